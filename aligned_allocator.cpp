@@ -1,20 +1,30 @@
 #include "stdafx.h"
+#include <algorithm>
 #include "aligned_allocator.h"
 
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace framework {
   namespace detail {
     void* allocate_aligned_memory(size_t align, size_t size) {
       assert(align >= sizeof(void*));
-      assert(size && ~size == size); // check that the size is a power of two, or 0.
+      assert((align & (align - 1)) == 0); // check that the alignment is a power of two
       if (size == 0) return nullptr;
-#ifdef _WIN32      
+#ifdef _WIN32
       return _aligned_malloc(size, align);
 #else
       void* ptr = nullptr;
       int rc = posix_memalign(&ptr, align, size);
       if (rc != 0) return nullptr;
       return ptr;
-#endif      
+#endif
     }
 
     void deallocate_aligned_memory(void *ptr) noexcept {
@@ -24,5 +34,131 @@ namespace framework {
       free(ptr);
 #endif
     }
+
+    static const size_t small_page_size = 4096;
+    static const size_t huge_page_size = 2 * 1024 * 1024;
+
+    static inline size_t round_up(size_t n, size_t m) noexcept {
+      return (n + m - 1) & ~(m - 1);
+    }
+
+    // write to every page, so it is faulted in now, and on our node if nothing says otherwise
+    static void prefault(void * p, size_t size) noexcept {
+      volatile char * c = static_cast<volatile char *>(p);
+      for (size_t i = 0; i < size; i += small_page_size) c[i] = 0;
+    }
+
+#if defined(_WIN32)
+
+    static size_t large_page_size() noexcept {
+      static size_t result = GetLargePageMinimum(); // 0 if unsupported
+      return result;
+    }
+
+    static size_t mapped_size(size_t size, unsigned hints) noexcept {
+      size_t large = large_page_size();
+      if ((hints & memory_explicit_huge) && large != 0 && size >= large) return round_up(size, large);
+      return round_up(size, small_page_size);
+    }
+
+    void* allocate_pages(size_t size, unsigned hints) {
+      if (size == 0) return nullptr;
+      size_t n = mapped_size(size, hints);
+      HANDLE process = GetCurrentProcess();
+      DWORD node = NUMA_NO_PREFERRED_NODE;
+      if (hints & memory_local) {
+        PROCESSOR_NUMBER processor;
+        GetCurrentProcessorNumberEx(&processor);
+        USHORT n16;
+        if (GetNumaProcessorNodeEx(&processor, &n16)) node = n16;
+      }
+      void* ptr = nullptr;
+      // large pages need SeLockMemoryPrivilege, which most accounts don't have
+      if (n != round_up(size, small_page_size))
+        ptr = VirtualAllocExNuma(process, nullptr, n, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE, node);
+      if (ptr == nullptr)
+        ptr = VirtualAllocExNuma(process, nullptr, n, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, node);
+      if (ptr != nullptr && (hints & memory_prefault)) prefault(ptr, n);
+      return ptr;
+    }
+
+    void deallocate_pages(void* ptr, size_t, unsigned) noexcept {
+      if (ptr != nullptr) VirtualFree(ptr, 0, MEM_RELEASE);
+    }
+
+#elif defined(__linux__)
+
+    // from numaif.h, so we don't need libnuma
+    static const int mpol_preferred = 1;
+
+    static size_t mapped_size(size_t size, unsigned hints) noexcept {
+      // a huge page we only half fill is worse than none
+      if ((hints & (memory_huge_pages | memory_explicit_huge)) && size >= huge_page_size) return round_up(size, huge_page_size);
+      return round_up(size, small_page_size);
+    }
+
+    // a private anonymous mapping of n bytes aligned to align, trimming what we over-asked for to get there
+    static void* map_aligned(size_t n, size_t align) noexcept {
+      size_t slack = align > small_page_size ? align : 0;
+      void* p = mmap(nullptr, n + slack, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (p == MAP_FAILED) return nullptr;
+      if (slack == 0) return p;
+      char* base = static_cast<char*>(p);
+      char* aligned = reinterpret_cast<char*>(round_up(uintptr_t(base), align));
+      if (aligned != base) munmap(base, size_t(aligned - base));
+      size_t tail = size_t(base + n + slack - (aligned + n));
+      if (tail != 0) munmap(aligned + n, tail);
+      return aligned;
+    }
+
+    void* allocate_pages(size_t size, unsigned hints) {
+      if (size == 0) return nullptr;
+      size_t n = mapped_size(size, hints);
+      bool huge = n != round_up(size, small_page_size);
+      void* ptr = nullptr;
+#ifdef MAP_HUGETLB
+      if (huge && (hints & memory_explicit_huge)) {
+        ptr = mmap(nullptr, n, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr == MAP_FAILED) ptr = nullptr; // no reserved pool, so see if transparent ones will do
+      }
+#endif
+      if (ptr == nullptr) {
+        // align to a huge page, or the kernel can't back the start of it with one
+        ptr = map_aligned(n, huge ? huge_page_size : small_page_size);
+        if (ptr == nullptr) return nullptr;
+#ifdef MADV_HUGEPAGE
+        if (huge) madvise(ptr, n, MADV_HUGEPAGE);
+#endif
+      }
+      if (hints & memory_local) {
+        unsigned cpu = 0, node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0 && node < 64) {
+          unsigned long mask = 1ul << node;
+          syscall(SYS_mbind, ptr, n, mpol_preferred, &mask, sizeof(mask) * 8, 0); // best effort
+        }
+      }
+      if (hints & memory_prefault) prefault(ptr, n);
+      return ptr;
+    }
+
+    void deallocate_pages(void* ptr, size_t size, unsigned hints) noexcept {
+      if (ptr != nullptr) munmap(ptr, mapped_size(size, hints));
+    }
+
+#else
+
+    // no pages of our own to hand out, but at least keep them page aligned and take the faults up front
+    void* allocate_pages(size_t size, unsigned hints) {
+      size_t n = round_up(size, small_page_size);
+      void* ptr = allocate_aligned_memory(small_page_size, n);
+      if (ptr != nullptr && (hints & memory_prefault)) prefault(ptr, n);
+      return ptr;
+    }
+
+    void deallocate_pages(void* ptr, size_t, unsigned) noexcept {
+      deallocate_aligned_memory(ptr);
+    }
+
+#endif
   }
-}
\ No newline at end of file
+}
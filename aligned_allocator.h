@@ -3,26 +3,72 @@
 #include "std.h"
 
 // this can be useful for cache alignment
+//
+// Big, long-lived buffers can also ask for how their pages are backed:
+//
+//   vector<tvec4<half>, aligned_allocator<tvec4<half>, 64, memory_bake>> cubemap;
+//
+// With any hints set, allocations of page_allocation_threshold bytes or more come straight from the OS, a page at
+// a time, rather than from the heap. From there:
+//
+// memory_huge_pages     asks for transparent huge pages with madvise on Linux, once a buffer is big enough to
+//                       fill one, so walking it costs a TLB miss per 2M rather than per 4k.
+// memory_explicit_huge  tries the reserved huge page pool first (MAP_HUGETLB, or MEM_LARGE_PAGES on Windows with
+//                       SeLockMemoryPrivilege), and falls back to the above when there isn't one.
+// memory_local          places the pages on the NUMA node of the calling thread. allocate from the worker that
+//                       will fill the buffer.
+// memory_prefault       touches every page up front, so the page faults are taken here rather than in the
+//                       middle of whatever first writes to it.
+//
+// None of these change what you get, only what it costs to touch, and any the OS can't do are quietly skipped.
+
+#if defined(_MSC_VER)
+#define FRAMEWORK_MALLOC __declspec(noalias) __declspec(restrict)
+#elif defined(__GNUC__)
+#define FRAMEWORK_MALLOC __attribute__((malloc))
+#else
+#define FRAMEWORK_MALLOC
+#endif
 
 namespace framework {
+
+  enum memory_hints : unsigned {
+    memory_default = 0,
+    memory_huge_pages = 1,
+    memory_explicit_huge = 2,
+    memory_local = 4,
+    memory_prefault = 8,
+    memory_bake = memory_huge_pages | memory_local | memory_prefault
+  };
+
+  static const size_t page_allocation_threshold = 16 * 1024; // smaller than this isn't worth a trip to the OS
+
   namespace detail {
-    __declspec(noalias) __declspec(restrict) void* allocate_aligned_memory(size_t align, size_t size);
+    FRAMEWORK_MALLOC void* allocate_aligned_memory(size_t align, size_t size);
     void deallocate_aligned_memory(void* ptr) noexcept;
+
+    // whole pages from the OS, aligned to at least a page. free with the same size and hints
+    FRAMEWORK_MALLOC void* allocate_pages(size_t size, unsigned hints);
+    void deallocate_pages(void* ptr, size_t size, unsigned hints) noexcept;
+
+    inline bool use_pages(size_t size, unsigned hints) noexcept {
+      return hints != memory_default && size >= page_allocation_threshold;
+    }
   }
 
-  template <typename T, size_t alignment = 32>
+  template <typename T, size_t alignment = 32, unsigned hints = memory_default>
   struct aligned_allocator;
 
-  template <size_t alignment>
-  struct aligned_allocator<void, alignment> {
+  template <size_t alignment, unsigned hints>
+  struct aligned_allocator<void, alignment, hints> {
     typedef void*             pointer;
     typedef const void*       const_pointer;
     typedef void              value_type;
 
-    template <class U> struct rebind { typedef aligned_allocator<U, alignment> other; };
+    template <class U> struct rebind { typedef aligned_allocator<U, alignment, hints> other; };
   };
 
-  template <typename T, size_t alignment> struct aligned_allocator {
+  template <typename T, size_t alignment, unsigned hints> struct aligned_allocator {
     typedef T         value_type;
     typedef T*        pointer;
     typedef const T*  const_pointer;
@@ -33,11 +79,11 @@ namespace framework {
 
     typedef std::true_type propagate_on_container_move_assignment;
 
-    template <class U> struct rebind { typedef aligned_allocator<U, alignment> other; };
+    template <class U> struct rebind { typedef aligned_allocator<U, alignment, hints> other; };
 
     aligned_allocator() noexcept {}
 
-    template <class U> aligned_allocator(const aligned_allocator<U, alignment>&) noexcept {}
+    template <class U> aligned_allocator(const aligned_allocator<U, alignment, hints>&) noexcept {}
 
     size_type max_size() const noexcept {
       return (size_type(~0) - size_type(alignment)) / sizeof(T);
@@ -51,13 +97,16 @@ namespace framework {
       return std::addressof(x);
     }
 
-    __declspec(noalias) __declspec(restrict) pointer allocate(size_type n, typename aligned_allocator<void, alignment>::const_pointer = 0) {
-      void* ptr = detail::allocate_aligned_memory(alignment, n * sizeof(T));
+    FRAMEWORK_MALLOC pointer allocate(size_type n, typename aligned_allocator<void, alignment, hints>::const_pointer = 0) {
+      size_type bytes = n * sizeof(T);
+      void* ptr = detail::use_pages(bytes, hints) ? detail::allocate_pages(bytes, hints) : detail::allocate_aligned_memory(alignment, bytes);
       if (ptr == nullptr) throw std::bad_alloc();      
       return reinterpret_cast<pointer>(ptr);
     }
 
-    void deallocate(pointer p, size_type) noexcept {
+    void deallocate(pointer p, size_type n) noexcept {
+      size_type bytes = n * sizeof(T);
+      if (detail::use_pages(bytes, hints)) return detail::deallocate_pages(p, bytes, hints);
       return detail::deallocate_aligned_memory(p);
     }
 
@@ -69,7 +118,7 @@ namespace framework {
     void destroy(pointer p) { p->~T(); }
   };
 
-  template <typename T, size_t alignment> struct aligned_allocator<const T, alignment> {
+  template <typename T, size_t alignment, unsigned hints> struct aligned_allocator<const T, alignment, hints> {
 
     typedef T         value_type;
     typedef const T*  pointer;
@@ -81,11 +130,11 @@ namespace framework {
 
     typedef std::true_type propagate_on_container_move_assignment;
 
-    template <class U> struct rebind { typedef aligned_allocator<U, alignment> other; };
+    template <class U> struct rebind { typedef aligned_allocator<U, alignment, hints> other; };
 
     aligned_allocator() noexcept {}
 
-    template <class U> aligned_allocator(const aligned_allocator<U, alignment>&) noexcept {}
+    template <class U> aligned_allocator(const aligned_allocator<U, alignment, hints>&) noexcept {}
 
     size_type max_size() const noexcept {
       return (size_type(~0) - size_type(alignment)) / sizeof(T);
@@ -95,8 +144,9 @@ namespace framework {
       return std::addressof(x);
     }
 
-    __declspec(noalias) __declspec(restrict) pointer allocate(size_type n, typename aligned_allocator<void, alignment>::const_pointer = 0) {
-      void* ptr = detail::allocate_aligned_memory(alignment, n * sizeof(T));
+    FRAMEWORK_MALLOC pointer allocate(size_type n, typename aligned_allocator<void, alignment, hints>::const_pointer = 0) {
+      size_type bytes = n * sizeof(T);
+      void* ptr = detail::use_pages(bytes, hints) ? detail::allocate_pages(bytes, hints) : detail::allocate_aligned_memory(alignment, bytes);
       if (ptr == nullptr) {
         throw std::bad_alloc();
       }
@@ -104,8 +154,10 @@ namespace framework {
       return reinterpret_cast<pointer>(ptr);
     }
 
-    void deallocate(pointer p, size_type) noexcept {
-      return detail::deallocate_aligned_memory(p);
+    void deallocate(pointer p, size_type n) noexcept {
+      size_type bytes = n * sizeof(T);
+      if (detail::use_pages(bytes, hints)) return detail::deallocate_pages(const_cast<T*>(p), bytes, hints);
+      return detail::deallocate_aligned_memory(const_cast<T*>(p));
     }
 
     template <class U, class ...Args> void construct(U* p, Args&&... args) {
@@ -115,13 +167,13 @@ namespace framework {
     void destroy(pointer p) { p->~T(); }
   };
 
-  template <typename T, size_t Talignment, typename U, size_t Ualignment>
-  inline bool operator== (const aligned_allocator<T, Talignment>&, const aligned_allocator<U, Ualignment>&) noexcept {
-    return Talignment == Ualignment;
+  template <typename T, size_t Talignment, unsigned Thints, typename U, size_t Ualignment, unsigned Uhints>
+  inline bool operator== (const aligned_allocator<T, Talignment, Thints>&, const aligned_allocator<U, Ualignment, Uhints>&) noexcept {
+    return Talignment == Ualignment && Thints == Uhints;
   }
 
-  template <typename T, size_t Talignment, typename U, size_t Ualignment>
-  inline bool operator!= (const aligned_allocator<T, Talignment>&, const aligned_allocator<U, Ualignment>&) noexcept {
-    return Talignment != Ualignment;
+  template <typename T, size_t Talignment, unsigned Thints, typename U, size_t Ualignment, unsigned Uhints>
+  inline bool operator!= (const aligned_allocator<T, Talignment, Thints>&, const aligned_allocator<U, Ualignment, Uhints>&) noexcept {
+    return Talignment != Ualignment || Thints != Uhints;
   }
 }
\ No newline at end of file
@@ -1,13 +1,14 @@
 #include "stdafx.h"
 #include <algorithm>
 #include <functional>
-#include <omp.h>
 #include <random>
 #include "distortion.h"
 #include "gl.h"
 #include "gui.h"
 #include "filesystem.h"
+#include "frame_arena.h"
 #include "openal.h"
+#include "pose_service.h"
 #include "post.h"
 #include "quality.h"
 #include "rendermodel.h"
@@ -16,17 +17,20 @@
 #include "spectrum.h"
 #include "timer.h"
 #include "worker.h"
+#include "frame_graph.h"
+#include "coroutine.h"
 #include "cds.h"
 #include "shaders/uniforms.h"
 #include "controllers.h"
 #include "sampling.h"
 #include "mesh.h"
+#include "memory_accounting.h"
+#include "metrics.h"
+#include "snapshot.h"
 
 using namespace framework;
 using namespace filesystem;
 
-static const int omp_threads = 6;
-
 // used reversed [1..0] floating point z rather than the classic [-1..1] mapping
 //#define USE_REVERSED_Z
 
@@ -84,6 +88,7 @@ struct app : app_uniforms {
   sdl::window window{ "framework", { 4, 5, gl::profile::core }, true, 50, 50, 1280, 1024 };
   gl::compiler compiler{ path("shaders") };
   openvr::system vr;
+  pose_service pose_stream{ vr }; // for anyone that wants fresher poses than the ones we wait on each frame
   openal::system al;
   rendermodel_manager rendermodels{ vr };
   quality quality{ 3 };
@@ -101,6 +106,9 @@ struct app : app_uniforms {
   bool gl_finish_hack = false;
   bool read_pixel_hack = true;
   bool show_sampling_debug_window = false;
+  bool show_scheduler_window = false;
+  bool show_metrics_window = false;
+  bool show_memory_window = false;
   
  // mesh dragon{ "dragon" }; // , "objects/dragon.obj"
   gui::system gui { window };
@@ -110,10 +118,17 @@ struct app : app_uniforms {
   bool skybox_visible = true;
   int controller_mask = 0;
   float last_resolve_buffer_usage = 0.f;
+  vr::TrackedDevicePose_t physical_pose[vr::k_unMaxTrackedDeviceCount]; // current poses
+  vr::TrackedDevicePose_t predicted_pose[vr::k_unMaxTrackedDeviceCount]; // poses 2 frames out
+  frame_graph frame; // everything up to submitting uniforms
+  versioned<app_uniforms> frame_state; // what we last submitted, for anyone off the render thread that wants poses or sky state
   
 private: 
   // void initialize_framebuffers();
-  void get_poses();
+  void build_frame_graph();
+  void wait_poses();
+  void update_poses(); // derive device and eye transforms from the latest poses, safe off of the render thread
+  void update_controllers();
   void update_controller_assignment();
   bool show_gui(bool * open = nullptr); // returns if we should shut down
   void desktop_display();
@@ -152,6 +167,7 @@ app::app() {
   glCreateBuffers(1, &ubo);
   gl::label(GL_BUFFER, ubo, "app ubo");
   glNamedBufferStorage(ubo, sizeof(app_uniforms), nullptr, GL_DYNAMIC_STORAGE_BIT | GL_MAP_WRITE_BIT);
+  gl::track_buffer(ubo, sizeof(app_uniforms));
   glBindBufferBase(GL_UNIFORM_BUFFER, 0, ubo); // INVARIANT: we keep this in this slot forever
 
   // load matrices.
@@ -177,7 +193,9 @@ app::app() {
   log("app")->info("desktop window refresh rate: {}hz", wdm.refresh_rate); // TODO: compute frame skipping for gui and desktop display off this relative to the vr rate.
 
   calculate_composite_frustum();
+  build_frame_graph();
   submit_uniforms(); // pre-load some data
+  frame_state.publish(static_cast<const app_uniforms &>(*this));
   SDL_StartTextInput();
 }
 
@@ -243,12 +261,11 @@ void app::update_controller_assignment() {
   }
 }
 
-void app::get_poses() {
-  vr::TrackedDevicePose_t physical_pose[vr::k_unMaxTrackedDeviceCount]; // current poses
-  vr::TrackedDevicePose_t predicted_pose[vr::k_unMaxTrackedDeviceCount]; // poses 2 frames out
-
+void app::wait_poses() {
   vr::VRCompositor()->WaitGetPoses(physical_pose, vr::k_unMaxTrackedDeviceCount, predicted_pose, vr::k_unMaxTrackedDeviceCount);
+}
 
+void app::update_poses() {
   device_mask = 0;
   for (int i = 0;i < vr::k_unMaxTrackedDeviceCount; ++i) {
     current_device_to_world[i] = openvr::hmd_mat3x4(physical_pose[i].mDeviceToAbsoluteTracking);
@@ -263,6 +280,16 @@ void app::get_poses() {
     predicted_device_velocity[i] = vector4(physical_pose[i].vVelocity.v);
   }
 
+  current_world_to_head = affineInverse(current_device_to_world[vr::k_unTrackedDeviceIndex_Hmd]);
+  predicted_world_to_head = affineInverse(predicted_device_to_world[vr::k_unTrackedDeviceIndex_Hmd]);
+
+  for (int i = 0; i < 2; ++i) {
+    current_pmv[i] = projection[i] * head_to_eye[i] * current_world_to_head;
+    predicted_pmv[i] = projection[i] * head_to_eye[i] * predicted_world_to_head;
+  }
+}
+
+void app::update_controllers() {
   update_controller_assignment();
 
   for (int i = 0;i < 2;++i) {
@@ -274,6 +301,7 @@ void app::get_poses() {
   }
      
   if (show_controllers_window && gui::Begin("Controllers", &show_controllers_window)) {
+    gui::Text("pose stream: %.0f Hz", pose_stream.rate());
     for (int i = 0;i < 2;++i) {
       if (controller_mask & (1 << i)) {
         gui::Text("controller %d", i);
@@ -332,43 +360,71 @@ void app::get_poses() {
     }
     gui::End();
   }
-
-  current_world_to_head = affineInverse(current_device_to_world[vr::k_unTrackedDeviceIndex_Hmd]);
-  predicted_world_to_head = affineInverse(predicted_device_to_world[vr::k_unTrackedDeviceIndex_Hmd]);
-
-  for (int i = 0; i < 2; ++i) {
-    current_pmv[i] = projection[i] * head_to_eye[i] * current_world_to_head;
-    predicted_pmv[i] = projection[i] * head_to_eye[i] * predicted_world_to_head;
-  }
 }
 
-
-void app::run() { 
-  while (!vr.poll() && !window.poll()) {
-    auto l = log("app");
-
-    timer::start_frame();
-
+void app::build_frame_graph() {
+  typedef frame_graph::affinity affinity;
+  auto l = log("app");
+  // resources are the addresses of whatever a stage touches
+  auto gui_state = &gui;
+  auto poses = &physical_pose;
+  auto device_transforms = &current_device_to_world;
+  auto viewport = &viewport_w;
+
+#ifdef FRAMEWORK_SUPPORTS_COROUTINES
+  // coroutines waiting on on_main_thread() or next_frame(), e.g. sky rebuilds ready to upload
+  frame.add("continuations", affinity::render_thread, {}, { &sky }, [] {
+    main_thread::drain();
+  });
+#endif
+  frame.add("gui frame", affinity::render_thread, {}, { gui_state }, [this, l] {
     l->info("gui frame");
     gui.new_frame();
-
+  });
+  frame.add("rendermodels", affinity::render_thread, {}, { &rendermodels }, [this, l] {
     l->info("polling rendermodels");
     rendermodels.poll();
-
+  });
+  frame.add("wait poses", affinity::render_thread, {}, { poses }, [this, l] {
     l->info("get_poses");
-    get_poses();
-
+    wait_poses();
+  });
+  // runs on the pool while the render thread gets on with quality.new_frame
+  frame.add("device transforms", affinity::any, { poses }, { device_transforms }, [this] {
+    update_poses();
+  });
+  frame.add("quality", affinity::render_thread, {}, { &quality, viewport, gui_state }, [this, l] {
     l->info("quality.new_frame");
     last_resolve_buffer_usage = resolve_buffer_usage;
     quality.new_frame(vr, &render_buffer_usage, &resolve_buffer_usage);
     viewport_w = quality.viewport_w;
     viewport_h = quality.viewport_h;
-
+  });
+  frame.add("controllers", affinity::render_thread, { device_transforms }, { &controllers, gui_state }, [this] {
+    update_controllers();
+  });
+  frame.add("sky", affinity::render_thread, { device_transforms }, { &sky, gui_state }, [this, l] {
     l->info("updating sky");
     sky.update(*this);
-
+  });
+  frame.add("submit uniforms", affinity::render_thread, { device_transforms, viewport, &sky, &controllers }, {}, [this, l] {
     l->info("submit_uniforms");
     submit_uniforms();
+  });
+  frame.add("publish frame state", affinity::render_thread, { device_transforms, viewport, &sky, &controllers }, { &frame_state }, [this] {
+    frame_state.publish(static_cast<const app_uniforms &>(*this));
+  });
+}
+
+
+void app::run() { 
+  while (!vr.poll() && !window.poll()) {
+    auto l = log("app");
+
+    timer::start_frame();
+    frame_arena::next_frame();
+
+    frame.run(chrono::steady_clock::now() + chrono::duration_cast<chrono::steady_clock::duration>(vr.time_to_photons())); // gui, poses, quality, sky and uniforms
 
 
     l->info("render_stencil");
@@ -600,6 +656,9 @@ bool app::show_gui(bool * open) {
       gui::MenuItem("Render Models", nullptr, &show_rendermodel_window);
       gui::MenuItem("Controllers", nullptr, &show_controllers_window);
       gui::MenuItem("Distributions", nullptr, &show_sampling_debug_window);
+      gui::MenuItem("Scheduler", nullptr, &show_scheduler_window);
+      gui::MenuItem("Metrics", nullptr, &show_metrics_window);
+      gui::MenuItem("Memory", nullptr, &show_memory_window);
       gui::EndMenu();
     }
 
@@ -609,6 +668,15 @@ bool app::show_gui(bool * open) {
   if (show_sampling_debug_window)
     sampling_debug_window(&show_sampling_debug_window, predicted_world_to_head);
 
+  if (show_scheduler_window)
+    scheduler_window(&show_scheduler_window);
+
+  if (show_metrics_window)
+    metrics_window(&show_metrics_window);
+
+  if (show_memory_window)
+    memory_window(&show_memory_window);
+
   if (show_settings_window) {
     ImGui::SetNextWindowSize(ImVec2(400, 200), ImGuiSetCond_FirstUseEver);
     gui::Begin("Settings", &show_settings_window);
@@ -668,6 +736,7 @@ int SDL_main(int argc, char ** argv) {
   logging::harness logs("vr", "al", "app", "main", "post", "distortion", "rendermodel","vao");
   SetProcessDPIAware(); // lest SDL2 lie and always tell us that DPI = 96
   cds_main_thread_attachment<> main_thread; // Allow use of concurrent data structures in the main threads
+  scheduler workers; // the one pool for parallel work, leaves a core free for the render thread
   log("main")->info("pid: {}", GetCurrentProcessId());
   // cd ../.. from the executable
   if (_wchdir(executable_path().parent_path().parent_path().parent_path().native().c_str()))
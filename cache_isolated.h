@@ -1,30 +1,35 @@
 #pragma once
 
+#include <cstdint>
+#include <utility>
+
 namespace framework {
 
   // try to ensure that T gets its own cache line.
-  template <typename T, size_t N = 64> 
+  template <typename T, size_t N = 64>
   struct cache_isolated {
     static const size_t padding_bytes = N;
 
     cache_isolated(const cache_isolated<T,N> & that) : data(that.data) {}
-    cache_isolated(T && data) : data(std::forward(data)) {}
-    template <typename ... T> cache_isolated(T&&...args) : data(std::forward(args)...) {}
+    template <typename ... Args> cache_isolated(Args && ... args) : data(std::forward<Args>(args)...) {}
 
-    cache_isolated & operator = (cache_isolated & that) {
+    cache_isolated & operator = (const cache_isolated & that) {
       data = that.data;
-      return this;
+      return *this;
     }
 
-    template <typename T> auto operator = (T && t) { data = t }
+    template <typename U> cache_isolated & operator = (U && u) {
+      data = std::forward<U>(u);
+      return *this;
+    }
 
   private:
     int8_t padding0[padding_bytes];
   public:
     T data;
   private:
-    int8_t padding1[padding_bytes - sizeof(T)];
+    int8_t padding1[padding_bytes - sizeof(T) % padding_bytes];
   };
 
 
-}
\ No newline at end of file
+}
@@ -1,10 +1,25 @@
 #pragma once
 
+#include <type_traits>
+#include <utility>
 #include "std.h"
 #include "aligned_allocator.h"
 #include "circular_array.h"
+#include "epoch.h"
 #include "noncopyable.h"
 
+// The C11 formulation of the Chase-Lev deque from
+// [Correct and Efficient Work-Stealing for Weak Memory Models](https://www.di.ens.fr/~zappa/readings/ppopp13.pdf)
+// by Nhat Minh Lê, Antoniu Pop, Albert Cohen and Francesco Zappa Nardelli.
+//
+// Only the owner may push or pop, at the bottom. Anyone may steal from the top. The fences are theirs, and are
+// what make this correct on ARM and POWER as well as x86: push publishes the element with a release fence before
+// bumping bottom, and both pop and steal need a full fence between their reads of top and bottom.
+//
+// Thieves read elements racily and only find out if they won with the CAS on top, so elements live in atomics.
+// Anything small and trivially copyable is stored as is. Anything else, including move-only types, is boxed on
+// the heap by push and unboxed by whoever wins it.
+
 namespace framework {
 
   static const size_t cache_line_size = 128;
@@ -15,63 +30,106 @@ namespace framework {
     aborted = 2
   };
 
+  namespace detail {
+    template <typename T, bool inline_ = std::is_trivially_copyable<T>::value && sizeof(T) <= sizeof(void*)>
+    struct deque_slot {
+      typedef T type;
+      static T wrap(T x) noexcept { return x; }
+      static T unwrap(T x) noexcept { return x; }
+      static void discard(T) noexcept {}
+    };
+
+    template <typename T> struct deque_slot<T, false> {
+      typedef T * type;
+      static T * wrap(T && x) { return new T(std::move(x)); }
+      static T unwrap(T * p) {
+        T result(std::move(*p));
+        delete p;
+        return result;
+      }
+      static void discard(T * p) noexcept { delete p; }
+    };
+  }
+
   // a growable, circular, work-stealing deque
   template <typename T, typename Allocator = aligned_allocator<T, cache_line_size>> struct chase_lev_deque : noncopyable {
     chase_lev_deque(size_t initial_size = 32);
     ~chase_lev_deque() noexcept;
 
     void push(T x); // allocates memory
-    inline T pop() noexcept;
+    inline T pop();
+
+    bool pop(T & result);
+    stealing steal(T & result);
+
+    // only a hint when called concurrently with thieves
+    bool empty() const noexcept {
+      return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+    }
+
+    size_t size() const noexcept { // likewise
+      int64_t n = bottom.load(std::memory_order_relaxed) - top.load(std::memory_order_relaxed);
+      return n > 0 ? size_t(n) : 0;
+    }
 
-    bool pop(T & result) noexcept;
-    stealing steal(T & result) noexcept;
+    size_t capacity() const noexcept { // owner only
+      return array.load(std::memory_order_relaxed)->size();
+    }
 
   private:
-    typedef circular_array<T, Allocator> circular_array_type;
+    typedef detail::deque_slot<T> slot;
+    typedef circular_array<typename slot::type, Allocator> circular_array_type;
 
     atomic<circular_array_type *> array;
-    atomic<size_t> top, bottom;
+    atomic<int64_t> top, bottom; // signed so that pop on an empty deque can briefly drive bottom below top
   };
 
   template <typename T, typename Allocator>
-  inline chase_lev_deque::chase_lev_deque(size_t initial_size) : array(new circular_array_type(initial_size)), top(0), bottom(0) {}
+  inline chase_lev_deque<T, Allocator>::chase_lev_deque(size_t initial_size) : array(new circular_array_type(initial_size)), top(0), bottom(0) {}
 
   template <typename T, typename Allocator>
-  inline chase_lev_deque::~chase_lev_deque() noexcept {
+  inline chase_lev_deque<T, Allocator>::~chase_lev_deque() noexcept {
     circular_array_type * p = array.load(std::memory_order_relaxed);
-    if (p) delete p;
+    if (p) {
+      for (int64_t i = top.load(std::memory_order_relaxed), b = bottom.load(std::memory_order_relaxed); i < b; ++i)
+        slot::discard(p->get(size_t(i)));
+      delete p;
+    }
   }
 
   template <typename T, typename Allocator>
-  inline void chase_lev_deque::push(T x) {
-    size_t b = bottom.load(std::memory_order_relaxed);
-    size_t t = top.load(std::memory_order_acquire);
+  inline void chase_lev_deque<T, Allocator>::push(T x) {
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
     circular_array_type * a = array.load(std::memory_order_relaxed);
-    if (b - t > a->size() - 1) {
-      a = a->grow(t, b);
-      array.store(a, std::memory_order_relaxed);
+    if (b - t > int64_t(a->size()) - 1) {
+      circular_array_type * old = a;
+      a = a->grow(size_t(t), size_t(b));
+      array.store(a, std::memory_order_release);
+      // thieves that loaded old before the store above may still be reading it
+      epoch_record::local().retire(*old);
     }
-    a->put(b, x);
+    a->put(size_t(b), slot::wrap(std::move(x)));
     std::atomic_thread_fence(std::memory_order_release);
     bottom.store(b + 1, std::memory_order_relaxed);
   }
 
   template <typename T, typename Allocator>
-  inline bool chase_lev_deque::pop(T & result) noexcept {
-    size_t b = bottom.load(std::memory_order_relaxed) - 1;
+  inline bool chase_lev_deque<T, Allocator>::pop(T & result) {
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
     circular_array_type * a = array.load(std::memory_order_relaxed);
     bottom.store(b, std::memory_order_relaxed);
     std::atomic_thread_fence(std::memory_order_seq_cst);
-    size_t t = top.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_relaxed);
     if (t <= b) {
-      T x = a->get(b);
+      typename slot::type x = a->get(size_t(b));
       if (t == b) {
-        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
-          return false;
-        }
+        // last element, race any thieves for it
+        bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
         bottom.store(b + 1, std::memory_order_relaxed);
+        if (!won) return false;
       }
-      result = x;
+      result = slot::unwrap(x);
       return true;
     } else {
       bottom.store(b + 1, std::memory_order_relaxed);
@@ -80,26 +138,29 @@ namespace framework {
   }
 
   template <typename T, typename Allocator>
-  inline T chase_lev_deque::pop() noexcept {
+  inline T chase_lev_deque<T, Allocator>::pop() {
     T result;
-    return pop(result) ? result : T();
+    return pop(result) ? std::move(result) : T();
   }
 
   template <typename T, typename Allocator>
-  inline stealing chase_lev_deque::steal(T & result) noexcept {
-    std::size_t t = top.load(std::memory_order_acquire);
+  inline stealing chase_lev_deque<T, Allocator>::steal(T & result) {
+    int64_t t = top.load(std::memory_order_acquire);
     std::atomic_thread_fence(std::memory_order_seq_cst);
-    std::size_t b = bottom.load(std::memory_order_acquire);
+    int64_t b = bottom.load(std::memory_order_acquire);
     if (t >= b) return stealing::empty;
-    if (t < b) {
-      circular_array_type * a = array.load(std::memory_order_relaxed);
-      T x = a->get(t);
-      if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    typename slot::type x;
+    {
+      // the owner may grow and retire the array under us, so only hold onto it inside a critical section.
+      // failed steals on an empty deque never get this far, and never pay for the fence in begin()
+      epoch_guard guard;
+      circular_array_type * a = array.load(std::memory_order_acquire);
+      x = a->get(size_t(t));
+      if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
         return stealing::aborted;
-      }
-      result = x;
-      return stealing::stolen;
     }
+    result = slot::unwrap(x);
+    return stealing::stolen;
   }
 
 }
@@ -2,43 +2,51 @@
 
 #include "std.h"
 #include "aligned_allocator.h"
+#include "epoch.h"
 
 namespace framework {
 
   static const int cacheline_size = 64;
 
+  // the backing store for chase_lev_deque. T is whatever fits in a lock-free atomic<T>: the deque boxes anything else.
+  //
+  // when we grow, thieves may still be reading the old array, so it is handed to the epoch collector rather than
+  // deleted, and is gone a couple of epochs later instead of living as long as the deque does.
   template <typename T, typename Allocator = aligned_allocator<atomic<T>, 128>>
-  struct circular_array {
-    // We can fix this later with a bunch of placement news, but it is expensive and I'm lazy.
-    static_assert(sizeof(T) == sizeof(atomic<T>));
+  struct circular_array : epoch_entry {
+    static_assert(sizeof(T) == sizeof(atomic<T>), "circular_array requires a lock-free atomic<T>");
+
+    typedef typename Allocator::template rebind<atomic<T>>::other allocator_type;
 
     size_t N;
-    Allocator allocator;
+    allocator_type allocator;
 
-    circular_array(size_t N) : N(N), allocator() {
+    circular_array(size_t N) : N(N), allocator(), items(allocator.allocate(N)) {
       assert(N > 0);
-      assert(N&~N == N); // N is a power of two
-      allocator.allocate(N);
+      assert((N & (N - 1)) == 0); // N is a power of two
+      for (size_t i = 0; i < N; ++i)
+        new (&items[i]) atomic<T>();
+    }
+    ~circular_array() {
+      allocator.deallocate(items, N);
     }
     size_t size() const noexcept {
       return N;
     }
-    T get(size_t index) {
+    T get(size_t index) const noexcept {
       return items[index & (size() - 1)].load(std::memory_order_relaxed);
     }
-    void put(size_t index, T x) {
+    void put(size_t index, T x) noexcept {
       items[index & (size() - 1)].store(x, std::memory_order_relaxed);
     }
-    circular_array * grow(size_t top, size_t bottom) {
+    // a copy twice the size holding [top, bottom). the caller is responsible for retiring this one
+    circular_array * grow(size_t top, size_t bottom) const {
       circular_array * new_array = new circular_array(N * 2);
-      new_array->previous.reset(this);
       for (std::size_t i = top; i != bottom; ++i)
         new_array->put(i, get(i));
       return new_array;
     }
   private:
-    atomic<T*> * items;
-    aligned_array<atomic<T*>, 64> items;
-    unique_ptr<circular_array> previous;
+    atomic<T> * items;
   };
-}
\ No newline at end of file
+}
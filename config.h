@@ -5,9 +5,6 @@
 
 #define FRAMEWORK_PLATFORM_WIN32
 
-// notably not set on ARM
-#define FRAMEWORK_MEMORYMODEL_TSO
-
 // Simple Direct Media Layer 2
 #define FRAMEWORK_SUPPORTS_SDL2
 
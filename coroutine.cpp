@@ -0,0 +1,68 @@
+#include "stdafx.h"
+#include "coroutine.h"
+
+#ifdef FRAMEWORK_SUPPORTS_COROUTINES
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace framework {
+
+  namespace {
+    const thread::id main_id = this_thread::get_id(); // static initialization happens on the main thread
+    mutex main_mutex;
+    vector<coro::coroutine_handle<>> this_frame, later_frames;
+
+    struct detached {
+      struct promise_type {
+        detached get_return_object() noexcept { return {}; }
+        coro::suspend_never initial_suspend() noexcept { return {}; }
+        coro::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept {
+          try {
+            throw;
+          } catch (std::exception & e) {
+            log("coroutine")->critical("detached coroutine failed: {}", e.what());
+          } catch (...) {
+            log("coroutine")->critical("detached coroutine failed: non std::exception caught");
+          }
+        }
+      };
+    };
+
+    detached run_detached(async<void> t) {
+      co_await t;
+    }
+  }
+
+  bool main_thread::current() noexcept {
+    return this_thread::get_id() == main_id;
+  }
+
+  void main_thread::post(coro::coroutine_handle<> h, bool next_frame) {
+    lock_guard<mutex> lock(main_mutex);
+    (next_frame ? later_frames : this_frame).push_back(h);
+  }
+
+  void main_thread::drain() {
+    vector<coro::coroutine_handle<>> ready;
+    {
+      lock_guard<mutex> lock(main_mutex);
+      ready.swap(this_frame);
+      ready.insert(ready.end(), later_frames.begin(), later_frames.end());
+      later_frames.clear();
+    }
+    // anything these post goes to the next drain
+    for (auto h : ready) h.resume();
+  }
+
+  void detach(async<void> t) {
+    run_detached(std::move(t));
+  }
+}
+
+#endif
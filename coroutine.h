@@ -0,0 +1,164 @@
+#pragma once
+
+// Coroutines on top of framework::pool, for multi-stage jobs that would otherwise be written as
+// something polled once a frame.
+//
+//   async<void> rebuild() {
+//     co_await p.schedule();     // hop onto a worker
+//     ... expensive work ...
+//     co_await on_main_thread(); // hop back for GL
+//     ... upload ...
+//   }
+//
+// Nothing here blocks a thread. Awaiting an async<T> starts it, and the awaiting coroutine resumes on
+// whichever thread the async<T> finishes on, or just carries on if it finished before we could suspend. on_main_thread() and next_frame() resume when main calls
+// main_thread::drain() at the top of a frame.
+//
+// This needs C++20 coroutines, or the Coroutines TS (/await on MSVC). Without either, only the
+// pool::schedule() awaiter in worker.h exists and FRAMEWORK_SUPPORTS_COROUTINES stays undefined.
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#define FRAMEWORK_SUPPORTS_COROUTINES
+namespace framework { namespace coro = std; }
+#elif defined(_RESUMABLE_FUNCTIONS_SUPPORTED)
+#include <experimental/resumable>
+#define FRAMEWORK_SUPPORTS_COROUTINES
+namespace framework { namespace coro = std::experimental; }
+#elif defined(__cpp_coroutines)
+#include <experimental/coroutine>
+#define FRAMEWORK_SUPPORTS_COROUTINES
+namespace framework { namespace coro = std::experimental; }
+#endif
+
+#ifdef FRAMEWORK_SUPPORTS_COROUTINES
+
+#include <atomic>
+#include <cassert>
+#include <exception>
+#include <new>
+#include <utility>
+
+#include "noncopyable.h"
+#include "worker.h"
+
+namespace framework {
+
+  struct main_thread {
+    static bool current() noexcept; // are we on it?
+    static void drain(); // resume everything waiting on on_main_thread() or next_frame(). call once per frame from main.
+    static void post(coro::coroutine_handle<> h, bool next_frame);
+  };
+
+  // resumes on the main thread, immediately if we're already there
+  struct on_main_thread {
+    bool await_ready() const noexcept { return main_thread::current(); }
+    void await_suspend(coro::coroutine_handle<> h) { main_thread::post(h, false); }
+    void await_resume() const noexcept {}
+  };
+
+  // resumes on the main thread at the start of the next frame
+  struct next_frame {
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(coro::coroutine_handle<> h) { main_thread::post(h, true); }
+    void await_resume() const noexcept {}
+  };
+
+  namespace detail {
+    struct async_promise_base {
+      coro::coroutine_handle<> continuation;
+      std::exception_ptr error;
+      std::atomic<bool> handoff{ false }; // set by whichever of us and our awaiter gets to the end of its side first
+
+      // start us on behalf of awaiting. returns false if we already finished, so the awaiter carries on where it
+      // is rather than being resumed from inside of our final_suspend one stack frame deeper on every co_await
+      bool start(coro::coroutine_handle<> self, coro::coroutine_handle<> awaiting) {
+        continuation = awaiting;
+        self.resume();
+        return !handoff.exchange(true, std::memory_order_acq_rel);
+      }
+
+      coro::suspend_always initial_suspend() noexcept { return {}; } // we start when awaited
+
+      // hand control to whoever awaited us, if they have already suspended. otherwise start() lets them continue
+      struct final_awaiter {
+        async_promise_base * p;
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(coro::coroutine_handle<>) noexcept {
+          if (p->handoff.exchange(true, std::memory_order_acq_rel)) p->continuation.resume();
+        }
+        void await_resume() const noexcept {}
+      };
+      final_awaiter final_suspend() noexcept { return final_awaiter{ this }; }
+
+      void unhandled_exception() noexcept { error = std::current_exception(); }
+      void rethrow() const {
+        if (error) std::rethrow_exception(error);
+      }
+    };
+  }
+
+  // a lazily started coroutine producing a T
+  template <typename T = void> struct async : noncopyable {
+    struct promise_type : detail::async_promise_base {
+      ~promise_type() { if (has_value) value().~T(); }
+      async get_return_object() { return async(coro::coroutine_handle<promise_type>::from_promise(*this)); }
+      template <typename U> void return_value(U && u) {
+        new (storage) T(std::forward<U>(u));
+        has_value = true;
+      }
+      T & value() noexcept { return *reinterpret_cast<T*>(storage); }
+      bool has_value = false;
+      alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    explicit async(coro::coroutine_handle<promise_type> h) noexcept : h(h) {}
+    async(async && that) noexcept : h(that.h) { that.h = nullptr; }
+    async & operator = (async && that) noexcept {
+      std::swap(h, that.h);
+      return *this;
+    }
+    ~async() { if (h) h.destroy(); }
+
+    bool await_ready() const noexcept {
+      assert(h); // empty or moved from
+      return h.done();
+    }
+    bool await_suspend(coro::coroutine_handle<> awaiting) { return h.promise().start(h, awaiting); }
+    T await_resume() {
+      h.promise().rethrow();
+      return std::move(h.promise().value());
+    }
+
+    coro::coroutine_handle<promise_type> h;
+  };
+
+  template <> struct async<void> : noncopyable {
+    struct promise_type : detail::async_promise_base {
+      async get_return_object() { return async(coro::coroutine_handle<promise_type>::from_promise(*this)); }
+      void return_void() noexcept {}
+    };
+
+    explicit async(coro::coroutine_handle<promise_type> h) noexcept : h(h) {}
+    async(async && that) noexcept : h(that.h) { that.h = nullptr; }
+    async & operator = (async && that) noexcept {
+      std::swap(h, that.h);
+      return *this;
+    }
+    ~async() { if (h) h.destroy(); }
+
+    bool await_ready() const noexcept {
+      assert(h); // empty or moved from
+      return h.done();
+    }
+    bool await_suspend(coro::coroutine_handle<> awaiting) { return h.promise().start(h, awaiting); }
+    void await_resume() { h.promise().rethrow(); }
+
+    coro::coroutine_handle<promise_type> h;
+  };
+
+  // start t now and let it run to completion on its own. exceptions are logged and dropped, as nobody is left to catch them
+  void detach(async<void> t);
+}
+
+#endif
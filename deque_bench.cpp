@@ -0,0 +1,226 @@
+#include "stdafx.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "chase_lev_deque.h"
+#include "epoch.h"
+
+// Stress tests and microbenchmarks for chase_lev_deque.
+//
+//   deque_bench [--thieves 1,3,7] [--items n] [--rounds n] [--quick]
+//
+// The stress tests start from a tiny array so the owner grows it constantly under thieves, then check that every
+// item pushed came out exactly once, for a pointer-sized T stored in place and for a move-only T that gets boxed.
+// They also report how many retired arrays the epoch collector is still holding onto, which batching keeps to
+// around epoch_batch.
+//
+// The benchmarks time the owner alone (push then pop), and one owner pushing against n thieves, for the deque
+// and for a std::deque behind a mutex. Any lost or duplicated item exits 1, so this doubles as a smoke test.
+
+using namespace std;
+using namespace std::chrono;
+using namespace framework;
+
+namespace {
+
+  struct options {
+    vector<int> thieves;
+    uint64_t items = 1 << 20;
+    int rounds = 8;
+  };
+
+  vector<int> parse_list(const char * s) {
+    vector<int> result;
+    stringstream ss(s);
+    string item;
+    while (getline(ss, item, ',')) result.push_back(atoi(item.c_str()));
+    return result;
+  }
+
+  [[noreturn]] void usage() {
+    cerr << "usage: deque_bench [--thieves 1,3,7] [--items n] [--rounds n] [--quick]\n";
+    exit(2);
+  }
+
+  // how T gets in and out of the deque, and back to the id we check off
+  template <typename T> struct item;
+  template <> struct item<uint64_t> {
+    static uint64_t make(uint64_t i) { return i + 1; } // 0 is what a default constructed T looks like
+    static uint64_t id(const uint64_t & x) { return x - 1; }
+  };
+  template <> struct item<unique_ptr<uint64_t>> {
+    static unique_ptr<uint64_t> make(uint64_t i) { return unique_ptr<uint64_t>(new uint64_t(i)); }
+    static uint64_t id(const unique_ptr<uint64_t> & x) { return *x; }
+  };
+
+  // one owner pushing n items in random bursts and popping some back, against thieves. every item must come out once
+  template <typename T> bool stress(const char * name, int thieves, uint64_t n, int rounds) {
+    epoch_record & r = epoch_record::local();
+    uint64_t reclaimed = r.stats().reclaimed;
+    bool ok = true;
+    for (int round = 0; round < rounds && ok; ++round) {
+      chase_lev_deque<T> d(2);
+      vector<atomic<uint8_t>> seen(n);
+      for (auto && s : seen) s.store(0, memory_order_relaxed);
+      atomic<bool> done(false);
+
+      auto check_off = [&](const T & x) {
+        seen[item<T>::id(x)].fetch_add(1, memory_order_relaxed);
+      };
+
+      vector<thread> threads;
+      for (int i = 0; i < thieves; ++i)
+        threads.emplace_back([&] {
+          T x;
+          while (!done.load(memory_order_acquire))
+            if (d.steal(x) == stealing::stolen) check_off(x);
+        });
+
+      mt19937_64 rng(round);
+      uint64_t next = 0;
+      while (next < n) {
+        uint64_t burst = min<uint64_t>(n - next, rng() % 256);
+        for (uint64_t i = 0; i < burst; ++i) d.push(item<T>::make(next++));
+        for (uint64_t i = rng() % (burst + 1); i > 0; --i) {
+          T x;
+          if (!d.pop(x)) break;
+          check_off(x);
+        }
+      }
+      T x;
+      while (d.pop(x)) check_off(x);
+      done.store(true, memory_order_release);
+      for (auto && t : threads) t.join();
+
+      uint64_t lost = 0, duplicated = 0;
+      for (auto && s : seen) {
+        uint8_t k = s.load(memory_order_relaxed);
+        if (k == 0) ++lost;
+        else if (k > 1) ++duplicated;
+      }
+      if (lost || duplicated) {
+        cerr << name << ": round " << round << " with " << thieves << " thieves lost " << lost << " and duplicated " << duplicated << " of " << n << " items\n";
+        ok = false;
+      }
+    }
+    epoch_stats e = r.stats();
+    cout << name << ", " << thieves << " thieves: " << (ok ? "ok" : "FAILED") << ", "
+         << e.reclaimed - reclaimed << " arrays reclaimed, " << e.pending << " pending, peak " << e.peak << "\n";
+    return ok;
+  }
+
+  // the obvious alternative
+  struct locked_deque {
+    void push(uint64_t x) {
+      lock_guard<mutex> lock(m);
+      d.push_back(x);
+    }
+    bool pop(uint64_t & x) {
+      lock_guard<mutex> lock(m);
+      if (d.empty()) return false;
+      x = d.back();
+      d.pop_back();
+      return true;
+    }
+    stealing steal(uint64_t & x) {
+      lock_guard<mutex> lock(m);
+      if (d.empty()) return stealing::empty;
+      x = d.front();
+      d.pop_front();
+      return stealing::stolen;
+    }
+    mutex m;
+    std::deque<uint64_t> d;
+  };
+
+  double seconds_since(steady_clock::time_point start) {
+    return duration<double>(steady_clock::now() - start).count();
+  }
+
+  // owner only: n pushes then n pops, in ns per operation
+  template <typename D> double owner_only(uint64_t n) {
+    D d;
+    auto start = steady_clock::now();
+    for (uint64_t i = 1; i <= n; ++i) d.push(i);
+    uint64_t x, sum = 0;
+    while (d.pop(x)) sum += x;
+    double elapsed = seconds_since(start);
+    if (sum != n * (n + 1) / 2) {
+      cerr << "owner_only: lost items\n";
+      exit(1);
+    }
+    return elapsed * 1e9 / double(2 * n);
+  }
+
+  // the owner pushes n items and pops when it can while thieves steal. millions of items through per second
+  template <typename D> double contended(int thieves, uint64_t n) {
+    D d;
+    atomic<bool> done(false);
+    atomic<uint64_t> sum(0), count(0);
+    vector<thread> threads;
+    for (int i = 0; i < thieves; ++i)
+      threads.emplace_back([&] {
+        uint64_t x, s = 0, c = 0;
+        while (!done.load(memory_order_acquire))
+          if (d.steal(x) == stealing::stolen) s += x, ++c;
+        sum.fetch_add(s);
+        count.fetch_add(c);
+      });
+    auto start = steady_clock::now();
+    uint64_t x, s = 0, c = 0;
+    for (uint64_t i = 1; i <= n; ++i) {
+      d.push(i);
+      if ((i & 3) == 0 && d.pop(x)) s += x, ++c;
+    }
+    while (d.pop(x)) s += x, ++c;
+    done.store(true, memory_order_release);
+    for (auto && t : threads) t.join();
+    double elapsed = seconds_since(start);
+    if (sum.load() + s != n * (n + 1) / 2 || count.load() + c != n) {
+      cerr << "contended: lost or duplicated items\n";
+      exit(1);
+    }
+    return double(n) / elapsed * 1e-6;
+  }
+}
+
+int main(int argc, char ** argv) {
+  options o;
+  for (int i = 1; i < argc; ++i) {
+    string a = argv[i];
+    bool more = i + 1 < argc;
+    if (a == "--thieves" && more) o.thieves = parse_list(argv[++i]);
+    else if (a == "--items" && more) o.items = max<uint64_t>(1, strtoull(argv[++i], nullptr, 10));
+    else if (a == "--rounds" && more) o.rounds = max(1, atoi(argv[++i]));
+    else if (a == "--quick") {
+      o.items = 1 << 16;
+      o.rounds = 2;
+    } else usage();
+  }
+  if (o.thieves.empty()) {
+    int n = max(2, int(thread::hardware_concurrency()));
+    for (int t = 1; t < n; t = t * 2 + 1) o.thieves.push_back(t);
+  }
+
+  bool ok = true;
+  for (int t : o.thieves) {
+    if (t < 1) usage();
+    ok = stress<uint64_t>("stress inline", t, o.items, o.rounds) && ok;
+    ok = stress<unique_ptr<uint64_t>>("stress boxed", t, o.items / 4, o.rounds) && ok;
+  }
+
+  cout << "\nbenchmark,thieves,chase_lev,locked,unit\n";
+  cout << "owner_only,0," << owner_only<chase_lev_deque<uint64_t>>(o.items) << "," << owner_only<locked_deque>(o.items) << ",ns/op\n";
+  for (int t : o.thieves)
+    cout << "contended," << t << "," << contended<chase_lev_deque<uint64_t>>(t, o.items) << "," << contended<locked_deque>(t, o.items) << ",Mitems/s\n";
+  return ok ? 0 : 1;
+}
@@ -1,25 +1,178 @@
 #include "stdafx.h"
+#include <algorithm>
+#include <thread>
 #include "epoch.h"
 
-#if 0
-
 namespace framework {
-  epoch_record::epoch_record(epoch_manager & global) 
-  : global(global) 
+  epoch_record::epoch_record(epoch_manager & global)
+  : global(global)
+  , epoch(0)
   , used(true)
   , active(0)
-  , epoch(0)
-  , dispatch_count(0)
-  , peak(0)
+  , bucket{ { 0, 0 }, { 0, 0 } }
   , pending_count(0)
-  , pending{ nullptr, nullptr, nullptr, nullptr } {
+  , peak(0)
+  , dispatch_count(0)
+  , pending{ nullptr, nullptr, nullptr, nullptr }
+  , pending_epoch{ 0, 0, 0, 0 } {
     atomic_thread_fence(std::memory_order_release);
     // cons onto global list, upmc
-    do {
-      next = global.records.load(std::memory_order_relaxed);
-      atomic_thread_fence(std::memory_order_release);
-    } while (!global.records.compare_exchange_weak(next, this, std::memory_order_relaxed));
+    next = global.records.load(std::memory_order_relaxed);
+    while (!global.records.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed)) {}
+  }
+
+  // only ever bumped by whoever owns the record, so no need for a locked add
+  static inline void bump(atomic<uint64_t> & counter, uint64_t n = 1) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+
+  // an entry retired in epoch e may still be visible to readers that began in e, but not once the global epoch is e + 2
+  static inline bool safe(uint32_t retired, uint32_t now) noexcept {
+    return int32_t(now - retired) >= 2;
+  }
+
+  void epoch_record::retire(epoch_entry & entry) {
+    // make sure whoever unlinked entry did so before we read the epoch
+    atomic_thread_fence(std::memory_order_seq_cst);
+    uint32_t e = global.epoch.load(std::memory_order_acquire);
+    int bucket = e & epoch_mask;
+    // anything still here is from 4 epochs back, so long dead
+    if (pending[bucket] != nullptr && pending_epoch[bucket] != e && safe(pending_epoch[bucket], e)) dispatch(bucket);
+    entry.next_epoch_entry = pending[bucket];
+    pending[bucket] = &entry;
+    pending_epoch[bucket] = e;
+    bump(pending_count);
+    uint64_t n = pending_count.load(std::memory_order_relaxed);
+    if (n > peak.load(std::memory_order_relaxed)) peak.store(n, std::memory_order_relaxed);
+    if (n >= epoch_batch) poll(); // scanning every record is the expensive part, so only do it for a batch at a time
+  }
+
+  bool epoch_record::poll() {
+    global.try_advance();
+    bool any = reclaim();
+    if (global.free_count.load(std::memory_order_relaxed) != 0) any = global.reclaim_orphans() || any;
+    return any;
+  }
+
+  bool epoch_record::reclaim() {
+    uint32_t e = global.epoch.load(std::memory_order_acquire);
+    bool any = false;
+    for (int i = 0; i < epoch_length; ++i) {
+      if (pending[i] != nullptr && safe(pending_epoch[i], e)) {
+        dispatch(i);
+        any = true;
+      }
+    }
+    return any;
+  }
+
+  void epoch_record::synchronize() {
+    assert(active.load(std::memory_order_relaxed) == 0);
+    uint32_t start = global.epoch.load(std::memory_order_acquire);
+    while (!safe(start, global.epoch.load(std::memory_order_acquire)))
+      if (!global.try_advance()) std::this_thread::yield();
   }
-}
 
-#endif
\ No newline at end of file
+  void epoch_record::dispatch(int bucket) {
+    uint64_t i = 0;
+    epoch_entry * n;
+    for (epoch_entry * cursor = pending[bucket]; cursor != nullptr; cursor = n) {
+      n = cursor->next_epoch_entry;
+      delete cursor;
+      ++i;
+    }
+    pending[bucket] = nullptr;
+    bump(dispatch_count, i);
+    pending_count.store(pending_count.load(std::memory_order_relaxed) - i, std::memory_order_relaxed);
+  }
+
+  void epoch_record::unregister() {
+    assert(active.load(std::memory_order_relaxed) == 0);
+    // whatever isn't safe yet stays on our pending lists, for whoever recycles us or polls in the meantime
+    poll();
+    used.store(false, std::memory_order_release);
+    global.free_count.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  epoch_stats epoch_record::stats() const noexcept {
+    epoch_stats result;
+    result.epoch = global.epoch.load(std::memory_order_relaxed);
+    result.records = used.load(std::memory_order_relaxed) ? 1 : 0;
+    result.active = active.load(std::memory_order_relaxed) != 0 ? 1 : 0;
+    result.pending = pending_count.load(std::memory_order_relaxed);
+    result.peak = peak.load(std::memory_order_relaxed);
+    result.reclaimed = dispatch_count.load(std::memory_order_relaxed);
+    return result;
+  }
+
+  epoch_record & epoch_record::local() {
+    struct registration {
+      epoch_record & r;
+      registration() : r(epoch_manager::global().acquire()) {}
+      ~registration() { r.unregister(); }
+    };
+    static thread_local registration self;
+    return self.r;
+  }
+
+  epoch_record * epoch_manager::recycle() {
+    if (free_count.load(std::memory_order_relaxed) == 0)
+      return nullptr;
+    for (epoch_record * cursor = records.load(std::memory_order_acquire); cursor != nullptr; cursor = cursor->next) {
+      if (cursor->used.load(std::memory_order_relaxed) == false && !cursor->used.exchange(true, std::memory_order_acquire)) {
+        free_count.fetch_sub(1, std::memory_order_relaxed);
+        return cursor;
+      }
+    }
+    return nullptr;
+  }
+
+  epoch_record & epoch_manager::acquire() {
+    if (epoch_record * r = recycle()) return *r;
+    return *new epoch_record(*this);
+  }
+
+  bool epoch_manager::reclaim_orphans() {
+    bool any = false;
+    for (epoch_record * cursor = records.load(std::memory_order_acquire); cursor != nullptr; cursor = cursor->next) {
+      if (cursor->used.load(std::memory_order_relaxed) || cursor->pending_count.load(std::memory_order_relaxed) == 0) continue;
+      // borrow it, so nobody recycles it out from under us, then put it back
+      if (cursor->used.exchange(true, std::memory_order_acquire)) continue;
+      any = cursor->reclaim() || any;
+      cursor->used.store(false, std::memory_order_release);
+    }
+    return any;
+  }
+
+  bool epoch_manager::try_advance() noexcept {
+    // pairs with the fence in begin(): either we see them active, or they see any epoch we publish
+    atomic_thread_fence(std::memory_order_seq_cst);
+    uint32_t e = epoch.load(std::memory_order_relaxed);
+    for (epoch_record * cursor = records.load(std::memory_order_acquire); cursor != nullptr; cursor = cursor->next) {
+      // acquire, so everything a reader did before leaving happens before anything we let be deleted
+      if (cursor->active.load(std::memory_order_acquire) != 0 && cursor->epoch.load(std::memory_order_acquire) != e)
+        return false;
+    }
+    epoch.compare_exchange_strong(e, e + 1, std::memory_order_acq_rel, std::memory_order_relaxed);
+    return true;
+  }
+
+  epoch_stats epoch_manager::stats() const noexcept {
+    epoch_stats result;
+    result.epoch = epoch.load(std::memory_order_relaxed);
+    for (epoch_record * cursor = records.load(std::memory_order_acquire); cursor != nullptr; cursor = cursor->next) {
+      epoch_stats s = cursor->stats();
+      result.records += s.records;
+      result.active += s.active;
+      result.pending += s.pending;
+      result.peak = std::max(result.peak, s.peak);
+      result.reclaimed += s.reclaimed;
+    }
+    return result;
+  }
+
+  epoch_manager & epoch_manager::global() {
+    static epoch_manager * instance = new epoch_manager; // leaked, so thread_local records can outlive static destruction
+    return *instance;
+  }
+}
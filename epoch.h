@@ -3,35 +3,49 @@
 #include "config.h"
 #include <cassert>
 #include "std.h"
-#include "cache_isolated.h"
-
-#if 0
+#include "noncopyable.h"
 
 // Epoch-based reclamation
 
 // Based on
 // [Practical Lock-freedom](https://www.cl.cam.ac.uk/techreports/UCAM-CL-TR-579.pdf)
-// by Keir Fraser 
+// by Keir Fraser
 // (Found in Section 5.2.3)
 
 // Current implementation lifted almost entirely from Samy Al Bahra's excellent
 // ConcurrencyKit. Bugs mine.
-
-// work-in-progress
+//
+// Readers bracket their use of shared pointers with begin() and end(). Whoever unlinks an object hands it to
+// retire(), and it is deleted once the global epoch has moved on twice, by which point every reader that could
+// have seen it has left its critical section. The epoch only advances when every active record has observed
+// the current one, so a reader that stalls inside a critical section stalls reclamation, never correctness.
+//
+// A reader pays for one fence in begin() and a store in end(), against a fence per pointer loaded for hazard
+// pointers, which is why this is the scheme of choice for read-mostly structures. See epoch_bench.cpp.
+//
+// Retirement is batched: retire() only tries to advance the epoch once epoch_batch entries are waiting. Pool
+// workers register a record when they start and poll() whenever they run out of work, so anything they retire
+// is collected soon enough; other threads get a record on first use of epoch_record::local() and should poll()
+// or barrier() now and then if they retire in small numbers.
+//
+// Nothing here assumes TSO: begin() needs a full fence between announcing itself and reading the global epoch.
 
 namespace framework {
   static const int epoch_length = 4;
   static const int epoch_mask = 3;
+  static const uint32_t epoch_batch = 64; // retirements we let pile up before trying to reclaim any of them
 
+  // a long-lived critical section. sections let a thread that is never quite quiescent, like one that always
+  // holds some section open, still let the epoch advance past the ones it has closed
   struct epoch_section {
-    uint32_t bucket;  
+    uint32_t bucket;
   };
 
   // things that inherit from this can be collected
   struct epoch_entry {
     virtual ~epoch_entry() {}
     // TODO: private w/ friends
-    epoch_entry * next_epoch_entry;
+    epoch_entry * next_epoch_entry = nullptr;
   };
 
   struct epoch_manager;
@@ -41,61 +55,62 @@ namespace framework {
     uint32_t count;
   };
 
-  struct epoch_record {
+  struct epoch_stats {
+    uint32_t epoch = 0; // the global epoch
+    uint64_t records = 0; // registered and in use
+    uint64_t active = 0; // in a critical section right now
+    uint64_t pending = 0; // retired, but not yet safe to delete
+    uint64_t peak = 0; // the most any one record has had pending at once
+    uint64_t reclaimed = 0; // deleted
+  };
+
+  // per thread. records are never freed, only unregistered and recycled, as other threads may be scanning them
+  struct epoch_record : noncopyable {
     epoch_record(epoch_manager & global);
-    const epoch_manager & global;
-    atomic<uint32_t> epoch; 
+    epoch_manager & global;
+    atomic<uint32_t> epoch; // the oldest global epoch our open sections have seen
     atomic<bool> used; // if false, we're free and waiting for pickup during scan
-    atomic<uint32_t> active;
-    cache_isolated<epoch_ref[2]> bucket;
-    uint32_t pending_count, peak, dispatch_count; // usage statistics
+    atomic<uint32_t> active; // critical section nesting depth
+    epoch_ref bucket[2]; // open sections by the parity of the epoch they began in
+    atomic<uint64_t> pending_count, peak, dispatch_count; // usage statistics, written only by whoever owns us
     epoch_entry * pending[epoch_length];
+    uint32_t pending_epoch[epoch_length]; // the latest epoch retired into each pending list
     epoch_record * next;
-    void unregister();
-    bool poll() {
-      return false;
-    }
-    void synchronize() {
 
-    }
+    void begin(epoch_section * section = nullptr) noexcept;
+    void end(epoch_section * section = nullptr) noexcept;
+
+    // defer deleting entry until no reader can hold it. entry must already be unreachable to new readers
+    void retire(epoch_entry & entry);
+
+    // try to move the global epoch along, then delete whatever that made safe. true if we deleted anything
+    bool poll();
+
+    // wait until everything retired so far is safe to delete. must not be called from inside a critical section
+    void synchronize();
+
+    // delete whatever is safe to delete
+    bool reclaim();
 
-    void reclaim() {
-      for (int i = 0; i < epoch_length; ++i)
-        dispatch(epoch);
+    void barrier() {
+      synchronize();
+      reclaim();
     }
 
-    void barrier();
+    void unregister();
 
-    void begin(epoch_section * s = nullptr, int count = 1);
-    void end(epoch_section * s = nullptr, int count = 1);
+    epoch_stats stats() const noexcept;
+
+    // the calling thread's record on epoch_manager::global(), registered on first use and unregistered at thread exit
+    static epoch_record & local();
 
-    void retire(epoch_entry & entry);
   private:
-    void add_ref(epoch_section & s) {
-      // TODO
-    }
-    void del_ref(epoch_section & s) {
-      // TODO
-    }
-    void dispatch(int epoch) {
-      epoch &= epoch_mask;
-      int i = 0;
-      epoch_entry * head = pending[epoch];
-      pending[epoch] = nullptr;
-      epoch_entry * n;
-      for (epoch_entry * cursor = head; cursor != nullptr; cursor = n) {
-        n = cursor->next_epoch_entry;
-        delete cursor;
-        i++;
-      }
-      if (pending_count > peak)
-        peak = pending_count;
-      dispatch_count += i;
-      pending_count -= i;
-    }
+    void dispatch(int bucket);
+    void add_ref(epoch_section & s) noexcept;
+    void del_ref(epoch_section & s) noexcept;
   };
 
-  struct epoch_manager {
+  struct epoch_manager : noncopyable {
     atomic<uint32_t> epoch;
     atomic<int> free_count;
     atomic<epoch_record *> records;
@@ -105,20 +120,33 @@ namespace framework {
     ~epoch_manager() {
       // oh boy
     }
-    epoch_record * recycle() const; // try to reuse a freed collector from the list
+    epoch_record * recycle(); // try to reuse a freed collector from the list
+    epoch_record & acquire(); // recycle, or register a new record
+
+    // bump the epoch if every active record has seen the current one. true if the epoch moved, by us or anyone else
+    bool try_advance() noexcept;
+
+    // delete whatever has become safe on records that were unregistered with retirements still pending
+    bool reclaim_orphans();
+
+    epoch_stats stats() const noexcept; // summed over every record
+
+    static epoch_manager & global();
+  };
+
+  // a critical section on the calling thread's record
+  struct epoch_guard : noncopyable {
+    explicit epoch_guard(epoch_record & r = epoch_record::local()) noexcept : r(r) { r.begin(); }
+    ~epoch_guard() { r.end(); }
+    epoch_record & r;
   };
 
-  inline void epoch_record::begin(epoch_section * section, int count) {    
-    assert(count > 0);
+  inline void epoch_record::begin(epoch_section * section) noexcept {
     auto a = active.load(std::memory_order_relaxed);
     if (a == 0) {
-#ifdef FRAMEWORK_MEMORYMODEL_TSO
-      active.exchange(count, std::memory_order_relaxed);
-      atomic_thread_fence(std::memory_order_acquire);
-#else
       active.store(1, std::memory_order_relaxed);
+      // announce ourselves before we look, or a scan could miss us and advance twice while we read
       atomic_thread_fence(std::memory_order_seq_cst);
-#endif
       auto g_epoch = global.epoch.load(std::memory_order_acquire);
       epoch.store(g_epoch, std::memory_order_release);
     } else {
@@ -127,48 +155,32 @@ namespace framework {
     if (section) add_ref(*section);
   }
 
-  inline void epoch_record::barrier() {
-    synchronize();
-    reclaim();    
-  }
-
-  inline void epoch_record::end(epoch_section * section, int count) {
-    atomic_thread_fence(std::memory_order_release);
-    active.fetch_sub(count, std::memory_order_relaxed);
+  inline void epoch_record::end(epoch_section * section) noexcept {
+    assert(active.load(std::memory_order_relaxed) > 0);
+    // our reads happen before anyone sees us leave
+    active.store(active.load(std::memory_order_relaxed) - 1, std::memory_order_release);
     if (section) del_ref(*section);
   }
 
-  inline void epoch_record::retire(epoch_entry & entry) {
-    int offset = global.epoch.load(std::memory_order_relaxed) & epoch_mask;
-    ++pending_count;
-    // cons onto the pending list, spnc
-    epoch_entry * & p = pending[offset];
-    entry.next_epoch_entry = pending[offset];
-    pending[offset] = &entry;
-  }
-  void epoch_record::unregister() {
-    // TODO: merge the local free lists into those of whomever is collecting us, then when we're down to one local collector, it can collect itself.
-    atomic_thread_fence(std::memory_order_release);
-    used.store(false, std::memory_order_relaxed);
-    global.free_count.fetch_add(1, std::memory_order_relaxed);
-  }
-
-  epoch_record * epoch_manager::recycle() const {
-    if (free_count.load(std::memory_order_relaxed) == 0)
-      return nullptr;
-    for (epoch_record * cursor = records.load(std::memory_order_relaxed); cursor != nullptr; cursor = cursor->next) {
-      if (cursor->used.load(std::memory_order_relaxed) == false) {
-        atomic_thread_fence(std::memory_order_acquire);
-        if (cursor->used.exchange(true, std::memory_order_relaxed)) {
-          free_count.fetch_sub(1, std::memory_order_relaxed);
-          return cursor;
-        }
-      }
+  inline void epoch_record::add_ref(epoch_section & s) noexcept {
+    uint32_t e = global.epoch.load(std::memory_order_acquire);
+    uint32_t i = e & 1;
+    epoch_ref & ref = bucket[i];
+    if (ref.count++ == 0) {
+      // the epoch has ticked since the other bucket was opened. order our observations after it, or we could take
+      // a reference from the previous generation
+      if (bucket[i ^ 1].count > 0) atomic_thread_fence(std::memory_order_acq_rel);
+      ref.epoch = e;
     }
-    return nullptr;
+    s.bucket = i;
   }
 
-
-};
-
-#endif
\ No newline at end of file
+  inline void epoch_record::del_ref(epoch_section & s) noexcept {
+    epoch_ref & current = bucket[s.bucket];
+    if (--current.count > 0) return;
+    // if we're still inside a section from a newer epoch, advertise that one, so the epoch can move on past this
+    epoch_ref & other = bucket[s.bucket ^ 1];
+    if (other.count > 0 && int32_t(current.epoch - other.epoch) < 0)
+      epoch.store(other.epoch, std::memory_order_release);
+  }
+}
@@ -0,0 +1,221 @@
+#include "stdafx.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cds.h"
+#include "epoch.h"
+
+// Read-mostly reclamation: epoch_record against the libcds hazard pointer collector that
+// cds_main_thread_attachment sets up.
+//
+//   epoch_bench [--readers 1,3,7] [--ms 500] [--pause n] [--quick]
+//
+// Readers load a shared pointer to a small immutable object over and over and check that its words agree, so
+// reading something that has already been deleted shows up as a torn read. One writer swaps in a fresh object
+// and retires the old one, spinning for --pause iterations between swaps. Each scheme protects one read at a time:
+//
+//   leak    no protection and nothing is freed until the end, the cost of reading with no reclamation at all
+//   epoch   an epoch_guard per read
+//   hazard  a cds::gc::HP::Guard per read
+//
+// We print reads and writes per second, as CSV, and how many retired objects were waiting at worst. A torn read
+// exits 1.
+
+using namespace std;
+using namespace std::chrono;
+using namespace framework;
+
+namespace {
+
+  struct node : epoch_entry {
+    explicit node(uint64_t v) {
+      for (auto & w : words) w = v;
+    }
+    bool intact() const noexcept {
+      for (auto w : words)
+        if (w != words[0]) return false;
+      return true;
+    }
+    uint64_t words[6];
+  };
+
+#ifdef FRAMEWORK_SUPPORTS_CDS
+  struct node_disposer {
+    void operator()(node * p) const { delete p; }
+  };
+#endif
+
+  enum class scheme { leak, epoch, hazard };
+
+  const char * name(scheme s) {
+    switch (s) {
+      case scheme::leak: return "leak";
+      case scheme::epoch: return "epoch";
+      default: return "hazard";
+    }
+  }
+
+  struct options {
+    vector<int> readers;
+    int ms = 500;
+    int pause = 100;
+  };
+
+  struct result {
+    uint64_t reads = 0, writes = 0, torn = 0, peak = 0;
+    double seconds = 0;
+  };
+
+  vector<int> parse_list(const char * s) {
+    vector<int> result;
+    stringstream ss(s);
+    string item;
+    while (getline(ss, item, ',')) result.push_back(atoi(item.c_str()));
+    return result;
+  }
+
+  [[noreturn]] void usage() {
+    cerr << "usage: epoch_bench [--readers 1,3,7] [--ms 500] [--pause n] [--quick]\n";
+    exit(2);
+  }
+
+  // burn a little time without touching memory
+  inline uint64_t spin(int n, uint64_t x) {
+    for (int i = 0; i < n; ++i) {
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+    }
+    return x;
+  }
+
+  result measure(scheme s, int readers, const options & o) {
+    atomic<node *> current(new node(0));
+    atomic<bool> stop(false);
+    atomic<uint64_t> reads(0), torn(0);
+    vector<node *> leaked; // only freed once the readers are gone
+    result r;
+
+    vector<thread> threads;
+    for (int i = 0; i < readers; ++i)
+      threads.emplace_back([&, s] {
+#ifdef FRAMEWORK_SUPPORTS_CDS
+        cds_thread_attachment attach_thread;
+#endif
+        epoch_record & record = epoch_record::local();
+        uint64_t n = 0, bad = 0;
+        while (!stop.load(memory_order_relaxed)) {
+          for (int k = 0; k < 64; ++k) {
+            switch (s) {
+              case scheme::leak:
+                bad += !current.load(memory_order_acquire)->intact();
+                break;
+              case scheme::epoch: {
+                epoch_guard guard(record);
+                bad += !current.load(memory_order_acquire)->intact();
+                break;
+              }
+              case scheme::hazard: {
+#ifdef FRAMEWORK_SUPPORTS_CDS
+                cds::gc::HP::Guard guard;
+                bad += !guard.protect(current)->intact();
+#endif
+                break;
+              }
+            }
+          }
+          n += 64;
+        }
+        reads.fetch_add(n);
+        torn.fetch_add(bad);
+      });
+
+    // the writer
+    threads.emplace_back([&, s] {
+#ifdef FRAMEWORK_SUPPORTS_CDS
+      cds_thread_attachment attach_thread;
+#endif
+      epoch_record & record = epoch_record::local();
+      uint64_t peak_before = record.stats().peak;
+      uint64_t version = 0, sink = 0;
+      auto deadline = steady_clock::now() + milliseconds(o.ms);
+      auto start = steady_clock::now();
+      while (steady_clock::now() < deadline) {
+        for (int k = 0; k < 16; ++k) {
+          node * old = current.exchange(new node(++version), memory_order_acq_rel);
+          switch (s) {
+            case scheme::leak: leaked.push_back(old); break;
+            case scheme::epoch: record.retire(*old); break;
+            case scheme::hazard:
+#ifdef FRAMEWORK_SUPPORTS_CDS
+              cds::gc::HP::retire<node_disposer>(old);
+#else
+              leaked.push_back(old);
+#endif
+              break;
+          }
+          sink += spin(o.pause, version);
+        }
+      }
+      r.seconds = duration<double>(steady_clock::now() - start).count();
+      stop.store(true, memory_order_relaxed);
+      r.writes = version + (sink == 42); // keep the spin honest
+      r.peak = s == scheme::epoch ? std::max(record.stats().peak, peak_before) : 0;
+      if (s == scheme::epoch) record.barrier();
+    });
+
+    for (auto && t : threads) t.join();
+    for (auto p : leaked) delete p;
+#ifdef FRAMEWORK_SUPPORTS_CDS
+    if (s == scheme::hazard) cds::gc::HP::scan();
+#endif
+    delete current.load();
+    r.reads = reads.load();
+    r.torn = torn.load();
+    return r;
+  }
+}
+
+int main(int argc, char ** argv) {
+#ifdef FRAMEWORK_SUPPORTS_CDS
+  cds_main_thread_attachment<> cds;
+#endif
+  options o;
+  for (int i = 1; i < argc; ++i) {
+    string a = argv[i];
+    bool more = i + 1 < argc;
+    if (a == "--readers" && more) o.readers = parse_list(argv[++i]);
+    else if (a == "--ms" && more) o.ms = max(1, atoi(argv[++i]));
+    else if (a == "--pause" && more) o.pause = max(0, atoi(argv[++i]));
+    else if (a == "--quick") o.ms = 100;
+    else usage();
+  }
+  if (o.readers.empty()) {
+    int n = max(2, int(thread::hardware_concurrency()));
+    for (int t = 1; t < n; t = t * 2 + 1) o.readers.push_back(t);
+  }
+
+  vector<scheme> schemes{ scheme::leak, scheme::epoch };
+#ifdef FRAMEWORK_SUPPORTS_CDS
+  schemes.push_back(scheme::hazard);
+#endif
+
+  bool ok = true;
+  cout << "scheme,readers,Mreads/s,Mreads/s/reader,Kwrites/s,peak pending,torn\n";
+  for (int readers : o.readers) {
+    if (readers < 1) usage();
+    for (scheme s : schemes) {
+      result r = measure(s, readers, o);
+      cout << name(s) << "," << readers << "," << r.reads / r.seconds * 1e-6 << "," << r.reads / r.seconds * 1e-6 / readers << ","
+           << r.writes / r.seconds * 1e-3 << "," << r.peak << "," << r.torn << "\n";
+      if (r.torn != 0) ok = false;
+    }
+  }
+  return ok ? 0 : 1;
+}
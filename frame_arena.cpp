@@ -0,0 +1,89 @@
+#include "stdafx.h"
+#include <algorithm>
+#include "aligned_allocator.h"
+#include "frame_arena.h"
+#include "memory_accounting.h"
+#include "metrics.h"
+
+using namespace std;
+
+namespace framework {
+
+  // this should flatten out once every thread has seen its busiest frame
+  static counter arena_heap_bytes("frame arena.heap", "bytes");
+
+  const size_t frame_arena::chunk_size;
+
+  frame_arena & frame_arena::local() noexcept {
+    static thread_local frame_arena arena;
+    return arena;
+  }
+
+  frame_arena::~frame_arena() {
+    for (auto & s : slots)
+      for (auto & c : s.chunks) {
+        memory(memory_tag::frame).cpu.deallocate(c.size);
+        detail::deallocate_aligned_memory(c.base);
+      }
+  }
+
+  void frame_arena::reset(slot & s, uint64_t f) noexcept {
+    s.frame = f;
+    // keep the ordinary chunks, but don't hang on to room made for one outsized request
+    auto keep = std::remove_if(s.chunks.begin(), s.chunks.end(), [](const chunk & c) {
+      if (c.size <= chunk_size) return false;
+      memory(memory_tag::frame).cpu.deallocate(c.size);
+      detail::deallocate_aligned_memory(c.base);
+      return true;
+    });
+    s.chunks.erase(keep, s.chunks.end());
+    s.current = 0;
+    if (s.chunks.empty()) {
+      s.top = s.limit = nullptr;
+    } else {
+      s.top = s.chunks[0].base;
+      s.limit = s.top + s.chunks[0].size;
+    }
+  }
+
+  void * frame_arena::refill(slot & s, size_t size, size_t align) {
+    // anything further along we've kept from an earlier frame?
+    for (size_t i = s.top == nullptr ? 0 : s.current + 1; i < s.chunks.size(); ++i) {
+      chunk & c = s.chunks[i];
+      uintptr_t p = (uintptr_t(c.base) + align - 1) & ~uintptr_t(align - 1);
+      if (p + size > uintptr_t(c.base + c.size)) continue;
+      s.current = i;
+      s.top = reinterpret_cast<char *>(p + size);
+      s.limit = c.base + c.size;
+      return reinterpret_cast<void *>(p);
+    }
+
+    size_t n = std::max<size_t>(chunk_size, size + align);
+    char * base = static_cast<char *>(detail::allocate_aligned_memory(64, n));
+    if (base == nullptr) throw bad_alloc();
+    s.chunks.push_back(chunk{ base, n });
+    arena_heap_bytes += n;
+    memory(memory_tag::frame).cpu.allocate(n);
+    s.current = s.chunks.size() - 1;
+    uintptr_t p = (uintptr_t(base) + align - 1) & ~uintptr_t(align - 1);
+    s.top = reinterpret_cast<char *>(p + size);
+    s.limit = base + n;
+    return reinterpret_cast<void *>(p);
+  }
+
+  size_t frame_arena::used() const noexcept {
+    uint64_t f = frame();
+    const slot & s = slots[f % frames_in_flight];
+    if (s.frame != f || s.top == nullptr) return 0;
+    size_t result = 0;
+    for (size_t i = 0; i < s.current; ++i) result += s.chunks[i].size;
+    return result + size_t(s.top - s.chunks[s.current].base);
+  }
+
+  size_t frame_arena::reserved() const noexcept {
+    size_t result = 0;
+    for (auto & s : slots)
+      for (auto & c : s.chunks) result += c.size;
+    return result;
+  }
+}
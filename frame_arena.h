@@ -0,0 +1,144 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "noncopyable.h"
+
+// Scratch memory for work that is done with by the end of the frame.
+//
+//   frame_vector<vertex> verts;
+//   verts.reserve(n);
+//   frame_string name = tracker.device_string<frame_string>(i, vr::Prop_RenderModelName_String);
+//
+// Every thread gets a bump allocator per frame in flight. Allocating is a pointer bump in memory nobody else
+// touches, and nothing is freed one block at a time: frame_arena::next_frame(), called once a frame by the render
+// loop, moves everybody on to the next slot, and a thread wipes a slot wholesale the first time it allocates from
+// it again, frames_in_flight frames later. Chunks are kept for reuse, so once a thread's arena has grown to fit a
+// frame, the frame loop stops going to the heap.
+//
+// The catch is lifetime: anything allocated here is gone frames_in_flight frames later, whoever holds it. Use it
+// for stage-local scratch and for strings built to be handed off to GL or a log. Don't use it for anything that
+// outlives the frame, like the sky bake that runs in the background across several, or from threads the frame loop
+// doesn't drive.
+//
+// Deallocating the most recent allocation on the same thread hands its space back, so a vector that is built and
+// dropped inside a stage costs nothing. Otherwise deallocation does nothing, so reserve up front where you can:
+// a growing vector leaves its old storage behind until the slot is recycled.
+namespace framework {
+
+  static const size_t frames_in_flight = 3;
+
+  namespace detail {
+    inline std::atomic<uint64_t> & frame_counter() noexcept {
+      static std::atomic<uint64_t> counter{ 0 };
+      return counter;
+    }
+  }
+
+  struct frame_arena : noncopyable {
+    static const size_t chunk_size = 1 << 20;
+
+    frame_arena() noexcept {}
+    ~frame_arena();
+
+    static frame_arena & local() noexcept; // the calling thread's
+
+    // retires the oldest frame in flight. call once a frame, from the render loop, before anyone allocates for it
+    static void next_frame() noexcept { detail::frame_counter().fetch_add(1, std::memory_order_relaxed); }
+    static uint64_t frame() noexcept { return detail::frame_counter().load(std::memory_order_relaxed); }
+
+    void * allocate(size_t size, size_t align) {
+      slot & s = acquire();
+      uintptr_t p = (uintptr_t(s.top) + align - 1) & ~uintptr_t(align - 1);
+      if (s.top != nullptr && p + size <= uintptr_t(s.limit)) {
+        s.top = reinterpret_cast<char *>(p + size);
+        return reinterpret_cast<void *>(p);
+      }
+      return refill(s, size, align);
+    }
+
+    // only reclaims the most recent allocation from this frame
+    void deallocate(void * p, size_t size) noexcept {
+      slot & s = slots[frame() % frames_in_flight];
+      char * q = static_cast<char *>(p);
+      if (s.frame == frame() && q + size == s.top && q >= s.chunks[s.current].base) s.top = q;
+    }
+
+    size_t used() const noexcept;     // by this frame, give or take alignment
+    size_t reserved() const noexcept; // held across every slot
+
+  private:
+    struct chunk {
+      char * base;
+      size_t size;
+    };
+
+    struct slot {
+      uint64_t frame = ~uint64_t(0);
+      std::vector<chunk> chunks;
+      size_t current = 0; // the chunk we're bumping through
+      char * top = nullptr;
+      char * limit = nullptr;
+    };
+
+    slot & acquire() noexcept {
+      uint64_t f = frame();
+      slot & s = slots[f % frames_in_flight];
+      if (s.frame != f) reset(s, f);
+      return s;
+    }
+
+    static void reset(slot & s, uint64_t f) noexcept;
+    void * refill(slot & s, size_t size, size_t align);
+
+    slot slots[frames_in_flight];
+  };
+
+  // stateless, so containers using it can be moved between threads. space comes from whichever thread allocates
+  template <typename T> struct frame_allocator {
+    typedef T         value_type;
+    typedef T*        pointer;
+    typedef const T*  const_pointer;
+    typedef T&        reference;
+    typedef const T&  const_reference;
+    typedef size_t    size_type;
+    typedef ptrdiff_t difference_type;
+
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type is_always_equal;
+
+    template <class U> struct rebind { typedef frame_allocator<U> other; };
+
+    frame_allocator() noexcept {}
+
+    template <class U> frame_allocator(const frame_allocator<U> &) noexcept {}
+
+    size_type max_size() const noexcept {
+      return size_type(~0) / sizeof(T);
+    }
+
+    pointer allocate(size_type n) {
+      if (n > max_size()) throw std::bad_alloc();
+      return static_cast<pointer>(frame_arena::local().allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(pointer p, size_type n) noexcept {
+      frame_arena::local().deallocate(p, n * sizeof(T));
+    }
+  };
+
+  template <typename T, typename U>
+  inline bool operator== (const frame_allocator<T> &, const frame_allocator<U> &) noexcept { return true; }
+
+  template <typename T, typename U>
+  inline bool operator!= (const frame_allocator<T> &, const frame_allocator<U> &) noexcept { return false; }
+
+  template <typename T> using frame_vector = std::vector<T, frame_allocator<T>>;
+  typedef std::basic_string<char, std::char_traits<char>, frame_allocator<char>> frame_string;
+}
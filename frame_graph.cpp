@@ -0,0 +1,103 @@
+#include "stdafx.h"
+#include <algorithm>
+#include <thread>
+#include "frame_graph.h"
+#include "parallel.h"
+
+using namespace std;
+
+namespace framework {
+
+  size_t frame_graph::add(const char * name, affinity where, initializer_list<resource> reads, initializer_list<resource> writes, function<void()> f) {
+    size_t i = stages.size();
+    stages.emplace_back(new stage);
+    stage & s = *stages.back();
+    s.name = name;
+    s.where = where;
+    s.f = std::move(f);
+
+    // read after write, write after write, write after read
+    for (auto r : reads) {
+      hazards & h = find(r);
+      if (h.last_writer != npos) depend(h.last_writer, i);
+    }
+    for (auto r : writes) {
+      hazards & h = find(r);
+      if (h.last_writer != npos) depend(h.last_writer, i);
+      for (auto j : h.readers) depend(j, i);
+    }
+
+    // only record ourselves once we're done looking, so reading and writing the same thing doesn't make us wait on ourselves
+    for (auto r : reads) find(r).readers.push_back(i);
+    for (auto r : writes) {
+      hazards & h = find(r);
+      h.last_writer = i;
+      h.readers.clear();
+    }
+    return i;
+  }
+
+  void frame_graph::depend(size_t from, size_t to) {
+    if (from == to) return;
+    auto & successors = stages[from]->successors;
+    if (std::find(successors.begin(), successors.end(), to) != successors.end()) return;
+    successors.push_back(to);
+    ++stages[to]->predecessors;
+  }
+
+  frame_graph::hazards & frame_graph::find(resource r) {
+    for (auto && h : resources)
+      if (h.r == r) return h;
+    resources.push_back(hazards{ r, npos, {} });
+    return resources.back();
+  }
+
+  void frame_graph::run(time_point deadline) {
+    if (pool * p = scheduler::current()) {
+      run(*p, deadline);
+      return;
+    }
+    for (auto && s : stages) s->f();
+  }
+
+  void frame_graph::run(pool & p, time_point deadline) {
+    if (stages.empty()) return;
+    this->deadline = deadline;
+    errors.reset();
+    for (auto && s : stages) s->pending.store(s->predecessors, memory_order_relaxed);
+    outstanding.store(stages.size(), memory_order_relaxed);
+
+    detail::with_worker(p, [this](worker & w) {
+      for (size_t i = 0; i < stages.size(); ++i)
+        if (stages[i]->predecessors == 0 && stages[i]->where == affinity::any) spawn(w, i);
+
+      // our own stages, in order, making ourselves useful while their inputs are being computed elsewhere
+      for (size_t i = 0; i < stages.size(); ++i) {
+        stage & s = *stages[i];
+        if (s.where != affinity::render_thread) continue;
+        while (s.pending.load(memory_order_acquire) != 0)
+          if (!w.try_run_one()) this_thread::yield();
+        if (!errors.stopping()) errors.attempt(s.f);
+        finish(w, i);
+      }
+
+      while (outstanding.load(memory_order_acquire) != 0)
+        if (!w.try_run_one()) this_thread::yield();
+    });
+    errors.rethrow();
+  }
+
+  void frame_graph::finish(worker & w, size_t i) {
+    for (auto j : stages[i]->successors)
+      if (stages[j]->pending.fetch_sub(1, memory_order_acq_rel) == 1 && stages[j]->where == affinity::any)
+        spawn(w, j);
+    outstanding.fetch_sub(1, memory_order_release);
+  }
+
+  void frame_graph::spawn(worker & w, size_t i) {
+    w.spawn(priority::critical, [this, i](worker & w) {
+      if (!errors.stopping()) errors.attempt(stages[i]->f);
+      finish(w, i);
+    }, deadline);
+  }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+#include "noncopyable.h"
+#include "parallel.h"
+#include "worker.h"
+
+// A task graph for the work done once per frame.
+//
+// Build the graph once, then run it every frame. Each stage names the resources it reads and writes, where a
+// resource is just the address of whatever it touches. A stage waits on the last stage added before it that
+// wrote anything it reads, and on every earlier stage that read or wrote anything it writes. Order of insertion
+// is therefore always a valid serial schedule, and is what you get without a scheduler.
+//
+// Stages marked render_thread run on the thread that calls run(), in the order they were added, so GL and the
+// gui see calls in a deterministic order. Everything else runs on the pool as soon as its inputs are ready, while
+// the render thread helps out whenever it is waiting on one of them. All of it is critical work, and a deadline
+// puts it ahead of other critical work submitted to the pool from outside with a later one.
+//
+// If a stage throws, the stages that haven't started yet are skipped, and run() rethrows the first exception
+// once the frame has drained. The pool is none the worse for it, and the graph can be run again next frame.
+namespace framework {
+
+  struct frame_graph : noncopyable {
+    typedef const void * resource;
+
+    enum class affinity : int {
+      any = 0,
+      render_thread = 1
+    };
+
+    // returns the stage id
+    size_t add(const char * name, affinity where, std::initializer_list<resource> reads, std::initializer_list<resource> writes, std::function<void()> f);
+
+    typedef std::chrono::steady_clock::time_point time_point;
+
+    void run(time_point deadline = time_point::max()); // on the process-wide scheduler, or serially without one
+    void run(pool & p, time_point deadline = time_point::max());
+
+    size_t size() const noexcept { return stages.size(); }
+
+  private:
+    struct stage : noncopyable {
+      const char * name;
+      affinity where;
+      std::function<void()> f;
+      std::vector<size_t> successors;
+      size_t predecessors = 0;
+      std::atomic<size_t> pending{ 0 }; // predecessors yet to finish this frame
+    };
+
+    struct hazards {
+      resource r;
+      size_t last_writer; // or npos
+      std::vector<size_t> readers; // since the last write
+    };
+
+    static const size_t npos = size_t(-1);
+
+    void depend(size_t from, size_t to);
+    hazards & find(resource r);
+    void finish(worker & w, size_t i); // release our successors
+    void spawn(worker & w, size_t i);
+
+    std::vector<std::unique_ptr<stage>> stages;
+    std::vector<hazards> resources;
+    std::atomic<size_t> outstanding{ 0 }; // stages yet to finish this frame
+    time_point deadline; // this frame's
+    detail::first_exception errors; // this frame's
+  };
+}
@@ -1,4 +1,7 @@
 #include "stdafx.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
 #include "spdlog.h"
 #include "error.h"
 #include "gl.h"
@@ -137,5 +140,88 @@ namespace framework {
       if (result != GL_FRAMEBUFFER_COMPLETE)
         die("bad framebuffer: {} ({}): {}", gl::get_label(GL_FRAMEBUFFER, framebuffer), framebuffer, show_framebuffer_status_result(result));
     }
+
+    static size_t texel_bytes(GLenum internalformat) noexcept {
+      switch (internalformat) {
+        case GL_R8: return 1;
+        case GL_RG8: case GL_R16F: case GL_DEPTH_COMPONENT16: return 2;
+        case GL_RGB8: case GL_RGBA8: case GL_SRGB8: case GL_SRGB8_ALPHA8: case GL_RG16F: case GL_R32F:
+        case GL_R11F_G11F_B10F: case GL_RGB10_A2: case GL_DEPTH24_STENCIL8: case GL_DEPTH_COMPONENT24:
+        case GL_DEPTH_COMPONENT32F: return 4;
+        case GL_RGB16F: case GL_RGBA16F: case GL_RG32F: case GL_DEPTH32F_STENCIL8: return 8;
+        case GL_RGB32F: case GL_RGBA32F: return 16;
+        default: return 4;
+      }
+    }
+
+    size_t texture_bytes(GLenum internalformat, GLsizei w, GLsizei h, GLsizei layers, GLsizei levels, GLsizei samples) noexcept {
+      size_t texels = 0;
+      for (GLsizei i = 0; i < levels; ++i)
+        texels += size_t(std::max(w >> i, 1)) * size_t(std::max(h >> i, 1));
+      return texels * size_t(layers) * size_t(std::max(samples, 1)) * texel_bytes(internalformat);
+    }
+
+    namespace {
+      struct tracking {
+        std::mutex m;
+        std::map<std::pair<GLenum, GLuint>, tracked_object> objects;
+      };
+
+      tracking & tracked() {
+        static tracking * instance = new tracking; // leaked, so late deletes still have somewhere to go
+        return *instance;
+      }
+
+      string object_label(GLenum kind, GLuint name) {
+        GLsizei len = 0;
+        glGetObjectLabel(kind, name, 0, &len, nullptr);
+        string label;
+        if (len <= 0) return fmt::format("{} {}", show_object_label_type(kind), name);
+        label.resize(size_t(len) + 1);
+        glGetObjectLabel(kind, name, len + 1, &len, const_cast<GLchar*>(label.data()));
+        label.resize(size_t(len));
+        return label;
+      }
+
+      void track(GLenum kind, GLuint name, size_t bytes, memory_tag tag) {
+        tracking & t = tracked();
+        lock_guard<mutex> lock(t.m);
+        auto i = t.objects.find(std::make_pair(kind, name));
+        if (i == t.objects.end()) {
+          i = t.objects.emplace(std::make_pair(kind, name), tracked_object{ kind, name, 0, tag, object_label(kind, name) }).first;
+        } else {
+          memory(i->second.tag).gpu.deallocate(i->second.bytes); // respecified
+        }
+        i->second.bytes = bytes;
+        i->second.tag = tag;
+        memory(tag).gpu.allocate(bytes);
+      }
+
+      void untrack(GLenum kind, GLuint name) noexcept {
+        tracking & t = tracked();
+        lock_guard<mutex> lock(t.m);
+        auto i = t.objects.find(std::make_pair(kind, name));
+        if (i == t.objects.end()) return;
+        memory(i->second.tag).gpu.deallocate(i->second.bytes);
+        t.objects.erase(i);
+      }
+    }
+
+    void track_buffer(GLuint buffer, size_t bytes, memory_tag tag) { track(GL_BUFFER, buffer, bytes, tag); }
+    void track_texture(GLuint texture, size_t bytes, memory_tag tag) { track(GL_TEXTURE, texture, bytes, tag); }
+    void untrack_buffer(GLuint buffer) noexcept { untrack(GL_BUFFER, buffer); }
+    void untrack_texture(GLuint texture) noexcept { untrack(GL_TEXTURE, texture); }
+
+    std::vector<tracked_object> tracked_objects() {
+      std::vector<tracked_object> result;
+      {
+        tracking & t = tracked();
+        lock_guard<mutex> lock(t.m);
+        result.reserve(t.objects.size());
+        for (auto & p : t.objects) result.push_back(p.second);
+      }
+      std::sort(result.begin(), result.end(), [](const tracked_object & a, const tracked_object & b) { return a.bytes > b.bytes; });
+      return result;
+    }
   }
 }
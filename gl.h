@@ -1,11 +1,13 @@
 #pragma once
 
+#include <vector>
 #include "config.h"
 #include "half.h"
 
 #ifdef FRAMEWORK_SUPPORTS_OPENGL
 
 #include "glew.h"
+#include "memory_accounting.h"
 #include "noncopyable.h"
 
 namespace framework {
@@ -41,6 +43,26 @@ namespace framework {
 
     void check_framebuffer(GLuint framebuffer, GLenum role);
 
+    // video memory accounting, see memory_accounting.h. track once storage is allocated, again if it is
+    // respecified, and untrack before deleting. texture views share their parent's storage, so leave them be
+    void track_buffer(GLuint buffer, size_t bytes, memory_tag tag = memory_tag::other);
+    void track_texture(GLuint texture, size_t bytes, memory_tag tag = memory_tag::other);
+    void untrack_buffer(GLuint buffer) noexcept;
+    void untrack_texture(GLuint texture) noexcept;
+
+    // roughly what the driver sets aside for a texture. rgb formats are assumed padded out to rgba
+    size_t texture_bytes(GLenum internalformat, GLsizei w, GLsizei h = 1, GLsizei layers = 1, GLsizei levels = 1, GLsizei samples = 1) noexcept;
+
+    struct tracked_object {
+      GLenum kind; // GL_BUFFER or GL_TEXTURE
+      GLuint name;
+      size_t bytes;
+      memory_tag tag;
+      string label; // as it was when first tracked
+    };
+
+    std::vector<tracked_object> tracked_objects(); // largest first
+
     struct debug_group : noncopyable {
       template <typename ... Ts> debug_group(int id, const char * format, const Ts & ... args) noexcept {
         string label = fmt::format(format, args...);
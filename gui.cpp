@@ -52,6 +52,8 @@ void render_draw_lists(ImDrawData* draw_data) {
 
     glNamedBufferData(g_VboHandle, (GLsizeiptr)cmd_list->VtxBuffer.size() * sizeof(ImDrawVert), cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
     glNamedBufferData(g_ElementsHandle, (GLsizeiptr)cmd_list->IdxBuffer.size() * sizeof(ImDrawIdx), cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
+    gl::track_buffer(g_VboHandle, cmd_list->VtxBuffer.size() * sizeof(ImDrawVert), memory_tag::gui);
+    gl::track_buffer(g_ElementsHandle, cmd_list->IdxBuffer.size() * sizeof(ImDrawIdx), memory_tag::gui);
 
     for (const ImDrawCmd* pcmd = cmd_list->CmdBuffer.begin(); pcmd != cmd_list->CmdBuffer.end(); pcmd++) {
       if (pcmd->UserCallback) {
@@ -138,6 +140,7 @@ void create_fonts_texture() {
   glTextureParameteri(g_FontTexture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
   glTextureParameteri(g_FontTexture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
   glTextureStorage2D(g_FontTexture, 1, GL_RGBA8, width, height);
+  gl::track_texture(g_FontTexture, gl::texture_bytes(GL_RGBA8, width, height), memory_tag::gui);
   glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
   glTextureSubImage2D(g_FontTexture, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
   //g_FontTextureHandle = glGetTextureHandleARB(g_FontTexture);
@@ -293,13 +296,20 @@ namespace framework {
 
     void system::invalidate_device_objects() {
       if (g_VaoHandle) glDeleteVertexArrays(1, &g_VaoHandle);
-      if (g_VboHandle) glDeleteBuffers(1, &g_VboHandle);
-      if (g_ElementsHandle) glDeleteBuffers(1, &g_ElementsHandle);
+      if (g_VboHandle) {
+        gl::untrack_buffer(g_VboHandle);
+        glDeleteBuffers(1, &g_VboHandle);
+      }
+      if (g_ElementsHandle) {
+        gl::untrack_buffer(g_ElementsHandle);
+        glDeleteBuffers(1, &g_ElementsHandle);
+      }
       g_VaoHandle = g_VboHandle = g_ElementsHandle = 0;
 
       glDeleteProgram(g_ShaderHandle);
       g_ShaderHandle = 0;
       if (g_FontTexture) {
+        gl::untrack_texture(g_FontTexture);
         glDeleteTextures(1, &g_FontTexture);
         ImGui::GetIO().Fonts->TexID = 0;
         g_FontTexture = 0;
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+
+#include "noncopyable.h"
+
+// A log-linear histogram in the spirit of HdrHistogram, for latencies and the like.
+//
+// Each power of two is split into sub_buckets linear buckets, so any value read back is within 1/sub_buckets of
+// what was recorded, and every uint64_t fits. record() is a bit scan and a relaxed increment: one thread records,
+// any number of threads may take a snapshot while it does. record_shared() is for when more than one thread might
+// record at once, at the price of a locked add; see sharded_histogram in metrics.h.
+namespace framework {
+
+  struct histogram : noncopyable {
+    static const int sub_bucket_bits = 3;
+    static const int sub_buckets = 1 << sub_bucket_bits;
+    static const int buckets = (64 - sub_bucket_bits + 1) * sub_buckets;
+
+    static int index(uint64_t v) noexcept {
+      if (v < uint64_t(2 * sub_buckets)) return int(v);
+      int shift = msb(v) - sub_bucket_bits;
+      return shift * sub_buckets + int(v >> shift);
+    }
+
+    // smallest and largest values that land in bucket i
+    static uint64_t lowest(int i) noexcept {
+      if (i < 2 * sub_buckets) return uint64_t(i);
+      int shift = i / sub_buckets - 1;
+      return uint64_t(i % sub_buckets + sub_buckets) << shift;
+    }
+    static uint64_t highest(int i) noexcept {
+      return i + 1 < buckets ? lowest(i + 1) - 1 : ~uint64_t(0);
+    }
+
+    // single writer
+    void record(uint64_t v) noexcept {
+      std::atomic<uint64_t> & c = counts[index(v)];
+      c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    // any number of writers
+    void record_shared(uint64_t v) noexcept {
+      counts[index(v)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // a copy we can sum, query and print at our leisure
+    struct snapshot {
+      uint64_t counts[buckets] = {};
+      uint64_t total = 0;
+
+      snapshot & operator += (const snapshot & that) noexcept {
+        for (int i = 0; i < buckets; ++i) counts[i] += that.counts[i];
+        total += that.total;
+        return *this;
+      }
+
+      // the largest value in the bucket holding the p'th percentile, p in [0,100]. 0 if nothing was recorded
+      uint64_t percentile(double p) const noexcept {
+        if (total == 0) return 0;
+        double rank = p * 0.01 * double(total);
+        uint64_t seen = 0;
+        for (int i = 0; i < buckets; ++i) {
+          seen += counts[i];
+          if (seen != 0 && double(seen) >= rank) return highest(i);
+        }
+        return max();
+      }
+
+      uint64_t max() const noexcept {
+        for (int i = buckets - 1; i >= 0; --i)
+          if (counts[i] != 0) return highest(i);
+        return 0;
+      }
+
+      double mean() const noexcept {
+        if (total == 0) return 0;
+        double sum = 0;
+        for (int i = 0; i < buckets; ++i)
+          if (counts[i] != 0) sum += double(counts[i]) * 0.5 * (double(lowest(i)) + double(highest(i)));
+        return sum / double(total);
+      }
+    };
+
+    snapshot read() const noexcept {
+      snapshot result;
+      for (int i = 0; i < buckets; ++i) {
+        result.counts[i] = counts[i].load(std::memory_order_relaxed);
+        result.total += result.counts[i];
+      }
+      return result;
+    }
+
+  private:
+    static int msb(uint64_t v) noexcept {
+#ifdef _WIN32
+      unsigned long result;
+      _BitScanReverse64(&result, v);
+      return int(result);
+#else
+      return 63 - __builtin_clzll(v);
+#endif
+    }
+
+    std::atomic<uint64_t> counts[buckets] = {};
+  };
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include "noncopyable.h"
+#include "task.h"
+
+// Dmitry Vyukov's [intrusive MPSC node-based queue](http://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue),
+// specialized to tasks.
+//
+// Any number of threads may push, and a push is a single exchange, so it never waits on anyone. Only the owner
+// may pop. A producer that has swung head but not yet linked its node makes the queue look empty to the owner
+// for a moment; the owner simply comes back later. Nodes are drawn from a slab, like boxed tasks.
+namespace framework {
+
+  struct inbox : noncopyable {
+    inbox() noexcept : head(&stub), tail(&stub) {}
+
+    ~inbox() {
+      task t;
+      while (pop(t)) {}
+    }
+
+    // any thread
+    void push(task t) {
+      node * n = new (detail::slab<sizeof(node)>::allocate()) node(std::move(t));
+      count.fetch_add(1, std::memory_order_relaxed); // first, so size() never undercounts what pop() can see
+      link(n);
+    }
+
+    // owner only
+    bool pop(task & t) {
+      node * tail = this->tail;
+      node * next = tail->next.load(std::memory_order_acquire);
+      if (tail == &stub) {
+        if (next == nullptr) return false;
+        this->tail = tail = next;
+        next = next->next.load(std::memory_order_acquire);
+      }
+      if (next == nullptr) {
+        if (tail != head.load(std::memory_order_acquire)) return false; // a push is half done
+        link(&stub); // so tail has a successor we can move on to
+        next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) return false;
+      }
+      this->tail = next;
+      t = std::move(tail->t);
+      tail->~node();
+      detail::slab<sizeof(node)>::deallocate(tail);
+      count.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+
+    // only a hint when read off the owning thread
+    size_t size() const noexcept { return count.load(std::memory_order_relaxed); }
+    bool empty() const noexcept { return size() == 0; }
+
+  private:
+    struct node {
+      node() noexcept {}
+      explicit node(task && t) noexcept : t(std::move(t)) {}
+      std::atomic<node *> next{ nullptr };
+      task t;
+    };
+
+    void link(node * n) noexcept {
+      n->next.store(nullptr, std::memory_order_relaxed);
+      node * previous = head.exchange(n, std::memory_order_acq_rel);
+      previous->next.store(n, std::memory_order_release);
+    }
+
+    std::atomic<node *> head; // producers
+    node * tail; // consumer
+    std::atomic<size_t> count{ 0 };
+    node stub;
+  };
+}
@@ -0,0 +1,140 @@
+#include "stdafx.h"
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include "gl.h"
+#include "gui.h"
+#include "memory_accounting.h"
+
+using namespace std;
+
+namespace framework {
+
+  static const char * const memory_filename = "memory.csv";
+
+  const char * show_memory_tag(memory_tag t) noexcept {
+    switch (t) {
+      case memory_tag::other: return "other";
+      case memory_tag::sky: return "sky";
+      case memory_tag::rendermodels: return "rendermodels";
+      case memory_tag::render_targets: return "render targets";
+      case memory_tag::post: return "post";
+      case memory_tag::gui: return "gui";
+      case memory_tag::geometry: return "geometry";
+      case memory_tag::frame: return "frame";
+      default: return "unknown";
+    }
+  }
+
+  memory_account & memory(memory_tag t) noexcept {
+    static memory_account * accounts = new memory_account[memory_tags]; // leaked, as things are freed during static destruction
+    return accounts[int(t)];
+  }
+
+  static void write_usage(ostream & out, memory_tag t, const char * side, const memory_usage & u) {
+    out << show_memory_tag(t) << "," << side << ","
+        << u.live.load(memory_order_relaxed) << "," << u.peak.load(memory_order_relaxed) << ","
+        << u.total.load(memory_order_relaxed) << "," << u.allocations.load(memory_order_relaxed) << "\n";
+  }
+
+  bool dump_memory(const char * filename) {
+    ofstream out(filename, ios::app);
+    auto now = chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
+    out << "# " << now << "ms since the epoch\ntag,side,live,peak,total,allocations\n";
+    for (int i = 0; i < memory_tags; ++i) {
+      memory_account & a = memory(memory_tag(i));
+      write_usage(out, memory_tag(i), "cpu", a.cpu);
+      write_usage(out, memory_tag(i), "gpu", a.gpu);
+    }
+    out << "kind,name,tag,bytes,label\n";
+    for (auto & o : gl::tracked_objects())
+      out << (o.kind == GL_BUFFER ? "buffer" : "texture") << "," << o.name << "," << show_memory_tag(o.tag) << "," << o.bytes << ",\"" << o.label << "\"\n";
+    return bool(out);
+  }
+
+  // 1.5 MB and the like
+  static string show_bytes(double n) {
+    static const char * const units[] = { "B", "KB", "MB", "GB" };
+    int u = 0;
+    while (fabs(n) >= 1024 && u < 3) {
+      n /= 1024;
+      ++u;
+    }
+    return fmt::format(u == 0 ? "{:.0f} {}" : "{:.1f} {}", n, units[u]);
+  }
+
+  void memory_window(bool * open) {
+    gui::SetNextWindowSize(ImVec2(640, 360), ImGuiSetCond_FirstUseEver);
+    if (open && gui::Begin("Memory", open)) {
+      // allocation rates, recomputed every half second or so
+      static chrono::steady_clock::time_point then = chrono::steady_clock::now();
+      static uint64_t last_total[memory_tags][2];
+      static double rate[memory_tags][2];
+      auto now = chrono::steady_clock::now();
+      double dt = chrono::duration<double>(now - then).count();
+      if (dt >= 0.5) {
+        for (int i = 0; i < memory_tags; ++i) {
+          memory_account & a = memory(memory_tag(i));
+          uint64_t totals[2] = { a.cpu.total.load(memory_order_relaxed), a.gpu.total.load(memory_order_relaxed) };
+          for (int j = 0; j < 2; ++j) {
+            rate[i][j] = (totals[j] - last_total[i][j]) / dt;
+            last_total[i][j] = totals[j];
+          }
+        }
+        then = now;
+      }
+
+      static bool dumped = false, dump_failed = false;
+      if (gui::Button("Dump")) {
+        dump_failed = !dump_memory(memory_filename);
+        dumped = true;
+      }
+      if (dumped) {
+        gui::SameLine();
+        gui::Text(dump_failed ? "unable to write %s" : "appended to %s", memory_filename);
+      }
+
+      gui::Separator();
+      gui::Columns(7, "memory");
+      const char * headings[] = { "tag", "cpu live", "cpu peak", "cpu rate", "gpu live", "gpu peak", "gpu rate" };
+      for (auto h : headings) {
+        gui::Text("%s", h);
+        gui::NextColumn();
+      }
+      gui::Separator();
+      int64_t live[2] = { 0, 0 };
+      for (int i = 0; i < memory_tags; ++i) {
+        memory_account & a = memory(memory_tag(i));
+        gui::Text("%s", show_memory_tag(memory_tag(i))); gui::NextColumn();
+        const memory_usage * sides[2] = { &a.cpu, &a.gpu };
+        for (int j = 0; j < 2; ++j) {
+          int64_t l = sides[j]->live.load(memory_order_relaxed);
+          live[j] += l;
+          gui::Text("%s", show_bytes(double(l)).c_str()); gui::NextColumn();
+          gui::Text("%s", show_bytes(double(sides[j]->peak.load(memory_order_relaxed))).c_str()); gui::NextColumn();
+          gui::Text("%s/s", show_bytes(rate[i][j]).c_str()); gui::NextColumn();
+        }
+      }
+      gui::Separator();
+      gui::Text("total"); gui::NextColumn();
+      for (int j = 0; j < 2; ++j) {
+        gui::Text("%s", show_bytes(double(live[j])).c_str()); gui::NextColumn();
+        gui::NextColumn();
+        gui::NextColumn();
+      }
+      gui::Columns(1);
+
+      if (gui::CollapsingHeader("GL objects")) {
+        auto objects = gl::tracked_objects();
+        gui::Columns(3, "gl objects");
+        for (auto & o : objects) {
+          gui::Text("%s", o.label.c_str()); gui::NextColumn();
+          gui::Text("%s", show_memory_tag(o.tag)); gui::NextColumn();
+          gui::Text("%s", show_bytes(double(o.bytes)).c_str()); gui::NextColumn();
+        }
+        gui::Columns(1);
+      }
+      gui::End();
+    }
+  }
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "noncopyable.h"
+
+// Who is holding on to how much memory.
+//
+// Memory is charged to one of a fixed set of subsystem tags, on the CPU heap and in video memory separately. The
+// CPU side is charged by allocating through accounted_allocator, which wraps any of the framework allocators:
+//
+//   vector<vec4, accounted_allocator<vec4, memory_tag::sky>> samples;
+//   vector<vec4, accounted_allocator<vec4, memory_tag::sky, aligned_allocator<vec4, 64, memory_bake>>> bake;
+//
+// The GPU side is charged by gl::track_buffer and gl::track_texture wherever storage is allocated, and let go by
+// gl::untrack_buffer and gl::untrack_texture before the object is deleted. See gl.h.
+//
+// Each side keeps live bytes, the peak, and a running total allocated, from which the memory window works out a
+// rate. Charging is a handful of relaxed atomic adds on the tag's own cache lines, and never takes a lock.
+namespace framework {
+
+  enum class memory_tag : int {
+    other = 0,
+    sky = 1,
+    rendermodels = 2,
+    render_targets = 3, // eye buffers, resolve targets, their depth and stencil
+    post = 4,
+    gui = 5,
+    geometry = 6,       // vertex arrays nobody else claims: distortion mesh, controllers, obj meshes
+    frame = 7           // frame arena chunks
+  };
+
+  static const int memory_tags = 8;
+
+  const char * show_memory_tag(memory_tag t) noexcept;
+
+  struct alignas(64) memory_usage : noncopyable {
+    std::atomic<int64_t> live{ 0 };
+    std::atomic<int64_t> peak{ 0 };
+    std::atomic<uint64_t> total{ 0 };       // allocated, ever
+    std::atomic<uint64_t> allocations{ 0 };
+
+    void allocate(size_t bytes) noexcept {
+      int64_t now = live.fetch_add(int64_t(bytes), std::memory_order_relaxed) + int64_t(bytes);
+      total.fetch_add(bytes, std::memory_order_relaxed);
+      allocations.fetch_add(1, std::memory_order_relaxed);
+      int64_t p = peak.load(std::memory_order_relaxed);
+      while (now > p && !peak.compare_exchange_weak(p, now, std::memory_order_relaxed)) {}
+    }
+
+    void deallocate(size_t bytes) noexcept {
+      live.fetch_sub(int64_t(bytes), std::memory_order_relaxed);
+    }
+  };
+
+  struct memory_account : noncopyable {
+    memory_usage cpu, gpu;
+  };
+
+  memory_account & memory(memory_tag t) noexcept;
+
+  // tag,side,live,peak,total,allocations for each tag, then every tracked gl object. call from the gl thread
+  bool dump_memory(const char * filename);
+
+  void memory_window(bool * open);
+
+  // charges whatever Base hands out to tag
+  template <typename T, memory_tag tag, typename Base = std::allocator<T>> struct accounted_allocator : Base {
+    typedef std::allocator_traits<Base> base_traits;
+
+    typedef T                                      value_type;
+    typedef typename base_traits::pointer          pointer;
+    typedef typename base_traits::const_pointer    const_pointer;
+    typedef typename base_traits::size_type        size_type;
+    typedef typename base_traits::difference_type  difference_type;
+
+    typedef std::true_type propagate_on_container_move_assignment;
+
+    template <class U> struct rebind {
+      typedef accounted_allocator<U, tag, typename base_traits::template rebind_alloc<U>> other;
+    };
+
+    accounted_allocator() noexcept {}
+
+    template <class U, class B> accounted_allocator(const accounted_allocator<U, tag, B> & that) noexcept : Base(static_cast<const B &>(that)) {}
+
+    pointer allocate(size_type n) {
+      pointer p = base_traits::allocate(*this, n);
+      memory(tag).cpu.allocate(n * sizeof(T));
+      return p;
+    }
+
+    void deallocate(pointer p, size_type n) noexcept {
+      memory(tag).cpu.deallocate(n * sizeof(T));
+      base_traits::deallocate(*this, p, n);
+    }
+  };
+
+  template <typename T, memory_tag Ttag, typename TBase, typename U, memory_tag Utag, typename UBase>
+  inline bool operator== (const accounted_allocator<T, Ttag, TBase> & a, const accounted_allocator<U, Utag, UBase> & b) noexcept {
+    return Ttag == Utag && static_cast<const TBase &>(a) == static_cast<const UBase &>(b);
+  }
+
+  template <typename T, memory_tag Ttag, typename TBase, typename U, memory_tag Utag, typename UBase>
+  inline bool operator!= (const accounted_allocator<T, Ttag, TBase> & a, const accounted_allocator<U, Utag, UBase> & b) noexcept {
+    return !(a == b);
+  }
+}
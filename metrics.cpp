@@ -0,0 +1,114 @@
+#include "stdafx.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <ostream>
+#include "gui.h"
+#include "metrics.h"
+
+using namespace std;
+
+namespace framework {
+
+  static const char * const metrics_filename = "metrics.csv";
+
+  metric::metric(const char * name, metric_kind kind, const char * unit) : name(name), kind(kind), unit(unit) {
+    metrics & r = metrics::global();
+    lock_guard<mutex> lock(r.m);
+    r.all.push_back(this);
+  }
+
+  metric::~metric() {
+    metrics & r = metrics::global();
+    lock_guard<mutex> lock(r.m);
+    r.all.erase(std::remove(r.all.begin(), r.all.end(), this), r.all.end());
+  }
+
+  metrics & metrics::global() {
+    static metrics * instance = new metrics; // leaked, so static metrics can unregister during static destruction
+    return *instance;
+  }
+
+  static const char * show_kind(metric_kind k) noexcept {
+    switch (k) {
+      case metric_kind::counter: return "counter";
+      case metric_kind::gauge: return "gauge";
+      default: return "histogram";
+    }
+  }
+
+  void metrics::write_csv(ostream & out) const {
+    each([&](const metric & m) {
+      out << m.name << "," << show_kind(m.kind) << "," << m.unit << ",";
+      switch (m.kind) {
+        case metric_kind::counter:
+          out << "," << static_cast<const counter &>(m).read() << ",,,,\n";
+          break;
+        case metric_kind::gauge:
+          out << "," << static_cast<const gauge &>(m).read() << ",,,,\n";
+          break;
+        case metric_kind::histogram: {
+          histogram::snapshot s = static_cast<const sharded_histogram &>(m).read();
+          out << s.total << ",," << s.mean() << "," << s.percentile(50) << "," << s.percentile(99) << "," << s.max() << "\n";
+          break;
+        }
+      }
+    });
+  }
+
+  bool metrics::export_csv(const char * filename) const {
+    ofstream out(filename, ios::app);
+    auto now = chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
+    out << "# " << now << "ms since the epoch\nname,kind,unit,count,value,mean,p50,p99,max\n";
+    write_csv(out);
+    return bool(out);
+  }
+
+  void metrics_window(bool * open) {
+    gui::SetNextWindowSize(ImVec2(560, 300), ImGuiSetCond_FirstUseEver);
+    if (open && gui::Begin("Metrics", open)) {
+      static bool exported = false, export_failed = false;
+      if (gui::Button("Export")) {
+        export_failed = !metrics::global().export_csv(metrics_filename);
+        exported = true;
+      }
+      if (exported) {
+        gui::SameLine();
+        gui::Text(export_failed ? "unable to write %s" : "appended to %s", metrics_filename);
+      }
+
+      gui::Separator();
+      gui::Columns(6, "metrics");
+      const char * headings[] = { "metric", "value", "mean", "p50", "p99", "max" };
+      for (auto h : headings) {
+        gui::Text("%s", h);
+        gui::NextColumn();
+      }
+      gui::Separator();
+      metrics::global().each([](const metric & m) {
+        gui::Text("%s", m.name); gui::NextColumn();
+        switch (m.kind) {
+          case metric_kind::counter:
+            gui::Text("%llu %s", (unsigned long long) static_cast<const counter &>(m).read(), m.unit); gui::NextColumn();
+            for (int i = 0; i < 4; ++i) gui::NextColumn();
+            break;
+          case metric_kind::gauge:
+            gui::Text("%lld %s", (long long) static_cast<const gauge &>(m).read(), m.unit); gui::NextColumn();
+            for (int i = 0; i < 4; ++i) gui::NextColumn();
+            break;
+          case metric_kind::histogram: {
+            histogram::snapshot s = static_cast<const sharded_histogram &>(m).read();
+            gui::Text("%llu samples", (unsigned long long) s.total); gui::NextColumn();
+            gui::Text("%.1f %s", s.mean(), m.unit); gui::NextColumn();
+            gui::Text("%llu", (unsigned long long) s.percentile(50)); gui::NextColumn();
+            gui::Text("%llu", (unsigned long long) s.percentile(99)); gui::NextColumn();
+            gui::Text("%llu", (unsigned long long) s.max()); gui::NextColumn();
+            break;
+          }
+        }
+      });
+      gui::Columns(1);
+      gui::End();
+    }
+  }
+}
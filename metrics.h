@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <vector>
+
+#include "cache_isolated.h"
+#include "histogram.h"
+#include "noncopyable.h"
+
+// Named counters, gauges and histograms, cheap enough to leave in hot paths.
+//
+//   static counter dropped_frames("quality.dropped frames", "frames");
+//   static sharded_histogram bake_time("sky.bake", "us");
+//   ...
+//   dropped_frames += n;        // a relaxed add on a line nobody else is writing
+//   bake_time.record(elapsed);
+//
+// Counters and histograms are split into metric_shards slots, each on its own cache line, and every thread writes
+// to the slot it was dealt on first use. Pool workers are pinned one to a core, so in practice that means a slot
+// per core, and recording never bounces a line between cores. Reads sum the slots as they go without stopping
+// anyone, so a total read while others are recording is a little stale, but never torn.
+//
+// A gauge holds a single value, like the duration of the last sky bake, so its last writer wins and there is
+// nothing to shard.
+//
+// Every metric registers itself by name with metrics::global() for as long as it lives, which is what the metrics
+// window and export_csv walk. Registration takes a lock; recording never does.
+namespace framework {
+
+  static const size_t metric_shards = 16; // power of 2
+
+  namespace detail {
+    // which slot the calling thread records into
+    inline size_t metric_shard() noexcept {
+      static std::atomic<size_t> next{ 0 };
+      static thread_local size_t shard = next.fetch_add(1, std::memory_order_relaxed) & (metric_shards - 1);
+      return shard;
+    }
+  }
+
+  enum class metric_kind : int {
+    counter = 0,
+    gauge = 1,
+    histogram = 2
+  };
+
+  struct metric : noncopyable {
+    metric(const char * name, metric_kind kind, const char * unit);
+    ~metric();
+    const char * name;
+    metric_kind kind;
+    const char * unit;
+  };
+
+  struct counter : metric {
+    explicit counter(const char * name, const char * unit = "") : metric(name, metric_kind::counter, unit) {}
+
+    void add(uint64_t n = 1) noexcept { shards[detail::metric_shard()].data.fetch_add(n, std::memory_order_relaxed); }
+    counter & operator ++ () noexcept { add(1); return *this; }
+    counter & operator += (uint64_t n) noexcept { add(n); return *this; }
+
+    uint64_t read() const noexcept {
+      uint64_t result = 0;
+      for (auto & s : shards) result += s.data.load(std::memory_order_relaxed);
+      return result;
+    }
+
+  private:
+    cache_isolated<std::atomic<uint64_t>> shards[metric_shards];
+  };
+
+  struct gauge : metric {
+    explicit gauge(const char * name, const char * unit = "") : metric(name, metric_kind::gauge, unit) {}
+
+    void set(int64_t v) noexcept { value.data.store(v, std::memory_order_relaxed); }
+    void add(int64_t n) noexcept { value.data.fetch_add(n, std::memory_order_relaxed); }
+    gauge & operator = (int64_t v) noexcept { set(v); return *this; }
+
+    int64_t read() const noexcept { return value.data.load(std::memory_order_relaxed); }
+
+  private:
+    cache_isolated<std::atomic<int64_t>> value{ 0 };
+  };
+
+  struct sharded_histogram : metric {
+    explicit sharded_histogram(const char * name, const char * unit = "") : metric(name, metric_kind::histogram, unit) {}
+
+    void record(uint64_t v) noexcept { shards[detail::metric_shard()].h.record_shared(v); }
+
+    histogram::snapshot read() const noexcept {
+      histogram::snapshot result;
+      for (auto & s : shards) result += s.h.read();
+      return result;
+    }
+
+  private:
+    struct alignas(64) shard {
+      histogram h;
+    };
+    shard shards[metric_shards];
+  };
+
+  // everything currently alive
+  struct metrics : noncopyable {
+    static metrics & global();
+
+    // f(const metric &) for each registered metric, in order of registration. don't register anything from f
+    template <typename F> void each(F && f) const {
+      std::lock_guard<std::mutex> lock(m);
+      for (const metric * p : all) f(*p);
+    }
+
+    // name,kind,unit,count,value,mean,p50,p99,max; one line per metric
+    void write_csv(std::ostream & out) const;
+
+    // append a header and a timestamped block of lines to filename. false if we couldn't write it
+    bool export_csv(const char * filename) const;
+
+  private:
+    friend struct metric;
+    mutable std::mutex m;
+    std::vector<const metric *> all;
+  };
+
+  void metrics_window(bool * open);
+}
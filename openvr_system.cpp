@@ -46,10 +46,6 @@ namespace framework {
 
     }
 
-    string system::device_string(device_id index, vr::TrackedDeviceProperty prop, vr::TrackedPropertyError * error) const {
-      return openvr::buffered_with_error(mem_fn(&vr::IVRSystem::GetStringTrackedDeviceProperty), error, handle, index, prop);
-    }
-
     bool system::poll() const {
       // Process SteamVR events
       vr::VREvent_t event;
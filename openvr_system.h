@@ -14,8 +14,9 @@
 namespace framework {
 
   namespace openvr {
-    template<typename... Ts, typename f, typename err> static inline string buffered_with_error(f fun, err *e, Ts... args) {
-      string result;
+    // S is any string type, e.g. frame_string for one that's only needed this frame
+    template<typename S = string, typename... Ts, typename f, typename err> static inline S buffered_with_error(f fun, err *e, Ts... args) {
+      S result;
       uint32_t newlen = fun(args..., nullptr, 0, e), len = 0;
       do {
         len = newlen;
@@ -27,8 +28,8 @@ namespace framework {
       return result;
     }
 
-    template<typename... Ts, typename f> static inline string buffered(f fun, Ts... args) {
-      string result;
+    template<typename S = string, typename... Ts, typename f> static inline S buffered(f fun, Ts... args) {
+      S result;
       uint32_t newlen = fun(args..., nullptr, 0), len = 0;
       do {
         len = newlen;
@@ -49,7 +50,9 @@ namespace framework {
 
       vr::TrackedDeviceClass device_class(device_id i) const;
       bool valid_device(device_id index) const;
-      string device_string(device_id index, vr::TrackedDeviceProperty prop, vr::TrackedPropertyError * error = nullptr) const;
+      template <typename S = string> S device_string(device_id index, vr::TrackedDeviceProperty prop, vr::TrackedPropertyError * error = nullptr) const {
+        return buffered_with_error<S>(mem_fn(&vr::IVRSystem::GetStringTrackedDeviceProperty), error, handle, index, prop);
+      }
 
       inline string driver() const;
       inline string driver_version() const;
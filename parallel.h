@@ -0,0 +1,294 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "noncopyable.h"
+#include "worker.h"
+
+// Fork-join combinators on top of framework::pool.
+//
+// Each comes in two flavors. The blocking form returns once all of the work is done, and the calling
+// thread runs jobs while it waits: a worker keeps draining its own queue, and a thread from outside of
+// the pool joins in as a guest worker. The continuation-style form returns immediately and spawns the
+// supplied continuation on whichever worker finishes last.
+//
+// Loops use lazy binary splitting, as described in "Lazy Binary-Splitting: A Run-Time Adaptive
+// Work-Stealing Scheduler" by Tzannes, Caragea, Barua and Vishkin. A loop runs grain-sized chunks
+// sequentially and only splits off the top half of what remains when there is nothing left in the
+// local queue for a peer to take. This pairs naturally with the private deques above, since a busy
+// worker only has something to deal when its queue is non-empty.
+//
+// Everything spawned stays in the lane of whoever spawned it, and loops in the background lane step
+// aside for waiting critical work between chunks.
+//
+// If any job throws, the rest of a loop stops at its next chunk and the first exception is rethrown
+// from the blocking form once everything already running has finished. The continuation-style forms
+// have nobody to throw to, so k is dropped and the worker that finished last reports the exception.
+// See task_group.h for fork-join with cancellation.
+namespace framework {
+
+  namespace detail {
+    template <typename T> struct non_deduced {
+      typedef T type;
+    };
+
+    // the first exception thrown by any job in a region, kept for whoever is waiting on it. later ones are dropped
+    struct first_exception : noncopyable {
+      std::atomic<bool> failed{ false }; // set as soon as anything throws, a hint to stop early
+      std::exception_ptr error; // written once, by whoever set failed, and read once the region has drained
+
+      template <typename F> void attempt(F && f) noexcept {
+        try {
+          f();
+        } catch (...) {
+          capture();
+        }
+      }
+      void capture() noexcept { // from inside a catch block
+        if (!failed.exchange(true, std::memory_order_acq_rel)) error = std::current_exception();
+      }
+      bool stopping() const noexcept { return failed.load(std::memory_order_relaxed); }
+      void rethrow() {
+        if (error) std::rethrow_exception(error);
+      }
+      void reset() noexcept { // for reuse, once nothing is running
+        error = nullptr;
+        failed.store(false, std::memory_order_relaxed);
+      }
+    };
+
+    // outstanding jobs in a blocking fork-join region. the root counts as one.
+    struct join_counter : first_exception {
+      std::atomic<size_t> pending{ 1 };
+      void fork() noexcept { pending.fetch_add(1, std::memory_order_relaxed); }
+      void join(worker &) noexcept { pending.fetch_sub(1, std::memory_order_release); }
+      bool done() const noexcept { return pending.load(std::memory_order_acquire) == 0; }
+    };
+
+    // outstanding jobs in a continuation-style region. the last one out completes the region and frees it.
+    struct join_continuation : first_exception {
+      explicit join_continuation(size_t pending = 1) : pending(pending) {}
+      std::atomic<size_t> pending;
+      virtual ~join_continuation() {}
+      void fork() noexcept { pending.fetch_add(1, std::memory_order_relaxed); }
+      void join(worker & w) {
+        if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          std::exception_ptr e = error;
+          if (!e) complete(w);
+          delete this;
+          if (e) std::rethrow_exception(e); // nobody is waiting on us, so let the worker report it
+        }
+      }
+      virtual void complete(worker & w) = 0;
+    };
+
+    // run f with a worker for p on this thread, enlisting the thread as a guest if it isn't one of ours
+    template <typename F> void with_worker(pool & p, F && f) {
+      worker * w = worker::current();
+      if (w != nullptr && &w->p == &p) {
+        f(*w);
+      } else {
+        worker & guest = p.guest();
+        worker::enlisted scope(guest);
+        f(guest);
+      }
+    }
+
+    // make ourselves useful until the region drains
+    inline void help_until(worker & w, const join_counter & j) {
+      while (!j.done())
+        if (!w.try_run_one()) std::this_thread::yield();
+    }
+
+    template <typename Index, typename State>
+    void lazy_split(worker & w, Index lo, Index hi, Index grain, State & s) {
+      auto && body = s.segment();
+      while (lo < hi && !s.stopping()) {
+        if (hi - lo > grain && !w.has_local_work()) {
+          // nobody has anything to take from us, so split off the top half where they can find it
+          Index mid = lo + (hi - lo) / 2;
+          s.fork();
+          w.spawn([mid, hi, grain, &s](worker & w) {
+            s.attempt([&] { lazy_split(w, mid, hi, grain, s); });
+            s.join(w);
+          });
+          hi = mid;
+        } else {
+          w.yield_to_critical();
+          Index end = std::min<Index>(hi, lo + grain);
+          for (; lo < end; ++lo) body(lo);
+        }
+      }
+      s.finish(body);
+    }
+
+    template <typename Join, typename F> struct for_state : Join {
+      template <typename G> explicit for_state(G && g) : f(std::forward<G>(g)) {}
+      F f;
+      F & segment() noexcept { return f; }
+      void finish(F &) noexcept {}
+    };
+
+    template <typename F> struct for_continuation final : for_state<join_continuation, F> {
+      template <typename G> for_continuation(G && g, task k) : for_state<join_continuation, F>(std::forward<G>(g)), k(std::move(k)) {}
+      task k;
+      void complete(worker & w) override { w.spawn(std::move(k)); }
+    };
+
+    // each segment of a reduction accumulates privately, then folds into the total once when it is done
+    template <typename Join, typename T, typename F, typename C> struct reduce_state : Join {
+      template <typename G, typename H> reduce_state(T identity, G && g, H && h)
+        : identity(identity), total(std::move(identity)), f(std::forward<G>(g)), combine(std::forward<H>(h)) {}
+
+      struct segment_type {
+        reduce_state & s;
+        T acc;
+        template <typename Index> void operator()(Index i) { s.f(i, acc); }
+      };
+
+      segment_type segment() { return segment_type{ *this, identity }; }
+      void finish(segment_type & seg) {
+        std::lock_guard<std::mutex> lock(m);
+        total = combine(std::move(total), std::move(seg.acc));
+      }
+
+      T identity, total;
+      F f;
+      C combine;
+      std::mutex m;
+    };
+
+    template <typename T, typename F, typename C, typename K> struct reduce_continuation final : reduce_state<join_continuation, T, F, C> {
+      template <typename G, typename H, typename L> reduce_continuation(T identity, G && g, H && h, L && l)
+        : reduce_state<join_continuation, T, F, C>(std::move(identity), std::forward<G>(g), std::forward<H>(h)), k(std::forward<L>(l)) {}
+      K k;
+      void complete(worker & w) override {
+        w.spawn([k = std::move(k), result = std::move(this->total)](worker & w) mutable { k(w, std::move(result)); });
+      }
+    };
+
+    struct invoke_continuation final : join_continuation {
+      invoke_continuation(task k, size_t n) : join_continuation(n), k(std::move(k)) {}
+      task k;
+      void complete(worker & w) override { w.spawn(std::move(k)); }
+    };
+
+    template <typename Join> inline void spawn_each(worker &, Join &) {}
+
+    template <typename Join, typename F, typename ... Fs> void spawn_each(worker & w, Join & j, F && f, Fs && ... fs) {
+      j.fork();
+      w.spawn([f = std::forward<F>(f), &j](worker & w) mutable {
+        j.attempt(f);
+        j.join(w);
+      });
+      spawn_each(w, j, std::forward<Fs>(fs)...);
+    }
+  }
+
+  // run f(i) for each i in [first, last), splitting into chunks of no fewer than grain iterations
+  template <typename Index, typename F>
+  void parallel_for(pool & p, Index first, Index last, typename detail::non_deduced<Index>::type grain, F && f) {
+    if (!(first < last)) return;
+    grain = std::max<Index>(grain, 1);
+    detail::for_state<detail::join_counter, F&> s(f);
+    detail::with_worker(p, [&](worker & w) {
+      s.attempt([&] { detail::lazy_split(w, first, last, grain, s); });
+      s.join(w);
+      detail::help_until(w, s);
+    });
+    s.rethrow();
+  }
+
+  // continuation-style: returns immediately, k is spawned once every iteration has completed
+  template <typename Index, typename F>
+  void parallel_for(pool & p, Index first, Index last, typename detail::non_deduced<Index>::type grain, F && f, task k) {
+    grain = std::max<Index>(grain, 1);
+    auto s = new detail::for_continuation<typename std::decay<F>::type>(std::forward<F>(f), std::move(k));
+    p.run([s, first, last, grain](worker & w) {
+      s->attempt([&] { detail::lazy_split(w, first, last, grain, *s); });
+      s->join(w);
+    });
+  }
+
+  // fold f(i, acc) over [first, last). each chunk starts from identity, and the partial results are
+  // merged with combine(T, T) -> T in no particular order, so combine must be associative and commutative.
+  template <typename Index, typename T, typename F, typename C>
+  T parallel_reduce(pool & p, Index first, Index last, typename detail::non_deduced<Index>::type grain, T identity, F && f, C && combine) {
+    if (!(first < last)) return identity;
+    grain = std::max<Index>(grain, 1);
+    detail::reduce_state<detail::join_counter, T, F&, C&> s(std::move(identity), f, combine);
+    detail::with_worker(p, [&](worker & w) {
+      s.attempt([&] { detail::lazy_split(w, first, last, grain, s); });
+      s.join(w);
+      detail::help_until(w, s);
+    });
+    s.rethrow();
+    return std::move(s.total);
+  }
+
+  // continuation-style: returns immediately, k(worker &, T) is spawned with the result
+  template <typename Index, typename T, typename F, typename C, typename K>
+  void parallel_reduce(pool & p, Index first, Index last, typename detail::non_deduced<Index>::type grain, T identity, F && f, C && combine, K && k) {
+    grain = std::max<Index>(grain, 1);
+    auto s = new detail::reduce_continuation<T, typename std::decay<F>::type, typename std::decay<C>::type, typename std::decay<K>::type>(
+      std::move(identity), std::forward<F>(f), std::forward<C>(combine), std::forward<K>(k)
+    );
+    p.run([s, first, last, grain](worker & w) {
+      s->attempt([&] { detail::lazy_split(w, first, last, grain, *s); });
+      s->join(w);
+    });
+  }
+
+  // parallel_for on the process-wide scheduler. without one, the loop just runs here, serially
+  template <typename Index, typename F>
+  void parallel_for(Index first, Index last, typename detail::non_deduced<Index>::type grain, F && f) {
+    if (pool * p = scheduler::current()) {
+      parallel_for(*p, first, last, grain, std::forward<F>(f));
+      return;
+    }
+    for (Index i = first; i < last; ++i) f(i);
+  }
+
+  // parallel_reduce on the process-wide scheduler. without one, the fold just runs here, serially
+  template <typename Index, typename T, typename F, typename C>
+  T parallel_reduce(Index first, Index last, typename detail::non_deduced<Index>::type grain, T identity, F && f, C && combine) {
+    if (pool * p = scheduler::current())
+      return parallel_reduce(*p, first, last, grain, std::move(identity), std::forward<F>(f), std::forward<C>(combine));
+    T acc = std::move(identity);
+    for (Index i = first; i < last; ++i) f(i, acc);
+    return acc;
+  }
+
+  // run each of the nullary functions, potentially in parallel. the first runs on this thread.
+  template <typename F, typename ... Fs, typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, task>::value>::type>
+  void parallel_invoke(pool & p, F && f, Fs && ... fs) {
+    detail::join_counter j;
+    detail::with_worker(p, [&](worker & w) {
+      detail::spawn_each(w, j, std::ref(fs)...);
+      j.attempt(f);
+      j.join(w);
+      detail::help_until(w, j);
+    });
+    j.rethrow();
+  }
+
+  // continuation-style: returns immediately, k is spawned once all of the functions have returned
+  template <typename ... Fs>
+  void parallel_invoke(pool & p, task k, Fs && ... fs) {
+    if (sizeof...(Fs) == 0) {
+      p.run(std::move(k));
+      return;
+    }
+    auto j = new detail::invoke_continuation(std::move(k), sizeof...(Fs));
+    using expand = int[];
+    (void) expand { 0, (p.run([f = std::forward<Fs>(fs), j](worker & w) mutable {
+      j->attempt(f);
+      j->join(w);
+    }), 0)... };
+  }
+}
@@ -0,0 +1,204 @@
+#include "stdafx.h"
+#include <algorithm>
+#include <atomic>
+#include "aligned_allocator.h"
+#include "cache_isolated.h"
+#include "noncopyable.h"
+#include "pool_allocator.h"
+
+using namespace std;
+
+namespace framework {
+  namespace detail {
+
+    static size_t class_size(size_t c) noexcept {
+      if (c < 8) return (c + 1) * 16;
+      size_t octave = (c - 8) >> 2, step = (c - 8) & 3;
+      return (size_t(128) << octave) + (step + 1) * (size_t(32) << octave);
+    }
+
+    // the smallest class that will hold size bytes. no table, so it works during static initialization
+    static inline size_t size_class(size_t size) noexcept {
+      size_t n = std::max<size_t>((size + pool_alignment - 1) & ~(pool_alignment - 1), pool_alignment);
+      if (n <= 128) return n / 16 - 1;
+      size_t octave = n <= 256 ? 0 : n <= 512 ? 1 : 2;
+      return 8 + 4 * octave + (n - (size_t(128) << octave) - 1) / (size_t(32) << octave);
+    }
+
+    struct free_block {
+      free_block * next;
+    };
+
+    struct pool_cache;
+
+    // lives at the start of every span
+    struct alignas(64) span_header {
+      pool_cache * owner;
+      size_t size_class;
+    };
+
+    struct pool_cache : noncopyable {
+      struct bin {
+        free_block * head = nullptr;
+        char * top = nullptr; // carving blocks out of the span we got most recently
+        char * limit = nullptr;
+      };
+
+      // remote frees on their way to one owner
+      struct batch {
+        pool_cache * owner = nullptr;
+        free_block * head = nullptr;
+        free_block * tail = nullptr;
+        size_t count = 0;
+      };
+
+      bin bins[pool_classes];
+      batch outgoing[pool_classes];
+      cache_isolated<atomic<free_block *>> remote[pool_classes]; // pushed by other threads, taken all at once by us
+      atomic<bool> used{ true };
+      pool_cache * next = nullptr;
+
+      pool_cache() {
+        for (auto & r : remote) r.data.store(nullptr, memory_order_relaxed);
+      }
+
+      void * allocate(size_t c);
+      void deallocate(void * p, size_t c) noexcept;
+      void send(batch & b, size_t c) noexcept;
+      void flush() noexcept;
+    };
+
+    struct pool_registry : noncopyable {
+      atomic<pool_cache *> caches{ nullptr };
+      atomic<uint64_t> spans{ 0 }, remote_blocks{ 0 }, remote_batches{ 0 };
+
+      pool_cache & acquire() {
+        for (pool_cache * cursor = caches.load(memory_order_acquire); cursor != nullptr; cursor = cursor->next)
+          if (!cursor->used.load(memory_order_relaxed) && !cursor->used.exchange(true, memory_order_acquire))
+            return *cursor;
+        pool_cache * c = new pool_cache;
+        pool_cache * head = caches.load(memory_order_relaxed);
+        do c->next = head; while (!caches.compare_exchange_weak(head, c, memory_order_release, memory_order_relaxed));
+        return *c;
+      }
+
+      static pool_registry & global() {
+        static pool_registry * instance = new pool_registry; // leaked, as blocks may be freed during static destruction
+        return *instance;
+      }
+    };
+
+    void * pool_cache::allocate(size_t c) {
+      bin & b = bins[c];
+      if (b.head == nullptr && remote[c].data.load(memory_order_relaxed) != nullptr)
+        b.head = remote[c].data.exchange(nullptr, memory_order_acquire);
+      if (free_block * f = b.head) {
+        b.head = f->next;
+        return f;
+      }
+      size_t n = class_size(c);
+      if (b.top == nullptr || b.top + n > b.limit) {
+        char * base = static_cast<char *>(allocate_aligned_memory(pool_span_size, pool_span_size));
+        if (base == nullptr) throw bad_alloc();
+        span_header * h = new (base) span_header;
+        h->owner = this;
+        h->size_class = c;
+        b.top = base + sizeof(span_header);
+        b.limit = base + pool_span_size;
+        pool_registry::global().spans.fetch_add(1, memory_order_relaxed);
+      }
+      void * result = b.top;
+      b.top += n;
+      return result;
+    }
+
+    void pool_cache::deallocate(void * p, size_t c) noexcept {
+      span_header * h = reinterpret_cast<span_header *>(uintptr_t(p) & ~uintptr_t(pool_span_size - 1));
+      assert(h->size_class == c);
+      free_block * f = static_cast<free_block *>(p);
+      if (h->owner == this) {
+        f->next = bins[c].head;
+        bins[c].head = f;
+        return;
+      }
+      batch & b = outgoing[c];
+      if (b.owner != h->owner) {
+        if (b.count != 0) send(b, c);
+        b.owner = h->owner;
+      }
+      f->next = b.head;
+      b.head = f;
+      if (b.tail == nullptr) b.tail = f;
+      if (++b.count >= pool_remote_batch) send(b, c);
+    }
+
+    void pool_cache::send(batch & b, size_t c) noexcept {
+      auto & r = b.owner->remote[c].data;
+      free_block * head = r.load(memory_order_relaxed);
+      do b.tail->next = head; while (!r.compare_exchange_weak(head, b.head, memory_order_release, memory_order_relaxed));
+      pool_registry & g = pool_registry::global();
+      g.remote_blocks.fetch_add(b.count, memory_order_relaxed);
+      g.remote_batches.fetch_add(1, memory_order_relaxed);
+      b.head = b.tail = nullptr;
+      b.count = 0;
+    }
+
+    void pool_cache::flush() noexcept {
+      for (size_t c = 0; c < pool_classes; ++c)
+        if (outgoing[c].count != 0) send(outgoing[c], c);
+    }
+
+    // trivially destructible, so it can still be read after the registration below is gone
+    static thread_local pool_cache * current = nullptr;
+
+    static pool_cache & local() {
+      if (current == nullptr) {
+        current = &pool_registry::global().acquire();
+        struct registration {
+          ~registration() {
+            if (current == nullptr) return;
+            current->flush();
+            current->used.store(false, memory_order_release);
+            current = nullptr;
+          }
+        };
+        // a thread that frees pooled memory after this has been torn down gets a cache that is never handed on
+        static thread_local registration self;
+      }
+      return *current;
+    }
+
+    void * pool_allocate(size_t size, size_t align) {
+      if (size > pool_max_size || align > pool_alignment) {
+        void * p = allocate_aligned_memory(std::max(align, sizeof(void *)), std::max<size_t>(size, 1));
+        if (p == nullptr) throw bad_alloc();
+        return p;
+      }
+      return local().allocate(size_class(size));
+    }
+
+    void pool_deallocate(void * p, size_t size, size_t align) noexcept {
+      if (p == nullptr) return;
+      if (size > pool_max_size || align > pool_alignment) {
+        deallocate_aligned_memory(p);
+        return;
+      }
+      local().deallocate(p, size_class(size));
+    }
+
+    void pool_flush() noexcept {
+      if (current != nullptr) current->flush();
+    }
+  }
+
+  pool_stats get_pool_stats() noexcept {
+    detail::pool_registry & g = detail::pool_registry::global();
+    pool_stats result;
+    for (detail::pool_cache * cursor = g.caches.load(memory_order_acquire); cursor != nullptr; cursor = cursor->next)
+      if (cursor->used.load(memory_order_relaxed)) ++result.caches;
+    result.spans = g.spans.load(memory_order_relaxed);
+    result.remote_blocks = g.remote_blocks.load(memory_order_relaxed);
+    result.remote_batches = g.remote_batches.load(memory_order_relaxed);
+    return result;
+  }
+}
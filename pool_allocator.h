@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// A size-class pool for small objects: task closures, inbox nodes, shared_ptr control blocks, map nodes.
+//
+//   auto m = make_pooled<rendermodel>(name, model);       // object and control block in one pooled block
+//   pooled_map<string, shared_ptr<rendermodel>> models;   // nodes from the pool
+//
+// Requests up to pool_max_size bytes are rounded up to one of pool_classes sizes, and carved out of 64k spans
+// that belong to whichever thread carved them. Every thread has a cache of free blocks per class, so allocating
+// and freeing on the same thread touches nothing shared.
+//
+// A block freed on some other thread goes home. The freeing thread strings blocks for the same owner together,
+// and hands over pool_remote_batch of them at a time with one CAS onto the owner's remote list for that class,
+// which the owner takes in one exchange when its own list runs dry. So work that is produced on one thread and
+// consumed on another, like an inbox, doesn't pile memory up on the consumer, and spans don't fragment across
+// every thread that ever touched them. Pool workers flush partial batches whenever they go idle, as does any
+// thread on its way out.
+//
+// Spans are never returned to the heap. A thread's cache, spans and all, is handed on to the next thread to need
+// one when it exits, the same way epoch records are. Anything bigger than pool_max_size, or aligned past 16 bytes,
+// goes to the heap as usual.
+namespace framework {
+  namespace detail {
+    static const size_t pool_span_size = 64 * 1024; // and alignment, so a block can find its span header
+    static const size_t pool_max_size = 1024;       // the largest class
+    static const size_t pool_classes = 20;          // 16..128 by 16, then four steps per doubling to 1024
+    static const size_t pool_alignment = 16;        // every class is a multiple of this
+    static const size_t pool_remote_batch = 32;     // blocks sent home with one CAS
+
+    void * pool_allocate(size_t size, size_t align = pool_alignment);
+    void pool_deallocate(void * p, size_t size, size_t align = pool_alignment) noexcept;
+
+    // send the calling thread's partial batches of remote frees home now
+    void pool_flush() noexcept;
+  }
+
+  struct pool_stats {
+    uint64_t caches = 0;       // threads currently holding one
+    uint64_t spans = 0;        // carved from the heap, ever
+    uint64_t remote_blocks = 0; // freed away from home
+    uint64_t remote_batches = 0; // CASes that sent them home
+  };
+
+  pool_stats get_pool_stats() noexcept;
+
+  template <typename T> struct pool_allocator {
+    typedef T         value_type;
+    typedef T*        pointer;
+    typedef const T*  const_pointer;
+    typedef T&        reference;
+    typedef const T&  const_reference;
+    typedef size_t    size_type;
+    typedef ptrdiff_t difference_type;
+
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type is_always_equal;
+
+    template <class U> struct rebind { typedef pool_allocator<U> other; };
+
+    pool_allocator() noexcept {}
+
+    template <class U> pool_allocator(const pool_allocator<U> &) noexcept {}
+
+    size_type max_size() const noexcept {
+      return size_type(~0) / sizeof(T);
+    }
+
+    pointer allocate(size_type n) {
+      if (n > max_size()) throw std::bad_alloc();
+      return static_cast<pointer>(detail::pool_allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(pointer p, size_type n) noexcept {
+      detail::pool_deallocate(p, n * sizeof(T), alignof(T));
+    }
+  };
+
+  template <typename T, typename U>
+  inline bool operator== (const pool_allocator<T> &, const pool_allocator<U> &) noexcept { return true; }
+
+  template <typename T, typename U>
+  inline bool operator!= (const pool_allocator<T> &, const pool_allocator<U> &) noexcept { return false; }
+
+  // make_shared, with the object and its control block in one pooled block
+  template <typename T, typename ... Args> std::shared_ptr<T> make_pooled(Args && ... args) {
+    return std::allocate_shared<T>(pool_allocator<T>(), std::forward<Args>(args)...);
+  }
+
+  template <typename K, typename V, typename C = std::less<K>>
+  using pooled_map = std::map<K, V, C, pool_allocator<std::pair<const K, V>>>;
+}
@@ -0,0 +1,148 @@
+#include "stdafx.h"
+#include "pose_service.h"
+
+#ifdef FRAMEWORK_SUPPORTS_OPENVR
+
+#include "openvr.h"
+#include "spdlog.h"
+
+using namespace std::chrono;
+
+namespace framework {
+
+  mat4 device_pose::device_to_world() const noexcept {
+    mat4 result = mat4_cast(orientation);
+    result[3] = vec4(position, 1.f);
+    return result;
+  }
+
+  static device_pose make_device_pose(const vr::TrackedDevicePose_t & p) noexcept {
+    mat4 m = openvr::hmd_mat3x4(p.mDeviceToAbsoluteTracking);
+    device_pose result;
+    result.position = vec3(m[3]);
+    result.orientation = normalize(quat_cast(mat3(m)));
+    result.velocity = vec3(p.vVelocity.v[0], p.vVelocity.v[1], p.vVelocity.v[2]);
+    result.angular_velocity = vec3(p.vAngularVelocity.v[0], p.vAngularVelocity.v[1], p.vAngularVelocity.v[2]);
+    return result;
+  }
+
+  // rotate by angular velocity w for dt seconds
+  static quat spin(const quat & q, const vec3 & w, float dt) noexcept {
+    float speed = length(w);
+    if (speed * dt < 1e-6f) return q;
+    return normalize(angleAxis(speed * dt, w / speed) * q);
+  }
+
+  static void extrapolate(const pose_sample & s, float dt, pose_sample & result) noexcept {
+    result.valid = s.valid;
+    for (int i = 0; i < pose_devices; ++i) {
+      const device_pose & d = s.device[i];
+      device_pose & r = result.device[i];
+      r.position = d.position + d.velocity * dt;
+      r.orientation = spin(d.orientation, d.angular_velocity, dt);
+      r.velocity = d.velocity;
+      r.angular_velocity = d.angular_velocity;
+    }
+  }
+
+  static void interpolate(const pose_sample & a, const pose_sample & b, float u, pose_sample & result) noexcept {
+    result.valid = a.valid | b.valid;
+    for (int i = 0; i < pose_devices; ++i) {
+      uint32_t bit = 1u << i;
+      if (!(a.valid & bit) || !(b.valid & bit)) {
+        // only one of them saw it, so take that one
+        result.device[i] = (b.valid & bit) ? b.device[i] : a.device[i];
+        continue;
+      }
+      const device_pose & p = a.device[i];
+      const device_pose & q = b.device[i];
+      device_pose & r = result.device[i];
+      r.position = mix(p.position, q.position, u);
+      r.orientation = slerp(p.orientation, q.orientation, u);
+      r.velocity = mix(p.velocity, q.velocity, u);
+      r.angular_velocity = mix(p.angular_velocity, q.angular_velocity, u);
+    }
+  }
+
+  pose_service::pose_service(openvr::system & vr, microseconds period)
+  : period(period)
+  , vr(vr) {
+    thread = std::thread([this] { main(); });
+  }
+
+  pose_service::~pose_service() {
+    stopping.store(true, std::memory_order_relaxed);
+    thread.join();
+  }
+
+  void pose_service::main() {
+    auto l = log("vr");
+    auto universe = vr::VRCompositor()->GetTrackingSpace(); // match whatever WaitGetPoses is using
+    l->info("pose service sampling every {}us", period.count());
+    vr::TrackedDevicePose_t poses[pose_devices];
+    pose_sample s;
+    auto next = steady_clock::now();
+    while (!stopping.load(std::memory_order_relaxed)) {
+      s.time = steady_clock::now();
+      vr.handle->GetDeviceToAbsoluteTrackingPose(universe, 0.f, poses, pose_devices);
+      s.valid = 0;
+      for (int i = 0; i < pose_devices; ++i) {
+        if (poses[i].bPoseIsValid) s.valid |= 1u << i;
+        s.device[i] = make_device_pose(poses[i]);
+      }
+      ring.push(s);
+
+      next += period;
+      auto now = steady_clock::now();
+      if (next < now) next = now; // fell behind, don't try to catch up
+      else std::this_thread::sleep_until(next);
+    }
+    l->info("pose service stopped after {} samples", ring.size());
+  }
+
+  bool pose_service::latest(pose_sample & result) const noexcept {
+    return ring.latest(result);
+  }
+
+  bool pose_service::at(time_point t, pose_sample & result) const noexcept {
+    pose_sample newer, older;
+    bool have_newer = false;
+    uint64_t n = ring.size();
+    // walk back from the newest until we find a sample from at or before t
+    for (uint64_t i = n; i-- > 0;) {
+      if (!ring.read(i, older)) break; // overwritten, so that's as far back as we go
+      if (older.time <= t) {
+        if (!have_newer) {
+          duration<float> dt = std::min<steady_clock::duration>(t - older.time, max_extrapolation);
+          result.time = t;
+          extrapolate(older, dt.count(), result);
+        } else {
+          float u = duration<float>(t - older.time).count() / duration<float>(newer.time - older.time).count();
+          result.time = t;
+          interpolate(older, newer, u, result);
+        }
+        return true;
+      }
+      newer = older;
+      have_newer = true;
+    }
+    if (have_newer) { // t is older than anything we still have
+      result = newer;
+      return true;
+    }
+    if (!ring.latest(older)) return false;
+    result = older; // lapped before we could read anything, so a fresh one will do
+    return true;
+  }
+
+  double pose_service::rate() const noexcept {
+    uint64_t n = ring.size();
+    if (n < 2) return 0;
+    uint64_t span = std::min<uint64_t>(n - 1, ring.capacity / 2);
+    pose_sample a, b;
+    if (!ring.read(n - 1, b) || !ring.read(n - 1 - span, a) || b.time <= a.time) return 0;
+    return span / duration<double>(b.time - a.time).count();
+  }
+}
+
+#endif
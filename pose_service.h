@@ -0,0 +1,73 @@
+#pragma once
+
+#include "config.h"
+
+#ifdef FRAMEWORK_SUPPORTS_OPENVR
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <glm/gtc/quaternion.hpp>
+
+#include "glm.h"
+#include "noncopyable.h"
+#include "openvr_system.h"
+#include "seqlock.h"
+
+// Device poses, sampled by a thread of their own well above the frame rate.
+//
+// WaitGetPoses hands the render thread one set of poses per frame. Anybody else, be it audio, the gui or a late
+// latch just before submit, wants the freshest pose they can get for the moment they care about, without
+// queuing up behind the render thread or hammering the VR runtime themselves. The pose service polls the runtime
+// every period and writes timestamped samples into a seqlock_ring, so any thread can ask at() for the poses at
+// a given time, interpolated between the samples either side, or extrapolated from the newest by its velocities.
+namespace framework {
+
+  static const int pose_devices = 16; // MAX_TRACKED_DEVICES in shaders/uniforms.h
+
+  struct device_pose {
+    vec3 position;
+    quat orientation;
+    vec3 velocity; // m/s
+    vec3 angular_velocity; // radians/s, about the world axes
+
+    mat4 device_to_world() const noexcept;
+  };
+
+  struct pose_sample {
+    std::chrono::steady_clock::time_point time;
+    uint32_t valid; // bit i is set if device[i] is tracking
+    device_pose device[pose_devices];
+  };
+
+  struct pose_service : noncopyable {
+    typedef std::chrono::steady_clock::time_point time_point;
+
+    explicit pose_service(openvr::system & vr, std::chrono::microseconds period = std::chrono::microseconds(1000));
+    ~pose_service();
+
+    // the newest sample. false if we don't have one yet
+    bool latest(pose_sample & result) const noexcept;
+
+    // poses as of t. never extrapolates further than max_extrapolation past the newest sample
+    bool at(time_point t, pose_sample & result) const noexcept;
+
+    // measured over whatever is in the ring
+    double rate() const noexcept;
+    uint64_t samples() const noexcept { return ring.size(); }
+
+    std::chrono::microseconds period;
+    std::chrono::milliseconds max_extrapolation{ 50 };
+
+  private:
+    void main();
+
+    openvr::system & vr;
+    seqlock_ring<pose_sample, 64> ring;
+    std::atomic<bool> stopping{ false };
+    std::thread thread;
+  };
+}
+
+#endif
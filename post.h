@@ -39,7 +39,7 @@ namespace framework {
       , tone(GL_FRAGMENT_SHADER, "post_tonemap")
       , w((quality.resolve_buffer_w + 1)/ 2)
       , h((quality.resolve_buffer_h + 1)/ 2)
-      , presolve(quality.resolve_target[0].format, "presolve", GL_RGBA16F)
+      , presolve(quality.resolve_target[0].format, "presolve", GL_RGBA16F, memory_tag::post)
       , timer("post") {
 
       glCreateVertexArrays(1, &vao);
@@ -47,7 +47,7 @@ namespace framework {
       for (int i = 0;i < 2;++i) {
         fbo[i].format = { w, h };
         string name = fmt::format("post fbo {}", i);
-        fbo[i].initialize(name, GL_RGBA16F);
+        fbo[i].initialize(name, GL_RGBA16F, memory_tag::post);
         //fbo[i].initialize(name, GL_R11F_G11F_B10F);
       }
       
@@ -82,6 +82,7 @@ namespace framework {
         if (!image) log("post")->warn("missing lenscolor.png");
         glCreateTextures(GL_TEXTURE_1D, 1, &color);
         glTextureStorage1D(color, 1, GL_RGB8, w);
+        gl::track_texture(color, gl::texture_bytes(GL_RGB8, w), memory_tag::post);
         if (image) glTextureSubImage1D(color, 0, 0, w, GL_RGBA, GL_UNSIGNED_BYTE, image);
         glTextureParameteri(color, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTextureParameteri(color, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -96,6 +97,7 @@ namespace framework {
         if (!image) log("post")->warn("missing lensdirt.png");
         glCreateTextures(GL_TEXTURE_2D, 1, &dirt);
         glTextureStorage2D(dirt, 1, GL_RGB8, w, h);
+        gl::track_texture(dirt, gl::texture_bytes(GL_RGB8, w, h), memory_tag::post);
         if (image) glTextureSubImage2D(dirt, 0, 0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, image);
         glTextureParameteri(dirt, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTextureParameteri(dirt, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -111,6 +113,7 @@ namespace framework {
         if (!image) log("post")->warn("missing lensstar.png");
         glCreateTextures(GL_TEXTURE_2D, 1, &star);
         glTextureStorage2D(star, 1, GL_RGB8, w, h);
+        gl::track_texture(star, gl::texture_bytes(GL_RGB8, w, h), memory_tag::post);
         if (image) glTextureSubImage2D(star, 0, 0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, image);
         glTextureParameteri(star, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTextureParameteri(star, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -128,6 +131,9 @@ namespace framework {
       glMakeTextureHandleNonResidentARB(color_handle);
       glMakeTextureHandleNonResidentARB(dirt_handle);
       glMakeTextureHandleNonResidentARB(star_handle);
+      gl::untrack_texture(color);
+      gl::untrack_texture(dirt);
+      gl::untrack_texture(star);
       glDeleteTextures(1, &color);
       glDeleteTextures(1, &dirt);
       glDeleteTextures(1, &star);
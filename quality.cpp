@@ -5,9 +5,12 @@
 #include "openvr_system.h"
 #include "timer.h"
 #include "quality.h"
+#include "worker.h"
+#include "metrics.h"
 
 namespace framework {
-  static int total_dropped_frames = 0;
+  static counter dropped_frames("quality.dropped frames", "frames");
+  static sharded_histogram frame_intervals("quality.frame interval", "us");
   static uint32_t last_adapted = 0;
   static float old_utilization = 0.8f, old_old_utilization = 0.8f, utilization = 0.8f;
   static vr::Compositor_FrameTiming frame_timing{};
@@ -29,7 +32,9 @@ namespace framework {
       auto old_frame_index = frame_timing.m_nFrameIndex;
       frame_timing.m_nSize = sizeof(vr::Compositor_FrameTiming);
       bool have_frame_timing = vr::VRCompositor()->GetFrameTiming(&frame_timing, 0);
-      total_dropped_frames += frame_timing.m_nNumDroppedFrames;
+      dropped_frames += frame_timing.m_nNumDroppedFrames;
+      if (have_frame_timing && frame_timing.m_nFrameIndex != old_frame_index)
+        frame_intervals.record(uint64_t(frame_timing.m_flClientFrameIntervalMs * 1000.f));
 
       old_old_utilization = old_utilization;
       old_utilization = utilization;
@@ -82,12 +87,19 @@ namespace framework {
       gui::Begin("Timing", &show_timing_window);
       gui::Text("viewport: %d x %d (%dx msaa)", viewport_w, viewport_h, render_target_metas[q.render_target].msaa_level);
       gui::Text("frame rate: %2.02f", 1000.0f / frame_timing.m_flClientFrameIntervalMs);
-      gui::Text("dropped frames: %d", total_dropped_frames);
+      gui::Text("dropped frames: %llu", (unsigned long long) dropped_frames.read());
+      histogram::snapshot intervals = frame_intervals.read();
+      gui::Text("frame interval: p50 %.2fms, p99 %.2fms, max %.2fms", intervals.percentile(50) * 1e-3, intervals.percentile(99) * 1e-3, intervals.max() * 1e-3);
       gui::Text("utilization: %.02f", utilization);
       gui::Text("headroom: %.2fms", frame_timing.m_nNumDroppedFrames ? 0.0f : frame_timing.m_flCompositorIdleCpuMs);
       gui::Text("pre-submit GPU: %.2fms", frame_timing.m_flPreSubmitGpuMs);
       gui::Text("post-submit GPU: %.2fms", frame_timing.m_flPostSubmitGpuMs);
       if (using_interleaved_reprojection) gui::Text("Using interleaved reprojection");
+      if (pool * workers = scheduler::current()) {
+        worker_times t = workers->times();
+        double total = std::max<double>(1.0, double(t.working + t.spinning + t.parked));
+        gui::Text("workers: %.0f%% working, %.0f%% spinning, %.0f%% parked", 100.0 * t.working / total, 100.0 * t.spinning / total, 100.0 * t.parked / total);
+      }
       gui::End();
     }
 
@@ -2,6 +2,7 @@
 #include "rendermodel.h"
 #include "shader.h"
 #include "filesystem.h"
+#include "frame_arena.h"
 #include "glm.h"
 
 using namespace vr;
@@ -19,6 +20,7 @@ namespace framework {
       make_attrib(&vr::RenderModel_Vertex_t::vNormal),
       make_attrib(&vr::RenderModel_Vertex_t::rfTextureCoord)
     ) {
+    vao.tag = memory_tag::rendermodels;
     vao.load(model.rVertexData, model.unVertexCount);
     vao.load_elements(model.rIndexData, model.unTriangleCount * 3);
   }
@@ -29,6 +31,7 @@ namespace framework {
     log("rendermodel")->info("create texture {} begin: {} x {}", name, diffuse.unWidth, diffuse.unHeight);
     glCreateTextures(GL_TEXTURE_2D, 1, &id);
     glTextureStorage2D(id, 5, GL_RGBA8, diffuse.unWidth, diffuse.unHeight);
+    gl::track_texture(id, gl::texture_bytes(GL_RGBA8, diffuse.unWidth, diffuse.unHeight, 1, 5), memory_tag::rendermodels);
     glTextureSubImage2D(id, 0, 0, 0, diffuse.unWidth, diffuse.unHeight, GL_RGBA, GL_UNSIGNED_BYTE, diffuse.rubTextureMapData);
     gl::label(GL_TEXTURE, id, "{} texture", name);
     glTextureParameteri(id, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -49,6 +52,7 @@ namespace framework {
 
   rendermodel_texture::~rendermodel_texture() {
     glMakeTextureHandleNonResidentARB(handle);
+    gl::untrack_texture(id);
     glDeleteTextures(1, &id);
   }
 
@@ -84,7 +88,7 @@ namespace framework {
     auto err = vrrm->LoadTexture_Async(key, &t);
     switch (err) {
       case vr::VRRenderModelError_None: {
-        auto m = make_shared<rendermodel_texture>(name, *t);
+        auto m = make_pooled<rendermodel_texture>(name, *t);
         vrrm->FreeTexture(t);
         textures.insert(iter, make_pair(key, m));
         if (result) *result = m;
@@ -116,7 +120,7 @@ namespace framework {
     auto err = vrrm->LoadRenderModel_Async(name.c_str(), &model);
     switch (err) {
     case vr::VRRenderModelError_None: {     
-      auto m = make_shared<rendermodel>(name, *model, !is_component && component_count(name) != 0);
+      auto m = make_pooled<rendermodel>(name, *model, !is_component && component_count(name) != 0);
       vrrm->FreeRenderModel(model);
       models.insert(iter, make_pair(name, m));
       if (result) *result = m;
@@ -159,9 +163,12 @@ namespace framework {
     // scan only active models
     for (auto i = vr::k_unTrackedDeviceIndex_Hmd + 1;i < vr::k_unMaxTrackedDeviceCount;++i) {
       if (!tracker.valid_device(i)) continue;
-      string name = tracker.device_string(i, vr::Prop_RenderModelName_String);
-      if (name == "") continue;
-      result = poll_model(name, &tracked_rendermodels[i]) && result;
+      // this runs every frame, so look the name up without touching the heap once the model is in hand
+      frame_string name = tracker.device_string<frame_string>(i, vr::Prop_RenderModelName_String);
+      if (name.empty()) continue;
+      auto & current = tracked_rendermodels[i];
+      if (current && current->name == name.c_str()) continue;
+      result = poll_model(string(name.c_str(), name.size()), &current) && result;
     }
 
     // for each model
@@ -7,6 +7,7 @@
 #include "filesystem.h"
 #include "shader.h"
 #include "noncopyable.h"
+#include "pool_allocator.h"
 #include "gui.h"
 #include "fmt.h"
 #include "timer.h"
@@ -46,7 +47,7 @@ namespace framework {
     vr::TextureID_t vr_texture_id;           // openvr asynchronous texture id
     shared_ptr<rendermodel_texture> diffuse; // updated after the fact
     bool missing_components;                 // do we have all the component parts?
-    map<string, shared_ptr<rendermodel>> components; // component parts, if any -- kinda hackish as real components don't have components right now.
+    pooled_map<string, shared_ptr<rendermodel>> components; // component parts, if any -- kinda hackish as real components don't have components right now.
   };
 
   
@@ -137,8 +138,8 @@ namespace framework {
     }
     openvr::system & tracker;
     vr::IVRRenderModels * vrrm;
-    map<string, shared_ptr<rendermodel>> models;
-    map<vr::TextureID_t, shared_ptr<rendermodel_texture>> textures;
+    pooled_map<string, shared_ptr<rendermodel>> models;
+    pooled_map<vr::TextureID_t, shared_ptr<rendermodel_texture>> textures;
     shared_ptr<rendermodel> tracked_rendermodels[vr::k_unMaxTrackedDeviceCount];
     gl::shader shader;
     scoped_connection 
@@ -0,0 +1,210 @@
+#include "stdafx.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ring_buffer.h"
+
+// Throughput and latency for the bounded rings in ring_buffer.h, against a std::deque behind a mutex.
+//
+//   ring_bench [--threads 1,2,4] [--items n] [--capacity n] [--batch n] [--quick]
+//
+// throughput  n producers and n consumers (one of each for spsc, one consumer for mpsc) move --items values
+//             between them, singly and then in batches of --batch. Every value is checked off at the other end,
+//             and anything lost or duplicated exits 1.
+// latency     two threads bounce a value back and forth over a pair of rings. We report the mean round trip.
+//
+// Full and empty rings are handled by yielding, which is what a real consumer with nothing better to do would do.
+
+using namespace std;
+using namespace std::chrono;
+using namespace framework;
+
+namespace {
+
+  struct options {
+    vector<int> threads;
+    uint64_t items = 1 << 22;
+    size_t capacity = 1024;
+    size_t batch = 32;
+  };
+
+  vector<int> parse_list(const char * s) {
+    vector<int> result;
+    stringstream ss(s);
+    string item;
+    while (getline(ss, item, ',')) result.push_back(atoi(item.c_str()));
+    return result;
+  }
+
+  [[noreturn]] void usage() {
+    cerr << "usage: ring_bench [--threads 1,2,4] [--items n] [--capacity n] [--batch n] [--quick]\n";
+    exit(2);
+  }
+
+  // the same interface as the rings, the slow way
+  template <typename T> struct locked_ring {
+    explicit locked_ring(size_t capacity) : limit(capacity) {}
+    bool push(T x) {
+      lock_guard<mutex> lock(m);
+      if (q.size() == limit) return false;
+      q.push_back(x);
+      return true;
+    }
+    bool pop(T & x) {
+      lock_guard<mutex> lock(m);
+      if (q.empty()) return false;
+      x = q.front();
+      q.pop_front();
+      return true;
+    }
+    template <typename It> size_t push_n(It first, size_t n) {
+      lock_guard<mutex> lock(m);
+      n = std::min(n, limit - q.size());
+      for (size_t i = 0; i < n; ++i, ++first) q.push_back(*first);
+      return n;
+    }
+    template <typename It> size_t pop_n(It out, size_t n) {
+      lock_guard<mutex> lock(m);
+      n = std::min(n, q.size());
+      for (size_t i = 0; i < n; ++i, ++out) {
+        *out = q.front();
+        q.pop_front();
+      }
+      return n;
+    }
+    size_t limit;
+    mutex m;
+    std::deque<T> q;
+  };
+
+  double seconds_since(steady_clock::time_point start) {
+    return duration<double>(steady_clock::now() - start).count();
+  }
+
+  // producers push 1..n between them, consumers pop until they've seen n. returns Mitems/s, or -1 if anything went missing
+  template <typename Q> double throughput(int producers, int consumers, uint64_t n, size_t capacity, size_t batch) {
+    Q q(capacity);
+    vector<atomic<uint8_t>> seen(n);
+    for (auto && s : seen) s.store(0, memory_order_relaxed);
+    atomic<uint64_t> consumed(0);
+    vector<thread> threads;
+    auto start = steady_clock::now();
+    for (int p = 0; p < producers; ++p)
+      threads.emplace_back([&, p] {
+        vector<uint64_t> buffer(batch);
+        uint64_t lo = n * p / producers, hi = n * (p + 1) / producers;
+        for (uint64_t i = lo; i < hi;) {
+          if (batch <= 1) {
+            while (!q.push(i + 1)) this_thread::yield();
+            ++i;
+          } else {
+            size_t k = size_t(std::min<uint64_t>(batch, hi - i));
+            for (size_t j = 0; j < k; ++j) buffer[j] = i + j + 1;
+            size_t done = 0;
+            while (done < k) {
+              size_t m = q.push_n(buffer.begin() + done, k - done);
+              if (m == 0) this_thread::yield();
+              done += m;
+            }
+            i += k;
+          }
+        }
+      });
+    for (int c = 0; c < consumers; ++c)
+      threads.emplace_back([&] {
+        vector<uint64_t> buffer(std::max<size_t>(batch, 1));
+        while (consumed.load(memory_order_relaxed) < n) {
+          size_t m = batch <= 1 ? (q.pop(buffer[0]) ? 1 : 0) : q.pop_n(buffer.begin(), batch);
+          if (m == 0) {
+            this_thread::yield();
+            continue;
+          }
+          for (size_t j = 0; j < m; ++j) seen[buffer[j] - 1].fetch_add(1, memory_order_relaxed);
+          consumed.fetch_add(m, memory_order_relaxed);
+        }
+      });
+    for (auto && t : threads) t.join();
+    double s = seconds_since(start);
+    for (auto && x : seen)
+      if (x.load(memory_order_relaxed) != 1) return -1;
+    return n / s * 1e-6;
+  }
+
+  // mean round trip in ns between two threads, over a ring each way
+  template <typename Q> double latency(uint64_t n, size_t capacity) {
+    Q ping(capacity), pong(capacity);
+    thread echo([&] {
+      uint64_t x;
+      for (uint64_t i = 0; i < n; ++i) {
+        while (!ping.pop(x)) {}
+        while (!pong.push(x)) {}
+      }
+    });
+    auto start = steady_clock::now();
+    uint64_t x;
+    for (uint64_t i = 0; i < n; ++i) {
+      while (!ping.push(i)) {}
+      while (!pong.pop(x)) {}
+    }
+    double s = seconds_since(start);
+    echo.join();
+    return s / n * 1e9;
+  }
+}
+
+int main(int argc, char ** argv) {
+  options o;
+  bool quick = false;
+  for (int i = 1; i < argc; ++i) {
+    string a = argv[i];
+    bool more = i + 1 < argc;
+    if (a == "--threads" && more) o.threads = parse_list(argv[++i]);
+    else if (a == "--items" && more) o.items = max(1, atoi(argv[++i]));
+    else if (a == "--capacity" && more) o.capacity = max(2, atoi(argv[++i]));
+    else if (a == "--batch" && more) o.batch = max(1, atoi(argv[++i]));
+    else if (a == "--quick") quick = true;
+    else usage();
+  }
+  if (quick) o.items = 1 << 16;
+  if (o.threads.empty()) {
+    int n = max(2, int(thread::hardware_concurrency())) / 2;
+    for (int t = 1; t <= n; t *= 2) o.threads.push_back(t);
+  }
+
+  bool ok = true;
+  auto report = [&](const char * benchmark, const char * ring, int threads, size_t batch, double single, double locked) {
+    cout << benchmark << "," << ring << "," << threads << "," << batch << "," << single << "," << locked << ",Mitems/s\n";
+    if (single < 0 || locked < 0) ok = false;
+  };
+
+  cout << "benchmark,ring,threads,batch,lock-free,locked,unit\n";
+  for (size_t batch : { size_t(1), o.batch }) {
+    report("throughput", "spsc", 1, batch,
+      throughput<spsc_ring<uint64_t>>(1, 1, o.items, o.capacity, batch),
+      throughput<locked_ring<uint64_t>>(1, 1, o.items, o.capacity, batch));
+    for (int t : o.threads) {
+      report("throughput", "mpsc", t, batch,
+        throughput<mpsc_ring<uint64_t>>(t, 1, o.items, o.capacity, batch),
+        throughput<locked_ring<uint64_t>>(t, 1, o.items, o.capacity, batch));
+      report("throughput", "mpmc", t, batch,
+        throughput<mpmc_ring<uint64_t>>(t, t, o.items, o.capacity, batch),
+        throughput<locked_ring<uint64_t>>(t, t, o.items, o.capacity, batch));
+    }
+  }
+
+  // spinning ping-pong with one core is just a measure of the scheduler's time slice
+  if (thread::hardware_concurrency() > 1) {
+    uint64_t n = quick ? 1 << 14 : 1 << 18;
+    cout << "latency,spsc,2,1," << latency<spsc_ring<uint64_t>>(n, o.capacity) << "," << latency<locked_ring<uint64_t>>(n, o.capacity) << ",ns/round trip\n";
+    cout << "latency,mpsc,2,1," << latency<mpsc_ring<uint64_t>>(n, o.capacity) << "," << latency<locked_ring<uint64_t>>(n, o.capacity) << ",ns/round trip\n";
+    cout << "latency,mpmc,2,1," << latency<mpmc_ring<uint64_t>>(n, o.capacity) << "," << latency<locked_ring<uint64_t>>(n, o.capacity) << ",ns/round trip\n";
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,345 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "cache_isolated.h"
+#include "noncopyable.h"
+
+// Bounded lock-free queues, for passing messages between threads without allocating.
+//
+//   spsc_ring<T>  one producer, one consumer. each side keeps a stale copy of the other's index and only rereads
+//                 it when the stale copy says it's full or empty, so in steady state neither side touches the
+//                 other's cache line at all.
+//   mpsc_ring<T>  any number of producers, one consumer.
+//   mpmc_ring<T>  any number of each. Dmitry Vyukov's [bounded MPMC queue](http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue):
+//                 every slot carries a sequence number saying whose turn it is, so producers and consumers only
+//                 contend on their own index, and only for as long as a compare-exchange.
+//
+// All three round the capacity up to a power of two, allocate once at construction, and never block. A push onto a
+// full ring or a pop off an empty one returns false, and it's up to the caller to decide whether to spin, yield,
+// or drop the message. push_n and pop_n move as many as are ready in one go, and touch the shared indices once
+// per batch rather than once per item.
+//
+// None of these are linearizable in the face of a producer that stalls mid-push: for mpsc and mpmc, items pushed
+// after it are invisible to consumers until it finishes. Nothing is lost, it just isn't there yet.
+namespace framework {
+
+  namespace detail {
+    inline size_t ring_capacity(size_t n) noexcept {
+      size_t c = 2;
+      while (c < n) c <<= 1;
+      return c;
+    }
+
+    // uninitialized storage for a T
+    template <typename T> struct ring_storage {
+      typename std::aligned_storage<sizeof(T), alignof(T)>::type bytes;
+      T * get() noexcept { return reinterpret_cast<T*>(&bytes); }
+    };
+
+    // a slot that says whose turn it is. lap l's producer may write slot i once sequence == l * capacity + i,
+    // and its consumer may read it once sequence == l * capacity + i + 1
+    template <typename T> struct sequenced_slot {
+      std::atomic<size_t> sequence;
+      ring_storage<T> value;
+    };
+
+    // claim up to n consecutive slots from index on, each of which must have sequence slot index + offset: 0 for a
+    // producer after empty slots, 1 for a consumer after full ones. a slot in that state only changes hands when
+    // somebody moves index past it, so once our exchange goes through they're ours. returns how many, and where
+    // they start in first, or 0 if the ring is full (or empty) as far as we're concerned
+    template <typename T> size_t claim(std::atomic<size_t> & index, sequenced_slot<T> * slots, size_t mask, size_t offset, size_t n, size_t & first) noexcept {
+      size_t i = index.load(std::memory_order_relaxed);
+      for (;;) {
+        size_t k = 0;
+        while (k < n && k <= mask && slots[(i + k) & mask].sequence.load(std::memory_order_acquire) == i + k + offset) ++k;
+        if (k == 0) {
+          if (intptr_t(slots[i & mask].sequence.load(std::memory_order_acquire)) - intptr_t(i + offset) < 0) return 0;
+          i = index.load(std::memory_order_relaxed); // somebody beat us to it
+        } else if (index.compare_exchange_weak(i, i + k, std::memory_order_relaxed)) {
+          first = i;
+          return k;
+        }
+      }
+    }
+
+    // destroy whatever is still waiting to be popped, starting from head
+    template <typename T> void destroy_filled(sequenced_slot<T> * slots, size_t mask, size_t head) noexcept {
+      for (size_t h = head; slots[h & mask].sequence.load(std::memory_order_relaxed) == h + 1; ++h)
+        slots[h & mask].value.get()->~T();
+    }
+  }
+
+  template <typename T> struct spsc_ring : noncopyable {
+    explicit spsc_ring(size_t capacity) : mask(detail::ring_capacity(capacity) - 1), slots(new detail::ring_storage<T>[mask + 1]) {}
+
+    ~spsc_ring() {
+      size_t h = head.data.load(std::memory_order_relaxed), t = tail.data.load(std::memory_order_relaxed);
+      for (; h != t; ++h) slots[h & mask].get()->~T();
+    }
+
+    size_t capacity() const noexcept { return mask + 1; }
+
+    // producer only
+    template <typename ... Args> bool emplace(Args && ... args) {
+      size_t t = tail.data.load(std::memory_order_relaxed);
+      if (t - cached_head.data == capacity()) {
+        cached_head.data = head.data.load(std::memory_order_acquire);
+        if (t - cached_head.data == capacity()) return false;
+      }
+      new (slots[t & mask].get()) T(std::forward<Args>(args)...);
+      tail.data.store(t + 1, std::memory_order_release);
+      return true;
+    }
+
+    bool push(const T & value) { return emplace(value); }
+    bool push(T && value) { return emplace(std::move(value)); }
+
+    // producer only. moves up to n items out of first, returns how many made it
+    template <typename It> size_t push_n(It first, size_t n) {
+      size_t t = tail.data.load(std::memory_order_relaxed);
+      size_t room = capacity() - (t - cached_head.data);
+      if (room < n) {
+        cached_head.data = head.data.load(std::memory_order_acquire);
+        room = capacity() - (t - cached_head.data);
+      }
+      if (n > room) n = room;
+      for (size_t i = 0; i < n; ++i, ++first) new (slots[(t + i) & mask].get()) T(std::move(*first));
+      tail.data.store(t + n, std::memory_order_release);
+      return n;
+    }
+
+    // consumer only
+    bool pop(T & result) {
+      size_t h = head.data.load(std::memory_order_relaxed);
+      if (h == cached_tail.data) {
+        cached_tail.data = tail.data.load(std::memory_order_acquire);
+        if (h == cached_tail.data) return false;
+      }
+      T * p = slots[h & mask].get();
+      result = std::move(*p);
+      p->~T();
+      head.data.store(h + 1, std::memory_order_release);
+      return true;
+    }
+
+    // consumer only. moves up to n items into out, returns how many
+    template <typename It> size_t pop_n(It out, size_t n) {
+      size_t h = head.data.load(std::memory_order_relaxed);
+      size_t ready = cached_tail.data - h;
+      if (ready < n) {
+        cached_tail.data = tail.data.load(std::memory_order_acquire);
+        ready = cached_tail.data - h;
+      }
+      if (n > ready) n = ready;
+      for (size_t i = 0; i < n; ++i, ++out) {
+        T * p = slots[(h + i) & mask].get();
+        *out = std::move(*p);
+        p->~T();
+      }
+      head.data.store(h + n, std::memory_order_release);
+      return n;
+    }
+
+    // only a hint unless both sides are quiet
+    size_t size() const noexcept { return tail.data.load(std::memory_order_acquire) - head.data.load(std::memory_order_acquire); }
+    bool empty() const noexcept { return size() == 0; }
+
+  private:
+    const size_t mask;
+    std::unique_ptr<detail::ring_storage<T>[]> slots;
+    cache_isolated<std::atomic<size_t>> head{ 0 }; // written by the consumer
+    cache_isolated<size_t> cached_tail{ 0 }; // consumer's copy
+    cache_isolated<std::atomic<size_t>> tail{ 0 }; // written by the producer
+    cache_isolated<size_t> cached_head{ 0 }; // producer's copy
+  };
+
+  template <typename T> struct mpmc_ring : noncopyable {
+    explicit mpmc_ring(size_t capacity) : mask(detail::ring_capacity(capacity) - 1), slots(new detail::sequenced_slot<T>[mask + 1]) {
+      for (size_t i = 0; i <= mask; ++i) slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    ~mpmc_ring() { detail::destroy_filled(slots.get(), mask, head.data.load(std::memory_order_relaxed)); }
+
+    size_t capacity() const noexcept { return mask + 1; }
+
+    // any thread
+    template <typename ... Args> bool emplace(Args && ... args) {
+      size_t t = tail.data.load(std::memory_order_relaxed);
+      for (;;) {
+        detail::sequenced_slot<T> & s = slots[t & mask];
+        size_t seq = s.sequence.load(std::memory_order_acquire);
+        intptr_t d = intptr_t(seq) - intptr_t(t);
+        if (d == 0) {
+          if (tail.data.compare_exchange_weak(t, t + 1, std::memory_order_relaxed)) {
+            new (s.value.get()) T(std::forward<Args>(args)...);
+            s.sequence.store(t + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (d < 0) {
+          return false; // the consumers haven't gotten around to this one since last lap
+        } else {
+          t = tail.data.load(std::memory_order_relaxed); // somebody beat us to it
+        }
+      }
+    }
+
+    bool push(const T & value) { return emplace(value); }
+    bool push(T && value) { return emplace(std::move(value)); }
+
+    // any thread. claims as many slots as it can in one go
+    template <typename It> size_t push_n(It first, size_t n) {
+      size_t t;
+      size_t k = n == 0 ? 0 : detail::claim(tail.data, slots.get(), mask, 0, n, t);
+      for (size_t i = 0; i < k; ++i, ++first) {
+        detail::sequenced_slot<T> & s = slots[(t + i) & mask];
+        new (s.value.get()) T(std::move(*first));
+        s.sequence.store(t + i + 1, std::memory_order_release);
+      }
+      return k;
+    }
+
+    // any thread
+    bool pop(T & result) {
+      size_t h = head.data.load(std::memory_order_relaxed);
+      for (;;) {
+        detail::sequenced_slot<T> & s = slots[h & mask];
+        size_t seq = s.sequence.load(std::memory_order_acquire);
+        intptr_t d = intptr_t(seq) - intptr_t(h + 1);
+        if (d == 0) {
+          if (head.data.compare_exchange_weak(h, h + 1, std::memory_order_relaxed)) {
+            T * p = s.value.get();
+            result = std::move(*p);
+            p->~T();
+            s.sequence.store(h + mask + 1, std::memory_order_release); // free for the next lap's producer
+            return true;
+          }
+        } else if (d < 0) {
+          return false; // nobody has filled this one in yet
+        } else {
+          h = head.data.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    // any thread. claims as many slots as it can in one go
+    template <typename It> size_t pop_n(It out, size_t n) {
+      size_t h;
+      size_t k = n == 0 ? 0 : detail::claim(head.data, slots.get(), mask, 1, n, h);
+      for (size_t i = 0; i < k; ++i, ++out) {
+        detail::sequenced_slot<T> & s = slots[(h + i) & mask];
+        T * p = s.value.get();
+        *out = std::move(*p);
+        p->~T();
+        s.sequence.store(h + i + mask + 1, std::memory_order_release);
+      }
+      return k;
+    }
+
+    size_t size() const noexcept {
+      size_t t = tail.data.load(std::memory_order_acquire), h = head.data.load(std::memory_order_acquire);
+      return t > h ? t - h : 0;
+    }
+    bool empty() const noexcept { return size() == 0; }
+
+  private:
+    const size_t mask;
+    std::unique_ptr<detail::sequenced_slot<T>[]> slots;
+    cache_isolated<std::atomic<size_t>> tail{ 0 }; // next slot to claim for a push
+    cache_isolated<std::atomic<size_t>> head{ 0 }; // next slot to claim for a pop
+  };
+
+  // the consumer owns its index outright, so pops are plain loads and stores, and a batch pop is one pass
+  template <typename T> struct mpsc_ring : noncopyable {
+    explicit mpsc_ring(size_t capacity) : mask(detail::ring_capacity(capacity) - 1), slots(new detail::sequenced_slot<T>[mask + 1]) {
+      for (size_t i = 0; i <= mask; ++i) slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    ~mpsc_ring() { detail::destroy_filled(slots.get(), mask, head.data.load(std::memory_order_relaxed)); }
+
+    size_t capacity() const noexcept { return mask + 1; }
+
+    // any thread
+    template <typename ... Args> bool emplace(Args && ... args) {
+      size_t t = tail.data.load(std::memory_order_relaxed);
+      for (;;) {
+        detail::sequenced_slot<T> & s = slots[t & mask];
+        intptr_t d = intptr_t(s.sequence.load(std::memory_order_acquire)) - intptr_t(t);
+        if (d == 0) {
+          if (tail.data.compare_exchange_weak(t, t + 1, std::memory_order_relaxed)) {
+            new (s.value.get()) T(std::forward<Args>(args)...);
+            s.sequence.store(t + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (d < 0) {
+          return false;
+        } else {
+          t = tail.data.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    bool push(const T & value) { return emplace(value); }
+    bool push(T && value) { return emplace(std::move(value)); }
+
+    // any thread. claims as many slots as it can in one go
+    template <typename It> size_t push_n(It first, size_t n) {
+      size_t t;
+      size_t k = n == 0 ? 0 : detail::claim(tail.data, slots.get(), mask, 0, n, t);
+      for (size_t i = 0; i < k; ++i, ++first) {
+        detail::sequenced_slot<T> & s = slots[(t + i) & mask];
+        new (s.value.get()) T(std::move(*first));
+        s.sequence.store(t + i + 1, std::memory_order_release);
+      }
+      return k;
+    }
+
+    // consumer only
+    bool pop(T & result) {
+      size_t h = head.data.load(std::memory_order_relaxed);
+      detail::sequenced_slot<T> & s = slots[h & mask];
+      if (s.sequence.load(std::memory_order_acquire) != h + 1) return false;
+      T * p = s.value.get();
+      result = std::move(*p);
+      p->~T();
+      s.sequence.store(h + mask + 1, std::memory_order_release);
+      head.data.store(h + 1, std::memory_order_relaxed);
+      return true;
+    }
+
+    // consumer only
+    template <typename It> size_t pop_n(It out, size_t n) {
+      size_t h = head.data.load(std::memory_order_relaxed);
+      size_t i = 0;
+      for (; i < n; ++i, ++out) {
+        detail::sequenced_slot<T> & s = slots[(h + i) & mask];
+        if (s.sequence.load(std::memory_order_acquire) != h + i + 1) break;
+        T * p = s.value.get();
+        *out = std::move(*p);
+        p->~T();
+        s.sequence.store(h + i + mask + 1, std::memory_order_release);
+      }
+      head.data.store(h + i, std::memory_order_relaxed);
+      return i;
+    }
+
+    // only a hint
+    size_t size() const noexcept {
+      size_t t = tail.data.load(std::memory_order_acquire), h = head.data.load(std::memory_order_relaxed);
+      return t > h ? t - h : 0;
+    }
+    bool empty() const noexcept { return size() == 0; }
+
+  private:
+    const size_t mask;
+    std::unique_ptr<detail::sequenced_slot<T>[]> slots;
+    cache_isolated<std::atomic<size_t>> tail{ 0 };
+    cache_isolated<std::atomic<size_t>> head{ 0 }; // only ever written by the consumer
+  };
+}
@@ -22,7 +22,7 @@ namespace framework {
     float w = 2 * uv.x - 1;
     float cosTheta = sign(w) * sqrt(abs(w));
     float sinTheta = cos2sin(cosTheta);
-    if (pdf) *pdf = abs(cosTheta) * float(M_2_PI);
+    if (pdf) *pdf = abs(cosTheta) * float(0.5 * M_1_PI); // |cos theta| / 2pi
     return vec3(
       cos(phi) * sinTheta,
       sin(phi) * sinTheta,
@@ -51,8 +51,9 @@ namespace framework {
   vec3 sample_hemisphere_cos(vec2 uv, float * pdf) noexcept {
     polar p = sample_polar(uv);
     vec2 xy = p.to_disc();
-    if (pdf) *pdf = sin2cos(uv.x) * float(M_1_PI); // cos theta / pi
-    return vec3(xy, sin2cos(p.r));
+    float cosTheta = sin2cos(p.r);
+    if (pdf) *pdf = cosTheta * float(M_1_PI);
+    return vec3(xy, cosTheta);
   }
 
   // Archimedes' hat box
@@ -74,7 +75,7 @@ namespace framework {
     float phi = uv.y * tau;
     float cosTheta = pow(uv.x, rcp(exponent + 1));
     float sinTheta = cos2sin(cosTheta);
-    if (pdf) *pdf = pow(cosTheta, exponent) * (exponent + 1) * float(0.5 * M_PI);
+    if (pdf) *pdf = pow(cosTheta, exponent) * (exponent + 1) * float(0.5 * M_1_PI);
     return vec3(cos(phi) * sinTheta, sin(phi) * sinTheta, cosTheta);
   }
 
@@ -330,6 +331,15 @@ namespace framework {
             point(seq.next());
         });
       }
+      if (gui::CollapsingHeader("Sobol, Owen scrambled")) {
+        static int seed = 0;
+        gui::SliderInt("seed", &seed, 0, 100);
+        panel([&](auto point) {
+          sobol_sequence seq(uint64_t(seed));
+          for (int i = 0;i < N;++i)
+            point(seq.get<3>(uint64_t(i)));
+        });
+      }
       if (gui::CollapsingHeader("Hammersley 2D")) {
         if (e == 5) {
           gui::Text("only 2D");
@@ -3,6 +3,7 @@
 #include "math.h"
 #include "sampling_sobol.h"
 #include "sampling_hammersley.h"
+#include "sampling_batch.h"
 
 namespace framework {
   // Sample uniformly from the surface of a sphere using 
@@ -0,0 +1,166 @@
+#include "stdafx.h"
+#include "math.h"
+#include "sampling.h"
+#include "simd.h"
+
+using namespace framework::simd;
+
+namespace framework {
+
+  // run kernel over [0,n) as wide as we were compiled for, then a lane at a time for whatever is left
+  template <typename K> static inline void batch(size_t n, K kernel) noexcept {
+    size_t i = 0;
+    for (; i + f32xn::width <= n; i += f32xn::width) kernel(f32xn(), i);
+    for (; i < n; ++i) kernel(f32x1(), i);
+  }
+
+  // sample_polar, without the branches
+  template <typename F> static inline void polar_lanes(F u, F v, F & r, F & phi) noexcept {
+    F a = F(2.f) * u - F(1.f);
+    F b = F(2.f) * v - F(1.f);
+    auto upper = a > -b;                                       // regions 1 and 2
+    auto wide = (upper & (a > b)) | ((!upper) & (a < b));      // regions 1 and 3, where |a| >= |b|
+    F num = select(wide, b, -a);
+    F den = select(wide, a, b);
+    F t = select(den == F(0.f), F(0.f), num / den);            // a == b == 0 lands in region 4 with r = 0
+    F offset = select(upper, select(wide, F(0.f), F(2.f)), select(wide, F(4.f), F(6.f)));
+    r = select(upper, F(1.f), F(-1.f)) * den;
+    phi = F(pi_4) * (offset + t);
+  }
+
+  void sample_sphere(size_t n, const float * u, const float * v, float * x, float * y, float * z, float * pdf) noexcept {
+    batch(n, [=](auto lane, size_t i) {
+      typedef decltype(lane) F;
+      F cosTheta = F(1.f) - F(2.f) * F::load(u + i);
+      F sinTheta = safe_sqrt(F(1.f) - cosTheta * cosTheta);
+      F s, c;
+      sincos(F::load(v + i) * F(tau), s, c);
+      (c * sinTheta).store(x + i);
+      (s * sinTheta).store(y + i);
+      cosTheta.store(z + i);
+      if (pdf) F(sample_sphere_pdf).store(pdf + i);
+    });
+  }
+
+  void sample_sphere_cos(size_t n, const float * u, const float * v, float * x, float * y, float * z, float * pdf) noexcept {
+    batch(n, [=](auto lane, size_t i) {
+      typedef decltype(lane) F;
+      F w = F(2.f) * F::load(u + i) - F(1.f);
+      F cosTheta = select(w < F(0.f), F(-1.f), F(1.f)) * sqrt(abs(w));
+      F sinTheta = safe_sqrt(F(1.f) - cosTheta * cosTheta);
+      F s, c;
+      sincos(F::load(v + i) * F(tau), s, c);
+      (c * sinTheta).store(x + i);
+      (s * sinTheta).store(y + i);
+      cosTheta.store(z + i);
+      if (pdf) (abs(cosTheta) * F(float(0.5 * M_1_PI))).store(pdf + i);
+    });
+  }
+
+  void sample_hemisphere(size_t n, const float * u, const float * v, float * x, float * y, float * z, float * pdf) noexcept {
+    batch(n, [=](auto lane, size_t i) {
+      typedef decltype(lane) F;
+      F r, phi, s, c;
+      polar_lanes(F::load(u + i), F::load(v + i), r, phi);
+      sincos(phi, s, c);
+      F h = F(1.f) - r * r;
+      F d = r * sqrt(F(1.f) + h);
+      (c * d).store(x + i);
+      (s * d).store(y + i);
+      h.store(z + i);
+      if (pdf) F(sample_hemisphere_pdf).store(pdf + i);
+    });
+  }
+
+  void sample_hemisphere_cos(size_t n, const float * u, const float * v, float * x, float * y, float * z, float * pdf) noexcept {
+    batch(n, [=](auto lane, size_t i) {
+      typedef decltype(lane) F;
+      F r, phi, s, c;
+      polar_lanes(F::load(u + i), F::load(v + i), r, phi);
+      sincos(phi, s, c);
+      F h = safe_sqrt(F(1.f) - r * r);
+      (r * c).store(x + i);
+      (r * s).store(y + i);
+      h.store(z + i);
+      if (pdf) (h * F(float(M_1_PI))).store(pdf + i);
+    });
+  }
+
+  void sample_cone(size_t n, const float * u, const float * v, float cosThetaMax, float * x, float * y, float * z, float * pdf) noexcept {
+    float cone_pdf = sample_cone_pdf(cosThetaMax);
+    batch(n, [=](auto lane, size_t i) {
+      typedef decltype(lane) F;
+      F t = F::load(u + i);
+      F cosTheta = (F(1.f) - t) + t * F(cosThetaMax);
+      F sinTheta = safe_sqrt(F(1.f) - cosTheta * cosTheta);
+      F s, c;
+      sincos(F::load(v + i) * F(tau), s, c);
+      (c * sinTheta).store(x + i);
+      (s * sinTheta).store(y + i);
+      cosTheta.store(z + i);
+      if (pdf) F(cone_pdf).store(pdf + i);
+    });
+  }
+
+  void sample_annulus(size_t n, const float * u, const float * v, float r_min, float r_max, float * x, float * y) noexcept {
+    float r_min2 = r_min * r_min, r_max2 = r_max * r_max;
+    batch(n, [=](auto lane, size_t i) {
+      typedef decltype(lane) F;
+      F r = sqrt(F(r_min2) + F::load(u + i) * F(r_max2 - r_min2));
+      F s, c;
+      sincos(F::load(v + i) * F(tau), s, c);
+      (r * c).store(x + i);
+      (r * s).store(y + i);
+    });
+  }
+
+  void sample_disc(size_t n, const float * u, const float * v, float * x, float * y) noexcept {
+    batch(n, [=](auto lane, size_t i) {
+      typedef decltype(lane) F;
+      F r, phi, s, c;
+      polar_lanes(F::load(u + i), F::load(v + i), r, phi);
+      sincos(phi, s, c);
+      (r * c).store(x + i);
+      (r * s).store(y + i);
+    });
+  }
+
+  void sample_ggx(size_t n, float roughness, vec3 N, mat3 TtoW, vec3 V, const float * u, const float * v, float * x, float * y, float * z, float * pdf) noexcept {
+    float r2 = roughness * roughness;
+    batch(n, [=](auto lane, size_t i) {
+      typedef decltype(lane) F;
+      // theta = atan2(roughness * sqrt(u), sqrt(1 - u)), but we only ever want its sine and cosine
+      F t = F::load(u + i);
+      F a = F(roughness) * sqrt(t);
+      F b = safe_sqrt(F(1.f) - t);
+      F l = sqrt(a * a + b * b);
+      auto degenerate = l == F(0.f);
+      F sinTheta = select(degenerate, F(0.f), a / l);
+      F cosTheta = select(degenerate, F(1.f), b / l);
+      F s, c;
+      sincos(F::load(v + i) * F(tau), s, c);
+      F hx = sinTheta * c, hy = sinTheta * s;
+
+      // H = TtoW * h
+      F Hx = F(TtoW[0].x) * hx + F(TtoW[1].x) * hy + F(TtoW[2].x) * cosTheta;
+      F Hy = F(TtoW[0].y) * hx + F(TtoW[1].y) * hy + F(TtoW[2].y) * cosTheta;
+      F Hz = F(TtoW[0].z) * hx + F(TtoW[1].z) * hy + F(TtoW[2].z) * cosTheta;
+
+      F HdV = Hx * F(V.x) + Hy * F(V.y) + Hz * F(V.z);
+      if (pdf) {
+        F NdH = simd::clamp(Hx * F(N.x) + Hy * F(N.y) + Hz * F(N.z), F(0.f), F(1.f));
+        F q = NdH * NdH * F(r2 - 1) + F(1.f);
+        F d = F(r2) / (F(pi) * q * q);
+        (d * NdH / (F(4.f) * simd::clamp(HdV, F(0.f), F(1.f)))).store(pdf + i);
+      }
+
+      // normalize(2 |H.V| H - V)
+      F k = F(2.f) * abs(HdV);
+      F Lx = k * Hx - F(V.x), Ly = k * Hy - F(V.y), Lz = k * Hz - F(V.z);
+      F inv = F(1.f) / sqrt(Lx * Lx + Ly * Ly + Lz * Lz);
+      (Lx * inv).store(x + i);
+      (Ly * inv).store(y + i);
+      (Lz * inv).store(z + i);
+    });
+  }
+}
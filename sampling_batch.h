@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include "glm.h"
+
+// Batched versions of the warps in sampling.h, for bakers that draw thousands of samples at a time.
+//
+// Each takes n samples in structure of arrays form, u[i] and v[i] in [0,1), and writes the i-th direction to
+// x[i], y[i], z[i] and, if pdf is not null, its density with respect to solid angle to pdf[i]. The discs write
+// points to x[i], y[i], and are uniform, see sample_disc_pdf and sample_annulus_pdf. Outputs may alias the inputs.
+//
+// They run as many lanes wide as the translation unit was compiled for, see simd.h, and agree with the scalar
+// versions to within a few ulps.
+namespace framework {
+  void sample_sphere(size_t n, const float * u, const float * v, float * x, float * y, float * z, float * pdf = nullptr) noexcept;
+  void sample_sphere_cos(size_t n, const float * u, const float * v, float * x, float * y, float * z, float * pdf = nullptr) noexcept;
+  void sample_hemisphere(size_t n, const float * u, const float * v, float * x, float * y, float * z, float * pdf = nullptr) noexcept;
+  void sample_hemisphere_cos(size_t n, const float * u, const float * v, float * x, float * y, float * z, float * pdf = nullptr) noexcept;
+  void sample_cone(size_t n, const float * u, const float * v, float cosThetaMax, float * x, float * y, float * z, float * pdf = nullptr) noexcept;
+  void sample_annulus(size_t n, const float * u, const float * v, float r_min, float r_max, float * x, float * y) noexcept;
+  void sample_disc(size_t n, const float * u, const float * v, float * x, float * y) noexcept;
+
+  // world space directions reflected about a GGX distributed half vector, as the scalar sample_ggx
+  void sample_ggx(size_t n, float roughness, vec3 N, mat3 TtoW, vec3 V, const float * u, const float * v, float * x, float * y, float * z, float * pdf = nullptr) noexcept;
+}
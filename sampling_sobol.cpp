@@ -1,11 +1,14 @@
 #include "stdafx.h"
+#include <algorithm>
 #include "sampling_sobol.h"
+#include "simd.h"
+
+using namespace framework::simd;
 
 namespace framework {
   namespace detail {
-    // Data on the primitive binary polynomials (a) and the corresponding
-    // starting values m, for Sobol sequences in up to 1111 dimensions,
-    // taken from:
+    // Direction numbers for Sobol sequences in up to 1111 dimensions, from the primitive polynomials and starting
+    // values m given in:
     //
     // P. Bratley and B. L. Fox, Algorithm 659, ACM Trans.
     // Math. Soft. 14 (1), 88-100 (1988),
@@ -13,868 +16,6749 @@ namespace framework {
     // as modified by:
     //
     // S. Joe and F. Y. Kuo, ACM Trans. Math. Soft 29 (1), 49-57 (2003).
-
-    // Successive primitive binary-coefficient polynomials 
     //
-    //  p(z) = a_0 + a_1 z + a_2 z^2 + ... a_31 z^31
-    //
-    // where a_i is the i-th bit of sobol_a[j] for the j-th polynomial. 
-    const uint32_t sobol_a[1110] = {
-      3, 7, 11, 13, 19, 25, 37, 59, 47, 61, 55, 41, 67, 97, 91,
-      109, 103, 115, 131, 193, 137, 145, 143, 241, 157, 185, 167, 229, 171, 213,
-      191, 253, 203, 211, 239, 247, 285, 369, 299, 301, 333, 351, 355, 357, 361,
-      391, 397, 425, 451, 463, 487, 501, 529, 539, 545, 557, 563, 601, 607, 617,
-      623, 631, 637, 647, 661, 675, 677, 687, 695, 701, 719, 721, 731, 757, 761,
-      787, 789, 799, 803, 817, 827, 847, 859, 865, 875, 877, 883, 895, 901, 911,
-      949, 953, 967, 971, 973, 981, 985, 995, 1001, 1019, 1033, 1051, 1063,
-      1069, 1125, 1135, 1153, 1163, 1221, 1239, 1255, 1267, 1279, 1293, 1305,
-      1315, 1329, 1341, 1347, 1367, 1387, 1413, 1423, 1431, 1441, 1479, 1509,
-      1527, 1531, 1555, 1557, 1573, 1591, 1603, 1615, 1627, 1657, 1663, 1673,
-      1717, 1729, 1747, 1759, 1789, 1815, 1821, 1825, 1849, 1863, 1869, 1877,
-      1881, 1891, 1917, 1933, 1939, 1969, 2011, 2035, 2041, 2053, 2071, 2091,
-      2093, 2119, 2147, 2149, 2161, 2171, 2189, 2197, 2207, 2217, 2225, 2255,
-      2257, 2273, 2279, 2283, 2293, 2317, 2323, 2341, 2345, 2363, 2365, 2373,
-      2377, 2385, 2395, 2419, 2421, 2431, 2435, 2447, 2475, 2477, 2489, 2503,
-      2521, 2533, 2551, 2561, 2567, 2579, 2581, 2601, 2633, 2657, 2669,
-      2681, 2687, 2693, 2705, 2717, 2727, 2731, 2739,
-      2741, 2773, 2783, 2793, 2799, 2801, 2811, 2819, 2825, 2833, 2867, 2879,
-      2881, 2891, 2905, 2911, 2917, 2927, 2941, 2951, 2955, 2963, 2965, 2991,
-      2999, 3005, 3017, 3035, 3037, 3047, 3053, 3083, 3085, 3097, 3103, 3159,
-      3169, 3179, 3187, 3205, 3209, 3223, 3227, 3229, 3251, 3263, 3271, 3277,
-      3283, 3285, 3299, 3305, 3319, 3331, 3343, 3357, 3367, 3373, 3393, 3399,
-      3413, 3417, 3427, 3439, 3441, 3475, 3487, 3497, 3515, 3517, 3529, 3543,
-      3547, 3553, 3559, 3573, 3589, 3613, 3617, 3623, 3627, 3635, 3641, 3655,
-      3659, 3669, 3679, 3697, 3707, 3709, 3713, 3731, 3743, 3747, 3771, 3791,
-      3805, 3827, 3833, 3851, 3865, 3889, 3895, 3933, 3947, 3949, 3957, 3971,
-      3985, 3991, 3995, 4007, 4013, 4021, 4045, 4051, 4069, 4073, 4179, 4201,
-      4219, 4221, 4249, 4305, 4331, 4359, 4383, 4387, 4411, 4431, 4439, 4449,
-      4459, 4485, 4531, 4569, 4575, 4621, 4663, 4669, 4711, 4723, 4735, 4793,
-      4801, 4811, 4879, 4893, 4897, 4921, 4927, 4941, 4977, 5017, 5027, 5033,
-      5127, 5169, 5175, 5199, 5213, 5223, 5237, 5287, 5293, 5331, 5391, 5405,
-      5453, 5523, 5573, 5591, 5597, 5611, 5641, 5703, 5717, 5721, 5797, 5821,
-      5909, 5913,
-      5955, 5957, 6005, 6025, 6061, 6067, 6079, 6081,
-      6231, 6237, 6289, 6295, 6329, 6383, 6427, 6453, 6465, 6501, 6523, 6539,
-      6577, 6589, 6601, 6607, 6631, 6683, 6699, 6707, 6761, 6795, 6865, 6881,
-      6901, 6923, 6931, 6943, 6999, 7057, 7079, 7103, 7105, 7123, 7173, 7185,
-      7191, 7207, 7245, 7303, 7327, 7333, 7355, 7365, 7369, 7375, 7411, 7431,
-      7459, 7491, 7505, 7515, 7541, 7557, 7561, 7701, 7705, 7727, 7749, 7761,
-      7783, 7795, 7823, 7907, 7953, 7963, 7975, 8049, 8089, 8123, 8125, 8137,
-      8219, 8231, 8245, 8275, 8293, 8303, 8331, 8333, 8351, 8357, 8367, 8379,
-      8381, 8387, 8393, 8417, 8435, 8461, 8469, 8489, 8495, 8507, 8515, 8551,
-      8555, 8569, 8585, 8599, 8605, 8639, 8641, 8647, 8653, 8671, 8675, 8689,
-      8699, 8729, 8741, 8759, 8765, 8771, 8795, 8797, 8825, 8831, 8841, 8855,
-      8859, 8883, 8895, 8909, 8943, 8951, 8955, 8965, 8999, 9003, 9031, 9045,
-      9049, 9071, 9073, 9085, 9095, 9101, 9109, 9123, 9129, 9137, 9143, 9147,
-      9185, 9197, 9209, 9227, 9235, 9247, 9253, 9257, 9277, 9297, 9303, 9313,
-      9325, 9343, 9347, 9371, 9373, 9397, 9407, 9409, 9415, 9419, 9443, 9481,
-      9495, 9501, 9505, 9517, 9529, 9555, 9557, 9571, 9585, 9591, 9607, 9611,
-      9621, 9625,
-      9631, 9647, 9661, 9669, 9679, 9687, 9707, 9731,
-      9733, 9745, 9773, 9791, 9803, 9811, 9817, 9833, 9847, 9851, 9863, 9875,
-      9881, 9905, 9911, 9917, 9923, 9963, 9973, 10003, 10025, 10043, 10063,
-      10071, 10077, 10091, 10099, 10105, 10115, 10129, 10145, 10169, 10183,
-      10187, 10207, 10223, 10225, 10247, 10265, 10271, 10275, 10289, 10299,
-      10301, 10309, 10343, 10357, 10373, 10411, 10413, 10431, 10445, 10453,
-      10463, 10467, 10473, 10491, 10505, 10511, 10513, 10523, 10539, 10549,
-      10559, 10561, 10571, 10581, 10615, 10621, 10625, 10643, 10655, 10671,
-      10679, 10685, 10691, 10711, 10739, 10741, 10755, 10767, 10781, 10785,
-      10803, 10805, 10829, 10857, 10863, 10865, 10875, 10877, 10917, 10921,
-      10929, 10949, 10967, 10971, 10987, 10995, 11009, 11029, 11043, 11045,
-      11055, 11063, 11075, 11081, 11117, 11135, 11141, 11159, 11163, 11181,
-      11187, 11225, 11237, 11261, 11279, 11297, 11307, 11309, 11327, 11329,
-      11341, 11377, 11403, 11405, 11413, 11427, 11439, 11453, 11461, 11473,
-      11479, 11489, 11495, 11499, 11533, 11545, 11561, 11567, 11575, 11579,
-      11589, 11611, 11623, 11637, 11657, 11663, 11687, 11691, 11701, 11747,
-      11761, 11773, 11783, 11795, 11797, 11817, 11849, 11855, 11867, 11869,
-      11873, 11883, 11919,
-      11921, 11927, 11933, 11947, 11955, 11961,
-      11999, 12027, 12029, 12037, 12041, 12049, 12055, 12095, 12097, 12107,
-      12109, 12121, 12127, 12133, 12137, 12181, 12197, 12207, 12209, 12239,
-      12253, 12263, 12269, 12277, 12287, 12295, 12309, 12313, 12335, 12361,
-      12367, 12391, 12409, 12415, 12433, 12449, 12469, 12479, 12481, 12499,
-      12505, 12517, 12527, 12549, 12559, 12597, 12615, 12621, 12639, 12643,
-      12657, 12667, 12707, 12713, 12727, 12741, 12745, 12763, 12769, 12779,
-      12781, 12787, 12799, 12809, 12815, 12829, 12839, 12857, 12875, 12883,
-      12889, 12901, 12929, 12947, 12953, 12959, 12969, 12983, 12987, 12995,
-      13015, 13019, 13031, 13063, 13077, 13103, 13137, 13149, 13173, 13207,
-      13211, 13227, 13241, 13249, 13255, 13269, 13283, 13285, 13303, 13307,
-      13321, 13339, 13351, 13377, 13389, 13407, 13417, 13431, 13435, 13447,
-      13459, 13465, 13477, 13501, 13513, 13531, 13543, 13561, 13581, 13599,
-      13605, 13617, 13623, 13637, 13647, 13661, 13677, 13683, 13695, 13725,
-      13729, 13753, 13773, 13781, 13785, 13795, 13801, 13807, 13825, 13835,
-      13855, 13861, 13871, 13883, 13897, 13905, 13915, 13939, 13941, 13969,
-      13979, 13981, 13997, 14027, 14035, 14037, 14051, 14063, 14085, 14095,
-      14107, 14113, 14125, 14137, 14145,
-      14151, 14163, 14193, 14199, 14219, 14229,
-      14233, 14243, 14277, 14287, 14289, 14295, 14301, 14305, 14323, 14339,
-      14341, 14359, 14365, 14375, 14387, 14411, 14425, 14441, 14449, 14499,
-      14513, 14523, 14537, 14543, 14561, 14579, 14585, 14593, 14599, 14603,
-      14611, 14641, 14671, 14695, 14701, 14723, 14725, 14743, 14753, 14759,
-      14765, 14795, 14797, 14803, 14831, 14839, 14845, 14855, 14889, 14895,
-      14909, 14929, 14941, 14945, 14951, 14963, 14965, 14985, 15033, 15039,
-      15053, 15059, 15061, 15071, 15077, 15081, 15099, 15121, 15147, 15149,
-      15157, 15167, 15187, 15193, 15203, 15205, 15215, 15217, 15223, 15243,
-      15257, 15269, 15273, 15287, 15291, 15313, 15335, 15347, 15359, 15373,
-      15379, 15381, 15391, 15395, 15397, 15419, 15439, 15453, 15469, 15491,
-      15503, 15517, 15527, 15531, 15545, 15559, 15593, 15611, 15613, 15619,
-      15639, 15643, 15649, 15661, 15667, 15669, 15681, 15693, 15717, 15721,
-      15741, 15745, 15765, 15793, 15799, 15811, 15825, 15835, 15847, 15851,
-      15865, 15877, 15881, 15887, 15899, 15915, 15935, 15937, 15955, 15973,
-      15977, 16011, 16035, 16061, 16069, 16087, 16093, 16097, 16121, 16141,
-      16153, 16159, 16165, 16183, 16189, 16195, 16197, 16201, 16209, 16215,
-      16225, 16259, 16265, 16273, 16299,
-      16309, 16355, 16375, 16381
-    };
-
-    // starting direction #'s m[i] = sobol_minit[i][j] for i=0..d of the
-    // degree - d primitive polynomial sobol_a[j].
-
-    const uint32_t sobol_minit[13][1110] = {
-      {
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
-      },
-      { 0,
-      1, 3, 1, 3, 1, 3, 3, 1, 3, 1, 3, 1, 3, 1, 1, 3, 1, 3, 1, 3,
-      1, 3, 3, 1, 1, 1, 3, 1, 3, 1, 3, 3, 1, 3, 1, 1, 1, 3, 1, 3, 1, 1, 1, 3, 3, 1, 3, 3, 1, 1,
-      3, 3, 1, 3, 3, 3, 1, 3, 1, 3, 1, 1, 3, 3, 1, 1, 1, 1, 3, 1, 1, 3, 1, 1, 1, 3, 3, 1, 3, 3,
-      1, 3, 3, 3, 1, 3, 3, 3, 1, 3, 3, 1, 3, 3, 3, 1, 3, 1, 3, 1, 1, 3, 3, 1, 3, 3, 1, 1, 1, 3,
-      3, 1, 3, 3, 1, 3, 1, 1, 3, 3, 3, 1, 1, 1, 3, 1, 1, 3, 1, 1, 3, 3, 1, 3, 1, 3, 3, 3, 3, 1,
-      1, 1, 3, 3, 1, 1, 3, 1, 1, 1, 1, 1, 1, 3, 1, 3, 1, 1, 1, 3, 1, 3, 1, 3, 3, 3, 1, 1, 3, 3,
-      1, 3, 1, 3, 1, 1, 3, 1, 3, 1, 3, 1, 3, 1, 1, 1, 3, 3, 1, 3, 3, 1, 3, 1, 1, 1, 3, 1, 3, 1,
-      1, 3, 1, 1, 3, 3, 1, 1, 3, 3, 3, 1, 3, 3, 3, 1, 3, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1,
-      1, 1, 3, 3, 3, 1, 1, 1, 1, 3, 3, 3, 1, 3, 3, 1, 1, 1, 1, 3, 1, 1, 3, 1, 3, 3, 1, 1, 3, 3,
-      1, 1, 1, 1, 3, 1, 3, 3, 1, 3, 3, 1, 1, 1, 3, 3, 3, 1, 3, 3, 1, 3, 3, 1, 3, 1, 3, 3, 3, 1,
-      3, 1, 1, 3, 1, 3, 1, 1, 1, 3, 3, 3, 1, 1, 3, 1, 3, 1, 1, 1, 1, 1, 1, 3, 1, 1, 3, 1, 3, 3,
-      1, 1, 1, 1, 3, 1, 3, 1, 3, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 3, 3, 3, 1, 1, 3, 3, 3, 3, 3,
-      1, 3, 3, 1, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 3, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 3, 3, 1, 3,
-      1, 1, 3, 3, 3, 1, 3, 3, 1, 3, 1, 3, 3, 1, 3, 3, 3, 1, 1,
-      3, 3, 1, 3, 1, 3, 1, 1, 1, 3, 3, 3, 3, 1, 3, 1, 1, 3, 1,
-      3, 1, 1, 1, 3, 1, 3, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 1, 3, 3, 3, 3, 3, 1, 3, 1, 3, 3, 3,
-      1, 3, 1, 3, 1, 3, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 3, 3, 1, 1, 3, 3, 1,
-      1, 1, 3, 3, 1, 1, 3, 3, 3, 3, 1, 1, 3, 1, 3, 3, 1, 3, 3, 1, 1, 1, 3, 3, 3, 1, 1, 3, 3, 3,
-      3, 3, 1, 1, 1, 3, 1, 3, 3, 1, 3, 3, 3, 3, 1, 1, 3, 1, 1, 3, 1, 3, 1, 3, 1, 3, 3, 1, 1, 3,
-      3, 1, 3, 3, 1, 3, 3, 1, 1, 3, 1, 3, 3, 1, 1, 3, 1, 3, 1, 3, 1, 1, 3, 3, 1, 1, 1, 3, 3, 1,
-      3, 1, 1, 3, 3, 1, 1, 3, 1, 3, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 3, 1, 3, 1, 1, 3, 3, 1, 1, 3,
-      1, 3, 1, 3, 3, 3, 1, 3, 3, 3, 1, 1, 3, 3, 3, 1, 1, 1, 1, 3, 1, 3, 1, 3, 1, 1, 3, 3, 1, 1,
-      1, 3, 3, 1, 3, 1, 3, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 1, 3, 3, 3, 1, 3, 1, 1, 3, 3, 1, 1, 3,
-      3, 1, 1, 1, 3, 1, 3, 3, 1, 1, 3, 1, 1, 3, 1, 3, 1, 1, 1, 3, 3, 3, 3, 1, 1, 3, 3, 1, 1, 1,
-      1, 3, 1, 1, 3, 3, 3, 1, 1, 3, 3, 1, 3, 3, 1, 1, 3, 3, 3, 3, 3, 3, 3, 1, 3, 3, 1, 3, 1, 3,
-      1, 1, 3, 3, 1, 1, 1, 3, 1, 3, 3, 1, 3, 3, 1, 3, 1, 1, 3, 3, 3, 1, 1, 1, 3, 1, 1, 1, 3, 3,
-      3, 1, 3, 3, 1, 3, 1, 1, 3, 3, 3, 1, 3, 3, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 1, 3, 3,
-      1, 3, 1, 1, 3, 3, 3, 1, 3, 3, 3, 3, 3, 1, 3, 3, 3, 1, 1, 1,
-      3, 3, 1, 3, 3, 1, 3, 1, 3, 1, 3, 1, 3, 3, 3, 3, 3, 3,
-      1, 1, 3, 1, 3, 1, 1, 1, 1, 1, 3, 1, 1, 1, 3, 1, 3, 1, 1, 3, 3, 3, 1, 3, 1, 3, 1, 1, 3, 1,
-      3, 3, 1, 3, 1, 3, 3, 1, 3, 3, 1, 3, 3, 3, 3, 3, 3, 1, 3, 1, 1, 3, 3, 3, 1, 1, 3, 3, 3, 3,
-      3, 3, 3, 1, 3, 3, 3, 3, 1, 3, 1, 3, 3, 3, 1, 3, 1, 3, 1, 1, 1, 3, 3, 1, 3, 1, 1, 3, 3, 1,
-      3, 1, 1, 1, 1, 3, 1, 3, 1, 1, 3, 1, 3, 1, 3, 3, 3, 3, 3, 3, 1, 3, 3, 3, 3, 1, 3, 3, 1, 3,
-      3, 3, 3, 3, 1, 1, 1, 1, 3, 3, 3, 1, 3, 3, 1, 1, 3, 3, 1, 1, 3, 3, 1, 3, 1, 1, 3, 1, 3, 3,
-      3, 3, 3, 1, 3, 1, 1, 3, 3, 3, 3, 1, 3, 1, 1, 3, 3, 3, 3, 3, 3, 1, 1, 3, 1, 3, 1, 1, 3, 1,
-      1, 1, 1, 3, 3, 1, 1, 3, 1, 1, 1, 3, 1, 3, 1, 1, 3, 3, 1, 3, 1, 1, 3, 3, 3, 3, 3, 1, 3, 1,
-      1, 1, 3, 1, 1, 1, 3, 1, 1, 3, 1, 3, 3, 3, 3, 3, 1, 1, 1, 3, 3, 3, 3, 1, 3, 3, 3, 3, 1, 1,
-      3, 3, 3, 1, 3, 1, 1, 3, 3, 1, 3, 3, 1, 1, 1, 1, 1, 3, 1, 1, 3, 3, 1, 1, 1, 3, 1, 1, 3, 3,
-      1, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 3, 3, 1, 1, 3, 1, 3, 3, 3, 3, 3, 1 },
-      { 0, 0,
-      7, 5, 1, 3, 3, 7, 5, 5, 7, 7, 1, 3, 3, 7, 5, 1, 1, 5, 3, 7,
-      1, 7, 5, 1, 3, 7, 7, 1, 1, 1, 5, 7, 7, 5, 1, 3, 3, 7, 5, 5, 5, 3, 3, 3, 1, 1, 5, 1, 1, 5,
-      3, 3, 3, 3, 1, 3, 7, 5, 7, 3, 7, 1, 3, 3, 5, 1, 3, 5, 5, 7, 7, 7, 1, 1, 3, 3, 1, 1, 5, 1,
-      5, 7, 5, 1, 7, 5, 3, 3, 1, 5, 7, 1, 7, 5, 1, 7, 3, 1, 7, 1, 7, 3, 3, 5, 7, 3, 3, 5, 1, 3,
-      3, 1, 3, 5, 1, 3, 3, 3, 7, 1, 1, 7, 3, 1, 3, 7, 5, 5, 7, 5, 5, 3, 1, 3, 3, 3, 1, 3, 3, 7,
-      3, 3, 1, 7, 5, 1, 7, 7, 5, 7, 5, 1, 3, 1, 7, 3, 7, 3, 5, 7, 3, 1, 3, 3, 3, 1, 5, 7, 3, 3,
-      7, 7, 7, 5, 3, 1, 7, 1, 3, 7, 5, 3, 3, 3, 7, 1, 1, 3, 1, 5, 7, 1, 3, 5, 3, 5, 3, 3, 7, 5,
-      5, 3, 3, 1, 3, 7, 7, 7, 1, 5, 7, 1, 3, 1, 1, 7, 1, 3, 1, 7, 1, 5, 3, 5, 3, 1, 1, 5, 5, 3,
-      3, 5, 7, 1, 5, 3, 7, 7, 3, 5, 3, 3, 1, 7, 3, 1, 3, 5, 7, 1, 3, 7, 1, 5, 1, 3, 1, 5, 3, 1,
-      7, 1, 5, 5, 5, 3, 7, 1, 1, 7, 3, 1, 1, 7, 5, 7, 5, 7, 7, 3, 7, 1, 3, 7, 7, 3, 5, 1, 1, 7,
-      1, 5, 5, 5, 1, 5, 1, 7, 5, 5, 7, 1, 1, 7, 1, 7, 7, 1, 1, 3, 3, 3, 7, 7, 5, 3, 7, 3, 1, 3,
-      7, 5, 3, 3, 5, 7, 1, 1, 5, 5, 7, 7, 1, 1, 1, 1, 5, 5, 5, 7, 5, 7, 1, 1, 3, 5, 1, 3, 3, 7,
-      3, 7, 5, 3, 5, 3, 1, 7, 1, 7, 7, 1, 1, 7, 7, 7, 5, 5, 1, 1, 7, 5, 5, 7, 5, 1, 1, 5, 5, 5,
-      5, 5, 5, 1, 3, 1, 5, 7, 3, 3, 5, 7, 3, 7, 1, 7, 7, 1, 3,
-      5, 1, 5, 5, 3, 7, 3, 7, 7, 5, 7, 5, 7, 1, 1, 5, 3, 5, 1,
-      5, 3, 7, 1, 5, 7, 7, 3, 5, 1, 3, 5, 1, 5, 3, 3, 3, 7, 3, 5, 1, 3, 7, 7, 3, 7, 5, 3, 3, 1,
-      7, 5, 1, 1, 3, 7, 1, 7, 1, 7, 3, 7, 3, 5, 7, 3, 5, 3, 1, 1, 1, 5, 7, 7, 3, 3, 1, 1, 1, 5,
-      5, 7, 3, 1, 1, 3, 3, 7, 3, 3, 5, 1, 3, 7, 3, 3, 7, 3, 5, 7, 5, 7, 7, 3, 3, 5, 1, 3, 5, 3,
-      1, 3, 5, 1, 1, 3, 7, 7, 1, 5, 1, 3, 7, 3, 7, 3, 5, 1, 7, 1, 1, 3, 5, 3, 7, 1, 5, 5, 1, 1,
-      3, 1, 3, 3, 7, 1, 7, 3, 1, 7, 3, 1, 7, 3, 5, 3, 5, 7, 3, 3, 3, 5, 1, 7, 7, 1, 3, 1, 3, 7,
-      7, 1, 3, 7, 3, 1, 5, 3, 1, 1, 1, 5, 3, 3, 7, 1, 5, 3, 5, 1, 3, 1, 3, 1, 5, 7, 7, 1, 1, 5,
-      3, 1, 5, 1, 1, 7, 7, 3, 5, 5, 1, 7, 1, 5, 1, 1, 3, 1, 5, 7, 5, 7, 7, 1, 5, 1, 1, 3, 5, 1,
-      5, 5, 3, 1, 3, 1, 5, 5, 3, 3, 3, 3, 1, 1, 3, 1, 3, 5, 5, 7, 5, 5, 7, 5, 7, 1, 3, 7, 7, 3,
-      5, 5, 7, 5, 5, 3, 3, 3, 1, 7, 1, 5, 5, 5, 3, 3, 5, 1, 3, 1, 3, 3, 3, 7, 1, 7, 7, 3, 7, 1,
-      1, 5, 7, 1, 7, 1, 7, 7, 1, 3, 7, 5, 1, 3, 5, 5, 5, 1, 1, 7, 1, 7, 1, 7, 7, 3, 1, 1, 5, 1,
-      5, 1, 5, 3, 5, 5, 5, 5, 5, 3, 3, 7, 3, 3, 5, 5, 3, 7, 1, 5, 7, 5, 1, 5, 5, 3, 5, 5, 7, 5,
-      3, 5, 5, 5, 1, 5, 5, 5, 5, 1, 3, 5, 3, 1, 7, 5, 5, 7, 1, 5, 3, 3, 1, 5, 3, 7, 1, 7, 5, 1,
-      1, 3, 1, 1, 7, 1, 5, 5, 3, 7, 3, 7, 5, 3, 1, 1, 3, 1, 3, 5,
-      5, 7, 5, 3, 7, 7, 7, 3, 7, 3, 7, 1, 3, 1, 7, 7, 1, 7,
-      3, 7, 3, 7, 3, 7, 3, 5, 1, 1, 7, 3, 1, 5, 5, 7, 1, 5, 5, 5, 7, 1, 5, 5, 1, 5, 5, 3, 1, 3,
-      1, 7, 3, 1, 3, 5, 7, 7, 7, 1, 1, 7, 3, 1, 5, 5, 5, 1, 1, 1, 1, 1, 5, 3, 5, 1, 3, 5, 3, 1,
-      1, 1, 1, 3, 7, 3, 7, 5, 7, 1, 5, 5, 7, 5, 3, 3, 7, 5, 3, 1, 1, 3, 1, 3, 1, 1, 3, 7, 1, 7,
-      1, 1, 5, 1, 7, 5, 3, 7, 3, 5, 3, 1, 1, 5, 5, 1, 7, 7, 3, 7, 3, 7, 1, 5, 1, 5, 3, 7, 3, 5,
-      7, 7, 7, 3, 3, 1, 1, 5, 5, 3, 7, 1, 1, 1, 3, 5, 3, 1, 1, 3, 3, 7, 5, 1, 1, 3, 7, 1, 5, 7,
-      3, 7, 5, 5, 7, 3, 5, 3, 1, 5, 3, 1, 1, 7, 5, 1, 7, 3, 7, 5, 1, 7, 1, 7, 7, 1, 1, 7, 1, 5,
-      5, 1, 1, 7, 5, 7, 1, 5, 3, 5, 3, 3, 7, 1, 5, 1, 1, 5, 5, 3, 3, 7, 5, 5, 1, 1, 1, 3, 1, 5,
-      7, 7, 1, 7, 5, 7, 3, 7, 3, 1, 3, 7, 3, 1, 5, 5, 3, 5, 1, 3, 5, 5, 5, 1, 1, 7, 7, 1, 5, 5,
-      1, 3, 5, 1, 5, 3, 5, 3, 3, 7, 5, 7, 3, 7, 3, 1, 3, 7, 7, 3, 3, 1, 1, 3, 3, 3, 3, 3, 5, 5,
-      3, 3, 3, 1, 3, 5, 7, 7, 1, 5, 7, 3, 7, 1, 1, 3, 5, 7, 5, 3, 3, 3 },
-      { 0, 0, 0, 0,
-      1, 7, 9, 13, 11, 1, 3, 7, 9, 5, 13, 13, 11, 3, 15, 5, 3,
-      15, 7, 9, 13, 9, 1, 11, 7, 5, 15, 1, 15, 11, 5, 11, 1, 7, 9, 7, 7, 1, 15, 15, 15, 13,
-      3, 3, 15, 5, 9, 7, 13, 3, 7, 5, 11, 9, 1, 9, 1, 5, 7, 13, 9, 9, 1, 7, 3, 5, 1, 11, 11,
-      13, 7, 7, 9, 9, 1, 1, 3, 9, 15, 1, 5, 13, 1, 9, 9, 9, 9, 9, 13, 11, 3, 5, 11, 11, 13,
-      5, 3, 15, 1, 11, 11, 7, 13, 15, 11, 13, 9, 11, 15, 15, 13, 3, 15, 7, 9, 11, 13, 11,
-      9, 9, 5, 13, 9, 1, 13, 7, 7, 7, 7, 7, 5, 9, 7, 13, 11, 9, 11, 15, 3, 13, 11, 1, 11, 3,
-      3, 9, 11, 1, 7, 1, 15, 15, 3, 1, 9, 1, 7, 13, 11, 3, 13, 11, 7, 3, 3, 5, 13, 11, 5,
-      11, 1, 3, 9, 7, 15, 7, 5, 13, 7, 9, 13, 15, 13, 9, 7, 15, 7, 9, 5, 11, 11, 13, 13, 9,
-      3, 5, 13, 9, 11, 15, 11, 7, 1, 7, 13, 3, 13, 3, 13, 9, 15, 7, 13, 13, 3, 13, 15, 15,
-      11, 9, 13, 9, 15, 1, 1, 15, 11, 11, 7, 1, 11, 13, 9, 13, 3, 5, 11, 13, 9, 9, 13, 1,
-      11, 15, 13, 3, 13, 7, 15, 1, 15, 3, 3, 11, 7, 13, 7, 7, 9, 7, 5, 15, 9, 5, 5, 7, 15,
-      13, 15, 5, 15, 5, 3, 1, 11, 7, 1, 5, 7, 9, 3, 11, 1, 15, 1, 3, 15, 11, 13, 5, 13, 1,
-      7, 1, 15, 7, 5, 1, 1, 15, 13, 11, 11, 13, 5, 11, 7, 9, 7, 1, 5, 3, 9, 5, 5, 11, 5, 1,
-      7, 1, 11, 7, 9, 13, 15, 13, 3, 1, 11, 13, 15, 1, 1, 11, 9, 13, 3, 13, 11, 15, 13, 9,
-      9, 9, 5, 5, 5, 5, 1, 15, 5, 9,
-      11, 7, 15, 5, 3, 13, 5, 3, 11, 5, 1, 11, 13, 9, 11,
-      3, 7, 13, 15, 1, 7, 11, 1, 13, 1, 15, 1, 9, 7, 3, 9, 11, 1, 9, 13, 13, 3, 11, 7, 9, 1,
-      7, 15, 9, 1, 5, 13, 5, 11, 3, 9, 15, 11, 13, 5, 1, 7, 7, 5, 13, 7, 7, 9, 5, 11, 11, 1,
-      1, 15, 3, 13, 9, 13, 9, 9, 11, 5, 5, 13, 15, 3, 9, 15, 3, 11, 11, 15, 15, 3, 11, 15,
-      15, 3, 1, 3, 1, 3, 3, 1, 3, 13, 1, 11, 5, 15, 7, 15, 9, 1, 7, 1, 9, 11, 15, 1, 13, 9,
-      13, 11, 7, 3, 7, 3, 13, 7, 9, 7, 7, 3, 3, 9, 9, 7, 5, 11, 13, 13, 7, 7, 15, 9, 5, 5, 3,
-      3, 13, 3, 9, 3, 1, 11, 1, 3, 11, 15, 11, 11, 11, 9, 13, 7, 9, 15, 9, 11, 1, 3, 3, 9,
-      7, 15, 13, 13, 7, 15, 9, 13, 9, 15, 13, 15, 9, 13, 1, 11, 7, 11, 3, 13, 5, 1, 7, 15,
-      3, 13, 7, 13, 13, 11, 3, 5, 3, 13, 11, 9, 9, 3, 11, 11, 7, 9, 13, 11, 7, 15, 13, 7,
-      5, 3, 1, 5, 15, 15, 3, 11, 1, 7, 3, 15, 11, 5, 5, 3, 5, 5, 1, 15, 5, 1, 5, 3, 7, 5, 11,
-      3, 13, 9, 13, 15, 5, 3, 5, 9, 5, 3, 11, 1, 13, 9, 15, 3, 5, 11, 9, 1, 3, 15, 9, 9, 9,
-      11, 7, 5, 13, 1, 15, 3, 13, 9, 13, 5, 1, 5, 1, 13, 13, 7, 7, 1, 9, 5, 11, 9, 11, 13,
-      3, 15, 15, 13, 15, 7, 5, 7, 9, 7, 9, 9, 9, 11, 9, 3, 11, 15, 13, 13, 5, 9, 15, 1, 1,
-      9, 5, 13, 3, 13, 15, 3, 1, 3, 11, 13, 1, 15, 9, 9, 3, 1, 9, 1, 9, 1, 13, 11, 15, 7,
-      11, 15, 13, 15, 1, 9, 9, 7,
-      3, 5, 11, 7, 3, 9, 5, 15, 7, 5, 3, 13, 7, 1, 1, 9,
-      15, 15, 15, 11, 3, 5, 15, 13, 7, 15, 15, 11, 11, 9, 5, 15, 9, 7, 3, 13, 1, 1, 5, 1,
-      3, 1, 7, 1, 1, 5, 1, 11, 11, 9, 9, 5, 13, 7, 7, 7, 1, 1, 9, 9, 11, 11, 15, 7, 5, 5, 3,
-      11, 1, 3, 7, 13, 7, 7, 7, 3, 15, 15, 11, 9, 3, 9, 3, 15, 13, 5, 3, 3, 3, 5, 9, 15, 9,
-      9, 1, 5, 9, 9, 15, 5, 15, 7, 9, 1, 9, 9, 5, 11, 5, 15, 15, 11, 7, 7, 7, 1, 1, 11, 11,
-      13, 15, 3, 13, 5, 1, 7, 1, 11, 3, 13, 15, 3, 5, 3, 5, 7, 3, 9, 9, 5, 1, 7, 11, 9, 3, 5,
-      11, 13, 13, 13, 9, 15, 5, 7, 1, 15, 11, 9, 15, 15, 13, 13, 13, 1, 11, 9, 15, 9, 5,
-      15, 5, 7, 3, 11, 3, 15, 7, 13, 11, 7, 3, 7, 13, 5, 13, 15, 5, 13, 9, 1, 15, 11, 5, 5,
-      1, 11, 3, 3, 7, 1, 9, 7, 15, 9, 9, 3, 11, 15, 7, 1, 3, 1, 1, 1, 9, 1, 5, 15, 15, 7, 5,
-      5, 7, 9, 7, 15, 13, 13, 11, 1, 9, 11, 1, 13, 1, 7, 15, 15, 5, 5, 1, 11, 3, 9, 11, 9,
-      9, 9, 1, 9, 3, 5, 15, 1, 1, 9, 7, 3, 3, 1, 9, 9, 11, 9, 9, 13, 13, 3, 13, 11, 13, 5, 1,
-      5, 5, 9, 9, 3, 13, 13, 9, 15, 9, 11, 7, 11, 9, 13, 9, 1, 15, 9, 7, 7, 1, 7, 9, 9, 15,
-      1, 11, 1, 13, 13, 15, 9, 13, 7, 15, 3, 9, 3, 1, 13, 7, 5, 9, 3, 1, 7, 1, 1, 13, 3, 3,
-      11, 1, 7, 13, 15, 15, 5, 7, 13, 13, 15, 11, 13, 1, 13, 13, 3, 9, 15, 15, 11, 15, 9,
-      15, 1, 13, 15, 1, 1, 5,
-      11, 5, 1, 11, 11, 5, 3, 9, 1, 3, 5, 13, 9, 7, 7, 1,
-      9, 9, 15, 7, 5, 5, 15, 13, 9, 7, 13, 3, 13, 11, 13, 7, 9, 13, 13, 13, 15, 9, 5, 5, 3,
-      3, 3, 1, 3, 15 },
-      { 0, 0, 0, 0, 0, 0,
-      9, 3, 27, 15, 29, 21, 23, 19, 11, 25, 7, 13, 17, 1,
-      25, 29, 3, 31, 11, 5, 23, 27, 19, 21, 5, 1, 17, 13, 7, 15, 9, 31, 25, 3, 5, 23, 7,
-      3, 17, 23, 3, 3, 21, 25, 25, 23, 11, 19, 3, 11, 31, 7, 9, 5, 17, 23, 17, 17, 25,
-      13, 11, 31, 27, 19, 17, 23, 7, 5, 11, 19, 19, 7, 13, 21, 21, 7, 9, 11, 1, 5, 21,
-      11, 13, 25, 9, 7, 7, 27, 15, 25, 15, 21, 17, 19, 19, 21, 5, 11, 3, 5, 29, 31, 29,
-      5, 5, 1, 31, 27, 11, 13, 1, 3, 7, 11, 7, 3, 23, 13, 31, 17, 1, 27, 11, 25, 1, 23,
-      29, 17, 25, 7, 25, 27, 17, 13, 17, 23, 5, 17, 5, 13, 11, 21, 5, 11, 5, 9, 31, 19,
-      17, 9, 9, 27, 21, 15, 15, 1, 1, 29, 5, 31, 11, 17, 23, 19, 21, 25, 15, 11, 5, 5, 1,
-      19, 19, 19, 7, 13, 21, 17, 17, 25, 23, 19, 23, 15, 13, 5, 19, 25, 9, 7, 3, 21, 17,
-      25, 1, 27, 25, 27, 25, 9, 13, 3, 17, 25, 23, 9, 25, 9, 13, 17, 17, 3, 15, 7, 7, 29,
-      3, 19, 29, 29, 19, 29, 13, 15, 25, 27, 1, 3, 9, 9, 13, 31, 29, 31, 5, 15, 29, 1,
-      19, 5, 9, 19, 5, 15, 3, 5, 7, 15, 17, 17, 23, 11, 9, 23, 19, 3, 17, 1, 27, 9, 9, 17,
-      13, 25, 29, 23, 29, 11, 31, 25, 21, 29, 19, 27, 31, 3, 5, 3, 3, 13, 21, 9, 29, 3,
-      17, 11, 11, 9, 21, 19, 7, 17, 31, 25, 1, 27, 5, 15, 27, 29, 29, 29, 25, 27, 25, 3,
-      21, 17, 25, 13, 15, 17, 13, 23, 9, 3, 11, 7, 9, 9, 7, 17, 7, 1,
-      27, 1, 9, 5, 31, 21, 25, 25, 21, 11, 1, 23, 19, 27,
-      15, 3, 5, 23, 9, 25, 7, 29, 11, 9, 13, 5, 11, 1, 3, 31, 27, 3, 17, 27, 11, 13, 15,
-      29, 15, 1, 15, 23, 25, 13, 21, 15, 3, 29, 29, 5, 25, 17, 11, 7, 15, 5, 21, 7, 31,
-      13, 11, 23, 5, 7, 23, 27, 21, 29, 15, 7, 27, 27, 19, 7, 15, 27, 27, 19, 19, 9, 15,
-      1, 3, 29, 29, 5, 27, 31, 9, 1, 7, 3, 19, 19, 29, 9, 3, 21, 31, 29, 25, 1, 3, 9, 27,
-      5, 27, 25, 21, 11, 29, 31, 27, 21, 29, 17, 9, 17, 13, 11, 25, 15, 21, 11, 19, 31,
-      3, 19, 5, 3, 3, 9, 13, 13, 3, 29, 7, 5, 9, 23, 13, 21, 23, 21, 31, 11, 7, 7, 3, 23,
-      1, 23, 5, 9, 17, 21, 1, 17, 29, 7, 5, 17, 13, 25, 17, 9, 19, 9, 5, 7, 21, 19, 13, 9,
-      7, 3, 9, 3, 15, 31, 29, 29, 25, 13, 9, 21, 9, 31, 7, 15, 5, 31, 7, 15, 27, 25, 19,
-      9, 9, 25, 25, 23, 1, 9, 7, 11, 15, 19, 15, 27, 17, 11, 11, 31, 13, 25, 25, 9, 7,
-      13, 29, 19, 5, 19, 31, 25, 13, 25, 15, 5, 9, 29, 31, 9, 29, 27, 25, 27, 11, 17, 5,
-      17, 3, 23, 15, 9, 9, 17, 17, 31, 11, 19, 25, 13, 23, 15, 25, 21, 31, 19, 3, 11,
-      25, 7, 15, 19, 7, 5, 3, 13, 13, 1, 23, 5, 25, 11, 25, 15, 13, 21, 11, 23, 29, 5,
-      17, 27, 9, 19, 15, 5, 29, 23, 19, 1, 27, 3, 23, 21, 19, 27, 11, 17, 13, 27, 11,
-      31, 23, 5, 9, 21, 31, 29, 11, 21, 17, 15, 7, 15, 7, 9, 21, 27, 25,
-      29, 11, 3, 21, 13, 23, 19, 27, 17, 29, 25, 17, 9,
-      1, 19, 23, 5, 23, 1, 17, 17, 13, 27, 23, 7, 7, 11, 13, 17, 13, 11, 21, 13, 23, 1,
-      27, 13, 9, 7, 1, 27, 29, 5, 13, 25, 21, 3, 31, 15, 13, 3, 19, 13, 1, 27, 15, 17, 1,
-      3, 13, 13, 13, 31, 29, 27, 7, 7, 21, 29, 15, 17, 17, 21, 19, 17, 3, 15, 5, 27, 27,
-      3, 31, 31, 7, 21, 3, 13, 11, 17, 27, 25, 1, 9, 7, 29, 27, 21, 23, 13, 25, 29, 15,
-      17, 29, 9, 15, 3, 21, 15, 17, 17, 31, 9, 9, 23, 19, 25, 3, 1, 11, 27, 29, 1, 31,
-      29, 25, 29, 1, 23, 29, 25, 13, 3, 31, 25, 5, 5, 11, 3, 21, 9, 23, 7, 11, 23, 11, 1,
-      1, 3, 23, 25, 23, 1, 23, 3, 27, 9, 27, 3, 23, 25, 19, 29, 29, 13, 27, 5, 9, 29, 29,
-      13, 17, 3, 23, 19, 7, 13, 3, 19, 23, 5, 29, 29, 13, 13, 5, 19, 5, 17, 9, 11, 11,
-      29, 27, 23, 19, 17, 25, 13, 1, 13, 3, 11, 1, 17, 29, 1, 13, 17, 9, 17, 21, 1, 11,
-      1, 1, 25, 5, 7, 29, 29, 19, 19, 1, 29, 13, 3, 1, 31, 15, 13, 3, 1, 11, 19, 5, 29,
-      13, 29, 23, 3, 1, 31, 13, 19, 17, 5, 5, 1, 29, 23, 3, 19, 25, 19, 27, 9, 27, 13,
-      15, 29, 23, 13, 25, 25, 17, 19, 17, 15, 27, 3, 25, 17, 27, 3, 27, 31, 23, 13, 31,
-      11, 15, 7, 21, 19, 27, 19, 21, 29, 7, 31, 13, 9, 9, 7, 21, 13, 11, 9, 11, 29, 19,
-      11, 19, 21, 5, 29, 13, 7, 19, 19, 27, 23, 31, 1, 27, 21, 7, 3, 7, 11,
-      23, 13, 29, 11, 31, 19, 1, 5, 5, 11, 5, 3, 27, 5,
-      7, 11, 31, 1, 27, 31, 31, 23, 5, 21, 27, 9, 25, 3, 15, 19, 1, 19, 9, 5, 25, 21, 15,
-      25, 29, 15, 21, 11, 19, 15, 3, 7, 13, 11, 25, 17, 1, 5, 31, 13, 29, 23, 9, 5, 29,
-      7, 17, 27, 7, 17, 31, 9, 31, 9, 9, 7, 21, 3, 3, 3, 9, 11, 21, 11, 31, 9, 25, 5, 1,
-      31, 13, 29, 9, 29, 1, 11, 19, 7, 27, 13, 31, 7, 31, 7, 25, 23, 21, 29, 11, 11, 13,
-      11, 27, 1, 23, 31, 21, 23, 21, 19, 31, 5, 31, 25, 25, 19, 17, 11, 25, 7, 13, 1,
-      29, 17, 23, 15, 7, 29, 17, 13, 3, 17 },
-      { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      37, 33, 7, 5, 11, 39, 63, 59, 17, 15, 23, 29, 3, 21,
-      13, 31, 25, 9, 49, 33, 19, 29, 11, 19, 27, 15, 25, 63, 55, 17, 63, 49, 19, 41,
-      59, 3, 57, 33, 49, 53, 57, 57, 39, 21, 7, 53, 9, 55, 15, 59, 19, 49, 31, 3, 39, 5,
-      5, 41, 9, 19, 9, 57, 25, 1, 15, 51, 11, 19, 61, 53, 29, 19, 11, 9, 21, 19, 43, 13,
-      13, 41, 25, 31, 9, 11, 19, 5, 53, 37, 7, 51, 45, 7, 7, 61, 23, 45, 7, 59, 41, 1,
-      29, 61, 37, 27, 47, 15, 31, 35, 31, 17, 51, 13, 25, 45, 5, 5, 33, 39, 5, 47, 29,
-      35, 47, 63, 45, 37, 47, 59, 21, 59, 33, 51, 9, 27, 13, 25, 43, 3, 17, 21, 59, 61,
-      27, 47, 57, 11, 17, 39, 1, 63, 21, 59, 17, 13, 31, 3, 31, 7, 9, 27, 37, 23, 31, 9,
-      45, 43, 31, 63, 21, 39, 51, 27, 7, 53, 11, 1, 59, 39, 23, 49, 23, 7, 55, 59, 3,
-      19, 35, 13, 9, 13, 15, 23, 9, 7, 43, 55, 3, 19, 9, 27, 33, 27, 49, 23, 47, 19, 7,
-      11, 55, 27, 35, 5, 5, 55, 35, 37, 9, 33, 29, 47, 25, 11, 47, 53, 61, 59, 3, 53,
-      47, 5, 19, 59, 5, 47, 23, 45, 53, 3, 49, 61, 47, 39, 29, 17, 57, 5, 17, 31, 23,
-      41, 39, 5, 27, 7, 29, 29, 33, 31, 41, 31, 29, 17, 29, 29, 9, 9, 31, 27, 53, 35, 5,
-      61, 1, 49, 13, 57, 29, 5, 21, 43, 25, 57, 49, 37, 27, 11, 61, 37, 49, 5, 63, 63,
-      3, 45, 37, 63, 21, 21, 19, 27, 59, 21, 45, 23, 13, 15, 3, 43, 63, 39, 19,
-      63, 31, 41, 41, 15, 43, 63, 53, 1, 63, 31, 7, 17,
-      11, 61, 31, 51, 37, 29, 59, 25, 63, 59, 47, 15, 27, 19, 29, 45, 35, 55, 39, 19,
-      43, 21, 19, 13, 17, 51, 37, 5, 33, 35, 49, 25, 45, 1, 63, 47, 9, 63, 15, 25, 25,
-      15, 41, 13, 3, 19, 51, 49, 37, 25, 49, 13, 53, 47, 23, 35, 29, 33, 21, 35, 23, 3,
-      43, 31, 63, 9, 1, 61, 43, 3, 11, 55, 11, 35, 1, 63, 35, 49, 19, 45, 9, 57, 51, 1,
-      47, 41, 9, 11, 37, 19, 55, 23, 55, 55, 13, 7, 47, 37, 11, 43, 17, 3, 25, 19, 55,
-      59, 37, 33, 43, 1, 5, 21, 5, 63, 49, 61, 21, 51, 15, 19, 43, 47, 17, 9, 53, 45,
-      11, 51, 25, 11, 25, 47, 47, 1, 43, 29, 17, 31, 15, 59, 27, 63, 11, 41, 51, 29, 7,
-      27, 63, 31, 43, 3, 29, 39, 3, 59, 59, 1, 53, 63, 23, 63, 47, 51, 23, 61, 39, 47,
-      21, 39, 15, 3, 9, 57, 61, 39, 37, 21, 51, 1, 23, 43, 27, 25, 11, 13, 21, 43, 7,
-      11, 33, 55, 1, 37, 35, 27, 61, 39, 5, 19, 61, 61, 57, 59, 21, 59, 61, 57, 25, 55,
-      27, 31, 41, 33, 63, 19, 57, 35, 13, 63, 35, 17, 11, 11, 49, 41, 55, 5, 45, 17,
-      35, 5, 31, 31, 37, 17, 45, 51, 1, 39, 49, 55, 19, 41, 13, 5, 51, 5, 49, 1, 21, 13,
-      17, 59, 51, 11, 3, 61, 1, 33, 37, 33, 61, 25, 27, 59, 7, 49, 13, 63, 3, 33, 3, 15,
-      9, 13, 35, 39, 11, 59, 59, 1, 57, 11, 5, 57, 13, 31, 13, 11, 55, 45, 9, 55, 55,
-      19, 25, 41, 23, 45, 29, 63, 59, 27, 39, 21, 37, 7,
-      61, 49, 35, 39, 9, 29, 7, 25, 23, 57, 5, 19, 15, 33, 49, 37, 25, 17, 45, 29, 15,
-      25, 3, 3, 49, 11, 39, 15, 19, 57, 39, 15, 11, 3, 57, 31, 55, 61, 19, 5, 41, 35,
-      59, 61, 39, 41, 53, 53, 63, 31, 9, 59, 13, 35, 55, 41, 49, 5, 41, 25, 27, 43, 5,
-      5, 43, 5, 5, 17, 5, 15, 27, 29, 17, 9, 3, 55, 31, 1, 45, 45, 13, 57, 17, 3, 61, 15,
-      49, 15, 47, 9, 37, 45, 9, 51, 61, 21, 33, 11, 21, 63, 63, 47, 57, 61, 49, 9, 59,
-      19, 29, 21, 23, 55, 23, 43, 41, 57, 9, 39, 27, 41, 35, 61, 29, 57, 63, 21, 31,
-      59, 35, 49, 3, 49, 47, 49, 33, 21, 19, 21, 35, 11, 17, 37, 23, 59, 13, 37, 35,
-      55, 57, 1, 29, 45, 11, 1, 15, 9, 33, 19, 53, 43, 39, 23, 7, 13, 13, 1, 19, 41, 55,
-      1, 13, 15, 59, 55, 15, 3, 57, 37, 31, 17, 1, 3, 21, 29, 25, 55, 9, 37, 33, 53, 41,
-      51, 19, 57, 13, 63, 43, 19, 7, 13, 37, 33, 19, 15, 63, 51, 11, 49, 23, 57, 47,
-      51, 15, 53, 41, 1, 15, 37, 61, 11, 35, 29, 33, 23, 55, 11, 59, 19, 61, 61, 45,
-      13, 49, 13, 63, 5, 61, 5, 31, 17, 61, 63, 13, 27, 57, 1, 21, 5, 11, 39, 57, 51,
-      53, 39, 25, 41, 39, 37, 23, 31, 25, 33, 17, 57, 29, 27, 23, 47, 41, 29, 19, 47,
-      41, 25, 5, 51, 43, 39, 29, 7, 31, 45, 51, 49, 55, 17, 43, 49, 45, 9, 29, 3, 5, 47,
-      9, 15, 19,
-      51, 45, 57, 63, 9, 21, 59, 3, 9, 13, 45, 23, 15,
-      31, 21, 15, 51, 35, 9, 11, 61, 23, 53, 29, 51, 45, 31, 29, 5, 35, 29, 53, 35, 17,
-      59, 55, 27, 51, 59, 27, 47, 15, 29, 37, 7, 49, 55, 5, 19, 45, 29, 19, 57, 33, 53,
-      45, 21, 9, 3, 35, 29, 43, 31, 39, 3, 45, 1, 41, 29, 5, 59, 41, 33, 35, 27, 19, 13,
-      25, 27, 43, 33, 35, 17, 17, 23, 7, 35, 15, 61, 61, 53, 5, 15, 23, 11, 13, 43, 55,
-      47, 25, 43, 15, 57, 45, 1, 49, 63, 57, 15, 31, 31, 7, 53, 27, 15, 47, 23, 7, 29,
-      53, 47, 9, 53, 3, 25, 55, 45, 63, 21, 17, 23, 31, 27, 27, 43, 63, 55, 63, 45, 51,
-      15, 27, 5, 37, 43, 11, 27, 5, 27, 59, 21, 7, 39, 27, 63, 35, 47, 55, 17, 17, 17,
-      3, 19, 21, 13, 49, 61, 39, 15 },
-      { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      13, 33, 115, 41, 79, 17, 29, 119, 75, 73, 105, 7,
-      59, 65, 21, 3, 113, 61, 89, 45, 107, 21, 71, 79, 19, 71, 61, 41, 57, 121, 87,
-      119, 55, 85, 121, 119, 11, 23, 61, 11, 35, 33, 43, 107, 113, 101, 29, 87, 119,
-      97, 29, 17, 89, 5, 127, 89, 119, 117, 103, 105, 41, 83, 25, 41, 55, 69, 117,
-      49, 127, 29, 1, 99, 53, 83, 15, 31, 73, 115, 35, 21, 89, 5, 1, 91, 53, 35, 95,
-      83, 19, 85, 55, 51, 101, 33, 41, 55, 45, 95, 61, 27, 37, 89, 75, 57, 61, 15,
-      117, 15, 21, 27, 25, 27, 123, 39, 109, 93, 51, 21, 91, 109, 107, 45, 15, 93,
-      127, 3, 53, 81, 79, 107, 79, 87, 35, 109, 73, 35, 83, 107, 1, 51, 7, 59, 33,
-      115, 43, 111, 45, 121, 105, 125, 87, 101, 41, 95, 75, 1, 57, 117, 21, 27, 67,
-      29, 53, 117, 63, 1, 77, 89, 115, 49, 127, 15, 79, 81, 29, 65, 103, 33, 73, 79,
-      29, 21, 113, 31, 33, 107, 95, 111, 59, 99, 117, 63, 63, 99, 39, 9, 35, 63, 125,
-      99, 45, 93, 33, 93, 9, 105, 75, 51, 115, 11, 37, 17, 41, 21, 43, 73, 19, 93, 7,
-      95, 81, 93, 79, 81, 55, 9, 51, 63, 45, 89, 73, 19, 115, 39, 47, 81, 39, 5, 5, 45,
-      53, 65, 49, 17, 105, 13, 107, 5, 5, 19, 73, 59, 43, 83, 97, 115, 27, 1, 69, 103,
-      3, 99, 103, 63, 67, 25, 121, 97, 77, 13, 83, 103, 41, 11, 27, 81, 37, 33, 125,
-      71, 41, 41, 59, 41, 87, 123,
-      43, 101, 63, 45, 39, 21, 97, 15, 97, 111, 21, 49,
-      13, 17, 79, 91, 65, 105, 75, 1, 45, 67, 83, 107, 125, 87, 15, 81, 95, 105, 65,
-      45, 59, 103, 23, 103, 99, 67, 99, 47, 117, 71, 89, 35, 53, 73, 9, 115, 49, 37,
-      1, 35, 9, 45, 81, 19, 127, 17, 17, 105, 89, 49, 101, 7, 37, 33, 11, 95, 95, 17,
-      111, 105, 41, 115, 5, 69, 101, 27, 27, 101, 103, 53, 9, 21, 43, 79, 91, 65,
-      117, 87, 125, 55, 45, 63, 85, 83, 97, 45, 83, 87, 113, 93, 95, 5, 17, 77, 77,
-      127, 123, 45, 81, 85, 121, 119, 27, 85, 41, 49, 15, 107, 21, 51, 119, 11, 87,
-      101, 115, 63, 63, 37, 121, 109, 7, 43, 69, 19, 77, 49, 71, 59, 35, 7, 13, 55,
-      101, 127, 103, 85, 109, 29, 61, 67, 21, 111, 67, 23, 57, 75, 71, 101, 123, 41,
-      107, 101, 107, 125, 27, 47, 119, 41, 19, 127, 33, 31, 109, 7, 91, 91, 39, 125,
-      105, 47, 125, 123, 91, 9, 103, 45, 23, 117, 9, 125, 73, 11, 37, 61, 79, 21, 5,
-      47, 117, 67, 53, 85, 33, 81, 121, 47, 61, 51, 127, 29, 65, 45, 41, 95, 57, 73,
-      33, 117, 61, 111, 59, 123, 65, 47, 105, 23, 29, 107, 37, 81, 67, 29, 115, 119,
-      75, 73, 99, 103, 7, 57, 45, 61, 95, 49, 101, 101, 35, 47, 119, 39, 67, 31, 103,
-      7, 61, 127, 87, 3, 35, 29, 73, 95, 103, 71, 75, 51, 87, 57, 97, 11, 105, 87, 41,
-      73, 109, 69, 35, 121, 39, 111, 1, 77,
-      39, 47, 53, 91, 3, 17, 51, 83, 39, 125, 85, 111,
-      21, 69, 85, 29, 55, 11, 117, 1, 47, 17, 65, 63, 47, 117, 17, 115, 51, 25, 33,
-      123, 123, 83, 51, 113, 95, 121, 51, 91, 109, 43, 55, 35, 55, 87, 33, 37, 5, 3,
-      45, 21, 105, 127, 35, 17, 35, 37, 97, 97, 21, 77, 123, 17, 89, 53, 105, 75, 25,
-      125, 13, 47, 21, 125, 23, 55, 63, 61, 5, 17, 93, 57, 121, 69, 73, 93, 121, 105,
-      75, 91, 67, 95, 75, 9, 69, 97, 99, 93, 11, 53, 19, 73, 5, 33, 79, 107, 65, 69,
-      79, 125, 25, 93, 55, 61, 17, 117, 69, 97, 87, 111, 37, 93, 59, 79, 95, 53, 115,
-      53, 85, 85, 65, 59, 23, 75, 21, 67, 27, 99, 79, 27, 3, 95, 27, 69, 19, 75, 47,
-      59, 41, 85, 77, 99, 55, 49, 93, 93, 119, 51, 125, 63, 13, 15, 45, 61, 19, 105,
-      115, 17, 83, 7, 7, 11, 61, 37, 63, 89, 95, 119, 113, 67, 123, 91, 33, 37, 99,
-      43, 11, 33, 65, 81, 79, 81, 107, 63, 63, 55, 89, 91, 25, 93, 101, 27, 55, 75,
-      121, 79, 43, 125, 73, 27, 109, 35, 21, 71, 113, 89, 59, 95, 41, 45, 113, 119,
-      113, 39, 59, 73, 15, 13, 59, 67, 121, 27, 7, 105, 15, 59, 59, 35, 91, 89, 23,
-      125, 97, 53, 41, 91, 111, 29, 31, 3, 103, 61, 71, 35, 7, 119, 29, 45, 49, 111,
-      41, 109, 59, 125, 13, 27, 19, 79, 9, 75, 83, 81, 33, 91, 109, 33, 29, 107, 111,
-      101, 107, 109, 65, 59, 43, 37,
-      1, 9, 15, 109, 37, 111, 113, 119, 79, 73, 65,
-      71, 93, 17, 101, 87, 97, 43, 23, 75, 109, 41, 49, 53, 31, 97, 105, 109, 119,
-      51, 9, 53, 113, 97, 73, 89, 79, 49, 61, 105, 13, 99, 53, 71, 7, 87, 21, 101, 5,
-      71, 31, 123, 121, 121, 73, 79, 115, 13, 39, 101, 19, 37, 51, 83, 97, 55, 81,
-      91, 127, 105, 89, 63, 47, 49, 75, 37, 77, 15, 49, 107, 23, 23, 35, 19, 69, 17,
-      59, 63, 73, 29, 125, 61, 65, 95, 101, 81, 57, 69, 83, 37, 11, 37, 95, 1, 73, 27,
-      29, 57, 7, 65, 83, 99, 69, 19, 103, 43, 95, 25, 19, 103, 41, 125, 97, 71, 105,
-      83, 83, 61, 39, 9, 45, 117, 63, 31, 5, 117, 67, 125, 41, 117, 43, 77, 97, 15,
-      29, 5, 59, 25, 63, 87, 39, 39, 77, 85, 37, 81, 73, 89, 29, 125, 109, 21, 23,
-      119, 105, 43, 93, 97, 15, 125, 29, 51, 69, 37, 45, 31, 75, 109, 119, 53, 5,
-      101, 125, 121, 35, 29, 7, 63, 17, 63, 13, 69, 15, 105, 51, 127, 105, 9, 57, 95,
-      59, 109, 35, 49, 23, 33, 107, 55, 33, 57, 79, 73, 69, 59, 107, 55, 11, 63, 95,
-      103, 23, 125, 91, 31, 91, 51, 65, 61, 75, 69, 107, 65, 101, 59, 35, 15 },
-      { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      7, 23, 39, 217, 141, 27, 53, 181, 169, 35, 15,
-      207, 45, 247, 185, 117, 41, 81, 223, 151, 81, 189, 61, 95, 185, 23, 73, 113,
-      239, 85, 9, 201, 83, 53, 183, 203, 91, 149, 101, 13, 111, 239, 3, 205, 253,
-      247, 121, 189, 169, 179, 197, 175, 217, 249, 195, 95, 63, 19, 7, 5, 75, 217,
-      245, 111, 189, 165, 169, 141, 221, 249, 159, 253, 207, 249, 219, 23, 49,
-      127, 237, 5, 25, 177, 37, 103, 65, 167, 81, 87, 119, 45, 79, 143, 57, 79, 187,
-      143, 183, 75, 97, 211, 149, 175, 37, 135, 189, 225, 241, 63, 33, 43, 13, 73,
-      213, 57, 239, 183, 117, 21, 29, 115, 43, 205, 223, 15, 3, 159, 51, 101, 127,
-      99, 239, 171, 113, 171, 119, 189, 245, 201, 27, 185, 229, 105, 153, 189, 33,
-      35, 137, 77, 97, 17, 181, 55, 197, 201, 155, 37, 197, 137, 223, 25, 179, 91,
-      23, 235, 53, 253, 49, 181, 249, 53, 173, 97, 247, 67, 115, 103, 159, 239, 69,
-      173, 217, 95, 221, 247, 97, 91, 123, 223, 213, 129, 181, 87, 239, 85, 89,
-      249, 141, 39, 57, 249, 71, 101, 159, 33, 137, 189, 71, 253, 205, 171, 13,
-      249, 109, 131, 199, 189, 179, 31, 99, 113, 41, 173, 23, 189, 197, 3, 135, 9,
-      95, 195, 27, 183, 1, 123, 73, 53, 99, 197, 59, 27, 101, 55, 193, 31, 61, 119,
-      11, 7, 255, 233, 53, 157, 193, 97, 83, 65, 81, 239, 167, 69, 71, 109,
-      97, 137, 71, 193, 189, 115, 79, 205, 37, 227,
-      53, 33, 91, 229, 245, 105, 77, 229, 161, 103, 93, 13, 161, 229, 223, 69, 15,
-      25, 23, 233, 93, 25, 217, 247, 61, 75, 27, 9, 223, 213, 55, 197, 145, 89, 199,
-      41, 201, 5, 149, 35, 119, 183, 53, 11, 13, 3, 179, 229, 43, 55, 187, 233, 47,
-      133, 91, 47, 71, 93, 105, 145, 45, 255, 221, 115, 175, 19, 129, 5, 209, 197,
-      57, 177, 115, 187, 119, 77, 211, 111, 33, 113, 23, 87, 137, 41, 7, 83, 43,
-      121, 145, 5, 219, 27, 11, 111, 207, 55, 97, 63, 229, 53, 33, 149, 23, 187,
-      153, 91, 193, 183, 59, 211, 93, 139, 59, 179, 163, 209, 77, 39, 111, 79, 229,
-      85, 237, 199, 137, 147, 25, 73, 121, 129, 83, 87, 93, 205, 167, 53, 107, 229,
-      213, 95, 219, 109, 175, 13, 209, 97, 61, 147, 19, 13, 123, 73, 35, 141, 81,
-      19, 171, 255, 111, 107, 233, 113, 133, 89, 9, 231, 95, 69, 33, 1, 253, 219,
-      253, 247, 129, 11, 251, 221, 153, 35, 103, 239, 7, 27, 235, 181, 5, 207, 53,
-      149, 155, 225, 165, 137, 155, 201, 97, 245, 203, 47, 39, 35, 105, 239, 49,
-      15, 253, 7, 237, 213, 55, 87, 199, 27, 175, 49, 41, 229, 85, 3, 149, 179, 129,
-      185, 249, 197, 15, 97, 197, 139, 203, 63, 33, 251, 217, 199, 199, 99, 249,
-      33, 229, 177, 13, 209, 147, 97, 31, 125, 177, 137,
-      187, 11, 91, 223, 29, 169, 231, 59, 31, 163, 41,
-      57, 87, 247, 25, 127, 101, 207, 187, 73, 61, 105, 27, 91, 171, 243, 33, 3, 1,
-      21, 229, 93, 71, 61, 37, 183, 65, 211, 53, 11, 151, 165, 47, 5, 129, 79, 101,
-      147, 169, 181, 19, 95, 77, 139, 197, 219, 97, 239, 183, 143, 9, 13, 209, 23,
-      215, 53, 137, 203, 19, 151, 171, 133, 219, 231, 3, 15, 253, 225, 33, 111,
-      183, 213, 169, 119, 111, 15, 201, 123, 121, 225, 113, 113, 225, 161, 165, 1,
-      139, 55, 3, 93, 217, 193, 97, 29, 69, 231, 161, 93, 69, 143, 137, 9, 87, 183,
-      113, 183, 73, 215, 137, 89, 251, 163, 41, 227, 145, 57, 81, 57, 11, 135, 145,
-      161, 175, 159, 25, 55, 167, 157, 211, 97, 247, 249, 23, 129, 159, 71, 197,
-      127, 141, 219, 5, 233, 131, 217, 101, 131, 33, 157, 173, 69, 207, 239, 81,
-      205, 11, 41, 169, 65, 193, 77, 201, 173, 1, 221, 157, 1, 15, 113, 147, 137,
-      205, 225, 73, 45, 49, 149, 113, 253, 99, 17, 119, 105, 117, 129, 243, 75,
-      203, 53, 29, 247, 35, 247, 171, 31, 199, 213, 29, 251, 7, 251, 187, 91, 11,
-      149, 13, 205, 37, 249, 137, 139, 9, 7, 113, 183, 205, 187, 39, 3, 79, 155,
-      227, 89, 185, 51, 127, 63, 83, 41, 133, 183, 181, 127, 19, 255, 219, 59, 251,
-      3, 187, 57, 217, 115, 217, 229, 181, 185, 149, 83, 115, 11,
-      123, 19, 109, 165, 103, 123, 219, 129, 155,
-      207, 177, 9, 49, 181, 231, 33, 233, 67, 155, 41, 9, 95, 123, 65, 117, 249, 85,
-      169, 129, 241, 173, 251, 225, 147, 165, 69, 81, 239, 95, 23, 83, 227, 249,
-      143, 171, 193, 9, 21, 57, 73, 97, 57, 29, 239, 151, 159, 191, 47, 51, 1, 223,
-      251, 251, 151, 41, 119, 127, 131, 33, 209, 123, 53, 241, 25, 31, 183, 107,
-      25, 115, 39, 11, 213, 239, 219, 109, 185, 35, 133, 123, 185, 27, 55, 245, 61,
-      75, 205, 213, 169, 163, 63, 55, 49, 83, 195, 51, 31, 41, 15, 203, 41, 63, 127,
-      161, 5, 143, 7, 199, 251, 95, 75, 101, 15, 43, 237, 197, 117, 167, 155, 21,
-      83, 205, 255, 49, 101, 213, 237, 135, 135, 21, 73, 93, 115, 7, 85, 223, 237,
-      79, 89, 5, 57, 239, 67, 65, 201, 155, 71, 85, 195, 89, 181, 119, 135, 147,
-      237, 173, 41, 155, 67, 113, 111, 21, 183, 23, 103, 207, 253, 69, 219, 205,
-      195, 43, 197, 229, 139, 177, 129, 69, 97, 201, 163, 189, 11, 99, 91, 253,
-      239, 91, 145, 19, 179, 231, 121, 7, 225, 237, 125, 191, 119, 59, 175, 237,
-      131, 79, 43, 45, 205, 199, 251, 153, 207, 37, 179, 113, 255, 107, 217, 61, 7,
-      181, 247, 31, 13, 113, 145, 107, 233, 233, 43, 79, 23, 169, 137, 129, 183,
-      53, 91, 55, 103, 223, 87, 177, 157, 79, 213, 139,
-      183, 231, 205, 143, 129, 243, 205, 93, 59,
-      15, 89, 9, 11, 47, 133, 227, 75, 9, 91, 19, 171, 163, 79, 7, 103, 5, 119, 155,
-      75, 11, 71, 95, 17, 13, 243, 207, 187 },
-      { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      235, 307, 495, 417, 57, 151, 19, 119, 375, 451,
-      55, 449, 501, 53, 185, 317, 17, 21, 487, 13, 347, 393, 15, 391, 307, 189,
-      381, 71, 163, 99, 467, 167, 433, 337, 257, 179, 47, 385, 23, 117, 369, 425,
-      207, 433, 301, 147, 333, 85, 221, 423, 49, 3, 43, 229, 227, 201, 383, 281,
-      229, 207, 21, 343, 251, 397, 173, 507, 421, 443, 399, 53, 345, 77, 385, 317,
-      155, 187, 269, 501, 19, 169, 235, 415, 61, 247, 183, 5, 257, 401, 451, 95,
-      455, 49, 489, 75, 459, 377, 87, 463, 155, 233, 115, 429, 211, 419, 143, 487,
-      195, 209, 461, 193, 157, 193, 363, 181, 271, 445, 381, 231, 135, 327, 403,
-      171, 197, 181, 343, 113, 313, 393, 311, 415, 267, 247, 425, 233, 289, 55,
-      39, 247, 327, 141, 5, 189, 183, 27, 337, 341, 327, 87, 429, 357, 265, 251,
-      437, 201, 29, 339, 257, 377, 17, 53, 327, 47, 375, 393, 369, 403, 125, 429,
-      257, 157, 217, 85, 267, 117, 337, 447, 219, 501, 41, 41, 193, 509, 131, 207,
-      505, 421, 149, 111, 177, 167, 223, 291, 91, 29, 305, 151, 177, 337, 183,
-      361, 435, 307, 507, 77, 181, 507, 315, 145, 423, 71, 103, 493, 271, 469,
-      339, 237, 437, 483, 31, 219, 61, 131, 391, 233, 219, 69, 57, 459, 225, 421,
-      7, 461, 111, 451, 277, 185, 193, 125, 251, 199, 73, 71, 7, 409, 417, 149,
-      193, 53, 437, 29, 467, 229, 31, 35, 75, 105,
-      503, 75, 317, 401, 367, 131, 365, 441, 433, 93, 377, 405, 465, 259, 283,
-      443, 143, 445, 3, 461, 329, 309, 77, 323, 155, 347, 45, 381, 315, 463, 207,
-      321, 157, 109, 479, 313, 345, 167, 439, 307, 235, 473, 79, 101, 245, 19,
-      381, 251, 35, 25, 107, 187, 115, 113, 321, 115, 445, 61, 77, 293, 405, 13,
-      53, 17, 171, 299, 41, 79, 3, 485, 331, 13, 257, 59, 201, 497, 81, 451, 199,
-      171, 81, 253, 365, 75, 451, 149, 483, 81, 453, 469, 485, 305, 163, 401, 15,
-      91, 3, 129, 35, 239, 355, 211, 387, 101, 299, 67, 375, 405, 357, 267, 363,
-      79, 83, 437, 457, 39, 97, 473, 289, 179, 57, 23, 49, 79, 71, 341, 287, 95,
-      229, 271, 475, 49, 241, 261, 495, 353, 381, 13, 291, 37, 251, 105, 399, 81,
-      89, 265, 507, 205, 145, 331, 129, 119, 503, 249, 1, 289, 463, 163, 443, 63,
-      123, 361, 261, 49, 429, 137, 355, 175, 507, 59, 277, 391, 25, 185, 381, 197,
-      39, 5, 429, 119, 247, 177, 329, 465, 421, 271, 467, 151, 45, 429, 137, 471,
-      11, 17, 409, 347, 199, 463, 177, 11, 51, 361, 95, 497, 163, 351, 127, 395,
-      511, 327, 353, 49, 105, 151, 321, 331, 329, 509, 107, 109, 303, 467, 287,
-      161, 45, 385, 289, 363, 331, 265, 407, 37, 433, 315, 343, 63, 51, 185, 71,
-      27, 267,
-      503, 239, 293, 245, 281, 297, 75, 461, 371,
-      129, 189, 189, 339, 287, 111, 111, 379, 93, 27, 185, 347, 337, 247, 507,
-      161, 231, 43, 499, 73, 327, 263, 331, 249, 493, 37, 25, 115, 3, 167, 197,
-      127, 357, 497, 103, 125, 191, 165, 55, 101, 95, 79, 351, 341, 43, 125, 135,
-      173, 289, 373, 133, 421, 241, 281, 213, 177, 363, 151, 227, 145, 363, 239,
-      431, 81, 397, 241, 67, 291, 255, 405, 421, 399, 75, 399, 105, 329, 41, 425,
-      7, 283, 375, 475, 427, 277, 209, 411, 3, 137, 195, 289, 509, 121, 55, 147,
-      275, 251, 19, 129, 285, 415, 487, 491, 193, 219, 403, 23, 97, 65, 285, 75,
-      21, 373, 261, 339, 239, 495, 415, 333, 107, 435, 297, 213, 149, 463, 199,
-      323, 45, 19, 301, 121, 499, 187, 229, 63, 425, 99, 281, 35, 125, 349, 87,
-      101, 59, 195, 511, 355, 73, 263, 243, 101, 165, 141, 11, 389, 219, 187, 449,
-      447, 393, 477, 305, 221, 51, 355, 209, 499, 479, 265, 377, 145, 411, 173,
-      11, 433, 483, 135, 385, 341, 89, 209, 391, 33, 395, 319, 451, 119, 341, 227,
-      375, 61, 331, 493, 411, 293, 47, 203, 375, 167, 395, 155, 5, 237, 361, 489,
-      127, 21, 345, 101, 371, 233, 431, 109, 119, 277, 125, 263, 73, 135, 123, 83,
-      123, 405, 69, 75, 287, 401, 23, 283, 393, 41, 379, 431, 11, 475, 505, 19,
-      365, 265, 271,
-      499, 489, 443, 165, 91, 83, 291, 319, 199,
-      107, 245, 389, 143, 137, 89, 125, 281, 381, 215, 131, 299, 249, 375, 455,
-      43, 73, 281, 217, 297, 229, 431, 357, 81, 357, 171, 451, 481, 13, 387, 491,
-      489, 439, 385, 487, 177, 393, 33, 71, 375, 443, 129, 407, 395, 127, 65, 333,
-      309, 119, 197, 435, 497, 373, 71, 379, 509, 387, 159, 265, 477, 463, 449,
-      47, 353, 249, 335, 505, 89, 141, 55, 235, 187, 87, 363, 93, 363, 101, 67,
-      215, 321, 331, 305, 261, 411, 491, 479, 65, 307, 469, 415, 131, 315, 487,
-      83, 455, 19, 113, 163, 503, 99, 499, 251, 239, 81, 167, 391, 255, 317, 363,
-      359, 395, 419, 307, 251, 267, 171, 461, 183, 465, 165, 163, 293, 477, 223,
-      403, 389, 97, 335, 357, 297, 19, 469, 501, 249, 85, 213, 311, 265, 379, 297,
-      283, 393, 449, 463, 289, 159, 289, 499, 407, 129, 137, 221, 43, 89, 403,
-      271, 75, 83, 445, 453, 389, 149, 143, 423, 499, 317, 445, 157, 137, 453,
-      163, 87, 23, 391, 119, 427, 323, 173, 89, 259, 377, 511, 249, 31, 363, 229,
-      353, 329, 493, 427, 57, 205, 389, 91, 83, 13, 219, 439, 45, 35, 371, 441, 17,
-      267, 501, 53, 25, 333, 17, 201, 475, 257, 417, 345, 381, 377, 55, 403, 77,
-      389, 347, 363, 211, 413, 419, 5, 167, 219, 201, 285, 425, 11, 77, 269, 489,
-      281, 403, 79,
-      425, 125, 81, 331, 437, 271, 397, 299, 475,
-      271, 249, 413, 233, 261, 495, 171, 69, 27, 409, 21, 421, 367, 81, 483, 255,
-      15, 219, 365, 497, 181, 75, 431, 99, 325, 407, 229, 281, 63, 83, 493, 5, 113,
-      15, 271, 37, 87, 451, 299, 83, 451, 311, 441, 47, 455, 47, 253, 13, 109, 369,
-      347, 11, 409, 275, 63, 441, 15 },
-      { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      519, 307, 931, 1023, 517, 771, 151, 1023,
-      539, 725, 45, 927, 707, 29, 125, 371, 275, 279, 817, 389, 453, 989, 1015,
-      29, 169, 743, 99, 923, 981, 181, 693, 309, 227, 111, 219, 897, 377, 425,
-      609, 227, 19, 221, 143, 581, 147, 919, 127, 725, 793, 289, 411, 835, 921,
-      957, 443, 349, 813, 5, 105, 457, 393, 539, 101, 197, 697, 27, 343, 515, 69,
-      485, 383, 855, 693, 133, 87, 743, 747, 475, 87, 469, 763, 721, 345, 479,
-      965, 527, 121, 271, 353, 467, 177, 245, 627, 113, 357, 7, 691, 725, 355,
-      889, 635, 737, 429, 545, 925, 357, 873, 187, 351, 677, 999, 921, 477, 233,
-      765, 495, 81, 953, 479, 89, 173, 473, 131, 961, 411, 291, 967, 65, 511, 13,
-      805, 945, 369, 827, 295, 163, 835, 259, 207, 331, 29, 315, 999, 133, 967,
-      41, 117, 677, 471, 717, 881, 755, 351, 723, 259, 879, 455, 721, 289, 149,
-      199, 805, 987, 851, 423, 597, 129, 11, 733, 549, 153, 285, 451, 559, 377,
-      109, 357, 143, 693, 615, 677, 701, 475, 767, 85, 229, 509, 547, 151, 389,
-      711, 785, 657, 319, 509, 99, 1007, 775, 359, 697, 677, 85, 497, 105, 615,
-      891, 71, 449, 835, 609, 377, 693, 665, 627, 215, 911, 503, 729, 131, 19,
-      895, 199, 161, 239, 633, 1013, 537, 255, 23, 149, 679, 1021, 595, 199, 557,
-      659, 251, 829, 727, 439, 495, 647, 223,
-      949, 625, 87, 481, 85, 799, 917, 769, 949,
-      739, 115, 499, 945, 547, 225, 1015, 469, 737, 495, 353, 103, 17, 665, 639,
-      525, 75, 447, 185, 43, 729, 577, 863, 735, 317, 99, 17, 477, 893, 537, 519,
-      1017, 375, 297, 325, 999, 353, 343, 729, 135, 489, 859, 267, 141, 831, 141,
-      893, 249, 807, 53, 613, 131, 547, 977, 131, 999, 175, 31, 341, 739, 467,
-      675, 241, 645, 247, 391, 583, 183, 973, 433, 367, 131, 467, 571, 309, 385,
-      977, 111, 917, 935, 473, 345, 411, 313, 97, 149, 959, 841, 839, 669, 431,
-      51, 41, 301, 247, 1015, 377, 329, 945, 269, 67, 979, 581, 643, 823, 557, 91,
-      405, 117, 801, 509, 347, 893, 303, 227, 783, 555, 867, 99, 703, 111, 797,
-      873, 541, 919, 513, 343, 319, 517, 135, 871, 917, 285, 663, 301, 15, 763,
-      89, 323, 757, 317, 807, 309, 1013, 345, 499, 279, 711, 915, 411, 281, 193,
-      739, 365, 315, 375, 809, 469, 487, 621, 857, 975, 537, 939, 585, 129, 625,
-      447, 129, 1017, 133, 83, 3, 415, 661, 53, 115, 903, 49, 79, 55, 385, 261,
-      345, 297, 199, 385, 617, 25, 515, 275, 849, 401, 471, 377, 661, 535, 505,
-      939, 465, 225, 929, 219, 955, 659, 441, 117, 527, 427, 515, 287, 191, 33,
-      389, 197, 825, 63, 417, 949, 35, 571, 9, 131, 609, 439, 95, 19, 569, 893,
-      451, 397, 971, 801,
-      125, 471, 187, 257, 67, 949, 621, 453, 411,
-      621, 955, 309, 783, 893, 597, 377, 753, 145, 637, 941, 593, 317, 555, 375,
-      575, 175, 403, 571, 555, 109, 377, 931, 499, 649, 653, 329, 279, 271, 647,
-      721, 665, 429, 957, 803, 767, 425, 477, 995, 105, 495, 575, 687, 385, 227,
-      923, 563, 723, 481, 717, 111, 633, 113, 369, 955, 253, 321, 409, 909, 367,
-      33, 967, 453, 863, 449, 539, 781, 911, 113, 7, 219, 725, 1015, 971, 1021,
-      525, 785, 873, 191, 893, 297, 507, 215, 21, 153, 645, 913, 755, 371, 881,
-      113, 903, 225, 49, 587, 201, 927, 429, 599, 513, 97, 319, 331, 833, 325,
-      887, 139, 927, 399, 163, 307, 803, 169, 1019, 869, 537, 907, 479, 335, 697,
-      479, 353, 769, 787, 1023, 855, 493, 883, 521, 735, 297, 1011, 991, 879,
-      855, 591, 415, 917, 375, 453, 553, 189, 841, 339, 211, 601, 57, 765, 745,
-      621, 209, 875, 639, 7, 595, 971, 263, 1009, 201, 23, 77, 621, 33, 535, 963,
-      661, 523, 263, 917, 103, 623, 231, 47, 301, 549, 337, 675, 189, 357, 1005,
-      789, 189, 319, 721, 1005, 525, 675, 539, 191, 813, 917, 51, 167, 415, 579,
-      755, 605, 721, 837, 529, 31, 327, 799, 961, 279, 409, 847, 649, 241, 285,
-      545, 407, 161, 591, 73, 313, 811, 17, 663, 269, 261, 37, 783, 127, 917, 231,
-      577, 975, 793,
-      921, 343, 751, 139, 221, 79, 817, 393, 545,
-      11, 781, 71, 1, 699, 767, 917, 9, 107, 341, 587, 903, 965, 599, 507, 843,
-      739, 579, 397, 397, 325, 775, 565, 925, 75, 55, 979, 931, 93, 957, 857, 753,
-      965, 795, 67, 5, 87, 909, 97, 995, 271, 875, 671, 613, 33, 351, 69, 811, 669,
-      729, 401, 647, 241, 435, 447, 721, 271, 745, 53, 775, 99, 343, 451, 427,
-      593, 339, 845, 243, 345, 17, 573, 421, 517, 971, 499, 435, 769, 75, 203,
-      793, 985, 343, 955, 735, 523, 659, 703, 303, 421, 951, 405, 631, 825, 735,
-      433, 841, 485, 49, 749, 107, 669, 211, 497, 143, 99, 57, 277, 969, 107, 397,
-      563, 551, 447, 381, 187, 57, 405, 731, 769, 923, 955, 915, 737, 595, 341,
-      253, 823, 197, 321, 315, 181, 885, 497, 159, 571, 981, 899, 785, 947, 217,
-      217, 135, 753, 623, 565, 717, 903, 581, 955, 621, 361, 869, 87, 943, 907,
-      853, 353, 335, 197, 771, 433, 743, 195, 91, 1023, 63, 301, 647, 205, 485,
-      927, 1003, 987, 359, 577, 147, 141, 1017, 701, 273, 89, 589, 487, 859, 343,
-      91, 847, 341, 173, 287, 1003, 289, 639, 983, 685, 697, 35, 701, 645, 911,
-      501, 705, 873, 763, 745, 657, 559, 699, 315, 347, 429, 197, 165, 955, 859,
-      167, 303, 833, 531, 473, 635, 641, 195, 589, 821, 205, 3, 635, 371, 891,
-      249, 123,
-      77, 623, 993, 401, 525, 427, 71, 655, 951,
-      357, 851, 899, 535, 493, 323, 1003, 343, 515, 859, 1017, 5, 423, 315, 1011,
-      703, 41, 777, 163, 95, 831, 79, 975, 235, 633, 723, 297, 589, 317, 679, 981,
-      195, 399, 1003, 121, 501, 155 },
-      { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      7, 2011, 1001, 49, 825, 415, 1441, 383, 1581,
-      623, 1621, 1319, 1387, 619, 839, 217, 75, 1955, 505, 281, 1629, 1379, 53,
-      1111, 1399, 301, 209, 49, 155, 1647, 631, 129, 1569, 335, 67, 1955, 1611,
-      2021, 1305, 121, 37, 877, 835, 1457, 669, 1405, 935, 1735, 665, 551, 789,
-      1543, 1267, 1027, 1, 1911, 163, 1929, 67, 1975, 1681, 1413, 191, 1711,
-      1307, 401, 725, 1229, 1403, 1609, 2035, 917, 921, 1789, 41, 2003, 187, 67,
-      1635, 717, 1449, 277, 1903, 1179, 363, 1211, 1231, 647, 1261, 1029, 1485,
-      1309, 1149, 317, 1335, 171, 243, 271, 1055, 1601, 1129, 1653, 205, 1463,
-      1681, 1621, 197, 951, 573, 1697, 1265, 1321, 1805, 1235, 1853, 1307, 945,
-      1197, 1411, 833, 273, 1517, 1747, 1095, 1345, 869, 57, 1383, 221, 1713,
-      335, 1751, 1141, 839, 523, 1861, 1105, 389, 1177, 1877, 805, 93, 1591,
-      423, 1835, 99, 1781, 1515, 1909, 1011, 303, 385, 1635, 357, 973, 1781,
-      1707, 1363, 1053, 649, 1469, 623, 1429, 1241, 1151, 1055, 503, 921, 3,
-      349, 1149, 293, 45, 303, 877, 1565, 1583, 1001, 663, 1535, 395, 1141,
-      1481, 1797, 643, 1507, 465, 2027, 1695, 367, 937, 719, 545, 1991, 83, 819,
-      239, 1791, 1461, 1647, 1501, 1161, 1629, 139, 1595, 1921, 1267, 1415,
-      509, 347, 777, 1083, 363, 269, 1015,
-      1809, 1105, 1429, 1471, 2019, 381, 2025,
-      1223, 827, 1733, 887, 1321, 803, 1951, 1297, 1995, 833, 1107, 1135, 1181,
-      1251, 983, 1389, 1565, 273, 137, 71, 735, 1005, 933, 67, 1471, 551, 457,
-      1667, 1729, 919, 285, 1629, 1815, 653, 1919, 1039, 531, 393, 1411, 359,
-      221, 699, 1485, 471, 1357, 1715, 595, 1677, 153, 1903, 1281, 215, 781,
-      543, 293, 1807, 965, 1695, 443, 1985, 321, 879, 1227, 1915, 839, 1945,
-      1993, 1165, 51, 557, 723, 1491, 817, 1237, 947, 1215, 1911, 1225, 1965,
-      1889, 1503, 1177, 73, 1767, 303, 177, 1897, 1401, 321, 921, 217, 1779,
-      327, 1889, 333, 615, 1665, 1825, 1639, 237, 1205, 361, 129, 1655, 983,
-      1089, 1171, 401, 677, 643, 749, 303, 1407, 1873, 1579, 1491, 1393, 1247,
-      789, 763, 49, 5, 1607, 1891, 735, 1557, 1909, 1765, 1777, 1127, 813, 695,
-      97, 731, 1503, 1751, 333, 769, 865, 693, 377, 1919, 957, 1359, 1627, 1039,
-      1783, 1065, 1665, 1917, 1947, 991, 1997, 841, 459, 221, 327, 1595, 1881,
-      1269, 1007, 129, 1413, 475, 1105, 791, 1983, 1359, 503, 691, 659, 691,
-      343, 1375, 1919, 263, 1373, 603, 1383, 297, 781, 145, 285, 767, 1739,
-      1715, 715, 317, 1333, 85, 831, 1615, 81, 1667, 1467, 1457, 1453, 1825,
-      109, 387, 1207, 2039, 213, 1351, 1329, 1173,
-      57, 1769, 951, 183, 23, 451, 1155, 1551,
-      2037, 811, 635, 1671, 1451, 863, 1499, 1673, 363, 1029, 1077, 1525, 277,
-      1023, 655, 665, 1869, 1255, 965, 277, 1601, 329, 1603, 1901, 395, 65,
-      1307, 2029, 21, 1321, 543, 1569, 1185, 1905, 1701, 413, 2041, 1697, 725,
-      1417, 1847, 411, 211, 915, 1891, 17, 1877, 1699, 687, 1089, 1973, 1809,
-      851, 1495, 1257, 63, 1323, 1307, 609, 881, 1543, 177, 617, 1505, 1747,
-      1537, 925, 183, 77, 1723, 1877, 1703, 397, 459, 521, 257, 1177, 389, 1947,
-      1553, 1583, 1831, 261, 485, 289, 1281, 1543, 1591, 1123, 573, 821, 1065,
-      1933, 1373, 2005, 905, 207, 173, 1573, 1597, 573, 1883, 1795, 1499, 1743,
-      553, 335, 333, 1645, 791, 871, 1157, 969, 557, 141, 223, 1129, 1685, 423,
-      1069, 391, 99, 95, 1847, 531, 1859, 1833, 1833, 341, 237, 1997, 1799, 409,
-      431, 1917, 363, 335, 1039, 1085, 1657, 1975, 1527, 1111, 659, 389, 899,
-      595, 1439, 1861, 1979, 1569, 1087, 1009, 165, 1895, 1481, 1583, 29, 1193,
-      1673, 1075, 301, 1081, 1377, 1747, 1497, 1103, 1789, 887, 739, 1577, 313,
-      1367, 1299, 1801, 1131, 1837, 73, 1865, 1065, 843, 635, 55, 1655, 913,
-      1037, 223, 1871, 1161, 461, 479, 511, 1721, 1107, 389, 151, 35, 375, 1099,
-      937, 1185, 1701, 769, 639, 1633,
-      1609, 379, 1613, 2031, 685, 289, 975, 671,
-      1599, 1447, 871, 647, 99, 139, 1427, 959, 89, 117, 841, 891, 1959, 223,
-      1697, 1145, 499, 1435, 1809, 1413, 1445, 1675, 171, 1073, 1349, 1545,
-      2039, 1027, 1563, 859, 215, 1673, 1919, 1633, 779, 411, 1845, 1477, 1489,
-      447, 1545, 351, 1989, 495, 183, 1639, 1385, 1805, 1097, 1249, 1431, 1571,
-      591, 697, 1509, 709, 31, 1563, 165, 513, 1425, 1299, 1081, 145, 1841,
-      1211, 941, 609, 845, 1169, 1865, 1593, 347, 293, 1277, 157, 211, 93, 1679,
-      1799, 527, 41, 473, 563, 187, 1525, 575, 1579, 857, 703, 1211, 647, 709,
-      981, 285, 697, 163, 981, 153, 1515, 47, 1553, 599, 225, 1147, 381, 135,
-      821, 1965, 609, 1033, 983, 503, 1117, 327, 453, 2005, 1257, 343, 1649,
-      1199, 599, 1877, 569, 695, 1587, 1475, 187, 973, 233, 511, 51, 1083, 665,
-      1321, 531, 1875, 1939, 859, 1507, 1979, 1203, 1965, 737, 921, 1565, 1943,
-      819, 223, 365, 167, 1705, 413, 1577, 745, 1573, 655, 1633, 1003, 91, 1123,
-      477, 1741, 1663, 35, 715, 37, 1513, 815, 941, 1379, 263, 1831, 1735, 1111,
-      1449, 353, 1941, 1655, 1349, 877, 285, 1723, 125, 1753, 985, 723, 175,
-      439, 791, 1051, 1261, 717, 1555, 1757, 1777, 577, 1583, 1957, 873, 331,
-      1163, 313, 1, 1963, 963, 1905, 821,
-      1677, 185, 709, 545, 1723, 215, 1885,
-      1249, 583, 1803, 839, 885, 485, 413, 1767, 425, 129, 1035, 329, 1263,
-      1881, 1779, 1565, 359, 367, 453, 707, 1419, 831, 1889, 887, 1871, 1869,
-      747, 223, 1547, 1799, 433, 1441, 553, 2021, 1303, 1505, 1735, 1619, 1065,
-      1161, 2047, 347, 867, 881, 1447, 329, 781, 1065, 219, 589, 645, 1257,
-      1833, 749, 1841, 1733, 1179, 1191, 1025, 1639, 1955, 1423, 1685, 1711,
-      493, 549, 783, 1653, 397, 895, 233, 759, 1505, 677, 1449, 1573, 1297,
-      1821, 1691, 791, 289, 1187, 867, 1535, 575, 183 },
-      { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      3915, 97, 3047, 937, 2897, 953, 127, 1201,
-      3819, 193, 2053, 3061, 3759, 1553, 2007, 2493, 603, 3343, 3751, 1059,
-      783, 1789, 1589, 283, 1093, 3919, 2747, 277, 2605, 2169, 2905, 721, 4069,
-      233, 261, 1137, 3993, 3619, 2881, 1275, 3865, 1299, 3757, 1193, 733, 993,
-      1153, 2945, 3163, 3179, 437, 271, 3493, 3971, 1005, 2615, 2253, 1131,
-      585, 2775, 2171, 2383, 2937, 2447, 1745, 663, 1515, 3767, 2709, 1767,
-      3185, 3017, 2815, 1829, 87, 3341, 793, 2627, 2169, 1875, 3745, 367, 3783,
-      783, 827, 3253, 2639, 2955, 3539, 1579, 2109, 379, 2939, 3019, 1999,
-      2253, 2911, 3733, 481, 1767, 1055, 4019, 4085, 105, 1829, 2097, 2379,
-      1567, 2713, 737, 3423, 3941, 2659, 3961, 1755, 3613, 1937, 1559, 2287,
-      2743, 67, 2859, 325, 2601, 1149, 3259, 2403, 3947, 2011, 175, 3389, 3915,
-      1315, 2447, 141, 359, 3609, 3933, 729, 2051, 1755, 2149, 2107, 1741,
-      1051, 3681, 471, 1055, 845, 257, 1559, 1061, 2803, 2219, 1315, 1369,
-      3211, 4027, 105, 11, 1077, 2857, 337, 3553, 3503, 3917, 2665, 3823, 3403,
-      3711, 2085, 1103, 1641, 701, 4095, 2883, 1435, 653, 2363, 1597, 767, 869,
-      1825, 1117, 1297, 501, 505, 149, 873, 2673, 551, 1499, 2793, 3277, 2143,
-      3663, 533, 3991, 575, 1877, 1009, 3929, 473, 3009, 2595, 3249, 675, 3593,
-      2453, 1567, 973, 595, 1335, 1715, 589, 85,
-      2265, 3069, 461, 1659, 2627, 1307, 1731, 1501, 1699, 3545, 3803, 2157,
-      453, 2813, 2047, 2999, 3841, 2361, 1079, 573, 69, 1363, 1597, 3427, 2899,
-      2771, 1327, 1117, 1523, 3521, 2393, 2537, 1979, 3179, 683, 2453, 453,
-      1227, 779, 671, 3483, 2135, 3139, 3381, 3945, 57, 1541, 3405, 3381, 2371,
-      2879, 1985, 987, 3017, 3031, 3839, 1401, 3749, 2977, 681, 1175, 1519,
-      3355, 907, 117, 771, 3741, 3337, 1743, 1227, 3335, 2755, 1909, 3603,
-      2397, 653, 87, 2025, 2617, 3257, 287, 3051, 3809, 897, 2215, 63, 2043,
-      1757, 3671, 297, 3131, 1305, 293, 3865, 3173, 3397, 2269, 3673, 717,
-      3041, 3341, 3595, 3819, 2871, 3973, 1129, 513, 871, 1485, 3977, 2473,
-      1171, 1143, 3063, 3547, 2183, 3993, 133, 2529, 2699, 233, 2355, 231,
-      3241, 611, 1309, 3829, 1839, 1495, 301, 1169, 1613, 2673, 243, 3601,
-      3669, 2813, 2671, 2679, 3463, 2477, 1795, 617, 2317, 1855, 1057, 1703,
-      1761, 2515, 801, 1205, 1311, 473, 3963, 697, 1221, 251, 381, 3887, 1761,
-      3093, 3721, 2079, 4085, 379, 3601, 3845, 433, 1781, 29, 1897, 1599, 2163,
-      75, 3475, 3957, 1641, 3911, 2959, 2833, 1279, 1099, 403, 799, 2183, 2699,
-      1711, 2037, 727, 289, 1785, 1575, 3633, 2367, 1261, 3953, 1735, 171,
-      1959,
-      2867, 859, 2951, 3211, 15, 1279, 1323, 599,
-      1651, 3951, 1011, 315, 3513, 3351, 1725, 3793, 2399, 287, 4017, 3571,
-      1007, 541, 3115, 429, 1585, 1285, 755, 1211, 3047, 915, 3611, 2697, 2129,
-      3669, 81, 3939, 2437, 915, 779, 3567, 3701, 2479, 3807, 1893, 3927, 2619,
-      2543, 3633, 2007, 3857, 3837, 487, 1769, 3759, 3105, 2727, 3155, 2479,
-      1341, 1657, 2767, 2541, 577, 2105, 799, 17, 2871, 3637, 953, 65, 69, 2897,
-      3841, 3559, 4067, 2335, 3409, 1087, 425, 2813, 1705, 1701, 1237, 821,
-      1375, 3673, 2693, 3925, 1541, 1871, 2285, 847, 4035, 1101, 2029, 855,
-      2733, 2503, 121, 2855, 1069, 3463, 3505, 1539, 607, 1349, 575, 2301,
-      2321, 1101, 333, 291, 2171, 4085, 2173, 2541, 1195, 925, 4039, 1379, 699,
-      1979, 275, 953, 1755, 1643, 325, 101, 2263, 3329, 3673, 3413, 1977, 2727,
-      2313, 1419, 887, 609, 2475, 591, 2613, 2081, 3805, 3435, 2409, 111, 3557,
-      3607, 903, 231, 3059, 473, 2959, 2925, 3861, 2043, 3887, 351, 2865, 369,
-      1377, 2639, 1261, 3625, 3279, 2201, 2949, 3049, 449, 1297, 897, 1891,
-      411, 2773, 749, 2753, 1825, 853, 2775, 3547, 3923, 3923, 987, 3723, 2189,
-      3877, 3577, 297, 2763, 1845, 3083, 2951, 483, 2169, 3985, 245, 3655,
-      3441, 1023, 235, 835, 3693, 3585, 327, 1003, 543, 3059, 2637,
-      2923, 87, 3617, 1031, 1043, 903, 2913,
-      2177, 2641, 3279, 389, 2009, 525, 4085, 3299, 987, 2409, 813, 2683, 373,
-      2695, 3775, 2375, 1119, 2791, 223, 325, 587, 1379, 2877, 2867, 3793, 655,
-      831, 3425, 1663, 1681, 2657, 1865, 3943, 2977, 1979, 2271, 3247, 1267,
-      1747, 811, 159, 429, 2001, 1195, 3065, 553, 1499, 3529, 1081, 2877, 3077,
-      845, 1793, 2409, 3995, 2559, 4081, 1195, 2955, 1117, 1409, 785, 287,
-      1521, 1607, 85, 3055, 3123, 2533, 2329, 3477, 799, 3683, 3715, 337, 3139,
-      3311, 431, 3511, 2299, 365, 2941, 3067, 1331, 1081, 1097, 2853, 2299,
-      495, 1745, 749, 3819, 619, 1059, 3559, 183, 3743, 723, 949, 3501, 733,
-      2599, 3983, 3961, 911, 1899, 985, 2493, 1795, 653, 157, 433, 2361, 3093,
-      3119, 3679, 2367, 1701, 1445, 1321, 2397, 1241, 3305, 3985, 2349, 4067,
-      3805, 3073, 2837, 1567, 3783, 451, 2441, 1181, 487, 543, 1201, 3735,
-      2517, 733, 1535, 2175, 3613, 3019 },
-      { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      2319, 653, 1379, 1675, 1951, 7075, 2087,
-      7147, 1427, 893, 171, 2019, 7235, 5697, 3615, 1961, 7517, 6849, 2893,
-      1883, 2863, 2173, 4543, 73, 381, 3893, 6045, 1643, 7669, 1027, 1549,
-      3983, 1985, 6589, 7497, 2745, 2375, 7047, 1117, 1171, 1975, 5199, 3915,
-      3695, 8113, 4303, 3773, 7705, 6855, 1675, 2245, 2817, 1719, 569, 1021,
-      2077, 5945, 1833, 2631, 4851, 6371, 833, 7987, 331, 1899, 8093, 6719,
-      6903, 5903, 5657, 5007, 2689, 6637, 2675, 1645, 1819, 689, 6709, 7717,
-      6295, 7013, 7695, 3705, 7069, 2621, 3631, 6571, 6259, 7261, 3397, 7645,
-      1115, 4753, 2047, 7579, 2271, 5403, 4911, 7629, 4225, 1209, 6955, 6951,
-      1829, 5579, 5231, 1783, 4285, 7425, 599, 5785, 3275, 5643, 2263, 657,
-      6769, 6261, 1251, 3249, 4447, 4111, 3991, 1215, 131, 4397, 3487, 7585,
-      5565, 7199, 3573, 7105, 7409, 1671, 949, 3889, 5971, 3333, 225, 3647,
-      5403, 3409, 7459, 6879, 5789, 6567, 5581, 4919, 1927, 4407, 8085, 4691,
-      611, 3005, 591, 753, 589, 171, 5729, 5891, 1033, 3049, 6567, 5257, 8003,
-      1757, 4489, 4923, 6379, 5171, 1757, 689, 3081, 1389, 4113, 455, 2761,
-      847, 7575, 5829, 633, 6629, 1103, 7635, 803, 6175, 6587, 2711, 3879, 67,
-      1179, 4761, 7281, 1557, 3379, 2459, 4273, 4127, 7147, 35,
-      3549, 395, 3735, 5787, 4179, 5889, 5057,
-      7473, 4713, 2133, 2897, 1841, 2125, 1029, 1695, 6523, 1143, 5105, 7133,
-      3351, 2775, 3971, 4503, 7589, 5155, 4305, 1641, 4717, 2427, 5617, 1267,
-      399, 5831, 4305, 4241, 3395, 3045, 4899, 1713, 171, 411, 7099, 5473,
-      5209, 1195, 1077, 1309, 2953, 7343, 4887, 3229, 6759, 6721, 6775, 675,
-      4039, 2493, 7511, 3269, 4199, 6625, 7943, 2013, 4145, 667, 513, 2303,
-      4591, 7941, 2741, 987, 8061, 3161, 5951, 1431, 831, 5559, 7405, 1357,
-      4319, 4235, 5421, 2559, 4415, 2439, 823, 1725, 6219, 4903, 6699, 5451,
-      349, 7703, 2927, 7809, 6179, 1417, 5987, 3017, 4983, 3479, 4525, 4643,
-      4911, 227, 5475, 2287, 5581, 6817, 1937, 1421, 4415, 7977, 1789, 3907,
-      6815, 6789, 6003, 5609, 4507, 337, 7427, 7943, 3075, 6427, 1019, 7121,
-      4763, 81, 3587, 2929, 1795, 8067, 2415, 1265, 4025, 5599, 4771, 3025,
-      2313, 6129, 7611, 6881, 5253, 4413, 7869, 105, 3173, 1629, 2537, 1023,
-      4409, 7209, 4413, 7107, 7469, 33, 1955, 2881, 5167, 6451, 4211, 179,
-      5573, 7879, 3387, 7759, 5455, 7157, 1891, 5683, 5689, 6535, 3109, 6555,
-      6873, 1249, 4251, 6437, 49, 2745, 1201, 7327, 4179, 6783, 623, 2779,
-      5963, 2585, 6927, 5333, 4033, 285, 7467, 4443, 4917, 3,
-      4319, 5517, 3449, 813, 5499, 2515, 5771,
-      3357, 2073, 4395, 4925, 2643, 7215, 5817, 1199, 1597, 1619, 7535, 4833,
-      609, 4797, 8171, 6847, 793, 6757, 8165, 3371, 2431, 5235, 4739, 7703,
-      7223, 6525, 5891, 5605, 4433, 3533, 5267, 5125, 5037, 225, 6717, 1121,
-      5741, 2013, 4327, 4839, 569, 5227, 7677, 4315, 2391, 5551, 859, 3627,
-      6377, 3903, 4311, 6527, 7573, 4905, 7731, 1909, 1555, 3279, 1949, 1887,
-      6675, 5509, 2033, 5473, 3539, 5033, 5935, 6095, 4761, 1771, 1271, 1717,
-      4415, 5083, 6277, 3147, 7695, 2461, 4783, 4539, 5833, 5583, 651, 1419,
-      2605, 5511, 3913, 5795, 2333, 2329, 4431, 3725, 6069, 2699, 7055, 6879,
-      1017, 3121, 2547, 4603, 2385, 6915, 6103, 5669, 7833, 2001, 4287, 6619,
-      955, 2761, 5711, 6291, 3415, 3909, 2841, 5627, 4939, 7671, 6059, 6275,
-      6517, 1931, 4583, 7301, 1267, 7509, 1435, 2169, 6939, 3515, 2985, 2787,
-      2123, 1969, 3307, 353, 4359, 7059, 5273, 5873, 6657, 6765, 6229, 3179,
-      1583, 6237, 2155, 371, 273, 7491, 3309, 6805, 3015, 6831, 7819, 713,
-      4747, 3935, 4109, 1311, 709, 3089, 7059, 4247, 2989, 1509, 4919, 1841,
-      3045, 3821, 6929, 4655, 1333, 6429, 6649, 2131, 5265, 1051, 261, 8057,
-      3379, 2179, 1993, 5655, 3063, 6381,
-      3587, 7417, 1579, 1541, 2107, 5085, 2873,
-      6141, 955, 3537, 2157, 841, 1999, 1465, 5171, 5651, 1535, 7235, 4349,
-      1263, 1453, 1005, 6893, 2919, 1947, 1635, 3963, 397, 969, 4569, 655,
-      6737, 2995, 7235, 7713, 973, 4821, 2377, 1673, 1, 6541 }
-    };
+    // Each m_k was extended to 32 terms by the polynomial's recurrence, then shifted up to m_k << (31 - k). The
+    // first dimension is the van der Corput sequence.
+    const uint32_t sobol_directions[sobol_dimensions][32] = {
+      { // 0
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x08000000, 0x04000000, 0x02000000, 0x01000000,
+        0x00800000, 0x00400000, 0x00200000, 0x00100000, 0x00080000, 0x00040000, 0x00020000, 0x00010000,
+        0x00008000, 0x00004000, 0x00002000, 0x00001000, 0x00000800, 0x00000400, 0x00000200, 0x00000100,
+        0x00000080, 0x00000040, 0x00000020, 0x00000010, 0x00000008, 0x00000004, 0x00000002, 0x00000001
+      },
+      { // 1
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x88000000, 0xcc000000, 0xaa000000, 0xff000000,
+        0x80800000, 0xc0c00000, 0xa0a00000, 0xf0f00000, 0x88880000, 0xcccc0000, 0xaaaa0000, 0xffff0000,
+        0x80008000, 0xc000c000, 0xa000a000, 0xf000f000, 0x88008800, 0xcc00cc00, 0xaa00aa00, 0xff00ff00,
+        0x80808080, 0xc0c0c0c0, 0xa0a0a0a0, 0xf0f0f0f0, 0x88888888, 0xcccccccc, 0xaaaaaaaa, 0xffffffff
+      },
+      { // 2
+        0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x68000000, 0xf4000000, 0x86000000, 0x4f000000,
+        0xe8800000, 0xb4400000, 0x66e00000, 0xffb00000, 0x80e80000, 0x40b40000, 0xe0660000, 0xb0ff0000,
+        0x68808000, 0xf4404000, 0x86e0e000, 0x4fb0b000, 0xe8e86800, 0xb4b4f400, 0x66668600, 0xffff4f00,
+        0x80006880, 0x4000f440, 0xe00086e0, 0xb0004fb0, 0x6800e8e8, 0xf400b4b4, 0x86006666, 0x4f00ffff
+      },
+      { // 3
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x38000000, 0xac000000, 0x62000000, 0x93000000,
+        0xdb800000, 0xfd400000, 0x5ae00000, 0x3db00000, 0xb8080000, 0x6c0c0000, 0x820e0000, 0xc3050000,
+        0xe3838000, 0x514ac000, 0x38e62000, 0xaeb93000, 0x6385b800, 0x9143d400, 0xd8ebae00, 0xfeb6db00,
+        0x5b800080, 0x3d4000c0, 0xbae000e0, 0x6db00050, 0x80080038, 0xc00c00ac, 0xe00e0062, 0x50050093
+      },
+      { // 4
+        0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x78000000, 0xcc000000, 0xfa000000, 0x8d000000,
+        0x58800000, 0xbdc00000, 0x21600000, 0x72f00000, 0xd8880000, 0xfdc40000, 0x816a0000, 0x42f30000,
+        0xa08f8000, 0x31c8c000, 0x7b65a000, 0xcffbd000, 0xf80a0800, 0x8c031c00, 0x5a07b600, 0xbd0cff00,
+        0x208f8080, 0x71c8c040, 0xdb65a0a0, 0xfffbd030, 0x800a0878, 0x40031ccc, 0xa007b6fa, 0x300cff8d
+      },
+      { // 5
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x48000000, 0xec000000, 0x32000000, 0x59000000,
+        0xa0800000, 0xd0c00000, 0x68200000, 0xfc100000, 0x7a480000, 0xb5ec0000, 0x92b20000, 0x89990000,
+        0xc8008000, 0x2c00c000, 0x12002000, 0x49001000, 0xe8804800, 0x3cc0ec00, 0x5a203200, 0xa5105900,
+        0xdac8a080, 0x652cd0c0, 0xfa926820, 0x7589fc10, 0xb248fa48, 0x99ec75ec, 0x80b2b2b2, 0xc0999999
+      },
+      { // 6
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xf8000000, 0xbc000000, 0xda000000, 0xad000000,
+        0x5a800000, 0xed400000, 0x3ae00000, 0x9d300000, 0xc2180000, 0x218c0000, 0x18c20000, 0x8c210000,
+        0x42188000, 0x618c4000, 0x78c26000, 0xfc217000, 0xba187800, 0xdd8cfc00, 0xa2c2ba00, 0x5121dd00,
+        0xe0982280, 0x30cc1140, 0x982280e0, 0xcc114030, 0x2280e098, 0x114030cc, 0x80e09822, 0x4030cc11
+      },
+      { // 7
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x48000000, 0xe4000000, 0x56000000, 0x2b000000,
+        0x70800000, 0x1c400000, 0xc8200000, 0x24300000, 0x36180000, 0xbb240000, 0x38920000, 0xf8790000,
+        0x9e358000, 0x0f3ac000, 0x46842000, 0xa7631000, 0xf0800800, 0xdc400c00, 0xa8200600, 0xb4300900,
+        0x7e180480, 0x5f240e40, 0x6e920560, 0xd37902b0, 0xeeb58708, 0x137ac1c4, 0x8ea42c82, 0x83531243
+      },
+      { // 8
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x18000000, 0x8c000000, 0xb2000000, 0x09000000,
+        0x75800000, 0xe8400000, 0xa7a00000, 0xf1700000, 0x2a180000, 0x45040000, 0x27be0000, 0x31570000,
+        0xca0a8000, 0x95114000, 0x3f89e000, 0xbd4c5000, 0x78128800, 0x9c154c00, 0x4a37ee00, 0x551b5d00,
+        0xdf980980, 0x6d4404c0, 0x601e0520, 0x10270d90, 0xf81286d8, 0x5c154644, 0xaa37e15a, 0x851b5f87
+      },
+      { // 9
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0xd8000000, 0xd4000000, 0x8a000000, 0x19000000,
+        0x33800000, 0x99c00000, 0x72200000, 0x3d100000, 0xc1a80000, 0xe4ec0000, 0x13960000, 0x69e50000,
+        0x0a2a8000, 0x593a4000, 0x9392e000, 0x29ff7000, 0xaa280800, 0xe92c0400, 0x4bb60a00, 0xfdf50b00,
+        0x20028d80, 0xf0164d40, 0x7824e8a0, 0x640a7190, 0x522a8b38, 0xcd3a4d9c, 0xb992ed22, 0x80ff78d1
+      },
+      { // 10
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x78000000, 0x4c000000, 0xe2000000, 0x73000000,
+        0xcd800000, 0x27400000, 0xd7a00000, 0xd8700000, 0x58080000, 0x9c340000, 0x3a360000, 0x2f170000,
+        0x57a68000, 0x184fc000, 0xf82be000, 0x8c251000, 0x422e8800, 0x633bcc00, 0xb5bdea00, 0x6b421100,
+        0x35800f80, 0xab4008c0, 0x95a00420, 0xbb700630, 0xed880b58, 0xf77406b4, 0x0f96035a, 0x84670ab7
+      },
+      { // 11
+        0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0xe8000000, 0xcc000000, 0x5e000000, 0x61000000,
+        0x74800000, 0x09c00000, 0xfca00000, 0xb5d00000, 0xaa980000, 0x28dc0000, 0x68220000, 0x8c2f0000,
+        0xbe158000, 0x51274000, 0x9cb0a000, 0xc5e93000, 0xa2958800, 0xd4e74400, 0xde10ae00, 0x21393300,
+        0x948d8680, 0x39fb48c0, 0x1492abe0, 0x79c63510, 0xf48001c8, 0x49c0085c, 0x1ca0042a, 0x85d00e4d
+      },
+      { // 12
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0xa8000000, 0xf4000000, 0x6e000000, 0x13000000,
+        0x1d800000, 0xbe400000, 0xee200000, 0xd3300000, 0xfdb80000, 0xce5c0000, 0x460a0000, 0x270d0000,
+        0x93a38000, 0xdd58c000, 0x5b8d6000, 0x99629000, 0x7db80800, 0x0e5c0c00, 0xa60a0e00, 0x570d0700,
+        0x3ba38a80, 0x2958cf40, 0x358d66e0, 0x8a629130, 0x603809d8, 0xb01c07e4, 0x482a00e2, 0x843d0a33
+      },
+      { // 13
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0xb8000000, 0x94000000, 0xc2000000, 0x61000000,
+        0xb0800000, 0x2a400000, 0x2ee00000, 0x54500000, 0xa0080000, 0xd0040000, 0x98020000, 0x04090000,
+        0x7a0b8000, 0xf5094000, 0x728c2000, 0x4b461000, 0x9e6b0800, 0x7e12a400, 0x8eeaee00, 0x84514500,
+        0x38000080, 0xd4000040, 0xe2000020, 0xf1000090, 0x088000b8, 0xbe400094, 0xece000c2, 0x35500061
+      },
+      { // 14
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x98000000, 0x84000000, 0x06000000, 0xc5000000,
+        0xa4800000, 0xf5c00000, 0x6fa00000, 0xe9b00000, 0xefa80000, 0x29bc0000, 0x8fae0000, 0x79b90000,
+        0x17a78000, 0xfdb14000, 0x11a7e000, 0x38bd1000, 0xb52da800, 0xcd724c00, 0xda8b5200, 0x24ccd700,
+        0x352da880, 0x0d724cc0, 0xba8b5260, 0x74ccd750, 0xad2da818, 0x89724c44, 0xbc8b5266, 0xb1ccd795
+      },
+      { // 15
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x58000000, 0x1c000000, 0x4a000000, 0x65000000,
+        0xe7800000, 0xa4400000, 0xc7e00000, 0x15b00000, 0x4d880000, 0x51440000, 0x18660000, 0x7dfd0000,
+        0x986d8000, 0x3df5c000, 0xf86aa000, 0xedff5000, 0xa065f800, 0xf1f28400, 0xea635e00, 0x94ffcb00,
+        0x0de58080, 0x30b1c040, 0xca0ca060, 0x250250d0, 0x87887858, 0x7447441c, 0x9fe9fe4a, 0x09b09b65
+      },
+      { // 16
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0xc8000000, 0x14000000, 0xa6000000, 0xff000000,
+        0xc0800000, 0xa1c00000, 0x33e00000, 0x18300000, 0xdde80000, 0xb3340000, 0x5b660000, 0x3df90000,
+        0x600a8000, 0x90084000, 0x2808e000, 0xc403b000, 0x6e0ae800, 0xeb04ac00, 0x66855600, 0x5ec46f00,
+        0xf362e880, 0xb9f0ac40, 0xee0356e0, 0xab0d6fd0, 0x86806848, 0x8eccec54, 0x3b6db646, 0xadf7df2f
+      },
+      { // 17
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x38000000, 0x2c000000, 0xce000000, 0x1d000000,
+        0x37800000, 0x91400000, 0x4ba00000, 0xb4100000, 0x53a80000, 0xe81c0000, 0x05a20000, 0x69170000,
+        0xc4218000, 0xc955c000, 0x760d6000, 0xf1041000, 0x59861800, 0x3c410400, 0x4428a200, 0x09514500,
+        0xd6061880, 0x410104c0, 0x6188a2a0, 0x104145b0, 0x8a2e18b8, 0x145d04ec, 0xe18aa26e, 0xd04645ad
+      },
+      { // 18
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x68000000, 0x9c000000, 0x36000000, 0xcb000000,
+        0xed800000, 0x7e400000, 0x66600000, 0xb0500000, 0x2be80000, 0xbe140000, 0x058a0000, 0xa2470000,
+        0x70648000, 0x4b5ac000, 0xae6de000, 0x5c517000, 0x55e7b800, 0xd91c5400, 0xb6043e00, 0x8b022100,
+        0xcd833880, 0x4e469440, 0x0e69de20, 0x2c535130, 0x1de480e8, 0x751ac0dc, 0xe80de016, 0xdc0170fb
+      },
+      { // 19
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x88000000, 0xfc000000, 0x1a000000, 0x41000000,
+        0xe1800000, 0xd0400000, 0x79e00000, 0x75100000, 0xe7f80000, 0x5b340000, 0xa0020000, 0x30030000,
+        0xa8008000, 0x0c03c000, 0x92022000, 0xbd03f000, 0xfb806800, 0x91410400, 0x98638600, 0xa5534100,
+        0x9e19e780, 0x2e25d440, 0x47f99fe0, 0x6b366cd0, 0x08000008, 0x3c00000c, 0x3a000002, 0xb100000f
+      },
+      { // 20
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x08000000, 0xec000000, 0x42000000, 0xc3000000,
+        0x83800000, 0x22c00000, 0x72600000, 0x7a700000, 0x97a80000, 0xd52c0000, 0x17aa0000, 0x952d0000,
+        0xb7a88000, 0xc52c4000, 0xbfa8a000, 0x292ff000, 0xfda9a800, 0xea2cfc00, 0x7e2ba600, 0xc8ec7700,
+        0x0c4a6f80, 0xb29d9ec0, 0x9be03120, 0x67b2ca70, 0x8c4a6f88, 0xf29d9ec4, 0x3be0312a, 0x37b2ca75
+      },
+      { // 21
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0xc8000000, 0x44000000, 0xe6000000, 0xb1000000,
+        0x09800000, 0x24c00000, 0xd6600000, 0x78900000, 0x4d080000, 0xc30c0000, 0x66020000, 0x71030000,
+        0x69818000, 0x14c0c000, 0x1e632000, 0x3c911000, 0xab0b9800, 0x720ec400, 0x6f822600, 0x55c39300,
+        0xbfe2d980, 0x6c512240, 0x536a1420, 0xff9e1c30, 0xcd080008, 0x030c000c, 0x06020006, 0x41030003
+      },
+      { // 22
+        0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0xe8000000, 0x3c000000, 0x52000000, 0x69000000,
+        0x7c800000, 0xb3c00000, 0x98e00000, 0x95500000, 0x8fb80000, 0xca440000, 0xfc820000, 0xf3c10000,
+        0x78e38000, 0x6553c000, 0x67bba000, 0xf644f000, 0xae834800, 0x9ac0a400, 0x04627200, 0xd6910f00,
+        0xff59c380, 0x6316a540, 0x213976e0, 0x50878d10, 0xf8e38008, 0x2553c004, 0x87bba00e, 0x0644f00f
+      },
+      { // 23
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x18000000, 0x5c000000, 0x9e000000, 0x11000000,
+        0x89800000, 0x14400000, 0xaae00000, 0xcb300000, 0x5a380000, 0x13fc0000, 0x26020000, 0xfd030000,
+        0x2f808000, 0x2941c000, 0xa5606000, 0x92717000, 0xe75a7800, 0xdd8c4400, 0x5f582600, 0x318f5100,
+        0xf9582b80, 0x0c8decc0, 0xf6db88e0, 0x55cffff0, 0x4bb80008, 0x9bbc000c, 0x32e20002, 0x57330007
+      },
+      { // 24
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0xf8000000, 0x74000000, 0x22000000, 0x2f000000,
+        0xb8800000, 0x54400000, 0x52e00000, 0x47d00000, 0x35980000, 0x02ec0000, 0x5ffa0000, 0xd17f0000,
+        0xd8818000, 0x04414000, 0x4ae06000, 0xa3d39000, 0xef9b6800, 0x59ed6c00, 0xc5786a00, 0xaa3eed00,
+        0x32e22980, 0x17d10e40, 0x2d99fde0, 0xe6ee84f0, 0x85f8c188, 0x8a7d224c, 0x4201f7ee, 0x7f03f9f9
+      },
+      { // 25
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x58000000, 0x0c000000, 0x3a000000, 0xa9000000,
+        0xc4800000, 0xcf400000, 0x4ea00000, 0x0f300000, 0xaed80000, 0x7f140000, 0x26820000, 0x2a410000,
+        0x10228000, 0xb9734000, 0x7cf96000, 0xb3643000, 0xfcfae800, 0xf367a400, 0x5cfb9200, 0x23657d00,
+        0x04f8da80, 0x2f664cc0, 0x3efbb360, 0x86652850, 0xfa7a8008, 0x49274004, 0xb4db600a, 0x4615300d
+      },
+      { // 26
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x28000000, 0x54000000, 0xee000000, 0x6d000000,
+        0xd2800000, 0xf7400000, 0xc0a00000, 0x60900000, 0xb1c80000, 0xb8ac0000, 0x7c220000, 0xbad10000,
+        0x83e88000, 0xbf7e4000, 0x254aa000, 0x36ec5000, 0xa0013800, 0xd002f400, 0x08036a00, 0xc400cd00,
+        0xc6001a80, 0x39016640, 0x3c823520, 0x9a408bb0, 0x1221b808, 0x97d0b404, 0x716bca02, 0xd83d9d09
+      },
+      { // 27
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xb8000000, 0x34000000, 0x96000000, 0x95000000,
+        0xa6800000, 0x5dc00000, 0x3aa00000, 0x46b00000, 0x0dc80000, 0xe21c0000, 0x62a20000, 0x22b10000,
+        0x43c98000, 0x531c4000, 0xea20e000, 0xde71d000, 0x49ebd800, 0xdd6e1400, 0x7bca7a00, 0x271ca700,
+        0x1c213280, 0x5b720ec0, 0x5769cd20, 0xb4ae6f70, 0xd76bd808, 0xf4ae1404, 0xb76a7a06, 0xe4aca701
+      },
+      { // 28
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xd8000000, 0x7c000000, 0x92000000, 0x8f000000,
+        0x6c800000, 0xda400000, 0x7ba00000, 0xea500000, 0x62080000, 0x77fc0000, 0x41aa0000, 0x21af0000,
+        0x51a18000, 0x6951c000, 0xa488e000, 0xeebf3000, 0x1c8b2800, 0xe2bccc00, 0xb68a7a00, 0xa1bc9500,
+        0x900abc80, 0x88fcf040, 0x1528cea0, 0x37ec7ab0, 0x60019488, 0x70003c4c, 0x3802b4ae, 0xcc00efbb
+      },
+      { // 29
+        0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x98000000, 0x64000000, 0xd2000000, 0xd5000000,
+        0xea800000, 0x20c00000, 0xd0600000, 0x08f00000, 0x8c280000, 0x2e940000, 0x62620000, 0xedf10000,
+        0x1eab8000, 0x1a55c000, 0xf8006000, 0x54009000, 0xaa00c800, 0xc1029400, 0xa081ca00, 0x91c11300,
+        0xe8e00980, 0xfd3377c0, 0xb6c99aa0, 0x06a43950, 0x3e28c808, 0xcb969404, 0xf0e3ca0e, 0xd9301307
+      },
+      { // 30
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xa8000000, 0x24000000, 0x0e000000, 0x07000000,
+        0xb2800000, 0x34c00000, 0x47600000, 0x52b00000, 0x45380000, 0xbec40000, 0xdfba0000, 0x6e070000,
+        0xb6da8000, 0x6bb64000, 0xe9602000, 0xc5b2d000, 0x7fba1800, 0xfe05cc00, 0x3eda5200, 0x1fb75f00,
+        0x4f616f80, 0xe6b3c5c0, 0xc338e360, 0xcdc6b2d0, 0xcb3bef88, 0x79c585cc, 0x4d38c362, 0x0ac462d5
+      },
+      { // 31
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x28000000, 0xc4000000, 0x76000000, 0xfd000000,
+        0x0a800000, 0xb7400000, 0x9c600000, 0xda900000, 0x6f280000, 0x70dc0000, 0x68e20000, 0xe4d10000,
+        0x87c88000, 0xd40fc000, 0xcf2aa000, 0xc0de1000, 0x60e35800, 0xd0d13400, 0xd9c80a00, 0xed0e0d00,
+        0xb3a90980, 0x8a9e8e40, 0xf602cea0, 0xbd022a70, 0x2a83d808, 0x4742f404, 0xb460aa02, 0x1e911d0f
+      },
+      { // 32
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x08000000, 0x84000000, 0x82000000, 0xbf000000,
+        0x60800000, 0xf1c00000, 0x38600000, 0x9c300000, 0x0f180000, 0xb90c0000, 0x5dfa0000, 0x2fff0000,
+        0xa8028000, 0x54034000, 0xaa00a000, 0x2b025000, 0xea822800, 0xcac0ec00, 0xdae38a00, 0xd2f13b00,
+        0x57f96380, 0xd4fdb7c0, 0x6a82dde0, 0x0ac394f0, 0xfae1cb88, 0xc2f21bcc, 0x5ffbf7e2, 0x50fffff1
+      },
+      { // 33
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x88000000, 0x4c000000, 0x2a000000, 0x9b000000,
+        0x72800000, 0x6fc00000, 0x3c200000, 0x62300000, 0x76280000, 0xa8bc0000, 0x7c2a0000, 0x03bf0000,
+        0x26a88000, 0xd07cc000, 0xb88aa000, 0x654df000, 0x96220800, 0x39339c00, 0xa4a9c200, 0x377d2300,
+        0xc809b280, 0x2d8c6bc0, 0x7a80ca20, 0xe3c03930, 0xb621b288, 0x09306bcc, 0x8caaca2a, 0x8b7f393f
+      },
+      { // 34
+        0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x68000000, 0x74000000, 0x06000000, 0xaf000000,
+        0x7b800000, 0x2c400000, 0x5a200000, 0x3d700000, 0x63d80000, 0x90f40000, 0x785a0000, 0x4cb50000,
+        0xaa798000, 0xb5c7c000, 0xa7a02000, 0xfe321000, 0xa27a3800, 0x31c5ac00, 0x29a25600, 0x9532dd00,
+        0xb7fb1e80, 0xc68438c0, 0x0e02a9e0, 0x2b02d710, 0xf5829e88, 0x4743f8c4, 0x4fa289ee, 0xca30c71b
+      },
+      { // 35
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x38000000, 0x2c000000, 0xe2000000, 0x3f000000,
+        0x94800000, 0x0e400000, 0x3c600000, 0xfb500000, 0xa2e80000, 0x1fbc0000, 0x248a0000, 0x67ef0000,
+        0x28e18000, 0x35124000, 0x7e8b6000, 0xb4edf000, 0xbe616800, 0x54534c00, 0xee6a5a00, 0x6dfd8500,
+        0xc2e84380, 0x8fbc6440, 0xfc887220, 0x1bed2fb0, 0xf2e12b88, 0x2613284c, 0x0808282e, 0x85afaab5
+      },
+      { // 36
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x78000000, 0x4c000000, 0x7a000000, 0x2f000000,
+        0x49800000, 0x75c00000, 0x96200000, 0xe4900000, 0x1ee80000, 0x702c0000, 0x994a0000, 0x5d7d0000,
+        0xb3808000, 0x1ac3c000, 0x7fa36000, 0x2153f000, 0xf0c80800, 0xd8bd8c00, 0xfda2ce00, 0x02506b00,
+        0x6349fe80, 0x327c8540, 0x5a01c320, 0xdf0262f0, 0x91817688, 0x89c2c944, 0x94206d2a, 0x8791f9fb
+      },
+      { // 37
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x48000000, 0x6c000000, 0xb2000000, 0x07000000,
+        0xf8800000, 0x74400000, 0xb6200000, 0xc9100000, 0x05c80000, 0xe7ac0000, 0x88520000, 0x0c770000,
+        0x82808000, 0x5f404000, 0xdca02000, 0xaa501000, 0x03684800, 0x36fc6c00, 0x89bab200, 0x25cb0700,
+        0xf79a7880, 0xc0db3440, 0x60521620, 0x30779910, 0x5880edc8, 0x2440dbac, 0xde205252, 0xb5107777
+      },
+      { // 38
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xf8000000, 0x3c000000, 0x5a000000, 0x17000000,
+        0x1e800000, 0x31400000, 0x33e00000, 0x48b00000, 0xe4d80000, 0x762c0000, 0xc5d20000, 0xcd530000,
+        0x49b88000, 0x4fdc4000, 0x72ea6000, 0x83cf7000, 0x90b27800, 0xc8a37c00, 0xa480ba00, 0x16402700,
+        0xb5608680, 0x35f07d40, 0x753891e0, 0x159c63b0, 0x658aa058, 0x9d3f506c, 0xa10a68b2, 0xfb7ff4a3
+      },
+      { // 39
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xc8000000, 0x64000000, 0xd6000000, 0x27000000,
+        0xb4800000, 0xbec00000, 0xb3600000, 0x3a100000, 0x35080000, 0xb5840000, 0x75060000, 0x15cf0000,
+        0x85608000, 0x4d10c000, 0x29886000, 0xff449000, 0xd866c800, 0x6cdf6400, 0xd2e85600, 0x6154e700,
+        0x5b6ed480, 0x6e5b2ec0, 0xdb6efb60, 0xae5b9e10, 0xbb6e0308, 0x3e5bc284, 0x736ee986, 0x5a5b9f0f
+      },
+      { // 40
+        0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x18000000, 0xfc000000, 0x2a000000, 0xd9000000,
+        0xec800000, 0x02400000, 0xdde00000, 0x4af00000, 0xe9580000, 0x149c0000, 0x8e1a0000, 0xef210000,
+        0x6fe08000, 0x2ff04000, 0xcfd8e000, 0xbfdc7000, 0xa77a1800, 0x5b91fc00, 0x7158aa00, 0xa89c9900,
+        0x441a0c80, 0x46217240, 0x9b6045e0, 0xd1b0f6f0, 0x38382358, 0x2c2cbd9c, 0xa2a27a9a, 0x4d4d1161
+      },
+      { // 41
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x28000000, 0xdc000000, 0x8e000000, 0x8d000000,
+        0xde800000, 0x15c00000, 0x8a200000, 0x37b00000, 0xa1080000, 0xb8ec0000, 0xe4c60000, 0xaa810000,
+        0x87088000, 0x29ecc000, 0x1446a000, 0x42417000, 0xfba8a800, 0xd79c1c00, 0xb16e2e00, 0x401dfd00,
+        0x60e67680, 0xd03109c0, 0x58802420, 0xf4c00ab0, 0x52a0f788, 0x0370012c, 0x53a8c8e6, 0xcb9ccc31
+      },
+      { // 42
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0xb8000000, 0x44000000, 0x9e000000, 0x1b000000,
+        0x56800000, 0x17400000, 0x84200000, 0x7e500000, 0xab180000, 0xfed40000, 0xeb660000, 0x5e7f0000,
+        0xfb988000, 0xe6944000, 0xbfc6a000, 0x786f1000, 0xa4203800, 0x2e500400, 0xb3183e00, 0xaad40b00,
+        0xcd66ee80, 0x017f5340, 0x33189a20, 0xead42550, 0x6d665d98, 0x117ff994, 0x8b185746, 0xaed4242f
+      },
+      { // 43
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x38000000, 0xfc000000, 0x26000000, 0x35000000,
+        0x1a800000, 0xf3400000, 0x7f200000, 0x21300000, 0x48580000, 0x84ec0000, 0x7a4e0000, 0xe3010000,
+        0x17788000, 0x15dc4000, 0xaa16a000, 0x6bedf000, 0x7336b800, 0x3fddbc00, 0x81ee0600, 0xb8718500,
+        0xbc800280, 0x8640bf40, 0xc5a0c120, 0x22701830, 0x0f784cd8, 0x59dcbeac, 0x141639ee, 0x52ed0471
+      },
+      { // 44
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x18000000, 0xc4000000, 0x8e000000, 0xb5000000,
+        0xaa800000, 0x8b400000, 0x67e00000, 0x15300000, 0x7ab80000, 0x03140000, 0x4b860000, 0x47590000,
+        0x85588000, 0x92244000, 0xdf3e6000, 0x014df000, 0x7c5e9800, 0x9a3d8400, 0xb3866e00, 0x33590500,
+        0x73585280, 0x1324ff40, 0xe3be91e0, 0xfb0d9430, 0x3f3ec638, 0xb14db954, 0x045ee8e6, 0xae3ddc29
+      },
+      { // 45
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x88000000, 0x4c000000, 0x7a000000, 0xa9000000,
+        0x46800000, 0x9bc00000, 0xc3e00000, 0x57b00000, 0x79a80000, 0x9e9c0000, 0xcfa20000, 0x8d7d0000,
+        0x40488000, 0xa02cc000, 0x908a6000, 0x7821f000, 0xc40a0800, 0x36e18c00, 0xd36a9a00, 0xef919900,
+        0xdda22e80, 0x587de7c0, 0x94c8d1e0, 0x2eec82b0, 0xe7eaad28, 0x5151105c, 0x42c238c2, 0xcd0d640d
+      },
+      { // 46
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xb8000000, 0xa4000000, 0x52000000, 0x23000000,
+        0x03800000, 0x73400000, 0x7b200000, 0xb7f00000, 0xf9480000, 0x2cec0000, 0x5e3e0000, 0x0ddd0000,
+        0x063e8000, 0xb9ddc000, 0x8c3ee000, 0xeedd1000, 0x65be5800, 0x1a9db400, 0x4f1e0a00, 0xfd2d9700,
+        0xcef60980, 0x1571e440, 0x12a072a0, 0x83b053b0, 0xb3e80be8, 0x1b5cbf5c, 0x67d635d6, 0x41816281
+      },
+      { // 47
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x18000000, 0xec000000, 0x72000000, 0x0f000000,
+        0x9f800000, 0xf7c00000, 0x23e00000, 0x8dd00000, 0xe8c80000, 0x94a40000, 0x8e960000, 0x55b90000,
+        0x64968000, 0xf6b94000, 0xa916a000, 0x3e797000, 0x0d76b800, 0xa8699c00, 0xb45eca00, 0xbe1d9300,
+        0x4d805580, 0x88c064c0, 0x8460f660, 0xa610a910, 0xa1283ea8, 0xfa740db4, 0x8bdea83e, 0x39ddb40d
+      },
+      { // 48
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x18000000, 0x0c000000, 0xf2000000, 0xcf000000,
+        0x73800000, 0x59400000, 0xba600000, 0x0bd00000, 0x85880000, 0x40640000, 0xe0060000, 0x10210000,
+        0x28668000, 0x14f1c000, 0xfe6ea000, 0x3dd5f000, 0xbc08b800, 0x2a24fc00, 0xe3e6ca00, 0xb1b1f300,
+        0x8e0e1980, 0xc5055a40, 0xa0009be0, 0xf0006d90, 0x38007468, 0x3c002ef4, 0xea0035ee, 0xc3009895
+      },
+      { // 49
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0xa8000000, 0xe4000000, 0xae000000, 0x2d000000,
+        0xc3800000, 0x8e400000, 0x1d600000, 0xcbd00000, 0x9a180000, 0x1b2c0000, 0x029a0000, 0xf71b0000,
+        0xb8828000, 0xdc37c000, 0xb2182000, 0x3f2c3000, 0x0c9a0800, 0x2a1b1400, 0xd3028600, 0xb6770900,
+        0x01784d80, 0xd9fc9340, 0x5502d6e0, 0xbf775190, 0xccf80178, 0x8abcd9fc, 0x23e25502, 0x1ee7bf77
+      },
+      { // 50
+        0x80000000, 0x40000000, 0x20000000, 0x50000000, 0xc8000000, 0x84000000, 0xee000000, 0xf7000000,
+        0xa9800000, 0xa6c00000, 0x33600000, 0x67f00000, 0x01580000, 0x52ac0000, 0x455a0000, 0xdc210000,
+        0xc2028000, 0xed8d4000, 0x28d8a000, 0xb46c1000, 0x563ae800, 0xebd1d400, 0x0b5aa600, 0x3b213300,
+        0x8382e780, 0x9f4d41c0, 0x3db8f2e0, 0xa09c5530, 0x10e23438, 0xe8bd165c, 0xd4e04b82, 0x26301b4d
+      },
+      { // 51
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0xc8000000, 0xc4000000, 0x6e000000, 0xb9000000,
+        0xf3800000, 0xd4c00000, 0xe6600000, 0x5db00000, 0x0dd80000, 0xa5cc0000, 0xd14a0000, 0xe7a70000,
+        0x52f28000, 0x0bdb4000, 0x0860a000, 0xa4b0d000, 0xde58e800, 0xe10c5400, 0xff2aa600, 0x7e177d00,
+        0x312a1d80, 0x17172dc0, 0x2aaab5e0, 0x97d75970, 0x6aca83b8, 0xb767ec7c, 0xfa92da92, 0x7f6bef6b
+      },
+      { // 52
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0xb8000000, 0xd4000000, 0xaa000000, 0x75000000,
+        0x93800000, 0x28400000, 0x7c600000, 0x16d00000, 0xc3c80000, 0x20ec0000, 0xb0be0000, 0x187f0000,
+        0xa4968000, 0x1203c000, 0xa1802000, 0x3940b000, 0x5de01800, 0xef90a400, 0x3e281200, 0xbf7ca100,
+        0x36963980, 0x73035d40, 0x38006fe0, 0x1400fe90, 0x0a001fa8, 0x0500463c, 0x2b80cb76, 0xfc40ec93
+      },
+      { // 53
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x58000000, 0xe4000000, 0xf2000000, 0x29000000,
+        0x75800000, 0xd8400000, 0x24600000, 0x92300000, 0xf9680000, 0x2dac0000, 0x3c320000, 0xd6190000,
+        0xbb248000, 0x8cd2c000, 0xf5802000, 0x18403000, 0x44601800, 0x42303400, 0xa1681600, 0xc9ac3900,
+        0xce323c80, 0xff190a40, 0xcea49d60, 0x5492f610, 0xd1e02918, 0x8a70148c, 0xbd08265a, 0x6f9c3f6b
+      },
+      { // 54
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x98000000, 0xe4000000, 0xee000000, 0x51000000,
+        0x99800000, 0x68400000, 0x5c200000, 0x5a300000, 0x17180000, 0xb4cc0000, 0xfbb20000, 0x8b170000,
+        0xceb88000, 0xbca4c000, 0x97802000, 0x49401000, 0x3da01800, 0xe6700c00, 0x3d382600, 0x5bfc3900,
+        0x9b2a3b80, 0x069b1440, 0xf0aaa660, 0x05c3da10, 0x1200b708, 0x1b18c68c, 0x468a3dc6, 0x90eb3133
+      },
+      { // 55
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x18000000, 0x9c000000, 0x16000000, 0xdf000000,
+        0xf7800000, 0x1c400000, 0xd6600000, 0xbf300000, 0x87b80000, 0x044c0000, 0x4a2e0000, 0xa93b0000,
+        0x58d78000, 0xf3b7c000, 0x56602000, 0x7f303000, 0xe7b81800, 0x744c1c00, 0x522e0600, 0x353b2700,
+        0x4ed78580, 0x2cb7f7c0, 0xa1e01de0, 0x63703710, 0x31d82d98, 0xcb7c33cc, 0xd59627ee, 0x31772613
+      },
+      { // 56
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x58000000, 0x54000000, 0x2e000000, 0x97000000,
+        0xd0800000, 0xe4400000, 0xe6600000, 0xfb300000, 0xfaa80000, 0x056c0000, 0xf5ca0000, 0xe1e70000,
+        0x6fc38000, 0xc8d44000, 0x10602000, 0xf8303000, 0x64281800, 0x262c1400, 0x9b2a1600, 0xaa971500,
+        0x5d0b8b80, 0xa18865c0, 0xcf821420, 0xf8fb0910, 0x1841a198, 0xf42f6acc, 0x1e2188aa, 0x9f1f645b
+      },
+      { // 57
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xf8000000, 0x1c000000, 0x7a000000, 0x51000000,
+        0x1c800000, 0xa4400000, 0x86600000, 0xbb100000, 0x05d80000, 0x5cbc0000, 0x442e0000, 0x164d0000,
+        0xf3608000, 0xe1aa4000, 0x3ae02000, 0x6f503000, 0x5bb80800, 0x4bac2c00, 0xc3f63e00, 0x07f10700,
+        0xd1ce9e80, 0x02a75440, 0x5360a720, 0x91aa5910, 0xe2e00998, 0xc35032c4, 0xd9b83776, 0x06ac3c2f
+      },
+      { // 58
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x38000000, 0xd4000000, 0x16000000, 0xbd000000,
+        0x4b800000, 0x3e400000, 0x11200000, 0xe9b00000, 0x05080000, 0xdfbc0000, 0x481a0000, 0x3c630000,
+        0x9a728000, 0xef07c000, 0xd8882000, 0x1cfc1000, 0x72ba1800, 0x7b932400, 0xb65a8e00, 0x0d0bf500,
+        0x839a2580, 0x42233f40, 0xeb528ae0, 0x96b7eb90, 0xe5802a48, 0x17401f6c, 0x2ca01cc2, 0xfaf03caf
+      },
+      { // 59
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x48000000, 0x24000000, 0x46000000, 0x3d000000,
+        0x09800000, 0xbe400000, 0x61600000, 0xd3f00000, 0xb9480000, 0x7fc40000, 0x3b220000, 0x14cb0000,
+        0x478a8000, 0x873ec000, 0xdec82000, 0x08843000, 0xbdc23800, 0x707b0400, 0x98229200, 0x8c4ac900,
+        0x72423180, 0x333b3f40, 0x10c2ba60, 0xf1faeb90, 0xe26a2a58, 0xbb0f0dfc, 0xd4a887d2, 0xa7f5d4b1
+      },
+      { // 60
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x28000000, 0xdc000000, 0x42000000, 0x5f000000,
+        0x3b800000, 0x8e400000, 0x75200000, 0x18d00000, 0x67880000, 0x8c740000, 0x8a1e0000, 0xb3390000,
+        0xc1f38000, 0x2527c000, 0xd0a82000, 0x8ba41000, 0x76162800, 0x210d2400, 0x16cd8a00, 0x52cef700,
+        0x34d3b080, 0x7df7c7c0, 0x172006e0, 0x97d01790, 0xd4083f48, 0x4e341534, 0x953e0362, 0x28e903dd
+      },
+      { // 61
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x88000000, 0x3c000000, 0x56000000, 0xb9000000,
+        0xbb800000, 0xda400000, 0x57600000, 0x46f00000, 0x93c80000, 0xd6640000, 0x790e0000, 0x5bd30000,
+        0xca508000, 0xdf67c000, 0x7aa82000, 0xc5943000, 0x6f463800, 0xc2f70400, 0x81bea200, 0x9d04cf00,
+        0x99d0b580, 0xe927de40, 0x13c836e0, 0x16640290, 0x990e0fd8, 0x4bd31abc, 0x42509372, 0xe367d4d9
+      },
+      { // 62
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xb8000000, 0xec000000, 0xd6000000, 0x17000000,
+        0xe1800000, 0x22400000, 0x5d200000, 0xa8b00000, 0xd0e80000, 0x1cbc0000, 0xfaa60000, 0x05930000,
+        0xb02f8000, 0xa862c000, 0x34482000, 0x6a4c1000, 0x796e1800, 0x1a9f1400, 0x15e1ae00, 0x680dfb00,
+        0x14619580, 0x5a4dd5c0, 0x91418060, 0x4efdcc90, 0x2fa98148, 0xa941d52c, 0xe28f97ba, 0x9992fdef
+      },
+      { // 63
+        0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x88000000, 0x4c000000, 0xe2000000, 0x49000000,
+        0x1b800000, 0x36400000, 0x5f200000, 0x94f00000, 0xbaf80000, 0x51a40000, 0xe3360000, 0xbe990000,
+        0x5fe88000, 0xd837c000, 0x14582000, 0xb6141000, 0x1f6e3800, 0x748d1c00, 0xca86a200, 0xd9bad300,
+        0xaf5e9880, 0x5ceec240, 0x16909ee0, 0xc3d3c190, 0x224e2dc8, 0xe97d3a3c, 0x8bfe8c3e, 0xce5ec929
+      },
+      { // 64
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x88000000, 0xc4000000, 0xca000000, 0x71000000,
+        0xe0800000, 0x11400000, 0xd0e00000, 0x69500000, 0x4c880000, 0xef140000, 0x33ea0000, 0xb4f10000,
+        0xb3128000, 0x95a14000, 0x1bea2000, 0x60f13000, 0xd1128800, 0xf0a17400, 0xb96a0200, 0xc4b10100,
+        0x2b72ba80, 0xf9b16840, 0xc5823a20, 0x53b50550, 0x84f08eb8, 0xcb047214, 0x09f2a902, 0x9df17e95
+      },
+      { // 65
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xc8000000, 0x7c000000, 0x3a000000, 0xef000000,
+        0xfa800000, 0xc7400000, 0xd6e00000, 0x55700000, 0xd5a80000, 0x5d940000, 0x81d60000, 0x4be90000,
+        0xfc918000, 0xb25c4000, 0x33562000, 0x30a93000, 0x70719800, 0x982c6400, 0xd47e1200, 0xd67d2f00,
+        0x1d479680, 0x69b55fc0, 0x07c7aca0, 0xfef55ed0, 0x79278338, 0x47857a9c, 0x5e8f81ca, 0x89116db5
+      },
+      { // 66
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x68000000, 0x0c000000, 0xae000000, 0x55000000,
+        0x1a800000, 0x99400000, 0x94a00000, 0x3c700000, 0x76680000, 0xc1040000, 0x40ce0000, 0x06230000,
+        0x790c8000, 0x44ea4000, 0x346e2000, 0xea531000, 0x07649800, 0x19ee6400, 0xb2a03a00, 0xb5701300,
+        0xcae83380, 0x91443140, 0x08ee1ca0, 0xfa132550, 0x2f448ea8, 0x75de5a5c, 0x8ce83b3a, 0x88440611
+      },
+      { // 67
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x58000000, 0x9c000000, 0xee000000, 0x09000000,
+        0x5c800000, 0xb5400000, 0xe2a00000, 0x44100000, 0x32280000, 0x477c0000, 0x45c60000, 0xb19b0000,
+        0xcbaa8000, 0x48e94000, 0x7f662000, 0x298b1000, 0xb782a800, 0x16954400, 0x3e203600, 0xb1503700,
+        0x70881380, 0x136c0640, 0x2fee0120, 0x6ae70a50, 0x606c8328, 0xf0725344, 0xe84cbbaa, 0xd4226c8f
+      },
+      { // 68
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xf8000000, 0x14000000, 0xc2000000, 0xc9000000,
+        0x9e800000, 0x4d400000, 0xb4a00000, 0x38500000, 0x74180000, 0x926c0000, 0x41320000, 0x729d0000,
+        0x9b2e8000, 0xbf8e4000, 0x6f922000, 0xa7cd1000, 0x6bb68800, 0xcda25c00, 0x3e801e00, 0x7d401500,
+        0x6ca03880, 0x5c502e40, 0x4e1819a0, 0x4f6c1650, 0x1db21da8, 0xf6dd3c54, 0xb10ebaa6, 0xca9e77cb
+      },
+      { // 69
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0xd8000000, 0x14000000, 0x3a000000, 0x53000000,
+        0x08800000, 0x3f400000, 0x36a00000, 0xde700000, 0x91380000, 0x1fdc0000, 0xe5d20000, 0x96910000,
+        0xce738000, 0x19114000, 0xe3f22000, 0x13a11000, 0xebeb9800, 0xafbd4c00, 0x7d981600, 0xe2ac1500,
+        0xc46a1680, 0x920d18c0, 0xff01b420, 0x16f04ad0, 0x8e39a328, 0x792c735c, 0xd3eb9e6e, 0xcbbd5427
+      },
+      { // 70
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x98000000, 0xa4000000, 0x22000000, 0x35000000,
+        0x0a800000, 0x79400000, 0x84e00000, 0xf2100000, 0x6d480000, 0x0e9c0000, 0x0b3a0000, 0x29bd0000,
+        0x5cd88000, 0x361c4000, 0xbf5a2000, 0xf3ed3000, 0x3df0a800, 0xd6d05400, 0xcf480600, 0xfb9c1900,
+        0xa1ba2080, 0x00fd1940, 0x4038a4a0, 0x600c7750, 0xf01209b8, 0xc87101c4, 0x3c4ab1f2, 0x862d49f7
+      },
+      { // 71
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x88000000, 0x24000000, 0xb2000000, 0xb7000000,
+        0xf3800000, 0x75400000, 0x3ca00000, 0x9a900000, 0x47e80000, 0x0f740000, 0x0fea0000, 0xcb050000,
+        0x0da58000, 0xe466c000, 0x52022000, 0x07711000, 0x6bcfa800, 0xd923c400, 0xaa878200, 0x9fc7d900,
+        0x0305a480, 0x89f6f9c0, 0x466a16e0, 0x6d450050, 0xd085a9a8, 0xacb6c664, 0x52ca039a, 0xc3d52a4d
+      },
+      { // 72
+        0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0xb8000000, 0x4c000000, 0x0a000000, 0xcb000000,
+        0x06800000, 0xf9400000, 0xc1a00000, 0x15b00000, 0x43b80000, 0x6acc0000, 0xe36e0000, 0xe2d10000,
+        0x57778000, 0x44844000, 0x26562000, 0x315d1000, 0x95b9b800, 0x03e56c00, 0x8a998e00, 0x53154300,
+        0x5a819a80, 0x1b694ec0, 0x4ed7b7a0, 0xed345150, 0x37ee04e8, 0x6c9118ac, 0xc25785ce, 0x9f746923
+      },
+      { // 73
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x38000000, 0x24000000, 0xfe000000, 0x5b000000,
+        0xad800000, 0x6d400000, 0xcae00000, 0x4ab00000, 0x8af80000, 0x6acc0000, 0xda9a0000, 0xe2eb0000,
+        0xc6ab8000, 0x38afc000, 0x63e22000, 0xce673000, 0xa351b800, 0x69b4ec00, 0x2351ae00, 0xa9b4f900,
+        0xc351a780, 0x19b4cac0, 0xfb51bd60, 0x3db4ce50, 0x05519b38, 0x66b4d16c, 0xa8d1a05e, 0x0bf4c223
+      },
+      { // 74
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x28000000, 0xe4000000, 0xb2000000, 0x95000000,
+        0xc4800000, 0x8b400000, 0x97a00000, 0xa0b00000, 0x79080000, 0xe2c40000, 0xb42a0000, 0xda050000,
+        0x915c8000, 0xa6a14000, 0x36022000, 0xb7311000, 0x99deb800, 0x7bd07400, 0x86fcaa00, 0x46116900,
+        0xaf0a3480, 0x85f50140, 0x05f48320, 0x45d56fd0, 0xa5a02368, 0x75b0246c, 0x5d883be2, 0xb9840b21
+      },
+      { // 75
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x58000000, 0x64000000, 0xee000000, 0x65000000,
+        0x07800000, 0x47400000, 0xf0a00000, 0x8fd00000, 0x4b580000, 0x029c0000, 0x10da0000, 0x9f830000,
+        0x435c8000, 0x4ecec000, 0xc2a22000, 0x708f1000, 0xcffe8800, 0x6b41dc00, 0x72dcb600, 0x488ec900,
+        0xfb821380, 0xad1f1540, 0x2b869fe0, 0xc54dd4d0, 0x37feb1a8, 0x3f41f3b4, 0xe4dc80b6, 0x398ec437
+      },
+      { // 76
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x98000000, 0x04000000, 0xea000000, 0x0d000000,
+        0xc3800000, 0x9bc00000, 0xffe00000, 0x45f00000, 0xa0c80000, 0xff040000, 0x8ac60000, 0x92530000,
+        0x19258000, 0xe1cc4000, 0x7aa5a000, 0x4a0c5000, 0x3d45a800, 0x7bfc4c00, 0xef8d8e00, 0x8df84d00,
+        0x4ccbb480, 0x896b4e40, 0x698e0460, 0xb69728b0, 0x4c039b98, 0x466f69cc, 0x5b481baa, 0x50c41a0d
+      },
+      { // 77
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x98000000, 0x3c000000, 0xce000000, 0x6f000000,
+        0x99800000, 0xe1c00000, 0x8da00000, 0xbb900000, 0x78d80000, 0xb7140000, 0x05ca0000, 0xdf8d0000,
+        0xeaea8000, 0x865e4000, 0x6b6aa000, 0x9b9e7000, 0x48cab800, 0xdf0e5400, 0x31929e00, 0xb5da5b00,
+        0x77f8ad80, 0xbec740c0, 0x7c4a0be0, 0x6e4d38b0, 0x9f4a8888, 0x91ce6654, 0x45b2aebe, 0x7f8a5f91
+      },
+      { // 78
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x38000000, 0xcc000000, 0xd2000000, 0xef000000,
+        0x5e800000, 0xd6c00000, 0x12a00000, 0xc4900000, 0x9dd80000, 0x0a440000, 0x73620000, 0xd4eb0000,
+        0x65ec8000, 0xa66bc000, 0x316ca000, 0x03abf000, 0xf74cb800, 0xa2fbd400, 0xccb4b600, 0x99efe700,
+        0xbc2e8280, 0xba10dcc0, 0x7b581520, 0xd0842970, 0xd3c23188, 0x6f7b2854, 0x9eb48efe, 0xb6efcec5
+      },
+      { // 79
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x68000000, 0x2c000000, 0x52000000, 0x03000000,
+        0xbe800000, 0x52c00000, 0x60e00000, 0x53f00000, 0x95780000, 0x838c0000, 0x9d7a0000, 0x9fa30000,
+        0xb75a8000, 0xd8c9c000, 0x77baa000, 0xdb39d000, 0xaac2a800, 0x64b5d400, 0x0db8b200, 0xd416df00,
+        0x56622680, 0x5d1f1fc0, 0xffb8a920, 0x8716db70, 0xa0e21918, 0x33df1b8c, 0xa5588e46, 0xfbe6e46f
+      },
+      { // 80
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xa8000000, 0x4c000000, 0xa6000000, 0xcd000000,
+        0x23800000, 0x47c00000, 0x6da00000, 0x26b00000, 0xd8380000, 0x142c0000, 0x726a0000, 0x9f290000,
+        0xacc78000, 0x43424000, 0x62e7a000, 0xe2327000, 0xf77fa800, 0xc0ae7400, 0xf52d8200, 0x07ab6700,
+        0x8d802b80, 0x16c01440, 0x60200360, 0xf07035b0, 0x98181008, 0xf45c381c, 0x42720c06, 0x27752e17
+      },
+      { // 81
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xa8000000, 0xf4000000, 0x32000000, 0xfd000000,
+        0x51800000, 0x7dc00000, 0x73a00000, 0xd8f00000, 0xde680000, 0x537c0000, 0xcae60000, 0xd36f0000,
+        0x0aa98000, 0x73254000, 0x3a89a000, 0xdb157000, 0xcec18800, 0xe9597c00, 0x33efa200, 0xb8ba4100,
+        0x4e482e80, 0xcb4c3e40, 0x96ae1ae0, 0x15231130, 0xc587ae08, 0xdfc66b0c, 0x16ae1392, 0xd52332d3
+      },
+      { // 82
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x38000000, 0xd4000000, 0x52000000, 0xf7000000,
+        0x31800000, 0x13c00000, 0x2ce00000, 0x41700000, 0x7cf80000, 0x19040000, 0x189e0000, 0xe30f0000,
+        0x03d08000, 0x54864000, 0xb528a000, 0xbe825000, 0xd636a800, 0xfd4d7400, 0xa2862600, 0xd87b0100,
+        0x24369280, 0xda4d6cc0, 0x8b0636e0, 0x8fbb1c30, 0x62d69bd8, 0xb83d4d6c, 0x947e3666, 0x727f37ed
+      },
+      { // 83
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x48000000, 0x74000000, 0x6e000000, 0x79000000,
+        0xe9800000, 0x7fc00000, 0x5aa00000, 0xf9700000, 0x29c80000, 0xdfcc0000, 0xaac60000, 0xb1590000,
+        0x5df98000, 0xb1b34000, 0xd3b1a000, 0x58bf7000, 0x22578800, 0xeb564c00, 0x2ac61a00, 0x71591100,
+        0xfdf9a180, 0x41b37f40, 0x9bb193e0, 0x2cbf6cb0, 0x4c57bf48, 0x925673ec, 0xc3463cba, 0x0e99075f
+      },
+      { // 84
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x58000000, 0x4c000000, 0x8a000000, 0xbd000000,
+        0x53800000, 0x15c00000, 0xe2a00000, 0xec500000, 0xba180000, 0x15540000, 0x57820000, 0x8b8f0000,
+        0x999d8000, 0x88e24000, 0x4125a000, 0xb1e67000, 0x4cbf9800, 0x3f3d7400, 0xdaa00e00, 0x70502700,
+        0x88180c80, 0xf4543840, 0xd6022060, 0x6f4f3930, 0xa2bd8ec8, 0xcc725124, 0x4a1da2ce, 0x5d224b31
+      },
+      { // 85
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x08000000, 0x2c000000, 0xea000000, 0xa9000000,
+        0xd8800000, 0x0ec00000, 0x25a00000, 0x88700000, 0xec180000, 0x4a7c0000, 0xf93a0000, 0xd0e70000,
+        0x22f78000, 0xcfedc000, 0x214fa000, 0x34e1f000, 0x44ed8800, 0xdcbae400, 0x58800a00, 0xcec02f00,
+        0x85a01080, 0xd8703540, 0xe4180ea0, 0x667c22f0, 0x133a05c8, 0x79e70bec, 0xfa77844e, 0xc12df333
+      },
+      { // 86
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x28000000, 0x24000000, 0x62000000, 0xb3000000,
+        0xa8800000, 0x9ec00000, 0xf7e00000, 0xc0700000, 0x60580000, 0xf06c0000, 0xf86e0000, 0x0c370000,
+        0x467a8000, 0xd13cc000, 0x1bc2a000, 0x3620d000, 0x6974a800, 0x37bbe400, 0xa0002200, 0x90002d00,
+        0x08001a80, 0xf40011c0, 0x4a0038a0, 0x97000270, 0xca800f58, 0x2dc03b6c, 0x5f600fce, 0x5eb02bb7
+      },
+      { // 87
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xa8000000, 0x54000000, 0xfe000000, 0xc5000000,
+        0x80800000, 0xc2c00000, 0x8da00000, 0xc6500000, 0xf9180000, 0xcaac0000, 0xe9b60000, 0x60210000,
+        0xd0278000, 0x4825c000, 0x441fa000, 0x5619f000, 0x91119800, 0x7ec4f400, 0x07983200, 0x0d6c2100,
+        0x04962d80, 0x74b12040, 0x0c9fb5a0, 0x10d9d4f0, 0xaab19cc8, 0x3994c064, 0x2800250e, 0x9400078f
+      },
+      { // 88
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x58000000, 0x4c000000, 0x3a000000, 0xaf000000,
+        0x59800000, 0x07c00000, 0x76a00000, 0x9e700000, 0xd1780000, 0x78b40000, 0x17020000, 0xe5f70000,
+        0x55fc8000, 0x5d8e4000, 0xe9a4a000, 0x0f8a7000, 0xc2fe8800, 0x78795400, 0x1c581e00, 0xc2040700,
+        0x735a3080, 0x3bf31cc0, 0xe4a68ee0, 0x157d7930, 0x36822548, 0xfe373dac, 0xe15c9796, 0xb0fe5c41
+      },
+      { // 89
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x68000000, 0xac000000, 0x02000000, 0xd9000000,
+        0x17800000, 0x2ec00000, 0x69200000, 0x4fd00000, 0x1ab80000, 0x3f5c0000, 0x50b20000, 0x7a6f0000,
+        0xdd718000, 0xd9b54000, 0x65c3a000, 0xcfda7000, 0xdab23800, 0x5f6f1400, 0xc0f18200, 0x12754f00,
+        0x7163ba80, 0xdbca6d40, 0xbcaa3d60, 0xd82329f0, 0xf45b9da8, 0x36565744, 0x8f382666, 0x089c3163
+      },
+      { // 90
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0xc8000000, 0x34000000, 0xc6000000, 0xf9000000,
+        0xc0800000, 0x09c00000, 0xb1600000, 0xb4900000, 0xafb80000, 0xd84c0000, 0xbc6e0000, 0x92010000,
+        0xaf338000, 0xf1e2c000, 0xfd5da000, 0x7ee3d000, 0xfcee3800, 0xdbc13400, 0x7e53aa00, 0xd572e900,
+        0x9ae5a380, 0x92afe340, 0x868039a0, 0xb0c00830, 0x11e03678, 0x2d500654, 0xd6d80436, 0x58dc2877
+      },
+      { // 91
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x48000000, 0x34000000, 0x6a000000, 0xc3000000,
+        0x0b800000, 0x14c00000, 0x11200000, 0xc4f00000, 0xb9180000, 0x408c0000, 0x0b6e0000, 0xff870000,
+        0x5ea08000, 0x42164000, 0x876ea000, 0x99a17000, 0x3bf62800, 0x0ccb1400, 0x4d6e9a00, 0x0aa16900,
+        0x58762880, 0xbc0b0dc0, 0x7e4e9060, 0x395151f0, 0x80ee34a8, 0x2b47090c, 0x6f80b88e, 0x16e675df
+      },
+      { // 92
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x38000000, 0xa4000000, 0xa6000000, 0x5f000000,
+        0x3a800000, 0xe9c00000, 0x29200000, 0x3db00000, 0x47580000, 0xceb40000, 0xd7de0000, 0x42690000,
+        0x99508000, 0x55f8c000, 0x7b2ea000, 0x5ce1f000, 0x16860800, 0x83dd1400, 0xec0ea600, 0xca51cd00,
+        0x555e0780, 0xcfa90ec0, 0xb6708f20, 0xa748c9b0, 0x3ef6aae8, 0xdf95ec1c, 0x4e783a1e, 0xa3043f01
+      },
+      { // 93
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x38000000, 0x64000000, 0x1e000000, 0x3f000000,
+        0xb8800000, 0xb9c00000, 0x4e600000, 0x47500000, 0x3c980000, 0x77b40000, 0x494e0000, 0x9bed0000,
+        0x9b488000, 0x0697c000, 0xb69ea000, 0x1eced000, 0xa2981800, 0x08b42400, 0x11ce3600, 0xf22d2d00,
+        0xed288980, 0x25c7d6c0, 0x940689a0, 0x567af1b0, 0x535625b8, 0x2a991ba4, 0xc4e6aabe, 0xb3eae139
+      },
+      { // 94
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xd8000000, 0x7c000000, 0x3e000000, 0x13000000,
+        0xd4800000, 0x09c00000, 0xf6200000, 0xc7700000, 0x6ec80000, 0xe8f40000, 0xd7f20000, 0x75110000,
+        0x7bbe8000, 0xc307c000, 0x5c84a000, 0x3de2f000, 0xdc482800, 0x4e341c00, 0xeb523e00, 0x18a13300,
+        0xefd6b980, 0x9943dbc0, 0x2d9e9aa0, 0x7477f6b0, 0xca4ca0a8, 0x1916efac, 0xedba383a, 0x542508e1
+      },
+      { // 95
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x78000000, 0x24000000, 0x92000000, 0x07000000,
+        0x67800000, 0xa2c00000, 0x4a200000, 0x33100000, 0x5de80000, 0xc9e40000, 0xe38e0000, 0x208b0000,
+        0xe5028000, 0x38844000, 0x3164a000, 0x32eb7000, 0x22681800, 0xbf243c00, 0xa3ae2600, 0x009b0500,
+        0x356aba80, 0x70a048c0, 0x6d4a9d60, 0x84b05970, 0xb7229368, 0xdf945874, 0x668c83f2, 0xe80f4bbd
+      },
+      { // 96
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0xc8000000, 0x2c000000, 0xe6000000, 0x05000000,
+        0xd8800000, 0xd3c00000, 0xb2200000, 0x37300000, 0x2ff80000, 0x5c0c0000, 0xbe120000, 0x41350000,
+        0x42d98000, 0xf8cac000, 0x43b3a000, 0xda33f000, 0x4b580800, 0x01fc2400, 0x754a1a00, 0x80c91f00,
+        0x97938b80, 0x2803ca40, 0x1c202fa0, 0xde3005b0, 0xb17832a8, 0xdacc2d3c, 0x1cb21576, 0x89c511cf
+      },
+      { // 97
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x78000000, 0x4c000000, 0x46000000, 0x4b000000,
+        0x96800000, 0xd3c00000, 0x7a600000, 0x15300000, 0x01c80000, 0xcb240000, 0xd6ba0000, 0xf3d50000,
+        0xca3e8000, 0x6d62c000, 0x4dcca000, 0x8d53d000, 0x9da82800, 0x65143c00, 0x19f21600, 0x17313f00,
+        0x58e48f80, 0x8c87c1c0, 0x56ba1420, 0xb3d53630, 0xea3eb338, 0xdd62ddbc, 0x35cca0ea, 0xc153f485
+      },
+      { // 98
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xa8000000, 0x14000000, 0x2a000000, 0xd9000000,
+        0x49800000, 0xeec00000, 0x74200000, 0x5a100000, 0x91280000, 0xed8c0000, 0x6c9e0000, 0xb93f0000,
+        0x39e98000, 0xa6a04000, 0xd07fa000, 0xd8037000, 0x5c201800, 0x8e101c00, 0x5b281200, 0x848c2900,
+        0x8d1e2080, 0x43ff3340, 0x67c998e0, 0x25b04df0, 0x08d7af68, 0xdb4f5d34, 0x449e2142, 0x6d3f31e7
+      },
+      { // 99
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x88000000, 0xd4000000, 0xb2000000, 0xf5000000,
+        0xa6800000, 0x65c00000, 0x4c600000, 0xce100000, 0x23580000, 0xb9ac0000, 0x6a6e0000, 0xe9130000,
+        0xa0938000, 0xf281c000, 0x97c5a000, 0xd92ed000, 0xb8e03800, 0xced02400, 0x21b83a00, 0x167c0100,
+        0x3f560e80, 0xbfaf0840, 0xfd258520, 0x32fee430, 0xb7d81ab8, 0x696c3af4, 0xe08e03ce, 0x92c329ef
+      },
+      { // 100
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x98000000, 0x94000000, 0x0a000000, 0x6f000000,
+        0x2a800000, 0x53c00000, 0xf0200000, 0x08700000, 0x2c380000, 0xce640000, 0xfd060000, 0xd1cf0000,
+        0x73728000, 0xccc2c000, 0xd2eca000, 0x77d9f000, 0x12002800, 0x3b002400, 0x00802e00, 0x6cc03100,
+        0x42a02480, 0xcfb03ec0, 0xd6180820, 0xa9140f30, 0xfbbe36a8, 0x4c6b16ec, 0x7e54b706, 0x157df185
+      },
+      { // 101
+        0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x98000000, 0x1c000000, 0x02000000, 0xbd000000,
+        0x6e800000, 0x81c00000, 0xb0200000, 0xd8100000, 0xfc380000, 0x320c0000, 0x25260000, 0x72870000,
+        0x83c08000, 0x0d0f4000, 0xb68ba000, 0x7dd87000, 0x82000800, 0xfd000400, 0x8e800e00, 0xb1c00300,
+        0x28200980, 0xc41001c0, 0xfe380020, 0x8f0c0bd0, 0x4ba606e8, 0xf347081c, 0x33e08b02, 0xd51f4d81
+      },
+      { // 102
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xa8000000, 0xcc000000, 0xb6000000, 0xa5000000,
+        0xd3800000, 0x4cc00000, 0x98200000, 0x04100000, 0xaa080000, 0x4b3c0000, 0x12aa0000, 0xe5730000,
+        0xc7cd8000, 0xea994000, 0x316ce000, 0x35c73000, 0xc5800800, 0x59c00400, 0xc3a00200, 0x74d00f00,
+        0x2c280a80, 0x262c0cc0, 0xdd220b60, 0x478f0a50, 0x9ec78d38, 0x473a44cc, 0xc4896982, 0x90727041
+      },
+      { // 103
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x28000000, 0xb4000000, 0x6a000000, 0xa9000000,
+        0x18800000, 0xe8c00000, 0x14200000, 0x5a300000, 0x71380000, 0x94840000, 0x1eca0000, 0x630d0000,
+        0x81aa8000, 0x28524000, 0x70e22000, 0xb8203000, 0x5c200800, 0x3e300c00, 0xd3380e00, 0x99840100,
+        0x444a0280, 0x96cd0b40, 0xe70a86a0, 0x33a24a90, 0x0d7a2188, 0x9e543e8c, 0x27f20942, 0x938909a3
+      },
+      { // 104
+        0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x58000000, 0x1c000000, 0x46000000, 0x8d000000,
+        0x01800000, 0xffc00000, 0x4c200000, 0x6e300000, 0xa9180000, 0xebac0000, 0x6cd60000, 0xdca70000,
+        0xd6618000, 0x97db4000, 0xc83c6000, 0x5401f000, 0xd2200800, 0x3f300c00, 0x8e980600, 0x296c0b00,
+        0x79760580, 0x515701c0, 0x75598460, 0x9f4748d0, 0x0c726018, 0x9ccafffc, 0x24b78cc2, 0x1a7c4ae3
+      },
+      { // 105
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x18000000, 0x1c000000, 0xbe000000, 0xdd000000,
+        0x15800000, 0x81400000, 0x42200000, 0x93100000, 0xb0980000, 0x38ec0000, 0x65660000, 0x10370000,
+        0x88278000, 0xd4034000, 0x0a2f6000, 0x67215000, 0x6ab80800, 0xf7fc0400, 0x0bfe0600, 0x45db0b00,
+        0xe0c18180, 0x597441c0, 0x7e28ebe0, 0xfd321dd0, 0xc58f6958, 0x29715c14, 0x46000a22, 0x31000631
+      },
+      { // 106
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x28000000, 0xf4000000, 0xa6000000, 0xf9000000,
+        0x72800000, 0xc0c00000, 0xc2200000, 0x67300000, 0x87a80000, 0xb85c0000, 0x81ea0000, 0x7cad0000,
+        0x0df18000, 0xb6aa4000, 0x2efaa000, 0x1f0f3000, 0xeb880800, 0x626c0c00, 0x5ac20a00, 0x79310700,
+        0xb2bb8280, 0x60f74f40, 0xb2032a60, 0x4f097f90, 0x7390af28, 0x1e62300c, 0x78d98e22, 0x0e364d73
+      },
+      { // 107
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0xe8000000, 0x5c000000, 0x26000000, 0x9f000000,
+        0x71800000, 0x25c00000, 0x1f200000, 0xb1b00000, 0xc5f80000, 0xcf140000, 0x598a0000, 0x99ef0000,
+        0xe91d8000, 0xc6adc000, 0xe8736000, 0xccd4f000, 0xd98a0800, 0x59ef0c00, 0x091d8e00, 0x16adcd00,
+        0x00736e80, 0x90d4f5c0, 0xff8a0a60, 0xc6ef05f0, 0x789d8918, 0x336dcf5c, 0x1f536f72, 0x2164fedb
+      },
+      { // 108
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xf8000000, 0xb4000000, 0xaa000000, 0xfd000000,
+        0x64800000, 0xffc00000, 0xcd200000, 0xbc900000, 0xdbd80000, 0x6f1c0000, 0x0dae0000, 0xa1750000,
+        0xc7f68000, 0x59314000, 0x86bc2000, 0x2ef17000, 0x47ae0800, 0xec750400, 0x3b768600, 0xe2f14f00,
+        0x199c2f80, 0xdb617b40, 0x52f602a0, 0x81a90bd0, 0x9f788048, 0x00d440fc, 0xc892a352, 0x51dc3089
+      },
+      { // 109
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xe8000000, 0x1c000000, 0x6e000000, 0xcf000000,
+        0xbf800000, 0x86c00000, 0x41200000, 0x80900000, 0xb1580000, 0x6bcc0000, 0x478a0000, 0xe2cf0000,
+        0x0b0f8000, 0x65b5c000, 0x5bcae000, 0xefb13000, 0x9ed20800, 0xd5030400, 0x42858600, 0xf87acb00,
+        0x07456e80, 0x10c4f1c0, 0xea38eee0, 0x752238f0, 0xd28f85f8, 0xc075c76c, 0x436aec92, 0x8ae132c9
+      },
+      { // 110
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x28000000, 0xec000000, 0x66000000, 0xf9000000,
+        0x8c800000, 0xb5400000, 0xd7200000, 0xa9900000, 0x07e80000, 0x8f540000, 0x503a0000, 0x68030000,
+        0x4c058000, 0xb6004000, 0xd1122000, 0x608fd000, 0xd3520800, 0x2e170400, 0x251f8a00, 0xb2934d00,
+        0x587fa280, 0xf99b9ec0, 0x6fda2e60, 0xc34bdb90, 0xe6000ac8, 0xb9000254, 0x2c8005f2, 0x65400959
+      },
+      { // 111
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x28000000, 0xa4000000, 0xca000000, 0xdb000000,
+        0x72800000, 0x0b400000, 0xd5200000, 0x13b00000, 0x3ac80000, 0xb0c40000, 0x8bda0000, 0x49710000,
+        0xfa0e8000, 0xa320c000, 0xde93a000, 0xf5775000, 0xec320800, 0x1e050c00, 0x891c8200, 0xb595c900,
+        0x3fc72280, 0x6b669a40, 0xa50f24a0, 0x8ba291b0, 0x26d52d28, 0xf6d395b4, 0x3edba5d2, 0x2af35e7b
+      },
+      { // 112
+        0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x08000000, 0x04000000, 0x42000000, 0x17000000,
+        0x67800000, 0xe7c00000, 0x19200000, 0x96b00000, 0x05580000, 0x364c0000, 0x03d20000, 0x2b090000,
+        0xe9948000, 0xd6f3c000, 0x9b96e000, 0x09da7000, 0x982a0800, 0x1c350c00, 0x9e3e8600, 0xe906cb00,
+        0x3e886080, 0xd16cb040, 0xcc7a6c20, 0x18d5bd70, 0x0ab6e878, 0x5b6a797c, 0xbf720f12, 0x8d790e2b
+      },
+      { // 113
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xf8000000, 0x74000000, 0x52000000, 0x31000000,
+        0x0a800000, 0xb0c00000, 0xbf200000, 0x35900000, 0xc5580000, 0x1a5c0000, 0xdfce0000, 0xe2b50000,
+        0x8ce08000, 0x01364000, 0xd28da000, 0x54c3b000, 0xe5360800, 0x88b90400, 0xe9d68600, 0xc98f4f00,
+        0x5b5b2f80, 0x6d4cf740, 0x466d2d20, 0x91f5f710, 0xfdbbaea8, 0x697ab00c, 0xac608a72, 0xb4f64f19
+      },
+      { // 114
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0xd8000000, 0xf4000000, 0x6e000000, 0x7f000000,
+        0xab800000, 0x07400000, 0xfba00000, 0xef700000, 0xf7a80000, 0x854c0000, 0x3e9e0000, 0xa5f10000,
+        0xfc458000, 0x260ec000, 0x433f6000, 0x39971000, 0xca458800, 0x6d0ecc00, 0xa6bf6200, 0xb1d71f00,
+        0x42658580, 0x713ec340, 0xc4b764e0, 0xa4eb18f0, 0x20d38f38, 0x56c3c334, 0xfdcceb5a, 0xc864d607
+      },
+      { // 115
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x58000000, 0x94000000, 0x5a000000, 0xed000000,
+        0x7d800000, 0x1f400000, 0x75a00000, 0x13700000, 0xdbb80000, 0x74440000, 0x132e0000, 0x82a10000,
+        0x23d88000, 0x094a4000, 0x968fe000, 0xb9f19000, 0x84588800, 0x3b0a4c00, 0xfeafe600, 0x65c19d00,
+        0x72408d80, 0xc83e4540, 0x6c39e3a0, 0x7e2493d0, 0x3f360a58, 0x5c9504b4, 0xacce84fa, 0xddef42e7
+      },
+      { // 116
+        0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x68000000, 0x6c000000, 0xbe000000, 0x05000000,
+        0xc6800000, 0x5cc00000, 0x6aa00000, 0x02d00000, 0xff880000, 0x9c5c0000, 0xa7520000, 0x24e70000,
+        0x1ead8000, 0x18ee4000, 0x18802000, 0x89cb7000, 0x540d8800, 0x6a3e4400, 0x2f082a00, 0x49977300,
+        0x255f8e80, 0x27d942c0, 0x4925a1e0, 0x08b93350, 0x91ffa2e8, 0xf002370c, 0x88002f4a, 0xfc0b777d
+      },
+      { // 117
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x08000000, 0xbc000000, 0x7a000000, 0x19000000,
+        0x56800000, 0x44c00000, 0x62a00000, 0x42f00000, 0x21a80000, 0xfd4c0000, 0x3bea0000, 0x67030000,
+        0x61a48000, 0x1d5d4000, 0xebd52000, 0x9f2a7000, 0xd5848800, 0xdb6d4c00, 0x88dd2200, 0xd0967f00,
+        0xc7c68880, 0xfd2247c0, 0xa893a5a0, 0xb3c83e90, 0x1b372de8, 0x3b95738c, 0xf4620b8a, 0xb57f06bf
+      },
+      { // 118
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x18000000, 0x3c000000, 0x36000000, 0xb1000000,
+        0xfd800000, 0x45c00000, 0x49a00000, 0x67d00000, 0x8ab80000, 0x514c0000, 0xadfe0000, 0x2da30000,
+        0x0dc38000, 0x7d874000, 0x05f8e000, 0x298c3000, 0x17e38800, 0x92974400, 0x6d60e600, 0x9bd03700,
+        0x9c858980, 0xf06847c0, 0x38456560, 0x4c687c10, 0x4e78e658, 0x9d4c339c, 0xc3c389fa, 0xc0874e6d
+      },
+      { // 119
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x38000000, 0x7c000000, 0x4a000000, 0x25000000,
+        0xd2800000, 0xcc400000, 0x58a00000, 0xc9500000, 0x7a380000, 0xad340000, 0x66960000, 0x527b0000,
+        0x73bc8000, 0x08c64000, 0x0bde2000, 0xce6e5000, 0xe9848800, 0x75f24400, 0x35482600, 0x70155900,
+        0xe8380b80, 0x243403c0, 0xa61602a0, 0x573b0b50, 0x8b9c8ea8, 0x54d64b04, 0xb1c6212a, 0x434a5ec5
+      },
+      { // 120
+        0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x58000000, 0x8c000000, 0xb2000000, 0x67000000,
+        0xdd800000, 0x61400000, 0x17a00000, 0x9a700000, 0xf0380000, 0xf81c0000, 0x5c0e0000, 0x5a0f0000,
+        0xb33a8000, 0xe3bac000, 0xb45be000, 0xad219000, 0x26828800, 0x86e6cc00, 0x75f5e600, 0x365e9b00,
+        0x52000d80, 0x170004c0, 0xe5800d20, 0x5d400d70, 0xfda00858, 0x71700ed4, 0x9fb80a5a, 0xfe5c0fd7
+      },
+      { // 121
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x38000000, 0x7c000000, 0x96000000, 0x41000000,
+        0xc7800000, 0x71400000, 0xbda00000, 0xbe700000, 0x77180000, 0x76840000, 0xbef60000, 0x58cb0000,
+        0xd1fb8000, 0x62674000, 0x11086000, 0x3fbe1000, 0xed438800, 0xfb934c00, 0xc7666e00, 0xccb11d00,
+        0x91ee0b80, 0x424f0bc0, 0x210d8760, 0xd7ac4910, 0xa973eff8, 0x119950d4, 0x106beaba, 0x4a1d53f7
+      },
+      { // 122
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x18000000, 0x44000000, 0x72000000, 0xa7000000,
+        0x1a800000, 0xf7400000, 0x1da00000, 0x9df00000, 0xd2e80000, 0x747c0000, 0x251e0000, 0x45850000,
+        0x39fe8000, 0x30f2c000, 0x7b5d2000, 0x63819000, 0x84e08800, 0xf177cc00, 0x10a3a200, 0x44735b00,
+        0xfd3da980, 0x21b65840, 0xfbe32d20, 0x8ff49d70, 0x25f60a28, 0xe6f90c34, 0x3e60857a, 0x7637ccef
+      },
+      { // 123
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0xb8000000, 0xcc000000, 0x7a000000, 0x51000000,
+        0xac800000, 0xfdc00000, 0x8da00000, 0x19500000, 0xb4680000, 0x0ad40000, 0xf2160000, 0xf50f0000,
+        0x829c8000, 0x8aed4000, 0xb208a000, 0xd516b000, 0x128a8800, 0x32e24400, 0x7e142200, 0xaf3bf900,
+        0x43a22380, 0x9e64f8c0, 0x83d6ada0, 0x229db810, 0x5ae80b48, 0x2a140e1c, 0x893606fa, 0xd09f0145
+      },
+      { // 124
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x68000000, 0x34000000, 0x1e000000, 0x57000000,
+        0x26800000, 0x07400000, 0x39a00000, 0x25d00000, 0x38d80000, 0x87540000, 0x79920000, 0xc5c10000,
+        0xa8e18000, 0xef56c000, 0x4d912000, 0xdbd29000, 0xfff38800, 0xc9d7c400, 0x4ad0ae00, 0xe2545900,
+        0xda3aae80, 0xf1115740, 0xcd9127e0, 0x9bd29870, 0x1ff382e8, 0x59d7ce34, 0x22d0aafa, 0xd6545d6d
+      },
+      { // 125
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xf8000000, 0x64000000, 0xea000000, 0x77000000,
+        0xc0800000, 0x2a400000, 0x53a00000, 0x40d00000, 0x6ef80000, 0x83e40000, 0xfc560000, 0xdaa50000,
+        0xd5588000, 0x3f16c000, 0x4ca9a000, 0x3c52d000, 0xfaae8800, 0xe563c400, 0x97092600, 0xd0a01500,
+        0xb2512780, 0x67941240, 0x52ff20a0, 0x7dd51670, 0xa971ad88, 0xa126d5e4, 0x49a08a1a, 0xbff2c43d
+      },
+      { // 126
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x88000000, 0xb4000000, 0x1e000000, 0x2d000000,
+        0x9e800000, 0xb9c00000, 0xcda00000, 0x3a700000, 0x92e80000, 0xa2240000, 0x471a0000, 0x8d910000,
+        0xda518000, 0x62e44000, 0xfa1d2000, 0x7b1ab000, 0x27a38800, 0xe9514c00, 0xd156a200, 0xdd6ffd00,
+        0x0f6f2080, 0xd06fb740, 0x41c80be0, 0xe19403d0, 0x38520368, 0xc5c50ddc, 0x87a385ba, 0xf9514a37
+      },
+      { // 127
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x08000000, 0x14000000, 0x2a000000, 0x4f000000,
+        0x4d800000, 0x18c00000, 0xdca00000, 0xe0500000, 0xaef80000, 0xed940000, 0xa8ca0000, 0x24990000,
+        0x6c7c8000, 0x98ecc000, 0x9c88e000, 0x80557000, 0x3eee8800, 0xe5b1c400, 0xbcc66600, 0x0eb4b900,
+        0x2350e880, 0xd5517540, 0x847c8ca0, 0x5cecc9f0, 0xde88e258, 0x4b5579cc, 0x516e87ea, 0xa671cfb5
+      },
+      { // 128
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0xd8000000, 0x14000000, 0x36000000, 0x8f000000,
+        0x5d800000, 0xe6c00000, 0x08a00000, 0xa6500000, 0x22d80000, 0x46b40000, 0xcd5e0000, 0x81590000,
+        0xe34f8000, 0xba58c000, 0x78d3e000, 0x1badf000, 0xe1e98800, 0x7925c400, 0x72ba6e00, 0x4b483100,
+        0x2673e580, 0x62fdf540, 0xa6b18560, 0xdd51cdf0, 0x59446658, 0xf7413e2c, 0x8c64666a, 0xf7d137d5
+      },
+      { // 129
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x58000000, 0x84000000, 0x32000000, 0x39000000,
+        0x86800000, 0xf5400000, 0xc1a00000, 0xc4f00000, 0x4d480000, 0xf5a40000, 0xdece0000, 0x785d0000,
+        0x9d3e8000, 0xa4a14000, 0x34502000, 0x133d9000, 0x5b988800, 0x31e84c00, 0x85c8aa00, 0x5fd5dd00,
+        0xcad02d80, 0x727d9440, 0x50388120, 0x98184290, 0x2400a7e8, 0xe231da14, 0x613e22ba, 0x02909b9f
+      },
+      { // 130
+        0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0xc8000000, 0x9c000000, 0x36000000, 0x4f000000,
+        0xfa800000, 0x2d400000, 0x25600000, 0x59700000, 0xbf580000, 0x48440000, 0xe6f60000, 0x61910000,
+        0x3dfc8000, 0xd11f4000, 0xb9b9e000, 0xf9d6b000, 0x6339e800, 0xe496b400, 0x2e59e200, 0x51e6b300,
+        0x6f01ee80, 0xcaa2bac0, 0x4577ede0, 0xc973be30, 0xa76b6248, 0x6c5cfce4, 0x84ea801e, 0x84be4973
+      },
+      { // 131
+        0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x08000000, 0x14000000, 0xf6000000, 0xbb000000,
+        0x09800000, 0xad400000, 0xc5600000, 0xe1700000, 0xff480000, 0x20540000, 0xd7d60000, 0xd5930000,
+        0xef4e8000, 0x18504000, 0x2bfa2000, 0x47b57000, 0xaa7a2800, 0xbef57400, 0x791a2600, 0x94857300,
+        0x87d22680, 0x0d917240, 0x636429e0, 0x827279f0, 0x7ae2a978, 0x17363324, 0x43ae852e, 0x64604d33
+      },
+      { // 132
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0xb8000000, 0xbc000000, 0x4e000000, 0x8f000000,
+        0x54800000, 0x4d400000, 0xd1600000, 0x2f500000, 0xb8780000, 0x20e40000, 0x9b8a0000, 0x79c50000,
+        0x4c068000, 0x361d4000, 0x930c6000, 0x6a853000, 0x7a6c6800, 0x39d53c00, 0x2c146200, 0xe6313b00,
+        0x5b1e6980, 0x6eb430c0, 0x8878ed60, 0xf8f97830, 0xf78c8828, 0xffd84ce4, 0xc70aed3e, 0x90987211
+      },
+      { // 133
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0xe8000000, 0x74000000, 0xda000000, 0xb7000000,
+        0x75800000, 0x38c00000, 0x44e00000, 0xfad00000, 0xaff80000, 0x81640000, 0x8a1e0000, 0xef230000,
+        0x49a58000, 0xe6e04000, 0xc1c12000, 0x4c451000, 0x38a12800, 0x4a551c00, 0x41b92200, 0x82e11b00,
+        0x23df2c80, 0x17661c40, 0x0b04a120, 0x6bb55730, 0x1df80678, 0x826404bc, 0x859e0a36, 0x10e30711
+      },
+      { // 134
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x88000000, 0x8c000000, 0xba000000, 0x4b000000,
+        0xcf800000, 0x1bc00000, 0x61e00000, 0x0af00000, 0xd5680000, 0x36b40000, 0x53760000, 0x6fa50000,
+        0x4be38000, 0xf9c54000, 0x7ec0a000, 0x6b435000, 0x4ba8a800, 0x6df75400, 0xf0deae00, 0xfe525300,
+        0x893d2680, 0xc0971bc0, 0x827d8d20, 0xfb144f70, 0x67b529d8, 0x87d31acc, 0x23e381c6, 0x45c54963
+      },
+      { // 135
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xc8000000, 0xbc000000, 0x66000000, 0x61000000,
+        0x1e800000, 0x36c00000, 0x60e00000, 0x79d00000, 0x63580000, 0x178c0000, 0x045e0000, 0xd8210000,
+        0x94208000, 0xaa14c000, 0x9f3d6000, 0x0bb9d000, 0xf2656800, 0x5135dc00, 0x66bb6a00, 0x32d4d900,
+        0x22fbe680, 0x0ad012c0, 0xc6fe80e0, 0x38f5c4d0, 0x2dfde908, 0xe97d1bbc, 0xd8800506, 0xc7c00521
+      },
+      { // 136
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x38000000, 0xfc000000, 0x2a000000, 0xd3000000,
+        0x7b800000, 0xe0400000, 0xa2600000, 0x95700000, 0xc8e80000, 0x798c0000, 0xb7620000, 0x6fed0000,
+        0x1c2f8000, 0xfa074000, 0x8b23a000, 0x17b2b000, 0xf24ba800, 0x8d7eb400, 0xc4c9ae00, 0xfba3bd00,
+        0xa06e2d80, 0xc258f2c0, 0x05478f20, 0xf0cb4ff0, 0x85a1a098, 0x9d6fb5f4, 0xbcec24be, 0x6785f1a3
+      },
+      { // 137
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0xc8000000, 0xb4000000, 0xb6000000, 0x95000000,
+        0x5b800000, 0x5e400000, 0x64600000, 0xfb500000, 0x57c80000, 0x01140000, 0x3d860000, 0x135b0000,
+        0x33ce8000, 0x6f07c000, 0xa49b2000, 0x82cdb000, 0xfab32800, 0x73c9bc00, 0xcf1d2e00, 0xb496bb00,
+        0x3afda280, 0x868e7040, 0x71e609e0, 0xec0b0910, 0x7a068458, 0x3f13c0f4, 0xbc9d241e, 0xeed6b841
+      },
+      { // 138
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xd8000000, 0x94000000, 0xda000000, 0xaf000000,
+        0x02800000, 0x6a400000, 0x0c600000, 0x45500000, 0xcec80000, 0x4f3c0000, 0x12aa0000, 0xd27f0000,
+        0x48718000, 0x475e4000, 0xf5f0e000, 0x97bb7000, 0xd7d8e800, 0xdc977c00, 0x675aee00, 0x85c47100,
+        0xffa96380, 0x4bc93840, 0x4aaa0e20, 0x867f02b0, 0xf2718608, 0x385e4814, 0x2f70e0ce, 0x69fb7141
+      },
+      { // 139
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x88000000, 0xbc000000, 0xd6000000, 0x25000000,
+        0x80800000, 0x98400000, 0x8d600000, 0x45d00000, 0x41980000, 0xaad40000, 0x42260000, 0x3f110000,
+        0xdbb08000, 0x31ffc000, 0xcb9ee000, 0xc9d07000, 0xdfb8e800, 0x13c17c00, 0xa4886a00, 0x0a7eb700,
+        0x6a768280, 0x3a7eccc0, 0x225667e0, 0xa66bb290, 0x447805e8, 0x0b440c14, 0x78de0fbe, 0x45150489
+      },
+      { // 140
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x68000000, 0xec000000, 0x5a000000, 0x87000000,
+        0xc8800000, 0x38c00000, 0xdbe00000, 0xf5500000, 0x18880000, 0xf0cc0000, 0xc7c60000, 0x57550000,
+        0x1bbf8000, 0x8e404000, 0x22036000, 0xc328d000, 0x1ea56800, 0x75eddc00, 0xfc72ee00, 0xe9319500,
+        0xa1bf8880, 0x59404bc0, 0xe2836520, 0x87e8dfb0, 0xf74567a8, 0xebbdd93c, 0x767aea96, 0xa63d91a9
+      },
+      { // 141
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x88000000, 0x54000000, 0x1e000000, 0xbd000000,
+        0xe1800000, 0x04c00000, 0x27e00000, 0x3b700000, 0xbe280000, 0x2d240000, 0xb9960000, 0x68db0000,
+        0xe5d08000, 0xcc4dc000, 0xfcb8a000, 0x75721000, 0x7b06a800, 0x708d1400, 0x47402e00, 0x641bdf00,
+        0xd6280680, 0x89240a40, 0x4f960f60, 0x31db0590, 0x92508778, 0x218dcedc, 0x24d8ad86, 0xf7c2182b
+      },
+      { // 142
+        0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0xb8000000, 0xec000000, 0xba000000, 0xe1000000,
+        0x2f800000, 0x37400000, 0x14600000, 0x96f00000, 0x24080000, 0xae140000, 0x572a0000, 0x84a90000,
+        0x41fb8000, 0xe08dc000, 0x0fcd2000, 0x47a67000, 0x336f2800, 0xea5b7400, 0x69dea600, 0x048fbb00,
+        0x01e00d80, 0x00b005c0, 0xffe80e20, 0xffa40fd0, 0xdf4202d8, 0x504d03a4, 0x88d9881e, 0x2b30c40b
+      },
+      { // 143
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x28000000, 0x84000000, 0xfe000000, 0xf1000000,
+        0xe3800000, 0x23c00000, 0x94e00000, 0x3a700000, 0xf8280000, 0xdc040000, 0x321e0000, 0xbb270000,
+        0xc4948000, 0xb562c000, 0xaa9b2000, 0x7c5c5000, 0xb52d2800, 0x3dbf5400, 0x82c7ae00, 0x6f4a9700,
+        0xb5800c80, 0x16c00f40, 0xe9600b60, 0xd8b00450, 0xa7480358, 0x41b4056c, 0xa0d60896, 0xac530e8b
+      },
+      { // 144
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x88000000, 0xcc000000, 0x06000000, 0x3f000000,
+        0x18800000, 0x91400000, 0xdc600000, 0xa9d00000, 0x3d080000, 0x4d9c0000, 0x00ce0000, 0x32850000,
+        0xb8608000, 0x13c54000, 0x3c2c6000, 0xfe27b000, 0xcb0a6800, 0x8aaebc00, 0xec4cee00, 0x31e2f100,
+        0x19260680, 0x57890dc0, 0xb1c68ee0, 0xd90c4230, 0x378ae968, 0x61fbf624, 0x5108842e, 0xfb894c79
+      },
+      { // 145
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x28000000, 0x24000000, 0x6a000000, 0x21000000,
+        0xf4800000, 0x24c00000, 0x98600000, 0xc8900000, 0x82f80000, 0xd7440000, 0xc7360000, 0x5bbb0000,
+        0xbb778000, 0xd914c000, 0xa8866000, 0xd2ef9000, 0x6f71e800, 0x7b3b5c00, 0x3d978a00, 0xd444c700,
+        0x669e6080, 0x59fb9940, 0x9adfec20, 0x1b545c50, 0xa92e03e8, 0xa0af075c, 0x46d9864e, 0x2d7bc785
+      },
+      { // 146
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x68000000, 0x6c000000, 0xa2000000, 0x2b000000,
+        0x25800000, 0xe5c00000, 0xd8600000, 0x69b00000, 0xf7e80000, 0x6b5c0000, 0x582e0000, 0xb4290000,
+        0x560f8000, 0x9d3c4000, 0xa882a000, 0x25439000, 0x910d2800, 0x5abfd400, 0x866f8600, 0xc88c4500,
+        0x756aa880, 0x191f97c0, 0x26a324a0, 0x4c56d070, 0x8f800e78, 0xf2c009ec, 0xd7e0075e, 0xdb700f07
+      },
+      { // 147
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x58000000, 0x34000000, 0x9e000000, 0x0d000000,
+        0xe5800000, 0x1fc00000, 0x4e600000, 0x8fb00000, 0x6cf80000, 0xb6e40000, 0x9dca0000, 0x51430000,
+        0xdd1e8000, 0xeda6c000, 0x63e52000, 0x0c4e1000, 0x709ba800, 0x2e58d400, 0xdf868200, 0x24f2cf00,
+        0x6ad72f80, 0x6fe91840, 0xf64f2460, 0xabbd1790, 0x1afd25b8, 0xd7da1e2c, 0xd249ad3e, 0xdd8fd547
+      },
+      { // 148
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0xa8000000, 0x64000000, 0xd6000000, 0x49000000,
+        0xbc800000, 0xb5400000, 0x75e00000, 0x1a900000, 0xb4780000, 0xbd640000, 0xe1f60000, 0x44ab0000,
+        0xa9588000, 0x7fe9c000, 0x79926000, 0x5bfcf000, 0x4faae800, 0x02c53c00, 0x6b208a00, 0x7b8dcf00,
+        0xace46880, 0xfe17f540, 0xed126fe0, 0x4abcfed0, 0xcc4aeca8, 0x615530c4, 0xcbd88c16, 0x17a9c3bd
+      },
+      { // 149
+        0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x28000000, 0xac000000, 0x9e000000, 0xd5000000,
+        0x2b800000, 0xc6400000, 0x53e00000, 0xd0b00000, 0x50e80000, 0xf2140000, 0xeb160000, 0x2e990000,
+        0xf5c08000, 0x11b8c000, 0xb144a000, 0xcb44f000, 0x5c6c2800, 0xf4e83400, 0x503e8600, 0x5835c700,
+        0x64122c80, 0x022539c0, 0x63080360, 0x52a40390, 0x73fe0558, 0x408d0234, 0xa8d68506, 0x4621cbaf
+      },
+      { // 150
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x58000000, 0x0c000000, 0xae000000, 0x39000000,
+        0xe7800000, 0x48400000, 0xf1e00000, 0x08b00000, 0xaae80000, 0xd83c0000, 0x4c220000, 0x4e2d0000,
+        0xa90c8000, 0xbfb3c000, 0x4474a000, 0x5fe07000, 0x31902800, 0x4d6fb400, 0x90468600, 0xbde2cd00,
+        0x46ba2b80, 0x03ceb9c0, 0x67800760, 0x08400750, 0x11e00a98, 0x98b00e14, 0xf2e804e6, 0xd43c04cf
+      },
+      { // 151
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x28000000, 0x44000000, 0x46000000, 0xef000000,
+        0x4d800000, 0x66c00000, 0x65600000, 0x58b00000, 0xbe780000, 0x9b240000, 0x63b60000, 0x6df30000,
+        0xdecc8000, 0xf9504000, 0xd2a1a000, 0xe34f5000, 0x57952800, 0xe3fb1400, 0x65e28200, 0x6af74f00,
+        0x37432880, 0xc9b81f40, 0xc0d60ee0, 0x9a430eb0, 0x8d348ab8, 0xb4b4439c, 0xfc77a00e, 0x920c57a7
+      },
+      { // 152
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x48000000, 0x54000000, 0xda000000, 0xb7000000,
+        0x74800000, 0xd0c00000, 0xa6600000, 0x9db00000, 0x21680000, 0x111c0000, 0x1d860000, 0x617f0000,
+        0xf1078000, 0x0d994000, 0x295de000, 0xa53b9000, 0xd7b26800, 0x9e7ed400, 0xd1898600, 0x074a4500,
+        0x38346a80, 0x4c01d440, 0x260e0120, 0x29130a30, 0x518984e8, 0x474a477c, 0xd83469ae, 0x5c01d197
+      },
+      { // 153
+        0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0xf8000000, 0xec000000, 0x92000000, 0x75000000,
+        0x39800000, 0xe6400000, 0x61e00000, 0x80b00000, 0x7df80000, 0xaa940000, 0x44f20000, 0x710d0000,
+        0x2f938000, 0xc56fc000, 0xdb542000, 0xac5d7000, 0xc8dfa800, 0x7316b400, 0x72818200, 0x98d2c300,
+        0xbb3fa580, 0xc6a6b9c0, 0x96f98ea0, 0xa406cd90, 0x662da0b8, 0xdb1bbe34, 0x56920206, 0xbefd0caf
+      },
+      { // 154
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x98000000, 0xf4000000, 0x46000000, 0x15000000,
+        0xd6800000, 0xef400000, 0xa3e00000, 0x23b00000, 0x49d80000, 0xe4ac0000, 0xfc720000, 0x40730000,
+        0x0a588000, 0x9d4ac000, 0x90f1e000, 0xd005f000, 0xf8116800, 0xc4133400, 0xce2a8a00, 0x7939c500,
+        0x64a96b80, 0xbc4f3e40, 0x606085e0, 0x1a56ca10, 0x055beb08, 0x64dafea4, 0x963be6d6, 0xed2af78f
+      },
+      { // 155
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x88000000, 0x6c000000, 0xa6000000, 0x1d000000,
+        0x69800000, 0x6ec00000, 0x0a600000, 0xb5100000, 0x55a80000, 0xd0e40000, 0x037e0000, 0x9ea90000,
+        0xec5a8000, 0x082ac000, 0xac332000, 0xc620d000, 0xed17a800, 0xe1a31c00, 0x02fe0e00, 0xac690300,
+        0xa83a8e80, 0x3c3ac9c0, 0xbe1b22e0, 0x0904d710, 0x2b89a4f8, 0xb9da1b3c, 0xd8ec883e, 0xaf77cebd
+      },
+      { // 156
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x48000000, 0xbc000000, 0xd6000000, 0x73000000,
+        0xd1800000, 0x57400000, 0x7de00000, 0x27300000, 0x0b980000, 0x9a740000, 0x934e0000, 0x3fcd0000,
+        0xee228000, 0xc70d4000, 0x9b8ea000, 0x0260b000, 0x97622800, 0x1de0f400, 0xf72e0a00, 0xb3bd0b00,
+        0x6e5a8680, 0xf94944c0, 0x9ad8a9e0, 0x4c99bcf0, 0x41eea878, 0xb110b644, 0x589a20c6, 0xbbe4fc07
+      },
+      { // 157
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x48000000, 0xe4000000, 0x02000000, 0x2b000000,
+        0x47800000, 0xcb400000, 0x8be00000, 0x21100000, 0xa8880000, 0x5ef40000, 0x13be0000, 0x415b0000,
+        0xa4e18000, 0x54964000, 0x00c12000, 0x768e3000, 0xfbfea800, 0x49137c00, 0x9cb60600, 0x24ef0f00,
+        0x94bf8a80, 0xe0dd4d40, 0x46a8a4a0, 0xb3ec7cf0, 0xad018c58, 0x9e864204, 0x0fc922c6, 0xd33a3da5
+      },
+      { // 158
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xd8000000, 0x2c000000, 0x66000000, 0xcd000000,
+        0xf3800000, 0x01400000, 0x51e00000, 0xba300000, 0x23080000, 0xaa9c0000, 0xa8f20000, 0x239d0000,
+        0xf9428000, 0x0dd2c000, 0x143ba000, 0x1a02b000, 0x13032800, 0x02917400, 0x4ce80e00, 0xb1ac0500,
+        0x7e7a0b80, 0x554103c0, 0x2bd08be0, 0xb93fce10, 0xf9912958, 0xca7c7cc4, 0x7f428226, 0x90d2cfb7
+      },
+      { // 159
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0xa8000000, 0x44000000, 0x0e000000, 0xdf000000,
+        0x61800000, 0x1a400000, 0x86e00000, 0xc8300000, 0x94280000, 0x461c0000, 0x0b0e0000, 0xc7bb0000,
+        0x81528000, 0xe9544000, 0x0d5fa000, 0x7356f000, 0x944b2800, 0x19d5b400, 0x49800600, 0x1e400d00,
+        0x68e00480, 0x87300d40, 0x5da80a60, 0x185c09b0, 0x83ee06f8, 0xd08b0c54, 0x74fa8e76, 0xb5084d27
+      },
+      { // 160
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x78000000, 0x9c000000, 0x76000000, 0x0f000000,
+        0x68800000, 0x72400000, 0x17e00000, 0xd0300000, 0x58080000, 0xec1c0000, 0x1e1a0000, 0xeb390000,
+        0x82ba8000, 0x0b5e4000, 0x7079e000, 0xcaf6b000, 0x3db16800, 0x2bfdf400, 0x96000e00, 0x5f000500,
+        0x70800180, 0xfe4008c0, 0x19e000e0, 0x43300930, 0x468801e8, 0x915c07d4, 0x617a07f6, 0x49490a27
+      },
+      { // 161
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x78000000, 0x04000000, 0x42000000, 0x03000000,
+        0xe6800000, 0x62400000, 0x00e00000, 0x20100000, 0xb0180000, 0xd8140000, 0x740e0000, 0x3a0f0000,
+        0x07008000, 0xa4884000, 0x61406000, 0xe67cd000, 0x425c4800, 0xb0f81c00, 0xf8000200, 0xc4000300,
+        0xe2000280, 0x730001c0, 0x9e8001e0, 0x66400010, 0x42e00108, 0x2310000c, 0x5698039a, 0xba540189
+      },
+      { // 162
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x08000000, 0xfc000000, 0xe6000000, 0x9f000000,
+        0x60800000, 0x86c00000, 0xfb600000, 0x28100000, 0x8c080000, 0xde1c0000, 0xbb1a0000, 0x72810000,
+        0x03df8000, 0xe2fcc000, 0x5143e000, 0x91241000, 0x8bbcd800, 0xe47d6c00, 0x08800200, 0xeac00100,
+        0xf5600380, 0x9b100340, 0x02880020, 0x3bdc03f0, 0xc6fa0398, 0x4351027c, 0x14378182, 0x9230c21b
+      },
+      { // 163
+        0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x08000000, 0x54000000, 0x56000000, 0x33000000,
+        0x4e800000, 0x19400000, 0x7d200000, 0xa4100000, 0xfe180000, 0xb70c0000, 0xa0960000, 0x76410000,
+        0x31aa8000, 0xd85ac000, 0xfebe6000, 0x44d5d000, 0x3aed2800, 0x1872a400, 0xcb200200, 0xe7100300,
+        0xd8980180, 0x4a4c02c0, 0x83b60020, 0xb5510150, 0xd7328158, 0x4516c0cc, 0x6d88613a, 0x8fc4d065
+      },
+      { // 164
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xe8000000, 0xec000000, 0xde000000, 0x65000000,
+        0x60800000, 0x31400000, 0x06200000, 0x7c100000, 0x46080000, 0x41040000, 0x62860000, 0x625d0000,
+        0xefbd8000, 0xf3cbc000, 0x1464a000, 0x5bb81000, 0x69d82800, 0x6371c400, 0xb0200200, 0xb5100100,
+        0xd8880080, 0x254400c0, 0xec2603a0, 0xc30d03b0, 0x71958378, 0xabdfc194, 0x506aa182, 0x49a110c5
+      },
+      { // 165
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x28000000, 0x44000000, 0x5a000000, 0x7f000000,
+        0xb5800000, 0xae400000, 0x67200000, 0x7a100000, 0x0f180000, 0x2d8c0000, 0x125a0000, 0x51250000,
+        0x1b188000, 0x9f934000, 0x4943e000, 0x6eacb000, 0xe240c800, 0x093c6400, 0xc7180200, 0x798c0300,
+        0x005a0180, 0xba250340, 0xdc9880a0, 0x0ad34110, 0xc1e3e168, 0xc5fcb1fc, 0x3ff8cad6, 0xf0e066b9
+      },
+      { // 166
+        0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0xf8000000, 0x34000000, 0xf2000000, 0x63000000,
+        0x5a800000, 0x06c00000, 0x33e00000, 0x86100000, 0x31180000, 0xe98c0000, 0x14560000, 0xf93f0000,
+        0x73f68000, 0x26164000, 0xe1186000, 0xa1915000, 0xd849d800, 0x3f3ffc00, 0xe2f80200, 0x1f9c0300,
+        0xbd4e0180, 0x94b302c0, 0x6da083e0, 0x882940d0, 0x3a6ee3c8, 0xe247118c, 0x5031b96a, 0x1e7eac1b
+      },
+      { // 167
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x58000000, 0x7c000000, 0xd2000000, 0xef000000,
+        0x87800000, 0x55c00000, 0xb4200000, 0x4e100000, 0x8d180000, 0x508c0000, 0xde4e0000, 0x6beb0000,
+        0x693f8000, 0x96924000, 0x6749e000, 0xbd72f000, 0xae7fb800, 0x3bfa0400, 0xe1380200, 0xa29c0300,
+        0xe1560180, 0xa46701c0, 0x68f18160, 0xd4b941f0, 0x68566348, 0x8af0b3bc, 0xc3ae5a1e, 0x83c4f557
+      },
+      { // 168
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x88000000, 0x0c000000, 0xfa000000, 0xab000000,
+        0xde800000, 0x80c00000, 0x2fe00000, 0xfe100000, 0x1d080000, 0xaf840000, 0xc5460000, 0xf9b10000,
+        0x5d318000, 0x36e74000, 0xe7896000, 0xa951d000, 0x13a31800, 0x4e237c00, 0x6c680200, 0x91540100,
+        0xd7ae0080, 0x982500c0, 0x0d7f8220, 0x6cd24030, 0x85fee3e8, 0xcd0792ac, 0x779bfb7a, 0x5155ee03
+      },
+      { // 169
+        0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0xb8000000, 0x7c000000, 0xae000000, 0x71000000,
+        0xbe800000, 0x11400000, 0xc5a00000, 0x9a100000, 0xfb080000, 0x8d940000, 0xf8c60000, 0xdf770000,
+        0x227f8000, 0x6aedc000, 0xe6a22000, 0xbb9dd000, 0x85cf2800, 0xd7f23400, 0x0e280200, 0x07c40100,
+        0x60ee0280, 0x95b300c0, 0xf21182e0, 0xaf1ec1f0, 0xd793a2b8, 0xe3d311c4, 0xc2f48afa, 0x52a52445
+      },
+      { // 170
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x98000000, 0x1c000000, 0xca000000, 0xab000000,
+        0x73800000, 0x79400000, 0x4de00000, 0x9b100000, 0x7b980000, 0x1d5c0000, 0xcbea0000, 0x62030000,
+        0xbf1b8000, 0xdd854000, 0x545f6000, 0xc77d7000, 0x26dca800, 0xf6a8fc00, 0x19ea0200, 0x15030300,
+        0xe69b8380, 0x5fc54140, 0xf23f6260, 0x392d7070, 0xdaa4ab28, 0xdbe4feac, 0xda1803ce, 0x131c02e5
+      },
+      { // 171
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xa8000000, 0x24000000, 0x52000000, 0x77000000,
+        0x43800000, 0x5fc00000, 0xcaa00000, 0x3f100000, 0x77980000, 0xc5cc0000, 0x49ba0000, 0x86850000,
+        0x7b5c8000, 0x1ee64000, 0x5e64e000, 0x78357000, 0xde4b7800, 0xea7d1400, 0x223a0200, 0x3d450300,
+        0x83fc8180, 0x86f64340, 0xc27ce2a0, 0xc6397090, 0x0f517948, 0x24e815dc, 0x6d7e830e, 0xb9af427f
+      },
+      { // 172
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xc8000000, 0x6c000000, 0xbe000000, 0xbd000000,
+        0xa3800000, 0xd5c00000, 0xa4e00000, 0x65100000, 0x97880000, 0x1fcc0000, 0xb3f60000, 0x61890000,
+        0x8ec58000, 0xce7bc000, 0xb951a000, 0x41a57000, 0x12ab3800, 0x342d5c00, 0x86760200, 0x95490100,
+        0x9fa58180, 0x1fabc2c0, 0x5fb9a320, 0x3fb971b0, 0x8fb53af8, 0x47b85ef4, 0x2bad808e, 0x95a7c257
+      },
+      { // 173
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x78000000, 0x94000000, 0x96000000, 0xf5000000,
+        0xc9800000, 0xad400000, 0xad600000, 0xb1100000, 0xe7980000, 0x2c5c0000, 0xa2ea0000, 0x915f0000,
+        0x176a8000, 0xa61ec000, 0x1d0ca000, 0xc58a3000, 0xff4d2800, 0xb6686c00, 0x198a0200, 0x154f0300,
+        0xd9728380, 0x7702c140, 0x6a86a1e0, 0x71c53250, 0x99bfaa58, 0xc92aafd4, 0x6feca126, 0xecda31b5
+      },
+      { // 174
+        0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x58000000, 0x5c000000, 0x02000000, 0xc9000000,
+        0x55800000, 0x21400000, 0x4d600000, 0x4d100000, 0x4b880000, 0x0a5c0000, 0x61f60000, 0x61db0000,
+        0x7ba38000, 0x082c4000, 0xae772000, 0x7585b000, 0x314da800, 0x4568ec00, 0xf9160200, 0x4d8b0100,
+        0x9d4b8380, 0xff6042c0, 0xdc092160, 0x4202b170, 0x29182808, 0xe59faf24, 0x7942a356, 0x1162f185
+      },
+      { // 175
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x28000000, 0x7c000000, 0x72000000, 0x1b000000,
+        0x62800000, 0x15c00000, 0x68e00000, 0xd9100000, 0x61980000, 0xd35c0000, 0x4b220000, 0x8cf50000,
+        0xcf078000, 0xac8a4000, 0x9cdd6000, 0x016b5000, 0x86583800, 0x60b4dc00, 0x10ba0200, 0xe8a90300,
+        0x5ca58380, 0x42bf4040, 0x03bae0a0, 0x063111f0, 0x037d59c8, 0x65538c6c, 0xb6383b8a, 0x1b64df57
+      },
+      { // 176
+        0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x28000000, 0x24000000, 0xea000000, 0xb9000000,
+        0x5a800000, 0xb9c00000, 0x1b200000, 0xfb100000, 0x87880000, 0xa9540000, 0x2be60000, 0x92b50000,
+        0xe15c8000, 0xdfe14000, 0xc0b52000, 0x64505000, 0x636ab800, 0x0e78a400, 0x76ee0200, 0xc2210100,
+        0x719a8280, 0x864440c0, 0x8e61a0a0, 0x36e51090, 0x62399ba8, 0x419df6e4, 0xae583b6a, 0xaa78e7e7
+      },
+      { // 177
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x08000000, 0xb4000000, 0x2a000000, 0xe5000000,
+        0xab800000, 0xbac00000, 0x09600000, 0xfb100000, 0x24880000, 0x944c0000, 0x88320000, 0x40b10000,
+        0x62ee8000, 0x61d14000, 0xddeaa000, 0xf75a7000, 0x10bad800, 0x4aefec00, 0x25da0200, 0x6fed0100,
+        0xae548180, 0x252c4240, 0x3f362020, 0x623a32d0, 0x85bef8a8, 0x3964df94, 0x430a78ae, 0x68989feb
+      },
+      { // 178
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x98000000, 0xac000000, 0x36000000, 0x69000000,
+        0x38800000, 0x76c00000, 0xf4600000, 0x93100000, 0xf7980000, 0xef440000, 0xfe2e0000, 0x13a30000,
+        0x63fd8000, 0xec4ac000, 0xc1bf2000, 0xb8ee1000, 0x9fce5800, 0x0ce2cc00, 0xc5d60200, 0x73f70300,
+        0xe44b8080, 0xa5adc1c0, 0xcaeca260, 0xf4c7d2b0, 0xc76cf8d8, 0xd4961da4, 0xa0df7ae2, 0xcd6fdedb
+      },
+      { // 179
+        0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x98000000, 0x7c000000, 0x86000000, 0x99000000,
+        0x9c800000, 0x15c00000, 0x3f200000, 0x53100000, 0xbb880000, 0x7c5c0000, 0x587e0000, 0x04e30000,
+        0xb1378000, 0x9e14c000, 0xa5192000, 0xfa829000, 0x7cc03800, 0x3baba400, 0x3ad60200, 0x02af0100,
+        0xb6418380, 0x7f6bc3c0, 0x6d70a260, 0xd66551f0, 0xc9e69a18, 0xafa1f664, 0x18d11872, 0x81b53557
+      },
+      { // 180
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x98000000, 0xfc000000, 0x3a000000, 0xbd000000,
+        0xc4800000, 0x75400000, 0x23200000, 0x43100000, 0x0f980000, 0x8ec40000, 0xa3ee0000, 0x73e30000,
+        0x5bf78000, 0x1feb4000, 0xa9f5a000, 0xb6e99000, 0x33602800, 0xb8ada400, 0x53d60200, 0xf7770300,
+        0xcea18080, 0x6cdc41c0, 0x02f42260, 0xdd65d3f0, 0x7bac08e8, 0x9c5c76f4, 0x59ac0912, 0x1d5c76d5
+      },
+      { // 181
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x38000000, 0x54000000, 0x6a000000, 0x21000000,
+        0x9b800000, 0xbec00000, 0xcba00000, 0x2b900000, 0x96c80000, 0xc7ac0000, 0x459a0000, 0xe5cf0000,
+        0x29268000, 0x0ad74000, 0xb1ab2000, 0x5285f000, 0x09589800, 0x2b765400, 0xfb268200, 0x3fd74100,
+        0x202b2180, 0x9d45f140, 0x617898e0, 0xea265550, 0xcc4e83a8, 0xf2eb4184, 0x68f923ee, 0x01e6f3bb
+      },
+      { // 182
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x68000000, 0x9c000000, 0xea000000, 0x23000000,
+        0xcf800000, 0xb4400000, 0xac600000, 0xe7900000, 0x08580000, 0x767c0000, 0x7c8a0000, 0x33d50000,
+        0xb42f8000, 0x19f74000, 0x38c16000, 0xc7ae7000, 0x77bdc800, 0x0faeec00, 0x1baf8200, 0xbdb74300,
+        0x1ca16380, 0x6c3e7340, 0xfde5c9a0, 0xc6d2ee70, 0x42a581a8, 0x1922438c, 0xcb6ee0be, 0x26193191
+      },
+      { // 183
+        0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0xa8000000, 0xcc000000, 0x7e000000, 0x89000000,
+        0x85800000, 0x56400000, 0x06a00000, 0x69900000, 0x18480000, 0x87b40000, 0x501e0000, 0x981d0000,
+        0xc40d8000, 0xc201c000, 0x5f042000, 0xc0893000, 0xadc50800, 0xd9f1f400, 0xeaad8200, 0x2791c100,
+        0x994c2280, 0xbe3d31c0, 0xd05b0aa0, 0xdbacf730, 0x560003f8, 0x05000324, 0x5b800096, 0xaf400099
+      },
+      { // 184
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x88000000, 0x6c000000, 0x02000000, 0x4d000000,
+        0x7b800000, 0x77c00000, 0x8ae00000, 0x07900000, 0x3dd80000, 0xcbec0000, 0xee020000, 0x8f090000,
+        0x56818000, 0x9c524000, 0x7538a000, 0xe172f000, 0x3846b800, 0xbb2cfc00, 0x5e618200, 0x16c24300,
+        0x5360a180, 0xcd5ef240, 0xd4a4ba20, 0x5fb5fdb0, 0x37380208, 0x0c7c0234, 0xb3da006e, 0xd4e5039f
+      },
+      { // 185
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x88000000, 0x1c000000, 0x9a000000, 0x61000000,
+        0xd4800000, 0xf1400000, 0xaee00000, 0x50900000, 0xdf480000, 0xf9ec0000, 0x270a0000, 0x0f990000,
+        0xf4cf8000, 0xd3294000, 0x9b2d2000, 0xa7211000, 0x8d396800, 0xb437fc00, 0xf4af8200, 0x83f94100,
+        0xd6052180, 0x331d1340, 0xc99b6a20, 0x6fd2fc70, 0xb6a20068, 0x36e50084, 0xe48d82d2, 0xe95c4085
+      },
+      { // 186
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xc8000000, 0xd4000000, 0xb2000000, 0x11000000,
+        0x74800000, 0x83c00000, 0x25a00000, 0x78900000, 0x9dc80000, 0xfaac0000, 0x8b0e0000, 0x01910000,
+        0xed568000, 0x93684000, 0x53ab2000, 0xa38c1000, 0x84423800, 0x9bf49400, 0x46768200, 0xed384100,
+        0x4d432180, 0x437013c0, 0x0ba43b20, 0x4f999750, 0x2a4600c8, 0xecfd0144, 0x91f88052, 0x0b6941cf
+      },
+      { // 187
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0xb8000000, 0x2c000000, 0xe6000000, 0xb5000000,
+        0x90800000, 0x1e400000, 0x1a200000, 0x16900000, 0x3b480000, 0xd2bc0000, 0xf4ca0000, 0x7f7f0000,
+        0x5d298000, 0xb91ec000, 0x0695a000, 0x23519000, 0xceb20800, 0x7ad76400, 0x5e618200, 0x07a2c100,
+        0xf45fa380, 0x392e9340, 0xbb1b8ae0, 0xf189a4b0, 0xa4d42198, 0x876353d4, 0x9125a9c2, 0x8f05f739
+      },
+      { // 188
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x98000000, 0x04000000, 0x62000000, 0x37000000,
+        0x1b800000, 0x43c00000, 0x06200000, 0x69900000, 0x2cd80000, 0x39a40000, 0xd8420000, 0x85eb0000,
+        0x4fb48000, 0xd5564000, 0x8d69e000, 0xe5e5f000, 0x3fad3800, 0xfd59a400, 0x816c8200, 0x1bf24300,
+        0x6eabe080, 0xb3cef240, 0xee39ba60, 0x459fe410, 0x42dd6388, 0xf0b3b3dc, 0x92c4d8ee, 0x88bc574f
+      },
+      { // 189
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0xb8000000, 0xec000000, 0xfe000000, 0xc5000000,
+        0x13800000, 0x58400000, 0x13600000, 0xd5900000, 0xb1580000, 0xdee40000, 0x38de0000, 0x09af0000,
+        0xbf298000, 0x64f9c000, 0xc7c3a000, 0x252df000, 0xebf9c800, 0x53564c00, 0x9df18200, 0x225dc300,
+        0xcc7da080, 0x8912f1c0, 0x5d884ae0, 0x054b8fb0, 0x9cec21f8, 0xcbdf3014, 0x8b2de8ce, 0xe6fd7ca1
+      },
+      { // 190
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x78000000, 0x9c000000, 0x1e000000, 0xc9000000,
+        0x7b800000, 0x74c00000, 0xcde00000, 0x2d900000, 0x79c80000, 0xa46c0000, 0x064e0000, 0xe2a70000,
+        0x04af8000, 0x11a5c000, 0x14222000, 0x59f6f000, 0x97885800, 0x52c61c00, 0xf8e78200, 0xb809c100,
+        0xbc0c2180, 0x8e01f3c0, 0x410fd9e0, 0x9f9fde70, 0xf6c3a278, 0x1af43224, 0x9f05f86e, 0x76952e13
+      },
+      { // 191
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x68000000, 0x5c000000, 0x9e000000, 0x9b000000,
+        0xa3800000, 0x2c400000, 0x4ee00000, 0x49900000, 0x95580000, 0xb8640000, 0x455e0000, 0x60750000,
+        0x515f8000, 0xd265c000, 0x3c4a6000, 0xb6e9f000, 0x2d8f4800, 0x4f473c00, 0x89678200, 0xbfd1c300,
+        0xeaac6080, 0x0b68f1c0, 0x5ad6c9a0, 0x8233fd70, 0x9cac6078, 0x0c68f16c, 0x4756ca0e, 0x4573fd71
+      },
+      { // 192
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x28000000, 0xc4000000, 0xa2000000, 0x25000000,
+        0x46800000, 0x3d400000, 0x10200000, 0x28900000, 0x2e580000, 0x59b40000, 0x22420000, 0xcfbd0000,
+        0xbd5c8000, 0xd03e4000, 0x8885a000, 0xbe5a5000, 0x71a2e800, 0xe65c2400, 0x6da48200, 0x985a4300,
+        0x96bfa280, 0xb5c35240, 0xae6468a0, 0x592b6710, 0xc81fa088, 0x34135394, 0xba1c6b9a, 0x590f66b5
+      },
+      { // 193
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x98000000, 0x5c000000, 0x3a000000, 0xc5000000,
+        0x02800000, 0x9cc00000, 0xc4200000, 0x8c900000, 0x57c80000, 0x4dbc0000, 0x79da0000, 0x36bb0000,
+        0x38478000, 0x07e54000, 0x3f27a000, 0x8d19d000, 0x8693d800, 0x1adda400, 0x6b2f8200, 0xd3094100,
+        0x9595a380, 0x2f4ed140, 0xf4665a60, 0xef6fe570, 0xbefda2e8, 0xf7a2d214, 0xfcd45b8a, 0xd438e733
+      },
+      { // 194
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xc8000000, 0x1c000000, 0x82000000, 0x89000000,
+        0x5e800000, 0x1c400000, 0x29e00000, 0x97900000, 0xa2d80000, 0xa5a40000, 0xc6660000, 0xe1510000,
+        0x997f8000, 0x68d24000, 0xf0a62000, 0x3ae55000, 0xc40e4800, 0x26015c00, 0xff198200, 0xf9834300,
+        0x81d9a080, 0xfe3712c0, 0x7ea86b20, 0x89e40c70, 0xe797c808, 0x4ac21d24, 0x09a023fa, 0x8c6451b1
+      },
+      { // 195
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x48000000, 0xdc000000, 0xce000000, 0xdf000000,
+        0x5b800000, 0x59400000, 0x08600000, 0x94900000, 0xdac80000, 0x152c0000, 0x76e60000, 0xcb510000,
+        0x597f8000, 0x7013c000, 0x680ce000, 0x0c15f000, 0x361f6800, 0x4b0a2c00, 0x49998200, 0x4842c100,
+        0x8cf36180, 0x964632c0, 0x8bf38920, 0x89cfdf70, 0x38aee938, 0x04b4ee7c, 0x3aa4e2ee, 0xcda9f2a5
+      },
+      { // 196
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x38000000, 0xec000000, 0x42000000, 0x19000000,
+        0x0d800000, 0x01c00000, 0xf4600000, 0xe8900000, 0x96480000, 0x70b40000, 0xbb6a0000, 0xb21f0000,
+        0xb1018000, 0x79864000, 0x7fde2000, 0x977b3000, 0x1005f800, 0xd81dec00, 0x9c0b8200, 0xaa094100,
+        0xcd17a280, 0xa3897340, 0x5ad1d8e0, 0xe0e9dfb0, 0xe4c7fb08, 0x63e6ed64, 0x6c4800b6, 0xc5b40247
+      },
+      { // 197
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x18000000, 0x0c000000, 0x92000000, 0xb3000000,
+        0xa8800000, 0xacc00000, 0xc9600000, 0x27900000, 0x1e480000, 0xa2ac0000, 0x086a0000, 0xac1b0000,
+        0x62058000, 0x1b044000, 0x6c8f6000, 0x2ad79000, 0xe4665800, 0xae0d0c00, 0xa90f8200, 0x6f8f4100,
+        0x4a42e180, 0x5cbfd340, 0xf9633860, 0xaf919c30, 0x6a445848, 0xecba0fcc, 0x31600122, 0xbb9000f3
+      },
+      { // 198
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0xa8000000, 0x4c000000, 0x9e000000, 0x5b000000,
+        0xaa800000, 0xb5400000, 0xfca00000, 0x05900000, 0xa5d80000, 0x60f40000, 0x06a20000, 0x4c9d0000,
+        0x6a458000, 0xb435c000, 0x4ddc6000, 0x4cf1d000, 0xa8a8e800, 0x2f9d3400, 0x24c78200, 0xd378c300,
+        0x7461e280, 0xb8e01240, 0x12ae8aa0, 0x0695e530, 0xdb50e878, 0x3fb9366c, 0xdb1d822a, 0x6a81c395
+      },
+      { // 199
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x88000000, 0x8c000000, 0x3a000000, 0x17000000,
+        0xa3800000, 0x58c00000, 0xa3200000, 0x2e900000, 0xfc480000, 0x806c0000, 0xe1760000, 0x4fe90000,
+        0xf3a58000, 0x13d54000, 0xc2b1e000, 0x054ef000, 0x7ae2d800, 0x532d4400, 0x869b8200, 0x20504100,
+        0x02626180, 0xf272b0c0, 0x5a76ba20, 0x8676f630, 0x0468bae8, 0x1763f55c, 0x02f3390e, 0x7733b4a3
+      },
+      { // 200
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xc8000000, 0x34000000, 0x2a000000, 0xeb000000,
+        0x2b800000, 0xde400000, 0x0f200000, 0xf2900000, 0x22d80000, 0x84ec0000, 0xb2fa0000, 0xd7f10000,
+        0x95628000, 0xefab4000, 0xf74a6000, 0x0ba4f000, 0xd5570800, 0xb4b44400, 0x84c08200, 0x49f64300,
+        0x9472e180, 0x4f2eb140, 0x5287eb20, 0x12c7f4d0, 0x1cffeaa8, 0x4efbf4ac, 0xc9fdeb2e, 0x5476f539
+      },
+      { // 201
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x08000000, 0x24000000, 0xe2000000, 0x35000000,
+        0xd6800000, 0x9ec00000, 0x04a00000, 0x45900000, 0x0f480000, 0x91fc0000, 0xfd6a0000, 0x3ab90000,
+        0xce808000, 0x12d24000, 0xf2a1a000, 0x4a955000, 0xc0c21800, 0x1fa2f400, 0xb0028200, 0x98074100,
+        0xcc032380, 0x16021340, 0xdf093820, 0xc79ce490, 0xaa41b988, 0xaf72a5d4, 0x97aa1ada, 0xd40ef43b
+      },
+      { // 202
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0xd8000000, 0x34000000, 0x3e000000, 0xfd000000,
+        0xb2800000, 0xb8400000, 0x6da00000, 0xfd900000, 0x8dc80000, 0x4c740000, 0x1be20000, 0xc5230000,
+        0x1eca8000, 0x3be9c000, 0x1532a000, 0x66c1d000, 0x9ff14800, 0xf3255400, 0xafc08200, 0x136ec100,
+        0xb6722280, 0x70ef1240, 0x56a36b60, 0x561a44d0, 0xc10beaf8, 0xc09086f4, 0xdf53ca4a, 0xc42895a1
+      },
+      { // 203
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0xc8000000, 0x3c000000, 0x42000000, 0x31000000,
+        0x84800000, 0x6b400000, 0x68600000, 0xeb500000, 0xa8780000, 0x4b440000, 0x186e0000, 0x835d0000,
+        0x24698000, 0xc1554000, 0x156fa000, 0x45c5d000, 0x7e22c800, 0x2da8dc00, 0x956fa200, 0x85c5d300,
+        0xde22ca80, 0x9da8dec0, 0x5d6fa120, 0xb9c5d3f0, 0x9c22cb88, 0xaca8de04, 0xd9efa332, 0xd285d25d
+      },
+      { // 204
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xd8000000, 0x5c000000, 0xd6000000, 0xb5000000,
+        0x7d800000, 0x88400000, 0xb6200000, 0x28500000, 0x66280000, 0x605c0000, 0x12360000, 0x32470000,
+        0x2d3d8000, 0x2cddc000, 0x6deb2000, 0x6f327000, 0x7bca2800, 0x977cb400, 0x55eb2200, 0x83327100,
+        0x15ca2980, 0x8e7cb7c0, 0x266b2160, 0xe2727070, 0x086a2ad8, 0x9b6cb514, 0x8be32096, 0x223e7251
+      },
+      { // 205
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xc8000000, 0x24000000, 0xbe000000, 0xf9000000,
+        0xda800000, 0xe7400000, 0x53a00000, 0xef500000, 0x57a80000, 0x815c0000, 0xd6be0000, 0xb7c50000,
+        0xabfa8000, 0xa372c000, 0x6735a000, 0xc9019000, 0x52954800, 0xa345e400, 0x5db5a200, 0xde419100,
+        0xa9354980, 0xd815e6c0, 0x7c1da120, 0x821d9190, 0x1b0b4b78, 0x7190e524, 0x5ec7224a, 0x297f520d
+      },
+      { // 206
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x48000000, 0x1c000000, 0xde000000, 0x35000000,
+        0x64800000, 0x59400000, 0xafa00000, 0xb1500000, 0x03b80000, 0x07540000, 0x5ab60000, 0xf5dd0000,
+        0x2af58000, 0xe0e6c000, 0xf7e32000, 0x28725000, 0x18ac0800, 0xdec9a400, 0x5b632200, 0xad325300,
+        0x490c0880, 0x2a99a5c0, 0x745b2320, 0xef265370, 0x621a0bf8, 0x5b14a514, 0x3996a2b2, 0x51d49215
+      },
+      { // 207
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x68000000, 0xac000000, 0x76000000, 0xad000000,
+        0x0e800000, 0xda400000, 0x74e00000, 0xe6500000, 0xaaf80000, 0x875c0000, 0xc27a0000, 0x98110000,
+        0x140f8000, 0xd20fc000, 0x67022000, 0xbd821000, 0xd5db6800, 0xd6218c00, 0xe5e22200, 0x36d21300,
+        0x11a36980, 0x9b3d8c40, 0x3b7823a0, 0xe49311b0, 0xd954e858, 0x636e4ef4, 0x9080039a, 0x1b4002d9
+      },
+      { // 208
+        0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x18000000, 0xdc000000, 0xc6000000, 0x61000000,
+        0xa9800000, 0x2ec00000, 0xd8e00000, 0x18d00000, 0xe1e80000, 0x8d4c0000, 0x79260000, 0x2caf0000,
+        0x146d8000, 0x259fc000, 0x20cda000, 0xedfcf000, 0xc34f7800, 0xac266c00, 0x8725a200, 0x41b0f100,
+        0xf3e97b80, 0xde496dc0, 0x53a82260, 0xa0ff3270, 0xf4ccd898, 0xdff99c44, 0x404158c6, 0x0eb65ecb
+      },
+      { // 209
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x88000000, 0x0c000000, 0xea000000, 0xf7000000,
+        0x80800000, 0x57c00000, 0x53200000, 0x31d00000, 0x0e280000, 0xa64c0000, 0x09720000, 0x2abd0000,
+        0x67838000, 0xff584000, 0x38f96000, 0xd0f65000, 0x4cfc9800, 0xcee2b400, 0xe5f16200, 0x076a5100,
+        0xaba69b80, 0x9213b740, 0x0300e020, 0xde8f1130, 0x1edc7828, 0x4abda49c, 0xf7851a22, 0x975bf46f
+      },
+      { // 210
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0xc8000000, 0x4c000000, 0x7e000000, 0x43000000,
+        0xbc800000, 0xa9400000, 0x44e00000, 0xcb500000, 0x41f80000, 0x50cc0000, 0x563e0000, 0x48750000,
+        0x6a078000, 0xa912c000, 0xd59be000, 0x9cc75000, 0xe82dc800, 0xeb694c00, 0xe683e200, 0xc85b5300,
+        0xdd6bcb80, 0x29904cc0, 0xeada6120, 0x072c9230, 0x19efaa78, 0xc4d9ddcc, 0x7c2a4bd2, 0xc17b8c95
+      },
+      { // 211
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xb8000000, 0x24000000, 0x7e000000, 0x73000000,
+        0x08800000, 0xf9c00000, 0x62a00000, 0x4bd00000, 0x33b80000, 0x4a540000, 0x1fe20000, 0x12a30000,
+        0xe3d68000, 0x8fa4c000, 0xc044e000, 0xaafbd000, 0x4d36d800, 0x6c940400, 0x67dce200, 0xe1bfd300,
+        0x2b4cd880, 0x56730740, 0x72f060e0, 0x593c1390, 0x5a84b978, 0x58db168c, 0x0b36d8c2, 0xfb940477
+      },
+      { // 212
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x48000000, 0x6c000000, 0xc6000000, 0x67000000,
+        0x1a800000, 0xe6400000, 0xc0e00000, 0xd4500000, 0x15f80000, 0xdbc40000, 0x5c3e0000, 0x62ed0000,
+        0x79438000, 0x3e7dc000, 0x38036000, 0x440c9000, 0x3a00a800, 0xd9080c00, 0x599b6200, 0x56d89300,
+        0x87a6aa80, 0x69310cc0, 0x3d7ee320, 0xe89c52b0, 0x93404998, 0xff795d5c, 0xd598ab4a, 0xc0dc0d29
+      },
+      { // 213
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0xc8000000, 0x84000000, 0x4e000000, 0x9f000000,
+        0xa3800000, 0x77400000, 0x9e600000, 0x88500000, 0xade80000, 0xd70c0000, 0x67920000, 0xd9450000,
+        0xd16a8000, 0xe3c0c000, 0x5eab6000, 0x0771b000, 0x70df0800, 0xd72abc00, 0x71396200, 0x1a34b100,
+        0x0fb58b80, 0x7bea7f40, 0x44120120, 0xee050310, 0xaf0a82b8, 0xbb90c13c, 0x3b4361ae, 0x547db3cd
+      },
+      { // 214
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x48000000, 0x6c000000, 0x12000000, 0xef000000,
+        0x17800000, 0x3a400000, 0x80600000, 0x1d500000, 0x3bf80000, 0x15140000, 0xc48a0000, 0x57cd0000,
+        0xa93f8000, 0xd0bb4000, 0x9ff86000, 0xab0cb000, 0x1994a800, 0x3f4dfc00, 0xccf26200, 0x0681b300,
+        0x10cb2880, 0x62a6be40, 0x20f20320, 0xd49902b0, 0xdfd580c8, 0xe52641fc, 0x52bfe17e, 0x38e3f159
+      },
+      { // 215
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x68000000, 0xc4000000, 0x46000000, 0x45000000,
+        0xbb800000, 0xbf400000, 0x00200000, 0x82500000, 0x27b80000, 0xb71c0000, 0x10860000, 0xe5c10000,
+        0xb2e68000, 0x1035c000, 0xda582000, 0xebabb000, 0xc51d4800, 0x7b9c7400, 0xdf5e2200, 0xf02ab300,
+        0xea5bc980, 0xe3b9b7c0, 0xf11e03a0, 0x558d0010, 0x5e588098, 0x0da8c2d4, 0x1018a34e, 0x580f71ed
+      },
+      { // 216
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x88000000, 0x5c000000, 0x7e000000, 0xad000000,
+        0xc4800000, 0x7bc00000, 0xeee00000, 0xead00000, 0xc4780000, 0xe4140000, 0x4a160000, 0xdf150000,
+        0xef858000, 0xc65ec000, 0x73be2000, 0xace75000, 0xa9d2d800, 0x75f94c00, 0xff482200, 0x75225300,
+        0x542f5880, 0xd6b38dc0, 0xf4600020, 0x8c100270, 0x46180178, 0x59040374, 0x968e0132, 0x20d1009f
+      },
+      { // 217
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x88000000, 0xbc000000, 0xfa000000, 0xd9000000,
+        0xb8800000, 0x14400000, 0x14600000, 0x61500000, 0xbee80000, 0xe0140000, 0xb0120000, 0x78150000,
+        0xe40d8000, 0xce0e4000, 0x9f0ca000, 0x9b885000, 0x75d9a800, 0xb8b59c00, 0x617ea200, 0xcbcd5100,
+        0x3fbc2880, 0xeeefdf40, 0x28000020, 0x2c0003f0, 0x52000368, 0xb5000024, 0xca8000c2, 0x714002a1
+      },
+      { // 218
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x18000000, 0x4c000000, 0xc6000000, 0x5f000000,
+        0xc9800000, 0xee400000, 0xf1200000, 0xa5500000, 0x92b80000, 0xe20c0000, 0x3d020000, 0x349f0000,
+        0x3ad38000, 0x1bfbc000, 0xa6b26000, 0x7809f000, 0x5c122800, 0x3e011400, 0xc3106200, 0x1786f300,
+        0xfd59ab80, 0xfea6d740, 0x14180260, 0xaa1c0230, 0xa91a0098, 0x5e83023c, 0x73c98346, 0x9578c289
+      },
+      { // 219
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x78000000, 0x1c000000, 0x5a000000, 0xdd000000,
+        0x3e800000, 0x77c00000, 0x08600000, 0x6ed00000, 0x00e80000, 0xc6140000, 0xc70e0000, 0xc38b0000,
+        0x79458000, 0x07a44000, 0x7aa82000, 0x34349000, 0x1be95800, 0x3f9cdc00, 0x73462200, 0xb2af9100,
+        0x1024d880, 0x7dfc9cc0, 0x888803e0, 0xe8c40170, 0xe7e601e8, 0x359f03b4, 0xc64b811a, 0xd82f41af
+      },
+      { // 220
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x38000000, 0x2c000000, 0xba000000, 0xf7000000,
+        0xd6800000, 0x16400000, 0xf6e00000, 0x83500000, 0xeb780000, 0xa19c0000, 0x00c20000, 0x80ab0000,
+        0xa5af8000, 0x50384000, 0x66ff6000, 0x1b539000, 0x77752800, 0xf3808c00, 0xe3c56200, 0xc0249300,
+        0xfef8a980, 0x8743cf40, 0x256d82e0, 0x109343b0, 0xa350e368, 0x9b6bd09c, 0x298a4bba, 0xc4d31ce9
+      },
+      { // 221
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x38000000, 0xdc000000, 0x42000000, 0x61000000,
+        0x80800000, 0x2b400000, 0xd2200000, 0x20500000, 0x47a80000, 0xfd940000, 0x89d60000, 0x48630000,
+        0xbaf58000, 0xa8b74000, 0xf60ba000, 0x770a5000, 0x67944800, 0xa4c8d400, 0x62f5a200, 0xe4bd5100,
+        0x5c17c880, 0x020c97c0, 0x410382e0, 0x70844270, 0x13562188, 0x0e291244, 0x6249eae2, 0x26a187dd
+      },
+      { // 222
+        0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0xe8000000, 0x6c000000, 0xba000000, 0x5b000000,
+        0x4e800000, 0x76400000, 0xb0a00000, 0x8b500000, 0xb7280000, 0x648c0000, 0x75560000, 0x9a210000,
+        0xdb038000, 0x0e824000, 0x965ae000, 0x40a09000, 0x6348a800, 0xdb3a4400, 0xde84e200, 0x2e5d9100,
+        0xd4b52b80, 0xad5507c0, 0xbe2b81a0, 0x1d0e40b0, 0xf78ce168, 0x07c192ac, 0xae6b2a9a, 0x44a80469
+      },
+      { // 223
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x18000000, 0x8c000000, 0x12000000, 0x7b000000,
+        0x6c800000, 0x20c00000, 0x17e00000, 0x95d00000, 0xda680000, 0xa6940000, 0xb7de0000, 0xf9670000,
+        0x66178000, 0x35094000, 0x8d9ae000, 0x1359d000, 0xdda87800, 0x47eeec00, 0x5dcce200, 0xde7ad100,
+        0x9089f880, 0x4ad4aec0, 0x70ff8260, 0x435d4330, 0x15a4e0c8, 0x43eed32c, 0x6bd7f9d2, 0x2373aeb3
+      },
+      { // 224
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x98000000, 0x14000000, 0xd2000000, 0xdf000000,
+        0x2a800000, 0xf0400000, 0xd5e00000, 0xf1500000, 0x26780000, 0x86840000, 0x664a0000, 0xe0e70000,
+        0x80c08000, 0xb6b14000, 0x683d6000, 0xba651000, 0x188ae800, 0xdf436c00, 0x576f6200, 0x1d161300,
+        0xad986a80, 0x6ec12e40, 0x67a08060, 0x63a14350, 0xe9a561c8, 0x82b1113c, 0xea38eaca, 0x5d606f91
+      },
+      { // 225
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0xe8000000, 0x14000000, 0x96000000, 0xd5000000,
+        0x85800000, 0x66c00000, 0xa3600000, 0xc9d00000, 0xb9e80000, 0xcd9c0000, 0x82d20000, 0x6d710000,
+        0x30c88000, 0x5667c000, 0xfc442000, 0xe7307000, 0x92f77800, 0xc9045c00, 0x979e2200, 0xadcd7100,
+        0x37e5f980, 0x549e9f40, 0xbd4881a0, 0xb4a7c150, 0x412423d8, 0x3fe07014, 0xd09f79b6, 0xa3585dcb
+      },
+      { // 226
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0xe8000000, 0xdc000000, 0x66000000, 0x81000000,
+        0x3a800000, 0x48c00000, 0x32200000, 0xb2500000, 0x9ae80000, 0xb0640000, 0x50aa0000, 0x1e910000,
+        0x5ad58000, 0xa937c000, 0xffd4a000, 0x81a51000, 0x2c0a7800, 0xfe07f400, 0x85012200, 0xf892d100,
+        0x9bdeda80, 0x33a2e640, 0x270b59a0, 0x5b952670, 0x425ff918, 0x02f03544, 0xb47583ca, 0x92a7c113
+      },
+      { // 227
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x98000000, 0x8c000000, 0xe6000000, 0xb5000000,
+        0xa8800000, 0xf1c00000, 0x5aa00000, 0x29500000, 0x73680000, 0x9ffc0000, 0x4c260000, 0xc1870000,
+        0xf74b8000, 0x9a7dc000, 0xd97a2000, 0xecf35000, 0xc1b1d800, 0xf0de2400, 0x4831a200, 0x838e9100,
+        0xd04bf980, 0x1ded77c0, 0x4b207860, 0xd600b730, 0x0d125818, 0xb49fe414, 0x7fcd8342, 0xfbaac337
+      },
+      { // 228
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xe8000000, 0x94000000, 0x16000000, 0x57000000,
+        0xdf800000, 0x10400000, 0x99a00000, 0xa7d00000, 0xddf80000, 0x08740000, 0x3d2a0000, 0xe2110000,
+        0xb10c8000, 0x5099c000, 0xa3c76000, 0xe3f6b000, 0xeb68a800, 0xe4a8e400, 0x4d4be200, 0x632f7300,
+        0xf10fc880, 0xb08e5440, 0x93db49a0, 0x1bf39550, 0x976e2ad8, 0x66b0261c, 0x0c58025e, 0xeba40151
+      },
+      { // 229
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x68000000, 0x24000000, 0x4a000000, 0xef000000,
+        0x6d800000, 0x7fc00000, 0xaf600000, 0x9e500000, 0xdea80000, 0xa4340000, 0xba7a0000, 0x24d10000,
+        0xa0ea8000, 0x0a924000, 0x465e6000, 0xc2a97000, 0x822dd800, 0x2b79fc00, 0x8454e200, 0x79ab3100,
+        0xfdbbb880, 0xe7b48c40, 0x40ab3ba0, 0x1937cd90, 0x44ffdba8, 0x209cfefc, 0x99446296, 0xd728702f
+      },
+      { // 230
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x78000000, 0x84000000, 0x22000000, 0x55000000,
+        0xfa800000, 0x03400000, 0xc9200000, 0x95d00000, 0x04680000, 0x87e40000, 0x10260000, 0xf1430000,
+        0x54328000, 0x33514000, 0x51232000, 0x41c09000, 0xae680800, 0x2ee39400, 0x4cb1a200, 0x8501d100,
+        0x32832a80, 0x5f5707c0, 0x9f37abe0, 0x9ad54710, 0x2fee0808, 0x5c309794, 0x8f4b228a, 0x572490dd
+      },
+      { // 231
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0xc8000000, 0x74000000, 0x52000000, 0x59000000,
+        0x14800000, 0xc9400000, 0xfe600000, 0x0fd00000, 0x2e280000, 0x45240000, 0x58ae0000, 0x5d750000,
+        0x66548000, 0x79f94000, 0x270ea000, 0x53815000, 0xcadbc800, 0xeca4bc00, 0xef722200, 0x2f5c1100,
+        0x157b6a80, 0x5250eec0, 0x8bfd6920, 0xce01ecd0, 0x8f07e9c8, 0x778daea4, 0x40ddcbf2, 0xb9b5bd35
+      },
+      { // 232
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xd8000000, 0xbc000000, 0x2a000000, 0xf9000000,
+        0x14800000, 0xec400000, 0x72a00000, 0xa2d00000, 0x9fe80000, 0xa8fc0000, 0x936e0000, 0xd8af0000,
+        0x1bd58000, 0xeb6c4000, 0xf4b9a000, 0x39c55000, 0xc66f6800, 0xae2b2400, 0xba842200, 0x73551100,
+        0x0d38c980, 0xaf0176c0, 0xe79ec960, 0xd1c277f0, 0xe26d4b28, 0x582d3424, 0xd98768b2, 0x46d72681
+      },
+      { // 233
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x08000000, 0x64000000, 0x56000000, 0x8d000000,
+        0x60800000, 0x5c400000, 0x73200000, 0x92d00000, 0x8e680000, 0xd37c0000, 0xebf60000, 0xcbb50000,
+        0xf2968000, 0xd741c000, 0x86be2000, 0xb2155000, 0x9b156800, 0x8d999400, 0x4cc0a200, 0x27689100,
+        0x85fd4980, 0x4aa9c5c0, 0xd00b4a20, 0x581cc490, 0x7c1dcad8, 0x4a1d06f4, 0xb703ea22, 0xdf985421
+      },
+      { // 234
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x18000000, 0x2c000000, 0x92000000, 0x27000000,
+        0xfe800000, 0xcec00000, 0xdfa00000, 0x4a500000, 0x72780000, 0x7d640000, 0x67ea0000, 0xaf3f0000,
+        0xf99b8000, 0xe05f4000, 0xa9746000, 0xa9f91000, 0xb221f800, 0x040b0400, 0x7617e200, 0x21025300,
+        0x779f9a80, 0x9d5d1440, 0xe4f59a60, 0x37a217b0, 0x0e4e1ac8, 0x646d57dc, 0xec627b1a, 0x186044cb
+      },
+      { // 235
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x48000000, 0xbc000000, 0x26000000, 0x39000000,
+        0x41800000, 0x49c00000, 0x05200000, 0xf2500000, 0x23f80000, 0x27ec0000, 0xd5fe0000, 0x26fd0000,
+        0x80758000, 0x452fc000, 0xd25ba000, 0x73e07000, 0xdfee5800, 0x21ebf400, 0xbcf62200, 0x9f73b300,
+        0x3db3fb80, 0xda1a86c0, 0x3f13fb20, 0x288a85f0, 0xf04bf918, 0xb8f68524, 0x6d6df9a6, 0xceb78617
+      },
+      { // 236
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x48000000, 0xd4000000, 0xba000000, 0xf9000000,
+        0x67800000, 0x28c00000, 0xfa600000, 0x91500000, 0xe9b80000, 0x99b40000, 0xc1b20000, 0x7da50000,
+        0xc3ac8000, 0xc8a84000, 0x823aa000, 0x777e3000, 0x5cc8f800, 0x506e5c00, 0x004e2200, 0x8a327300,
+        0x43785880, 0x16c16f40, 0x31785b20, 0xfbc16c50, 0xccf85868, 0xfa016fa4, 0x19185a3e, 0x97916fb3
+      },
+      { // 237
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x68000000, 0xf4000000, 0x0e000000, 0x47000000,
+        0xfc800000, 0xd0c00000, 0x17600000, 0x0e500000, 0xc2a80000, 0x90a40000, 0xcdaa0000, 0x48210000,
+        0xdb608000, 0x7c52c000, 0x4fb56000, 0xdd3bd000, 0x3aeab800, 0x890bdc00, 0x5b9de200, 0x1c5d1100,
+        0x3fbdda80, 0x85250e40, 0x36f5dba0, 0x1b110ed0, 0xe697d8b8, 0xa9c40e5c, 0x54f55ad2, 0xbe13cfd3
+      },
+      { // 238
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0xf8000000, 0xec000000, 0xbe000000, 0x65000000,
+        0xd2800000, 0x40c00000, 0x08600000, 0x57500000, 0x6a280000, 0x57fc0000, 0xf1020000, 0xc09b0000,
+        0xfbcb8000, 0x6ff2c000, 0x3d1e2000, 0xce981000, 0xb6df7800, 0xa96dfc00, 0x2fd7a200, 0x1df1d100,
+        0x560ad980, 0x51072f40, 0x3096f9e0, 0xb3c43eb0, 0xabe20178, 0x970b03d4, 0xf983812a, 0xbf5ec1f3
+      },
+      { // 239
+        0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0xe8000000, 0x0c000000, 0xa2000000, 0x9f000000,
+        0x4a800000, 0x33c00000, 0xcc600000, 0x16500000, 0xfd280000, 0x35ec0000, 0x5d1e0000, 0xa5890000,
+        0x715b8000, 0xc3af4000, 0x903f6000, 0x78649000, 0x2045d800, 0xc4313c00, 0x7e7ae200, 0xf142d100,
+        0x83a13b80, 0x703aecc0, 0x486059a0, 0xc8477d30, 0xc8360308, 0xdc6503bc, 0x6e45810a, 0xc926403f
+      },
+      { // 240
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0xf8000000, 0xd4000000, 0xba000000, 0x21000000,
+        0x37800000, 0x52c00000, 0x59a00000, 0x7c500000, 0x48e80000, 0x7d2c0000, 0xe4120000, 0x520b0000,
+        0xed0c8000, 0x09824000, 0x31c1a000, 0x9b2b3000, 0xa3093800, 0x6281e400, 0x6f5f2200, 0x82627100,
+        0x3e641b80, 0x08789540, 0xf77fb9e0, 0xf3e4a650, 0x9ba00368, 0xc95000c4, 0x256800be, 0x5eec035b
+      },
+      { // 241
+        0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x28000000, 0xbc000000, 0x9e000000, 0x89000000,
+        0x58800000, 0x07400000, 0xb5200000, 0x1ed00000, 0x26f80000, 0x7abc0000, 0x081e0000, 0xac110000,
+        0x660d8000, 0xad00c000, 0x5283a000, 0xac4f5000, 0xfaa20800, 0xc81c9400, 0xcc102200, 0xd61e9300,
+        0x850c2980, 0xee8306c0, 0x32498aa0, 0x73b155f0, 0x908001f8, 0xcb4003e4, 0x63200042, 0x9bd0002d
+      },
+      { // 242
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x78000000, 0x14000000, 0xa2000000, 0xbd000000,
+        0x53800000, 0x4ec00000, 0x22a00000, 0x84500000, 0x55f80000, 0x49240000, 0xbe920000, 0xa5430000,
+        0xd86c8000, 0xd4f14000, 0x14b22000, 0x5b40b000, 0x1b7c3800, 0x84688400, 0xaaeca200, 0x17a2f300,
+        0xabda9a80, 0x753d7740, 0xb090bbe0, 0x0e59c750, 0x44fe8208, 0x0cb242b4, 0x3f5ea22e, 0x1171f22b
+      },
+      { // 243
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xe8000000, 0x4c000000, 0x6e000000, 0x47000000,
+        0x6f800000, 0xf9c00000, 0xede00000, 0x55500000, 0x69b80000, 0x707c0000, 0xcd9a0000, 0x10c90000,
+        0xa5778000, 0x5312c000, 0x95846000, 0x84c5b000, 0x9f681800, 0x4e15ac00, 0x7709e200, 0x778e7300,
+        0xcdc3f980, 0x27eede40, 0x304799a0, 0x2f2b6e30, 0xa12f8238, 0xb63ec05c, 0x51a6639e, 0x7470b097
+      },
+      { // 244
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x08000000, 0xec000000, 0x12000000, 0xfd000000,
+        0x91800000, 0x21400000, 0x93600000, 0xd9d00000, 0x05a80000, 0x00fc0000, 0x4d8a0000, 0x8b450000,
+        0x7a638000, 0x2e414000, 0x2feb2000, 0x0111f000, 0xcb83c800, 0x5052fc00, 0x80e2a200, 0x0d85b100,
+        0xeb436980, 0xea6e4e40, 0x26484a20, 0xc3efbeb0, 0x130383c8, 0x369140b4, 0xc1c323e6, 0xa1adf175
+      },
+      { // 245
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x98000000, 0x14000000, 0x66000000, 0xcd000000,
+        0x2d800000, 0xf1c00000, 0x2d600000, 0x27500000, 0x64380000, 0xe2740000, 0x29d20000, 0xd96f0000,
+        0xb14c8000, 0xe13dc000, 0x43fc2000, 0xaa19f000, 0x5f045800, 0x76853c00, 0x595aa200, 0x7d3f3300,
+        0x89e6f880, 0xc50e0f40, 0x418e5860, 0x73ce3f50, 0xce7c2318, 0x4bd9f374, 0xca645a56, 0x95d53cd7
+      },
+      { // 246
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x28000000, 0xbc000000, 0x7e000000, 0xab000000,
+        0x0e800000, 0x0a400000, 0x97600000, 0xa9d00000, 0x8cb80000, 0x086c0000, 0x554a0000, 0x8be10000,
+        0xbe998000, 0x1250c000, 0xf37be000, 0x53cb9000, 0xcda6e800, 0x6ffddc00, 0x84906200, 0xb3565300,
+        0x84ee8b80, 0xaa178c40, 0x490ceaa0, 0x2b8cddf0, 0x97d1e078, 0x07ba91ec, 0xf6e76b1a, 0x67111e99
+      },
+      { // 247
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x48000000, 0x5c000000, 0x5a000000, 0x0d000000,
+        0x98800000, 0x1d400000, 0x99e00000, 0xcad00000, 0xf5280000, 0xf8fc0000, 0x004e0000, 0xd96d0000,
+        0x13818000, 0x92dc4000, 0x712f2000, 0x66f5d000, 0xf3584800, 0x02ee0c00, 0x9d48a200, 0xd9f89100,
+        0xaad8e980, 0x453a9ec0, 0xb0f64b20, 0x5c530c70, 0x836122e8, 0x1e98d3f4, 0x0a59cac2, 0x6c724fc5
+      },
+      { // 248
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x98000000, 0xb4000000, 0xb2000000, 0xf9000000,
+        0x4b800000, 0xa9400000, 0x50e00000, 0xfdd00000, 0x69280000, 0xfef40000, 0xfac60000, 0x0dbf0000,
+        0x3f3c8000, 0x9de34000, 0x4446a000, 0x197bb000, 0x15854800, 0x364fcc00, 0x80742200, 0x8e03f100,
+        0xf7116880, 0xfc9c3fc0, 0x75cd4860, 0xd52bcfd0, 0xb0fa2048, 0x6dd8f124, 0x2123ebce, 0x22e47fb5
+      },
+      { // 249
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x28000000, 0xd4000000, 0x92000000, 0x6d000000,
+        0x58800000, 0x75c00000, 0x9da00000, 0x36500000, 0xf7e80000, 0x77bc0000, 0xe7420000, 0x89610000,
+        0x2d7c8000, 0x67754000, 0x46662000, 0xa0edd000, 0xd63a5800, 0x38048400, 0xdc10a200, 0xf6159100,
+        0x070af980, 0xc9811740, 0x6b525aa0, 0x17788650, 0x9e72a1c8, 0xece493f4, 0x683e7842, 0x3b1855c7
+      },
+      { // 250
+        0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x78000000, 0x0c000000, 0x26000000, 0x83000000,
+        0xa8800000, 0xb3400000, 0x80a00000, 0x70b00000, 0xe8b80000, 0x74ac0000, 0x1aaa0000, 0xeda50000,
+        0x6f248000, 0x79604000, 0xd2502000, 0xb9353000, 0x627b5800, 0xe6d74c00, 0x647b5a00, 0x15d74d00,
+        0x14fb5880, 0x9a974dc0, 0xca5b5960, 0x65274df0, 0xac6359f8, 0x21cb4ffc, 0x9ee95b5a, 0x0f9e4d31
+      },
+      { // 251
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x18000000, 0xc4000000, 0xe6000000, 0xc7000000,
+        0x5b800000, 0xdc400000, 0xb9a00000, 0x09b00000, 0x01a80000, 0x3db40000, 0xcfae0000, 0xf6ad0000,
+        0xae358000, 0xcfe94000, 0x6d11a000, 0x868ad000, 0x52c95800, 0xd7626c00, 0x2cc95a00, 0x14626f00,
+        0x71495980, 0xdf226c40, 0x8b6959e0, 0xced26f50, 0xd5615a78, 0x3dd66c4c, 0x40e75b16, 0x2a8f6f3d
+      },
+      { // 252
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x28000000, 0xf4000000, 0x4e000000, 0xbd000000,
+        0xb4800000, 0xbcc00000, 0xa3a00000, 0x7bb00000, 0xe7b80000, 0x7dbc0000, 0xfeb20000, 0xdf370000,
+        0x23698000, 0x72004000, 0x1707e000, 0x3f997000, 0x194ae800, 0x39f09c00, 0x63caea00, 0x78309d00,
+        0x54eaea80, 0xcf409cc0, 0x38f2ea20, 0x3d4c9f10, 0x6ff8eb18, 0x22c79de4, 0x06a369ca, 0x3330df17
+      },
+      { // 253
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x38000000, 0xbc000000, 0x5e000000, 0xb3000000,
+        0xd9800000, 0x57c00000, 0x8fa00000, 0xe7b00000, 0xb3b80000, 0xf9b40000, 0x60aa0000, 0xd02d0000,
+        0x0f7a8000, 0xe3914000, 0xb6d72000, 0xe3241000, 0x96f2e800, 0xd4551c00, 0xc972ea00, 0x3c951d00,
+        0x9952eb80, 0x73e51ec0, 0x1acaeb60, 0x35211c30, 0xc1f8ea18, 0x1fc81efc, 0x4bb0697e, 0x65b05fa3
+      },
+      { // 254
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x78000000, 0x9c000000, 0xa2000000, 0x1f000000,
+        0x99800000, 0xb4c00000, 0x27a00000, 0x5db00000, 0xeea80000, 0x5d340000, 0x02f60000, 0xfad90000,
+        0x32ba8000, 0xdf26c000, 0xede12000, 0x0b4c1000, 0x62678800, 0xc697fc00, 0x0d4f8a00, 0x6363ff00,
+        0x12198980, 0x570aff40, 0x8d8b0860, 0xe2d83d30, 0x7ebc2ae8, 0xe53d2d4c, 0x7ee9208e, 0x48c8139f
+      },
+      { // 255
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x88000000, 0x74000000, 0x4e000000, 0x63000000,
+        0xfd800000, 0x40c00000, 0xa6e00000, 0x1cf00000, 0x71f80000, 0xcf7c0000, 0x82220000, 0xec130000,
+        0x220d8000, 0x010c4000, 0xdc842000, 0x6c459000, 0x42bc8800, 0x2a56d400, 0x15a48a00, 0xb9dad500,
+        0xc67e8a80, 0x6ab5d6c0, 0xee5108a0, 0xf3aa9710, 0x5ed8a998, 0xfde3469c, 0x3d60026e, 0xfb30039f
+      },
+      { // 256
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x88000000, 0x44000000, 0x0a000000, 0x71000000,
+        0x26800000, 0xdbc00000, 0x15600000, 0x2b700000, 0xb8680000, 0x3bfc0000, 0x74ba0000, 0x070b0000,
+        0x51938000, 0x624ac000, 0xa330e000, 0x3a423000, 0x3f204800, 0x6c566400, 0xb8284a00, 0xfdda6700,
+        0x7a7a4880, 0x6eed67c0, 0xc833caa0, 0x15dca6d0, 0xae78aa88, 0xdce85714, 0x75320212, 0x7d47007b
+      },
+      { // 257
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0xb8000000, 0xe4000000, 0x0a000000, 0x29000000,
+        0x5a800000, 0x71c00000, 0x1e600000, 0x08700000, 0x2f680000, 0x46ec0000, 0xccaa0000, 0xa59d0000,
+        0x2c518000, 0x3628c000, 0x2459e000, 0xaa3cb000, 0xea498800, 0xb93cc400, 0x21c18a00, 0x7660c700,
+        0x44638a80, 0x4961c7c0, 0x39f00860, 0x51380450, 0xadd26848, 0x307174f4, 0x0b738122, 0x6ce9c133
+      },
+      { // 258
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x58000000, 0x14000000, 0x5a000000, 0xad000000,
+        0xfd800000, 0xb4400000, 0x21e00000, 0x6cf00000, 0x61780000, 0xed340000, 0x68c20000, 0x06390000,
+        0xde438000, 0x94fcc000, 0xe56b6000, 0x3f2dd000, 0x39c8d800, 0xeda82400, 0x890ada00, 0xbf912500,
+        0x6d495b80, 0x366de7c0, 0x2da23ae0, 0xa9003790, 0x6f8ae388, 0x85581124, 0x7a783a7e, 0x63bd36f5
+      },
+      { // 259
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x48000000, 0x44000000, 0x6a000000, 0x17000000,
+        0x9d800000, 0x48400000, 0x83e00000, 0x64f00000, 0xf1780000, 0xdd3c0000, 0x44d20000, 0x7f2b0000,
+        0x57db8000, 0xa8aac000, 0x789a2000, 0xfed29000, 0x10381800, 0xe65ea400, 0xbeea1a00, 0xce75a500,
+        0x54b19a80, 0x5e9f64c0, 0xe7cbbba0, 0x80bdf5d0, 0x6c8ba208, 0xacdf518c, 0x0b33ba7e, 0x55c1f5ad
+      },
+      { // 260
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0xb8000000, 0x7c000000, 0x82000000, 0xbd000000,
+        0x48800000, 0x25400000, 0xc8200000, 0x2d300000, 0xa9a80000, 0xc6fc0000, 0xa7c60000, 0x84610000,
+        0x4b868000, 0x32cac000, 0x68eb6000, 0xe0cb7000, 0xade55800, 0x74489c00, 0xdaa35a00, 0xb9699f00,
+        0xc305d880, 0xb7935c40, 0x70c6ba60, 0x75e42db0, 0x7845e068, 0x30bdb344, 0xc0683b4a, 0x7592ecd1
+      },
+      { // 261
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x98000000, 0x5c000000, 0x62000000, 0xc5000000,
+        0xd3800000, 0x31c00000, 0x8d200000, 0xe0300000, 0x57a80000, 0x48640000, 0x8a4a0000, 0xb8e90000,
+        0x330a8000, 0x6082c000, 0x91406000, 0x7c6b1000, 0xec4ba800, 0x23e6cc00, 0x3781aa00, 0xdfcfcf00,
+        0xa22b2b80, 0x42bd0ec0, 0x13e349e0, 0x0f821fb0, 0x93cae068, 0x2829d0a4, 0x43abc926, 0xfe7ddf63
+      },
+      { // 262
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x18000000, 0xa4000000, 0x22000000, 0x03000000,
+        0x23800000, 0xc9400000, 0xcea00000, 0x05b00000, 0xaa380000, 0xdd7c0000, 0xe6d20000, 0xf9e10000,
+        0x1e0d8000, 0xc515c000, 0x2297a000, 0x99dad000, 0x3c7a7800, 0xa6406c00, 0x43287a00, 0x71e16d00,
+        0xb205fa80, 0x0b04acc0, 0xcf8a5ae0, 0x27527e50, 0x53ba2268, 0xa33f125c, 0x61f5d8e6, 0xfa16bc79
+      },
+      { // 263
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x88000000, 0x9c000000, 0xd2000000, 0x87000000,
+        0x33800000, 0xf6c00000, 0x19a00000, 0x4ab00000, 0x97380000, 0x44e40000, 0xf1d60000, 0x6a370000,
+        0x5c7c8000, 0x1e92c000, 0x865c2000, 0xfaf15000, 0xfcc10800, 0x2aa1fc00, 0x47370a00, 0x2ce6fd00,
+        0xfdd38980, 0x30203f40, 0x4761aba0, 0xff026d30, 0xf78a20e8, 0xd0c6532c, 0x40bd8a26, 0xa4333df7
+      },
+      { // 264
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x08000000, 0x14000000, 0x1a000000, 0x09000000,
+        0xf6800000, 0xd4c00000, 0xb6e00000, 0x33f00000, 0xd3780000, 0x58bc0000, 0x67d20000, 0x79630000,
+        0x39b98000, 0xd556c000, 0xcfade000, 0x9a443000, 0x1e212800, 0xdb043400, 0x8b932a00, 0x68573500,
+        0x1332aa80, 0x6f8df4c0, 0x3a554aa0, 0x2e26c490, 0xf307e2c8, 0xef9b30b4, 0x7a4aab12, 0x0e31f6e7
+      },
+      { // 265
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0xd8000000, 0x6c000000, 0xd6000000, 0x5f000000,
+        0x87800000, 0x69c00000, 0xd2200000, 0x3b300000, 0x53b80000, 0x95ec0000, 0xca060000, 0x410d0000,
+        0xcc888000, 0x04464000, 0xeae7a000, 0x5d9c5000, 0x50c4e800, 0x22b86c00, 0x317aea00, 0x8a596d00,
+        0x99f46880, 0xac122c40, 0x361b4be0, 0xaf083df0, 0x0f9800b8, 0xdddc008c, 0x683e00a6, 0xb221002b
+      },
+      { // 266
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x48000000, 0x1c000000, 0x0a000000, 0xc3000000,
+        0xea800000, 0x95400000, 0xcaa00000, 0xd3b00000, 0x82280000, 0x09fc0000, 0xb0020000, 0x281b0000,
+        0x4c008000, 0xb215c000, 0x9713a000, 0xfc87f000, 0x5c56d800, 0xe32ecc00, 0xac7cda00, 0xddc9cf00,
+        0x10fe5880, 0xe1870cc0, 0xa3cd79a0, 0xf5e53cb0, 0x2a000188, 0xf30003bc, 0x02800022, 0x794002e9
+      },
+      { // 267
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x48000000, 0x74000000, 0x0a000000, 0x1b000000,
+        0xa9800000, 0x20400000, 0x18a00000, 0x81b00000, 0xa7380000, 0x14ec0000, 0xef1e0000, 0xe3870000,
+        0x9b418000, 0x2134c000, 0xe9f5a000, 0xcb819000, 0x9f4f1800, 0x53374c00, 0x5ee91a00, 0x541c4d00,
+        0xda169880, 0xf31f8f40, 0x4d9ab9a0, 0x6246de90, 0x77be0188, 0x223702fc, 0x9c79812e, 0xa5d8c37d
+      },
+      { // 268
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x88000000, 0x74000000, 0x26000000, 0xb7000000,
+        0x76800000, 0x02c00000, 0x76e00000, 0x8ff00000, 0xaa680000, 0x10240000, 0xf70e0000, 0xd68f0000,
+        0x32d98000, 0xaef14000, 0x73fda000, 0xf87a7000, 0x8138a800, 0x3698b400, 0xa2deaa00, 0x46f3b700,
+        0x57e92b80, 0x567df640, 0x422509a0, 0x6612c790, 0x170e0138, 0x468f014c, 0xdad982e2, 0x8af14247
+      },
+      { // 269
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x68000000, 0x84000000, 0x92000000, 0x01000000,
+        0xda800000, 0xb7400000, 0x47a00000, 0x10b00000, 0x79280000, 0xa5f40000, 0xb79e0000, 0xbbc30000,
+        0x83eb8000, 0xdc95c000, 0x6c57e000, 0xa825b000, 0xd765d800, 0x64c06c00, 0x3e73da00, 0xfa476f00,
+        0xfb2e5980, 0xece5ae40, 0x590c3820, 0xa696dc50, 0x29558268, 0x00a6c054, 0x31346302, 0x91f47189
+      },
+      { // 270
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xc8000000, 0x7c000000, 0x76000000, 0x7b000000,
+        0xf1800000, 0x89400000, 0xd4200000, 0x55300000, 0x21b80000, 0x7e7c0000, 0xd4920000, 0x6fdb0000,
+        0x42fc8000, 0xb7464000, 0x933f2000, 0xf2a41000, 0xa3f8b800, 0x93dffc00, 0x74f2ba00, 0xec48fd00,
+        0x12a43a80, 0xb3e9bcc0, 0x0bd599a0, 0xb0e0ed30, 0x2e568078, 0x63a140dc, 0x4f71a1be, 0x080953f9
+      },
+      { // 271
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0xe8000000, 0xa4000000, 0x56000000, 0x49000000,
+        0x0f800000, 0x26400000, 0x9e200000, 0xad300000, 0x09a80000, 0x076c0000, 0x45920000, 0x455f0000,
+        0xe2b38000, 0xcfed4000, 0x49426000, 0xf0aa9000, 0x00ecd800, 0x17d4dc00, 0x9576da00, 0x4a97df00,
+        0x3bdf5a80, 0x77799cc0, 0x6d94b920, 0xc14d4e50, 0x44bb8078, 0x6ef14374, 0xe2d86246, 0x80e990ed
+      },
+      { // 272
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0xb8000000, 0x7c000000, 0xa6000000, 0x35000000,
+        0x6d800000, 0x47400000, 0xa5200000, 0x88b00000, 0xefe80000, 0x7ad40000, 0x9a7e0000, 0xb1810000,
+        0x115a8000, 0x18304000, 0xf137e000, 0xcaa0d000, 0x30f87800, 0xec4b3c00, 0x41a2fa00, 0xe47b7f00,
+        0xe8951980, 0x82dbac40, 0xc66d6360, 0x279091b0, 0x4c4f9bf8, 0xb1abee64, 0x6c7a83ce, 0xfc804339
+      },
+      { // 273
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xe8000000, 0x74000000, 0xc2000000, 0x63000000,
+        0x1e800000, 0x70c00000, 0xe1a00000, 0xaf300000, 0xe7f80000, 0x0a540000, 0x0b7a0000, 0xd19f0000,
+        0x10458000, 0xd467c000, 0xe914a000, 0xd982f000, 0xd4432800, 0x9e77bc00, 0x0e06aa00, 0xed107d00,
+        0xb3920b80, 0xa3528ec0, 0xb2f12020, 0xf5d53310, 0x662f8928, 0xae614f9c, 0xc61f82d2, 0x0908c09f
+      },
+      { // 274
+        0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x58000000, 0x44000000, 0xe6000000, 0xc5000000,
+        0x41800000, 0x8bc00000, 0x9a600000, 0x73f00000, 0xf4380000, 0xb45c0000, 0xf0a60000, 0x3e150000,
+        0xc1018000, 0x879b4000, 0x1ec6e000, 0x83e75000, 0xbc396800, 0x884ec400, 0x02b8ea00, 0x45158500,
+        0x019e0a80, 0xabc2d440, 0xca7f63e0, 0x2be01150, 0xb0398a78, 0x524c9744, 0x35b801fe, 0x7f9c012b
+      },
+      { // 275
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xf8000000, 0x74000000, 0x36000000, 0x3b000000,
+        0xc3800000, 0x5e400000, 0xe7a00000, 0xb0300000, 0x48780000, 0xbcdc0000, 0xb3720000, 0x1f550000,
+        0x3d278000, 0xf0e34000, 0x01092000, 0xfa8ad000, 0xb0c05800, 0xb1688c00, 0x3247da00, 0x35bbcd00,
+        0x9536fa80, 0xcced1ec0, 0x9b04a160, 0x73909310, 0x8644fbb8, 0x63b81efc, 0x7e232236, 0x0773d145
+      },
+      { // 276
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0xc8000000, 0x74000000, 0x02000000, 0x1b000000,
+        0x74800000, 0x1b400000, 0xa3600000, 0x93f00000, 0xd2a80000, 0x36d40000, 0xf7ae0000, 0xef5f0000,
+        0x61658000, 0x68fbc000, 0xf62fa000, 0xe580b000, 0x20ce1800, 0x7eb6d400, 0xa8cb9a00, 0x2abd1700,
+        0x1acc3980, 0xa9a9a640, 0xd24c22a0, 0xc4f07390, 0x682a38a8, 0x3892a4fc, 0xd54fa0fa, 0xb670b2d1
+      },
+      { // 277
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xa8000000, 0x24000000, 0x8a000000, 0x65000000,
+        0x6d800000, 0x59400000, 0x76200000, 0x11b00000, 0xede80000, 0x565c0000, 0x2eaa0000, 0x1d770000,
+        0x7e9f8000, 0x37ccc000, 0x19eb6000, 0x24535000, 0x57a3b800, 0x46f99c00, 0x44d43a00, 0xe7695f00,
+        0xd3955880, 0xee4d0fc0, 0x52a96220, 0xbb785350, 0x85963a08, 0x1d425dc4, 0x6c20db3e, 0xecb6cf61
+      },
+      { // 278
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xe8000000, 0x24000000, 0xce000000, 0x37000000,
+        0x22800000, 0x23c00000, 0x95a00000, 0xd9300000, 0xfde80000, 0x52d40000, 0x74260000, 0x1e730000,
+        0x48938000, 0x1ac44000, 0x6025a000, 0xc8747000, 0xa3974800, 0x3a4bdc00, 0x9eecca00, 0x865b9f00,
+        0x4cef6980, 0x535cef40, 0xa36ba220, 0x431373d0, 0x2482cb18, 0xc0cc9c0c, 0x8132ea12, 0x01ffafc3
+      },
+      { // 279
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x98000000, 0x7c000000, 0x06000000, 0xc1000000,
+        0x1c800000, 0xad400000, 0xb0600000, 0x12f00000, 0xf2b80000, 0x604c0000, 0xd2ea0000, 0x12a10000,
+        0x70528000, 0xfae04000, 0xf6a56000, 0x0a467000, 0x3dee9800, 0x2b3d7400, 0xbb841a00, 0x20d13500,
+        0x89ab7880, 0x5bc647c0, 0xb22f62e0, 0x3b177230, 0x9b8418f8, 0xd0d13434, 0xb1ab780a, 0x97c64541
+      },
+      { // 280
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0xd8000000, 0x6c000000, 0xc6000000, 0x1f000000,
+        0xe5800000, 0x99c00000, 0x68200000, 0x63b00000, 0x91680000, 0x56d40000, 0x05aa0000, 0xde790000,
+        0xfb508000, 0x586a4000, 0xc454a000, 0x2dea9000, 0xf596e800, 0xf1c1cc00, 0x3c2e6a00, 0xb9bf8f00,
+        0x9070c980, 0xc05c1ec0, 0xbffea2e0, 0x30939370, 0x15466bf8, 0x336b8c0c, 0x6bdac9ee, 0x1d251cab
+      },
+      { // 281
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xf8000000, 0xd4000000, 0xce000000, 0x3d000000,
+        0x70800000, 0xa9400000, 0x22200000, 0x08b00000, 0x72e80000, 0xed540000, 0xd4260000, 0x01b10000,
+        0xdc6f8000, 0x81084000, 0x5282e000, 0x6e517000, 0xb1bb1800, 0x14733c00, 0x5d1c9a00, 0xa09f7f00,
+        0xb1507980, 0xe62b0f40, 0x3ea2e260, 0x9be17010, 0x53d31b58, 0x40673fe4, 0x531a9b1a, 0x7d9e7e01
+      },
+      { // 282
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x18000000, 0x8c000000, 0x7e000000, 0x77000000,
+        0xd2800000, 0xaf400000, 0xbda00000, 0x6d300000, 0xa3780000, 0x1f540000, 0xb5ae0000, 0x99350000,
+        0x01608000, 0x0e494000, 0x9c3ea000, 0x9aee7000, 0x6481d800, 0x0c414c00, 0xfd395a00, 0x9b6c0d00,
+        0xa351fb80, 0x83a37c40, 0x7a3ea3e0, 0x21ee7270, 0xa801d818, 0x84014eac, 0x8a1958d2, 0xd51c0c51
+      },
+      { // 283
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x28000000, 0x14000000, 0x86000000, 0x0b000000,
+        0x03800000, 0x76c00000, 0xda600000, 0xe3f00000, 0xcc280000, 0x78d40000, 0x956a0000, 0xde670000,
+        0xfde18000, 0x1b234000, 0x99492000, 0x46bed000, 0x188a4800, 0xed54a400, 0x70a3ca00, 0xdb93e700,
+        0x8ac8e980, 0xa86e36c0, 0x1ee12120, 0xecaad290, 0x19804938, 0xbfc3a5bc, 0xecea48b6, 0xd1a4a6a7
+      },
+      { // 284
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x18000000, 0xf4000000, 0x32000000, 0x07000000,
+        0xe6800000, 0xbfc00000, 0x88e00000, 0x31700000, 0x7c280000, 0xc90c0000, 0xff8e0000, 0xb8550000,
+        0x74af8000, 0xffcbc000, 0x68e02000, 0x816e7000, 0xf431c800, 0x25153400, 0x39904a00, 0x8d4bf700,
+        0x953fea80, 0xa69e4540, 0x5fc602e0, 0x38e90290, 0xb9698028, 0x9022c18c, 0x0f09a332, 0xca8cb133
+      },
+      { // 285
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x18000000, 0x04000000, 0xf2000000, 0xff000000,
+        0x37800000, 0x15400000, 0xa8200000, 0xe8b00000, 0xc6780000, 0xc5140000, 0xa4820000, 0xacc90000,
+        0x84658000, 0x620dc000, 0xf7092000, 0x7b8b5000, 0xcb5db800, 0xb9325c00, 0xd63a3a00, 0xe9b69d00,
+        0xb0f69b80, 0xc6c00dc0, 0x3f7a03e0, 0xc79d01d0, 0x2d478228, 0xfc34c32c, 0x32b4a376, 0x256293b9
+      },
+      { // 286
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x68000000, 0xc4000000, 0xc2000000, 0xe9000000,
+        0xe1800000, 0x39400000, 0x6ca00000, 0x90300000, 0x22e80000, 0xba140000, 0xd5120000, 0xdf870000,
+        0x0e438000, 0x0a2dc000, 0xa7ede000, 0xbd915000, 0x77423800, 0xd3bc8c00, 0x82b3ba00, 0xbf264f00,
+        0x0875d980, 0x3bceddc0, 0x09680020, 0xde5402d0, 0x12320128, 0xebf70274, 0x0b8b812e, 0x3449c051
+      },
+      { // 287
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0xa8000000, 0x34000000, 0x9a000000, 0x35000000,
+        0x8a800000, 0x7f400000, 0x07200000, 0xf4b00000, 0xa7780000, 0xb4040000, 0xda160000, 0xd50b0000,
+        0x9a918000, 0xd740c000, 0x33336000, 0x6eb4b000, 0x92601800, 0x3e9a5c00, 0xa5479a00, 0xd2219d00,
+        0x6e3d7980, 0x7021ed40, 0x87200320, 0xb4b00190, 0x47780348, 0xa4040044, 0x721602e2, 0xe10b01f9
+      },
+      { // 288
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x48000000, 0xe4000000, 0x1a000000, 0x9d000000,
+        0x5c800000, 0x88c00000, 0xace00000, 0xd1700000, 0x83280000, 0xec040000, 0x5e0a0000, 0x171b0000,
+        0x798b8000, 0x7856c000, 0xda2c6000, 0xfa8b7000, 0x93d12800, 0xbb631400, 0x9630aa00, 0x349ed700,
+        0x3cdf4b80, 0x6ef764c0, 0x106002a0, 0x69b00350, 0x07c800c8, 0x29740224, 0x8f22003a, 0x821f03c7
+      },
+      { // 289
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xe8000000, 0x74000000, 0xa6000000, 0xc1000000,
+        0x60800000, 0x25c00000, 0x1ba00000, 0x8c300000, 0x20680000, 0xaa9c0000, 0xaece0000, 0x302b0000,
+        0x22618000, 0x858f4000, 0x6b4e6000, 0x3b76f000, 0xa91f8800, 0xd4805c00, 0x23d80a00, 0xcab81f00,
+        0x04b9e880, 0x71aaaf40, 0x17298320, 0xe3e34290, 0x70c863b8, 0xad31f294, 0x30f808ba, 0xd7481e43
+      },
+      { // 290
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x18000000, 0x14000000, 0xce000000, 0x61000000,
+        0x3e800000, 0x61400000, 0xd6200000, 0x3fb00000, 0xc5680000, 0x8a8c0000, 0x5f5a0000, 0x8f210000,
+        0x25378000, 0x72304000, 0x29bb6000, 0x90783000, 0x4a0ed800, 0x470abc00, 0x738b5a00, 0xb5d7ff00,
+        0x007dba80, 0xa20e8fc0, 0x6b1782e0, 0x99804390, 0x02d363d8, 0x4bf43114, 0x33d4dba2, 0xbd6bbc51
+      },
+      { // 291
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x88000000, 0x54000000, 0x52000000, 0x53000000,
+        0x7d800000, 0xb1c00000, 0x29e00000, 0xed700000, 0xce380000, 0xfd9c0000, 0xf1d20000, 0x09eb0000,
+        0x1d758000, 0x4629c000, 0xa996a000, 0xa3dd9000, 0x5af8e800, 0x60e93400, 0xf7e76a00, 0x8077f500,
+        0x4eb64a80, 0x94d8a6c0, 0x9d7580a0, 0x0629c390, 0x8996a3e8, 0x53dd93dc, 0xd2f8ea9e, 0x34e936db
+      },
+      { // 292
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x58000000, 0xac000000, 0x16000000, 0x41000000,
+        0x63800000, 0xc4400000, 0xdae00000, 0xc2700000, 0xf2a80000, 0x2e940000, 0x21d20000, 0x57a10000,
+        0x3f188000, 0x16844000, 0xfdc36000, 0xf9b09000, 0x6207d800, 0x3b022400, 0xd4855a00, 0x56c36700,
+        0x2524b980, 0x70c2b5c0, 0xfc2a80e0, 0x5f554370, 0x9e73e2b8, 0x9ca0d174, 0x9396b8b6, 0xbc53b4a5
+      },
+      { // 293
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x58000000, 0x64000000, 0x36000000, 0x51000000,
+        0x24800000, 0xa4400000, 0x8ea00000, 0x49300000, 0x1ef80000, 0xe99c0000, 0x42d60000, 0x35f50000,
+        0x060d8000, 0xb9094000, 0xe8846000, 0x7e527000, 0xd5b13800, 0x6ebd4c00, 0xf932ba00, 0xb6ed0d00,
+        0x05955a80, 0x48df3e40, 0x36fb83e0, 0x458c43d0, 0x68d1e138, 0xe6f73394, 0x1d9b592a, 0x0cc63e45
+      },
+      { // 294
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x48000000, 0xe4000000, 0xa2000000, 0xef000000,
+        0x23800000, 0x4fc00000, 0x68e00000, 0x8a700000, 0x5f380000, 0xfe8c0000, 0x2b560000, 0x10b70000,
+        0x174f8000, 0xfea9c000, 0x4e512000, 0x882fd000, 0x611d6800, 0xca9e1400, 0x815cea00, 0xbbbcd500,
+        0xc6cc4880, 0x1671c440, 0xe12181a0, 0xef92c3d0, 0xb9c8a128, 0x9df1116c, 0xbae3cb26, 0x3d680513
+      },
+      { // 295
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0xa8000000, 0xc4000000, 0x4a000000, 0xa7000000,
+        0x03800000, 0x7f400000, 0x41600000, 0x1e300000, 0x4f480000, 0x596c0000, 0x023e0000, 0xb9470000,
+        0xd8618000, 0x28afc000, 0x289aa000, 0x42d51000, 0x0b305800, 0x47c56400, 0x0baafa00, 0x01107700,
+        0xea9aa080, 0x31d51040, 0x4ab05820, 0x8b856450, 0xab4af988, 0x0360768c, 0xad32a1a6, 0xaec91321
+      },
+      { // 296
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x98000000, 0x94000000, 0x42000000, 0x45000000,
+        0xcc800000, 0x18c00000, 0xe8a00000, 0x58700000, 0xecd80000, 0x5abc0000, 0x35660000, 0x3c490000,
+        0x0c7d8000, 0x4edcc000, 0xafb9e000, 0x71f4b000, 0x289a4800, 0x32d1ec00, 0x11a3aa00, 0xcae55d00,
+        0xff19e080, 0xed84b140, 0xbe4248e0, 0xa96dee10, 0x3245a968, 0x3f6c5e44, 0x954462ba, 0xa6e87037
+      },
+      { // 297
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x38000000, 0x6c000000, 0xfa000000, 0x47000000,
+        0xd0800000, 0xfbc00000, 0x8a200000, 0x9df00000, 0x2dc80000, 0xd73c0000, 0x5a7a0000, 0x4e810000,
+        0xf2d68000, 0xdbb8c000, 0x43aea000, 0x9fb07000, 0x7dbba800, 0x26bb9c00, 0x34350a00, 0xe4fbef00,
+        0x4446a280, 0x657c72c0, 0x1209a860, 0xa3069c70, 0x5e998908, 0x5ac22fac, 0xdfbe822a, 0x9db4c033
+      },
+      { // 298
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x88000000, 0x2c000000, 0x8e000000, 0x6d000000,
+        0x4a800000, 0xc1c00000, 0x30a00000, 0xbd700000, 0xf3d80000, 0x1bbc0000, 0x16e60000, 0xe68b0000,
+        0x0fc88000, 0xfda24000, 0xe7ff6000, 0xba087000, 0x07192800, 0x25944c00, 0x78464a00, 0x5eec3d00,
+        0x2a876080, 0x31c47140, 0x08a728a0, 0x09634cf0, 0xd9c8ca18, 0xd4b57c04, 0xbf688392, 0x00d243f3
+      },
+      { // 299
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xf8000000, 0xf4000000, 0x52000000, 0x61000000,
+        0x60800000, 0x59c00000, 0x93200000, 0x0ef00000, 0x57d80000, 0x1c2c0000, 0x716a0000, 0x59990000,
+        0x7d4d8000, 0x40eec000, 0xf8d76000, 0x93a9b000, 0x8727e800, 0xccf93c00, 0x1ed08a00, 0x80a08d00,
+        0x76af6280, 0x0db5b2c0, 0x2035eb60, 0x4f7c3c10, 0x4e8f08a8, 0x26cb4f54, 0x14a7824a, 0xf4b7c223
+      },
+      { // 300
+        0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xc8000000, 0x94000000, 0x52000000, 0x89000000,
+        0x1a800000, 0xae400000, 0xeaa00000, 0xd8f00000, 0x54580000, 0xc7b40000, 0xb8620000, 0x970f0000,
+        0xad9f8000, 0xd3cac000, 0x616c6000, 0x9589f000, 0xcfc65800, 0x476ffc00, 0x3e8a3a00, 0x94560d00,
+        0x67b46180, 0x287df0c0, 0x2f0458a0, 0xf190ff90, 0x15cdb868, 0xba68cd74, 0x061a00a2, 0x7b0b005d
+      },
+      { // 301
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x08000000, 0xc4000000, 0x76000000, 0x47000000,
+        0xda800000, 0xa9400000, 0x64a00000, 0xd1f00000, 0xcf480000, 0x4bac0000, 0x3f6e0000, 0x48030000,
+        0xa4158000, 0x86084000, 0x1f0d2000, 0x168a3000, 0x1b583800, 0x55bf9c00, 0x4c751a00, 0xbc85af00,
+        0x86452080, 0x8a263240, 0x56b63aa0, 0x20fc9e50, 0xf2c09bf8, 0x687ded0c, 0xfa800232, 0x394001f9
+      },
+      { // 302
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xd8000000, 0x14000000, 0x52000000, 0xc1000000,
+        0x0e800000, 0x15400000, 0x0ba00000, 0xacf00000, 0x16480000, 0xdc2c0000, 0x03260000, 0x4ab10000,
+        0x62658000, 0xa316c000, 0xc7876000, 0x77d67000, 0x48f2b800, 0xec583c00, 0x613dda00, 0x83a24f00,
+        0x00e96080, 0xe04b7340, 0x873139e0, 0x00bffc10, 0x177f3828, 0xef92fc54, 0xcbd4b9f2, 0x66e93c11
+      },
+      { // 303
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x28000000, 0xfc000000, 0xae000000, 0xbd000000,
+        0xe9800000, 0x7c400000, 0xc6e00000, 0x44b00000, 0x37480000, 0x96640000, 0x4b6e0000, 0x72ef0000,
+        0xc6ae8000, 0xec5c4000, 0x2ee16000, 0x58be1000, 0x8957f800, 0x036bb400, 0x5efe9a00, 0xa0b1a700,
+        0xbd476180, 0x41751340, 0x65f77b20, 0x0828f7b0, 0x86997818, 0x46c7f604, 0x0e37f89e, 0x079bb445
+      },
+      { // 304
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x78000000, 0xfc000000, 0xf6000000, 0x73000000,
+        0x72800000, 0x1a400000, 0x34e00000, 0x00b00000, 0x0b580000, 0xd76c0000, 0xb96a0000, 0xa6690000,
+        0x8aec8000, 0x97a34000, 0xa3dda000, 0xc022b000, 0x08095800, 0xc413f400, 0x2a0cfa00, 0x751d4500,
+        0x798fa280, 0x94d7b2c0, 0xd8b7d960, 0x4745b430, 0x796fd838, 0xc669b73c, 0x5ae5d892, 0x1fb0b765
+      },
+      { // 305
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0xd8000000, 0x0c000000, 0x56000000, 0x4f000000,
+        0x0f800000, 0x99c00000, 0xe5600000, 0xc2b00000, 0x0cd80000, 0xb3ec0000, 0x3bee0000, 0xaff90000,
+        0xd5e68000, 0x1ced4000, 0x847e2000, 0x1e349000, 0x34848800, 0x5c403400, 0x9da2aa00, 0xbb58a500,
+        0xd6282280, 0x80919240, 0xf6540be0, 0x8cb87770, 0x2fd40838, 0x1a78740c, 0xe5340be6, 0x9108751b
+      },
+      { // 306
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xe8000000, 0xb4000000, 0xca000000, 0xcd000000,
+        0x11800000, 0xdec00000, 0x0c600000, 0xc4b00000, 0xbbc80000, 0x89e40000, 0x807a0000, 0x22a30000,
+        0x00df8000, 0x9b7dc000, 0xa027e000, 0x988e1000, 0xcd4f2800, 0xfba63400, 0x4b40ca00, 0x30bc2700,
+        0x51dde180, 0x14ed11c0, 0xc9f0a820, 0xa06bf410, 0x72af2a88, 0x58d636e4, 0xc768caee, 0xde28258f
+      },
+      { // 307
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xe8000000, 0x94000000, 0x7e000000, 0x25000000,
+        0x25800000, 0x11c00000, 0xdea00000, 0xbd700000, 0x24d80000, 0xe32c0000, 0xf0a20000, 0xa0730000,
+        0xed538000, 0x40e74000, 0x09146000, 0xf7919000, 0xa6c2c800, 0x6c360c00, 0xae2eaa00, 0x013b9d00,
+        0xefb66280, 0xa6e293c0, 0x30114b20, 0xa8114c90, 0xb41ac858, 0xce1a0fc4, 0xcd0cabee, 0xb1889f13
+      },
+      { // 308
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0xe8000000, 0xfc000000, 0x5a000000, 0xe3000000,
+        0x34800000, 0x70400000, 0xbd600000, 0x33300000, 0x33480000, 0x79e40000, 0x9b760000, 0x4a2f0000,
+        0x04d68000, 0xed2ac000, 0xbe5c2000, 0x387a7000, 0x5ead5800, 0x44830400, 0x68597a00, 0x996d7700,
+        0xad2a2180, 0x9e557040, 0x087bd820, 0x66a9c4b0, 0x508558c8, 0xce57077c, 0x2067783a, 0x7aa6760d
+      },
+      { // 309
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0xc8000000, 0x54000000, 0x4e000000, 0x35000000,
+        0xfb800000, 0xd0c00000, 0xeea00000, 0x8b700000, 0xde580000, 0x65f40000, 0x05060000, 0x239b0000,
+        0xaccf8000, 0xa4a94000, 0x38666000, 0x44cb5000, 0x00b8a800, 0x0e676c00, 0xbdd8ca00, 0x29373d00,
+        0xf1afe180, 0xd3f91040, 0xbc1148a0, 0xea057c10, 0x03060018, 0x029b0084, 0xf94f8156, 0x116942d7
+      },
+      { // 310
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xd8000000, 0x54000000, 0x2a000000, 0x21000000,
+        0x25800000, 0x98400000, 0x7e600000, 0xdf300000, 0xb0d80000, 0x4dac0000, 0xca020000, 0xf1050000,
+        0x6d958000, 0xa459c000, 0xd87a6000, 0x803a1000, 0x9e4af800, 0xd174e400, 0x09b29a00, 0xc80bf500,
+        0x7c0de280, 0x8616d3c0, 0xef1d1be0, 0xf68b3790, 0xc8d801c8, 0xe9ac00d4, 0x180200be, 0x34050025
+      },
+      { // 311
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xc8000000, 0x4c000000, 0xc2000000, 0x5b000000,
+        0x9e800000, 0x5e400000, 0x25e00000, 0x78b00000, 0x57d80000, 0x672c0000, 0x781a0000, 0xe41f0000,
+        0xde148000, 0x211fc000, 0x418a2000, 0x4ed13000, 0xe2a05800, 0x98d41400, 0xefb07a00, 0x4b5a2500,
+        0x4264a280, 0xb361f0c0, 0x0ae6fba0, 0xe036e4f0, 0xfc800228, 0x3540015c, 0x536001f2, 0x1af001d5
+      },
+      { // 312
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x18000000, 0x6c000000, 0x1e000000, 0xe5000000,
+        0xc8800000, 0xad400000, 0x30200000, 0xd4700000, 0x12d80000, 0x7ee40000, 0x1c8e0000, 0x6f590000,
+        0x23228000, 0x1dec4000, 0x1d046000, 0x748c3000, 0xcb517800, 0x293e0c00, 0x1afb1a00, 0x369b3d00,
+        0x9850e380, 0x80ad7340, 0x852199e0, 0x24e37ff0, 0x23828218, 0xd8dc4324, 0x59fc62da, 0xc7183361
+      },
+      { // 313
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xa8000000, 0xec000000, 0xc2000000, 0xf5000000,
+        0xb7800000, 0xa6400000, 0xcc600000, 0x6b300000, 0xb6d80000, 0xb0a40000, 0x92920000, 0xe9d30000,
+        0x3e248000, 0x515bc000, 0xaefbe000, 0x6ae9d000, 0x04ec7800, 0x53f2e400, 0x61659a00, 0xd8b83500,
+        0x5e956380, 0x3bc510c0, 0x13211b20, 0xa2d3f670, 0x26b683a8, 0x9188c164, 0x2d5f6056, 0xf4f2108d
+      },
+      { // 314
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x88000000, 0x54000000, 0xde000000, 0x69000000,
+        0x41800000, 0x9cc00000, 0x2ca00000, 0xb7700000, 0x0b580000, 0xcd640000, 0x645e0000, 0x59fb0000,
+        0x23078000, 0xd69b4000, 0xc44be000, 0x69ed9000, 0xdb016800, 0x1a99ac00, 0xc64c8a00, 0x8aeb3d00,
+        0x2d946380, 0xaed2d140, 0x37b48ba0, 0x8dff3d10, 0xbd126358, 0xdf8dd1f4, 0x95cd0bfe, 0x7d2f7f97
+      },
+      { // 315
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0xc8000000, 0xb4000000, 0x2a000000, 0x4d000000,
+        0xb6800000, 0x35c00000, 0x79a00000, 0xd3700000, 0xbd480000, 0x5b640000, 0x29460000, 0xc16b0000,
+        0xfc438000, 0x0be1c000, 0x5799e000, 0x155bf000, 0x7f702800, 0x2b4cac00, 0x6867ca00, 0xa8d85f00,
+        0xc7326180, 0xb2ae3240, 0xbee7c8a0, 0x0d185f90, 0x96926188, 0x85de30e4, 0xe1afc9f2, 0xaf7c5ca3
+      },
+      { // 316
+        0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x68000000, 0x5c000000, 0x62000000, 0xe5000000,
+        0xdc800000, 0xe3c00000, 0xdea00000, 0x4e700000, 0x37580000, 0x11740000, 0x7aca0000, 0xf0230000,
+        0xf0aa8000, 0x3179c000, 0xead9e000, 0x483eb000, 0xf4aca800, 0x67638c00, 0x31c74a00, 0x13ba3d00,
+        0x2ef36180, 0x868771c0, 0x42d54a20, 0xb42d3db0, 0x46b3e228, 0xda6db3e4, 0xd95e297a, 0xce6e4cdb
+      },
+      { // 317
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x78000000, 0x34000000, 0x1a000000, 0xa1000000,
+        0xd8800000, 0x7dc00000, 0xd5600000, 0x4fb00000, 0xf5580000, 0x30bc0000, 0x9ed60000, 0x48f50000,
+        0x28ed8000, 0x58efc000, 0x10f46000, 0xccf7b000, 0x9ae6e800, 0x15f6b400, 0x767c8a00, 0x72380500,
+        0x0219e080, 0xe5187340, 0x8a928b60, 0x00c10690, 0x5bfa6388, 0xbd7eb354, 0x43bd698a, 0x7b5c7533
+      },
+      { // 318
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x88000000, 0x3c000000, 0x22000000, 0x67000000,
+        0x2e800000, 0xb6400000, 0xaa600000, 0x22b00000, 0x16880000, 0x92540000, 0x5c660000, 0x0bab0000,
+        0xf51e8000, 0x5197c000, 0x4ccea000, 0x52323000, 0x45d59800, 0x41b84400, 0x3e05ba00, 0xb51db700,
+        0xf19e8380, 0x7cd7c240, 0x8a2ea3a0, 0xf1c231b0, 0x5fbd9aa8, 0x7b1c456c, 0xfc8bba32, 0x6952b445
+      },
+      { // 319
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x68000000, 0x0c000000, 0x9e000000, 0x5d000000,
+        0xbc800000, 0x20c00000, 0x83a00000, 0xa7f00000, 0x20980000, 0x76d40000, 0x62b60000, 0xbd770000,
+        0x39548000, 0xdbe64000, 0x269e6000, 0xffd33000, 0x74230800, 0x3abc2c00, 0xc969ea00, 0x23495d00,
+        0x44f48180, 0x31164040, 0x32866220, 0xf5c73170, 0x63350bd8, 0x713b2d44, 0xf2256a8a, 0xf3bb1cf7
+      },
+      { // 320
+        0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0xb8000000, 0xac000000, 0xb6000000, 0x0d000000,
+        0xca800000, 0x04c00000, 0x51200000, 0x0b700000, 0x84880000, 0x05d40000, 0xfdba0000, 0x0ab10000,
+        0x0b2a8000, 0x10674000, 0x93056000, 0xc38df000, 0xbc414800, 0x4ae8fc00, 0x3fceaa00, 0x56b24f00,
+        0xa5228380, 0x617341c0, 0xe79f6360, 0xde4cf070, 0x3de3c838, 0xfe5bbe84, 0x2df1cbf2, 0x964ebf27
+      },
+      { // 321
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x48000000, 0xfc000000, 0x82000000, 0xa1000000,
+        0xe8800000, 0xdfc00000, 0xb7a00000, 0x54f00000, 0xf2880000, 0x0adc0000, 0x012e0000, 0xf8330000,
+        0x44be8000, 0x9563c000, 0x19c26000, 0xb0b63000, 0x0b6e6800, 0x4ac9cc00, 0xe1328a00, 0x882c3f00,
+        0x5cb68280, 0x217fc240, 0x67cc61a0, 0x93b532b0, 0x42f8eb28, 0x7d860d74, 0x8956ebaa, 0x6b750efb
+      },
+      { // 322
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x18000000, 0x9c000000, 0xd2000000, 0xe5000000,
+        0x81800000, 0x31c00000, 0x4de00000, 0xc7b00000, 0x8a980000, 0xb7440000, 0x70ae0000, 0xae110000,
+        0x67188000, 0x1c85c000, 0x3c44e000, 0xb62f9000, 0xf3558800, 0x1ebdc400, 0xe911ea00, 0x0b939500,
+        0x28ce8380, 0x0e60c140, 0x0b6a61e0, 0xdaff5230, 0x9327eb28, 0x52c695e4, 0x5f78034e, 0xacf40253
+      },
+      { // 323
+        0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x58000000, 0x4c000000, 0x96000000, 0xdf000000,
+        0x8d800000, 0x28400000, 0xb2a00000, 0x7d700000, 0x56980000, 0x17d40000, 0x27f20000, 0x37550000,
+        0x9f2a8000, 0xc5374000, 0xcc3f2000, 0x7ea55000, 0xab773800, 0x69809c00, 0xea5a9a00, 0x57b68d00,
+        0xc9f88180, 0x745240c0, 0x4cada2e0, 0x567610f0, 0x71021b38, 0x2e94ce4c, 0x8bcd226e, 0x79f052dd
+      },
+      { // 324
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x38000000, 0xfc000000, 0x02000000, 0x45000000,
+        0xdd800000, 0x3bc00000, 0x9b200000, 0xb3700000, 0x3c980000, 0xe85c0000, 0x6ff60000, 0x64d50000,
+        0xafb08000, 0xcf3bc000, 0x3572e000, 0x27981000, 0x62dd4800, 0xf4a55c00, 0xe5a72a00, 0xbe2a8d00,
+        0x9ee68080, 0x8f5ec140, 0xa77a6260, 0x1a8fd3b0, 0xe341a8e8, 0xdd744ee4, 0x039ce17e, 0x2cd110fb
+      },
+      { // 325
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x48000000, 0x7c000000, 0x5a000000, 0x0f000000,
+        0x47800000, 0x9e400000, 0x8fe00000, 0xd8300000, 0x10980000, 0x7dc40000, 0xafba0000, 0x86cf0000,
+        0xee2e8000, 0x9d98c000, 0xd154a000, 0xa86c1000, 0xf672b800, 0xd7787400, 0xd9f09a00, 0xe538a500,
+        0xf4148380, 0x0617c3c0, 0x851a20a0, 0xb084d330, 0xedde1848, 0x37a065cc, 0x02c02276, 0x803bd345
+      },
+      { // 326
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x48000000, 0xa4000000, 0x86000000, 0x19000000,
+        0xde800000, 0xfd400000, 0x83e00000, 0xf9300000, 0xf9080000, 0x6e940000, 0xd5420000, 0x57e70000,
+        0x372d8000, 0x440c4000, 0x3607e000, 0x311af000, 0x0a837800, 0x33525400, 0x3eeb1a00, 0xa1a3e700,
+        0x1d420380, 0x33e702c0, 0xd12d80a0, 0x2d0c4350, 0xa087e338, 0x685af2f4, 0x0f637962, 0xd3625791
+      },
+      { // 327
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x38000000, 0xa4000000, 0xa6000000, 0x17000000,
+        0x01800000, 0x86400000, 0x3ee00000, 0x16300000, 0x4b180000, 0xe39c0000, 0x07460000, 0x80750000,
+        0x0de38000, 0xf1b84000, 0x7a5a2000, 0x4cecd000, 0xaf21f800, 0x518e9400, 0x5e5e5a00, 0xaaef0500,
+        0x18260080, 0xc0050340, 0xe01b8260, 0x301440d0, 0xa8042278, 0x9c05d2cc, 0x02047a9e, 0xb103d645
+      },
+      { // 328
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x88000000, 0x3c000000, 0xd6000000, 0xe9000000,
+        0xe6800000, 0x3fc00000, 0x73200000, 0x6b700000, 0x0d080000, 0x44840000, 0xdcc60000, 0x7aab0000,
+        0xd3268000, 0x9b754000, 0xb513e000, 0x209ff000, 0xbecc2800, 0x79a51c00, 0x0abf4a00, 0xab24af00,
+        0x1f660180, 0x071b0040, 0xab8e81a0, 0x5b4143b0, 0x9ffde178, 0x49c0f354, 0x6a24a8c2, 0x35ff5f5b
+      },
+      { // 329
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x38000000, 0xac000000, 0xfa000000, 0x5d000000,
+        0xa4800000, 0x05c00000, 0x00600000, 0xf4300000, 0xa1180000, 0xd68c0000, 0xecda0000, 0x02f90000,
+        0x6ee28000, 0xf4f2c000, 0x79e8e000, 0x157d3000, 0x84b12800, 0xd2d03400, 0x81e14a00, 0xd966c500,
+        0xaeba0280, 0x47c902c0, 0xb17a8060, 0x8abec170, 0x09d2e308, 0x4a7433c4, 0xb12ba97a, 0x599ef563
+      },
+      { // 330
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x08000000, 0xfc000000, 0xae000000, 0x19000000,
+        0x9a800000, 0x25400000, 0x2ba00000, 0x11700000, 0x1b080000, 0xe59c0000, 0x7ade0000, 0xea7b0000,
+        0x0e8e8000, 0x47524000, 0x64b2e000, 0xb6fa7000, 0xfedef800, 0xa0625c00, 0x6d9c9a00, 0x46c16f00,
+        0x64760280, 0xc7970040, 0xd5d880a0, 0xbdf540b0, 0x33426298, 0xf6a33394, 0x21ea98d2, 0xad566cf1
+      },
+      { // 331
+        0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0xd8000000, 0xd4000000, 0x1e000000, 0xd9000000,
+        0x26800000, 0xa9c00000, 0x8fa00000, 0x1df00000, 0xab180000, 0xe59c0000, 0x00520000, 0xe5fd0000,
+        0x0f118000, 0x83914000, 0x3d4ce000, 0x0579f000, 0xabdae800, 0x34b64c00, 0x50758a00, 0x0753fd00,
+        0xfa6a0080, 0x105101c0, 0x4dfb81e0, 0xa3004390, 0x79976318, 0x2249b034, 0x2ef588e2, 0x3a93fdc3
+      },
+      { // 332
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x08000000, 0x04000000, 0xa2000000, 0xf7000000,
+        0xa1800000, 0xff400000, 0x24a00000, 0xa1700000, 0x2d180000, 0xaa9c0000, 0x40d60000, 0x92e30000,
+        0x7d518000, 0x83bcc000, 0xa8eea000, 0xc650d000, 0x2436d800, 0x12bdfc00, 0xbc7ffa00, 0xdf82ed00,
+        0x464e0080, 0x643f0140, 0xb2a782a0, 0xac6fc050, 0xd78722a8, 0x424013cc, 0xc636780e, 0x45a22c21
+      },
+      { // 333
+        0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x48000000, 0xfc000000, 0xbe000000, 0x3d000000,
+        0x4d800000, 0x94c00000, 0x05a00000, 0x8ff00000, 0xd6180000, 0xd1140000, 0xeb8a0000, 0xaddf0000,
+        0x42368000, 0x64384000, 0x1d286000, 0xbaaa1000, 0xe1692800, 0x62492c00, 0xf5e5ca00, 0x41107d00,
+        0xb3980180, 0x49d403c0, 0xf82a02a0, 0x532f0130, 0x2fae83d8, 0xe0ec4304, 0x008263ce, 0x314512a7
+      },
+      { // 334
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x28000000, 0x7c000000, 0xd2000000, 0x4b000000,
+        0xad800000, 0x31c00000, 0x25e00000, 0xc8b00000, 0xe6180000, 0x75140000, 0xfc860000, 0x7b5f0000,
+        0x43aa8000, 0xeb85c000, 0x74db2000, 0x2160d000, 0xe7f98800, 0x0bbf8400, 0x07962a00, 0x6ed19500,
+        0xc6780180, 0xb0640240, 0x0d7e0320, 0x5dfb02b0, 0xdcb483e8, 0xa80ec0dc, 0x3c17a1fe, 0x320a11eb
+      },
+      { // 335
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0xf8000000, 0x1c000000, 0x82000000, 0x1b000000,
+        0x16800000, 0x8b400000, 0x6da00000, 0xd5700000, 0x8c080000, 0x6a1c0000, 0x2f1a0000, 0x80810000,
+        0xf65c8000, 0xfe33c000, 0xd1a32000, 0x6769b000, 0x4f1fb800, 0x909edc00, 0xde521a00, 0xea29af00,
+        0xb7a00280, 0xe27000c0, 0xc0880360, 0x165c03b0, 0x2e3a01e8, 0xd9b1001c, 0x83748252, 0xd11fc241
+      },
+      { // 336
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xa8000000, 0x44000000, 0x5a000000, 0x09000000,
+        0xbe800000, 0xa4c00000, 0xc3a00000, 0x5ef00000, 0xbc080000, 0x561c0000, 0x27060000, 0x55970000,
+        0xff5d8000, 0xc7e3c000, 0x6a9a6000, 0x96cef000, 0xaea74800, 0xaa7eec00, 0xb9ceaa00, 0x6f28df00,
+        0x87200280, 0x23300340, 0x49280220, 0xf82c0150, 0xaaae03c8, 0x107b0134, 0x80d38392, 0x69a8c2b7
+      },
+      { // 337
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0xc8000000, 0x2c000000, 0x76000000, 0xdf000000,
+        0x9d800000, 0x3ec00000, 0xc5e00000, 0xf4b00000, 0x7e080000, 0x93040000, 0xdb820000, 0x39c10000,
+        0xbc6c8000, 0x9072c000, 0x12ef6000, 0x2539f000, 0x06c3d800, 0x51e6ec00, 0x56b2de00, 0x23048b00,
+        0x43880080, 0xfdc40040, 0xf6620020, 0xf1710010, 0x7c6480c8, 0xf076c02c, 0x22ed6076, 0xfd38f0df
+      },
+      { // 338
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xc8000000, 0xf4000000, 0xce000000, 0xd5000000,
+        0xe7800000, 0xcf400000, 0x7d200000, 0x06100000, 0x0a080000, 0x93040000, 0xe6820000, 0x56cb0000,
+        0xaf6c8000, 0x68bf4000, 0x0d54e000, 0x31215000, 0x94187800, 0x750df400, 0x17845200, 0x2741a100,
+        0x39280080, 0x00140040, 0x2b0a0020, 0xba8f00b0, 0xfcce80c8, 0xcc6440f4, 0x663060ce, 0x1f9a10d5
+      },
+      { // 339
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0xa8000000, 0x7c000000, 0x2e000000, 0x37000000,
+        0x67800000, 0xb5c00000, 0x52e00000, 0xbe700000, 0xaa080000, 0x2d040000, 0x328a0000, 0xf3490000,
+        0x63aa8000, 0x6cd7c000, 0xea5ae000, 0x3b1f7000, 0xd9b07800, 0xa1e45c00, 0x63f8ae00, 0xdacda700,
+        0x91680080, 0xc1b40040, 0xa5e200a0, 0x39fd0090, 0x2fc880a8, 0x47eac07c, 0x58f2602e, 0x0b45b037
+      },
+      { // 340
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x58000000, 0xcc000000, 0xce000000, 0xc5000000,
+        0xa0800000, 0x6dc00000, 0xbfe00000, 0x3a900000, 0xaa080000, 0x0f040000, 0x9f8a0000, 0xda4d0000,
+        0x21a58000, 0x413cc000, 0x2c34e000, 0x88b05000, 0x1f7c0800, 0xb79ddc00, 0x7e857e00, 0x10c9e900,
+        0xa3680080, 0x11540040, 0x44e200a0, 0x971900d0, 0x53478058, 0x0f25c0cc, 0x49f360ce, 0xe35590c5
+      },
+      { // 341
+        0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x08000000, 0x94000000, 0xc6000000, 0x91000000,
+        0x4e800000, 0x7bc00000, 0x31600000, 0xb5100000, 0x29080000, 0x92840000, 0x89ca0000, 0x56630000,
+        0x62908000, 0x88414000, 0x1e286000, 0x9cb31000, 0x84ffe800, 0xa2db3c00, 0xa26c5600, 0x749a3100,
+        0x814a0080, 0xfca30040, 0xbd7080a0, 0x76914030, 0x0e406008, 0x2f271094, 0xe23de8c6, 0xf73c3c91
+      },
+      { // 342
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0xb8000000, 0x74000000, 0x86000000, 0x59000000,
+        0x36800000, 0xa1c00000, 0x8ea00000, 0x3b900000, 0xe7080000, 0xdb8c0000, 0xf14e0000, 0xa66d0000,
+        0x3bbb8000, 0x095f4000, 0x342c6000, 0x48579000, 0x86a86800, 0xe7909c00, 0x4d022a00, 0xa08d9900,
+        0xa0c60080, 0x1c2100c0, 0xa45580e0, 0x44a240d0, 0x509fe0b8, 0xee84d074, 0xc5ca0886, 0x50aa0c59
+      },
+      { // 343
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x98000000, 0xec000000, 0xc6000000, 0xc7000000,
+        0xef800000, 0x37c00000, 0xb9200000, 0x07f00000, 0x1d080000, 0x168c0000, 0xe34a0000, 0x8f6b0000,
+        0x3a198000, 0x6656c000, 0x3ab86000, 0x79627000, 0xa513f800, 0xc5d3fc00, 0x7b73d200, 0x9f455f00,
+        0xa1620080, 0x291700c0, 0x13db80a0, 0x9471c0b0, 0x04cbe098, 0xbcafb0ec, 0x913a18c6, 0x3cab4cc7
+      },
+      { // 344
+        0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xd8000000, 0x64000000, 0x5e000000, 0x29000000,
+        0x9c800000, 0xed400000, 0xe0a00000, 0x4b100000, 0x3c880000, 0x3d4c0000, 0x28ae0000, 0x071f0000,
+        0xde858000, 0x2e4a4000, 0xc32be000, 0x5fdd9000, 0x4fec4800, 0x68b49400, 0x541dea00, 0x150d2100,
+        0x66858080, 0x7a4a40c0, 0xa52be0e0, 0xe2dd90f0, 0x556c48d8, 0xc8f49464, 0x763dea5e, 0x9a5d2129
+      },
+      { // 345
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x78000000, 0xfc000000, 0xea000000, 0xc9000000,
+        0xac800000, 0x9c400000, 0x50600000, 0xeeb00000, 0xe4880000, 0xa8440000, 0xce620000, 0x99bd0000,
+        0xef0f8000, 0x478bc000, 0x8dcca000, 0xdea19000, 0x859d4800, 0x29de0400, 0xb1b7a600, 0x2b0c7b00,
+        0x718f8080, 0x7ecbc040, 0xc32ca020, 0x495190d0, 0x0ff54878, 0xc66a04fc, 0x8dbda6ea, 0xa1057bc9
+      },
+      { // 346
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x18000000, 0xec000000, 0x8e000000, 0x05000000,
+        0x53800000, 0x15c00000, 0xbc600000, 0x0c100000, 0x7f880000, 0xfbc40000, 0x09620000, 0xd7990000,
+        0x9e498000, 0x25aac000, 0x8e7ae000, 0xfe915000, 0x23c8b800, 0x85699c00, 0xe9982600, 0x13401100,
+        0x82298080, 0xf9bac040, 0xc9f2e020, 0x79555090, 0xbcaab818, 0xbbf09cec, 0xaa51a68e, 0x262ad105
+      },
+      { // 347
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x28000000, 0xbc000000, 0xb2000000, 0x95000000,
+        0xdb800000, 0x78400000, 0x3a200000, 0x80500000, 0x9f880000, 0xfe4c0000, 0x51260000, 0xc4d90000,
+        0x3d4a8000, 0x69a7c000, 0xb41d2000, 0xafa85000, 0x7f133800, 0x1b224400, 0x65dd8200, 0x18cdd500,
+        0x8eea8080, 0x54b7c0c0, 0x82352060, 0x85f45090, 0x119d3828, 0x88e744bc, 0xffb902b2, 0xa6bf1595
+      },
+      { // 348
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0xb8000000, 0x3c000000, 0x46000000, 0x23000000,
+        0x99800000, 0x15400000, 0xfd600000, 0xbf500000, 0xaf880000, 0x7e4c0000, 0xd0ea0000, 0xf8190000,
+        0xb3e38000, 0x019fc000, 0x96a66000, 0xd4f73000, 0xadf01800, 0x017f9400, 0xb6be3600, 0x6b1d0500,
+        0xc26b8080, 0x30d3c0c0, 0x81cc60a0, 0xb6ae3090, 0x84f398b8, 0xb5f0543c, 0xad705646, 0x48b63523
+      },
+      { // 349
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x48000000, 0x6c000000, 0x6a000000, 0x77000000,
+        0x75800000, 0xc7c00000, 0xd3e00000, 0xeaf00000, 0x37880000, 0x6ccc0000, 0xf4620000, 0x2e350000,
+        0xdfec8000, 0x30fac000, 0x788ca000, 0x6d4e7000, 0x7da1d800, 0x8cdfbc00, 0x5d971e00, 0xc23b1f00,
+        0x75e48080, 0x67f6c0c0, 0x5d0ea020, 0xe28b7050, 0xc2455848, 0x0c297c6c, 0x1d19be6a, 0xdb706f77
+      },
+      { // 350
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xc8000000, 0x4c000000, 0x92000000, 0xb7000000,
+        0xec800000, 0xe5400000, 0x2de00000, 0x61100000, 0xb2880000, 0x004c0000, 0x16660000, 0x38d50000,
+        0xb2248000, 0x00b8c000, 0x57f72000, 0x3d1a7000, 0x48804800, 0xcb459400, 0xf0e47e00, 0xee902100,
+        0xad4c8080, 0xa1e4c0c0, 0x93192060, 0x55837050, 0x24c2c8c8, 0xbf28544c, 0x8737de92, 0x643291b7
+      },
+      { // 351
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x38000000, 0x74000000, 0x12000000, 0x35000000,
+        0x27800000, 0xc0400000, 0x75200000, 0x7d700000, 0x51880000, 0x7f4c0000, 0x23a60000, 0xe0b50000,
+        0x9deb8000, 0x369b4000, 0xe81f2000, 0xa9d25000, 0x5bb3f800, 0x116c4400, 0xe25af200, 0x0dfb4700,
+        0x4b438080, 0x91a740c0, 0xe5b12060, 0xd26b5050, 0xbade7838, 0xfb320474, 0xf3a65212, 0x18be5735
+      },
+      { // 352
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0xe8000000, 0xb4000000, 0xe6000000, 0x0b000000,
+        0x32800000, 0xed400000, 0x59e00000, 0x9bd00000, 0x59880000, 0xcfc40000, 0xbcae0000, 0x26350000,
+        0xcc568000, 0x29474000, 0xa7e46000, 0x7cdbb000, 0x8100a800, 0x938f1400, 0x8ecebe00, 0x8f226d00,
+        0x18f88080, 0xfb724040, 0x6db2e0e0, 0x0e9cf050, 0xfc64c8e8, 0xb614a4b4, 0xb02e16e6, 0x8c7d790b
+      },
+      { // 353
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x58000000, 0x8c000000, 0x62000000, 0x0d000000,
+        0x7a800000, 0xb8c00000, 0x44200000, 0x25b00000, 0xe3880000, 0x8c4c0000, 0xe3e60000, 0x5e110000,
+        0xd07d8000, 0x7d2cc000, 0x613c2000, 0x0c4fd000, 0x23ef2800, 0x3e10cc00, 0xc073a200, 0x25252b00,
+        0xed3b8080, 0x6e4dc0c0, 0x2ee9a060, 0x449f1010, 0x78bd0858, 0x61021c8c, 0xc8870a62, 0x8dc8270d
+      },
+      { // 354
+        0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x48000000, 0xdc000000, 0x4a000000, 0x03000000,
+        0x09800000, 0x1cc00000, 0xf8e00000, 0xd0f00000, 0x78880000, 0x424c0000, 0x9bae0000, 0x8ddf0000,
+        0x121c8000, 0x2379c000, 0x0f4ea000, 0x7f2d3000, 0xa5951800, 0x9abf8c00, 0x1f266e00, 0x95965f00,
+        0x32ba8080, 0x332ac0c0, 0x979c20e0, 0xedbbf0f0, 0x70af3848, 0x88577cdc, 0x1cdbd64a, 0xbc97e303
+      },
+      { // 355
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x68000000, 0x9c000000, 0x02000000, 0xb3000000,
+        0xbe800000, 0x7cc00000, 0x0a600000, 0xea700000, 0x57880000, 0x35440000, 0xce2a0000, 0x89d50000,
+        0x4c1e8000, 0x67f5c000, 0xd5c62000, 0xe3e03000, 0x7e326800, 0x5c258c00, 0xb2dbc600, 0x9e9e7700,
+        0x213c8080, 0x98a4c040, 0x2912a0a0, 0xe470f050, 0x6e82c868, 0x54c47c9c, 0x366d8e02, 0xb87acbb3
+      },
+      { // 356
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x28000000, 0x4c000000, 0x46000000, 0xe5000000,
+        0x7d800000, 0xec400000, 0x66600000, 0x42300000, 0x9c480000, 0x1e6c0000, 0x46360000, 0x06410000,
+        0x956e8000, 0x92b2c000, 0xd1856000, 0xfa40d000, 0xcb651800, 0xe3b3a400, 0x1e02b600, 0xd10b3b00,
+        0x3f856080, 0x9340d0c0, 0x90e51860, 0x7af3a490, 0x2de2b628, 0x337b3b4c, 0x83ad60c6, 0x2a1cd025
+      },
+      { // 357
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x58000000, 0xac000000, 0x12000000, 0x2b000000,
+        0x11800000, 0x88c00000, 0x1de00000, 0x30f00000, 0x9cc80000, 0x73ec0000, 0x41fa0000, 0xe2430000,
+        0x0ca98000, 0x41d0c000, 0xe7d22000, 0x12d33000, 0x2a55d800, 0x701cac00, 0x00b3ee00, 0x1b685700,
+        0x93b22080, 0x76e330c0, 0x417dd8a0, 0x0400acb0, 0x8601ee58, 0x850757ac, 0xc081a092, 0x4640f0eb
+      },
+      { // 358
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x08000000, 0x54000000, 0x5a000000, 0x37000000,
+        0x0c800000, 0x38400000, 0xdfe00000, 0x6fd00000, 0xf4480000, 0x69ec0000, 0x3ed60000, 0xb1cf0000,
+        0x382c8000, 0xb6f34000, 0x6f3aa000, 0x7317f000, 0x97e78800, 0x9bdb2400, 0xbe470e00, 0x26e8f500,
+        0x6e5aa080, 0x8787f0c0, 0x8acf8860, 0xe2a72470, 0xafb90e08, 0xfd5bf554, 0x190820da, 0xb187b0f7
+      },
+      { // 359
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x18000000, 0x4c000000, 0xa2000000, 0xbb000000,
+        0x35800000, 0xfdc00000, 0xb6a00000, 0x63500000, 0x73c80000, 0xbfac0000, 0x25d20000, 0x1f870000,
+        0x02cd8000, 0xa526c000, 0x23952000, 0xbde23000, 0x41bb9800, 0x31fffc00, 0x069bda00, 0x4962ed00,
+        0x5efd2080, 0x1d1e30c0, 0x8da19820, 0x96d4fcf0, 0xae045a18, 0xf9032d4c, 0x5e858022, 0x204ac07b
+      },
+      { // 360
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0xf8000000, 0x34000000, 0x26000000, 0xe9000000,
+        0x5d800000, 0x75400000, 0xcde00000, 0x11b00000, 0x5f480000, 0x96e40000, 0x333e0000, 0x368d0000,
+        0xbfcb8000, 0x882d4000, 0x7a976000, 0xd3591000, 0x5a7a9800, 0x51673400, 0xb57d4e00, 0x15e84300,
+        0xd5bf6080, 0x314d1040, 0xe3ec98e0, 0x84be3450, 0xb8c0cef8, 0xe0ac0334, 0x585d80a6, 0xc0f440a9
+      },
+      { // 361
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xd8000000, 0x44000000, 0xfe000000, 0x2f000000,
+        0x39800000, 0xb8400000, 0xbba00000, 0x44500000, 0x0a480000, 0xa6a40000, 0x20d20000, 0xf68b0000,
+        0xd1c98000, 0xcbe64000, 0x53fce000, 0x2c177000, 0x39ebd800, 0x6ef26400, 0x78904a00, 0x1d255d00,
+        0x5d94e080, 0x6da37040, 0x9751d820, 0x99cd6430, 0x27e3cad8, 0x11fc1d44, 0x891b807e, 0x096d406f
+      },
+      { // 362
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x18000000, 0xcc000000, 0x22000000, 0x85000000,
+        0x38800000, 0x7bc00000, 0x91200000, 0xf4f00000, 0x7ac80000, 0x1fa40000, 0x043e0000, 0xa4650000,
+        0x35158000, 0x609ac000, 0x87d32000, 0xab3bd000, 0x6de04800, 0xa8531c00, 0xe5770200, 0x8b82a700,
+        0x884d2080, 0x456ed040, 0x6b9dc8e0, 0x885ddcd0, 0x95722218, 0xa38877cc, 0x8c4ee8a2, 0xb3660cc5
+      },
+      { // 363
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x88000000, 0x94000000, 0x22000000, 0x5b000000,
+        0xa0800000, 0x58400000, 0xcba00000, 0xabb00000, 0xa1480000, 0x70240000, 0xb37e0000, 0x62ad0000,
+        0x983c8000, 0x2d8f4000, 0x91c32000, 0x00633000, 0x5cd64800, 0x33172400, 0x7e7c4a00, 0x4b209300,
+        0x03f52080, 0x52ea3040, 0x9794c8e0, 0x2c356450, 0xff83ea88, 0xf2cce394, 0xece048a2, 0x3a9e241b
+      },
+      { // 364
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xd8000000, 0x14000000, 0xd2000000, 0x2f000000,
+        0x39800000, 0x19c00000, 0x11600000, 0x11500000, 0x14c80000, 0xbfe40000, 0x35120000, 0x266b0000,
+        0x5cd98000, 0xcf0b4000, 0x698a2000, 0xd1cd7000, 0xed61d800, 0x0f513c00, 0xfdcaa600, 0x7b6bad00,
+        0x3a502080, 0x17427040, 0x452a5820, 0xdbf17c30, 0xd3f906d8, 0x4ffd9d14, 0x41f3d852, 0x40fa3c6f
+      },
+      { // 365
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x58000000, 0x84000000, 0xb2000000, 0x47000000,
+        0xde800000, 0x04400000, 0xc7600000, 0xa2d00000, 0x8ac80000, 0x4b240000, 0x29b20000, 0xf6130000,
+        0xe8e98000, 0xcd1e4000, 0xf06a2000, 0x445ef000, 0x9a8a2800, 0xd64c2400, 0x1064a600, 0x9450f500,
+        0x5283a080, 0xba40b040, 0x7e600820, 0xe552d4b0, 0x790e8e58, 0x278cd184, 0x63cf0632, 0x84a44507
+      },
+      { // 366
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x68000000, 0x8c000000, 0x62000000, 0x5d000000,
+        0x1e800000, 0xa6400000, 0xf0200000, 0x87900000, 0xe0c80000, 0x226c0000, 0x11be0000, 0x845d0000,
+        0x8b228000, 0x5a1ac000, 0xbf052000, 0x838a5000, 0x58c1a800, 0x06618400, 0x1fba7200, 0xeb5c8100,
+        0xa0a7a080, 0x6ed090c0, 0x8b6488e0, 0xa93bd450, 0x2113da68, 0x6281058c, 0xdc4bd2e2, 0xf92d119d
+      },
+      { // 367
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x78000000, 0xc4000000, 0xca000000, 0x69000000,
+        0x26800000, 0x9fc00000, 0x9e600000, 0xb5900000, 0xfd480000, 0x8ba40000, 0xa2fe0000, 0x7e590000,
+        0x912b8000, 0x73364000, 0xa33ba000, 0x7b3c1000, 0x4f3ba800, 0xed3a1c00, 0x38375600, 0x10b76100,
+        0x2c702080, 0xfd9a5040, 0xf14808e0, 0x0da20c10, 0xadf2fe78, 0x47d47dc4, 0x4f6cf64a, 0xf71b7129
+      },
+      { // 368
+        0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0xe8000000, 0x64000000, 0x0e000000, 0x91000000,
+        0x92800000, 0x83400000, 0xb0e00000, 0x2d100000, 0xadc80000, 0xf1a40000, 0x86fe0000, 0x3d530000,
+        0x34a28000, 0xb27c4000, 0xab1de000, 0xa8c09000, 0x652be800, 0x40bb9400, 0xf93f7e00, 0x6ff62900,
+        0x33df6080, 0x65ecd040, 0xa19e08e0, 0x078f04b0, 0xefc296e8, 0xaaaabd64, 0xdb749e8e, 0xe591b9d1
+      },
+      { // 369
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x78000000, 0xb4000000, 0x4a000000, 0x2d000000,
+        0xca800000, 0x12c00000, 0x3fa00000, 0xfe500000, 0x24480000, 0x1b6c0000, 0x1afa0000, 0x6b950000,
+        0x4c638000, 0x357d4000, 0x0fdba000, 0x370c5000, 0x5f866800, 0xcc49cc00, 0xb76f0a00, 0x94fd5d00,
+        0xa4982080, 0x67e110c0, 0x1335c8a0, 0x45b99cd0, 0x117b6278, 0x5ddd91b4, 0xde06aaca, 0x77080ded
+      },
+      { // 370
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x08000000, 0x04000000, 0x42000000, 0xff000000,
+        0x06800000, 0x6fc00000, 0x2b600000, 0x0e900000, 0x9b480000, 0x63a40000, 0x8f7a0000, 0x2c110000,
+        0x668c8000, 0x1fce4000, 0x13672000, 0x92967000, 0xd548a800, 0xdaa69c00, 0x34f36600, 0xba5e7100,
+        0x24a3a080, 0x55fc3040, 0xadd588a0, 0x64e1ec90, 0xa2d74e08, 0x1a66ad04, 0xf11fe6c2, 0xef0031bf
+      },
+      { // 371
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x78000000, 0xfc000000, 0x16000000, 0xdd000000,
+        0x1a800000, 0x2e400000, 0x61200000, 0x10500000, 0x26c80000, 0x38640000, 0x80f20000, 0x6f530000,
+        0x334b8000, 0x1ba9c000, 0xae186000, 0x8fe95000, 0xac3de800, 0x4c364400, 0x9c3da200, 0x7434fd00,
+        0x403be080, 0xd2349040, 0xe53f8820, 0x34b814b0, 0xdd71ca78, 0x889c79fc, 0xd7a7a296, 0x8013fd9d
+      },
+      { // 372
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xb8000000, 0xbc000000, 0xbe000000, 0x73000000,
+        0x08800000, 0x0ac00000, 0x87600000, 0x47100000, 0x79480000, 0xc1240000, 0xe8b20000, 0x443b0000,
+        0x3cf78000, 0xee95c000, 0x5e06e000, 0x2309b000, 0xa081c800, 0x3ec80c00, 0x3d64e600, 0x3613e900,
+        0xbcc36080, 0xb0677040, 0x6d90a820, 0x8e847c30, 0x85cbceb8, 0x11e655bc, 0x0edc4e3e, 0x4ea39533
+      },
+      { // 373
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0xc8000000, 0x24000000, 0xbe000000, 0xaf000000,
+        0x55800000, 0xb6400000, 0x2d600000, 0xf9900000, 0x28c80000, 0x50ac0000, 0x5dbe0000, 0x11bf0000,
+        0xdbb88000, 0x92b84000, 0xf436e000, 0x45fb7000, 0xebd69800, 0x7ba34400, 0xe6380600, 0x50f41100,
+        0x3f506080, 0x8f6c30c0, 0xc490f8e0, 0xa84c7470, 0xd2667ec8, 0xf4132524, 0x02867e3e, 0x2fc3256f
+      },
+      { // 374
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x68000000, 0xfc000000, 0x22000000, 0x13000000,
+        0x95800000, 0x90400000, 0x21a00000, 0xe2300000, 0xbac80000, 0x2e640000, 0x1cda0000, 0x1ed50000,
+        0x9dda8000, 0xc059c000, 0x7c192000, 0x17bcb000, 0x1a8b1800, 0x17c16400, 0xbaef4a00, 0x12102b00,
+        0x7eb9a080, 0x78007040, 0x7400b8a0, 0xae0014d0, 0x89077268, 0x1288fffc, 0xdbcf72a2, 0x80ecff53
+      },
+      { // 375
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xa8000000, 0x3c000000, 0xde000000, 0x81000000,
+        0x14800000, 0xd7c00000, 0x7ee00000, 0xb4100000, 0x1ee80000, 0xa4140000, 0xe6e20000, 0xc01b0000,
+        0xace88000, 0xa318c000, 0xe7656000, 0xe150d000, 0x5ac42800, 0xfc6dac00, 0x8edbc600, 0xf28aed00,
+        0xd2c42880, 0x706dac40, 0x58dbc6a0, 0xbf8aedf0, 0xb0442828, 0x1aadac7c, 0xecbbc67e, 0x5d5aed71
+      },
+      { // 376
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x78000000, 0x64000000, 0xd2000000, 0x05000000,
+        0x27800000, 0xb7c00000, 0xe2200000, 0x4fb00000, 0x7e280000, 0xb9b40000, 0x49260000, 0x8b350000,
+        0xa1618000, 0xbad34000, 0xdefca000, 0x8e4b1000, 0x3ee2d800, 0xc9126c00, 0x1edffa00, 0xacf21700,
+        0x7b42d880, 0x71626c40, 0x62d7fae0, 0x4af61710, 0x344cd8f8, 0x27e36c24, 0x58907a32, 0x7e105715
+      },
+      { // 377
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x18000000, 0x64000000, 0x52000000, 0xd1000000,
+        0x01800000, 0x4f400000, 0x8a200000, 0xf1900000, 0x16280000, 0xd79c0000, 0x5d220000, 0x0b1b0000,
+        0x3de38000, 0x297d4000, 0xc4d6a000, 0x51085000, 0xc182b800, 0xef42a400, 0xfa2b1a00, 0xe9913d00,
+        0x7222b880, 0x8592a4c0, 0x8c231aa0, 0x0a9d3d70, 0x72a8b898, 0xa355a4a4, 0x35429af2, 0x472b7da1
+      },
+      { // 378
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xe8000000, 0x3c000000, 0xe6000000, 0xc5000000,
+        0xf2800000, 0x18c00000, 0xb2a00000, 0x51300000, 0x84a80000, 0x2c3c0000, 0x322a0000, 0xb6f70000,
+        0x77848000, 0x0a44c000, 0x3a62e000, 0xbb949000, 0x0197c800, 0x729a1c00, 0x3d1c6200, 0xb355cf00,
+        0x2b3fc880, 0xd7a61cc0, 0xd3b66220, 0x5462cfb0, 0x129b4868, 0x6d12dcfc, 0xcb5c82c6, 0x4f3a5f75
+      },
+      { // 379
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xe8000000, 0xa4000000, 0x0a000000, 0x39000000,
+        0xa5800000, 0x04400000, 0xb7e00000, 0xead00000, 0xe5e80000, 0x4fdc0000, 0x266a0000, 0xcc9d0000,
+        0xef048000, 0x1a874000, 0x16cc2000, 0x3528d000, 0x2df47800, 0xbd119400, 0xf9458600, 0xe8637900,
+        0x0f9c7880, 0xab8d94c0, 0xe74f8620, 0xe36e7910, 0xff10f868, 0xb446d464, 0x8fe1a62a, 0x86d7a929
+      },
+      { // 380
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x28000000, 0x34000000, 0x8a000000, 0xb1000000,
+        0x06800000, 0x77400000, 0xfc600000, 0x4a900000, 0x22680000, 0x41940000, 0xcde20000, 0xfc590000,
+        0xd0c08000, 0x45aa4000, 0x85b02000, 0xe69d5000, 0x84664800, 0x16912400, 0x3c680e00, 0xaa934d00,
+        0x526e4880, 0xb9952440, 0xd1e20ea0, 0x425e4dd0, 0xebccc8a8, 0xf2266474, 0xf472ae2a, 0x6db95d61
+      },
+      { // 381
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xc8000000, 0x0c000000, 0xca000000, 0x73000000,
+        0x80800000, 0xdf400000, 0x2fa00000, 0x2dd00000, 0x01a80000, 0x48dc0000, 0x50220000, 0x781d0000,
+        0x224e8000, 0xda2dc000, 0x6b1a2000, 0x12cef000, 0xdd642800, 0x80b00400, 0xf91f5200, 0x65c09900,
+        0x3bec2880, 0xf6fc04c0, 0xed3552a0, 0x1bd19910, 0x00a8a848, 0xcf50c4cc, 0x11e3f26a, 0xf5ffa963
+      },
+      { // 382
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x88000000, 0x4c000000, 0x36000000, 0xbb000000,
+        0x1d800000, 0x86400000, 0xfd200000, 0x3e100000, 0x6a280000, 0x05940000, 0x8f620000, 0xd13b0000,
+        0xc53a8000, 0x8737c000, 0x6e3de000, 0x42b67000, 0xdc733800, 0x4d969400, 0x23682a00, 0xb73e1500,
+        0x06313880, 0x5ebd9440, 0x927aaaa0, 0x329dd5f0, 0x44eed808, 0xbc70e40c, 0x5d931296, 0xfb6c814b
+      },
+      { // 383
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x58000000, 0xcc000000, 0x36000000, 0x77000000,
+        0x64800000, 0x81c00000, 0x98e00000, 0x48100000, 0x13e80000, 0x12940000, 0xd1220000, 0x04f50000,
+        0x01f78000, 0x5071c000, 0x8830e000, 0xfc9cb000, 0x2a27a800, 0xf6792c00, 0xe736e600, 0xf41ccd00,
+        0x8de5a880, 0x419c2c40, 0x07a966a0, 0x50390d10, 0x709748d8, 0xbc259c8c, 0x91714e96, 0xdbb5e167
+      },
+      { // 384
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x38000000, 0xc4000000, 0xca000000, 0x4d000000,
+        0xf8800000, 0xfe400000, 0x67600000, 0xb8100000, 0x98680000, 0xa99c0000, 0x64a20000, 0xd5b50000,
+        0xbf518000, 0x05814000, 0x6ec92000, 0xc52b9000, 0x4179a800, 0x9f7cf400, 0x407d1e00, 0x01f21500,
+        0x6533a880, 0x4d15f4c0, 0x64ee9ea0, 0x3dd65590, 0xdec308b8, 0xad232404, 0x1d7c166a, 0x017431dd
+      },
+      { // 385
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x78000000, 0x94000000, 0xce000000, 0xd3000000,
+        0x28800000, 0x5dc00000, 0xd8a00000, 0xc5b00000, 0x60280000, 0xf07c0000, 0x84820000, 0x67cb0000,
+        0x15ad8000, 0x363e4000, 0xf9636000, 0x2f187000, 0x849c6800, 0x39dbec00, 0xf0b68200, 0xc7a9c700,
+        0x0731e880, 0xf8e5acc0, 0x3755e2a0, 0x8271b770, 0xc58d80f8, 0x1e4e4054, 0x99eb606e, 0xfed470a3
+      },
+      { // 386
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x28000000, 0x64000000, 0x6a000000, 0x6f000000,
+        0xe1800000, 0x4a400000, 0x6ee00000, 0xc6b00000, 0x37680000, 0x30fc0000, 0x5f8a0000, 0xa74f0000,
+        0xa4608000, 0x37754000, 0x54cc2000, 0x1d2cb000, 0x8e1ab800, 0xa1395400, 0xec2e7600, 0xb2908f00,
+        0x09fa3880, 0x170c14c0, 0x7d825620, 0x7c4c3f30, 0x17e880a8, 0x6e3940a4, 0xfdae204a, 0xf0dfb05f
+      },
+      { // 387
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0xa8000000, 0xc4000000, 0x12000000, 0x21000000,
+        0x63800000, 0x51400000, 0xa5200000, 0x1b500000, 0xa4a80000, 0x13140000, 0x6e0e0000, 0x1f0d0000,
+        0xf48c8000, 0x91c54000, 0x1eeba000, 0x48be5000, 0x599f1800, 0x28cb0400, 0xa16e6a00, 0x97fba100,
+        0x33bb9880, 0x0f1a4440, 0xc00bca60, 0x2008f190, 0xf0080028, 0x38040084, 0x6c060072, 0xd60900b1
+      },
+      { // 388
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x38000000, 0x34000000, 0x2a000000, 0x71000000,
+        0x55800000, 0xf9c00000, 0x64600000, 0x10f00000, 0x38e80000, 0x68bc0000, 0x1f4a0000, 0xe5270000,
+        0x6ed18000, 0x52b04000, 0x26452000, 0x9caa5000, 0x391ef800, 0x55d80c00, 0x2637de00, 0x22097300,
+        0xbd057880, 0x6b8f4cc0, 0x12c37e20, 0x78e363b0, 0x88b6a0b8, 0x8f4110f4, 0x6d20580a, 0x62d51cc1
+      },
+      { // 389
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xf8000000, 0xd4000000, 0x56000000, 0x17000000,
+        0x28800000, 0x58400000, 0xf3e00000, 0xda500000, 0xba680000, 0x6d9c0000, 0x61420000, 0xd86d0000,
+        0x5c958000, 0x16c44000, 0x94a6e000, 0x8d363000, 0xaa7ee800, 0x9d1f7400, 0x3d0ef600, 0x258a4100,
+        0x55c16880, 0x2a2a34c0, 0x627f96a0, 0x61153110, 0xe70ce078, 0xa0873014, 0xc44968f6, 0x99e63407
+      },
+      { // 390
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x68000000, 0xbc000000, 0x9e000000, 0x57000000,
+        0x7e800000, 0x55c00000, 0xa2200000, 0xf8300000, 0x5da80000, 0x08740000, 0x52c60000, 0x14ad0000,
+        0x61f88000, 0x998ac000, 0x734b6000, 0x53e0b000, 0x80170800, 0xb89eac00, 0x5e5a0a00, 0xb8f13f00,
+        0x98018880, 0x040d6c40, 0xaa0feae0, 0xe5064f90, 0xdf8d60e8, 0xc04db0fc, 0x176f887e, 0x58d46cc7
+      },
+      { // 391
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x58000000, 0x5c000000, 0xb6000000, 0x89000000,
+        0xb6800000, 0xb6400000, 0xf9600000, 0x3ed00000, 0x18e80000, 0xa31c0000, 0x334e0000, 0x61e10000,
+        0x3d938000, 0x3100c000, 0xfa82e000, 0x384b5000, 0xfc6d0800, 0x66567400, 0x7ba93e00, 0x5affe900,
+        0x32d88880, 0x36ebb4c0, 0x16165e60, 0xe3c579d0, 0x06ace0d8, 0x2e7a509c, 0x0f9688d6, 0x920ab459
+      },
+      { // 392
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0xb8000000, 0x8c000000, 0x82000000, 0x29000000,
+        0x25800000, 0x21c00000, 0x68200000, 0xa3700000, 0x7aa80000, 0x94340000, 0x03ce0000, 0xb1290000,
+        0x8efd8000, 0xbf6dc000, 0x4a17a000, 0x87b45000, 0x450b7800, 0x37890c00, 0xd0c71a00, 0x11a68b00,
+        0xb8b0f880, 0xb789cc40, 0x90cb3a60, 0x71a21bd0, 0x68bfa038, 0x0f8050cc, 0x1cc578e2, 0xf3a00cf9
+      },
+      { // 393
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x28000000, 0x74000000, 0xea000000, 0x07000000,
+        0xe1800000, 0x7a400000, 0x8a600000, 0x8cd00000, 0x40280000, 0xeebc0000, 0x18f20000, 0x74970000,
+        0xd94c8000, 0xf9e24000, 0x3d952000, 0xadceb000, 0xa9297800, 0xaa343400, 0x60336e00, 0x97378100,
+        0xfebc5880, 0xc0fa84c0, 0x889a16a0, 0x7743b530, 0x3cef36a8, 0xaf1d05b4, 0xdc0e4eca, 0x5e0531f7
+      },
+      { // 394
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x38000000, 0x84000000, 0xae000000, 0x53000000,
+        0x4a800000, 0xd6c00000, 0x8de00000, 0x46b00000, 0x55280000, 0x085c0000, 0x31160000, 0x87bf0000,
+        0xa6a98000, 0x89114000, 0xc3b46000, 0xe8a1f000, 0x6a178800, 0xb137fc00, 0xba6f2600, 0x49f15f00,
+        0xa48be880, 0xa5ca0cc0, 0x976eaee0, 0x1879a3b0, 0x64cd4eb8, 0x64ea1344, 0x993126ce, 0x96625f23
+      },
+      { // 395
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xb8000000, 0x54000000, 0xfa000000, 0x2b000000,
+        0xf1800000, 0x42c00000, 0x93a00000, 0x24900000, 0x73680000, 0xf8340000, 0x847e0000, 0xc69b0000,
+        0x5c618000, 0x5bb04000, 0x71bd2000, 0xb2b77000, 0xbf347800, 0x9bf17c00, 0x355db200, 0x65480d00,
+        0x74615880, 0x87b20c40, 0x07b7ca60, 0x47b27170, 0x27b56a38, 0x57be4114, 0xefb5b21a, 0xbbbc0d1b
+      },
+      { // 396
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0xd8000000, 0x8c000000, 0x6e000000, 0x79000000,
+        0x28800000, 0x23400000, 0x9c600000, 0xad700000, 0x19280000, 0xdc1c0000, 0x9ed60000, 0x617d0000,
+        0x57278000, 0xd513c000, 0xfe546000, 0x163fd000, 0x294b2800, 0x6f608400, 0xb6f0be00, 0xc1e9bb00,
+        0x08b74880, 0x3f0354c0, 0x558d96e0, 0xd1c43f90, 0xb4287658, 0xd6952f4c, 0x4a90be0e, 0x3c99bb29
+      },
+      { // 397
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xa8000000, 0x5c000000, 0x5a000000, 0x91000000,
+        0xe2800000, 0xcfc00000, 0x7ae00000, 0x87b00000, 0xd8280000, 0x95dc0000, 0x895a0000, 0x99950000,
+        0xa6fc8000, 0x7f02c000, 0x95802000, 0xd6455000, 0x7ea5c800, 0x241f0c00, 0xecb8f600, 0x7ba21f00,
+        0x309fe880, 0x707f5cc0, 0x96c9be20, 0x3463d310, 0x8a7d3e28, 0xd7cd139c, 0x5eef1efa, 0x09b14341
+      },
+      { // 398
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0xe8000000, 0x0c000000, 0x7e000000, 0x05000000,
+        0xea800000, 0x23400000, 0xada00000, 0x94f00000, 0x7fe80000, 0xf9dc0000, 0xb7560000, 0xc6130000,
+        0x80b48000, 0x63cdc000, 0x31ec6000, 0x34d71000, 0xc1d80800, 0x035fc400, 0xcc190200, 0x6fbf6300,
+        0x16426880, 0x8f2bd4c0, 0x2bbd8ae0, 0x34416770, 0x8c290a68, 0x503ca7cc, 0x678d6a1e, 0x75c7b7b5
+      },
+      { // 399
+        0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x78000000, 0xac000000, 0xaa000000, 0xdb000000,
+        0xf2800000, 0xdf400000, 0xc3a00000, 0xb7900000, 0xf6680000, 0xb7740000, 0xb0560000, 0x71830000,
+        0xd1cd8000, 0xdeebc000, 0x8b322000, 0xcd78f000, 0x43534800, 0x4708e400, 0x808ba200, 0xb84f2500,
+        0x132ce880, 0x67dbd440, 0xc14acae0, 0xaeaf31f0, 0xac1c02f8, 0x5ca815ec, 0x8b1b80ca, 0x6c28c06b
+      },
+      { // 400
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x38000000, 0x7c000000, 0xa6000000, 0x1b000000,
+        0x98800000, 0x3e400000, 0x22200000, 0x98f00000, 0xace80000, 0x80940000, 0xec3a0000, 0x99850000,
+        0x7bc58000, 0x2fecc000, 0xb410e000, 0x6c7df000, 0x4ca82800, 0xe5be3400, 0xda491a00, 0x282d6300,
+        0x3dfd4880, 0xc36f0440, 0xb851d220, 0x975ea790, 0x1dd47ab8, 0x6a98533c, 0xb9378006, 0x7e0dc0cb
+      },
+      { // 401
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0xd8000000, 0xfc000000, 0xc2000000, 0x0b000000,
+        0x51800000, 0xc9c00000, 0x11200000, 0x6d100000, 0x0b680000, 0x1efc0000, 0x56de0000, 0x79450000,
+        0x76678000, 0x6278c000, 0x9b98a000, 0x2926f000, 0x411cf800, 0x716f0c00, 0xf9f43a00, 0x1d531500,
+        0x478bd880, 0xf4cd3cc0, 0xcdae6260, 0xd05fe910, 0x93049a58, 0x0d89e53c, 0x7bc92022, 0xd22730db
+      },
+      { // 402
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0xd8000000, 0x24000000, 0x5a000000, 0x6f000000,
+        0xc8800000, 0x0d400000, 0x08e00000, 0x29700000, 0xb7280000, 0xd3dc0000, 0x26320000, 0x34c10000,
+        0xc82b8000, 0xa35d4000, 0xff752000, 0xee2d3000, 0x725d6800, 0xa2f48400, 0x14e67600, 0x67770b00,
+        0xaa2bc880, 0xd858f4c0, 0x45fc3ea0, 0x206fbf50, 0x143b5658, 0x97c63be4, 0x56a4a07a, 0x371d70ff
+      },
+      { // 403
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x98000000, 0x04000000, 0xa6000000, 0xcf000000,
+        0x07800000, 0x99400000, 0x5be00000, 0x5eb00000, 0x5f280000, 0x61140000, 0x8cfa0000, 0xe5410000,
+        0x49ef8000, 0x5fbf4000, 0xdba6e000, 0xc5d13000, 0x23505800, 0x8e9e0400, 0x19beb600, 0xa4af4700,
+        0xaa513880, 0xf6147440, 0xef7a0e20, 0x2a0573d0, 0x95025618, 0x9a8f7744, 0xbfc6e006, 0x9621305f
+      },
+      { // 404
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x38000000, 0xf4000000, 0xae000000, 0x37000000,
+        0x2d800000, 0x20c00000, 0x7da00000, 0xeb700000, 0x97e80000, 0x639c0000, 0x75f20000, 0x9ca10000,
+        0x65f58000, 0xc4a84000, 0x61f06000, 0x02adb000, 0x9afe7800, 0x752a1c00, 0x23303200, 0x12050300,
+        0xc5099880, 0xd88eecc0, 0x304baaa0, 0xd1eaef50, 0x5897b2b8, 0xa27c4334, 0x7564788e, 0x3ad71ca7
+      },
+      { // 405
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x78000000, 0xac000000, 0xe2000000, 0x61000000,
+        0x01800000, 0x88c00000, 0x74a00000, 0xa9500000, 0xa0e80000, 0x3eb40000, 0xe0d20000, 0xbc270000,
+        0xa4198000, 0x7a83c000, 0x0446a000, 0xbfe15000, 0x843ff800, 0x049f3c00, 0x13c78200, 0xe8222100,
+        0xaa12d880, 0x598aac40, 0xd4cf5aa0, 0x4eab8db0, 0xd45e02f8, 0x3b61e1ec, 0x7b7478c2, 0x77fbfc91
+      },
+      { // 406
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0xd8000000, 0x0c000000, 0xba000000, 0x3f000000,
+        0x40800000, 0xf4400000, 0x08600000, 0x6e700000, 0x17a80000, 0xc4dc0000, 0x50fe0000, 0x22e70000,
+        0x8d378000, 0xeb4dc000, 0xd8e92000, 0x1238b000, 0xfbc46800, 0xc4a69400, 0xce51be00, 0x23bd0b00,
+        0x5604c880, 0x7504e4c0, 0xc7837660, 0x88c2ef30, 0x9e2e3e58, 0x551ccbcc, 0x835be85a, 0x183754cf
+      },
+      { // 407
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0xd8000000, 0x2c000000, 0xbe000000, 0xe5000000,
+        0x11800000, 0x20c00000, 0xb7e00000, 0xc7100000, 0x27a80000, 0x3bb40000, 0xa8960000, 0x42650000,
+        0xedd78000, 0x074dc000, 0x262b6000, 0x837f1000, 0xd3793800, 0xab763c00, 0xf774f600, 0x017f8500,
+        0x1073d880, 0x93f1ec40, 0xe8392ee0, 0xab5f6990, 0x5d0b7658, 0xed86456c, 0xa6ceb8de, 0xeeebfc35
+      },
+      { // 408
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x98000000, 0xdc000000, 0x0a000000, 0x35000000,
+        0x77800000, 0xf9c00000, 0x44e00000, 0xbc900000, 0x75a80000, 0x03340000, 0x639e0000, 0x87230000,
+        0x757b8000, 0xf2bcc000, 0xed5a2000, 0x554d1000, 0xf9a71800, 0x413cec00, 0x82932600, 0x4eabcd00,
+        0xf7b0b880, 0x22da3c40, 0xe08b9e60, 0xdf45f1f0, 0x8ca52618, 0x56bccd9c, 0x8b5538ea, 0x9245fc85
+      },
+      { // 409
+        0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x98000000, 0x2c000000, 0x22000000, 0x21000000,
+        0xb1800000, 0x2bc00000, 0x39200000, 0xaff00000, 0x35f80000, 0x28fc0000, 0x73720000, 0x7db90000,
+        0x63108000, 0xc8224000, 0x76786000, 0x4a367000, 0xafd76800, 0x4780d400, 0xf4c9c600, 0xf3ac7900,
+        0x88b1c680, 0x2c907940, 0x98e3c660, 0x43d979f0, 0xc58b46f8, 0x85c739dc, 0x6a2126da, 0x177849fd
+      },
+      { // 410
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x48000000, 0x8c000000, 0x9a000000, 0x95000000,
+        0x69800000, 0x07c00000, 0xd0600000, 0x72500000, 0x10580000, 0x51540000, 0x86da0000, 0xd2170000,
+        0x2cf38000, 0x29eb4000, 0x1d9ae000, 0x7c37b000, 0x21032800, 0xc7885400, 0xfcc0d200, 0xa2e5b700,
+        0xd718d280, 0x2d71b7c0, 0x9222d260, 0xcff6b710, 0x5f695228, 0x4ed9f79c, 0x9e11b2b2, 0x56fd4709
+      },
+      { // 411
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x78000000, 0x04000000, 0x9a000000, 0x17000000,
+        0xc1800000, 0x55400000, 0xd8200000, 0x05700000, 0xea780000, 0xeff40000, 0x80be0000, 0x1f9b0000,
+        0xa36c8000, 0x1854c000, 0xb5896000, 0x27461000, 0x13290800, 0x0af4dc00, 0x4a339e00, 0xe551a900,
+        0x8b0d9e80, 0x6f8aa9c0, 0x50411e20, 0x22ae6990, 0x77b07e58, 0xee1c7994, 0x7e2776c2, 0xec73a583
+      },
+      { // 412
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x08000000, 0xfc000000, 0xfe000000, 0xbb000000,
+        0x32800000, 0xb8c00000, 0x72e00000, 0xd0d00000, 0xc3d80000, 0x3d540000, 0x839a0000, 0xae7b0000,
+        0x462b8000, 0x843c4000, 0xbc07a000, 0xde061000, 0x4b063800, 0x2a823400, 0x4ccb5a00, 0x70e6f700,
+        0x95d15a80, 0x4a5df7c0, 0xb71ada60, 0x49b1b7d0, 0x0c457a68, 0x5523a72c, 0x7ab94296, 0x02ca9397
+      },
+      { // 413
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x18000000, 0x8c000000, 0xf6000000, 0x99000000,
+        0x95800000, 0x74c00000, 0x23a00000, 0x31900000, 0xcc980000, 0xfb140000, 0xccde0000, 0x65f90000,
+        0x34288000, 0xb6584000, 0xddb32000, 0x56ccb000, 0xa0a0e800, 0x1b1d2400, 0xdcd45e00, 0xadfbe700,
+        0xd02a5e80, 0xd452e7c0, 0x3ebade20, 0xac4ea7b0, 0xd8effe38, 0xd9ff173c, 0xba2196ce, 0x735773a5
+      },
+      { // 414
+        0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xe8000000, 0xc4000000, 0x5a000000, 0x5b000000,
+        0x21800000, 0xa8c00000, 0xcba00000, 0xa4300000, 0x31380000, 0x29bc0000, 0x47f20000, 0x03150000,
+        0xe94b8000, 0x536fc000, 0x679e6000, 0x210dd000, 0xaa84c800, 0xf14ac400, 0x3f633e00, 0x19955d00,
+        0x50093e80, 0x380c5d40, 0xbc08be60, 0x060a9d30, 0x2d0f5e88, 0xe48d8df4, 0x884676d2, 0x19e959af
+      },
+      { // 415
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xe8000000, 0x4c000000, 0xa2000000, 0xc1000000,
+        0xbb800000, 0x3c400000, 0xe2e00000, 0x87900000, 0xc4180000, 0xbc540000, 0xc0b60000, 0x9c230000,
+        0x86b58000, 0x53254000, 0x2e396000, 0xade67000, 0xef104800, 0x1adacc00, 0x2d7f8200, 0x9f8c8b00,
+        0x124a0280, 0xa1e9cbc0, 0xad1362a0, 0xabdfbb90, 0x2efb2a48, 0x07c177dc, 0x1eaaa8ea, 0x457afc1d
+      },
+      { // 416
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x28000000, 0xb4000000, 0xaa000000, 0xb7000000,
+        0xca800000, 0xa1400000, 0x51a00000, 0x75300000, 0x83b80000, 0xacfc0000, 0xe85e0000, 0x84e30000,
+        0xee998000, 0xb18ec000, 0x1dca6000, 0x79ea1000, 0x231b3800, 0x024dec00, 0xa1279600, 0x6b7c5500,
+        0x7c9e1680, 0xfa829540, 0x394c76a0, 0x3da48590, 0x93314e88, 0x02b66924, 0xcf715822, 0x9e97fc93
+      },
+      { // 417
+        0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0xd8000000, 0x24000000, 0xf2000000, 0x3b000000,
+        0xb2800000, 0x3dc00000, 0xefe00000, 0xea100000, 0x2a980000, 0x6c5c0000, 0x91360000, 0x36e10000,
+        0x2b948000, 0x89dac000, 0xc07be000, 0xa1c55000, 0xa9ecf800, 0x2b14e400, 0x2f157a00, 0xed144b00,
+        0xae19fa80, 0x48928b40, 0x5f541a20, 0xafb6db30, 0x052c62f8, 0x2978ff14, 0x1842f80a, 0x5ea9e42f
+      },
+      { // 418
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0xf8000000, 0xe4000000, 0xee000000, 0xd3000000,
+        0x85800000, 0x61c00000, 0x81e00000, 0x16f00000, 0x79780000, 0x95b40000, 0xdad20000, 0xbc650000,
+        0x33328000, 0x0698c000, 0xd84c2000, 0x3a281000, 0x4214c800, 0x550d1400, 0xfa86aa00, 0x76419500,
+        0x492c2a80, 0xd79d55c0, 0xbcca0ae0, 0x676445b0, 0x6abe4218, 0x0d549154, 0x14a648f6, 0x8255d487
+      },
+      { // 419
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x48000000, 0xcc000000, 0x36000000, 0x5d000000,
+        0xb5800000, 0x91c00000, 0x42600000, 0xec700000, 0xbbf80000, 0x253c0000, 0x45d60000, 0x3eef0000,
+        0x3a338000, 0x6f534000, 0xc5ae2000, 0x2310f000, 0x0a0a2800, 0x530d7400, 0x5c81f200, 0x064e0500,
+        0x3caa7280, 0xbc914540, 0x18ca5220, 0xa5e2b5d0, 0xeabdfa68, 0xff1f811c, 0x340fa85e, 0x62013441
+      },
+      { // 420
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x08000000, 0x04000000, 0xaa000000, 0x8b000000,
+        0x27800000, 0x2dc00000, 0x31200000, 0x30f00000, 0x8c780000, 0x6e340000, 0x06d60000, 0xf5030000,
+        0xce8b8000, 0xa547c000, 0xc16f6000, 0xaf12d000, 0xae282800, 0x557eb400, 0x5eb10600, 0x8a91b900,
+        0x9cec8680, 0xc1d579c0, 0x9c8866a0, 0xb2406990, 0x60ef2ea8, 0xf7dc0d94, 0x918e0002, 0xe0c7001f
+      },
+      { // 421
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x38000000, 0xbc000000, 0x52000000, 0x3b000000,
+        0x29800000, 0xf3400000, 0xb0600000, 0x33b00000, 0x25380000, 0x51fc0000, 0xdbd60000, 0xfa8d0000,
+        0x0ec68000, 0x85294000, 0xded66000, 0xd206d000, 0x7b0bc800, 0x89813c00, 0x434e1a00, 0x88661100,
+        0x8fbe9a80, 0x77325140, 0x6af67a20, 0xf251c1f0, 0x09c5d218, 0xbea72d4c, 0xb690804a, 0xfbe44077
+      },
+      { // 422
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x18000000, 0xa4000000, 0x62000000, 0xb3000000,
+        0xda800000, 0x6c400000, 0x2ce00000, 0xcb500000, 0x4ed80000, 0xd61c0000, 0x9bba0000, 0x63810000,
+        0x99c88000, 0x8c26c000, 0xf2f6e000, 0x7ceed000, 0x235ef800, 0x92d87c00, 0xa0159200, 0x52be9700,
+        0xae071280, 0x4d095740, 0x7f8172e0, 0xcfcd47f0, 0x952b6af8, 0x9776eb54, 0x142a809a, 0x16fbc0e7
+      },
+      { // 423
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x98000000, 0x24000000, 0x1e000000, 0xa3000000,
+        0xe4800000, 0x5bc00000, 0x1ba00000, 0xa4f00000, 0x6d780000, 0xa93c0000, 0xc9d20000, 0x23430000,
+        0xca628000, 0x6a54c000, 0x22032000, 0xd9041000, 0xb989d800, 0x0c412400, 0x3ce9fe00, 0xc0924100,
+        0xcc217e80, 0xc3b98140, 0xe912de60, 0x186a5150, 0x3b5aa6f8, 0x278ba574, 0xef41a0e6, 0x3860d0d7
+      },
+      { // 424
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x98000000, 0x2c000000, 0xd6000000, 0xd1000000,
+        0x13800000, 0x20c00000, 0x57600000, 0xb8b00000, 0xdc380000, 0x56740000, 0xb6560000, 0x0b470000,
+        0x8ba68000, 0x81d84000, 0x898f2000, 0xd7c73000, 0x3de18800, 0x2ff24400, 0xc99ad200, 0x92ab0900,
+        0xc6525280, 0x634049c0, 0x0fadf2a0, 0xf3d839d0, 0x3a85da38, 0xef450dfc, 0x09a9a0ee, 0x9adf702d
+      },
+      { // 425
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xe8000000, 0x94000000, 0x2a000000, 0x4d000000,
+        0x30800000, 0x74c00000, 0xb9a00000, 0xdd300000, 0x7eb80000, 0x4dfc0000, 0x45160000, 0xe9c90000,
+        0xd12f8000, 0x75f2c000, 0x89126000, 0x1fcdb000, 0xd2223800, 0xca773400, 0x14528e00, 0xc829cd00,
+        0x8f730e80, 0xe0de0d40, 0x8ee0ee20, 0x07d47db0, 0xb36936c8, 0xe3953924, 0x8e0460e2, 0x6f04b069
+      },
+      { // 426
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x48000000, 0x4c000000, 0x66000000, 0x27000000,
+        0xec800000, 0x8ec00000, 0x3ae00000, 0x62b00000, 0xd4780000, 0xca940000, 0x522a0000, 0xbf510000,
+        0xba418000, 0xa02f4000, 0xea582000, 0xc3cbd000, 0xb7625800, 0xf7fe9400, 0xf4d8ea00, 0x180f9900,
+        0xf400ca80, 0x820449c0, 0x3d029260, 0xe58addf0, 0x09427828, 0x3ea144bc, 0xf190b2ce, 0x60a00d5b
+      },
+      { // 427
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x18000000, 0xdc000000, 0xee000000, 0x6f000000,
+        0x90800000, 0x4d400000, 0xa9a00000, 0x83d00000, 0x02980000, 0xfd3c0000, 0xfde20000, 0x49f70000,
+        0x528a8000, 0xa4454000, 0xa22ca000, 0xa418d000, 0xa3789800, 0x1acaec00, 0x2063a600, 0xad338300,
+        0xa5ef0680, 0x75fb5340, 0x6c8f9e60, 0xd34dbf90, 0xeeae3878, 0x07593c4c, 0x65d3be16, 0x099b2f63
+      },
+      { // 428
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xa8000000, 0x5c000000, 0x16000000, 0x4f000000,
+        0x59800000, 0x60400000, 0xd6600000, 0x17b00000, 0xc3f80000, 0xff940000, 0x41220000, 0xac530000,
+        0x9e0d8000, 0x230a4000, 0x17882000, 0x4b495000, 0x6dea8800, 0x72f2ac00, 0x15179a00, 0x9eeae900,
+        0x6d7fba80, 0xf253b9c0, 0xdd0d32e0, 0xa4851550, 0xf4c0a848, 0x7aa8fc0c, 0x091092de, 0x28e20583
+      },
+      { // 429
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0xf8000000, 0xdc000000, 0xae000000, 0xe5000000,
+        0x1c800000, 0xf4400000, 0x4a600000, 0xb7b00000, 0x61f80000, 0xd89c0000, 0xeaa60000, 0x1d930000,
+        0x66208000, 0xb1db4000, 0x204aa000, 0x50607000, 0x78b0f800, 0x3a781c00, 0x83534a00, 0x71050900,
+        0xa681ea80, 0xeb497940, 0xe9ef1220, 0x307e6590, 0x545ad8d8, 0x86832c4c, 0x7b4912f6, 0xb1ed65e9
+      },
+      { // 430
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0xe8000000, 0xdc000000, 0xca000000, 0x55000000,
+        0x0b800000, 0x1bc00000, 0xd1a00000, 0xbcb00000, 0x22780000, 0xf0540000, 0x3b260000, 0x7af70000,
+        0x571d8000, 0x53ce4000, 0x5da1e000, 0xbebf3000, 0x3b76c800, 0xd9d31400, 0xa9eb7e00, 0x6ad99d00,
+        0xa56c9e80, 0xab91adc0, 0x0a87d6a0, 0x764cf950, 0x0d6d4848, 0x979a548c, 0x708f1e02, 0x5b4ced19
+      },
+      { // 431
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xc8000000, 0x34000000, 0xe6000000, 0xed000000,
+        0x18800000, 0xe5400000, 0x13200000, 0x7cf00000, 0xdab80000, 0xc8140000, 0xcf220000, 0x9ef30000,
+        0xe9bb8000, 0x5192c000, 0x28e3a000, 0x5790f000, 0x95eab800, 0xe71bcc00, 0xd4a14e00, 0xda3e5900,
+        0x7158ee80, 0xfe09a9c0, 0xb10bd6e0, 0x3a83a550, 0xb64ab828, 0x1aabcc64, 0x53394e4e, 0x27da5949
+      },
+      { // 432
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x08000000, 0x1c000000, 0x7e000000, 0xc7000000,
+        0x27800000, 0xe9c00000, 0xede00000, 0x8cd00000, 0x40180000, 0xf3740000, 0xd6ee0000, 0x055d0000,
+        0x76d98000, 0x9d1e4000, 0xd9f8a000, 0x0daf5000, 0x97f46800, 0x02a8d400, 0x0c739a00, 0x25605f00,
+        0x2e9d3a80, 0x92360fc0, 0xf946d220, 0x4ba99b70, 0x84fa6828, 0xe725d46c, 0xecb21ad6, 0x200a1f6b
+      },
+      { // 433
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x18000000, 0xbc000000, 0x7e000000, 0x89000000,
+        0x23800000, 0x76400000, 0xa0200000, 0xb5f00000, 0x30b80000, 0x68140000, 0x47260000, 0xe77b0000,
+        0xa97e8000, 0x887b4000, 0x7ffba000, 0x83b7b000, 0x709fc800, 0xade48c00, 0x3f99fe00, 0x2b6c0900,
+        0x2c5c5e80, 0x9804b9c0, 0x7c0316a0, 0x5e047590, 0xd901c8b8, 0x3b8b8c2c, 0xca417e46, 0xde2c4965
+      },
+      { // 434
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x48000000, 0x94000000, 0x4a000000, 0x93000000,
+        0xaa800000, 0x56400000, 0x1ae00000, 0xe9500000, 0x05980000, 0x61340000, 0xf68e0000, 0x48430000,
+        0x63eb8000, 0x80d8c000, 0xb1516000, 0xb990d000, 0x4f393800, 0x378dfc00, 0xadc9e200, 0x41289f00,
+        0x15730280, 0x7b608fc0, 0xa99b5a20, 0x673da390, 0x538b8068, 0xffc8c004, 0x0e2960a2, 0x61f4d057
+      },
+      { // 435
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xd8000000, 0x2c000000, 0xf2000000, 0x19000000,
+        0x8f800000, 0x66c00000, 0x61a00000, 0x1e100000, 0x6f580000, 0xe4340000, 0xd9820000, 0xb9c70000,
+        0x49268000, 0xcc524000, 0x26b86000, 0x5ec87000, 0x5dac4800, 0x54140400, 0x8a500e00, 0x41bad700,
+        0x8a4eee80, 0xa5e0e7c0, 0x28fac6e0, 0x4d2c9310, 0xba5e8038, 0x89b6403c, 0x1e42604a, 0xabeb70e5
+      },
+      { // 436
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x28000000, 0xac000000, 0xda000000, 0x49000000,
+        0x2f800000, 0x4e400000, 0x43e00000, 0x6e700000, 0xf7b80000, 0x2e140000, 0xcd820000, 0xb3450000,
+        0x526b8000, 0xef374000, 0x20dde000, 0xc4a7f000, 0xc211c800, 0xb7838c00, 0x6a43a200, 0xa5e87d00,
+        0x2575c280, 0x1538cdc0, 0x39d9eae0, 0x532cb130, 0xf85380c8, 0xaa63409c, 0x3b3fe092, 0xeed2f015
+      },
+      { // 437
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0xd8000000, 0x44000000, 0x0e000000, 0x79000000,
+        0x72800000, 0x18400000, 0x24a00000, 0x41f00000, 0xdd380000, 0x4cd40000, 0xdd020000, 0x8c890000,
+        0xd9488000, 0x222ac000, 0x8fb92000, 0xc49b3000, 0x71a45800, 0x617b3c00, 0x9679e600, 0x5dfd5100,
+        0x57304680, 0x5bd8a1c0, 0xe68f3ee0, 0x3e41adf0, 0xa1a20038, 0x497900b4, 0x6a7080b6, 0x27fec00d
+      },
+      { // 438
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0xc8000000, 0x0c000000, 0x56000000, 0x81000000,
+        0x87800000, 0x25400000, 0xe1e00000, 0xfb300000, 0x90f80000, 0x9fdc0000, 0x16420000, 0x8d630000,
+        0x36fb8000, 0x06dd4000, 0xb5c52000, 0x6227b000, 0xc8120800, 0xf76fbc00, 0xd1fc7200, 0xb8505900,
+        0x4300d280, 0x3489a940, 0x09cc7a60, 0xcc2ce5d0, 0xfd1f20a8, 0x72e8b0dc, 0xe7b3887e, 0x053dfc1d
+      },
+      { // 439
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0xa8000000, 0x64000000, 0x8a000000, 0x53000000,
+        0xed800000, 0xefc00000, 0x78a00000, 0xff500000, 0xea180000, 0x4af40000, 0x49c20000, 0xf5a50000,
+        0x03d38000, 0x2f5bc000, 0x12106000, 0x16f9d000, 0xffce4800, 0xe0aa9400, 0x53526e00, 0xf415e300,
+        0x3bf38e80, 0x9342f3c0, 0x7de626e0, 0xc7be7730, 0x45286048, 0xe89dd054, 0xceb44842, 0x03ab94c7
+      },
+      { // 440
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x58000000, 0x4c000000, 0x26000000, 0x57000000,
+        0x18800000, 0xd2400000, 0xd3e00000, 0x06900000, 0x5f580000, 0x24740000, 0xd64e0000, 0x11e50000,
+        0xc39c8000, 0x4ada4000, 0xc7b72000, 0xd46dd000, 0x28539800, 0xccfd5c00, 0xfc07d200, 0xbe055300,
+        0xbb027280, 0x0e87c3c0, 0xdd424a20, 0x87690ff0, 0xf2d72078, 0xdbbdd0bc, 0x3a6b98de, 0x5b595c2b
+      },
+      { // 441
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xe8000000, 0xdc000000, 0x9a000000, 0x5d000000,
+        0x78800000, 0xd1c00000, 0x37600000, 0x72500000, 0x9c180000, 0x9f340000, 0x53460000, 0xeba50000,
+        0x45b78000, 0xbb804000, 0x9a46e000, 0xa523b000, 0x9b70f800, 0xc569c400, 0x33582200, 0x5e9aef00,
+        0xa3f74280, 0xf4a81fc0, 0x9430daa0, 0x74c72b70, 0x0be96048, 0x2d97f0ac, 0x00701852, 0xbaef7431
+      },
+      { // 442
+        0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0xf8000000, 0xec000000, 0x62000000, 0xcd000000,
+        0x82800000, 0xa7400000, 0xf8200000, 0x83100000, 0xb1d80000, 0xed340000, 0x01c20000, 0xe9610000,
+        0x58328000, 0xaf424000, 0x4c2b6000, 0xdd123000, 0x56d1d800, 0xb6b50c00, 0xaa011e00, 0x190ae700,
+        0x6c82fe80, 0xb84f97c0, 0x4fa8c6e0, 0x4adbeb70, 0x8cb9e018, 0x5b00709c, 0xb182b8fa, 0x12c33c91
+      },
+      { // 443
+        0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xd8000000, 0x94000000, 0x8e000000, 0xa7000000,
+        0xf7800000, 0x6bc00000, 0x28200000, 0x94b00000, 0xdc980000, 0x78240000, 0x9cb20000, 0x80990000,
+        0x4a268000, 0xf9b6c000, 0xca18a000, 0xff641000, 0xead3c800, 0xeac16400, 0xf4a82e00, 0xf2f40100,
+        0x467be680, 0x4c3565c0, 0xdcd3c860, 0xe9c16430, 0xb5282e38, 0x5a340164, 0xcfdbe6d6, 0x804565f3
+      },
+      { // 444
+        0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0xa8000000, 0x84000000, 0x76000000, 0x35000000,
+        0xb0800000, 0x0cc00000, 0x6de00000, 0x61f00000, 0x24180000, 0x81ec0000, 0x33fa0000, 0x77190000,
+        0x5c698000, 0xa3b8c000, 0xe4362000, 0x137db000, 0x63d89800, 0xfd89e400, 0xc04da200, 0x2b2b5900,
+        0x93153a80, 0x9a62bd40, 0xdeb89860, 0x20b9e4b0, 0xc1b5a248, 0xbf375974, 0x5af73a5e, 0xdd97bdf1
+      },
+      { // 445
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0xe8000000, 0xac000000, 0x46000000, 0x6b000000,
+        0xbe800000, 0x0a400000, 0x99600000, 0xa9900000, 0xf8f80000, 0x6d640000, 0x6b9a0000, 0x19fd0000,
+        0xcee98000, 0x5c5e4000, 0x9853a000, 0xb25b5000, 0xff5b1800, 0x1ad4ec00, 0x46146200, 0x793b1700,
+        0x0fcf7a80, 0x35affbc0, 0x1ebb18e0, 0x1204ecf0, 0xf90c6288, 0x878f179c, 0xedcd7a2e, 0x44a6fb07
+      },
+      { // 446
+        0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x88000000, 0x04000000, 0x0e000000, 0xe5000000,
+        0x06800000, 0x4b400000, 0xef600000, 0x2e100000, 0xe5780000, 0xd56c0000, 0x0d1a0000, 0xe2fd0000,
+        0x26af8000, 0xc432c000, 0x210da000, 0xa8893000, 0xfe48f800, 0xd1ef7c00, 0xe95c7200, 0x001a6f00,
+        0x10748a80, 0x0be51340, 0x7a50f860, 0x8f937cf0, 0xe7be7268, 0xcccb6fb4, 0x5ca10a06, 0x073ad3a1
+      },
+      { // 447
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x48000000, 0x14000000, 0x1a000000, 0xd5000000,
+        0x91800000, 0x3dc00000, 0x68e00000, 0xd5f00000, 0x77180000, 0x0fe40000, 0x15760000, 0xd95d0000,
+        0x23cf8000, 0x7fe3c000, 0x9d75e000, 0x6d5f7000, 0xc9c58800, 0xe2ec2400, 0x18fca200, 0x4a9c1900,
+        0x74212a80, 0xa6943dc0, 0x522b8820, 0x2d952430, 0xb4a522e8, 0x08d2d9e4, 0x7e034ad2, 0x470c8d01
+      },
+      { // 448
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x88000000, 0x54000000, 0x6e000000, 0x5f000000,
+        0x12800000, 0xfdc00000, 0xf3200000, 0xf6500000, 0x7a780000, 0xcea40000, 0x511a0000, 0x40910000,
+        0x55d38000, 0x0a3fc000, 0xb2cea000, 0x59ae9000, 0xb7901800, 0x4352d400, 0x81fa3e00, 0x32e52f00,
+        0x0f702680, 0x5526fbc0, 0x5d5998e0, 0x96fc1430, 0x14671ee8, 0x6cb47fa4, 0x710e9e66, 0xed8abfcb
+      },
+      { // 449
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x68000000, 0x14000000, 0xca000000, 0xdb000000,
+        0x7d800000, 0x5e400000, 0xf9200000, 0xa6300000, 0xfc180000, 0xcba40000, 0x8ffa0000, 0xe07d0000,
+        0xd9318000, 0xe395c000, 0x3aece000, 0xf15e9000, 0xab00a800, 0xb5865c00, 0x1a4aa600, 0x6b217900,
+        0x01300e80, 0x5f9a25c0, 0x84eb28e0, 0xd05e9cf0, 0x658fc608, 0x824e2924, 0x77264622, 0xef3fe90f
+      },
+      { // 450
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x58000000, 0xfc000000, 0xfe000000, 0x6d000000,
+        0x34800000, 0x52400000, 0x91a00000, 0xf7900000, 0x57380000, 0x3a2c0000, 0x2a560000, 0x595b0000,
+        0x70d88000, 0x7e144000, 0x09ff2000, 0x35c3b000, 0xfa68d800, 0x30f0cc00, 0x2b464e00, 0xaf225b00,
+        0xb2d89680, 0x8d199740, 0x607e58a0, 0x1b038c50, 0x9d8fee78, 0x54c2abec, 0x18e1ee26, 0x9bb5abd1
+      },
+      { // 451
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0xc8000000, 0xc4000000, 0xce000000, 0xaf000000,
+        0xc7800000, 0xec400000, 0x06600000, 0x6db00000, 0xb8d80000, 0xf0e40000, 0xd1720000, 0x79750000,
+        0x4d7b8000, 0xab7ac000, 0xf079a000, 0x31f39000, 0xb6bf4800, 0xb9579c00, 0x97a17200, 0xee9d1500,
+        0x9f8c3a80, 0xf04f89c0, 0x146ec860, 0x30bc5cf0, 0x12515228, 0x7e2145f4, 0x9dd15286, 0x966145ab
+      },
+      { // 452
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x78000000, 0xf4000000, 0xaa000000, 0x0d000000,
+        0x28800000, 0x43400000, 0x45a00000, 0xe1d00000, 0x23780000, 0xb72c0000, 0x279e0000, 0x72530000,
+        0x23ba8000, 0x6a4ec000, 0x5f2ae000, 0xeb96f000, 0x8c539800, 0x94b8dc00, 0x37c35e00, 0xc0edbf00,
+        0x4776c680, 0x252a6340, 0x7e911820, 0xe0da1c50, 0x15f7bed8, 0xf3684fe4, 0x57bfde52, 0x804c7fb9
+      },
+      { // 453
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0xa8000000, 0x54000000, 0xda000000, 0xd1000000,
+        0x2c800000, 0x10c00000, 0x5a600000, 0x79100000, 0x98780000, 0x74e40000, 0xa4de0000, 0x70990000,
+        0x8e3d8000, 0x6749c000, 0xcf25e000, 0xf33b3000, 0xbdcb1800, 0x38eda400, 0x42d35a00, 0x0f9b4f00,
+        0x99be4280, 0x220bebc0, 0xfd0e98a0, 0x1a8064f0, 0xd7c8ba88, 0x81e97f64, 0x1a50daf2, 0xf55b8f45
+      },
+      { // 454
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x58000000, 0xcc000000, 0x3a000000, 0x61000000,
+        0x84800000, 0xf4c00000, 0xba600000, 0x61700000, 0x50180000, 0xdcec0000, 0x78b60000, 0x74f90000,
+        0x185a8000, 0x4e474000, 0xf1aa6000, 0xb0913000, 0xe62c1800, 0x45d9e400, 0xa2079a00, 0xcd074900,
+        0xae858280, 0xfdcbad40, 0xaaee98a0, 0x63b2a470, 0xb17bfa78, 0x581f79fc, 0x58eb1ae2, 0xe6b909ed
+      },
+      { // 455
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x98000000, 0x3c000000, 0x7a000000, 0x3d000000,
+        0xfd800000, 0x91400000, 0x66200000, 0x8ef00000, 0x4bd80000, 0xe3a40000, 0xf3ba0000, 0xafff0000,
+        0x7c5c8000, 0xa7e84000, 0xdc1f6000, 0x6e42f000, 0x2aab4800, 0x703d2c00, 0x35b1c600, 0x28f8a500,
+        0xdcd88e80, 0xdb2e89c0, 0xb377c8e0, 0xba956cd0, 0x958ea6f8, 0xe54a552c, 0xd82bc662, 0xe5f7a5c1
+      },
+      { // 456
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0xf8000000, 0x4c000000, 0x86000000, 0x93000000,
+        0x66800000, 0xa0c00000, 0x9aa00000, 0xab700000, 0xf7580000, 0xece40000, 0xa9120000, 0x6a850000,
+        0x06c08000, 0xd9a54000, 0x05ffa000, 0xe396d000, 0xbc4f9800, 0x17660400, 0x68579600, 0x2c61f500,
+        0x4ad88e80, 0x5ea2b1c0, 0xb970b860, 0x7e5594f0, 0x5767ae18, 0x4851217c, 0xfc6080fe, 0x82d5401f
+      },
+      { // 457
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x18000000, 0xac000000, 0x2a000000, 0x13000000,
+        0x48800000, 0xcdc00000, 0x76600000, 0x04300000, 0x56d80000, 0xd52c0000, 0x16960000, 0x47070000,
+        0x7e888000, 0x1cc94000, 0x49e56000, 0x1f721000, 0x78777800, 0xd6f6f400, 0xd2348a00, 0x37d0ad00,
+        0x02ab7280, 0x69df1940, 0xf7a298a0, 0xe851a490, 0xa9e89238, 0xaf7f497c, 0x907600b2, 0xb2f700ff
+      },
+      { // 458
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x98000000, 0xbc000000, 0xde000000, 0x0d000000,
+        0xa5800000, 0x8b400000, 0x97e00000, 0xb2b00000, 0x1ed80000, 0x0a240000, 0xd6920000, 0x6d470000,
+        0x16e48000, 0xa13c4000, 0xac9f2000, 0xc240b000, 0x80634800, 0x92f00c00, 0x8db19a00, 0xd05e4d00,
+        0x65ee5280, 0x39b601c0, 0xea52e860, 0xeaeffcd0, 0x5f3b7278, 0x5195b1ac, 0xefc720c6, 0x2f24b071
+      },
+      { // 459
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x28000000, 0x44000000, 0x86000000, 0x7b000000,
+        0x40800000, 0x16c00000, 0xeee00000, 0x14500000, 0x94380000, 0x69a40000, 0xf5fe0000, 0x55c10000,
+        0xb2658000, 0xc894c000, 0x73df2000, 0xe8795000, 0x0881f800, 0x02c80400, 0xd0e3b200, 0xb3566300,
+        0x3ebfca80, 0xc66ea7c0, 0xa69d58a0, 0x6cd09470, 0x9efeea08, 0x4d46f7f4, 0xe8a1202e, 0x547850ff
+      },
+      { // 460
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x18000000, 0x24000000, 0x2e000000, 0x49000000,
+        0x3b800000, 0x65400000, 0x99200000, 0xa2900000, 0x26380000, 0xb4e40000, 0x8a720000, 0xd6430000,
+        0xada88000, 0x395dc000, 0xa3dda000, 0xb113f000, 0xef7f6800, 0xdfc80c00, 0x3bedd600, 0xb4f8c300,
+        0x2a823e80, 0x5ac90fc0, 0x62604860, 0x3ab13c90, 0x832d9ef8, 0xfd99ff74, 0xc0b7a0b6, 0x8c24f0ad
+      },
+      { // 461
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x18000000, 0xd4000000, 0x72000000, 0x23000000,
+        0xfb800000, 0x1d400000, 0xf5a00000, 0x47d00000, 0x17f80000, 0xf8640000, 0xc8ba0000, 0x96c10000,
+        0x30e28000, 0x067ac000, 0xd22d6000, 0xd4989000, 0x1f5ec800, 0x31324c00, 0x708f3e00, 0x8accdf00,
+        0xdeeb7680, 0x0b7053c0, 0x44ab28e0, 0xaf511c30, 0x893e1678, 0x348cc324, 0x10cfe0ea, 0x31e25037
+      },
+      { // 462
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x48000000, 0xb4000000, 0x96000000, 0x8d000000,
+        0x7c800000, 0xc8400000, 0xec200000, 0xcbb00000, 0xb6180000, 0x79640000, 0x43120000, 0xd9e10000,
+        0x395f8000, 0x16c9c000, 0xff692000, 0x361b3000, 0xb96b5800, 0xa31aac00, 0xa9e7d600, 0x7157d100,
+        0xa2c10e80, 0x6965bdc0, 0xbb107860, 0xc5e09cb0, 0x6b530ea8, 0x45c4bdc4, 0xbaeff85e, 0x14d95cf9
+      },
+      { // 463
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x68000000, 0x2c000000, 0x8e000000, 0x51000000,
+        0x00800000, 0x7f400000, 0xbbe00000, 0x96300000, 0x0c580000, 0x4da40000, 0xc95a0000, 0xd7210000,
+        0xbd158000, 0x074a4000, 0xcfe92000, 0x3c3d7000, 0x0f50d800, 0xfa2d9c00, 0xcb919a00, 0x9d0b3500,
+        0xbe8ec280, 0x264de9c0, 0x6763f8e0, 0x0f71ec30, 0xcab4c208, 0x551ce9dc, 0xeb4e7866, 0x21efacbd
+      },
+      { // 464
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x68000000, 0xcc000000, 0xca000000, 0x13000000,
+        0x90800000, 0x56c00000, 0x93200000, 0xf6b00000, 0x7b580000, 0x82c40000, 0x0d260000, 0xbbb30000,
+        0x06d78000, 0x398e4000, 0x4d466000, 0xc16e9000, 0xcd57b800, 0x63ce2400, 0x8aa03e00, 0xebf1c900,
+        0x7231e680, 0x13917dc0, 0xcce66020, 0xee1e9050, 0xb7afb8c8, 0x0e7a245c, 0x5d7e3ea2, 0xadf6c9df
+      },
+      { // 465
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x18000000, 0x64000000, 0xf6000000, 0xab000000,
+        0xe7800000, 0xdf400000, 0x09200000, 0x7db00000, 0x23d80000, 0xeb440000, 0xc7220000, 0x42bf0000,
+        0x3a588000, 0xe303c000, 0xbb8b2000, 0xbd4ad000, 0x5c244800, 0x4d344c00, 0x891c4600, 0x60269900,
+        0xff332e80, 0x241805c0, 0x24ab2060, 0xbbfad0d0, 0x607c48f8, 0x0d304c74, 0xa91e46ee, 0x902999cf
+      },
+      { // 466
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0xe8000000, 0x2c000000, 0x52000000, 0xff000000,
+        0x51800000, 0x4bc00000, 0xdce00000, 0x0af00000, 0xe1d80000, 0x5dc40000, 0x9dea0000, 0x96710000,
+        0x74918000, 0x73684000, 0x2c3de000, 0xf3b3d000, 0x3d776800, 0x031fe400, 0x31ab9200, 0x50543100,
+        0xa6011a80, 0xc90805c0, 0xc085e0e0, 0x2f47d0b0, 0xfda56888, 0xb25ae45c, 0xd10812ba, 0xc48971d3
+      },
+      { // 467
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x38000000, 0x64000000, 0xd6000000, 0x6f000000,
+        0xdd800000, 0x38c00000, 0x25e00000, 0xd3d00000, 0x38f80000, 0xf1cc0000, 0x5f6e0000, 0xda9b0000,
+        0xbfda8000, 0xe2f9c000, 0xb4cd2000, 0x4fe49000, 0xbed3a800, 0x74729400, 0x27857200, 0x2dccb300,
+        0xad63fa80, 0xc396b740, 0x1d5b2020, 0x3fb39050, 0xcde72898, 0x6fd05474, 0x3af2d2ee, 0x60c1e30b
+      },
+      { // 468
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x28000000, 0xbc000000, 0xca000000, 0x6b000000,
+        0x1f800000, 0xc3c00000, 0x16200000, 0xf4b00000, 0x43580000, 0x36cc0000, 0x34a20000, 0x79ff0000,
+        0x5a338000, 0x9c154000, 0x20ad6000, 0x4ff11000, 0x9b32c800, 0x78918400, 0xd4e2be00, 0x2614f900,
+        0xb3a51680, 0xa4786d40, 0xbef760e0, 0xe7b210d0, 0xe8db4848, 0x7307c42c, 0x3b865ee2, 0x6dc3a9d7
+      },
+      { // 469
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x48000000, 0xbc000000, 0xd6000000, 0xe9000000,
+        0x3d800000, 0x8ac00000, 0xed200000, 0x52300000, 0xbfd80000, 0xefcc0000, 0x0ea60000, 0xadf90000,
+        0x09778000, 0x96334000, 0xddd8a000, 0x4cc6f000, 0xbc24c800, 0xbbbd3400, 0xef175e00, 0x75eb4100,
+        0x34133680, 0x736c8540, 0x685ea0a0, 0x1a0ff0f0, 0x170b4868, 0xf882740c, 0x9949fe9e, 0x7ae4b155
+      },
+      { // 470
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xb8000000, 0x04000000, 0xfa000000, 0x71000000,
+        0xb4800000, 0xd8c00000, 0xaf200000, 0x98f00000, 0x69180000, 0xb1cc0000, 0xafa60000, 0x223d0000,
+        0x433c8000, 0xdfb7c000, 0x6b71e000, 0x7259b000, 0xdda6d800, 0x8f340400, 0xd9b61e00, 0xc4730d00,
+        0xbdd92680, 0x78e2b940, 0x4857e0a0, 0xcca4b0b0, 0xebba5898, 0x4973c4f4, 0xd75ffe42, 0xdb26bd75
+      },
+      { // 471
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x68000000, 0xac000000, 0x36000000, 0x85000000,
+        0x82800000, 0x18c00000, 0x28200000, 0x08d00000, 0x4d380000, 0xf74c0000, 0x5e660000, 0x2e330000,
+        0xf8cf8000, 0x58284000, 0x50dba000, 0x99323000, 0x054af800, 0x41656400, 0x1fb36e00, 0xe785df00,
+        0xea443680, 0x68e18b40, 0xf4f220a0, 0xb7e97050, 0xa57ed848, 0x98af14bc, 0x6f1a365e, 0x649e8b29
+      },
+      { // 472
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0xa8000000, 0x74000000, 0x5e000000, 0x59000000,
+        0x18800000, 0xafc00000, 0x73200000, 0x16700000, 0x79980000, 0xe34c0000, 0x12ee0000, 0x34570000,
+        0xd36f8000, 0xc319c000, 0xaf80a000, 0x76497000, 0x68649800, 0x98913400, 0xc7caae00, 0xe7208500,
+        0x38789680, 0x5893c140, 0x27cf2020, 0x9720b090, 0x407c3808, 0x849444a4, 0x0dc036f6, 0x9026b12d
+      },
+      { // 473
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0xb8000000, 0x44000000, 0xee000000, 0x09000000,
+        0xd6800000, 0x1bc00000, 0x1b200000, 0xe1900000, 0x0ff80000, 0x6a840000, 0x91c20000, 0x8c270000,
+        0x16128000, 0x3eb7c000, 0xc06ea000, 0x8c7c7000, 0xbdc2f800, 0xbe225400, 0xc511ce00, 0x27340b00,
+        0xf82f1680, 0xf01defc0, 0xbbb28060, 0x94e7c050, 0x8cb6a058, 0xd36870d4, 0x75f8f856, 0x1581544d
+      },
+      { // 474
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0xa8000000, 0x7c000000, 0x52000000, 0xe7000000,
+        0x44800000, 0xc7400000, 0xde600000, 0xf5d00000, 0x90780000, 0x88840000, 0x2d420000, 0x0d630000,
+        0x4f578000, 0x4a354000, 0x8966e000, 0x09595000, 0x63313800, 0xa8ebbc00, 0xc59ed200, 0x429b5b00,
+        0x161e8a80, 0x995cf7c0, 0xeb378060, 0xe4e54010, 0xef9ee048, 0x719d50ac, 0x7c9338fa, 0xeb18bc9b
+      },
+      { // 475
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xf8000000, 0x3c000000, 0x26000000, 0x5f000000,
+        0xb1800000, 0xda400000, 0x28e00000, 0x2d900000, 0xf2b80000, 0x9b8c0000, 0x1b420000, 0x9a6d0000,
+        0xd0548000, 0xa7144000, 0x137da000, 0x382d9000, 0x84b7e800, 0xcc8c3c00, 0x0ecc6a00, 0xea287700,
+        0x79b2a280, 0x580d9b40, 0xac0c80e0, 0x0e0840f0, 0x2b07a098, 0x538c908c, 0x9f4168de, 0xe0657c63
+      },
+      { // 476
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x58000000, 0xec000000, 0xfe000000, 0x45000000,
+        0x57800000, 0x87400000, 0xec200000, 0x80300000, 0x76d80000, 0x8a8c0000, 0x1cc20000, 0x85610000,
+        0x01128000, 0x15634000, 0x69152000, 0xc165b000, 0x0b122800, 0x22668c00, 0xf59b7600, 0x0ca2a100,
+        0xdbf6fe80, 0x373edd40, 0xaa5080e0, 0x27424030, 0xbc27a038, 0xc836f09c, 0xb2df08a6, 0xc08f3ca9
+      },
+      { // 477
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x38000000, 0x6c000000, 0x42000000, 0x21000000,
+        0xfd800000, 0xe5c00000, 0x29a00000, 0x6db00000, 0xf5580000, 0x3d040000, 0x678e0000, 0xb8c10000,
+        0x9e208000, 0xfd754000, 0x0f7ae000, 0xd6723000, 0x67fbc800, 0xf0348400, 0xc09a4600, 0x3ca40100,
+        0x6e35ee80, 0x5b96f5c0, 0xac2e00a0, 0x047100f0, 0x8ef88018, 0x79b1405c, 0x3b54e07a, 0x4e03304d
+      },
+      { // 478
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x38000000, 0xfc000000, 0x3e000000, 0x01000000,
+        0x1d800000, 0x80400000, 0x4ce00000, 0x86500000, 0xa2780000, 0xef040000, 0x948e0000, 0x79c50000,
+        0x7ea48000, 0xcdbc4000, 0xc4a42000, 0xeebff000, 0xb62bc800, 0x3a72dc00, 0xa3054a00, 0xb2886b00,
+        0xf4c02280, 0x652c07c0, 0xb0f600a0, 0xabc100b0, 0xe9aa8018, 0x4539408c, 0xd360a006, 0xd913b0fd
+      },
+      { // 479
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x18000000, 0x2c000000, 0xda000000, 0xfd000000,
+        0x8a800000, 0x55c00000, 0xd0200000, 0x83b00000, 0xd5d80000, 0xc70c0000, 0x27860000, 0xd7410000,
+        0x81e28000, 0xbd934000, 0x5d676000, 0xbf567000, 0xc2cd7800, 0xffaaf400, 0x50fbde00, 0xba3cf900,
+        0x71954680, 0xd7623d40, 0x4a5e00a0, 0x4c4d0070, 0x44648038, 0x8bd2401c, 0x9405e0c2, 0x860530d1
+      },
+      { // 480
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0xb8000000, 0xa4000000, 0x0e000000, 0xdb000000,
+        0xc3800000, 0x4fc00000, 0xe4200000, 0x6cd00000, 0x81b80000, 0xa60c0000, 0x270e0000, 0x19870000,
+        0xf2c68000, 0xe0a1c000, 0x4a9aa000, 0xff555000, 0x367d8800, 0x462ec400, 0x95d9be00, 0xfb3c0f00,
+        0x334e1680, 0x866d5b40, 0x6c380020, 0xa2cc0090, 0x18ae0018, 0x4e970074, 0x215e80b6, 0x557dc07f
+      },
+      { // 481
+        0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0x08000000, 0xcc000000, 0xb6000000, 0xfd000000,
+        0x0c800000, 0x81400000, 0xcce00000, 0x41b00000, 0x48780000, 0xb8040000, 0x24020000, 0xaa050000,
+        0x33038000, 0x35804000, 0xf7c66000, 0x06a5b000, 0x7cd7e800, 0x84086400, 0xbdd80a00, 0x11506700,
+        0x87cd0d80, 0x6978c3c0, 0x9a800020, 0x4c400010, 0x68600028, 0x7cf0001c, 0x3a980002, 0xc8b40033
+      },
+      { // 482
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0xb8000000, 0x74000000, 0xb6000000, 0xf7000000,
+        0x5c800000, 0x21c00000, 0x1da00000, 0xe6100000, 0x14680000, 0xd4040000, 0x06060000, 0x3f070000,
+        0x00848000, 0x5bc5c000, 0x28a3a000, 0xfb95b000, 0x9e2fb800, 0xb4e6e400, 0xdc770e00, 0xd0dfed00,
+        0x26ffb080, 0x9daf6340, 0xc5a00020, 0xc2100030, 0xfa680038, 0xc7040024, 0x5486002e, 0x9dc7001d
+      },
+      { // 483
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x28000000, 0x1c000000, 0x4e000000, 0x81000000,
+        0xbe800000, 0xd9c00000, 0x96a00000, 0x1d700000, 0x2b180000, 0xd4040000, 0xe2060000, 0x87030000,
+        0x53838000, 0x01414000, 0xd260e000, 0x7b527000, 0x6eac0800, 0xd739f400, 0xf2b4ce00, 0xd8b9b500,
+        0x1df46b80, 0x9bdd98c0, 0x80200020, 0x18b00030, 0x93b80018, 0x3874001c, 0x5f9e000a, 0x96c70007
+      },
+      { // 484
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x48000000, 0x6c000000, 0xfa000000, 0x0b000000,
+        0x62800000, 0xe5400000, 0x2d200000, 0x41f00000, 0x34580000, 0x72040000, 0x07020000, 0xc8810000,
+        0xd6438000, 0x6ba24000, 0x32b36000, 0xe87fd000, 0x5a745800, 0xb4991400, 0x72e22a00, 0xbd90e900,
+        0xd6894f80, 0xa2ad42c0, 0xf6d80020, 0xa7440010, 0x42220008, 0x9571001c, 0x501b8012, 0x7ea6401b
+      },
+      { // 485
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x88000000, 0xfc000000, 0xd2000000, 0xfb000000,
+        0x13800000, 0x47400000, 0x10200000, 0x34d00000, 0x3cf80000, 0x8e040000, 0x59020000, 0x40810000,
+        0x98c18000, 0x0d644000, 0x23f7e000, 0xc9ae9000, 0x0ebbd800, 0xd4a69c00, 0x6a113a00, 0xf4980100,
+        0x2f706680, 0x4b6847c0, 0x24d80020, 0x06d40010, 0x97fa0008, 0x0585000c, 0x5a438022, 0xf6a5403f
+      },
+      { // 486
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0xa8000000, 0x7c000000, 0x5e000000, 0xdd000000,
+        0x02800000, 0xa5c00000, 0xcee00000, 0x10100000, 0xdd180000, 0x32040000, 0xbb060000, 0x5b830000,
+        0x1d418000, 0x3c254000, 0x2373e000, 0xe94af000, 0x5bbae800, 0xf0b21400, 0x46a82e00, 0x7728f700,
+        0x656e4080, 0x10c948c0, 0x05f80020, 0x73140030, 0xf29e0018, 0x5d47000c, 0x9c27802a, 0x7376401f
+      },
+      { // 487
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x08000000, 0xac000000, 0xfa000000, 0x99000000,
+        0xd6800000, 0x4b400000, 0x7ae00000, 0x61700000, 0x41380000, 0x49040000, 0x7e860000, 0x17430000,
+        0x18e48000, 0x5c704000, 0xc1bd6000, 0x6143d000, 0x4be2c800, 0xebf5b400, 0x687eda00, 0x0ee79700,
+        0x9f706b80, 0x7e3ed9c0, 0x64860020, 0xde430030, 0xa6648018, 0x2b304024, 0x495d6002, 0x3533d02b
+      },
+      { // 488
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x88000000, 0x0c000000, 0xf6000000, 0x23000000,
+        0x3b800000, 0x03c00000, 0x88200000, 0x42500000, 0xdf580000, 0xd3040000, 0xe3860000, 0x67c70000,
+        0xe2248000, 0x1f544000, 0xcbd86000, 0x1d43b000, 0x4b671800, 0x9636dc00, 0x7cec9e00, 0x9b2c0100,
+        0xb9087280, 0x465c4ac0, 0x1d860020, 0x88c70030, 0xcfa48038, 0xaf944024, 0xf0786022, 0x50d3b003
+      },
+      { // 489
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0xe8000000, 0x74000000, 0xb6000000, 0x67000000,
+        0x7b800000, 0xbec00000, 0x92600000, 0xaf300000, 0x2c980000, 0xdf040000, 0x37860000, 0x84c30000,
+        0xaf638000, 0x99b74000, 0x4cdba000, 0x5921b000, 0xa8953800, 0x5048dc00, 0xdf6a7600, 0x60f9d300,
+        0xa337d980, 0xb69a54c0, 0xf2060020, 0x99030030, 0x78838018, 0xeb47401c, 0xd7a3a03a, 0x84d5b01d
+      },
+      { // 490
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x38000000, 0x9c000000, 0x12000000, 0xef000000,
+        0x58800000, 0x16400000, 0x32200000, 0x8ab00000, 0x1be80000, 0x93040000, 0x5a820000, 0xa1430000,
+        0xa6a28000, 0xb6f1c000, 0x5acce000, 0x53349000, 0xb82d7800, 0x58e5c400, 0x60d03200, 0x3e7b5100,
+        0xe5de3580, 0xa4af8f40, 0xd0a20020, 0xf7f30010, 0xcf4a8018, 0x9af5c014, 0x60cee00e, 0x78379027
+      },
+      { // 491
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x28000000, 0x0c000000, 0xce000000, 0x07000000,
+        0xa4800000, 0x50c00000, 0x54a00000, 0x52300000, 0x05580000, 0xdb040000, 0x12820000, 0x63c50000,
+        0xaa258000, 0xeff14000, 0x30786000, 0xb4727000, 0xb03a3800, 0x4a142400, 0xebad0600, 0x54fae500,
+        0x04b17180, 0xf4981ac0, 0x80220020, 0xcaf50010, 0x4dfd8028, 0xdf35402c, 0x34da600a, 0xde477003
+      },
+      { // 492
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x88000000, 0xec000000, 0x5a000000, 0x1b000000,
+        0xe8800000, 0xbd400000, 0x50600000, 0x55900000, 0x3f180000, 0xef040000, 0x36860000, 0xe0410000,
+        0xa1e68000, 0x7f544000, 0x8cbf6000, 0x16b6d000, 0xffeed800, 0x300a4400, 0xaa596a00, 0x4365c300,
+        0x91144c80, 0xf858e8c0, 0x74660020, 0x03910030, 0x8e1e8008, 0x44804034, 0x07416022, 0xbb63d03b
+      },
+      { // 493
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x68000000, 0xec000000, 0x2e000000, 0xeb000000,
+        0xd2800000, 0x4f400000, 0x5da00000, 0xc8b00000, 0xe2180000, 0x5f040000, 0xe8820000, 0x6e430000,
+        0x76268000, 0xf8734000, 0x257f6000, 0x79d57000, 0x3bcd5800, 0x94c99400, 0xa44afa00, 0x9e0cad00,
+        0x422aa580, 0x935ea0c0, 0xa1a20020, 0xaeb30010, 0x551e8018, 0x1b874034, 0xc8c5601a, 0x2362703b
+      },
+      { // 494
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0xc8000000, 0x04000000, 0xea000000, 0xb5000000,
+        0x87800000, 0xc9c00000, 0x25e00000, 0xfbb00000, 0xb2080000, 0x1f040000, 0x12860000, 0xde470000,
+        0x54238000, 0x12564000, 0xa7b82000, 0xf20b5000, 0x3f07a800, 0x82853c00, 0x6642ce00, 0x9824ef00,
+        0xfc51bd80, 0xf8bae040, 0xc08e0020, 0x71430030, 0x6ea58038, 0xb811401c, 0xd19ba032, 0x515d1001
+      },
+      { // 495
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x88000000, 0xd4000000, 0x12000000, 0x05000000,
+        0xe9800000, 0x4d400000, 0xafe00000, 0x06900000, 0x70f80000, 0xe7040000, 0xa4860000, 0x10c30000,
+        0x80a38000, 0x24744000, 0x4beea000, 0xc8bc9000, 0xe9622800, 0x5b524c00, 0xaddaea00, 0xec36bf00,
+        0xcd8cd480, 0xe36ab7c0, 0x467e0020, 0x32c70030, 0xada58018, 0x09f7401c, 0xecad2022, 0x3e58d035
+      },
+      { // 496
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x48000000, 0xfc000000, 0xfa000000, 0xcf000000,
+        0x4b800000, 0xfd400000, 0xea200000, 0x00b00000, 0x3d480000, 0x49040000, 0x3e820000, 0x19c30000,
+        0xace78000, 0x5fd24000, 0x2bdfe000, 0x8efbd000, 0x85c87800, 0x25c75c00, 0x76e16a00, 0x00d19100,
+        0xd85a2580, 0xc7bf9a40, 0x69ea0020, 0x10770010, 0xcf2d8018, 0xff15403c, 0xf1ba6012, 0x34ea903f
+      },
+      { // 497
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x98000000, 0x5c000000, 0x92000000, 0x35000000,
+        0x16800000, 0x56400000, 0xc5600000, 0x43500000, 0xeae80000, 0x23040000, 0xcd860000, 0x97c70000,
+        0xb8a48000, 0x02f4c000, 0xf49ae000, 0xe8d89000, 0x64bba800, 0xd36db400, 0x52c33200, 0x66276b00,
+        0x70b7ba80, 0x6ff96740, 0x948e0020, 0xf1d30030, 0x22aa8038, 0x3967c024, 0x61506026, 0x37ef5017
+      },
+      { // 498
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x48000000, 0xfc000000, 0x16000000, 0x95000000,
+        0xd6800000, 0x7cc00000, 0xba600000, 0xb2900000, 0xd6080000, 0x66840000, 0xa4c60000, 0x6e630000,
+        0x08928000, 0x1d0a4000, 0xd903e000, 0x1886b000, 0x3dc7a800, 0xd6e43400, 0x0551a600, 0xd3ea3300,
+        0x68512480, 0x216c1840, 0xd6928020, 0xb40a4030, 0x7983e018, 0xa146b014, 0x1927a812, 0xe4b4343f
+      },
+      { // 499
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x28000000, 0xbc000000, 0x4a000000, 0x9b000000,
+        0x44800000, 0x45c00000, 0xae200000, 0x15100000, 0x5a680000, 0x4c840000, 0xe9c20000, 0x6c250000,
+        0x62128000, 0x7ce94000, 0x2e41e000, 0x49605000, 0xa7f1d800, 0xd2d8a400, 0x60bf6e00, 0x33ce9100,
+        0x7cd1f880, 0x764b8b40, 0x8e928020, 0xc5294010, 0x6a61e028, 0x97705014, 0x9119d80a, 0x679ca42f
+      },
+      { // 500
+        0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x38000000, 0xcc000000, 0x7a000000, 0xe1000000,
+        0xeb800000, 0xb1c00000, 0x9be00000, 0xde100000, 0x3ad80000, 0x97840000, 0xb3c20000, 0x56e70000,
+        0x7f918000, 0x5219c000, 0x2be26000, 0xa611d000, 0x16d80800, 0xdd82dc00, 0x6ac64e00, 0x7165bf00,
+        0xb454a080, 0x28ff1ec0, 0x1e718020, 0x2d09c010, 0x1aba6038, 0xb055d00c, 0x06fa080e, 0x9975dc33
+      },
+      { // 501
+        0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0xa8000000, 0x5c000000, 0x9e000000, 0xa5000000,
+        0x05800000, 0xe4c00000, 0x62a00000, 0xdaf00000, 0x59780000, 0x09840000, 0x02c20000, 0xa3a50000,
+        0x85718000, 0x72bd4000, 0x09a6e000, 0x0276f000, 0xdc382800, 0xd5e5ac00, 0x75906600, 0x42acf500,
+        0x0fcfa780, 0x5f1ca3c0, 0xf1d18020, 0x214d4010, 0xc35ee028, 0x2632f00c, 0x8fda282a, 0xb170ac17
+      },
+      { // 502
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x98000000, 0xf4000000, 0x2a000000, 0x89000000,
+        0x08800000, 0x66c00000, 0x5f600000, 0xf4d00000, 0x43e80000, 0xf4840000, 0x00c60000, 0x38670000,
+        0x17568000, 0xc8acc000, 0x1ba3a000, 0x6eb75000, 0x51bb4800, 0x3aaac400, 0x46a5f600, 0x7c345b00,
+        0xf67f7680, 0x01481740, 0x0ab68020, 0xc3bcc030, 0x77aba038, 0x2c235034, 0xfff54826, 0x7f99c43d
+      },
+      { // 503
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x68000000, 0x9c000000, 0x0a000000, 0x9b000000,
+        0xcc800000, 0x46400000, 0x06200000, 0xa6900000, 0x8df80000, 0x86840000, 0xfd460000, 0x1aa70000,
+        0xb8d18000, 0x7fdb4000, 0xb610e000, 0xe1be5000, 0xcba7d800, 0xcf51e400, 0x251e7200, 0xae715100,
+        0xb5082480, 0x76cf57c0, 0x55298020, 0x095f4030, 0xc356e038, 0x5719500c, 0x1176581a, 0xb78aa427
+      },
+      { // 504
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x48000000, 0xbc000000, 0x5e000000, 0xc9000000,
+        0xad800000, 0x30400000, 0x00a00000, 0xeef00000, 0x02480000, 0x6f840000, 0x97460000, 0xdc230000,
+        0x17348000, 0x98aa4000, 0xaad1e000, 0x417cf000, 0xe5294800, 0x7293ec00, 0x0ddec200, 0x8dde6500,
+        0x4dd94780, 0x2dd8fa40, 0xbddc8020, 0xf5de4030, 0x49dfe018, 0x17dbf024, 0xdedbc812, 0x735aac2f
+      },
+      { // 505
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x38000000, 0x54000000, 0xea000000, 0x61000000,
+        0x63800000, 0xb8c00000, 0xc8e00000, 0xd4b00000, 0x0be80000, 0x2d840000, 0x2bc20000, 0xce630000,
+        0xedf18000, 0x76c9c000, 0xec56a000, 0xc75d5000, 0x226c0800, 0xe4449c00, 0xe8a50600, 0xfe166700,
+        0xa8f9b580, 0x50fc3740, 0x24f98020, 0x9efdc010, 0xf7fca018, 0xf87a500c, 0xfebf880e, 0xbd5e5c15
+      },
+      { // 506
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x18000000, 0x9c000000, 0x86000000, 0xf5000000,
+        0xe7800000, 0x5b400000, 0xec600000, 0xe7f00000, 0x79a80000, 0x75840000, 0xec420000, 0x44e50000,
+        0x38308000, 0xc408c000, 0x5ed0e000, 0x433e3000, 0xb65ea800, 0xd829bc00, 0x3bc11a00, 0x57a40300,
+        0xf0564f80, 0x29f8c540, 0x4c788020, 0xb83cc010, 0x60dae028, 0xdeef3004, 0xefe42806, 0x56b07c27
+      },
+      { // 507
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x48000000, 0x3c000000, 0x6a000000, 0xcb000000,
+        0x58800000, 0x4ec00000, 0x5be00000, 0x82500000, 0xbce80000, 0xa3840000, 0x9e460000, 0x09210000,
+        0x03b58000, 0xbdba4000, 0x7bede000, 0x19015000, 0x07815800, 0xd0464400, 0x4c25b600, 0x3e317f00,
+        0x7efea280, 0xab4cef40, 0x77f38020, 0xbf9b4030, 0x00d86008, 0x5a7b102c, 0x6f8cb812, 0x7717140f
+      },
+      { // 508
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x18000000, 0x0c000000, 0xaa000000, 0x2f000000,
+        0x05800000, 0x5dc00000, 0xc2a00000, 0x44f00000, 0x33580000, 0x12840000, 0xe4460000, 0x5d630000,
+        0xad508000, 0xcc28c000, 0xf51c6000, 0xb4e75000, 0x8a947800, 0x598bac00, 0xa86eae00, 0x687cb500,
+        0x79b61780, 0x56b832c0, 0xb4968020, 0x108bc030, 0x48ece018, 0x0f3f9004, 0xfb501806, 0x8128fc03
+      },
+      { // 509
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x78000000, 0x24000000, 0x42000000, 0x27000000,
+        0x19800000, 0xca400000, 0xeea00000, 0x66900000, 0xefa80000, 0x56840000, 0x7fc60000, 0x9ae50000,
+        0xf9318000, 0x8dbbc000, 0x69ed2000, 0x56201000, 0x80523800, 0x1dcc4c00, 0x61701200, 0xcc1b9500,
+        0xeaf90480, 0x25cfd540, 0x25778020, 0x1e1ec030, 0x85fca028, 0x604bd00c, 0x8937181e, 0x95b85c09
+      },
+      { // 510
+        0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0xf8000000, 0xe4000000, 0xa2000000, 0x23000000,
+        0xb4800000, 0x75400000, 0xdca00000, 0x2bd00000, 0x20180000, 0x1b840000, 0x6fc60000, 0xe4e30000,
+        0x6ef58000, 0x570fc000, 0x43fb2000, 0xc3f71000, 0xbe8c1800, 0x873f2400, 0xef93ea00, 0x533b0500,
+        0x7591ee80, 0xf43948c0, 0xd3138020, 0x5a7cc030, 0x5f36a018, 0xa6ecd02c, 0x8089383e, 0x223f3439
+      },
+      { // 511
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0xe8000000, 0xf4000000, 0xf2000000, 0x69000000,
+        0x2f800000, 0x79c00000, 0xde200000, 0xfff00000, 0x30680000, 0x34840000, 0xff460000, 0xa8610000,
+        0xa8178000, 0xf9bf4000, 0x0f1ba000, 0x09ad9000, 0x0aa04800, 0xd0b1fc00, 0x800a0e00, 0x80959100,
+        0x00fe8f80, 0x3c7ffb40, 0xe7398020, 0xa55a4030, 0x784a2008, 0xa873d03c, 0x45ac683a, 0xd4a32c3d
+      },
+      { // 512
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xe8000000, 0x9c000000, 0x5e000000, 0xef000000,
+        0xf8800000, 0x9b400000, 0x8ce00000, 0xb4300000, 0x7c780000, 0xe9840000, 0x1cc20000, 0xd7230000,
+        0x67958000, 0x6eaf4000, 0x0cc8e000, 0xc0bcf000, 0xaea27800, 0x43534400, 0x7d8d1a00, 0x415e4700,
+        0x8312f180, 0xebeb8bc0, 0x0f2f8020, 0x3c084010, 0xa19f6018, 0xba30b02c, 0x8b7f183a, 0x0500f427
+      },
+      { // 513
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0xc8000000, 0x94000000, 0x7a000000, 0x31000000,
+        0x51800000, 0xd6400000, 0x65a00000, 0x59b00000, 0x3e080000, 0x8a840000, 0x8ec20000, 0x1e650000,
+        0xb4558000, 0x811e4000, 0x19b8a000, 0xc78dd000, 0x98c28800, 0x49600c00, 0x9ad07200, 0xfddc4d00,
+        0x02dffd80, 0xe8590840, 0x369f8020, 0xf0ff4010, 0xa8af2028, 0x0fb6902c, 0xc90fa832, 0x14039c25
+      },
+      { // 514
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x68000000, 0x54000000, 0x66000000, 0x0f000000,
+        0xaf800000, 0xf3c00000, 0x56e00000, 0x28d00000, 0xcde80000, 0xfe840000, 0xbf420000, 0xc0a10000,
+        0x68f58000, 0x495b4000, 0x7afea000, 0xef8d3000, 0xac177800, 0xf88bfc00, 0x5f945e00, 0xa94cd700,
+        0xb8769680, 0x1d180740, 0x1bdf8020, 0x2fbe4010, 0x7a292008, 0x5667702c, 0x8494581a, 0x20c98c15
+      },
+      { // 515
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x48000000, 0xcc000000, 0xfe000000, 0xfd000000,
+        0x3f800000, 0x86400000, 0x0c200000, 0x93b00000, 0xea480000, 0xb0840000, 0x5ac60000, 0xf8e10000,
+        0xfe548000, 0x779a4000, 0xf75a6000, 0x90bdf000, 0x3a6ce800, 0x55367c00, 0xa18df200, 0x19e5c100,
+        0x97d5cd80, 0x70da6a40, 0xe2fa8020, 0xfc4f4030, 0xd180e008, 0xf342b024, 0xdfa40812, 0x7bf0cc33
+      },
+      { // 516
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0xa8000000, 0x04000000, 0x3a000000, 0x07000000,
+        0xc5800000, 0xeac00000, 0x5b600000, 0x63d00000, 0x55c80000, 0xd4840000, 0x56420000, 0x29230000,
+        0xc0f68000, 0xea3d4000, 0x573c2000, 0xd5bfd000, 0x9afd3800, 0xfb5dac00, 0x6be99600, 0x59f43b00,
+        0xe2b82e80, 0x677fa640, 0xdd9c8020, 0xde8a4010, 0xaf20a018, 0x71f59034, 0xa6bd982a, 0x3d783c01
+      },
+      { // 517
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x48000000, 0x5c000000, 0x82000000, 0xed000000,
+        0xff800000, 0x92400000, 0xbbe00000, 0x2ff00000, 0x4a380000, 0xb4840000, 0x36c60000, 0x75270000,
+        0xaed38000, 0x4aea4000, 0xd96ee000, 0xa12e1000, 0x3bca6800, 0x51b97c00, 0x70c05200, 0x5e27ff00,
+        0xba514f80, 0x2c2a09c0, 0x744d8020, 0x6bf94030, 0xe7236038, 0xbbd7501c, 0x41690812, 0xe52e2c17
+      },
+      { // 518
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0xf8000000, 0xac000000, 0x5a000000, 0xd5000000,
+        0xa3800000, 0x20400000, 0xdae00000, 0x36500000, 0xdc380000, 0xc8440000, 0x4ee60000, 0x20570000,
+        0xc33c8000, 0x46c3c000, 0x61236000, 0x80f5d000, 0xfa8a2800, 0x0f2edc00, 0x551e6200, 0xdcb10700,
+        0xa26a9a80, 0x307bbdc0, 0x18a36020, 0xb5b5d030, 0x63ea2838, 0x893edc24, 0xabc6623e, 0x8ea5072b
+      },
+      { // 519
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x38000000, 0x6c000000, 0x52000000, 0x37000000,
+        0xb0800000, 0x9c400000, 0x29a00000, 0x72100000, 0x22e80000, 0x50440000, 0xcba20000, 0x5d110000,
+        0x0e6f8000, 0xa605c000, 0xb9016000, 0xcd839000, 0x87c63800, 0x6f644400, 0x9cf78200, 0x9bdbdd00,
+        0xabfe2880, 0x202a9340, 0x28a16020, 0x93939010, 0xd72e3808, 0xf820443c, 0xdfd5820e, 0x368add1b
+      },
+      { // 520
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x78000000, 0x64000000, 0xbe000000, 0x57000000,
+        0x18800000, 0x6fc00000, 0x60200000, 0x45d00000, 0x24980000, 0x93c40000, 0x4a260000, 0xe4d50000,
+        0xe71c8000, 0x4687c000, 0xc8c52000, 0x30a0f000, 0xa6163800, 0xe6bb0400, 0x5b145e00, 0x9f38f100,
+        0x57519680, 0xba5b60c0, 0xe8652020, 0x2eb0f030, 0x84ae3828, 0x93af0424, 0xeb2a5e1e, 0xb4e9f119
+      },
+      { // 521
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x28000000, 0x2c000000, 0x72000000, 0xc7000000,
+        0x34800000, 0x20400000, 0x6c200000, 0x51100000, 0x3db80000, 0x34440000, 0x6a260000, 0xc0110000,
+        0x203d8000, 0xbd854000, 0xf9c76000, 0x9be29000, 0xc7f3b800, 0xbdc8e400, 0xeb4c6200, 0x540af100,
+        0x28afb080, 0xb7fec9c0, 0x7b676020, 0xc1b29030, 0xf0ebb808, 0x8fdce42c, 0xcc72620a, 0xfd0ff10b
+      },
+      { // 522
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0xf8000000, 0x34000000, 0x92000000, 0x1b000000,
+        0x4b800000, 0xfe400000, 0x56a00000, 0x1f500000, 0xa2780000, 0x2c440000, 0xeda60000, 0x24d30000,
+        0xb4388000, 0xb6e3c000, 0x54f7a000, 0x0faf9000, 0xc8fc5800, 0xee879c00, 0xd8c35200, 0xf265a500,
+        0xc3376280, 0x34492fc0, 0x168fa020, 0xf3eb9030, 0xbd5a5818, 0xee549c04, 0x06fbd23e, 0x6b86650d
+      },
+      { // 523
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x38000000, 0x54000000, 0x42000000, 0xaf000000,
+        0xa0800000, 0x21400000, 0x2f200000, 0x1f900000, 0x7a580000, 0x2b440000, 0xcc260000, 0x79170000,
+        0xbe198000, 0x67e5c000, 0x4474a000, 0xe02d1000, 0xaa68f800, 0x4fcec400, 0x621eaa00, 0x89e7e900,
+        0x1d74c480, 0x9dab36c0, 0xbcaca020, 0xb5291030, 0x31eef838, 0x6c09c40c, 0xf37f2a0e, 0x21d62915
+      },
+      { // 524
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x78000000, 0xac000000, 0xea000000, 0x31000000,
+        0xa5800000, 0x14c00000, 0xefe00000, 0x09500000, 0x73780000, 0x56c40000, 0x7ae20000, 0xf2d30000,
+        0x20b98000, 0xbfa7c000, 0x5ff76000, 0x350c5000, 0xb50c0800, 0xf508ec00, 0x9508c600, 0xa50caf00,
+        0xdd0e8280, 0x710c97c0, 0x9b0f6020, 0xaa085010, 0x0f8e0818, 0x1b4bec0c, 0xf4a9461e, 0xfdff6f2b
+      },
+      { // 525
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0xd8000000, 0x1c000000, 0x7a000000, 0x29000000,
+        0xa4800000, 0x00c00000, 0x77a00000, 0x36900000, 0xfd880000, 0xaec40000, 0xa0a20000, 0x3d170000,
+        0x9acc8000, 0x8c22c000, 0x59d2e000, 0xfb6cd000, 0xa1b1c800, 0xedd9e400, 0x97ebe600, 0x2572ed00,
+        0x1c7b3c80, 0x627da840, 0x8d7ae020, 0x0af8d010, 0xcfbbc838, 0xd85ae424, 0xffad6636, 0x10132d07
+      },
+      { // 526
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0xc8000000, 0x2c000000, 0xde000000, 0xe5000000,
+        0xfe800000, 0x67c00000, 0xa9e00000, 0xa7100000, 0x86780000, 0x0dc40000, 0xa6e60000, 0x96930000,
+        0xb03b8000, 0xe2624000, 0x26576000, 0xbc5df000, 0x4930a800, 0x588fb400, 0xf4ad5e00, 0xb95a3f00,
+        0x07b55080, 0x974c27c0, 0x014f6020, 0x0849f030, 0x48cea818, 0xba08b41c, 0x2568de32, 0xc9bf7f0b
+      },
+      { // 527
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x98000000, 0x84000000, 0x76000000, 0x55000000,
+        0x35800000, 0xa5400000, 0xcb600000, 0x22700000, 0x75e80000, 0x80440000, 0x26e20000, 0xa3350000,
+        0x388f8000, 0x6f30c000, 0xe28e2000, 0xf032b000, 0x800f2800, 0xdbf46c00, 0x0aac8a00, 0xd4202b00,
+        0x66121b80, 0xfd187340, 0x326c2020, 0x4607b010, 0x2d00a828, 0xe184ac3c, 0xbb42aa26, 0x82629b21
+      },
+      { // 528
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x48000000, 0xdc000000, 0xf6000000, 0x03000000,
+        0x36800000, 0x0d400000, 0x81e00000, 0x5db00000, 0xf0c80000, 0xa6440000, 0xdb620000, 0x1ef10000,
+        0x362e8000, 0xaf764000, 0x0fece000, 0xfad2b000, 0x883c9800, 0xfb6ef400, 0x4e960a00, 0xa25aff00,
+        0x921f9580, 0xba7b4240, 0x0a0ee020, 0xa563b010, 0xa1f21808, 0x06a8b434, 0x3932ea12, 0x2c8c4f37
+      },
+      { // 529
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x48000000, 0x04000000, 0x82000000, 0x95000000,
+        0x97800000, 0x1cc00000, 0xdee00000, 0xae900000, 0xd6380000, 0x51c40000, 0x25660000, 0x04570000,
+        0x87de8000, 0xb1d64000, 0xfe1e2000, 0x80b71000, 0xd04c2800, 0x466dfc00, 0x3c1c4600, 0x35b5a700,
+        0x77ce7c80, 0xc2a9ddc0, 0xaef82020, 0x1d201030, 0xb6f2a838, 0x91ebbc34, 0x00da6612, 0xdb56b701
+      },
+      { // 530
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xc8000000, 0x94000000, 0x5e000000, 0xb3000000,
+        0xe9800000, 0xe1c00000, 0x85200000, 0xccd00000, 0x34580000, 0xcec40000, 0xc6a20000, 0x90110000,
+        0x53fb8000, 0x56524000, 0x5c1ea000, 0xfa27f000, 0x37541800, 0x34980c00, 0x63642e00, 0xb3329900,
+        0x502e5e80, 0x318b9ec0, 0x561ca020, 0x7726f010, 0x3dd79808, 0x84de4c1c, 0x5b808e32, 0x30c06925
+      },
+      { // 531
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0xc8000000, 0x8c000000, 0xd2000000, 0x81000000,
+        0x8f800000, 0x0c400000, 0xd0200000, 0x85f00000, 0x46280000, 0x59440000, 0xd9a60000, 0x4eb10000,
+        0xfe8f8000, 0x48724000, 0x136a6000, 0x92e39000, 0x36158800, 0xcfbb3c00, 0x72bf8200, 0x073c5100,
+        0xd67f4780, 0x63dc5d40, 0x2f6c6020, 0x68e29030, 0xeb120808, 0xaa3d7c3c, 0xbbfbe232, 0x069ac123
+      },
+      { // 532
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0xb8000000, 0x6c000000, 0x2e000000, 0xb9000000,
+        0x50800000, 0x13c00000, 0xefa00000, 0xe4f00000, 0x58080000, 0xf4c40000, 0x6e220000, 0x13b30000,
+        0x766c8000, 0xd091c000, 0x57596000, 0xd23e7000, 0xa9ef4800, 0xf6d24400, 0x9dbe7e00, 0x37a84d00,
+        0x5036cf80, 0x562e9440, 0x77736020, 0xa0497010, 0xaf21c818, 0x0f308424, 0xbbab9e2e, 0xae37fd1b
+      },
+      { // 533
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x08000000, 0xf4000000, 0x3a000000, 0xf9000000,
+        0x16800000, 0x0dc00000, 0xf3600000, 0x21500000, 0x35b80000, 0x0ac40000, 0x9ee60000, 0x4f150000,
+        0xcb9e8000, 0xea344000, 0x58e9a000, 0x8978d000, 0x7b234800, 0xf873f400, 0xa8cc4e00, 0x0a8c8b00,
+        0x82ab2280, 0x2d5869c0, 0x12d7a020, 0xf0f9d030, 0x9f63c828, 0x8756b434, 0x72bd6e02, 0x07451b3d
+      },
+      { // 534
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x48000000, 0x9c000000, 0xd6000000, 0xc5000000,
+        0xc0800000, 0x60400000, 0x7be00000, 0xf9700000, 0x11c80000, 0x07440000, 0x84620000, 0xf2b30000,
+        0x4bec8000, 0x27164000, 0xf87ee000, 0xb529b000, 0x45b4a800, 0x9c6d4400, 0x20d46200, 0x3c59af00,
+        0xcc784380, 0x2f2e5a40, 0x7eb4e020, 0x95eeb010, 0x1e122818, 0x7efc0424, 0x586c0212, 0x62d15f27
+      },
+      { // 535
+        0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x38000000, 0x14000000, 0x4a000000, 0x0f000000,
+        0x90800000, 0x41400000, 0xf9a00000, 0x23f00000, 0x1fe80000, 0x98440000, 0x20260000, 0xb3370000,
+        0xba8f8000, 0xb0d5c000, 0x6a5ea000, 0xea895000, 0x58d5f800, 0x565c4400, 0x7c8e2a00, 0x31d1dd00,
+        0x97d90780, 0xe84a0b40, 0x16b0a020, 0x9c4a5030, 0x6cb47838, 0x4b4a843c, 0x18310a0e, 0x780e4d05
+      },
+      { // 536
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x58000000, 0x4c000000, 0xa2000000, 0x61000000,
+        0xb5800000, 0x56400000, 0x69200000, 0x75500000, 0x40e80000, 0x43c40000, 0x2f660000, 0x64710000,
+        0xa9be8000, 0xf92ec000, 0x41a06000, 0x5c921000, 0xfa8c8800, 0x8c35ec00, 0x9b9c1200, 0x34f93900,
+        0x90893280, 0x19356340, 0x301ee020, 0x29bcd030, 0x392ce808, 0x61a7fc34, 0x8c909a16, 0xa28cd513
+      },
+      { // 537
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x78000000, 0xf4000000, 0x86000000, 0xc5000000,
+        0xa5800000, 0x4a400000, 0x39600000, 0x3f100000, 0xb9c80000, 0x7bc40000, 0xe5220000, 0xeb750000,
+        0x5f5f8000, 0x824fc000, 0x1081a000, 0xd7c33000, 0x2724a800, 0x70716c00, 0x3bde3200, 0x938e5b00,
+        0x52a5e080, 0xf231ca40, 0x2ebe2020, 0x2e9cf010, 0xd06d0828, 0x1d765c3c, 0xa2589a1e, 0x73ca373d
+      },
+      { // 538
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x98000000, 0xf4000000, 0x3a000000, 0x8b000000,
+        0x84800000, 0x31c00000, 0x1ba00000, 0xf5900000, 0x39480000, 0x11440000, 0x68620000, 0xa1350000,
+        0x7a5c8000, 0xfec8c000, 0x2801a000, 0xbc06d000, 0xf605d800, 0xd5046400, 0xad82ee00, 0xca46ad00,
+        0x94e22480, 0x54f1b640, 0x53fd2020, 0xec5e1010, 0x5bcc7828, 0x2d86b424, 0x8a453626, 0x34e7c93d
+      },
+      { // 539
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x78000000, 0xe4000000, 0xe6000000, 0xcb000000,
+        0xcb800000, 0x60400000, 0x28e00000, 0x1d900000, 0x52380000, 0x2dc40000, 0xb3a60000, 0x76f10000,
+        0x63ee8000, 0x2d1fc000, 0x4af52000, 0x71e83000, 0x581dd800, 0x7e711c00, 0x4428e200, 0x3fbad700,
+        0x6686c480, 0xa0c175c0, 0xa323a020, 0x8533f030, 0x1f4ef808, 0x86682c34, 0x2a5bba1e, 0x23940b39
+      },
+      { // 540
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xd8000000, 0xec000000, 0xee000000, 0x3f000000,
+        0x12800000, 0x9a400000, 0xc7600000, 0xbc100000, 0x97980000, 0x1ec40000, 0x5e260000, 0x7ff10000,
+        0x72c88000, 0x6abac000, 0xb5b56000, 0x8da87000, 0x0aac7800, 0x042cd400, 0x986e7200, 0x440dab00,
+        0x309e2880, 0x0047f0c0, 0x1a65e020, 0x4f96b030, 0xe85f1808, 0x6565a404, 0xbd128a36, 0x421fbf3b
+      },
+      { // 541
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x88000000, 0x54000000, 0x96000000, 0x21000000,
+        0xd8800000, 0x06400000, 0xeb200000, 0xa2300000, 0xc7180000, 0xf0c40000, 0x50620000, 0x33930000,
+        0x646d8000, 0xad784000, 0x8854a000, 0xdf8db000, 0xcf2b8800, 0x24d90400, 0x2723d200, 0x7835c900,
+        0x7c1a6980, 0xf34694c0, 0xe5a12020, 0xe571f010, 0x44bd2818, 0xdcb7b42c, 0x285dda22, 0xf7608d15
+      },
+      { // 542
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x58000000, 0xec000000, 0x92000000, 0xfb000000,
+        0x9d800000, 0x80c00000, 0x9ea00000, 0xcb100000, 0x1a080000, 0x73440000, 0xbf660000, 0xd7310000,
+        0x9a5b8000, 0xaa2ec000, 0x81156000, 0xcd0b9000, 0x5cc15800, 0xb4a3ac00, 0x8c10a600, 0x3d8c8500,
+        0xbc83d080, 0xc2428440, 0xf5e6e020, 0x78715030, 0x0f3a3808, 0x3a1d3c1c, 0x3ccc7e16, 0xa8e0e93b
+      },
+      { // 543
+        0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x58000000, 0xf4000000, 0xc6000000, 0xd9000000,
+        0xab800000, 0x44c00000, 0x7de00000, 0x2a300000, 0xf9980000, 0x05440000, 0x12260000, 0x83530000,
+        0x55ed8000, 0x367ec000, 0xf075a000, 0xf93b3000, 0xd9544800, 0x26ec1c00, 0x16f84600, 0xb035ff00,
+        0xea9e6980, 0x95c178c0, 0x0a602020, 0x64f1f030, 0xdf7fe818, 0xc3f02c2c, 0x29ff8e16, 0xd2b0233d
+      },
+      { // 544
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0xf8000000, 0xe4000000, 0xce000000, 0xc7000000,
+        0x1f800000, 0xd4400000, 0x10200000, 0xe0900000, 0x0a580000, 0xc9c40000, 0xa1620000, 0x9a330000,
+        0xfc098000, 0xe97bc000, 0x70d12000, 0xc47f7000, 0x4650b800, 0x98bcbc00, 0x55b14200, 0xa04a5100,
+        0x855f8c80, 0x8a4636c0, 0x3f20a020, 0xb310b010, 0x3c1b9818, 0xcce4cc0c, 0xb3727a3e, 0x52aa2d39
+      },
+      { // 545
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x68000000, 0x64000000, 0x0e000000, 0xc7000000,
+        0x19800000, 0x64400000, 0xb0a00000, 0x99500000, 0x3b580000, 0x1ac40000, 0x3d660000, 0x15b70000,
+        0xceae8000, 0xbacf4000, 0xb1f92000, 0xe2957000, 0x5cb9b800, 0xacb60c00, 0x882bc200, 0xfb0e9500,
+        0xb71d2280, 0x0e611ec0, 0x4a31a020, 0x39ed3030, 0xa5ee1838, 0x87ec3c34, 0x1aeb5a1a, 0x726de919
+      },
+      { // 546
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xc8000000, 0xdc000000, 0x72000000, 0x63000000,
+        0x5c800000, 0x75c00000, 0x3b600000, 0x61f00000, 0xfce80000, 0xba440000, 0x4a260000, 0x1b510000,
+        0x587a8000, 0xfe5a4000, 0xef0ce000, 0xb0709000, 0x24ae9800, 0xbb632400, 0xa1f78e00, 0xdcebeb00,
+        0xea43e780, 0x8225cb40, 0xc7506020, 0x2a7bd030, 0x9d58f808, 0xb389f414, 0xc5b5f632, 0x1fc85f37
+      },
+      { // 547
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0xc8000000, 0x6c000000, 0x5a000000, 0xf9000000,
+        0x23800000, 0x5e400000, 0x8a200000, 0x3cd00000, 0xd1f80000, 0x2cc40000, 0xcbe20000, 0x9ab70000,
+        0xe2088000, 0x706a4000, 0xfd9d6000, 0x8e33d000, 0x28ca4800, 0x708cdc00, 0x21a95200, 0x93faa100,
+        0xd1c61e80, 0x2e614bc0, 0xbff7e020, 0x16ae9010, 0x077fa838, 0x5b054c04, 0xce867a32, 0x73c1ad1b
+      },
+      { // 548
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x48000000, 0x7c000000, 0x7a000000, 0x21000000,
+        0x0d800000, 0xa5400000, 0x62e00000, 0x25300000, 0xd7b80000, 0x35c40000, 0x90220000, 0xd3930000,
+        0xa5eb8000, 0x560e4000, 0x16bde000, 0x0846d000, 0x1d638800, 0xbd72ac00, 0xb2df0a00, 0xdcb56700,
+        0x54fa1180, 0x1c2309c0, 0xa1946020, 0x98eb9010, 0x518de818, 0xdafe3c1c, 0x1b236212, 0xe7121b1f
+      },
+      { // 549
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x38000000, 0xa4000000, 0xbe000000, 0xe5000000,
+        0x85800000, 0x85c00000, 0xf7e00000, 0x53700000, 0xb8780000, 0x31440000, 0xb1a60000, 0x40510000,
+        0xd76f8000, 0x828dc000, 0xeeff2000, 0xa806f000, 0x8c07a800, 0xf2036c00, 0x37074e00, 0x4286af00,
+        0xff456380, 0xaca337c0, 0x41d6a020, 0x1caa3030, 0xa86f0808, 0x9c0c5c3c, 0x2bb9c60e, 0xafa23329
+      },
+      { // 550
+        0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x68000000, 0x84000000, 0x62000000, 0xb1000000,
+        0xfb800000, 0x7e400000, 0xa9e00000, 0x6b300000, 0xb0c80000, 0x58c40000, 0x8a220000, 0x8f970000,
+        0x08998000, 0x6eff4000, 0x318a2000, 0xfda21000, 0x67d10800, 0xfa7a1c00, 0xfb491200, 0x0e873f00,
+        0x47c4e180, 0xb6a24240, 0x6151a020, 0x49ba5010, 0xa7eaa838, 0x6ad34c0c, 0xfff83a1a, 0x5a0c3321
+      },
+      { // 551
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xe8000000, 0xfc000000, 0xca000000, 0x0d000000,
+        0x77800000, 0xeac00000, 0x3ee00000, 0x24d00000, 0x9c780000, 0xa4440000, 0xe5a60000, 0x6ff30000,
+        0x38ce8000, 0x5fab4000, 0x32bde000, 0x84a75000, 0x9a73e800, 0x93097c00, 0xe4cd7600, 0xe5ad0700,
+        0x67b9fe80, 0x3726e7c0, 0xaeb56020, 0x96ef1030, 0x70988818, 0xe9916c34, 0x605d7e3a, 0x22742b3f
+      },
+      { // 552
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x98000000, 0x4c000000, 0xca000000, 0xd1000000,
+        0x92800000, 0x74400000, 0x56600000, 0x05500000, 0x54080000, 0xd3c40000, 0x4ea60000, 0x20710000,
+        0x66bb8000, 0x6158c000, 0xffc86000, 0x81655000, 0x4cd20800, 0x43cad400, 0x13628200, 0xf1d44300,
+        0x6b4b9280, 0x2e216c40, 0x7935e020, 0xd05c9030, 0xfd49e808, 0x3d23441c, 0xbeb6ea26, 0x589ec713
+      },
+      { // 553
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x28000000, 0xe4000000, 0x46000000, 0x93000000,
+        0x7a800000, 0x38400000, 0x52600000, 0x8d900000, 0xcf680000, 0xf3c40000, 0x85a20000, 0xee370000,
+        0x825e8000, 0xf31d4000, 0x82f92000, 0x9cab3000, 0x46631800, 0x93911400, 0xa06e2200, 0xd3444300,
+        0xa4e6a480, 0xf7d32740, 0x980da020, 0xbfd57010, 0xec0eb838, 0x31d46434, 0x4b089a0a, 0x25542739
+      },
+      { // 554
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x98000000, 0x8c000000, 0x5e000000, 0x61000000,
+        0x8c800000, 0xe8400000, 0x56600000, 0xbfd00000, 0x53980000, 0xe7c40000, 0x05a20000, 0x98730000,
+        0xdcee8000, 0x12a8c000, 0x39ca6000, 0xac9ff000, 0x2a408800, 0xd1672400, 0x6e526200, 0x215e6300,
+        0x2ce0a680, 0xb29160c0, 0xa37ee020, 0xd3503010, 0x2bde6818, 0x49a71434, 0xe6740a26, 0x0ded7723
+      },
+      { // 555
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0xf8000000, 0x34000000, 0xee000000, 0x1f000000,
+        0x94800000, 0x36c00000, 0x2ae00000, 0x1cd00000, 0x33680000, 0xaf440000, 0x75a60000, 0xf1750000,
+        0xe61d8000, 0xef5bc000, 0x49fba000, 0xf6087000, 0xd7d27800, 0x99ede400, 0x6e835600, 0xb7c3c700,
+        0xf9640e80, 0x3a969740, 0x39482020, 0xb272b030, 0x209a5828, 0x449f542c, 0x82990e3e, 0x419c930d
+      },
+      { // 556
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0xc8000000, 0xfc000000, 0x4e000000, 0x7d000000,
+        0x25800000, 0xeec00000, 0xabe00000, 0x67b00000, 0x38d80000, 0x5be40000, 0x8fb20000, 0x94db0000,
+        0xede58000, 0xc6b44000, 0x035ce000, 0x3027f000, 0x35d7a800, 0xafadcc00, 0x4dd88600, 0xa266f700,
+        0x7f74f180, 0xba3e40c0, 0x9bd7a820, 0xa2adcc10, 0xc0588618, 0x80a6f70c, 0x5294f1b2, 0x5c8e40ff
+      },
+      { // 557
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x68000000, 0x8c000000, 0x86000000, 0xb1000000,
+        0xe6800000, 0xa4c00000, 0xefe00000, 0xa4300000, 0x15880000, 0xc7e40000, 0x48360000, 0x638d0000,
+        0x4ee68000, 0x4ab54000, 0xcd496000, 0x9602b000, 0xb900c800, 0x9a865400, 0x1ac39600, 0xbae1b700,
+        0x48b67580, 0x8649ba40, 0x7f80c820, 0xae465430, 0x3d239628, 0xc2d1b714, 0xb33e759a, 0x7cadba63
+      },
+      { // 558
+        0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0xc8000000, 0x44000000, 0x3e000000, 0x89000000,
+        0xb9800000, 0x6e400000, 0x20e00000, 0x51b00000, 0xd1a80000, 0xf8e40000, 0x4db20000, 0xb3af0000,
+        0xf3e58000, 0xcf344000, 0x976d2000, 0xb3c47000, 0xe0a00800, 0xe050ec00, 0x859b0200, 0xf50f0f00,
+        0x66b36180, 0xa1290f40, 0xcf200820, 0x3310ec10, 0x0afb0238, 0x37ff0f0c, 0xd87b61b2, 0xab3d0f51
+      },
+      { // 559
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x78000000, 0x2c000000, 0xce000000, 0xbb000000,
+        0x40800000, 0x1d400000, 0xaba00000, 0x6c300000, 0xf1280000, 0x67a40000, 0xb2360000, 0x522b0000,
+        0xdb228000, 0x1975c000, 0x6e8a6000, 0x3994f000, 0x4e181800, 0xe20c6400, 0xfad21a00, 0x46be4500,
+        0x32b98580, 0xa0be5340, 0x1db81820, 0x623c6430, 0xa5fa1a18, 0x4a1a4534, 0xb80f859e, 0xc3d5534b
+      },
+      { // 560
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x28000000, 0x2c000000, 0x0e000000, 0x0b000000,
+        0x5e800000, 0x83c00000, 0x4b600000, 0x5dd00000, 0xc4b80000, 0x57640000, 0x3bd20000, 0x83bb0000,
+        0xb7e18000, 0x9b134000, 0xba5a6000, 0x67f1f000, 0x1fcb1800, 0xee6c9400, 0x1b5fee00, 0x80764300,
+        0x3f8dfa80, 0xc7498bc0, 0xdaab1820, 0xf8bc9410, 0xe167ee18, 0xe4d2432c, 0x673ffa8a, 0x35228bcb
+      },
+      { // 561
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x48000000, 0xc4000000, 0x7a000000, 0x5b000000,
+        0x5e800000, 0x6ac00000, 0xace00000, 0x6a300000, 0xdb280000, 0x50e40000, 0x4c320000, 0x162b0000,
+        0x7b608000, 0x11704000, 0x118d2000, 0xf3f35000, 0x3d4a9800, 0x0213d400, 0x34fe0600, 0x407aff00,
+        0x19bd0580, 0xdfd91f40, 0x7d2a9820, 0xdde3d410, 0x07b60618, 0xdb6eff24, 0x34c70592, 0x5de61f71
+      },
+      { // 562
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0xe8000000, 0xa4000000, 0xfe000000, 0xdf000000,
+        0xa9800000, 0x80c00000, 0x25200000, 0xdd900000, 0xf0780000, 0xb3240000, 0x66960000, 0x07fd0000,
+        0x7ce08000, 0x02314000, 0xfea82000, 0x57bf7000, 0xb383b800, 0xc1c36c00, 0x63a27600, 0x8cd41100,
+        0x1999c080, 0x119555c0, 0x6a7bb820, 0x32276c30, 0x80147628, 0xc6b91124, 0x7d0140ba, 0x048015e9
+      },
+      { // 563
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0xf8000000, 0xdc000000, 0xae000000, 0x1d000000,
+        0x8f800000, 0x47c00000, 0x61a00000, 0xedb00000, 0x73c80000, 0x57a40000, 0xfcb60000, 0xba490000,
+        0x19658000, 0x9891c000, 0x7f3fe000, 0x3788f000, 0xf7c52800, 0x59a59c00, 0x11b7ce00, 0xedcda500,
+        0xb2a63180, 0xaf343040, 0x538d2820, 0x65c19c30, 0xfaa1ce08, 0x4b34a50c, 0x018bb1be, 0xe6c1f077
+      },
+      { // 564
+        0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x48000000, 0x14000000, 0x06000000, 0xa9000000,
+        0x37800000, 0x2fc00000, 0x12200000, 0x86d00000, 0xdce80000, 0x80240000, 0x69d20000, 0xa26f0000,
+        0x28618000, 0x1c304000, 0x229fa000, 0x7459b000, 0xe9f90800, 0xfce81c00, 0x9025ce00, 0x71d71900,
+        0x4e6dea80, 0x7264c940, 0xa7310820, 0xba1c1c10, 0xc51fce38, 0xe39c192c, 0x47de6a92, 0xd83b8945
+      },
+      { // 565
+        0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0xe8000000, 0xb4000000, 0x46000000, 0xe7000000,
+        0x37800000, 0x08400000, 0x23a00000, 0x1c500000, 0x51e80000, 0x01a40000, 0xa5520000, 0x3d6f0000,
+        0x7c618000, 0xc7b54000, 0x661aa000, 0x481bb000, 0x5b1e7800, 0xca9d1c00, 0x95def200, 0x69fde500,
+        0xc9ef3e80, 0xfda69d40, 0x07567820, 0xc4691c10, 0xf0e4f238, 0x0a76e52c, 0xecfcbeba, 0xa76cdd6d
+      },
+      { // 566
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xd8000000, 0x44000000, 0x3a000000, 0x3b000000,
+        0xbd800000, 0x61400000, 0x5fe00000, 0xafd00000, 0x71780000, 0x69e40000, 0x22d20000, 0x01f90000,
+        0x58278000, 0x3cf4c000, 0x680b2000, 0x04ae5000, 0x33991800, 0x7eb0cc00, 0xae6a5a00, 0xa03b6700,
+        0x8e01f280, 0x9906b1c0, 0xe2811820, 0x96c4cc10, 0xdda05a08, 0x09b6671c, 0x85ec72b6, 0x7c7f71d1
+      },
+      { // 567
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xc8000000, 0x8c000000, 0x92000000, 0x1f000000,
+        0x2e800000, 0x31400000, 0xd9600000, 0x7ff00000, 0xcd580000, 0x86640000, 0xf1760000, 0x0c1b0000,
+        0x07008000, 0xca804000, 0xdf476000, 0x0c601000, 0x0a76b800, 0xcc9d1400, 0xe3411a00, 0x66603300,
+        0xa1718b80, 0xa41b60c0, 0x1b00b820, 0x90861430, 0x4c419a18, 0xb0e07324, 0x2436ebb2, 0x3b7b70e3
+      },
+      { // 568
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xd8000000, 0x14000000, 0xbe000000, 0xa3000000,
+        0x0d800000, 0xce400000, 0xd6600000, 0xbb700000, 0xc3980000, 0x3d640000, 0x9af60000, 0x57d90000,
+        0xfe028000, 0x4300c000, 0xfd81a000, 0xc6437000, 0x1a63d800, 0x1170cc00, 0xde9b8200, 0x93e7ab00,
+        0x5933b780, 0x4ff96ec0, 0x9315d820, 0x3be9cc30, 0x03790208, 0x61d76b34, 0xd74a17b6, 0xb8ae1ec5
+      },
+      { // 569
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x58000000, 0x7c000000, 0xce000000, 0x29000000,
+        0x5c800000, 0x0fc00000, 0x59600000, 0xf0100000, 0xe2e80000, 0x78640000, 0x78920000, 0x672b0000,
+        0x0a018000, 0x6b00c000, 0x8380e000, 0xb643f000, 0x9c238800, 0xf3b10400, 0xd91e0e00, 0x4c5f8300,
+        0xe7fb6480, 0x980a6940, 0xae318820, 0x8e5a0410, 0x78ff8e18, 0x418f432c, 0xdb738496, 0xd5fd995f
+      },
+      { // 570
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x88000000, 0x7c000000, 0x8e000000, 0x39000000,
+        0xad800000, 0x68400000, 0x27a00000, 0x93900000, 0x6a280000, 0x8aa40000, 0x7c160000, 0xdd6f0000,
+        0x35878000, 0x2c424000, 0xbda4e000, 0x2897f000, 0xf8ad8800, 0x0a628c00, 0x10713200, 0x381ff500,
+        0x461e7080, 0x371e5340, 0x069b8820, 0x90dd8c30, 0x067eb238, 0x4469b51c, 0xc80490a2, 0x5c02a35f
+      },
+      { // 571
+        0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x28000000, 0x94000000, 0x96000000, 0x57000000,
+        0xa8800000, 0xed400000, 0xa6a00000, 0x43700000, 0xeee80000, 0x9da40000, 0x91f20000, 0x6eaf0000,
+        0x1e838000, 0xea434000, 0x3623a000, 0xe2333000, 0x624bf800, 0x8bd5e400, 0x1699da00, 0xe1cc8d00,
+        0x6c16df80, 0x8c7c5d40, 0x2399f820, 0x384ae410, 0xb6d25a38, 0x0b1bcd3c, 0x950f7f8a, 0xf0746d65
+      },
+      { // 572
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x88000000, 0x44000000, 0x66000000, 0xf7000000,
+        0x7b800000, 0x08c00000, 0x0aa00000, 0x23d00000, 0x22d80000, 0x1ba40000, 0xef520000, 0x71990000,
+        0xc9c28000, 0x4e264000, 0x34932000, 0x96bdb000, 0x4dd7f800, 0xd1dbfc00, 0x26267600, 0xc0936d00,
+        0x88bf8280, 0xa6d1f0c0, 0x005df820, 0xfbe6fc10, 0x20b6f608, 0x2f2c2d34, 0xfdee22a2, 0x3a4a00d1
+      },
+      { // 573
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x18000000, 0xb4000000, 0xae000000, 0x19000000,
+        0xfd800000, 0x8ec00000, 0x67e00000, 0x04500000, 0x94880000, 0xf0e40000, 0x30d60000, 0xefcb0000,
+        0xc5c78000, 0x5166c000, 0x7c16a000, 0xeb2ef000, 0xfb140800, 0xb7ac4c00, 0x2c560600, 0x988e7700,
+        0xfae00e80, 0xefd0f240, 0xa74a0820, 0xac834c30, 0x0f478618, 0xfb23b71c, 0x08b12e86, 0x7658c26d
+      },
+      { // 574
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0xb8000000, 0xcc000000, 0x72000000, 0x7f000000,
+        0x50800000, 0x02400000, 0xc9e00000, 0x55300000, 0x3ff80000, 0xd4e40000, 0xe2b60000, 0x113f0000,
+        0x85468000, 0x7563c000, 0x95716000, 0x61191000, 0xa5523800, 0x610ae400, 0x01388200, 0x1d453700,
+        0x0964ed80, 0x0f720dc0, 0x6a1c3820, 0x4bd1e430, 0x6e480238, 0xe759f714, 0x1ab30dae, 0xfd38ddf3
+      },
+      { // 575
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x78000000, 0x04000000, 0xc2000000, 0x65000000,
+        0x73800000, 0x20c00000, 0x0a200000, 0x63d00000, 0xecd80000, 0x69240000, 0x97520000, 0x8a9b0000,
+        0x78458000, 0xa261c000, 0xc9b32000, 0x396f9000, 0xa64ce800, 0xee1dbc00, 0x76021600, 0x9f03f900,
+        0x7281c280, 0xa14400c0, 0x37e6e820, 0x1e72bc10, 0x6dcd9618, 0xeadd390c, 0xee25629e, 0xd1d150c1
+      },
+      { // 576
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x48000000, 0x9c000000, 0x16000000, 0xcf000000,
+        0x15800000, 0x98400000, 0xd0600000, 0xd6300000, 0x46f80000, 0x55e40000, 0x46720000, 0x2a990000,
+        0x85d48000, 0x87884000, 0xf6f9e000, 0x4de63000, 0xb2773800, 0xb09dcc00, 0x14d2b200, 0xc10c5b00,
+        0x6d3f4d80, 0xcac6bdc0, 0xa1a3b820, 0xb8158c10, 0xd7ab5208, 0x04aa6b04, 0x47287592, 0x306b71e7
+      },
+      { // 577
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x48000000, 0xc4000000, 0xd2000000, 0xbb000000,
+        0xf9800000, 0x6dc00000, 0xb7600000, 0xb5300000, 0xa8d80000, 0xe6e40000, 0x2cf60000, 0x75bd0000,
+        0x34d68000, 0x23ac4000, 0x539f2000, 0x3fc61000, 0xcc649800, 0xecb66c00, 0x951d3e00, 0x19800300,
+        0x5dc4d580, 0x0f6060c0, 0x69321820, 0xf6da2c30, 0x4be21e28, 0xbc761314, 0x5af84d92, 0x17f20cf1
+      },
+      { // 578
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x88000000, 0xdc000000, 0xae000000, 0x49000000,
+        0x24800000, 0x17c00000, 0xb6200000, 0xad300000, 0x99780000, 0x0aa40000, 0x5ef20000, 0xb55b0000,
+        0x6c938000, 0x8c0e4000, 0x19b9e000, 0x1904f000, 0x7c870800, 0xd3c34400, 0xbc260e00, 0x1e355900,
+        0x86ffdd80, 0xdee74dc0, 0x92948820, 0x9d0d0410, 0xf93fee18, 0x04c1a93c, 0x79a0d5a2, 0x617009f7
+      },
+      { // 579
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x88000000, 0x4c000000, 0x52000000, 0x3d000000,
+        0xa3800000, 0x04c00000, 0xb5a00000, 0x52f00000, 0xee680000, 0xda240000, 0xc4360000, 0x46c90000,
+        0xdb538000, 0xa69a4000, 0x654f6000, 0x1f971000, 0x333aa800, 0xc7bdfc00, 0x79fb7600, 0xa5196500,
+        0x518bfb80, 0x0234ed40, 0xddc92820, 0xf3d7bc30, 0xd2dc1608, 0x90aa753c, 0x2e8753a2, 0xcf401153
+      },
+      { // 580
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xf8000000, 0xa4000000, 0x92000000, 0x69000000,
+        0x83800000, 0x8e400000, 0xe4200000, 0x45d00000, 0x84080000, 0x53a40000, 0xd1920000, 0x75290000,
+        0x93f58000, 0xd8ddc000, 0x8c282000, 0x98731000, 0x2a9f8800, 0x6e0dbc00, 0xdea0a200, 0xe0158900,
+        0xa26f0280, 0x0c55ca40, 0xb74a0820, 0x7e007c10, 0xe7008208, 0xfc82990c, 0xc6c28abe, 0x78e17669
+      },
+      { // 581
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x58000000, 0x34000000, 0xda000000, 0x1b000000,
+        0xa5800000, 0xdf400000, 0x0da00000, 0x5f300000, 0x25c80000, 0xf4240000, 0x76720000, 0xfd690000,
+        0x7f918000, 0x6a78c000, 0x4a2ca000, 0x5e355000, 0xfb491800, 0x1ee40c00, 0x4c956a00, 0xc3fad500,
+        0xeb692580, 0x7a951c40, 0x76f89820, 0xafeccc10, 0xab51ca08, 0x599b852c, 0x163a3d96, 0x060c104d
+      },
+      { // 582
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x98000000, 0x14000000, 0x8a000000, 0x5b000000,
+        0x7c800000, 0x70c00000, 0x30600000, 0xdc100000, 0xd9580000, 0x9ee40000, 0x03d20000, 0xafbd0000,
+        0xe1348000, 0x1a6ec000, 0x0389a000, 0xdadad000, 0xd0a51800, 0x3474c400, 0xb14e9600, 0xddbbbb00,
+        0x5e333480, 0xc4ec64c0, 0xb4499820, 0x903e0410, 0xb9753628, 0x70cc6b04, 0xa4faaca6, 0x3b1260c5
+      },
+      { // 583
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xc8000000, 0xcc000000, 0x46000000, 0xab000000,
+        0xf6800000, 0x63400000, 0x96e00000, 0x95900000, 0xd9380000, 0x0e640000, 0xa1d20000, 0x575b0000,
+        0xefb78000, 0x968c4000, 0xc8e96000, 0xb13fb000, 0x92661800, 0x3fd35400, 0x885fea00, 0x5b364f00,
+        0xd4cb0880, 0x458bdbc0, 0x1a699820, 0x487b1410, 0x51848a18, 0xf3c2ff1c, 0x4ea290b2, 0x4df0cff3
+      },
+      { // 584
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x68000000, 0x14000000, 0xf2000000, 0xf3000000,
+        0x12800000, 0xf2c00000, 0xfee00000, 0x9e900000, 0x39280000, 0xca640000, 0x4d520000, 0x764b0000,
+        0xecb58000, 0x04594000, 0x3a5fa000, 0x07581000, 0x60d9d800, 0xb19cb400, 0x343fc600, 0xa00f0f00,
+        0xf9949080, 0x99ad3740, 0xaba45820, 0x9131f410, 0x721a6618, 0x3f781f0c, 0xa2aac89a, 0xbd23c345
+      },
+      { // 585
+        0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xb8000000, 0xc4000000, 0x4e000000, 0x21000000,
+        0x0c800000, 0xc8400000, 0x1aa00000, 0x7bb00000, 0xae580000, 0xa4240000, 0xd8f60000, 0x377f0000,
+        0xca538000, 0x10cbc000, 0xfe0d2000, 0x93eff000, 0x7779c800, 0xea54c400, 0x00cf7200, 0xb60ebd00,
+        0xefefa980, 0xfd7ea8c0, 0x85524820, 0x2d4b0430, 0x72cc5238, 0x3d0a4d3c, 0x9c6be1ae, 0x50baacf1
+      },
+      { // 586
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x78000000, 0x04000000, 0xde000000, 0x03000000,
+        0x39800000, 0x1f400000, 0xa8e00000, 0xc6b00000, 0xa3780000, 0xd3640000, 0xd0f20000, 0x07190000,
+        0xfc118000, 0x5fa9c000, 0x7c6d2000, 0x054d7000, 0xcbdcd800, 0xaeb36c00, 0x2f7b4a00, 0x51663f00,
+        0xb9f56980, 0x9b99e9c0, 0xddd55820, 0x0f8eac10, 0x0e7c6a08, 0xf1e64f2c, 0x6232319e, 0xa6be45c1
+      },
+      { // 587
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0xc8000000, 0x54000000, 0x02000000, 0x01000000,
+        0x01800000, 0x75c00000, 0xa6200000, 0x2ab00000, 0x37b80000, 0xc6a40000, 0xeef20000, 0xdc5d0000,
+        0x86368000, 0x6dfc4000, 0x7a43a000, 0xace09000, 0x2a134800, 0xf2482c00, 0xbe79fe00, 0x86819900,
+        0xff464980, 0x27659bc0, 0xaad7c820, 0x07e96c10, 0x280cde28, 0x429d4914, 0x6496a1b2, 0x590d27d5
+      },
+      { // 588
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xa8000000, 0x34000000, 0x9a000000, 0x15000000,
+        0x53800000, 0x2ec00000, 0x92a00000, 0x99500000, 0x85e80000, 0x44240000, 0x6c120000, 0x3d8b0000,
+        0x2dd68000, 0xf9af4000, 0x01c6a000, 0xa4245000, 0x7c16e800, 0xf589bc00, 0x49d4e600, 0xcbaf9d00,
+        0x20c58680, 0x6da57140, 0x47d26820, 0x34adfc10, 0xfe44c618, 0xdce48d14, 0xfdb5ceaa, 0x84589d4d
+      },
+      { // 589
+        0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0xf8000000, 0x44000000, 0x4e000000, 0xe5000000,
+        0x62800000, 0x40400000, 0x07200000, 0x1c500000, 0xe8080000, 0x58a40000, 0x0a920000, 0xb96d0000,
+        0xd2d58000, 0x2a4dc000, 0xe8832000, 0xab41f000, 0x20a5e800, 0x0e90b400, 0x576fb200, 0x07d13100,
+        0xb0cb8680, 0xecc36a40, 0xe2626820, 0xd9f07410, 0x84191228, 0x4f8d010c, 0x0a654ebe, 0x15f62e51
+      },
+      { // 590
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x98000000, 0xec000000, 0x5e000000, 0x5d000000,
+        0x3f800000, 0x10c00000, 0xdd200000, 0x4cb00000, 0x12b80000, 0xf7a40000, 0xd7f60000, 0x4d590000,
+        0x35368000, 0x737ac000, 0x6b026000, 0x86867000, 0x25472800, 0x72e41c00, 0x3516b600, 0xc04b6100,
+        0x497d6980, 0xfc00fbc0, 0x2607a820, 0xc107dc30, 0xa9825608, 0x39c7d114, 0x50a021a6, 0x5f7697fb
+      },
+      { // 591
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x18000000, 0xcc000000, 0x6a000000, 0x47000000,
+        0xb2800000, 0xed400000, 0x76e00000, 0x30b00000, 0xb4c80000, 0x6b640000, 0xcb720000, 0xa16b0000,
+        0x84368000, 0x048ac000, 0xc0016000, 0x2003d000, 0x3001f800, 0x48017400, 0xd404fa00, 0xa607ef00,
+        0x2d074180, 0xf580f440, 0x5fc57820, 0x9ba0b410, 0x46531a18, 0x847eff14, 0xdfafd986, 0xa0165073
+      },
+      { // 592
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x58000000, 0x2c000000, 0xb6000000, 0x3d000000,
+        0xf8800000, 0x9b400000, 0x16e00000, 0x29f00000, 0x66580000, 0x8f640000, 0x54360000, 0x92f90000,
+        0x9af48000, 0x7fdcc000, 0x32a46000, 0x80933000, 0x976a2800, 0xe91a2400, 0xf381aa00, 0x9ec73f00,
+        0x5522bb80, 0xb45440c0, 0x0148a820, 0xeccfe430, 0x0b094a08, 0x74accf04, 0xa4baf396, 0xec9454cb
+      },
+      { // 593
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xc8000000, 0x0c000000, 0x06000000, 0x25000000,
+        0x33800000, 0x71400000, 0x02e00000, 0xd9b00000, 0xb0580000, 0xc0640000, 0xe9720000, 0x44fb0000,
+        0xf7b38000, 0x295c4000, 0x5de76000, 0x4135b000, 0xbb9c6800, 0x76427c00, 0xae67fa00, 0x10725f00,
+        0x2978e180, 0x97f560c0, 0xda3de820, 0xda153c10, 0xe30b1a18, 0xc58faf3c, 0x6f49e9b2, 0x80edacc3
+      },
+      { // 594
+        0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x38000000, 0xf4000000, 0x22000000, 0xb7000000,
+        0x3e800000, 0x66c00000, 0x38600000, 0x85700000, 0x46b80000, 0x33e40000, 0x7a320000, 0x3e990000,
+        0x4c368000, 0x9b9bc000, 0x8db2a000, 0x5fd99000, 0x3d117800, 0x83ced400, 0x555ee600, 0x19d75b00,
+        0x7cae0f80, 0x86ac9bc0, 0xf5adf820, 0xa1281410, 0xece8c608, 0x040c0b14, 0x86bb578e, 0x53e01ffd
+      },
+      { // 595
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x78000000, 0x04000000, 0x66000000, 0x41000000,
+        0x5f800000, 0x9b400000, 0x90600000, 0xc4300000, 0x14880000, 0x18e40000, 0x49f60000, 0x8c2d0000,
+        0xddf48000, 0x522dc000, 0x38f12000, 0x7badb000, 0x9ab0c800, 0xb04c5c00, 0xa3c52a00, 0x75a02b00,
+        0x20912d80, 0xb39ed640, 0x243a4820, 0xe3a89c30, 0xeeb68a28, 0x1e4d5b04, 0x8ec4459e, 0x3022fa41
+      },
+      { // 596
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x98000000, 0x84000000, 0xa6000000, 0xd3000000,
+        0x52800000, 0xeec00000, 0xc1e00000, 0xd3500000, 0xd3880000, 0xde640000, 0x48160000, 0x202f0000,
+        0xbd168000, 0x61aac000, 0xe1572000, 0x1e89b000, 0x6be15800, 0x9a523400, 0xc0098600, 0xdf223700,
+        0xfab3fe80, 0xacdc5240, 0xe7e9d820, 0xff73f430, 0xcbbe2638, 0x547e4714, 0x721b06a6, 0x2e091661
+      },
+      { // 597
+        0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0x38000000, 0x94000000, 0x4e000000, 0x35000000,
+        0x1b800000, 0x4d400000, 0xfea00000, 0xf6900000, 0xc3a80000, 0xfa240000, 0x43520000, 0x1acf0000,
+        0xe2d58000, 0x5c8bc000, 0xeaf7a000, 0x58d9f000, 0xecbb6800, 0x0bcbfc00, 0xcf50da00, 0x50ce7d00,
+        0x71d65880, 0xee0b3f40, 0x5e34e820, 0x043b3c10, 0x8408fa38, 0x5d374d0c, 0x5ebd108e, 0xaccdf365
+      },
+      { // 598
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x28000000, 0x84000000, 0xfa000000, 0x0b000000,
+        0x32800000, 0xc3c00000, 0x65600000, 0x03900000, 0x27180000, 0x66a40000, 0x06f20000, 0x74890000,
+        0x19bf8000, 0xcc574000, 0x0c7f2000, 0x9c315000, 0xec689800, 0x3169f400, 0x36e86e00, 0x16aae300,
+        0xf9897080, 0x463ca2c0, 0x4017b820, 0x9d58a410, 0xd280f608, 0xd3c3171c, 0x1d611e8a, 0xdf9641e1
+      },
+      { // 599
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x18000000, 0xf4000000, 0xaa000000, 0x97000000,
+        0x2f800000, 0xdf400000, 0x4f600000, 0x60500000, 0x65880000, 0x30240000, 0xbf360000, 0x3dd90000,
+        0xf1ae8000, 0x3d12c000, 0xe1e8a000, 0x49f2d000, 0x84f8f800, 0xbc1b1c00, 0x170c8a00, 0xe7e05300,
+        0x6894e680, 0x71aaba40, 0xfd105820, 0xc1e9cc30, 0x19f47208, 0x9cfb4f14, 0x48186c86, 0xbd0ae97d
+      },
+      { // 600
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x68000000, 0x64000000, 0xde000000, 0xa5000000,
+        0x27800000, 0x95400000, 0xd0e00000, 0xd4d00000, 0x8af80000, 0xada40000, 0x20320000, 0x202d0000,
+        0x32598000, 0xc2154000, 0xf15c2000, 0x1c927000, 0x8199e800, 0x9e305c00, 0xd52efa00, 0x6ddf1f00,
+        0xeb521280, 0xf3bb71c0, 0xd745c820, 0x57e22c10, 0x24571228, 0x973f432c, 0xdc84e89a, 0x57c06ed9
+      },
+      { // 601
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x68000000, 0x6c000000, 0x2a000000, 0x2f000000,
+        0xaf800000, 0x5e400000, 0xb5600000, 0xd3500000, 0x80780000, 0x57240000, 0xd4360000, 0x182b0000,
+        0x0edd8000, 0xb0514000, 0x95fe6000, 0x1e67d000, 0xfad5b800, 0xbb3e5c00, 0x52c54200, 0x9ea0c300,
+        0x1f72fe80, 0x15cb5dc0, 0x184bd820, 0xf5098c30, 0xcde8fa18, 0x33fa9f0c, 0xeb61bc9a, 0x72509edb
+      },
+      { // 602
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x08000000, 0xec000000, 0x8a000000, 0x05000000,
+        0xaa800000, 0xbc400000, 0x6be00000, 0x94300000, 0x7cb80000, 0x03a40000, 0x21d20000, 0x73890000,
+        0x6e9a8000, 0x5fb64000, 0x4c7c6000, 0x7b07d000, 0xa184e800, 0x85c37400, 0x2a205200, 0x08176700,
+        0xf3aebd80, 0xb38b03c0, 0x0e988820, 0xafb4a410, 0x947cba08, 0x9f001334, 0xc784ef82, 0x0ac164fb
+      },
+      { // 603
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0xb8000000, 0x1c000000, 0xaa000000, 0x81000000,
+        0x15800000, 0x24400000, 0xbb600000, 0xb3f00000, 0x25f80000, 0xe5240000, 0x51960000, 0xaf8d0000,
+        0x66988000, 0x2ad7c000, 0xee6be000, 0xe3a8d000, 0x868f4800, 0x171a8c00, 0x18971200, 0xee0ec300,
+        0x7cd99b80, 0x8eb651c0, 0xc71ca820, 0xc0965c30, 0xc20e5a28, 0xfed94f24, 0xabb609ae, 0x649f52c7
+      },
+      { // 604
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x28000000, 0xc4000000, 0x3a000000, 0x4f000000,
+        0x3e800000, 0x9f400000, 0xd1200000, 0x7c100000, 0x04180000, 0x1c640000, 0xc6360000, 0x8c890000,
+        0x303a8000, 0xd9f34000, 0x57e92000, 0x1c8a5000, 0xf83fb800, 0xedf59400, 0x95ea8a00, 0xbf8fe100,
+        0x38bb8c80, 0x07b09ec0, 0x354e9820, 0x625bc430, 0x72c33208, 0xb6e37534, 0x8b73868a, 0xf6a83ff1
+      },
+      { // 605
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0xc8000000, 0x34000000, 0x6e000000, 0x65000000,
+        0x43800000, 0xeb400000, 0x2d600000, 0x3db00000, 0x89680000, 0x10240000, 0x49d60000, 0x8d590000,
+        0x890b8000, 0x9a144000, 0x65fea000, 0x2519f000, 0x76e8e800, 0x4166fc00, 0xbfb50a00, 0xae69f300,
+        0x54a4b980, 0x16139d40, 0x37fe4820, 0x3a1b0c30, 0xce6be208, 0x44a60f3c, 0x0e1233b2, 0x3bfa2e4d
+      },
+      { // 606
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x58000000, 0xfc000000, 0x16000000, 0x93000000,
+        0x56800000, 0x94400000, 0x80a00000, 0xbc900000, 0x6cf80000, 0x2ee40000, 0xa1320000, 0x09ef0000,
+        0xc6de8000, 0x5034c000, 0x3e6ae000, 0x9d193000, 0xc752d800, 0x0b9a9400, 0xf3127200, 0x3b3a6d00,
+        0x4785e880, 0xf3c2a1c0, 0x83603820, 0xd7f7a410, 0x4f0aaa38, 0xd3ebf914, 0x0bdb1a96, 0xd1b30cff
+      },
+      { // 607
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0xc8000000, 0x0c000000, 0xea000000, 0xa9000000,
+        0x90800000, 0x4f400000, 0x86a00000, 0xbd700000, 0xed080000, 0x47e40000, 0x64d60000, 0x9bff0000,
+        0x282d8000, 0x54544000, 0xc4b96000, 0xb68dd000, 0x1d208800, 0x07b3a400, 0xbe6bca00, 0xaa75ed00,
+        0xea8c0780, 0xcf25a640, 0x8ab1e820, 0xf8ea7430, 0x6e354238, 0x59ad490c, 0x47944db2, 0x075f0b43
+      },
+      { // 608
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x78000000, 0x84000000, 0x02000000, 0xb5000000,
+        0xba800000, 0x8ac00000, 0xbea00000, 0xeff00000, 0xade80000, 0xda640000, 0xba560000, 0xfb9b0000,
+        0xd8ce8000, 0xa7d1c000, 0xa6d92000, 0xe22d9000, 0x5646e800, 0x13673400, 0x46d1e600, 0xa6590d00,
+        0x39ece380, 0x0062dd40, 0xbb57c820, 0x6b1ea430, 0x1b090e18, 0x25f13914, 0x74ed859e, 0xfee51061
+      },
+      { // 609
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x68000000, 0x0c000000, 0x5e000000, 0x13000000,
+        0x42800000, 0x5dc00000, 0x22a00000, 0x57900000, 0xe0f80000, 0x8c640000, 0xc7b60000, 0xb2ad0000,
+        0xba388000, 0x26414000, 0xd4e36000, 0x8b737000, 0x578f5800, 0x7ded3400, 0xcd5a7e00, 0x6f747d00,
+        0xc58fb080, 0x90e93dc0, 0x0cda3820, 0x18334430, 0xb6eda628, 0xbbd80924, 0xa8b6ae9a, 0x362e30c3
+      },
+      { // 610
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0xa8000000, 0x3c000000, 0x22000000, 0x5f000000,
+        0xd2800000, 0x8fc00000, 0x7fe00000, 0xea500000, 0x6fa80000, 0xc7240000, 0x9b320000, 0xd83d0000,
+        0x706e8000, 0xf0c34000, 0xbd66e000, 0x6d969000, 0x7c4d3800, 0xa7763400, 0x979e8e00, 0xef991700,
+        0x3b9fbe80, 0x859fd740, 0xa899d820, 0x8d1da410, 0xec5d3628, 0x3e7c6314, 0xf4cfd0aa, 0xa3b4504f
+      },
+      { // 611
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x58000000, 0x24000000, 0x82000000, 0x4d000000,
+        0x78800000, 0x2bc00000, 0x51e00000, 0xba100000, 0xde080000, 0xdf240000, 0xaf720000, 0xc9d90000,
+        0xafcd8000, 0xa7c4c000, 0xcfe22000, 0x41149000, 0x01892800, 0xbd642400, 0x0bd66e00, 0xc6edf700,
+        0xafb1fc80, 0x4fbcaa40, 0x1b990820, 0x1369b410, 0xacf2c608, 0x7d9d130c, 0xbc6db296, 0x8971cd49
+      },
+      { // 612
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xb8000000, 0x34000000, 0x7e000000, 0x8b000000,
+        0x8c800000, 0x64c00000, 0x53200000, 0x2a900000, 0xe7880000, 0xb0e40000, 0x7f360000, 0xbcdf0000,
+        0xb3c98000, 0xb507c000, 0x2780a000, 0xb8417000, 0x3fe41800, 0xf5b00400, 0x87197600, 0xa2693100,
+        0xc8536880, 0x2ba97e40, 0x38f2b820, 0x7f7e7430, 0x5f9cee38, 0xc8aaf52c, 0x4874beae, 0x09ba3f4d
+      },
+      { // 613
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xe8000000, 0x8c000000, 0x5e000000, 0xc5000000,
+        0x6a800000, 0x8ec00000, 0xe9a00000, 0x49700000, 0x34380000, 0xa6640000, 0xe8560000, 0xb0890000,
+        0xa07c8000, 0xd9054000, 0x1c836000, 0xe7c37000, 0xcd21e800, 0xeab07400, 0x3b1ae600, 0x3fd79500,
+        0xf0c93780, 0x351b83c0, 0xf2d48820, 0x264a0430, 0x1ddf8e08, 0xba76a104, 0xd7beb1ba, 0x3c2266e3
+      },
+      { // 614
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x28000000, 0x9c000000, 0xea000000, 0xdb000000,
+        0x58800000, 0x8ac00000, 0x9ce00000, 0x5ef00000, 0x1da80000, 0x89240000, 0xd4960000, 0xec9d0000,
+        0x2dea8000, 0xc8034000, 0x2c07e000, 0xb204d000, 0xbf011800, 0x06876400, 0x27c7e600, 0xf5656f00,
+        0x57b6eb80, 0x530e7f40, 0xc1f0f820, 0x0b2eb430, 0x26e47e28, 0x6df54b34, 0x7928ed8a, 0x39e6c067
+      },
+      { // 615
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x88000000, 0x2c000000, 0x22000000, 0x61000000,
+        0xb5800000, 0x1b400000, 0x78a00000, 0xd1b00000, 0x79880000, 0xe0e40000, 0x1d920000, 0xb6f90000,
+        0xe2888000, 0xf0624000, 0x0d526000, 0x8e1c9000, 0x3b1fc800, 0xf89e8c00, 0xb4dfaa00, 0x0efa5d00,
+        0x968fe980, 0x56601a40, 0xf257a820, 0xf09f1c10, 0xd8dae208, 0x0cff9124, 0x678aa3a2, 0x6be4974b
+      },
+      { // 616
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xd8000000, 0xec000000, 0xe6000000, 0xef000000,
+        0x4b800000, 0x5e400000, 0x22a00000, 0x38b00000, 0xba980000, 0xa9e40000, 0xe0920000, 0x44e90000,
+        0xea1b8000, 0xd620c000, 0x45746000, 0xd279b000, 0x49f23800, 0xb3b9fc00, 0x1f17a200, 0x50acdd00,
+        0xe1bf2180, 0xba139ac0, 0x322c5820, 0xeb7d4c10, 0x55741a08, 0x9a78e13c, 0xadf563b6, 0x91bf37fb
+      },
+      { // 617
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x48000000, 0xec000000, 0x66000000, 0xb7000000,
+        0x71800000, 0xe8c00000, 0xc8200000, 0x07500000, 0x68280000, 0xb5e40000, 0xf3f20000, 0x0f3b0000,
+        0xe7ad8000, 0x3e244000, 0xe8566000, 0xeda9b000, 0xaf227800, 0x4ed4ac00, 0x44e81600, 0xc7c54900,
+        0x6da64e80, 0x4d93eb40, 0xad0e1820, 0x5a321c10, 0x599dee18, 0x8dbaa50c, 0x84efb892, 0xe7c4527b
+      },
+      { // 618
+        0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x98000000, 0x04000000, 0x32000000, 0x8f000000,
+        0x48800000, 0x7cc00000, 0x29200000, 0x30300000, 0x07080000, 0x45640000, 0x01d20000, 0x5c190000,
+        0x355e8000, 0x973ac000, 0x526f2000, 0xfcb41000, 0x09c93800, 0xc3412400, 0x29661600, 0xbfd14100,
+        0x5d1c8d80, 0x94dcb240, 0x86789820, 0xc40ff410, 0xe3e00e08, 0xe4147514, 0xd0bba3a6, 0x2628d741
+      },
+      { // 619
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x78000000, 0xe4000000, 0x42000000, 0x09000000,
+        0xb5800000, 0xa2400000, 0xc8600000, 0xe9d00000, 0x71f80000, 0x0ba40000, 0x79f60000, 0x1d4d0000,
+        0xd4098000, 0xd0e9c000, 0xf6f82000, 0xb9209000, 0xa9350800, 0xa5e9cc00, 0x357a6200, 0x3862fb00,
+        0xf1d49a80, 0x85f9e9c0, 0x81a4a820, 0xecf09c30, 0x0ecf4a28, 0x3d4fa72c, 0xa40df09e, 0x08efdef9
+      },
+      { // 620
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x28000000, 0x2c000000, 0xf6000000, 0x0d000000,
+        0x77800000, 0xa3400000, 0xeda00000, 0xd0900000, 0xa8d80000, 0x6d640000, 0xcc720000, 0x32ef0000,
+        0x21a88000, 0xd40f4000, 0x70986000, 0xba423000, 0x2820a800, 0x44d01c00, 0x59fe0a00, 0x4c349500,
+        0x71c98080, 0x37ff38c0, 0x75304820, 0x844d6c10, 0xfbbec238, 0x1012b924, 0x571d228a, 0x9100b1cb
+      },
+      { // 621
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xe8000000, 0x14000000, 0xf6000000, 0xd1000000,
+        0xd7800000, 0x52400000, 0x31600000, 0x6cf00000, 0x6a880000, 0xb2a40000, 0x46d60000, 0xac9d0000,
+        0xfc9c8000, 0x749d4000, 0xd09fa000, 0xde983000, 0xf39e4800, 0xc61edc00, 0xb35d4200, 0x84b8d300,
+        0x6d8c8380, 0x64262240, 0x8b156820, 0xcbbfac30, 0xbf0aaa28, 0xb7e33f04, 0x293309ba, 0xa9ad6d45
+      },
+      { // 622
+        0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0xb8000000, 0xe4000000, 0xa6000000, 0x17000000,
+        0x28800000, 0x45c00000, 0x08200000, 0x4cb00000, 0xe9180000, 0x5b640000, 0x62520000, 0x4b0f0000,
+        0xc00d8000, 0x0a8bc000, 0x2e4e2000, 0x91edb000, 0xec1df800, 0x0ae32400, 0xa4117e00, 0x5c69a900,
+        0xc859c980, 0x7c854ac0, 0x1bc65820, 0x1b215410, 0xf230a638, 0x03d83d0c, 0x9fc0cfae, 0xcd2007f9
+      },
+      { // 623
+        0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x98000000, 0x34000000, 0x66000000, 0xd7000000,
+        0xc6800000, 0x43c00000, 0xa3600000, 0xd0700000, 0xd6f80000, 0x48240000, 0x7bd60000, 0x496f0000,
+        0x786b8000, 0xa9eec000, 0xccaca000, 0xdc09b000, 0x3718f800, 0x0591d400, 0xfd4ace00, 0x19b97300,
+        0xed85df80, 0x9f4375c0, 0xeda7d820, 0x5892a430, 0x9ec89638, 0x3dfe173c, 0x74a469a6, 0xc51112cd
+      },
+      { // 624
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x08000000, 0x7c000000, 0xe2000000, 0x35000000,
+        0x78800000, 0xa1c00000, 0xfda00000, 0xac300000, 0xb4e80000, 0xeae40000, 0x4f520000, 0x64f90000,
+        0x51788000, 0x0c3e4000, 0x765ce000, 0x14cc9000, 0xd7926800, 0xfbdfe400, 0xad883e00, 0x3bf07500,
+        0x3248bd80, 0xc157b540, 0xfbfe0820, 0x40f93410, 0xa77cb608, 0x173e0124, 0x41d86b82, 0x8c8f645f
+      },
+      { // 625
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0xd8000000, 0x34000000, 0xbe000000, 0x89000000,
+        0x21800000, 0xb4400000, 0x02a00000, 0x77500000, 0xcd380000, 0x05640000, 0x22b20000, 0x9e4d0000,
+        0xebc88000, 0x9188c000, 0xf22aa000, 0xd8fa7000, 0xf3850800, 0xf745ec00, 0xb426b200, 0xfb924d00,
+        0x825c6e80, 0xf0d6dfc0, 0x247f2820, 0xa8435c10, 0x20a31a28, 0x9c54d124, 0xa7bd54b6, 0x4ba0becd
+      },
+      { // 626
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x18000000, 0x2c000000, 0xf2000000, 0xcb000000,
+        0x91800000, 0xa6400000, 0xa5200000, 0xe1300000, 0xae680000, 0x44e40000, 0x2f560000, 0x4ef90000,
+        0x95788000, 0x843ac000, 0x7a9a6000, 0x4ae81000, 0x3a211800, 0xdeb6ac00, 0x992e8200, 0x1f45c100,
+        0x3fa5ed80, 0xf6f56540, 0x3d0bf820, 0x18f07c30, 0x4c0bfa08, 0x56767d24, 0x35ccf786, 0x7411c84b
+      },
+      { // 627
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xb8000000, 0xdc000000, 0x66000000, 0x13000000,
+        0x7f800000, 0x6b400000, 0x43e00000, 0x95d00000, 0x99b80000, 0x04240000, 0x22f60000, 0xb4c90000,
+        0x43a98000, 0x4ebfc000, 0xb1a5e000, 0xa4b1b000, 0xf7a9d800, 0x1cb95c00, 0x30a14a00, 0x7a305700,
+        0xf2687a80, 0xe298b3c0, 0x8753b820, 0x327e2c30, 0xad04f208, 0xe0877b2c, 0x5ac508ae, 0xefa008f7
+      },
+      { // 628
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xa8000000, 0xb4000000, 0xb6000000, 0x97000000,
+        0xca800000, 0xef400000, 0xc4200000, 0x28d00000, 0x3c380000, 0x5ee40000, 0x3d320000, 0xe98b0000,
+        0x692f8000, 0x15bb4000, 0xed20a000, 0x91573000, 0x17f97800, 0x8e813400, 0xb1402a00, 0x87218900,
+        0x24559a80, 0xec7937c0, 0xe4445820, 0x4ca64410, 0x86967218, 0xd59ccd1c, 0xfbf468aa, 0x9e6abaed
+      },
+      { // 629
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x98000000, 0x24000000, 0xda000000, 0xab000000,
+        0xd2800000, 0xc8c00000, 0x94200000, 0x05700000, 0x89b80000, 0x81640000, 0x11120000, 0xdb2d0000,
+        0x1b0e8000, 0x4c7ac000, 0x72c22000, 0x8f235000, 0xbff61800, 0xad79f400, 0x73417600, 0x41640900,
+        0xf1103780, 0x2b2b47c0, 0xd308b820, 0xf07d6410, 0x8cc3ce28, 0xfe206d14, 0xc67779a6, 0xb738eac9
+      },
+      { // 630
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0xd8000000, 0xdc000000, 0x56000000, 0x85000000,
+        0xc7800000, 0xbfc00000, 0xee200000, 0x7e900000, 0xfca80000, 0x47640000, 0xfaf20000, 0xfcd90000,
+        0xeffa8000, 0x1ae8c000, 0xf781e000, 0xd7c73000, 0x1a256800, 0xfc909c00, 0x2baf6e00, 0x8fe30900,
+        0x51b15080, 0xefb90f40, 0x070c0820, 0xc9366c10, 0xdcf96608, 0xe8686534, 0xa7c0b6b6, 0x5220aa77
+      },
+      { // 631
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x58000000, 0xdc000000, 0x6e000000, 0xdb000000,
+        0x25800000, 0x6a400000, 0xd4a00000, 0xa3900000, 0x92980000, 0xce640000, 0x93f60000, 0x426d0000,
+        0xd58c8000, 0x5238c000, 0x47f1e000, 0xc868f000, 0x0c8d9800, 0x8abf8c00, 0x57330200, 0xe10e6d00,
+        0xa4fad880, 0x919692c0, 0xe79ef820, 0x90e6bc30, 0xcc35fa28, 0xa48cd104, 0x7eb92296, 0x0d3743f7
+      },
+      { // 632
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x88000000, 0x4c000000, 0x46000000, 0xe7000000,
+        0xc7800000, 0x77400000, 0x33a00000, 0xcb900000, 0x13180000, 0x92640000, 0x47f60000, 0x47ed0000,
+        0x300b8000, 0x1dbe4000, 0x87756000, 0x672eb000, 0xacedf800, 0xd18d9c00, 0xddf8aa00, 0x0b567500,
+        0x1ffda880, 0x865286c0, 0x297d1820, 0xa9946c30, 0x6e1db228, 0x2ce6193c, 0x24361aa2, 0x46899fd3
+      },
+      { // 633
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x68000000, 0x64000000, 0x6e000000, 0x03000000,
+        0x34800000, 0xf8c00000, 0xff200000, 0x11f00000, 0x5de80000, 0xa6640000, 0x3d920000, 0x4d7b0000,
+        0xbc9d8000, 0x7d4d4000, 0x5fd62000, 0x699bf000, 0x36cdd800, 0x91964400, 0x577dd600, 0xe9993100,
+        0x76ce8380, 0xf191f540, 0x677c7820, 0x819ff410, 0x12c9ae18, 0x9f92c50c, 0x647d2d9a, 0xb51c3059
+      },
+      { // 634
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xd8000000, 0xa4000000, 0xae000000, 0x0f000000,
+        0xa4800000, 0x1a400000, 0xd4200000, 0xbeb00000, 0x12780000, 0xdfe40000, 0x9d560000, 0x45290000,
+        0x1bca8000, 0xfd1cc000, 0xdef62000, 0xaf5cf000, 0x96d53800, 0xebee4400, 0x2dab4200, 0xe38a0900,
+        0x04381980, 0xc9c5bdc0, 0xdee79820, 0x26d37430, 0x03ecda08, 0xa1a97d34, 0xe18cc3b6, 0xd938c0e9
+      },
+      { // 635
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x58000000, 0x5c000000, 0x42000000, 0xfd000000,
+        0x14800000, 0x7bc00000, 0x5aa00000, 0xee100000, 0x17880000, 0x0ee40000, 0x78f20000, 0x137b0000,
+        0xaf988000, 0xe26cc000, 0xe197e000, 0x2bcf9000, 0x2c06a800, 0xca060400, 0x9902ee00, 0x9a814d00,
+        0x9cc0ec80, 0xef26ce40, 0xc353c820, 0xcbea5410, 0xaed12618, 0xfaab1924, 0x50b1ca96, 0x379dd757
+      },
+      { // 636
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xf8000000, 0xb4000000, 0x4a000000, 0xe1000000,
+        0xd4800000, 0x8fc00000, 0xb1200000, 0x38100000, 0x12680000, 0x58140000, 0x226e0000, 0x50150000,
+        0xbe688000, 0x5612c000, 0xa16d2000, 0x29909000, 0x1b2a2800, 0xc3f63400, 0x1dde5600, 0x58abbd00,
+        0x6fb39680, 0x30b92e40, 0x45de5620, 0xfcabbd30, 0xfdb39688, 0xb5b92e74, 0x235e561e, 0x266bbd1d
+      },
+      { // 637
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0xb8000000, 0x74000000, 0x0a000000, 0x21000000,
+        0x03800000, 0xabc00000, 0xe6e00000, 0x8a700000, 0x05580000, 0xe2740000, 0x895a0000, 0x3c710000,
+        0xf2588000, 0xa6f4c000, 0x2e1b2000, 0xe1d49000, 0x638a2800, 0x6d7c8c00, 0x2f637600, 0xe0b5bb00,
+        0x103c2580, 0x2bc411c0, 0xa6e37620, 0x2a75bb10, 0x555c25a8, 0x5a7411d4, 0xfd5b760e, 0x3671bb0d
+      },
+      { // 638
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x28000000, 0xfc000000, 0x06000000, 0x6f000000,
+        0x8d800000, 0x60400000, 0x33600000, 0x03f00000, 0xb3080000, 0x5bf40000, 0x970a0000, 0x39f10000,
+        0x3a0a8000, 0x09704000, 0x42cd6000, 0xbed07000, 0xf09e1800, 0xd08c1c00, 0x48b11a00, 0x9feb8700,
+        0x0d460580, 0xe3e39f40, 0xcb311a20, 0x3cab8710, 0x3da605a8, 0x03539f44, 0xe8d91a2a, 0x97ef872f
+      },
+      { // 639
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x48000000, 0xec000000, 0x5a000000, 0xb7000000,
+        0xbb800000, 0x38c00000, 0x1a600000, 0x7fb00000, 0xb8180000, 0x53b40000, 0xc21a0000, 0xd4b70000,
+        0x61988000, 0x48754000, 0xcdffe000, 0xdac79000, 0x79625800, 0x0a364c00, 0x99d99e00, 0xbb519f00,
+        0x3feae380, 0x188d1fc0, 0x63b99e20, 0xd4e19f10, 0xaff2e398, 0xf7391fd4, 0xb3a39e32, 0x5b569f2b
+      },
+      { // 640
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xa8000000, 0x6c000000, 0x2a000000, 0xd5000000,
+        0xed800000, 0xe6c00000, 0x72600000, 0x6dd00000, 0x20480000, 0x29d40000, 0x264a0000, 0xb6d70000,
+        0x0eca8000, 0x15924000, 0xf669e000, 0x20231000, 0x6ef74800, 0xc4387c00, 0x87ae7e00, 0x26c6ef00,
+        0x52609080, 0x1dd72d40, 0x984e7e20, 0xedd6ef10, 0x60489098, 0x49d32d44, 0x364c7e0a, 0x1ed5ef0b
+      },
+      { // 641
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0xf8000000, 0x9c000000, 0xd2000000, 0xa9000000,
+        0xd5800000, 0x8cc00000, 0xec600000, 0xe5700000, 0x5f480000, 0x91740000, 0xc94a0000, 0xc6770000,
+        0x4fcc8000, 0x5230c000, 0xb4e86000, 0xace65000, 0x9e352800, 0xdeecfc00, 0xf9e74e00, 0x49b29f00,
+        0x0329e580, 0x5c072540, 0xf2074e20, 0x19029f10, 0xfd81e598, 0xe8c32574, 0xa2654e1e, 0x9e719f37
+      },
+      { // 642
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0xe8000000, 0x54000000, 0xfe000000, 0x77000000,
+        0x8a800000, 0xb4c00000, 0x02200000, 0x12900000, 0xcd380000, 0x9e940000, 0x1f3a0000, 0xcb970000,
+        0x98bc8000, 0x94d04000, 0x87de2000, 0x4427b000, 0x99959800, 0x8dbfe400, 0x73563e00, 0x089ef500,
+        0xb3432a80, 0x1d615cc0, 0x6df63e20, 0xcdcef510, 0x68db2a98, 0x82a55cf4, 0xdf543e1a, 0x6a9df505
+      },
+      { // 643
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x58000000, 0x94000000, 0x46000000, 0x6f000000,
+        0x68800000, 0x78400000, 0xeaa00000, 0xc3b00000, 0xa4480000, 0x25b40000, 0x7b4e0000, 0x35350000,
+        0xe70d8000, 0xc197c000, 0xdfb92000, 0x4b5df000, 0xed4e5800, 0xb230b400, 0x63889a00, 0x1bd26100,
+        0x441d4780, 0x1b686340, 0x1fc09a20, 0x6a666130, 0x59534788, 0x315d635c, 0xc84d1a36, 0x47b1a115
+      },
+      { // 644
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xa8000000, 0x1c000000, 0x22000000, 0x0f000000,
+        0xcd800000, 0xb3400000, 0xd4600000, 0x51900000, 0xfa180000, 0x8f940000, 0xc71a0000, 0xb5150000,
+        0x7dd98000, 0x44304000, 0xc9296000, 0x0f395000, 0xcd651800, 0xed113c00, 0x89df8200, 0x5a331f00,
+        0x9428ce80, 0x65bbefc0, 0xafa78220, 0xa8371f10, 0x032ace88, 0x3c3aefdc, 0x52e4020a, 0xf9525f17
+      },
+      { // 645
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x88000000, 0xf4000000, 0x46000000, 0xc9000000,
+        0x01800000, 0x1bc00000, 0x55e00000, 0x12500000, 0x36e80000, 0xc8540000, 0x9dee0000, 0xaed70000,
+        0xaaae8000, 0x2f734000, 0xcbd92000, 0x19a97000, 0xf5f36800, 0x2e9b7c00, 0x070eb600, 0xd4065300,
+        0xf600e480, 0x31050440, 0x6d86b620, 0x21c25330, 0x2ee6e498, 0x9cd60444, 0xe5ae3602, 0x87f2130d
+      },
+      { // 646
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x78000000, 0xc4000000, 0x4a000000, 0x7b000000,
+        0x44800000, 0x9e400000, 0x88200000, 0xf1900000, 0x8c480000, 0x2a940000, 0x98ce0000, 0xecd50000,
+        0x44ea8000, 0x2f46c000, 0x77a4a000, 0x0b509000, 0x0a297800, 0x2b27b400, 0x21170a00, 0x000d3500,
+        0x8db02680, 0x1fdfc740, 0x41d90a20, 0xe8d83530, 0xa35aa688, 0xdb990764, 0x0afdaa3e, 0xb9c8a501
+      },
+      { // 647
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x38000000, 0x8c000000, 0xc2000000, 0x79000000,
+        0x61800000, 0x1c400000, 0xf6a00000, 0xc6500000, 0x99d80000, 0xa3540000, 0x225a0000, 0x7a170000,
+        0x1f788000, 0x6d06c000, 0x5f84e000, 0xaf44d000, 0x0a252800, 0xcd94dc00, 0x443f4a00, 0x4926a900,
+        0x79171880, 0xcbfb77c0, 0xb2c54a20, 0x9c61a910, 0xc6379898, 0xc5e9b7d4, 0xc3bbaa2e, 0x7a627933
+      },
+      { // 648
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x78000000, 0x9c000000, 0xc2000000, 0xe1000000,
+        0x90800000, 0x5c400000, 0xe2200000, 0xd4500000, 0xc7580000, 0x39540000, 0x9dde0000, 0xc0110000,
+        0x017b8000, 0x1302c000, 0xc9876000, 0xf0c0d000, 0xcc666800, 0xaf715400, 0x1f890a00, 0x60498500,
+        0xa7a94880, 0x191aafc0, 0x5a770a20, 0xc9088530, 0x930ac8a8, 0x3e0c6fec, 0x048e6a3e, 0xedc95517
+      },
+      { // 649
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x38000000, 0x24000000, 0x2a000000, 0x71000000,
+        0xfe800000, 0xeec00000, 0x6a600000, 0x8dd00000, 0xa1980000, 0x90d40000, 0x991e0000, 0x09110000,
+        0xdafa8000, 0xd380c000, 0x7e43a000, 0xefa59000, 0xc0362800, 0x200f6400, 0xbbe9de00, 0xb57ff700,
+        0x33c79080, 0xf2e62bc0, 0x8417de20, 0xda7ef730, 0x6e4510a8, 0x17a2ebe4, 0x44327e2e, 0x9a0e6739
+      },
+      { // 650
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x48000000, 0x74000000, 0x9a000000, 0x71000000,
+        0x3c800000, 0x3f400000, 0xbae00000, 0xe5900000, 0x36e80000, 0xde940000, 0x436e0000, 0x01530000,
+        0x98cb8000, 0xfd214000, 0x72302000, 0x8c999000, 0x1b69a800, 0xad557400, 0x6ec8d200, 0x9a266300,
+        0x99b49e80, 0x105b6440, 0x494ed220, 0x80e16330, 0x04911eb8, 0x1269246c, 0x6dd57232, 0x5f89b32d
+      },
+      { // 651
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0xa8000000, 0x1c000000, 0xf6000000, 0xe1000000,
+        0x1b800000, 0x50400000, 0x9d200000, 0x2cd00000, 0x15880000, 0xb3d40000, 0x630a0000, 0x06110000,
+        0x836c8000, 0xf2644000, 0x17746000, 0x249ff000, 0x5a3d6800, 0xd2ac2c00, 0x10066a00, 0x48020500,
+        0x6c022c80, 0x8e07b940, 0x55046a20, 0xf1870510, 0x4744aca8, 0x67a2f974, 0x67148a0a, 0xd8e8b517
+      },
+      { // 652
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xd8000000, 0x64000000, 0x22000000, 0xa1000000,
+        0x49800000, 0x66400000, 0x07e00000, 0xbe100000, 0x60480000, 0x35140000, 0x64ce0000, 0x14d10000,
+        0x0a6f8000, 0xdba7c000, 0x1cf4a000, 0x25dad000, 0x7a1ba800, 0xa3bf9c00, 0xee4a1a00, 0xfa15e300,
+        0xb24f8a80, 0xec141140, 0x794c1a20, 0x8890e330, 0xc88e0aa8, 0x0e32d14c, 0xbbff3a16, 0x5ea9f329
+      },
+      { // 653
+        0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0xc8000000, 0x5c000000, 0xb2000000, 0xa5000000,
+        0x89800000, 0xe3400000, 0xa5600000, 0xd0d00000, 0x2b680000, 0x5bd40000, 0x15ea0000, 0x84130000,
+        0xe24d8000, 0x86e54000, 0x52976000, 0x318cd000, 0x1b444800, 0x91659c00, 0x2ed7d200, 0x046b7700,
+        0xe356f480, 0x9128dc40, 0xd535d220, 0xbb7c7710, 0x179974b8, 0x640a9c7c, 0x0a053212, 0x7106e707
+      },
+      { // 654
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xe8000000, 0xe4000000, 0x6a000000, 0x01000000,
+        0x7d800000, 0x5bc00000, 0xa3600000, 0xe0b00000, 0x80880000, 0x1fb40000, 0x3e0a0000, 0x7cf10000,
+        0x212d8000, 0x8de64000, 0x7bf2a000, 0xc3a91000, 0x78a4a800, 0x03d5fc00, 0xc038f600, 0x6f3e2700,
+        0xc9bc9380, 0xa6fed340, 0x37daf620, 0xadcb2710, 0x8b9313a8, 0xe39d937c, 0x186fd61a, 0x9bc57729
+      },
+      { // 655
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x58000000, 0x14000000, 0xd2000000, 0x8b000000,
+        0x09800000, 0x08400000, 0x4c200000, 0xeeb00000, 0x0e380000, 0x6bb40000, 0x32be0000, 0x17730000,
+        0xae588000, 0x7321c000, 0xc5302000, 0xe57b5000, 0xb2167800, 0x4a4a1c00, 0x186fba00, 0x7bd83d00,
+        0xc564af80, 0xf4157cc0, 0xd349ba20, 0x7aef3d30, 0xaa1a2fb8, 0xd903bcf4, 0x42871a36, 0xe1c2ad35
+      },
+      { // 656
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x18000000, 0x4c000000, 0x96000000, 0x37000000,
+        0x40800000, 0xf1c00000, 0x6e200000, 0xb3700000, 0x56480000, 0x83f40000, 0x7f8e0000, 0x81d50000,
+        0xaaf98000, 0xf89dc000, 0x258fe000, 0xe0d77000, 0xfd7b5800, 0xb9dcf400, 0xa2691600, 0x71846500,
+        0x8e45fd80, 0x5b608f40, 0x1e909620, 0x7e19a530, 0xcb4a1d88, 0xba77ff7c, 0x95cbce26, 0x38b55123
+      },
+      { // 657
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xa8000000, 0x3c000000, 0x32000000, 0x03000000,
+        0x8e800000, 0x71400000, 0xc0e00000, 0xf8500000, 0x1a780000, 0xa6d40000, 0x933a0000, 0xe2370000,
+        0xbd698000, 0x5d4a4000, 0x983c6000, 0x00b1d000, 0x462b7800, 0x7aac2400, 0x48eab200, 0x668a4300,
+        0x9f9aa080, 0xed00e8c0, 0x8f833220, 0x34c00310, 0x7326c098, 0xd3f138dc, 0x1dc84a0a, 0xf87c271f
+      },
+      { // 658
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x68000000, 0x84000000, 0xfa000000, 0x5d000000,
+        0xcf800000, 0xd7c00000, 0x16200000, 0x46900000, 0xecb80000, 0x61140000, 0xff7a0000, 0x6d330000,
+        0xb4e88000, 0x26084000, 0x8638a000, 0x35559000, 0xf0994800, 0xa2836c00, 0x6043b600, 0xcde17d00,
+        0x7eb71280, 0x652fd0c0, 0x9b2b3620, 0x7c293d10, 0x0eafb2b8, 0x46ea40d4, 0xef0a7e3a, 0x3bbe5131
+      },
+      { // 659
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0xb8000000, 0xc4000000, 0x1a000000, 0xd9000000,
+        0xf3800000, 0x70400000, 0x4d200000, 0x20100000, 0xb6280000, 0x5b940000, 0x9a6e0000, 0x58b30000,
+        0xb17d8000, 0xb81ec000, 0xb72fa000, 0xdc101000, 0xa82a6800, 0x78920c00, 0xc0eb2a00, 0x6375c500,
+        0x481f3a80, 0xcf289c40, 0xf816aa20, 0xc22b0530, 0x19909ab8, 0xf7688c5c, 0x0934c20e, 0xdc3d0901
+      },
+      { // 660
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x98000000, 0x94000000, 0x5e000000, 0xc1000000,
+        0xf5800000, 0x86c00000, 0xbc200000, 0x36700000, 0x13c80000, 0x87f40000, 0xf30e0000, 0x9ed70000,
+        0x66fa8000, 0xc6dbc000, 0x62aa2000, 0x1a673000, 0x67132800, 0xbe5e1c00, 0x7beade00, 0x4f82dd00,
+        0xd1c0dd80, 0xe4a1ab40, 0x1f305e20, 0x2e291d30, 0xad22fd98, 0xfbf29b64, 0xf10d7606, 0x6dd00115
+      },
+      { // 661
+        0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0xd8000000, 0x64000000, 0x2a000000, 0x61000000,
+        0x60800000, 0xc3400000, 0xda600000, 0x5cd00000, 0xcf280000, 0xa0540000, 0x726a0000, 0x49310000,
+        0x3b398000, 0xd7dfc000, 0x874ea000, 0x69849000, 0xffc4a800, 0x87221400, 0x65b37200, 0x2e796700,
+        0x82b98480, 0x801ff640, 0xbc6af220, 0x4236a710, 0x9abf24a8, 0x041f665c, 0x466c5a16, 0x8b31b309
+      },
+      { // 662
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x88000000, 0x44000000, 0xfa000000, 0x1d000000,
+        0x6d800000, 0xe3c00000, 0xc0200000, 0xf8900000, 0x22780000, 0xa9140000, 0x87ba0000, 0x72310000,
+        0xa9ae8000, 0xf50d4000, 0xedd8a000, 0x23409000, 0x16614800, 0xb7717c00, 0x34cd1600, 0x1cf8dd00,
+        0x3853c280, 0x28dc46c0, 0x62c39620, 0x7ba59d10, 0x885362a8, 0x70d8d6e4, 0x0ec0de02, 0x55a1e101
+      },
+      { // 663
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0xe8000000, 0xb4000000, 0x2e000000, 0x45000000,
+        0xc9800000, 0x1c400000, 0x73a00000, 0x9a900000, 0xee980000, 0xfd140000, 0xf7da0000, 0xa7330000,
+        0xe10e8000, 0xd20c4000, 0x328f2000, 0xe54f3000, 0x2daa0800, 0x3a1dfc00, 0x44d5aa00, 0x9a3fc100,
+        0xe9020e80, 0x6b859dc0, 0xcb432a20, 0xf5278110, 0xcc572eb8, 0xb9f9ade4, 0xefe7a21a, 0xa9363d3d
+      },
+      { // 664
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0xc8000000, 0x74000000, 0x6e000000, 0xe7000000,
+        0x0b800000, 0x01c00000, 0x16e00000, 0x49300000, 0x19180000, 0xfcb40000, 0x57de0000, 0xa5d10000,
+        0x292a8000, 0xf12f4000, 0x8d2d2000, 0x372a3000, 0x2e2f1800, 0x0aaeec00, 0x74e95600, 0x0dcdfb00,
+        0xb5186f80, 0xeeb20bc0, 0x0adbd620, 0xb756bb30, 0x0c6b4fa8, 0x99893be4, 0xbd3e4e12, 0x96e7172d
+      },
+      { // 665
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x88000000, 0x3c000000, 0x7e000000, 0xa1000000,
+        0x30800000, 0x36c00000, 0x09a00000, 0x47700000, 0xc0f80000, 0xa1f40000, 0x9b3a0000, 0xced10000,
+        0xc78f8000, 0xc10d4000, 0x8aca6000, 0xddecb000, 0x355a6800, 0x7880b400, 0xeac39e00, 0x67a71900,
+        0xde755580, 0x447c96c0, 0xd5341e20, 0x4d9e5910, 0x182535a8, 0x013126ec, 0x5f99f602, 0x5f27ad1f
+      },
+      { // 666
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x48000000, 0x64000000, 0x7a000000, 0x5d000000,
+        0x20800000, 0xb5400000, 0xd7600000, 0xbf700000, 0xcdd80000, 0xe9f40000, 0x0b9e0000, 0x81170000,
+        0xc02a8000, 0x586d4000, 0xb78da000, 0xf1b89000, 0x65044800, 0x5c811400, 0x8341a200, 0x04618f00,
+        0xf0f00980, 0x611bc9c0, 0xd1532220, 0x8bc8cf30, 0x045ba998, 0xee3059e4, 0xa0bbea32, 0x6b879b29
+      },
+      { // 667
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x08000000, 0x0c000000, 0x0a000000, 0x45000000,
+        0x8e800000, 0xfdc00000, 0xeaa00000, 0xddb00000, 0x54b80000, 0x8d340000, 0x127e0000, 0xc2170000,
+        0xcf8f8000, 0x484f4000, 0x4febe000, 0x40d91000, 0xdba2c800, 0xfd30e400, 0xba7f6600, 0x9e16d100,
+        0xfd8d5b80, 0x094c9cc0, 0xc768e620, 0xf21d9130, 0xfa80bb98, 0x53c68ccc, 0xf9a3ae22, 0x24313533
+      },
+      { // 668
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x98000000, 0x0c000000, 0x22000000, 0x8f000000,
+        0x25800000, 0xf2c00000, 0xd4e00000, 0x88700000, 0x79380000, 0xa2f40000, 0xee7a0000, 0xe4d70000,
+        0x02ef8000, 0x8d9bc000, 0xd523e000, 0xe314d000, 0x508a9800, 0x20ad7c00, 0x2d394e00, 0xacf3fb00,
+        0x937a3d80, 0x66567ac0, 0x41acce20, 0x85bf3b10, 0x24b65d98, 0xb8d96aec, 0x5c05b606, 0x4a069713
+      },
+      { // 669
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xb8000000, 0xc4000000, 0xba000000, 0x89000000,
+        0x0a800000, 0xff400000, 0x31a00000, 0xf9900000, 0x02180000, 0x02140000, 0x53da0000, 0xa6f50000,
+        0x5aed8000, 0x2bf8c000, 0xdba7a000, 0x78931000, 0x549ce800, 0x7353c400, 0xe97a5200, 0x18e72900,
+        0x17342e80, 0x6e0941c0, 0x4acdd220, 0xdaaae910, 0x3fde0e88, 0xf0f291fc, 0xc5ee9a0e, 0x9e7e3d21
+      },
+      { // 670
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x28000000, 0x2c000000, 0x72000000, 0x09000000,
+        0xba800000, 0x83400000, 0x39600000, 0x08500000, 0x24d80000, 0xe3d40000, 0xe91e0000, 0x1ff30000,
+        0x77288000, 0xf6fa4000, 0xdee5e000, 0x8793d000, 0x29f8a800, 0xc3658400, 0xdd527200, 0xf459ef00,
+        0xbd950080, 0x1cfa31c0, 0xc3e4f220, 0xab10af30, 0x2db860b8, 0x1383a1f4, 0xc9c1ba2a, 0xa222fb3b
+      },
+      { // 671
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0xb8000000, 0x9c000000, 0xf2000000, 0x57000000,
+        0x82800000, 0xc4400000, 0x41200000, 0x9e100000, 0x94c80000, 0xe7940000, 0x280a0000, 0xe1f50000,
+        0x73bc8000, 0xae68c000, 0xfa446000, 0x1c215000, 0xf791d800, 0xf008c400, 0x8df1ba00, 0xe9bf6d00,
+        0xdd6afa80, 0x16c08340, 0x7d673a20, 0x6332ad10, 0x28da1a88, 0x9c5d1374, 0xd118820e, 0xffbe3937
+      },
+      { // 672
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x08000000, 0x3c000000, 0x8a000000, 0xb7000000,
+        0xa9800000, 0xda400000, 0x20200000, 0xa8b00000, 0xe3880000, 0xe2340000, 0x964a0000, 0xdd510000,
+        0x64588000, 0x5ba94000, 0x9e856000, 0x33c31000, 0x5a63d800, 0xd893dc00, 0x433aca00, 0x3dbdfd00,
+        0xfe7c7f80, 0xfc1de940, 0x10884a20, 0xe5b5bd10, 0xe5099fa8, 0x05f3b954, 0x8a2cf222, 0x60c0711f
+      },
+      { // 673
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x88000000, 0x4c000000, 0x92000000, 0x71000000,
+        0x77800000, 0x2fc00000, 0x93200000, 0x0e900000, 0x30a80000, 0x7c140000, 0x6eee0000, 0x47f10000,
+        0xbbda8000, 0x4a8d4000, 0x0104e000, 0x0f83d000, 0xdbc06800, 0x5527ec00, 0x2994d600, 0xe829d500,
+        0xc7521280, 0xd48b2840, 0x82005620, 0x39059530, 0x9b8472a8, 0x2dc1b864, 0x6a22de02, 0x3514a923
+      },
+      { // 674
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x88000000, 0xe4000000, 0xba000000, 0xb7000000,
+        0xf7800000, 0xdf400000, 0x30a00000, 0x93300000, 0x69980000, 0xa9b40000, 0x165a0000, 0xe1d10000,
+        0x128d8000, 0x47dd4000, 0x1f96a000, 0x9cae9000, 0x012c1800, 0x516fac00, 0x5a4b2200, 0xb8384900,
+        0x6402cb80, 0xfa032dc0, 0x1704a220, 0x07800910, 0x5743eba8, 0xd4a1fdfc, 0x29339a02, 0xde9c7529
+      },
+      { // 675
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x68000000, 0x9c000000, 0xf2000000, 0x49000000,
+        0xcf800000, 0x4a400000, 0xf3600000, 0x0e700000, 0x4cd80000, 0x32f40000, 0xac1e0000, 0xae570000,
+        0xb64e8000, 0xd61c4000, 0xab566000, 0x83c9d000, 0x59592800, 0x0db02c00, 0x12faba00, 0xdb651700,
+        0x32723980, 0xcedd69c0, 0x03f23a20, 0x979a5730, 0x8a14d998, 0xfe2ff9c4, 0x5eebf23a, 0x624beb17
+      },
+      { // 676
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xd8000000, 0x3c000000, 0xd2000000, 0xd7000000,
+        0xa6800000, 0x7ec00000, 0xc2200000, 0xca900000, 0x85880000, 0x4d140000, 0x44ca0000, 0x22770000,
+        0x8b3a8000, 0x9309c000, 0xdbd76000, 0x12e95000, 0xcee0d800, 0xefb7e400, 0x41996e00, 0x4258d500,
+        0xfdfd4a80, 0x952d5140, 0x8f41ee20, 0x5a621510, 0x1672aa98, 0x9d3ec144, 0xda0ed616, 0xb056611f
+      },
+      { // 677
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0xb8000000, 0x2c000000, 0x96000000, 0x89000000,
+        0x35800000, 0x35c00000, 0xc5e00000, 0x26300000, 0x80f80000, 0xb8b40000, 0x63ba0000, 0x7a110000,
+        0xb52e8000, 0x377cc000, 0xfe73e000, 0x2cde7000, 0x4560a800, 0x48765c00, 0x75dc4600, 0x68e2d300,
+        0xc1b7a780, 0x9e3bacc0, 0xebd0c620, 0xe2cb1310, 0x9a48c7a8, 0x780c1ce4, 0x8b2f0e0e, 0x6a7aff1b
+      },
+      { // 678
+        0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x38000000, 0x0c000000, 0xb6000000, 0x59000000,
+        0xd9800000, 0x05400000, 0xe4e00000, 0x51d00000, 0xdf580000, 0x94940000, 0x5bba0000, 0xb5450000,
+        0xece08000, 0x15d0c000, 0x0d5ae000, 0x4f907000, 0x6138a800, 0x86867c00, 0x8dc26200, 0x7c212b00,
+        0x62704480, 0xb16dadc0, 0x20988220, 0x23b15b10, 0x1b48ec88, 0x6bebd1d4, 0x235ae02e, 0x0a907013
+      },
+      { // 679
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x38000000, 0xe4000000, 0x86000000, 0xfb000000,
+        0x94800000, 0x26400000, 0x20a00000, 0xef500000, 0x01180000, 0x39140000, 0x69be0000, 0xba470000,
+        0xe2a08000, 0x2252c000, 0x8699a000, 0x57d1f000, 0x0d5ef800, 0x08b79400, 0x636e6a00, 0xa89b6100,
+        0xd0d5e880, 0x4bd9fdc0, 0xbbf7ca20, 0xf04a9130, 0x970b1098, 0xaa2e69f4, 0xd2b9a02e, 0x8ec1f009
+      },
+      { // 680
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x58000000, 0x7c000000, 0xbe000000, 0xa3000000,
+        0x6a800000, 0xa1400000, 0x3ca00000, 0x72f00000, 0x6ee80000, 0x1bb40000, 0x864e0000, 0xd3450000,
+        0xb9a78000, 0xe773c000, 0x2b2a6000, 0x7d533000, 0xde98f800, 0xd01ba400, 0x535b9200, 0x62fb7100,
+        0xb18ffd80, 0x30a72240, 0x74f1f220, 0xa1e84130, 0xa7370588, 0xa00c864c, 0x47626036, 0x7717302f
+      },
+      { // 681
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x68000000, 0xdc000000, 0x96000000, 0x29000000,
+        0x4a800000, 0xe4400000, 0x24200000, 0x5d700000, 0x0c580000, 0xe5340000, 0x7e7e0000, 0xf1470000,
+        0xe8a08000, 0x98304000, 0x6ef86000, 0xa203f000, 0xa301a800, 0x9585e400, 0x57c0ea00, 0xe2e03500,
+        0x41132980, 0xe30df3c0, 0x9d188a20, 0xdd93c530, 0x8e4a8198, 0x43bc17f4, 0xdca6603a, 0x1234f007
+      },
+      { // 682
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x88000000, 0xf4000000, 0x12000000, 0xe3000000,
+        0xe7800000, 0xbcc00000, 0xa0200000, 0x12d00000, 0x74b80000, 0x92140000, 0x929e0000, 0xe1c70000,
+        0x9aa18000, 0x54974000, 0xf2d82000, 0xf6a0d000, 0x0a96b800, 0x1fdcac00, 0xe4217e00, 0x28d07d00,
+        0xf3b9d080, 0x1f95b4c0, 0xb1595e20, 0x4060ad30, 0xc5b76898, 0x848d18fc, 0x295e2002, 0x0c63d00d
+      },
+      { // 683
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x68000000, 0x4c000000, 0x8a000000, 0x91000000,
+        0x63800000, 0x5cc00000, 0xc0e00000, 0x49100000, 0xb4d80000, 0xd1d40000, 0xc23a0000, 0x8bc70000,
+        0xf8638000, 0x87504000, 0x7b7be000, 0x6ce31000, 0xb314e800, 0x2ddc4c00, 0xce53ee00, 0x7cfc5b00,
+        0x9625ce80, 0x58f471c0, 0xfe480e20, 0x09cf4b10, 0xbb092698, 0x4cec3dcc, 0x4d79e03a, 0x3fe01003
+      },
+      { // 684
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x58000000, 0x14000000, 0xc2000000, 0x39000000,
+        0xa1800000, 0xdc400000, 0xc6e00000, 0x64d00000, 0x82980000, 0x0a940000, 0x757a0000, 0x63c30000,
+        0xeda28000, 0x0cb5c000, 0x70882000, 0x5228d000, 0xb41f6800, 0x28521c00, 0x9d5aaa00, 0xd9327b00,
+        0x3ecd2480, 0x15cd53c0, 0x754a8a20, 0xec8eab10, 0x7c284cb8, 0xab1c4fc4, 0x3ad2a036, 0x95991015
+      },
+      { // 685
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0xa8000000, 0xa4000000, 0xc6000000, 0x51000000,
+        0x16800000, 0x1c400000, 0x8c600000, 0xa7100000, 0xb8080000, 0x69540000, 0xcb6e0000, 0x0dc50000,
+        0x8fa78000, 0x0db44000, 0xdd3ca000, 0xc52f7000, 0x5ea5a800, 0xdb318400, 0xe17aea00, 0x794c1700,
+        0x51b7ba80, 0xc73db340, 0x4e2e4a20, 0xe3276730, 0x4af41288, 0x54dd374c, 0xcffd200a, 0x990a3019
+      },
+      { // 686
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x68000000, 0x8c000000, 0xba000000, 0x39000000,
+        0x09800000, 0xe1c00000, 0x47a00000, 0x0f300000, 0x9e080000, 0xc8f40000, 0xa2ae0000, 0x43430000,
+        0x3ae38000, 0x4ad44000, 0xd659e000, 0xf3ea9000, 0x2ca7a800, 0x73b49c00, 0x2c4c4600, 0xe790b100,
+        0x8bbe5780, 0xbfbc7d40, 0x91bda620, 0x16be2130, 0xa03fffb8, 0xa37fe16c, 0xb99c603a, 0xa349d013
+      },
+      { // 687
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0xb8000000, 0xec000000, 0x16000000, 0x0b000000,
+        0x96800000, 0x38400000, 0x66a00000, 0xe1100000, 0xe9880000, 0x1b540000, 0x3e2a0000, 0x91c30000,
+        0xa2648000, 0xfaf2c000, 0xcfb9e000, 0x13097000, 0x75113800, 0xb3890400, 0x36541a00, 0xcbaec100,
+        0x6b076a80, 0x06872940, 0x6045fa20, 0x5aa3b110, 0x4f1452b8, 0x0e892d74, 0x9bd7600e, 0x0d68b02b
+      },
+      { // 688
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x08000000, 0xf4000000, 0x6a000000, 0x87000000,
+        0x3c800000, 0x0c400000, 0x85200000, 0xe5500000, 0x93480000, 0xaf140000, 0x276a0000, 0x1fc70000,
+        0x71e28000, 0x7e334000, 0x983f2000, 0x738f1000, 0x0e759800, 0xc31bb400, 0x1bdbda00, 0x36bb0d00,
+        0x54cda880, 0x41d1c340, 0x230cfa20, 0xd4301d10, 0x3f3a3098, 0x3f097744, 0x1a37a022, 0xba3b502d
+      },
+      { // 689
+        0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0xd8000000, 0x9c000000, 0x26000000, 0x91000000,
+        0xf9800000, 0x92c00000, 0xf1a00000, 0xafd00000, 0x42a80000, 0xcf140000, 0xf00a0000, 0x8a430000,
+        0x02e58000, 0xb0b1c000, 0xcadb6000, 0x6b6bf000, 0x18366800, 0x019bfc00, 0x180c9e00, 0x6e470100,
+        0xa8e6c880, 0x2fb0c840, 0xe65ffe20, 0xba28f110, 0xcc52a0b8, 0x376c347c, 0x9e34e016, 0x80993037
+      },
+      { // 690
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x68000000, 0xa4000000, 0x92000000, 0xa1000000,
+        0x5d800000, 0x32400000, 0xaba00000, 0xa6f00000, 0x5a880000, 0x31b40000, 0xeeaa0000, 0x4c050000,
+        0x76068000, 0x13024000, 0x6c81a000, 0x07c7d000, 0x3de02800, 0x9f567c00, 0x5d7c9a00, 0x36bbb100,
+        0xed5aa580, 0x09088940, 0x9cf73a20, 0x3f896110, 0x4e340d88, 0x85e8b564, 0x7620003a, 0xd4b00039
+      },
+      { // 691
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x48000000, 0xd4000000, 0x0a000000, 0xaf000000,
+        0x72800000, 0xe7c00000, 0xfaa00000, 0xa7700000, 0x39880000, 0x2bb40000, 0x33ae0000, 0x30050000,
+        0x18028000, 0xbc034000, 0x4e022000, 0xed021000, 0x0983d800, 0x9f43c400, 0xb2624600, 0x2f544100,
+        0x793a0580, 0xe89a1940, 0xbf6e6620, 0x3a235130, 0x03b35d88, 0x97ae9d64, 0xc2000032, 0xbb000005
+      },
+      { // 692
+        0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0x38000000, 0xd4000000, 0x42000000, 0x9f000000,
+        0x1f800000, 0x6b400000, 0x71200000, 0xd8700000, 0x42680000, 0x40340000, 0xfaca0000, 0x8e010000,
+        0x79038000, 0x5a84c000, 0x0fc72000, 0x7fe3d000, 0x89125800, 0xb6baec00, 0x2e6ba200, 0x96357500,
+        0x87ca9980, 0x3e811a40, 0x35c68220, 0x94e7a510, 0xe49341a8, 0x7afb364c, 0x94c8002e, 0x67040025
+      },
+      { // 693
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x08000000, 0xfc000000, 0x9e000000, 0x19000000,
+        0xd4800000, 0x95c00000, 0x19e00000, 0x9ad00000, 0x20280000, 0xe8140000, 0xa44a0000, 0xdb830000,
+        0xe4428000, 0x26a74000, 0x1ff76000, 0x7f9cb000, 0x3b2b2800, 0xeb945400, 0x14096600, 0x6f25eb00,
+        0x64b2b880, 0x60b96e40, 0x079c0620, 0x9f2e5b10, 0x619110b8, 0x7f097a44, 0x34a08022, 0xc0f0402f
+      },
+      { // 694
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0xd8000000, 0x7c000000, 0xd6000000, 0x37000000,
+        0x31800000, 0x80400000, 0x15a00000, 0x70300000, 0x34f80000, 0xa9740000, 0x2bde0000, 0xd6850000,
+        0x89c28000, 0x59e7c000, 0xfb976000, 0xd7c87000, 0x060e5800, 0xe3ed3c00, 0xee7eba00, 0x9eb6a100,
+        0x713ac380, 0x6e95aac0, 0x434fda20, 0x9acfd130, 0xee881b88, 0xa92a56e4, 0xd41c8016, 0xe862c02f
+      },
+      { // 695
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xe8000000, 0x24000000, 0x82000000, 0xa7000000,
+        0x8c800000, 0x18400000, 0xc4a00000, 0x26900000, 0xcbd80000, 0xa3d40000, 0xc8fe0000, 0x47830000,
+        0x02c68000, 0xe1e04000, 0x15b1a000, 0x378b5000, 0xb5e81800, 0x209a7400, 0x51f0fa00, 0x7d2bc100,
+        0x727d3680, 0x52c49bc0, 0x29e75a20, 0xc1b79130, 0x4d8daeb8, 0xdeedafc4, 0x0a18801a, 0x6cb34039
+      },
+      { // 696
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x28000000, 0xec000000, 0x8a000000, 0x9d000000,
+        0x11800000, 0x4fc00000, 0xc7a00000, 0x90d00000, 0x23b80000, 0xf4140000, 0x2a9e0000, 0xfb850000,
+        0xa2c28000, 0x4e204000, 0x8b13e000, 0xaa1d1000, 0x9fc78800, 0x0fa2dc00, 0xccd79600, 0x11ba3100,
+        0xad13b880, 0x5d1e40c0, 0xa3427620, 0xe9e62130, 0x80b0b088, 0x20cddce4, 0x097a802a, 0x0634400b
+      },
+      { // 697
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x68000000, 0x34000000, 0x9e000000, 0xd3000000,
+        0x3e800000, 0x52c00000, 0x47a00000, 0x73f00000, 0x9f880000, 0xf0340000, 0x3faa0000, 0x52830000,
+        0x20c28000, 0xa6a44000, 0x4c712000, 0xe2cfb000, 0xa2d33800, 0x2abf0400, 0x461f0e00, 0x176d4900,
+        0x90234980, 0x7ab2e140, 0xb36c2e20, 0x2625f910, 0x7db0f1b8, 0x03eea544, 0xcfe2803a, 0x3094401d
+      },
+      { // 698
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0xc8000000, 0x8c000000, 0xfa000000, 0x61000000,
+        0xae800000, 0xd0400000, 0xeb600000, 0x42100000, 0xdee80000, 0xbcd40000, 0xa5ca0000, 0xf5a30000,
+        0xe9348000, 0x5f994000, 0x7c2ee000, 0xf5f79000, 0x01ba6800, 0xeddf2400, 0xf24b4a00, 0x8f610f00,
+        0x4414a280, 0xbdeab440, 0xe7512a20, 0x650fdf10, 0xd9802ab8, 0x75c20074, 0xdca00812, 0x8bb1f433
+      },
+      { // 699
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xa8000000, 0xdc000000, 0x32000000, 0xf7000000,
+        0x2b800000, 0x51400000, 0xe0600000, 0x6a700000, 0x68b80000, 0x18b40000, 0x759e0000, 0x28a50000,
+        0xec538000, 0xe92c4000, 0xfb3f6000, 0x4df6d000, 0xf3fe5800, 0xebd04c00, 0xc26bf200, 0xa058ff00,
+        0x26012980, 0x49002ec0, 0xd6871220, 0x49c26f30, 0xdca01188, 0xc256b2ec, 0x0c2ab80a, 0x97bedc07
+      },
+      { // 700
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x18000000, 0xa4000000, 0xba000000, 0xf9000000,
+        0x32800000, 0xddc00000, 0xbb600000, 0x6e100000, 0x56b80000, 0x65540000, 0x2a1e0000, 0xd9270000,
+        0xc8318000, 0x8b0bc000, 0x221ea000, 0x55271000, 0xae37e800, 0x9c08c400, 0x4b9a6600, 0xe763af00,
+        0x40106e80, 0x6db9f6c0, 0xfad54620, 0x675f7f30, 0xe2812698, 0x95c222fc, 0x9766c826, 0x98131419
+      },
+      { // 701
+        0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xf8000000, 0xc4000000, 0x6e000000, 0x17000000,
+        0x1d800000, 0x22c00000, 0xd9e00000, 0x9d300000, 0x7c180000, 0x06740000, 0xd93a0000, 0x4da30000,
+        0x91918000, 0x8308c000, 0x4439a000, 0xf922b000, 0xd1d39800, 0x29af1c00, 0x7029ee00, 0x7ce9c300,
+        0x5209af80, 0xa2bc67c0, 0x0461ce20, 0x1ff3b310, 0x35fb97b8, 0x1345cbdc, 0x9921b81e, 0xe1d66c21
+      },
+      { // 702
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x78000000, 0x14000000, 0x7a000000, 0x81000000,
+        0x61800000, 0xe7c00000, 0x45200000, 0x32100000, 0x8cb80000, 0xf0540000, 0xfc5e0000, 0x7a610000,
+        0x85738000, 0x764ec000, 0x42d92000, 0xbf221000, 0x7317a800, 0x4d385c00, 0xa7917600, 0xc17c4500,
+        0x5c74de80, 0x73ca14c0, 0x071bd620, 0xdf009530, 0x228256a8, 0xb34458ec, 0x0963083e, 0x69f58c35
+      },
+      { // 703
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x68000000, 0xa4000000, 0x22000000, 0x9f000000,
+        0xff800000, 0x63c00000, 0x29e00000, 0x4b500000, 0xed280000, 0x7b140000, 0x310e0000, 0x1ca50000,
+        0xcbf18000, 0xf8da4000, 0xd2cea000, 0xf5405000, 0xa0a6d800, 0xe5f06c00, 0xc1db2600, 0x604cd300,
+        0x9e077480, 0xb104ce40, 0xc6840620, 0xd146c330, 0x42a70c88, 0x5af0f27c, 0xce5ff83a, 0x6b8b7c19
+      },
+      { // 704
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x18000000, 0x64000000, 0xea000000, 0x47000000,
+        0xb1800000, 0x28c00000, 0x29a00000, 0x51f00000, 0xa1180000, 0xe2b40000, 0xc77a0000, 0x9b670000,
+        0xd7548000, 0x8d6bc000, 0x2d69a000, 0xdd699000, 0x756c1800, 0xd9695c00, 0x4f683e00, 0x866ca100,
+        0x9aecf980, 0x44a94dc0, 0xf44d1e20, 0xa4daf110, 0x7d934198, 0x6fce81f4, 0xeb1db826, 0x55b4cc09
+      },
+      { // 705
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x98000000, 0x6c000000, 0x8a000000, 0xc5000000,
+        0x24800000, 0x4cc00000, 0xcda00000, 0x1d900000, 0x86880000, 0x8fd40000, 0x1aea0000, 0xb7610000,
+        0xb7358000, 0x2e99c000, 0x7718e000, 0xc35e9000, 0xf03e4800, 0x7909f400, 0xd4940e00, 0x38086900,
+        0xce17fa80, 0xf7ca0140, 0x98316e20, 0xdf1b3910, 0xd75b52a8, 0x463c657c, 0x5e0ea806, 0xc113640b
+      },
+      { // 706
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x68000000, 0xac000000, 0xc2000000, 0x7f000000,
+        0x83800000, 0xc8c00000, 0x62e00000, 0xf7b00000, 0x33480000, 0xe2f40000, 0x9c6e0000, 0xef210000,
+        0x6dd68000, 0x41be4000, 0xd699e000, 0x7f4f5000, 0x50f19800, 0x3b698c00, 0xb8a77e00, 0xa317ab00,
+        0x325ccb80, 0x1fae8540, 0x78401e20, 0x9ba2bb30, 0xfa92b3a8, 0xf19d5944, 0xe8ce783a, 0x3e33dc1b
+      },
+      { // 707
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x08000000, 0x14000000, 0xae000000, 0x8d000000,
+        0x79800000, 0x2a400000, 0x6ce00000, 0x2b900000, 0x93680000, 0xba540000, 0x1ace0000, 0x8ba10000,
+        0x5ef28000, 0xa2bd4000, 0xddd82000, 0x970f3000, 0xb803c800, 0x4c013c00, 0x1204fa00, 0xa704cb00,
+        0x52859e80, 0xcac64440, 0x91265a20, 0xe032bb30, 0xad9876a8, 0x28ed4864, 0x5f15e822, 0x00af0c35
+      },
+      { // 708
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0xd8000000, 0x14000000, 0xde000000, 0xdb000000,
+        0x32800000, 0xfec00000, 0x90a00000, 0x4c500000, 0x4bd80000, 0xfb140000, 0x473e0000, 0x21250000,
+        0x54128000, 0xdbbfc000, 0x6ce02000, 0xaa363000, 0x7b2f7800, 0xa69fe400, 0x2af5ee00, 0x608ab100,
+        0x204ae480, 0x1be843c0, 0x0d394e20, 0xe4264130, 0x9d973c88, 0x87fe57e4, 0xda83f816, 0x62c52435
+      },
+      { // 709
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x78000000, 0xac000000, 0x4a000000, 0x05000000,
+        0x52800000, 0xd9400000, 0x79200000, 0x0fb00000, 0xaf880000, 0x99740000, 0x616e0000, 0x54a50000,
+        0x19758000, 0xa16ac000, 0x74a2e000, 0x69779000, 0xd96c4800, 0xd8a74400, 0x23732200, 0xdc6d3d00,
+        0x8a236780, 0xfa335d40, 0xa54a4220, 0x85956d30, 0x55b84f88, 0x3c39495c, 0xe4ffc83e, 0x011c841b
+      },
+      { // 710
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x88000000, 0x14000000, 0xba000000, 0xe9000000,
+        0x46800000, 0x86400000, 0x45a00000, 0x17d00000, 0x27980000, 0xc6140000, 0x1efe0000, 0x6c230000,
+        0x80178000, 0xa9fb4000, 0x11a52000, 0x8dd79000, 0x1e98e800, 0x38926400, 0x04b93a00, 0x8783b900,
+        0xc4c6dc80, 0x21e719c0, 0x17759a20, 0x50cc6930, 0x20cc94b8, 0x88c9adcc, 0x4cc96802, 0x4ece2435
+      },
+      { // 711
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x08000000, 0x14000000, 0x76000000, 0x83000000,
+        0x05800000, 0xe2c00000, 0x11a00000, 0xf2f00000, 0x0c780000, 0x72b40000, 0x149e0000, 0xcc250000,
+        0xcc348000, 0x5fd94000, 0x25462000, 0x9665f000, 0x4dd5b800, 0x5dc91c00, 0xf3af4e00, 0x127a0100,
+        0x55b03180, 0x1f1976c0, 0xe1e3ee20, 0xb213b130, 0xaeef2988, 0xc818dad4, 0x72613822, 0xa3d05c35
+      },
+      { // 712
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x18000000, 0x44000000, 0x9e000000, 0xd9000000,
+        0xc2800000, 0x77c00000, 0x1be00000, 0x6e100000, 0xb6380000, 0x1e540000, 0xe29e0000, 0x0b630000,
+        0x92d38000, 0x245fc000, 0x6e03a000, 0xe1023000, 0xd683e800, 0x41c76400, 0x9ee5b600, 0x7694eb00,
+        0x86fc3e80, 0x1e37a6c0, 0x39cb9620, 0xd17a1b30, 0xf977f6b8, 0x1ee932ec, 0xcd086826, 0x8f1ca421
+      },
+      { // 713
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x68000000, 0x14000000, 0xbe000000, 0x65000000,
+        0x6d800000, 0x53c00000, 0x8d200000, 0xc1500000, 0x86880000, 0xbc140000, 0x6cea0000, 0x44250000,
+        0x5ed18000, 0x524a4000, 0xe3b72000, 0x20fcb000, 0x00ce8800, 0x2ef31c00, 0xc299f600, 0xbcf92500,
+        0xbacfa480, 0xcdf79540, 0xc61d5620, 0x40bed510, 0xab2d8c88, 0x3707795c, 0xda84883a, 0xc9461c15
+      },
+      { // 714
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x68000000, 0x3c000000, 0x6a000000, 0x83000000,
+        0x5d800000, 0xae400000, 0xd2a00000, 0xe8900000, 0x84880000, 0xae540000, 0xbcee0000, 0x6ca30000,
+        0xfd978000, 0xd00c4000, 0xee946000, 0xf58e1000, 0xc4d6f800, 0x292e3c00, 0x91412a00, 0x25221900,
+        0x25d52680, 0x3baec940, 0x8084ca20, 0xd6c74930, 0x40663eb8, 0x46f5a54c, 0x4f7ef83a, 0x01aa3c3f
+      },
+      { // 715
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x68000000, 0x6c000000, 0xe6000000, 0x21000000,
+        0xe0800000, 0x77c00000, 0x34e00000, 0x81f00000, 0x6a180000, 0x25b40000, 0x5abe0000, 0x24e30000,
+        0x29f28000, 0xe61c4000, 0x53b3e000, 0x13ba7000, 0xa8616800, 0xb832b400, 0xf3fef600, 0x32c54300,
+        0x0e65c180, 0xb9379fc0, 0x63799620, 0xbd047330, 0x3e83c9b8, 0xb2c41be4, 0xce61683a, 0x5932b42b
+      },
+      { // 716
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xf8000000, 0x74000000, 0x6a000000, 0x9d000000,
+        0xdf800000, 0x58400000, 0x85a00000, 0xff500000, 0x5f280000, 0x8af40000, 0x287a0000, 0x69df0000,
+        0x148c8000, 0x3aa2c000, 0x21d02000, 0x5eed1000, 0x84160800, 0x820bcc00, 0xa761da00, 0xa935e900,
+        0x279bec80, 0x9a2fca40, 0x5177d220, 0xd23e2510, 0xad7a3698, 0xd25a2354, 0xbecc3e9e, 0x0601ef4d
+      },
+      { // 717
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0xe8000000, 0x44000000, 0xaa000000, 0xad000000,
+        0xc4800000, 0xc0400000, 0x30e00000, 0x17b00000, 0x99180000, 0xe3540000, 0xe4ae0000, 0xf74d0000,
+        0x337d8000, 0x3ba44000, 0xb0d2a000, 0xb56c9000, 0xbf6b8800, 0x226c1400, 0x2eef1a00, 0x5aab1b00,
+        0x284e3380, 0xd6fc89c0, 0x21649220, 0xaf770f30, 0xbfb92988, 0x9f0392fc, 0x0584a19a, 0xcac686e1
+      },
+      { // 718
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xd8000000, 0x24000000, 0xaa000000, 0x45000000,
+        0xee800000, 0xc4c00000, 0x0c600000, 0xe1100000, 0x35880000, 0x79740000, 0xc69a0000, 0x7dfd0000,
+        0x536d8000, 0xc6a1c000, 0x4271a000, 0x5f191000, 0x16ba4800, 0xaf4bc400, 0x72177e00, 0x5008ef00,
+        0x9c343280, 0xd5befd40, 0x62cd3620, 0x6b532b10, 0xcd2b4c88, 0x6c02125c, 0x46030496, 0x4300d659
+      },
+      { // 719
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x38000000, 0x0c000000, 0x82000000, 0xcf000000,
+        0x98800000, 0xffc00000, 0x0be00000, 0xf0500000, 0x05580000, 0x87b40000, 0xdf0e0000, 0xd9e90000,
+        0x1e388000, 0x8c26c000, 0x97b1e000, 0x870a5000, 0x25e95800, 0xf43b7400, 0x7722f600, 0x81377300,
+        0x35cc8080, 0x798c6fc0, 0x632bae20, 0x865c0730, 0xfd3676a8, 0x1fcf1cd4, 0x22892eae, 0x25a968f3
+      },
+      { // 720
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x38000000, 0xdc000000, 0x76000000, 0xef000000,
+        0x6e800000, 0xd5c00000, 0xe6e00000, 0x1b100000, 0x0cd80000, 0xc9f40000, 0xd5ca0000, 0xa82d0000,
+        0x3fbf8000, 0xbba6c000, 0x8f346000, 0x5baaf000, 0x91fdd800, 0x5701e400, 0xf2878600, 0x83c00b00,
+        0x39e23a80, 0x4d95abc0, 0x051a5e20, 0x5911ef10, 0x21ddbc88, 0xca71a0cc, 0x238a64ae, 0x888d44e7
+      },
+      { // 721
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0xa8000000, 0x7c000000, 0x2e000000, 0x51000000,
+        0x19800000, 0x7b400000, 0x42600000, 0x6f500000, 0xddd80000, 0x83340000, 0xa38a0000, 0xe7690000,
+        0x8bf88000, 0xae864000, 0x7fc26000, 0xd6a7b000, 0x0372a800, 0x136f1c00, 0x49ffc200, 0xd9872700,
+        0x9b45e480, 0x32646bc0, 0x17556a20, 0x09dc3b10, 0xd13026a8, 0xdc8a4cf4, 0xafe80e8a, 0xe93e10cf
+      },
+      { // 722
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0xe8000000, 0x04000000, 0x96000000, 0xcd000000,
+        0xb1800000, 0xdcc00000, 0xe8600000, 0x01d00000, 0xab080000, 0xafb40000, 0x3fde0000, 0x793d0000,
+        0xaea98000, 0x1d844000, 0xaec4a000, 0xe3617000, 0xe5528800, 0x2a4e5c00, 0x09101e00, 0x8d6e1700,
+        0xaf600c80, 0xc754f140, 0xb94a9620, 0x01944b30, 0x9e2e1288, 0x52c7e65c, 0x09631a9a, 0x0254fa71
+      },
+      { // 723
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x78000000, 0xb4000000, 0x2a000000, 0x0b000000,
+        0x68800000, 0x82400000, 0xe5200000, 0x76900000, 0xa2c80000, 0xf5b40000, 0x815e0000, 0xbef90000,
+        0x852a8000, 0x4844c000, 0x9e262000, 0xd6171000, 0xfc8eb800, 0xf6907400, 0x62ceba00, 0x55b46500,
+        0x915a3a80, 0xc6ffa940, 0x31280220, 0x62401130, 0x952280a8, 0xbe96cc44, 0x7eceb8be, 0x13b6785d
+      },
+      { // 724
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x88000000, 0xb4000000, 0x86000000, 0x29000000,
+        0xf9800000, 0xb7c00000, 0xe5200000, 0x63f00000, 0x25580000, 0x7fd40000, 0x172a0000, 0x294f0000,
+        0x93de8000, 0x48914000, 0x544c2000, 0xbc5ff000, 0x3e562800, 0xeceb1c00, 0x666ae600, 0x632f5d00,
+        0x8f4cc580, 0xcad861c0, 0x2916ce20, 0xdf8b4110, 0x6b78a398, 0xf2a67cc4, 0x19362b82, 0x57fcd0fd
+      },
+      { // 725
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x88000000, 0x34000000, 0x36000000, 0xa9000000,
+        0xef800000, 0x4a400000, 0x2aa00000, 0x87300000, 0x21a80000, 0xb4940000, 0x111a0000, 0xc3790000,
+        0x1d2a8000, 0x42574000, 0x8d7a2000, 0x78287000, 0x17d22800, 0x743c2c00, 0x9e0a8a00, 0x9e241100,
+        0x45f6bf80, 0x8bcce640, 0xa6c2a220, 0xf4613d10, 0xbf56b5a8, 0x24ffb764, 0x236e3d82, 0xfef5ab5d
+      },
+      { // 726
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xa8000000, 0xe4000000, 0xc6000000, 0x41000000,
+        0x84800000, 0xfcc00000, 0x1da00000, 0x04b00000, 0x28e80000, 0xd0140000, 0xfcda0000, 0xca390000,
+        0x64698000, 0xd8d64000, 0xdf7fa000, 0x338df000, 0x4201e800, 0x97077400, 0x3d867e00, 0xc4423100,
+        0x6b638f80, 0x7a137840, 0x2fdd9620, 0xc1bc4510, 0x492c71a8, 0xd337097c, 0x9fa9b98a, 0x40f6cd69
+      },
+      { // 727
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x98000000, 0x44000000, 0x9e000000, 0xc1000000,
+        0xbc800000, 0xf7c00000, 0xf9a00000, 0xd9300000, 0x5c480000, 0xe5940000, 0xc7fe0000, 0xdf190000,
+        0x0f4d8000, 0xea13c000, 0xafbea000, 0x86feb000, 0xa39d6800, 0x5888f400, 0xe3b7e600, 0xee889100,
+        0x9eb2fb80, 0xd80ce540, 0x5e748e20, 0x80296530, 0x16009da8, 0x8d03b47c, 0xae86d586, 0x84c23061
+      },
+      { // 728
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x88000000, 0x0c000000, 0x36000000, 0x4d000000,
+        0x48800000, 0xdbc00000, 0xe0e00000, 0xf7500000, 0xe5780000, 0xc6b40000, 0xf4aa0000, 0x61090000,
+        0xd8798000, 0x46374000, 0x8368e000, 0x47eb7000, 0xea2fc800, 0xe7ccd400, 0xa819e600, 0x1ea65b00,
+        0x34f5e880, 0x010ba6c0, 0xc87c2e20, 0x9e338f10, 0xf76d8ea8, 0xf5eebdfc, 0x9d2b2682, 0xd44a59d3
+      },
+      { // 729
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x18000000, 0xf4000000, 0x06000000, 0xc9000000,
+        0xcd800000, 0xd5c00000, 0x33200000, 0x66900000, 0x98b80000, 0xe0b40000, 0xa9ae0000, 0x2ec90000,
+        0x3cbf8000, 0x2eb7c000, 0x9ca92000, 0xb94c7000, 0xca7ea800, 0xeb163c00, 0x2d79f600, 0xc395cd00,
+        0x67395e80, 0x5a73cec0, 0x2e095e20, 0x481af130, 0xb6e728a8, 0x9db5c3ec, 0x022f20a6, 0x22084fcd
+      },
+      { // 730
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x78000000, 0x3c000000, 0xbe000000, 0xad000000,
+        0x56800000, 0x93c00000, 0x35e00000, 0xf4700000, 0x64e80000, 0x32940000, 0x9b1e0000, 0x8b3f0000,
+        0x03ab8000, 0x17b2c000, 0x890d6000, 0xaae0b000, 0x09f0c800, 0x50ae6400, 0x4c306600, 0x1c4e4300,
+        0x44c20180, 0x8c66d240, 0x4236ae20, 0x094b2730, 0x4e47e798, 0x91a5514c, 0xa2d24fbe, 0x97bf857f
+      },
+      { // 731
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x28000000, 0xc4000000, 0x36000000, 0x01000000,
+        0x05800000, 0x67c00000, 0xefa00000, 0xb8f00000, 0xd3380000, 0xc8540000, 0xeb4a0000, 0x2f2f0000,
+        0xfa7c8000, 0xbeb44000, 0x1d5da000, 0x86057000, 0x3907e800, 0x8985fc00, 0xc5c62600, 0xf0a7a900,
+        0x7870fd80, 0x877b46c0, 0x4133ce20, 0xb9995510, 0x23205b98, 0x0eb7afd4, 0x255a13aa, 0x0a0723e1
+      },
+      { // 732
+        0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xd8000000, 0x3c000000, 0x8a000000, 0xdd000000,
+        0xd8800000, 0xe5400000, 0x2d600000, 0xb1100000, 0xd2080000, 0xb3740000, 0x8a9e0000, 0x1ebb0000,
+        0x38cd8000, 0xbed3c000, 0xcb2f6000, 0x45861000, 0x1dc04800, 0xd822b400, 0xb473f200, 0x871bd700,
+        0xd77f6e80, 0x6ee84540, 0x91a5ba20, 0x1bb66330, 0x4e3f1cb8, 0xe98b527c, 0xedb03496, 0x393ff67f
+      },
+      { // 733
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xd8000000, 0xbc000000, 0x26000000, 0x9d000000,
+        0xf1800000, 0x5dc00000, 0x29e00000, 0x4ff00000, 0xd3b80000, 0xe1140000, 0x16ce0000, 0x63ef0000,
+        0xa27c8000, 0x96f7c000, 0xc83e6000, 0x6fd67000, 0xe7af4800, 0xc25a9c00, 0x02e65600, 0x5b70db00,
+        0x73fb9580, 0xbb37c0c0, 0x89df1e20, 0x94214730, 0x76174398, 0x244bdbf4, 0x5ea86b96, 0x09d837df
+      },
+      { // 734
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0x18000000, 0x24000000, 0x96000000, 0x01000000,
+        0x43800000, 0x71400000, 0x81e00000, 0x44b00000, 0x15180000, 0xd6540000, 0xd52a0000, 0xf88f0000,
+        0xfc5d8000, 0x33b5c000, 0x679ba000, 0x9c90f000, 0x71886800, 0xb3d84c00, 0x88f39200, 0x257b6b00,
+        0x14a61b80, 0x7350c1c0, 0x40a9fa20, 0xe8c82710, 0x4e3a0998, 0x1e456adc, 0xd763c1a6, 0x9872d6d9
+      },
+      { // 735
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0xf8000000, 0x94000000, 0x5e000000, 0x0f000000,
+        0xc0800000, 0x8a400000, 0x87a00000, 0x19300000, 0x7e380000, 0xeb940000, 0x6e8e0000, 0x14690000,
+        0x1e7d8000, 0x0d30c000, 0xe0382000, 0x4493b000, 0x5e0a9800, 0x662e9400, 0x0ddffa00, 0x4a007100,
+        0x9102c780, 0x6f822ac0, 0xbac36220, 0xf5e3e530, 0x0a96bda8, 0x390f9bfc, 0x9aaa059e, 0x459bbfd5
+      },
+      { // 736
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xf8000000, 0xb4000000, 0x76000000, 0x71000000,
+        0xaa800000, 0x2f400000, 0xcf200000, 0x31f00000, 0x4de80000, 0x84540000, 0x1b5a0000, 0xea990000,
+        0x9cf98000, 0x432cc000, 0x9db12000, 0x374cf000, 0xa5676800, 0x62510400, 0x825e2200, 0x5c1d3500,
+        0x79bc5980, 0xc70d1040, 0xb5c0ca20, 0xf860f110, 0x1ad35ba8, 0x021cd57c, 0xf4bbfb9e, 0xf78ce57d
+      },
+      { // 737
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x38000000, 0x24000000, 0x52000000, 0x93000000,
+        0x2c800000, 0xd2400000, 0xf6e00000, 0x88700000, 0xeab80000, 0x5a140000, 0xec8a0000, 0x504f0000,
+        0x4feb8000, 0xd1fcc000, 0x9f71a000, 0x043fd000, 0xf356f800, 0x9aec9400, 0x447f7a00, 0xb6b27b00,
+        0xee1d7d80, 0xf4802cc0, 0x06420220, 0xfce22f10, 0x8f73a798, 0xac3d87ec, 0x3f5187ae, 0x64ea97d9
+      },
+      { // 738
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xa8000000, 0xcc000000, 0xaa000000, 0x89000000,
+        0x68800000, 0x54c00000, 0xbee00000, 0xa8b00000, 0x66280000, 0x82d40000, 0x585e0000, 0xff1b0000,
+        0x00bf8000, 0xb4a84000, 0x6716e000, 0xba3c9000, 0x7d69e800, 0x9f72b400, 0x19499e00, 0x46274b00,
+        0xcc537f80, 0x0f9f4c40, 0xf07ff620, 0x8c4dbf30, 0x5ca401b8, 0x9590976c, 0x0ffb618a, 0x870b4743
+      },
+      { // 739
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x18000000, 0xf4000000, 0x9a000000, 0xcd000000,
+        0xc3800000, 0x34c00000, 0x8ae00000, 0x6af00000, 0x83380000, 0x27940000, 0x2f0e0000, 0xbf4d0000,
+        0x47ee8000, 0x9cbbc000, 0x35502000, 0x3eef9000, 0x25388800, 0x7c932c00, 0xff8b7e00, 0x970ed300,
+        0x1b481580, 0xe5edfcc0, 0x35bd7620, 0x74d63f30, 0x332b4b88, 0xf658bfe4, 0xefa3eba6, 0x35d5efcd
+      },
+      { // 740
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x68000000, 0x54000000, 0xc6000000, 0xe1000000,
+        0x10800000, 0x96400000, 0x52600000, 0x7f500000, 0xcf080000, 0xe1b40000, 0x841e0000, 0xc3d90000,
+        0x87788000, 0xf40c4000, 0x12372000, 0xeddcf000, 0xf27d6800, 0x828fd400, 0x35736a00, 0xc7380f00,
+        0x4f6e3480, 0xd9e6b540, 0x4a968220, 0x9cab9b30, 0xfb427ea8, 0x88e64a54, 0x0213deba, 0xc6effa65
+      },
+      { // 741
+        0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x58000000, 0x84000000, 0x6e000000, 0x49000000,
+        0xc5800000, 0x0e400000, 0x30a00000, 0x2d700000, 0xf8380000, 0x34540000, 0xc90a0000, 0x4fcb0000,
+        0x9aa98000, 0x203bc000, 0xf052a000, 0x470b3000, 0xf6c82800, 0x072a3c00, 0xaa7eaa00, 0xaef43100,
+        0x237e4d80, 0xcb7032c0, 0x3d3f0220, 0x53d5cd10, 0xcc4a47b8, 0x41eb33fc, 0xdf1b67b6, 0x0460c3f1
+      },
+      { // 742
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x88000000, 0x2c000000, 0x62000000, 0x2d000000,
+        0x9f800000, 0xbf400000, 0x70600000, 0x12100000, 0x3ee80000, 0xbff40000, 0x6eba0000, 0x46f90000,
+        0xc01a8000, 0x8ccf4000, 0x2a06e000, 0xe104d000, 0xcd85c800, 0x8a464c00, 0x4be2a200, 0xe3546700,
+        0x018bee80, 0x1f661a40, 0x7095ea20, 0x36296b10, 0xccd5aca8, 0xe6cfad64, 0x6b014c82, 0xbc867d5b
+      },
+      { // 743
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xd8000000, 0x54000000, 0xba000000, 0x31000000,
+        0xe1800000, 0xba400000, 0x4a600000, 0x6f900000, 0x81880000, 0x16740000, 0x895a0000, 0x821d0000,
+        0x69fd8000, 0x9c29c000, 0x27c62000, 0x86239000, 0xdaf76800, 0xf49d3c00, 0x2539ea00, 0xda8da700,
+        0x2ef2fa80, 0x7e9d8940, 0xec3b0220, 0x1f0d5b10, 0xf6b73088, 0x51febe5c, 0xd82b1096, 0x15c02e45
+      },
+      { // 744
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xc8000000, 0xfc000000, 0xba000000, 0x95000000,
+        0x3b800000, 0x9b400000, 0xb3e00000, 0x62700000, 0x14d80000, 0x4c140000, 0x92ee0000, 0x1da90000,
+        0x184b8000, 0x3d394000, 0x4b616000, 0xd5b11000, 0x06f98800, 0x4b402c00, 0x2be20200, 0xc677db00,
+        0xaadeed80, 0x5716d7c0, 0x7a680a20, 0x926ab730, 0x9e6b8fa8, 0x4c6d1ccc, 0x156aef92, 0x5cec0ccf
+      },
+      { // 745
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x08000000, 0xfc000000, 0xee000000, 0x71000000,
+        0xaa800000, 0x34400000, 0xe8a00000, 0xe3100000, 0x10080000, 0x9b340000, 0x345a0000, 0xfe190000,
+        0x8fb88000, 0x4a2b4000, 0x58626000, 0xaef6b000, 0xc13fa800, 0x846f0400, 0xa3c4fa00, 0xa0660900,
+        0xcaf49680, 0x7b3e7b40, 0x376bd220, 0x9e464d10, 0xb3a00ca8, 0x5293c274, 0x35ca6ca2, 0x8651726f
+      },
+      { // 746
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x48000000, 0xbc000000, 0x66000000, 0xfd000000,
+        0x71800000, 0xdac00000, 0xf7600000, 0x93f00000, 0x47f80000, 0x78140000, 0x774a0000, 0xce4f0000,
+        0x1dce8000, 0xd80f4000, 0x21e86000, 0x765cf000, 0x4a85c800, 0x66469c00, 0x64262e00, 0x5a57cf00,
+        0xb16abd80, 0x8b1de6c0, 0xa2276620, 0x97511310, 0xf8ea7398, 0xb5d999c4, 0xc74073b2, 0x23a699ff
+      },
+      { // 747
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x38000000, 0xe4000000, 0xfa000000, 0x63000000,
+        0xbb800000, 0x9fc00000, 0xc4200000, 0x4ed00000, 0x8f780000, 0x22740000, 0x2dea0000, 0x9ae90000,
+        0xb36e8000, 0x33aac000, 0x420ca000, 0x321d9000, 0x45c67800, 0xf7236c00, 0x6d535600, 0xe4b95500,
+        0x24557c80, 0xe43a90c0, 0x5411ae20, 0x6dd9f910, 0x61e40aa8, 0x09f495c4, 0xca2e0aae, 0x1acd95e9
+      },
+      { // 748
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0xe8000000, 0xf4000000, 0x7e000000, 0x11000000,
+        0x1e800000, 0x01c00000, 0x87e00000, 0xf7100000, 0xf8280000, 0x6b740000, 0x5e7e0000, 0x1c790000,
+        0x17788000, 0x2ef84000, 0x84ba2000, 0x8a193000, 0x1e2de800, 0xf6766400, 0x82fa1600, 0xd6bcd300,
+        0x091c5a80, 0x23af9c40, 0x9a317e20, 0x815bf730, 0xd60ceca8, 0x8f863f54, 0xdf44ec9a, 0x26223f4d
+      },
+      { // 749
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xd8000000, 0xc4000000, 0x1a000000, 0x77000000,
+        0xa5800000, 0x94c00000, 0x7e200000, 0x6c700000, 0x55a80000, 0x54d40000, 0xea9e0000, 0xa89b0000,
+        0xdb9a8000, 0x841bc000, 0x77dba000, 0x747b9000, 0x48ced800, 0x79409c00, 0x36e6ae00, 0x2c52d500,
+        0x44d9e180, 0x0bff5e40, 0x4b0cf620, 0xb2e28930, 0x16566fb8, 0xc3d9db44, 0x667e6f96, 0xc3cddb41
+      },
+      { // 750
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xa8000000, 0x24000000, 0x1e000000, 0x69000000,
+        0xf6800000, 0xf2c00000, 0x14a00000, 0x0ab00000, 0x1ed80000, 0x2d940000, 0xda2e0000, 0xaa290000,
+        0x622b8000, 0xd62a4000, 0x502fa000, 0xb52b3000, 0x79a9a800, 0xfc6da400, 0x774ece00, 0x79be4900,
+        0x81012f80, 0xb28529c0, 0x7cc2e620, 0xe5a0ad30, 0x7033c1a8, 0xd61e10cc, 0x4e33c18a, 0x4f1e10f9
+      },
+      { // 751
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xb8000000, 0xec000000, 0x5a000000, 0x75000000,
+        0xcd800000, 0x41c00000, 0xece00000, 0x7a700000, 0xfbe80000, 0x58140000, 0x02da0000, 0xc65f0000,
+        0xe81e8000, 0xbc38c000, 0xad2ae000, 0xa0729000, 0xcee88800, 0xf5919c00, 0x531b5600, 0x92bdd300,
+        0x7e6f2980, 0x1dd56240, 0x803f5e20, 0x6f2f8f10, 0x49721f98, 0xf169e144, 0x95569f8e, 0xc47e216b
+      },
+      { // 752
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x68000000, 0x4c000000, 0x7a000000, 0x81000000,
+        0x92800000, 0xfc400000, 0xb9200000, 0xb3300000, 0x62c80000, 0xc7940000, 0xc83e0000, 0x29b90000,
+        0x9a798000, 0x8f9c4000, 0xaccee000, 0x08941000, 0x55bda800, 0xe87ce400, 0x92989a00, 0x5c48a500,
+        0x51d7d780, 0x4819b140, 0x5c0ab220, 0x5af50130, 0x462e2da8, 0xbe44445c, 0xac21adba, 0xdfb50463
+      },
+      { // 753
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xc8000000, 0x74000000, 0x26000000, 0xf3000000,
+        0x17800000, 0x32400000, 0xc5e00000, 0x35b00000, 0xb9f80000, 0xbed40000, 0x108e0000, 0x2e090000,
+        0xcaca8000, 0x4fe94000, 0xb17c2000, 0x6110f000, 0xf629f800, 0xc4ddec00, 0x2c405a00, 0xfae6db00,
+        0x08300b80, 0xf2baa6c0, 0x05b52220, 0xa1ff7730, 0xa2d0f1a8, 0x5288cdc4, 0x330c7192, 0x5a4c8ded
+      },
+      { // 754
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0xe8000000, 0x54000000, 0xd2000000, 0x4b000000,
+        0x65800000, 0x05c00000, 0x03a00000, 0xb8700000, 0x2cb80000, 0xde140000, 0x676a0000, 0x12d90000,
+        0x39c68000, 0xc5a04000, 0x81772000, 0x12395000, 0x5653b800, 0x350d1c00, 0x7b0de600, 0xe60fe900,
+        0x528a8180, 0x3dc876c0, 0x64297e20, 0xc53ba510, 0xe5d4dfa8, 0xe1ca83c4, 0x122e199a, 0x043c3ac5
+      },
+      { // 755
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x78000000, 0x5c000000, 0xe6000000, 0xcb000000,
+        0xbb800000, 0x13400000, 0x95200000, 0xc8b00000, 0x19f80000, 0x76d40000, 0xf86e0000, 0x319d0000,
+        0x74408000, 0x20a4c000, 0x14f16000, 0xdd5e7000, 0xf8237800, 0x58360c00, 0xc138f200, 0xd8b1ad00,
+        0x81fec380, 0x5ad31cc0, 0x366aea20, 0xde99d130, 0x75c54988, 0x1ee4bdd4, 0xf154dbbe, 0xbd2f60e7
+      },
+      { // 756
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x88000000, 0xdc000000, 0x22000000, 0x35000000,
+        0x53800000, 0x9b400000, 0xd1200000, 0x00f00000, 0xadb80000, 0xe2940000, 0xf06a0000, 0x45d90000,
+        0x46468000, 0xaea34000, 0x81b36000, 0x0d9dd000, 0xc7e70800, 0x0d976c00, 0x32e96200, 0x4b193d00,
+        0x5f240180, 0x6ff6dec0, 0x2f3d0a20, 0x4c538110, 0xf90a6ba8, 0x0c888fc4, 0x34c86982, 0xcd6862e7
+      },
+      { // 757
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0xe8000000, 0x5c000000, 0xa6000000, 0x1d000000,
+        0xc5800000, 0x08400000, 0x86600000, 0x4ff00000, 0xe7680000, 0xadd40000, 0x20fa0000, 0xe4490000,
+        0xb9c38000, 0x94204000, 0x62926000, 0x281ff000, 0x33794800, 0xf90ffc00, 0xb6269a00, 0x2d907700,
+        0xaa9bd180, 0xf5bf6a40, 0x47adb220, 0xee707b10, 0xad2c03a8, 0x34b4e16c, 0x158af99a, 0xc1e66647
+      },
+      { // 758
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x48000000, 0xac000000, 0x0e000000, 0xf7000000,
+        0x4d800000, 0x85c00000, 0x25a00000, 0x52b00000, 0x2a680000, 0xccd40000, 0x227e0000, 0xf5890000,
+        0xff078000, 0x81814000, 0x9bc5e000, 0x2aa7b000, 0xfb309800, 0x0daf7c00, 0x1077e600, 0xca4af900,
+        0x17a5d780, 0x93b7d040, 0xd4ea9e20, 0x16963530, 0x331ca9a8, 0x941b556c, 0x419f2fb2, 0x305a5c5b
+      },
+      { // 759
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x78000000, 0xa4000000, 0x0e000000, 0x23000000,
+        0x02800000, 0xf0c00000, 0x87200000, 0x25700000, 0x86f80000, 0x2c940000, 0x8fae0000, 0x61990000,
+        0x97068000, 0xb480c000, 0xd7c4a000, 0x1ba73000, 0x8eb7f800, 0xa75d4400, 0xf722ee00, 0xad733500,
+        0x6afbb980, 0x6e9708c0, 0x7ea9b620, 0xea1d4130, 0x4840afa8, 0xe2e079e4, 0x87d661be, 0xcfc9bcd9
+      },
+      { // 760
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x18000000, 0xe4000000, 0x16000000, 0xf7000000,
+        0x76800000, 0xa5400000, 0xac200000, 0x67300000, 0x84580000, 0xb0540000, 0xa44e0000, 0x67bd0000,
+        0x5c068000, 0xa207c000, 0xd902a000, 0xf584f000, 0xddc05800, 0x1a642400, 0xab922200, 0xb1296d00,
+        0xeea9a780, 0xd66e69c0, 0xeb88da20, 0xecddb930, 0xde15dd88, 0xacee20e4, 0xd4cddfa6, 0xedf97dc9
+      },
+      { // 761
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xa8000000, 0x24000000, 0x7a000000, 0xab000000,
+        0xb4800000, 0x82c00000, 0xda600000, 0xf6f00000, 0xa9680000, 0xcc540000, 0xb2fa0000, 0xb14f0000,
+        0xf0048000, 0xd8044000, 0xbc00a000, 0xa6041000, 0x5d013800, 0x41875400, 0xe7429e00, 0x47262f00,
+        0x1ad60580, 0x073f8e40, 0x49ab0620, 0x21316b10, 0x668fa398, 0x3fe1f554, 0x2bb31d8a, 0x25488a59
+      },
+      { // 762
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x78000000, 0x9c000000, 0x4a000000, 0x1f000000,
+        0xf4800000, 0x41c00000, 0xbb200000, 0x3f300000, 0x4ff80000, 0x93d40000, 0x5eee0000, 0xa8990000,
+        0xe7848000, 0xe740c000, 0x09e76000, 0x92971000, 0xca0fd800, 0x458d1400, 0xe6caa600, 0xe92d8500,
+        0x56bdd380, 0xeb37e8c0, 0x51fa1e20, 0x52d38130, 0xcb6eada8, 0xacda79f4, 0x20e7ebbe, 0x83102cd7
+      },
+      { // 763
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x88000000, 0x6c000000, 0x7e000000, 0xc7000000,
+        0x3f800000, 0xe5400000, 0x89e00000, 0x13b00000, 0x89f80000, 0x5d140000, 0x82ae0000, 0x43df0000,
+        0x0a818000, 0xd3c14000, 0x7c23e000, 0x5c943000, 0x00e91800, 0xe5bd6c00, 0x0470e200, 0x37de8b00,
+        0x2082cb80, 0xeec6eac0, 0xe6a21a20, 0xb753d730, 0xf8cd3198, 0xdb2e0ddc, 0x359fb382, 0x46e5f6eb
+      },
+      { // 764
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x88000000, 0xa4000000, 0xb2000000, 0xd5000000,
+        0x0a800000, 0x19c00000, 0xdfa00000, 0xdb900000, 0x4c380000, 0x58f40000, 0xda8a0000, 0xaa9d0000,
+        0xffe58000, 0xb8774000, 0x0a4fa000, 0xc1be5000, 0x8eb1c800, 0xce6be400, 0xeb6d7600, 0x29e9c100,
+        0xb4282680, 0xa98862c0, 0x2f191e20, 0xcda17510, 0x3e911888, 0xeebd07dc, 0x9533ee82, 0x3f2e86f9
+      },
+      { // 765
+        0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xf8000000, 0x8c000000, 0xbe000000, 0x1d000000,
+        0xac800000, 0x9bc00000, 0x6ee00000, 0xd1700000, 0x19b80000, 0x41540000, 0xc6aa0000, 0x4c5b0000,
+        0x9da58000, 0x4e52c000, 0x1928e000, 0x0e1db000, 0xc0054800, 0xa001f400, 0x90054600, 0x8802bb00,
+        0x74049180, 0x3206f4c0, 0xa302ee20, 0xb185ff10, 0x37411fb8, 0xf5277bdc, 0xbf93d99e, 0xc8c800f3
+      },
+      { // 766
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x48000000, 0xf4000000, 0xee000000, 0xfb000000,
+        0x32800000, 0x39c00000, 0x5c600000, 0x6bd00000, 0x35e80000, 0xdd740000, 0x34da0000, 0xac890000,
+        0xd7268000, 0x4e754000, 0xa25a2000, 0x9349b000, 0x94443800, 0xb1264400, 0xa174e600, 0xcede6f00,
+        0x098ae480, 0x46a45240, 0xf930fe20, 0xddf89b10, 0xb1fcbaa8, 0x03f93944, 0x52fcdcb2, 0x2d7f166d
+      },
+      { // 767
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x48000000, 0x74000000, 0xe2000000, 0x07000000,
+        0xb9800000, 0x0bc00000, 0xc5200000, 0xed100000, 0xc2580000, 0x5cf40000, 0xbfee0000, 0x06790000,
+        0x65628000, 0x1cf14000, 0xdfee2000, 0xb679d000, 0x3d63d800, 0x20f27c00, 0x49eaf600, 0x537d1d00,
+        0x83e11a80, 0x92b7d5c0, 0x87090e20, 0x7b4fb130, 0xacaab4a8, 0x0c19f4c4, 0x6414c2b2, 0xc2d8a9ed
+      },
+      { // 768
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0xb8000000, 0xe4000000, 0x86000000, 0xfb000000,
+        0x74800000, 0x4b400000, 0x27200000, 0x95f00000, 0x99380000, 0xb6940000, 0xc16a0000, 0x9e1b0000,
+        0x13628000, 0x9050c000, 0xe48ca000, 0x08097000, 0x974b3800, 0xfe69b400, 0x5c9c3200, 0x6b250500,
+        0x0ff63180, 0xe03afac0, 0x2f11aa20, 0xbdaec110, 0x62fbbbb8, 0x6cf28be4, 0x40bd098e, 0x2a534ee9
+      },
+      { // 769
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x98000000, 0xfc000000, 0xf6000000, 0xbb000000,
+        0xd7800000, 0x89400000, 0xaae00000, 0x11f00000, 0xd1580000, 0xad540000, 0x57ce0000, 0x19bd0000,
+        0xe5a68000, 0xc813c000, 0x532a6000, 0x6f4bf000, 0x857cf800, 0xcf05ec00, 0x8585a200, 0x18477300,
+        0xa065d980, 0x6c3307c0, 0xd97d3a20, 0x69046f30, 0x86820388, 0xa3c658e4, 0x47212186, 0x81d2ebcf
+      },
+      { // 770
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0xc8000000, 0x54000000, 0xb6000000, 0x5b000000,
+        0x36800000, 0x54400000, 0xa2600000, 0xfb100000, 0xaa580000, 0xfa340000, 0x2fae0000, 0xe6390000,
+        0xb6278000, 0x39754000, 0x414a2000, 0x286a7000, 0x499c3800, 0x2b91a400, 0xbd1b4a00, 0xe2d4bf00,
+        0x1afbae80, 0x9f02b3c0, 0x38835220, 0x33466b30, 0xc6e35ca8, 0x8a56e8ec, 0x31bf9692, 0xd5e717e5
+      },
+      { // 771
+        0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x18000000, 0x7c000000, 0x42000000, 0x0b000000,
+        0x3b800000, 0xa8c00000, 0xe1200000, 0xdf300000, 0x0ae80000, 0x57d40000, 0x707e0000, 0xe74f0000,
+        0xf9a78000, 0xe875c000, 0x1d0d6000, 0x90c35000, 0x8d257800, 0x55332c00, 0xd5ea8e00, 0x4a524d00,
+        0xedbf8380, 0x74ef0840, 0xbed49620, 0x90f93130, 0xdc09f598, 0xd444a96c, 0xe8637ba6, 0x81d6e46f
+      },
+      { // 772
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x08000000, 0xec000000, 0x4a000000, 0x95000000,
+        0x8a800000, 0x2f400000, 0x8d600000, 0x3ef00000, 0xf0b80000, 0x17d40000, 0x52ae0000, 0xdf5f0000,
+        0xba658000, 0xfd754000, 0x777be000, 0x3cf19000, 0x29bd8800, 0x47566400, 0x10ee0200, 0x3cbbd700,
+        0x0dd63980, 0x5fad84c0, 0x41de6a20, 0x3b272330, 0x43163398, 0x1c0e77fc, 0xfc8e31a2, 0x16cea0cb
+      },
+      { // 773
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x58000000, 0x8c000000, 0xc6000000, 0x0d000000,
+        0x3e800000, 0x59400000, 0xe5a00000, 0x21d00000, 0x5b780000, 0x52340000, 0x0e8e0000, 0x705d0000,
+        0xb2a18000, 0x1c55c000, 0xb5bee000, 0xb2537000, 0x8cb8c800, 0x96d6a400, 0x36f91200, 0x94f17100,
+        0x3aebd080, 0xb86eccc0, 0x9f293a20, 0xab8da530, 0x5add8a88, 0x81e5d9dc, 0x42f298b6, 0xffeda8d3
+      },
+      { // 774
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0xd8000000, 0xc4000000, 0x56000000, 0xcd000000,
+        0x83800000, 0xfb400000, 0x09200000, 0xc2b00000, 0xf4080000, 0x93540000, 0x54de0000, 0xd4c90000,
+        0x65308000, 0x694dc000, 0x7f75a000, 0x59e8f000, 0x91878800, 0xa0440c00, 0xe7a0c200, 0xea769d00,
+        0xde69a380, 0x9cc47b40, 0x34626a20, 0x7e97a130, 0x213b49a8, 0x121e1a54, 0xc7ac8396, 0x97214b41
+      },
+      { // 775
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xe8000000, 0x0c000000, 0x16000000, 0x25000000,
+        0x24800000, 0xc5400000, 0xe9200000, 0x1ad00000, 0xc1180000, 0xc2340000, 0xdfae0000, 0x9cdf0000,
+        0x80508000, 0x8d5a4000, 0x2995e000, 0x9d3b7000, 0x74610800, 0x87f57400, 0x49cbf200, 0x6c29a500,
+        0xe21a2880, 0x8bb723c0, 0x026f9a20, 0x1ebde130, 0xb2a53298, 0x681082d4, 0xdcff489a, 0x680613f3
+      },
+      { // 776
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x08000000, 0xc4000000, 0x42000000, 0xf9000000,
+        0x43800000, 0x2f400000, 0x85200000, 0x63100000, 0x2c480000, 0x02f40000, 0xe13e0000, 0x6a8b0000,
+        0x65938000, 0xee894000, 0x0794a000, 0xc78dd000, 0x7c12a800, 0x24c9ac00, 0x7f37e200, 0xfcd85d00,
+        0xe9f92e80, 0x92ee5940, 0xa2a26a20, 0x1e556130, 0x8868c4b8, 0xde62784c, 0x6c360ea2, 0x925ec941
+      },
+      { // 777
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xf8000000, 0xbc000000, 0x82000000, 0x89000000,
+        0x3d800000, 0x4fc00000, 0x69600000, 0x50500000, 0xbb180000, 0x53740000, 0xa1ea0000, 0x3b5d0000,
+        0x64d38000, 0x895cc000, 0x55d56000, 0x28dc5000, 0x28136800, 0x30bf9c00, 0xf9c0e600, 0x46648f00,
+        0x4ad3c080, 0x8a58c5c0, 0x85556e20, 0xd49b8310, 0xfdb52e88, 0x010f86ec, 0xe2cd209e, 0x01ac55ff
+      },
+      { // 778
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xe8000000, 0xc4000000, 0xa2000000, 0x8b000000,
+        0x29800000, 0xb4400000, 0x4f600000, 0x2f300000, 0x5e480000, 0x61940000, 0x345e0000, 0xaa8b0000,
+        0x18328000, 0x39ce4000, 0xd8d5a000, 0x6bbcd000, 0x7b7e3800, 0x50d8fc00, 0x2e4eaa00, 0x5994cf00,
+        0xf85e4780, 0xdc8b9340, 0xd937b220, 0x5f4ea330, 0xe71375b8, 0x1b9f7044, 0x32af679a, 0x95e60341
+      },
+      { // 779
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xc8000000, 0x84000000, 0x9e000000, 0x09000000,
+        0x3d800000, 0xfb400000, 0x06e00000, 0x4bb00000, 0x9bb80000, 0x95940000, 0xe4ae0000, 0xdef90000,
+        0x6a738000, 0xfa9d4000, 0x0a04a000, 0xaf053000, 0xd8872800, 0xecc0bc00, 0xa2a52200, 0xfdd5b300,
+        0x88c89b80, 0xfa8f78c0, 0x01ed2a20, 0x11197f30, 0xbc4031a8, 0xaa6647cc, 0x51743b92, 0x841e48d1
+      },
+      { // 780
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xe8000000, 0x54000000, 0xa2000000, 0x07000000,
+        0xca800000, 0x83400000, 0xcee00000, 0xbe700000, 0x6cb80000, 0x2b540000, 0x106a0000, 0xf9fd0000,
+        0x50b58000, 0xdb9c4000, 0x10842000, 0x2843d000, 0x4a64d800, 0x54326400, 0x71de7200, 0x2de6bb00,
+        0x5ef0ad80, 0xecf830c0, 0x15330a20, 0x965f4f10, 0x67242788, 0xe3d23fdc, 0xa42c8d9a, 0x359fe0c5
+      },
+      { // 781
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x08000000, 0x4c000000, 0xd6000000, 0x71000000,
+        0x22800000, 0xa8c00000, 0x72200000, 0x39300000, 0x8d680000, 0x67540000, 0x07be0000, 0xe7ad0000,
+        0x36748000, 0xd70f4000, 0x9781e000, 0xd0467000, 0x5de0a800, 0xc8934400, 0x36183e00, 0x7cdf6d00,
+        0xfdf92b80, 0x254a3440, 0x1965f620, 0x29511930, 0xd2be5d88, 0xaf2d6d74, 0xe1b0cba2, 0xb2a84463
+      },
+      { // 782
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xb8000000, 0x54000000, 0x7e000000, 0xb7000000,
+        0x25800000, 0x86c00000, 0x81a00000, 0xe1b00000, 0x91180000, 0xf5540000, 0x6cca0000, 0x6bdf0000,
+        0xd6f58000, 0xc87cc000, 0x32462000, 0xf1e7b000, 0x6551d800, 0xe4cbfc00, 0xe7dbbe00, 0x8cf43900,
+        0xb978e780, 0xf4c58bc0, 0x2ca1c620, 0xd530b510, 0xa15ea198, 0x11b2fedc, 0x691ec78e, 0xc1523bc5
+      },
+      { // 783
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xe8000000, 0x8c000000, 0x7e000000, 0xcd000000,
+        0x8f800000, 0x2fc00000, 0x1be00000, 0xa8900000, 0x99780000, 0x15340000, 0xbcca0000, 0xfabd0000,
+        0x10d58000, 0x895c4000, 0x7442e000, 0x4e253000, 0xdc744800, 0x95686c00, 0x850fa600, 0xe058ab00,
+        0x69c4b680, 0x82e382c0, 0x1d148e20, 0xf9bdb710, 0xda57b888, 0xf51b75dc, 0xa666569a, 0x5456b2f3
+      },
+      { // 784
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0xc8000000, 0x2c000000, 0x6e000000, 0xbb000000,
+        0xc8800000, 0xcb400000, 0xe9e00000, 0x85100000, 0x07180000, 0x8d340000, 0xc5ae0000, 0x7d5d0000,
+        0x95518000, 0xb6794000, 0x5b67e000, 0xbf50b000, 0xff7bf800, 0xaee3d400, 0x5b90b200, 0xb35cb300,
+        0x9e50c680, 0x96fcb5c0, 0xcc252a20, 0xf0b29730, 0xed6a6c88, 0x0f7a62dc, 0xa6e12692, 0x579505fb
+      },
+      { // 785
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x68000000, 0x44000000, 0xb2000000, 0x27000000,
+        0x0b800000, 0xe5400000, 0x91200000, 0xe5500000, 0xab180000, 0xdcb40000, 0x072e0000, 0x8b5b0000,
+        0xf9138000, 0xc0ba4000, 0x9220a000, 0xacd15000, 0xe15f5800, 0x32126c00, 0xdd3ec200, 0xd264cd00,
+        0x79724c80, 0xaecb83c0, 0x5f6aba20, 0x52f9b130, 0x908576b8, 0x60c372cc, 0x1d64ecba, 0xf6f5d3e1
+      },
+      { // 786
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x18000000, 0x94000000, 0xb6000000, 0x03000000,
+        0x8d800000, 0x0cc00000, 0x39a00000, 0x05100000, 0x47780000, 0x06f40000, 0x5e8e0000, 0xfffd0000,
+        0x44b58000, 0xc66fc000, 0x3f8e2000, 0x2778f000, 0x16f77800, 0x968dfc00, 0x83ff8e00, 0x7eb45900,
+        0xe76af280, 0x070818c0, 0xa53d5620, 0xae139530, 0xa6f9a488, 0xf8368dfc, 0x3a2972a6, 0xf86ed8d5
+      },
+      { // 787
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xf8000000, 0x5c000000, 0x32000000, 0x4f000000,
+        0xc4800000, 0x29c00000, 0x3be00000, 0xf6300000, 0xae680000, 0x13940000, 0x0cfa0000, 0x4ee90000,
+        0x14518000, 0xea18c000, 0xc35c6000, 0xaf7fd000, 0xb7ac5800, 0x3071d400, 0xf6cde600, 0xda862300,
+        0xecc1eb80, 0x4c662a40, 0xd9765e20, 0x0b49e710, 0x46c5b5a8, 0x4f62cd7c, 0x87f06b9e, 0x398eea47
+      },
+      { // 788
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0xc8000000, 0xec000000, 0xba000000, 0x9b000000,
+        0x14800000, 0x67c00000, 0x3fe00000, 0x98500000, 0xd5080000, 0xf3f40000, 0xa3fe0000, 0x49890000,
+        0x18378000, 0x361d4000, 0x32dbe000, 0xfdbc1000, 0xf42af800, 0x8fc09400, 0xa3e2f600, 0x4a542300,
+        0x120e2880, 0x95704140, 0xb33a6e20, 0xd8ece730, 0x7ca246a8, 0xc871a66c, 0x3eb9a892, 0xb4ad014b
+      },
+      { // 789
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x28000000, 0x34000000, 0xca000000, 0xe3000000,
+        0xbd800000, 0x90c00000, 0xd7200000, 0x39300000, 0x3c880000, 0xbc540000, 0xc1de0000, 0xb70f0000,
+        0x61968000, 0xca7c4000, 0xe47a2000, 0x45799000, 0xdffef800, 0x80bf9c00, 0x38590e00, 0x95c92d00,
+        0x29b39380, 0x20cbf340, 0x49355620, 0x448c6130, 0xc050c598, 0xafdc9264, 0xb60d13aa, 0x0b13b37d
+      },
+      { // 790
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x28000000, 0x94000000, 0x36000000, 0x59000000,
+        0xd7800000, 0xbcc00000, 0x8a600000, 0x30b00000, 0x2c680000, 0x2e940000, 0x9cfe0000, 0xbf6b0000,
+        0x22138000, 0x48b84000, 0x1f4e2000, 0x4f837000, 0xc0c62800, 0xc8652c00, 0x6fb65e00, 0x8aedc700,
+        0xd1d3cf80, 0x9c5dae40, 0x5cbbd620, 0xe94cdb30, 0xf68019b8, 0x2745754c, 0x5ca5cfaa, 0x71d2ae55
+      },
+      { // 791
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x58000000, 0x8c000000, 0x6e000000, 0xb9000000,
+        0x05800000, 0x97400000, 0x30a00000, 0xdef00000, 0x89f80000, 0x83940000, 0xc86e0000, 0xacff0000,
+        0x70168000, 0x0a2fc000, 0x67dfe000, 0xd8a73000, 0x3af66800, 0xc3f8bc00, 0x10904200, 0xceecc100,
+        0x653a7180, 0x057148c0, 0xcfb94a20, 0x92b78d30, 0xabdb3b98, 0x16a2c5e4, 0x73f471b6, 0x0e7e48d3
+      },
+      { // 792
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x18000000, 0xdc000000, 0x96000000, 0x33000000,
+        0xed800000, 0xb4400000, 0x12e00000, 0xe7500000, 0xf9480000, 0x75740000, 0xe03e0000, 0xdb4b0000,
+        0x34738000, 0xa4b9c000, 0x0f8c6000, 0x8857f000, 0x42ceb800, 0x1237bc00, 0x2f5fca00, 0x905b4300,
+        0x03dc2480, 0xa09a1740, 0x25f89220, 0xcbedcf30, 0x22c4b6b8, 0x7f27d84c, 0xf3f424a6, 0x45fe1747
+      },
+      { // 793
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xa8000000, 0xe4000000, 0xf2000000, 0x7f000000,
+        0xfc800000, 0xd1400000, 0x04600000, 0x9af00000, 0x37e80000, 0x0a540000, 0x11ba0000, 0x1de90000,
+        0x79518000, 0x5b3a4000, 0xb1a9a000, 0x56b35000, 0x080e9800, 0xa161d400, 0xbd722200, 0x482b5f00,
+        0x50768980, 0xdbac3e40, 0x85b69a20, 0xb28e9b10, 0xa52013a8, 0x7692a57c, 0xe91e898a, 0x3fb83e69
+      },
+      { // 794
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x48000000, 0x04000000, 0x9e000000, 0x3f000000,
+        0x09800000, 0x84400000, 0x2ee00000, 0xedf00000, 0x7a180000, 0x43d40000, 0x81ce0000, 0xfe1f0000,
+        0x1dd48000, 0xdecf4000, 0x2799a000, 0xd1923000, 0xf42e9800, 0x546d1c00, 0x948fea00, 0xbe7ba300,
+        0x51e05180, 0x44724dc0, 0x4e5a5220, 0xf530cf30, 0x203a0398, 0x1e0282f4, 0xff0051b2, 0x69824df1
+      },
+      { // 795
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xb8000000, 0x74000000, 0x56000000, 0x53000000,
+        0xb6800000, 0x07c00000, 0x89600000, 0x76500000, 0xd4f80000, 0xb7740000, 0xe38e0000, 0x94fd0000,
+        0x57708000, 0x938ac000, 0x7cfc2000, 0x9b77f000, 0xb18bf800, 0x79fb2400, 0x7ef55600, 0x00ca0700,
+        0xf758a880, 0x81c7bac0, 0xa2640e20, 0x94d51330, 0xd53ca688, 0xd512a9d4, 0x5758a88e, 0x11c7baed
+      },
+      { // 796
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x38000000, 0xb4000000, 0xfa000000, 0x29000000,
+        0x84800000, 0x51c00000, 0x75200000, 0xf5700000, 0xd4280000, 0xb42c0000, 0x642a0000, 0x4c2b0000,
+        0xf02a8000, 0x862b4000, 0xe12ee000, 0xb6a93000, 0x4ae87800, 0xea8c5c00, 0x3b1ed200, 0x6f657b00,
+        0xfa16d080, 0xfe3e71c0, 0x6216d0a0, 0xba3e71f0, 0x8016d0a8, 0x173e71fc, 0xc696d0a6, 0xdbfe71d1
+      },
+      { // 797
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x58000000, 0x2c000000, 0x92000000, 0x85000000,
+        0x87800000, 0xc7c00000, 0x94200000, 0xa3b00000, 0xbb980000, 0x039c0000, 0x5f9e0000, 0xf59d0000,
+        0x6c9c8000, 0x211e4000, 0x4fdf2000, 0xce7bb000, 0x2f0f9800, 0x8733a400, 0xe0d99a00, 0x90fb3b00,
+        0xc54f2680, 0x4dd07a40, 0x9acf26a0, 0xe6107a50, 0xfcef26b8, 0xf0a07a5c, 0x98f726ae, 0x18fc7a57
+      },
+      { // 798
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xb8000000, 0x04000000, 0x36000000, 0xb7000000,
+        0xf9800000, 0xf0400000, 0xd4a00000, 0x9ef00000, 0xaf480000, 0xa74c0000, 0x5b4e0000, 0x494f0000,
+        0xf84e8000, 0x0ecb4000, 0x030b6000, 0x11ead000, 0xecbf6800, 0x2480a400, 0xdcc32600, 0xf4678300,
+        0x78927480, 0x66de8ec0, 0x371274a0, 0x619e8ed0, 0x3a3274a8, 0x3f2e8edc, 0xf9da7486, 0x02928edd
+      },
+      { // 799
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x58000000, 0x3c000000, 0xda000000, 0xb5000000,
+        0xf4800000, 0x45c00000, 0x60200000, 0xe3100000, 0x8cd80000, 0x40dc0000, 0xb2de0000, 0x53dd0000,
+        0x495f8000, 0x079d4000, 0xc03ca000, 0xfd6a7000, 0x15d7d800, 0x677c7c00, 0x9f885200, 0x83625300,
+        0x57f0cb80, 0x7d6eed40, 0x55d0cba0, 0x077eed50, 0xcf88cbb8, 0xdb62ed44, 0x6bf6cbae, 0xa76fed4b
+      },
+      { // 800
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0x08000000, 0x24000000, 0x46000000, 0x7f000000,
+        0xdd800000, 0x66400000, 0x4fe00000, 0x7d700000, 0x0a880000, 0x5c8c0000, 0xeb8a0000, 0xb20f0000,
+        0x024b8000, 0x3aabc000, 0xbe5ae000, 0x9490d000, 0xf8ff2800, 0xb383c400, 0x6d47f600, 0x7c620900,
+        0xd0302280, 0xd6ed96c0, 0x1cb822a0, 0x356196f0, 0x8ab22288, 0x712e96d4, 0xcf19a28a, 0x12f556dd
+      },
+      { // 801
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x08000000, 0x84000000, 0x2a000000, 0x13000000,
+        0x52800000, 0xd3c00000, 0xcc200000, 0xf1100000, 0xe8180000, 0xd21c0000, 0x591a0000, 0xd79f0000,
+        0x52588000, 0x2b78c000, 0x35ece000, 0x65b5b000, 0xe9c92800, 0x0ca1bc00, 0xddd02200, 0x88bac300,
+        0x31cb8b80, 0xb0a12b40, 0xdbd38ba0, 0xc5bd2b70, 0x52498b88, 0xa6e22b4c, 0xbcb10b8a, 0x384aeb6d
+      },
+      { // 802
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x18000000, 0x4c000000, 0x8e000000, 0xff000000,
+        0x2d800000, 0xa2400000, 0xc9200000, 0xefd00000, 0xf8380000, 0x1a3c0000, 0x5b3e0000, 0xe1b90000,
+        0xaa7d8000, 0x1b1d4000, 0x00ef2000, 0x4b835000, 0xd940a800, 0xdea3c400, 0xe091d600, 0x759b1f00,
+        0xc928a180, 0x6be70040, 0x8030a1a0, 0x020b0050, 0x5536a198, 0xda8e0074, 0x1ff5219e, 0x316a4067
+      },
+      { // 803
+        0x80000000, 0xc0000000, 0xa0000000, 0x90000000, 0xb8000000, 0xd4000000, 0xe2000000, 0xdb000000,
+        0x29800000, 0x3c400000, 0x2f600000, 0x1e700000, 0x60180000, 0xfe1c0000, 0x6b1a0000, 0x0f9f0000,
+        0xb35b8000, 0xeafe4000, 0x1a28e000, 0x9567f000, 0xe1752800, 0x239a6400, 0xe55a8600, 0xe3f97d00,
+        0xc0a94e80, 0xeca06e40, 0xc4514ea0, 0x2b8c6e70, 0x69b34e88, 0x683f6e54, 0x468acea6, 0xb9322e61
+      },
+      { // 804
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0xc8000000, 0xac000000, 0xb2000000, 0x3b000000,
+        0x91800000, 0x47400000, 0xc9a00000, 0x6e900000, 0xc8d80000, 0x2edc0000, 0x73da0000, 0x7f590000,
+        0x54998000, 0xa6ffc000, 0xf20aa000, 0xc2273000, 0x6ed2e800, 0x8af86400, 0x800d5e00, 0x99259300,
+        0xef57a780, 0x05ba0140, 0xe5afa7a0, 0x45b60170, 0x1c8da7b8, 0xbae30174, 0xd136278a, 0xf349c15f
+      },
+      { // 805
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0xb8000000, 0x9c000000, 0x76000000, 0xfb000000,
+        0x9f800000, 0x88400000, 0xfde00000, 0xeaf00000, 0x1fd80000, 0xdcdc0000, 0x9f5e0000, 0x81190000,
+        0xd7fb8000, 0x1a8e4000, 0x1112a000, 0x462d1000, 0xc884c800, 0xc9c13400, 0x4aa2f600, 0x32955900,
+        0x4869ae80, 0xc667c040, 0xc8b7aea0, 0x8f3ec050, 0x02ac2e98, 0x2f408044, 0xb4668eb6, 0x29b19063
+      },
+      { // 806
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x08000000, 0x5c000000, 0xbe000000, 0x03000000,
+        0x63800000, 0x65c00000, 0x55a00000, 0xc2100000, 0xde880000, 0x018c0000, 0x1c0a0000, 0x9acd0000,
+        0x3ce98000, 0x9339c000, 0x44132000, 0x398ad000, 0xf808c800, 0x00cad400, 0x45ea7a00, 0x19bc1700,
+        0xa350a780, 0xd76d43c0, 0x6afaa7a0, 0x4fb043f0, 0x689b2798, 0x4d0583d4, 0x3882079a, 0xb24253c3
+      },
+      { // 807
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0xb8000000, 0x1c000000, 0x52000000, 0xbb000000,
+        0x35800000, 0x28400000, 0x24200000, 0xaa700000, 0x94d80000, 0xebdc0000, 0x405e0000, 0xd9190000,
+        0xffbd8000, 0xa2084000, 0x9db0a000, 0x9fbe3000, 0x720de800, 0xc5b14400, 0x13bf8600, 0x9809e700,
+        0x62b49480, 0x743dc240, 0x0b4a94a0, 0x7314c250, 0xf60f1498, 0xbbb08274, 0x32b9b4b6, 0x228bb273
+      },
+      { // 808
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x18000000, 0x34000000, 0x5a000000, 0x39000000,
+        0x7a800000, 0x93c00000, 0x79e00000, 0xc5300000, 0x02880000, 0xc78c0000, 0x9b0a0000, 0xd7c90000,
+        0x6bae8000, 0x08de4000, 0xcdf7e000, 0x3ce93000, 0xc9faf800, 0x8ea42c00, 0x94103200, 0xa9dabd00,
+        0x4372f480, 0x952c10c0, 0x7918f4a0, 0x291510f0, 0x315e74b8, 0x4db750cc, 0x244b94be, 0x3aeb60c1
+      },
+      { // 809
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0xd8000000, 0x34000000, 0xe2000000, 0xd9000000,
+        0xc2800000, 0x12400000, 0x53e00000, 0x9af00000, 0x70180000, 0xcb1c0000, 0x909e0000, 0xa0590000,
+        0xb1fb8000, 0xa0ed4000, 0x7e04e000, 0x2707f000, 0xa5833800, 0x57c22c00, 0x54203e00, 0x16d46100,
+        0x52c91680, 0x7bd18640, 0x324f16a0, 0x50948650, 0xf32a9698, 0x0020c644, 0xe4d5f6ae, 0xb3ca7649
+      },
+      { // 810
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x48000000, 0x04000000, 0xee000000, 0x73000000,
+        0x47800000, 0x4e400000, 0xc7e00000, 0x53d00000, 0x5b880000, 0xce8c0000, 0x5e0a0000, 0x29c90000,
+        0x6b6e8000, 0xf4dcc000, 0x58c4e000, 0x97279000, 0x60f20800, 0x457b3400, 0x40f2c600, 0x157cb900,
+        0x98f70780, 0xa97c2bc0, 0x3af507a0, 0x30792bf0, 0xe07187b8, 0x4abcebcc, 0x2e53e7aa, 0x90cbbbcd
+      },
+      { // 811
+        0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xd8000000, 0x4c000000, 0xe2000000, 0xd9000000,
+        0x44800000, 0xcac00000, 0xb4e00000, 0x67900000, 0x38180000, 0x2b1c0000, 0x629e0000, 0xa2d90000,
+        0x97fa8000, 0x010c4000, 0x9cc62000, 0x13e53000, 0x5011f800, 0x8b5cdc00, 0x67bd0a00, 0x0c2c6d00,
+        0x36323180, 0xb42b6140, 0x4a3431a0, 0x6e2e6150, 0xaf30b198, 0x10ab214c, 0xf0f411ae, 0x02ce515f
+      },
+      { // 812
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x18000000, 0xa4000000, 0x4e000000, 0xe5000000,
+        0x2c800000, 0x04400000, 0x6ce00000, 0xacf00000, 0xfc180000, 0x531c0000, 0x849a0000, 0x715b0000,
+        0x017f8000, 0x932f4000, 0xee226000, 0x8f541000, 0x458d3800, 0xa3315c00, 0xff3ffe00, 0x8ccf5900,
+        0x0f549e80, 0x85884e40, 0x83369ea0, 0x6f3f4e70, 0x94cb1ea8, 0xab570e54, 0xcb8cfeae, 0x66375e7d
+      },
+      { // 813
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0xb8000000, 0xdc000000, 0x76000000, 0xb5000000,
+        0x3e800000, 0xa5c00000, 0x50e00000, 0x9ed00000, 0x4b780000, 0x647c0000, 0x91fa0000, 0xabb90000,
+        0x62198000, 0xaeec4000, 0x0a22a000, 0xe3b51000, 0x23eeb800, 0x28a04c00, 0x5077e200, 0xd60da500,
+        0x30f03380, 0x62ce9840, 0x949233a0, 0x8adb9870, 0xbc89b3b8, 0x3732d874, 0xe5289396, 0x83c28843
+      },
+      { // 814
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0xc8000000, 0x04000000, 0x92000000, 0xb9000000,
+        0x8c800000, 0x43400000, 0x0c600000, 0x24100000, 0x27880000, 0x0b0c0000, 0x184a0000, 0xfc2b0000,
+        0x4c3f8000, 0x31b1c000, 0x87bde000, 0x81737000, 0x871db800, 0x4bc65c00, 0x1d258600, 0xb1700500,
+        0x1f1e5580, 0xa7c0d1c0, 0x1b21d5a0, 0x527111f0, 0x2e9c35a8, 0xfa0261d4, 0xed018d9a, 0xf6843dd5
+      },
+      { // 815
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x98000000, 0x34000000, 0x1e000000, 0x95000000,
+        0xbe800000, 0x41400000, 0x11600000, 0x83900000, 0x7dc80000, 0xf34c0000, 0x9a0a0000, 0x576d0000,
+        0xf6f98000, 0xac354000, 0x5ef8e000, 0xb0321000, 0x9cfbb800, 0x0737cc00, 0x05788600, 0x47f4ed00,
+        0x60dce180, 0xbfc7b7c0, 0x702561a0, 0xe2f2f7f0, 0xf65d8198, 0x2280e7d4, 0x434639be, 0x46672bd9
+      },
+      { // 816
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0xe8000000, 0x3c000000, 0x1a000000, 0x53000000,
+        0x6b800000, 0x09400000, 0xb2600000, 0x31f00000, 0xaef80000, 0x717c0000, 0xce3a0000, 0x3d5d0000,
+        0x582f8000, 0x6610c000, 0xc34d2000, 0xff67f000, 0x07706800, 0x5938b400, 0xb8de3e00, 0x94698d00,
+        0x4ef17280, 0x17792d40, 0xa73ef2a0, 0xb5d9ed70, 0x82ebd298, 0x09321d64, 0x66d9baa2, 0x296ba96b
+      },
+      { // 817
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xe8000000, 0xec000000, 0x76000000, 0x73000000,
+        0x41800000, 0xc3c00000, 0x77e00000, 0x01100000, 0x95180000, 0xc29c0000, 0x225a0000, 0x6c3b0000,
+        0x1aee8000, 0x8a11c000, 0xa09aa000, 0x535b1000, 0x0cbf8800, 0xc1a90400, 0x92b5da00, 0xcb2a4500,
+        0x44f49d80, 0x9d0b1d40, 0x83021da0, 0x4986dd70, 0xbfc2bda8, 0x59e6cd5c, 0x7613b592, 0x4e9e0967
+      },
+      { // 818
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x68000000, 0xdc000000, 0x86000000, 0x0b000000,
+        0x95800000, 0x1fc00000, 0x0b200000, 0xb3700000, 0x5e880000, 0x7d0c0000, 0x11ce0000, 0xdb690000,
+        0x7ddb8000, 0xcd70c000, 0x418a2000, 0x02881000, 0xbb0d4800, 0xfacc6400, 0x1eed5a00, 0x0a18a300,
+        0x1a57e880, 0x74fd74c0, 0x570468a0, 0x5381b4d0, 0xf4c04898, 0xcea0a4c4, 0xc4b68082, 0x89ac00f3
+      },
+      { // 819
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xd8000000, 0x3c000000, 0xf2000000, 0x7b000000,
+        0x7c800000, 0xe5400000, 0x0ea00000, 0xe3500000, 0x48480000, 0x4ecc0000, 0xe48e0000, 0x10ad0000,
+        0x8bba8000, 0xdcd44000, 0x5d89a000, 0xef283000, 0xbe7ae800, 0xed358c00, 0x2f7fe600, 0xf6b6b300,
+        0xd4bad980, 0x4e5653c0, 0xa1c859a0, 0xce0e13d0, 0x20eff9b8, 0x809b23ec, 0x0547918e, 0xbea6efe3
+      },
+      { // 820
+        0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x28000000, 0x0c000000, 0x36000000, 0x13000000,
+        0xbb800000, 0x39c00000, 0x69200000, 0x3b900000, 0xbf880000, 0x7e0c0000, 0x42ca0000, 0x936d0000,
+        0xf2ba8000, 0x39d3c000, 0x2f6fa000, 0xccbc1000, 0x36d58800, 0x7aecd400, 0xc279da00, 0xde72b300,
+        0x5dbe3f80, 0xbc562bc0, 0x19acbfa0, 0xf019ebf0, 0x03811f98, 0x2dc4fbcc, 0x9b241792, 0xe296efcf
+      },
+      { // 821
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x48000000, 0xe4000000, 0x0e000000, 0x6d000000,
+        0xe3800000, 0x90400000, 0x6f600000, 0x04100000, 0xedd80000, 0x2c5c0000, 0x7b1e0000, 0xf4fd0000,
+        0x5e288000, 0xe752c000, 0xd439e000, 0x278f9000, 0x7be5f800, 0x7cd06400, 0xa8792600, 0xc2e83d00,
+        0xacf0cd80, 0x5789fb40, 0x13e04da0, 0x48d73b50, 0x5e7fadb8, 0x03e9ab7c, 0xa574d5aa, 0xa4ca0f45
+      },
+      { // 822
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0xe8000000, 0x94000000, 0xd2000000, 0xa5000000,
+        0x15800000, 0xf3c00000, 0xf4e00000, 0x04500000, 0xd7080000, 0x5c8c0000, 0x844a0000, 0x162d0000,
+        0x1b3e8000, 0x0791c000, 0x0be96000, 0x2cddf000, 0xf141d800, 0x07a1f400, 0x1ef4aa00, 0x307fed00,
+        0x41327f80, 0x3a9a3fc0, 0xde64ffa0, 0x8317fff0, 0x6faf9f98, 0xf6fb0fec, 0x1872c7a2, 0x893a3bc9
+      },
+      { // 823
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xe8000000, 0x7c000000, 0x1e000000, 0x67000000,
+        0x24800000, 0xc6400000, 0x1be00000, 0xb5100000, 0xa4280000, 0x5bac0000, 0x876e0000, 0x2dcd0000,
+        0x3fbe8000, 0x7cc1c000, 0xfaa62000, 0xea74d000, 0xa77ce800, 0x0c624c00, 0x15d53e00, 0x108f0100,
+        0x2eded980, 0xe09600c0, 0x6dee59a0, 0x348ac0d0, 0x84def9b8, 0xf593d0cc, 0xa86a3182, 0x25484cd3
+      },
+      { // 824
+        0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0x68000000, 0x44000000, 0x76000000, 0x7b000000,
+        0x8c800000, 0xe6400000, 0xd4200000, 0xf0100000, 0x89e80000, 0xca6c0000, 0xfeae0000, 0x13c90000,
+        0xbd7a8000, 0x31c1c000, 0x6ee7e000, 0x3a765000, 0xf1da8800, 0xe9916c00, 0xf42b1e00, 0xa68e9f00,
+        0x41dc2f80, 0x219478c0, 0x2028afa0, 0xc88cb8d0, 0x16ddcf98, 0x9f1728cc, 0xcb6ea782, 0xeb2914dd
+      },
+      { // 825
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x88000000, 0x04000000, 0x76000000, 0xdb000000,
+        0x6c800000, 0x55c00000, 0x8f200000, 0xde700000, 0xf5e80000, 0x6e6c0000, 0x152e0000, 0x9acd0000,
+        0xe01d8000, 0x08c1c000, 0xe0a5e000, 0x0b345000, 0x4d098800, 0x1a3e6c00, 0x8d328200, 0x4e09db00,
+        0x9aba1880, 0xbaf62fc0, 0xe42998a0, 0xf74aefd0, 0x0059f8b8, 0x8ba37fd4, 0xdfb3909a, 0xe4c843d5
+      },
+      { // 826
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x18000000, 0x0c000000, 0x46000000, 0x81000000,
+        0x94800000, 0xbbc00000, 0x3e600000, 0xfe300000, 0x03480000, 0x70cc0000, 0x8e8e0000, 0x27ab0000,
+        0x403b8000, 0xdd234000, 0xdd972000, 0xf21f1000, 0x11321800, 0x52c83c00, 0xad8e2200, 0xd0283100,
+        0xac78b080, 0x1f0482c0, 0xf98530a0, 0xd940c2d0, 0x0ca79088, 0x40d792d4, 0x0cb9288e, 0x8ae3fed7
+      },
+      { // 827
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xb8000000, 0x54000000, 0xb6000000, 0x9b000000,
+        0x72800000, 0x22c00000, 0xb3600000, 0x91f00000, 0x63280000, 0x0cac0000, 0x3fee0000, 0xa8cf0000,
+        0xae9a8000, 0xcc274000, 0x14d1e000, 0xd07e5000, 0x63978800, 0xb95f9c00, 0x32c44a00, 0xfb61f100,
+        0x5df38e80, 0x312fafc0, 0x99af0ea0, 0x826befd0, 0x4e8a6ea8, 0xa43dfffc, 0x9c368686, 0xc4cb73e9
+      },
+      { // 828
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x98000000, 0x74000000, 0xb2000000, 0xcf000000,
+        0xd7800000, 0x37400000, 0xe2200000, 0xd5100000, 0x32e80000, 0xf06c0000, 0xd3aa0000, 0x874b0000,
+        0xd23e8000, 0x23624000, 0x1235e000, 0xab7e7000, 0x20450800, 0xa1a43400, 0xc0564e00, 0x37ce7f00,
+        0x1ef80780, 0x100688c0, 0xe80487a0, 0xcc03c8f0, 0x7605e7a8, 0xe504f8dc, 0x6c838f8e, 0x52c0fcc1
+      },
+      { // 829
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x38000000, 0x64000000, 0x2e000000, 0xb1000000,
+        0xb2800000, 0x13c00000, 0xb0a00000, 0x43f00000, 0x4f480000, 0x86cc0000, 0xf88e0000, 0xb8690000,
+        0x3a7f8000, 0xada64000, 0xf3716000, 0xaf8a1000, 0x97ec9800, 0xd93d8c00, 0x1dc3d200, 0x71a7f700,
+        0xf9775880, 0xd08c8ac0, 0x446ed8a0, 0x407fcad0, 0xdaa63898, 0xacf69ae4, 0x44ca4096, 0xab8e46fd
+      },
+      { // 830
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x68000000, 0xdc000000, 0xfa000000, 0x09000000,
+        0x28800000, 0xcc400000, 0xb4a00000, 0x1a900000, 0x1ff80000, 0x287c0000, 0x77be0000, 0x62dd0000,
+        0x4a2a8000, 0x8aa1c000, 0x1d932000, 0x787ef000, 0xcfb9b800, 0x46dd7c00, 0xf42b5e00, 0xcda79b00,
+        0x1a17df80, 0x6fbb8840, 0x96db5fa0, 0x0c2b4850, 0x89a4ffb8, 0x5415786c, 0x40bae7a2, 0x4d5a345b
+      },
+      { // 831
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x18000000, 0x24000000, 0xc2000000, 0x31000000,
+        0xb2800000, 0x62400000, 0xd1600000, 0xafd00000, 0x89c80000, 0x7c4c0000, 0x378e0000, 0x1b2f0000,
+        0x635e8000, 0x1d664000, 0x31d36000, 0x4ecf7000, 0x15cbf800, 0xea4dec00, 0xfc8f3e00, 0x8ca91500,
+        0x699abb80, 0xbb465dc0, 0x3fe23ba0, 0x3b931dd0, 0x83a9dba8, 0x6c192ddc, 0x8881c3ae, 0x2742f1d5
+      },
+      { // 832
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x98000000, 0x94000000, 0x6a000000, 0xb5000000,
+        0x55800000, 0x88400000, 0x15600000, 0x6a900000, 0xe1480000, 0x27cc0000, 0xd10a0000, 0xb6af0000,
+        0xe9998000, 0xa6e54000, 0x69d5e000, 0xdea8b000, 0xf59c1800, 0x60e63400, 0xf2d7b600, 0xcc2b3d00,
+        0x095ef980, 0xc2407bc0, 0xb06579a0, 0x07163bf0, 0x2d0b1988, 0xc0a8cbc4, 0x9a9961ae, 0x68600fe1
+      },
+      { // 833
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0xb8000000, 0x84000000, 0x52000000, 0xe7000000,
+        0xe1800000, 0x02c00000, 0x86200000, 0x6a500000, 0x89e80000, 0xd16c0000, 0x0b2e0000, 0x174b0000,
+        0xc1798000, 0xcea44000, 0xa8146000, 0x418cf000, 0xed5ac800, 0x67f54400, 0xc2799200, 0xcd250300,
+        0x05d20180, 0x4a28d6c0, 0xebcd81a0, 0x593b96d0, 0x2dc66188, 0x4ba426c4, 0xa69749a6, 0x6eced2e5
+      },
+      { // 834
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x28000000, 0xd4000000, 0xb6000000, 0x21000000,
+        0xf0800000, 0xc3400000, 0xa8a00000, 0x4d500000, 0xde180000, 0x8d5c0000, 0xcdfa0000, 0xb4ad0000,
+        0xccb58000, 0x48e8c000, 0xa1946000, 0x607cd000, 0x25685800, 0xd0571c00, 0x6c9d6600, 0x2918f300,
+        0x8cd8c180, 0x363c2d40, 0x1b4ca1a0, 0xb740fd70, 0x2ea4f998, 0xb457e174, 0xc2999f92, 0x041f1241
+      },
+      { // 835
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xe8000000, 0xa4000000, 0xde000000, 0xe9000000,
+        0x06800000, 0x11c00000, 0xc1200000, 0x33500000, 0xe9680000, 0x68ac0000, 0x518e0000, 0x7edf0000,
+        0x75b48000, 0x661fc000, 0xa214e000, 0xfc8d1000, 0xb65ed800, 0x35712c00, 0x9dbd4200, 0x12825b00,
+        0x47c71980, 0xdc247ec0, 0x73d3f9a0, 0x5da96ed0, 0xd50d21a8, 0x441842cc, 0xb9106392, 0x390a19e5
+      },
+      { // 836
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0xe8000000, 0xcc000000, 0x3a000000, 0x43000000,
+        0xc1800000, 0x00400000, 0xfee00000, 0x55f00000, 0x01080000, 0xd94c0000, 0x53ae0000, 0xb85b0000,
+        0x1c538000, 0x9598c000, 0x88f0a000, 0x358a7000, 0xc18be800, 0x3f8d2400, 0x3a898600, 0x7a0e0100,
+        0xdcce4680, 0x15edeac0, 0xc7bee6a0, 0xef279ad0, 0xa3550e88, 0xd61abed4, 0x4fb488b2, 0xece8bfe7
+      },
+      { // 837
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x68000000, 0x4c000000, 0x3e000000, 0x9b000000,
+        0xf5800000, 0xaec00000, 0x80600000, 0xe5900000, 0x3d180000, 0x3fdc0000, 0x51ba0000, 0x572f0000,
+        0x0bb28000, 0x80adc000, 0xb875a000, 0x5a4b5000, 0xaca50800, 0xc8f36400, 0xea09b200, 0xbf81e100,
+        0xffc54580, 0xe4e40940, 0x8fd0e5a0, 0x673f5970, 0xe86ded88, 0xf7103d5c, 0xf05e5f92, 0x667edc4f
+      },
+      { // 838
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x68000000, 0xe4000000, 0x06000000, 0x29000000,
+        0xf4800000, 0xbfc00000, 0xc3600000, 0xa8500000, 0x5a080000, 0xd9cc0000, 0x50aa0000, 0x93ff0000,
+        0x22768000, 0xf1f9c000, 0xcd74e000, 0x8c7bd000, 0xb6341800, 0x98de7c00, 0x39016200, 0x6c85a900,
+        0x93c77380, 0x11639fc0, 0xef5393a0, 0x63884ff0, 0x948f8b88, 0x050a33fc, 0x0c4ce992, 0x6fec9ac5
+      },
+      { // 839
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x28000000, 0x34000000, 0xce000000, 0x09000000,
+        0xdb800000, 0xe5400000, 0x6b600000, 0xf5500000, 0xa1780000, 0x1a3c0000, 0x705a0000, 0x5a8d0000,
+        0x28b38000, 0x4ceec000, 0xe8656000, 0x31d61000, 0xbab9d800, 0x4d9bc400, 0xd02c8e00, 0x4d464500,
+        0x9f64f780, 0xdb565840, 0x787997a0, 0xe9bc4870, 0xa11a4f98, 0xffea8c44, 0xd4e54192, 0x36120949
+      },
+      { // 840
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x98000000, 0xfc000000, 0x7a000000, 0x5f000000,
+        0xc0800000, 0x02400000, 0x1ae00000, 0x60500000, 0xc9980000, 0xe9dc0000, 0x303e0000, 0x3aef0000,
+        0xc6308000, 0x91884000, 0x45a1a000, 0x89357000, 0x590b0800, 0xf3e34c00, 0x7dd1fe00, 0x785ad900,
+        0x23fd9380, 0x73cdb340, 0xcf4433a0, 0xa164c350, 0x04913ba8, 0x04388f6c, 0x94e8458e, 0xa7361653
+      },
+      { // 841
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x28000000, 0xac000000, 0x8e000000, 0x7b000000,
+        0xf3800000, 0x1ac00000, 0xd1200000, 0x74f00000, 0x83980000, 0x8f5c0000, 0x617a0000, 0x640f0000,
+        0x38568000, 0xc6abc000, 0x9664a000, 0x3417d000, 0x5dce8800, 0xfef0d400, 0x1a9fa200, 0x29de7b00,
+        0xc33d9480, 0x746c7c40, 0x2b4134a0, 0x6ee7ac70, 0x9555bc88, 0xaa28787c, 0xcd249e82, 0x12f1c357
+      },
+      { // 842
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x88000000, 0x4c000000, 0x46000000, 0x41000000,
+        0x58800000, 0x55400000, 0xefe00000, 0x8ed00000, 0x05980000, 0x7adc0000, 0x823e0000, 0x3d6b0000,
+        0x29318000, 0x2749c000, 0xc945a000, 0x61e49000, 0x23d31800, 0x4b1a1c00, 0xe6981600, 0x79597900,
+        0xa0fa5780, 0x824a0740, 0x8bc7f7a0, 0x1ba29750, 0xc9b2ef88, 0x060f8b44, 0x54a579aa, 0x7c343257
+      },
+      { // 843
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x48000000, 0x1c000000, 0x0e000000, 0x75000000,
+        0xc4800000, 0x92c00000, 0xcc200000, 0x34f00000, 0xae280000, 0xc9ec0000, 0x014a0000, 0x877b0000,
+        0xd5728000, 0x606cc000, 0xd30e2000, 0x93995000, 0x32a27800, 0x11339c00, 0x858baa00, 0xba585b00,
+        0x6f05a480, 0x438219c0, 0x3d4184a0, 0x976049f0, 0xfa917ca8, 0xd63f15fc, 0xe414f6ba, 0xe3fe1efb
+      },
+      { // 844
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x58000000, 0x34000000, 0xee000000, 0xf9000000,
+        0x10800000, 0xe1c00000, 0x61600000, 0xfc300000, 0xf6380000, 0x76fc0000, 0xd31e0000, 0xd0eb0000,
+        0xb6b18000, 0x40ff4000, 0x5e18e000, 0x8e689000, 0xfe70d800, 0x691c1c00, 0x77ee7200, 0xf734a900,
+        0x8db87080, 0x5cbecd40, 0x303e90a0, 0xf3fd5d50, 0xe19fc888, 0x422e0144, 0x88515a9e, 0x808e3849
+      },
+      { // 845
+        0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0x58000000, 0x94000000, 0x3a000000, 0x55000000,
+        0x23800000, 0xf1400000, 0x33600000, 0x44d00000, 0x69d80000, 0x659c0000, 0xf97e0000, 0x42eb0000,
+        0x07508000, 0x089e4000, 0xdefce000, 0x01aa3000, 0xdd361800, 0x99ca4400, 0xbd65ae00, 0x1bd24500,
+        0xe75f9b80, 0x535f2140, 0x595d7ba0, 0xf45e1150, 0x33dbe388, 0xa09a154c, 0x52faad9e, 0x0fae6069
+      },
+      { // 846
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0xe8000000, 0x84000000, 0x5a000000, 0xa9000000,
+        0xbb800000, 0x95c00000, 0xe6a00000, 0x7ed00000, 0xf2780000, 0x36bc0000, 0x979a0000, 0x1a890000,
+        0xa1508000, 0xcdbbc000, 0xf11de000, 0xe6ca3000, 0xcf35f800, 0x5c4ae400, 0xc5772a00, 0x252fef00,
+        0x2c030180, 0x7e03c640, 0xa304e1a0, 0xca80f670, 0x424199b8, 0xad61d27c, 0x6b735382, 0x9e280d5d
+      },
+      { // 847
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0xd8000000, 0x4c000000, 0x62000000, 0x81000000,
+        0xdd800000, 0x7ec00000, 0xb8a00000, 0x35700000, 0xaa780000, 0x09bc0000, 0x969e0000, 0x302f0000,
+        0x0d738000, 0x16794000, 0x03bd2000, 0x139d3000, 0x1bacb800, 0xdcb01400, 0x905b4200, 0x1489f700,
+        0xa2044480, 0xe1027340, 0x6d8764a0, 0x36c04350, 0x2ca05ca8, 0x1b751774, 0x49783e9e, 0x553ed067
+      },
+      { // 848
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xb8000000, 0x3c000000, 0xde000000, 0xf1000000,
+        0x40800000, 0xd2c00000, 0xba200000, 0xaad00000, 0xdfa80000, 0x586c0000, 0x70ca0000, 0x6fd90000,
+        0xafd58000, 0x952c4000, 0x41afa000, 0x096c5000, 0xc04c5800, 0x951f1c00, 0x91f5aa00, 0xddfb6b00,
+        0xb1054580, 0xe08734c0, 0x22c0e5a0, 0x922264f0, 0x2ed13db8, 0x3dad38d4, 0x77693796, 0xc14f03db
+      },
+      { // 849
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x98000000, 0xfc000000, 0x52000000, 0xad000000,
+        0xcb800000, 0xb8c00000, 0x37e00000, 0x9c700000, 0x3b180000, 0x5adc0000, 0x70ba0000, 0x270b0000,
+        0xd7718000, 0xab994000, 0x0a9ca000, 0x9b193000, 0xcadfd800, 0xc8bfc400, 0x8b092200, 0x1d75ed00,
+        0xfa9af680, 0x931a1a40, 0x8edc56a0, 0x36b82a70, 0xec0a0ea8, 0x87f2ae64, 0xdbdd8c8e, 0xb139735b
+      },
+      { // 850
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x88000000, 0xcc000000, 0xda000000, 0xfb000000,
+        0xc5800000, 0x90c00000, 0xc1200000, 0x07900000, 0xb1980000, 0xc05c0000, 0x9ffe0000, 0x3d290000,
+        0x45518000, 0x07b9c000, 0x3849a000, 0x55a27000, 0x71d62800, 0x81fec400, 0x902b6200, 0x41d75b00,
+        0xb9f92f80, 0x242db740, 0xcfd68fa0, 0xdcfac750, 0x0caf2798, 0xbb94c354, 0xb39c65ba, 0x9f582867
+      },
+      { // 851
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0xc8000000, 0x2c000000, 0x76000000, 0xe1000000,
+        0x3f800000, 0x63400000, 0x2be00000, 0xb2700000, 0xb1c80000, 0xad8c0000, 0xa4ea0000, 0xe4590000,
+        0x68328000, 0xf1a8c000, 0x8ebba000, 0xf5c51000, 0x9b269800, 0xecd4a400, 0xb95b9e00, 0x59b79100,
+        0xf7eafa80, 0xb0d9e0c0, 0x7bf35aa0, 0xf389f0f0, 0xd9ed42b8, 0x05dc94ec, 0xb677fc8a, 0x5bcad5e7
+      },
+      { // 852
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x68000000, 0xc4000000, 0xfa000000, 0x93000000,
+        0x20800000, 0x63400000, 0xf8a00000, 0x42d00000, 0xcc380000, 0xde7c0000, 0x595e0000, 0xf64f0000,
+        0x10928000, 0x6b1dc000, 0xc16de000, 0xd7813000, 0x49c52800, 0x40e0ec00, 0xeef79600, 0x7fac2300,
+        0xbde23d80, 0x1f71e040, 0x9369dda0, 0xe083d050, 0x034075a8, 0x68a1fc7c, 0x9ad083b2, 0x603d2f4d
+      },
+      { // 853
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x08000000, 0x5c000000, 0x1a000000, 0xa5000000,
+        0xa6800000, 0x51400000, 0x3de00000, 0xd8700000, 0x61280000, 0xf36c0000, 0xe70a0000, 0x95b90000,
+        0xfab58000, 0xf309c000, 0x73b92000, 0xb5b4f000, 0x688a5800, 0xd079ac00, 0x9f148600, 0x321cd900,
+        0x6aa12280, 0xfa9197c0, 0x4ada02a0, 0xfd8067f0, 0x2cc7dab8, 0xd1250bd4, 0x6955fcba, 0x987de2c3
+      },
+      { // 854
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x68000000, 0xe4000000, 0x36000000, 0x45000000,
+        0x9a800000, 0xc1c00000, 0x16e00000, 0xdb100000, 0xccd80000, 0x779c0000, 0xf0ba0000, 0xc54f0000,
+        0x6e868000, 0x6fc1c000, 0x7fe0e000, 0xa3945000, 0x161ff800, 0x5afc6c00, 0x46eb4200, 0x9bb74500,
+        0x4e6e3580, 0x4975c740, 0x170855a0, 0x91205770, 0x80f74d88, 0xf9486b7c, 0x1483f792, 0x58c34245
+      },
+      { // 855
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x18000000, 0xbc000000, 0x26000000, 0x51000000,
+        0x3b800000, 0x8d400000, 0xcce00000, 0x60300000, 0xd6c80000, 0x180c0000, 0xf5ae0000, 0x87790000,
+        0x8c838000, 0x47c74000, 0xca20a000, 0x69969000, 0xde1e9800, 0x34f38400, 0x4c6c0e00, 0x005a5900,
+        0x48945080, 0x0d9a7ac0, 0xadb770a0, 0x528baad0, 0xb3694898, 0x6edebec4, 0xd453de9e, 0x733b63eb
+      },
+      { // 856
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x58000000, 0xcc000000, 0x9e000000, 0xef000000,
+        0x62800000, 0xe7400000, 0xad200000, 0x25f00000, 0x27080000, 0x7ecc0000, 0x62aa0000, 0xc17d0000,
+        0x1b008000, 0x40864000, 0x2e462000, 0x5ca5d000, 0x66372800, 0x4e6efc00, 0x0a9ba600, 0x68143f00,
+        0x57196880, 0xc5d4c4c0, 0x697fc8a0, 0xaf0754f0, 0x4286c098, 0xb74078dc, 0x45204e8e, 0xb1f7bbef
+      },
+      { // 857
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x08000000, 0x3c000000, 0x12000000, 0x5f000000,
+        0xd9800000, 0x12c00000, 0xe1a00000, 0x54500000, 0x84d80000, 0xd59c0000, 0x85fa0000, 0x1b8d0000,
+        0x56c38000, 0x37a7c000, 0x1d502000, 0xf45fb000, 0x67dfc800, 0xde1f4400, 0x28393200, 0xf3a82f00,
+        0x18503580, 0x6edf3f40, 0x8e9b95a0, 0xaa7b4f70, 0x704e7d98, 0x1fe6bb44, 0xe5b3079a, 0xec6a104b
+      },
+      { // 858
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x88000000, 0xd4000000, 0x96000000, 0x17000000,
+        0xf8800000, 0x0dc00000, 0x89200000, 0x23f00000, 0xc9280000, 0x526c0000, 0x0d8e0000, 0xb5df0000,
+        0xd7c18000, 0x3421c000, 0x7e756000, 0xe568d000, 0x650ae800, 0x101b6c00, 0x5ae4a200, 0x09d6db00,
+        0x74593c80, 0xd98311c0, 0x7245dca0, 0xd46601d0, 0xa31454a8, 0x7dfabde4, 0x7bb39e8a, 0xf84acad1
+      },
+      { // 859
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xe8000000, 0xa4000000, 0xa6000000, 0x53000000,
+        0xba800000, 0xf4c00000, 0x9c200000, 0x8fd00000, 0x01880000, 0x05cc0000, 0x2c2a0000, 0xb85b0000,
+        0x5f458000, 0xc766c000, 0xfeb5e000, 0x6439d000, 0xaf71c800, 0x39995c00, 0xeae0da00, 0x26f48b00,
+        0x47dcad80, 0x9a0095c0, 0xa904cda0, 0x238385f0, 0xcf42e5a8, 0xcf6409c4, 0xaab47792, 0xfa381eed
+      },
+      { // 860
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x08000000, 0x04000000, 0xa2000000, 0xe3000000,
+        0x23800000, 0xe8c00000, 0xb2e00000, 0x91100000, 0x55c80000, 0xd58c0000, 0x182a0000, 0x091d0000,
+        0x00218000, 0x9cf5c000, 0xa95be000, 0xbd85f000, 0x15c46800, 0xac643400, 0x8750d200, 0x616c9500,
+        0x783b6580, 0xe453e7c0, 0x82eb05a0, 0x70fed7f0, 0xc6b50d98, 0x1bfad3d4, 0x2132579a, 0xb13b82d5
+      },
+      { // 861
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x68000000, 0x3c000000, 0x42000000, 0xf9000000,
+        0xbd800000, 0x17400000, 0xc4600000, 0x44d00000, 0x25880000, 0xae4c0000, 0x34ea0000, 0x4d190000,
+        0xcb268000, 0x14b1c000, 0x7f5e2000, 0xc0c33000, 0xb6217800, 0xef32d400, 0x171f0e00, 0xa623fd00,
+        0xb736b380, 0x231c83c0, 0x282413a0, 0x643773f0, 0x5b9dcbb8, 0xc0e757cc, 0x4e159da2, 0x66a94ec3
+      },
+      { // 862
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x88000000, 0x94000000, 0xb6000000, 0x8f000000,
+        0xfe800000, 0xef400000, 0x49e00000, 0x14d00000, 0xe4f80000, 0xfe3c0000, 0x781a0000, 0xa16b0000,
+        0x88218000, 0xfa71c000, 0x0dcb6000, 0xe813d000, 0x65df2800, 0x4dcf9c00, 0x0811c600, 0x15ddf900,
+        0x95c94780, 0x1413c440, 0x37d9a7a0, 0xaccad470, 0x65946fa8, 0x261b5864, 0x0a6be18a, 0x38a1ed41
+      },
+      { // 863
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x48000000, 0xf4000000, 0xda000000, 0xab000000,
+        0xc1800000, 0xd6400000, 0x57200000, 0x12300000, 0x82980000, 0x725c0000, 0x94ba0000, 0x22ef0000,
+        0x25e48000, 0x33d2c000, 0xe34b6000, 0x6e14b000, 0x91286800, 0x86832400, 0xc1c6b600, 0xec601f00,
+        0x7196b680, 0xbe6c1e40, 0xef2356a0, 0x6e356e70, 0x0c9cde88, 0x735c3a6c, 0xb63b609a, 0xc128b151
+      },
+      { // 864
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x88000000, 0x2c000000, 0x42000000, 0xc1000000,
+        0x4f800000, 0xbc400000, 0xbca00000, 0x87b00000, 0xd3f80000, 0x233c0000, 0x6d5a0000, 0x058f0000,
+        0x41278000, 0x02f7c000, 0x34d8a000, 0xeecbb000, 0x25033800, 0x41840400, 0x8f460600, 0xaa20b300,
+        0xd0736680, 0xbd19d540, 0x9b2e46a0, 0xb796a570, 0x06885e88, 0x0fa1d174, 0x513240aa, 0x2439167f
+      },
+      { // 865
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0xa8000000, 0x8c000000, 0x3a000000, 0x09000000,
+        0x84800000, 0xf1400000, 0x58a00000, 0xff500000, 0x13780000, 0x35bc0000, 0x01de0000, 0x2beb0000,
+        0xba248000, 0x2515c000, 0x425ba000, 0xf92b7000, 0x2046b800, 0xb826dc00, 0x1810b600, 0x88dbe300,
+        0xef6bb180, 0xeb619e40, 0x8db291a0, 0x15082e50, 0x66550988, 0x2ffb426c, 0xb0fc27a2, 0xb778cd4f
+      },
+      { // 866
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x08000000, 0x74000000, 0xd6000000, 0x15000000,
+        0xee800000, 0xc6c00000, 0x03e00000, 0x87d00000, 0x56d80000, 0x159c0000, 0x2f3a0000, 0x7d4b0000,
+        0xb8668000, 0x4f92c000, 0x03ff6000, 0x29acd000, 0x8237f800, 0x9c0dcc00, 0x41c7da00, 0xe6623500,
+        0xee978380, 0x1b783140, 0x4a6c63a0, 0x67512170, 0xa9187ba8, 0xc2f9fd5c, 0x6129b9aa, 0x79f41441
+      },
+      { // 867
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x58000000, 0x84000000, 0xde000000, 0x39000000,
+        0xe7800000, 0x10c00000, 0xc3600000, 0x9ed00000, 0xba580000, 0xee1c0000, 0x5d3e0000, 0x7ecf0000,
+        0xa6638000, 0x63554000, 0x6d9b6000, 0x63f89000, 0x6cafd800, 0x93332400, 0xcbcf0200, 0x23e32900,
+        0xa0953780, 0x667ea940, 0xef6bd7a0, 0xb8d07950, 0xd75aefa8, 0xaf9d8d74, 0x60fcd5be, 0xdc2f5055
+      },
+      { // 868
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x08000000, 0x5c000000, 0xca000000, 0x49000000,
+        0xe0800000, 0x01400000, 0x14a00000, 0x4ab00000, 0x50c80000, 0xce0c0000, 0x086e0000, 0xd6bf0000,
+        0x95a08000, 0x9634c000, 0x4b8c2000, 0x6baf7000, 0xf658b800, 0x1136fc00, 0xcc0f9600, 0x7d6f2300,
+        0x2c3ede80, 0x25e38cc0, 0x36147ea0, 0x967b3cd0, 0xacc666a8, 0xdb6570ec, 0xa853e8aa, 0xc1581ffb
+      },
+      { // 869
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x08000000, 0xdc000000, 0xd6000000, 0x61000000,
+        0x17800000, 0x15c00000, 0x40200000, 0x39d00000, 0xd8780000, 0xd93c0000, 0xe05a0000, 0xf4eb0000,
+        0x12248000, 0x6ad0c000, 0x8cf82000, 0x407b9000, 0x1d391800, 0x3258e400, 0x67e92a00, 0x66a5db00,
+        0x0395fd80, 0x799b3240, 0x5acb5da0, 0xbef76270, 0x5f2ce5a8, 0xff03d64c, 0x4a8277aa, 0x0442b97b
+      },
+      { // 870
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xc8000000, 0x2c000000, 0xda000000, 0x39000000,
+        0xb0800000, 0xe3400000, 0xb2200000, 0xfc700000, 0xa6a80000, 0x626c0000, 0x648a0000, 0x461b0000,
+        0x06258000, 0x0277c000, 0x49a8a000, 0xe1eb7000, 0xc64a3800, 0x8bf8fc00, 0x71300600, 0xd3890700,
+        0xc19c4c80, 0xa2e52dc0, 0x34936ca0, 0x533e9df0, 0x95d674a8, 0xfc1dd1c4, 0x0f236a9a, 0x8af79acf
+      },
+      { // 871
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x28000000, 0xec000000, 0x82000000, 0x1d000000,
+        0x7c800000, 0x18400000, 0xa2600000, 0x56300000, 0x7e080000, 0x8c6c0000, 0x325a0000, 0x00570000,
+        0xde3d8000, 0xd966c000, 0x49b6a000, 0x0dcf3000, 0x6bc91800, 0x08cc5c00, 0x634bae00, 0x268ba500,
+        0x4a2f4880, 0x573816c0, 0x23e650a0, 0x82f44af0, 0x9c2dfe88, 0x6c3fefc4, 0x5c62b602, 0x8137f93f
+      },
+      { // 872
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x38000000, 0x4c000000, 0x76000000, 0xef000000,
+        0xa7800000, 0xf8c00000, 0x87200000, 0x2bb00000, 0x08e80000, 0xa7cc0000, 0xd87e0000, 0x5a950000,
+        0x8c5f8000, 0x68a04000, 0x57772000, 0x3dcb1000, 0xb17c2800, 0x9a163400, 0x771ee200, 0x1544f300,
+        0x2ee09a80, 0x2010bfc0, 0xae1cb2a0, 0x3dc68bd0, 0xa1a250b8, 0x67f278e4, 0x4e8aca36, 0x689ec737
+      },
+      { // 873
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0xe8000000, 0xf4000000, 0x56000000, 0x97000000,
+        0xfc800000, 0x43c00000, 0x12200000, 0x7bb00000, 0xe9580000, 0x6f7c0000, 0xb2ce0000, 0x94930000,
+        0x0b6f8000, 0xb066c000, 0x03d26000, 0x4e8f5000, 0x3ff52800, 0xfe3cac00, 0x282fe200, 0x03815b00,
+        0x0b45aa80, 0xa7e1c240, 0xee9082a0, 0x866d6e50, 0x31e76088, 0x99903554, 0xcaecca32, 0x8a22f729
+      },
+      { // 874
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0xe8000000, 0xf4000000, 0x4a000000, 0x9f000000,
+        0x2c800000, 0xdac00000, 0xe6200000, 0x11300000, 0x8ad80000, 0xa6fc0000, 0xe8ca0000, 0x6e930000,
+        0xa2aa8000, 0x4447c000, 0xcfe36000, 0xad93b000, 0xd02c8800, 0xdb848c00, 0xc242ea00, 0x56e3d300,
+        0xd8101680, 0x5f6dca40, 0x02e49ea0, 0xe2154670, 0x086c74a8, 0x6a65955c, 0x9ad6e212, 0x854f9f21
+      },
+      { // 875
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x98000000, 0xb4000000, 0x02000000, 0xbf000000,
+        0x46800000, 0xa7c00000, 0x97600000, 0x3b900000, 0x99a80000, 0x7ccc0000, 0x305a0000, 0xa3710000,
+        0x5e798000, 0xdc474000, 0x0923e000, 0x2db27000, 0x029cc800, 0xd1971c00, 0x5aa95200, 0x744ca100,
+        0x0e9b2180, 0x57965ec0, 0x8fafe9a0, 0x31cd42f0, 0xc1dcbbb8, 0x6e30e3d4, 0xd8de1a1e, 0xcdb1fd39
+      },
+      { // 876
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x98000000, 0x34000000, 0x12000000, 0x2f000000,
+        0x1b800000, 0x99400000, 0x75a00000, 0x6db00000, 0x00180000, 0xefbc0000, 0x910a0000, 0x64970000,
+        0x736c8000, 0x1d424000, 0x9fa4e000, 0x26b0f000, 0x619fc800, 0xf5f9f400, 0xd92ece00, 0xad602b00,
+        0x3251f280, 0x1d8e5c40, 0xe2563aa0, 0xb58ba870, 0xee52f488, 0x638c834c, 0x4b57862e, 0x630c9f01
+      },
+      { // 877
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x08000000, 0xc4000000, 0x1e000000, 0x33000000,
+        0x75800000, 0x08400000, 0x4c200000, 0x66b00000, 0x86f80000, 0x00dc0000, 0x836a0000, 0xe7110000,
+        0x14098000, 0xe803c000, 0x9404e000, 0x76059000, 0x6703c800, 0x63828400, 0xff445600, 0x27a17f00,
+        0x5df08e80, 0xbf5ecf40, 0x6e2b46a0, 0x49b04b70, 0x817d10b8, 0x119c3454, 0x0fce1e3a, 0x03603b25
+      },
+      { // 878
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xe8000000, 0x34000000, 0xda000000, 0x01000000,
+        0x5d800000, 0x57c00000, 0x69a00000, 0x14500000, 0xac680000, 0xa3cc0000, 0xe89a0000, 0x5a730000,
+        0x7efd8000, 0xf380c000, 0x6cc26000, 0x45213000, 0xa615f800, 0x4e0b7400, 0x303dfa00, 0x8ba7cf00,
+        0x09565980, 0x3fefe0c0, 0x7f0ba1a0, 0x35b894f0, 0x70645ba8, 0x36f05be4, 0x2cbd8212, 0x61e07b29
+      },
+      { // 879
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x68000000, 0xfc000000, 0x4a000000, 0xdf000000,
+        0x2b800000, 0x11400000, 0x92200000, 0x06500000, 0x6bc80000, 0x97ec0000, 0x70ba0000, 0x89f30000,
+        0x29d88000, 0xba81c000, 0x2bc52000, 0x79e7f000, 0x5fb4c800, 0xc47eb400, 0x3b94ce00, 0xb7291700,
+        0x74dfd180, 0x820321c0, 0x130319a0, 0x298195f0, 0xc245d7a8, 0x9ba782cc, 0x34108632, 0x986a6333
+      },
+      { // 880
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x18000000, 0x14000000, 0xde000000, 0xfb000000,
+        0xb5800000, 0xcac00000, 0xe9200000, 0x8d700000, 0x19680000, 0x6b4c0000, 0xe3ba0000, 0x58130000,
+        0x867d8000, 0x3ab74000, 0x4acce000, 0x377b9000, 0x6a310800, 0xee8b4400, 0xf11b0200, 0xdca20300,
+        0x87b5cc80, 0xd04b95c0, 0xb63ec4a0, 0xe2d3d1f0, 0x275846a8, 0xbbc692e4, 0x99a16a2e, 0x79369721
+      },
+      { // 881
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x08000000, 0xf4000000, 0xe2000000, 0xfb000000,
+        0x2e800000, 0xa7400000, 0xc7200000, 0xd0100000, 0xabd80000, 0x5ffc0000, 0x356e0000, 0x8bf70000,
+        0x90288000, 0xa7d6c000, 0x36be6000, 0x274df000, 0xb062e800, 0x2f32fc00, 0xa7ceb600, 0x9222a700,
+        0x7b97bb80, 0x9f1d2340, 0x701b53a0, 0xac98df50, 0xa8dd65a8, 0xcd7cb84c, 0xa42cbe2a, 0x25d06b31
+      },
+      { // 882
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0xf8000000, 0x14000000, 0xee000000, 0x97000000,
+        0xb5800000, 0xb6400000, 0x2b600000, 0xe5900000, 0x4e980000, 0xbafc0000, 0xc6ea0000, 0xa4310000,
+        0x7cac8000, 0x85514000, 0x7838e000, 0xcd4f1000, 0xd700e800, 0x1584a400, 0xe6468600, 0xe3607500,
+        0x09901d80, 0xb49e7f40, 0xc3faf5a0, 0xe46bdb70, 0xa7f0f3b8, 0xe18aee7c, 0x4ba00e06, 0xd3378139
+      },
+      { // 883
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x78000000, 0x7c000000, 0x9e000000, 0x29000000,
+        0x32800000, 0x64400000, 0x24a00000, 0xd5500000, 0xb4580000, 0xa5fc0000, 0xac2a0000, 0xcd350000,
+        0xb2ec8000, 0x49d54000, 0x411ba000, 0x2fdfd000, 0x3339d800, 0x0ccaec00, 0x8cc09e00, 0xabe02300,
+        0x24774580, 0xd6cae940, 0x67c49da0, 0x7e650570, 0x93b08398, 0xa0ac665c, 0x10766606, 0x8ccc5f03
+      },
+      { // 884
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x68000000, 0x44000000, 0x92000000, 0x77000000,
+        0x21800000, 0xa1c00000, 0x9fa00000, 0x7b900000, 0x68e80000, 0x7c4c0000, 0x685a0000, 0x08710000,
+        0x5b1c8000, 0x4595c000, 0x09eee000, 0xd8caf000, 0xaf1e8800, 0x7f946400, 0x5ae91a00, 0x5b49af00,
+        0x11db7780, 0x85b19ac0, 0x12bfffa0, 0xdb04fef0, 0x378265b8, 0x24c491fc, 0xf925f222, 0x93d2fb2d
+      },
+      { // 885
+        0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x18000000, 0xf4000000, 0x82000000, 0x7f000000,
+        0x6b800000, 0x3c400000, 0x13a00000, 0xaa700000, 0x40c80000, 0xde6c0000, 0xb89a0000, 0xbb950000,
+        0x381e8000, 0x5e544000, 0x90fee000, 0x88007000, 0xdc01c800, 0x8e037400, 0xf9016600, 0x8e86f300,
+        0xdcc07480, 0xc66084c0, 0xfa93bca0, 0x929af0f0, 0x08965a98, 0x359d43cc, 0x77164e1e, 0x7bd9f731
+      },
+      { // 886
+        0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0x08000000, 0xfc000000, 0x8e000000, 0x83000000,
+        0xa0800000, 0x6cc00000, 0x1a600000, 0x90900000, 0x89580000, 0x263c0000, 0x812e0000, 0x66330000,
+        0x43ac8000, 0x9ff2c000, 0x5e4e2000, 0xc922d000, 0x58b60800, 0x34682c00, 0x01121a00, 0xa8188100,
+        0xa31dc980, 0xbf9ce940, 0xfd5dc1a0, 0x143bc550, 0x2c2d5b88, 0x35b2844c, 0x87ea320a, 0x15527d33
+      },
+      { // 887
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x58000000, 0x34000000, 0xba000000, 0x21000000,
+        0xa5800000, 0x6fc00000, 0x0ba00000, 0x58b00000, 0x99e80000, 0x9d4c0000, 0x0b7a0000, 0x11d50000,
+        0xf17f8000, 0x10d74000, 0x64fbe000, 0xf715b000, 0x035df800, 0x21a03400, 0x01b67a00, 0x386e1f00,
+        0xc08bce80, 0x4dde6bc0, 0x62e436a0, 0x9c575ff0, 0x02bfcc98, 0xfd7700c4, 0x1b4a620e, 0x3c7e9b09
+      },
+      { // 888
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x98000000, 0x6c000000, 0x22000000, 0xd1000000,
+        0x98800000, 0xb4400000, 0xd1e00000, 0x37700000, 0x52980000, 0xb47c0000, 0x5c8e0000, 0x9dd70000,
+        0x978e8000, 0x48544000, 0x21482000, 0x20f3b000, 0xe55b7800, 0x4c5a9c00, 0x68df0e00, 0xf69d3900,
+        0xb27dfe80, 0xcb8e3440, 0xb25086a0, 0xbc4fa850, 0x2a7708a8, 0x181dd17c, 0x693a560e, 0xc9ef1527
+      },
+      { // 889
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x28000000, 0xe4000000, 0xca000000, 0x7b000000,
+        0x82800000, 0x43c00000, 0xe0e00000, 0x26100000, 0xe1780000, 0xd31c0000, 0x2eca0000, 0x43570000,
+        0xe8588000, 0xbeebc000, 0x3327e000, 0xfef33000, 0xdb6c2800, 0x44675c00, 0x80d5b200, 0xba1d7d00,
+        0xdb4e2180, 0x0c15b040, 0x8a7a89a0, 0xa9992c70, 0xd108db88, 0xa5b7616c, 0x9b4ad202, 0x6c158d15
+      },
+      { // 890
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xe8000000, 0x04000000, 0xae000000, 0x35000000,
+        0xcd800000, 0xba400000, 0x41e00000, 0x9ab00000, 0xb5c80000, 0x01ac0000, 0x9d5a0000, 0xbb770000,
+        0x676a8000, 0xf57fc000, 0xa764e000, 0xf0711000, 0x27e87800, 0xfeb87400, 0x2ec77600, 0x5c27e100,
+        0x5a135080, 0xa61a70c0, 0xb111a8a0, 0xd69dc4f0, 0x52d23e88, 0x5b3b35fc, 0x50811632, 0x13c5313d
+      },
+      { // 891
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x68000000, 0x54000000, 0xc2000000, 0xf1000000,
+        0xf5800000, 0x0d400000, 0x05200000, 0x24f00000, 0x25780000, 0xe1dc0000, 0xba6a0000, 0xe3350000,
+        0xf79a8000, 0xcfcbc000, 0x6d006000, 0x3386f000, 0xc647b800, 0x4da6f400, 0x2231ae00, 0x4a1b5f00,
+        0x068cfc80, 0xb2220140, 0xda71c4a0, 0x80bf3570, 0x92380a98, 0x99fe9a6c, 0x75194e02, 0xdc0f6f39
+      },
+      { // 892
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0xe8000000, 0x14000000, 0x56000000, 0x19000000,
+        0xef800000, 0xc1c00000, 0x3b200000, 0xa3500000, 0x31e80000, 0x994c0000, 0xf9de0000, 0x1c130000,
+        0x00898000, 0x0ef8c000, 0x65476000, 0x52625000, 0xcb315800, 0xe9dcc400, 0x14125a00, 0x6488bb00,
+        0x60f9b580, 0x804278c0, 0xffe16da0, 0x45f67cd0, 0x247c5788, 0x990097e4, 0xaf82ba32, 0x61c12b21
+      },
+      { // 893
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xb8000000, 0x2c000000, 0x2e000000, 0x1f000000,
+        0x20800000, 0x18c00000, 0x46600000, 0x82100000, 0x32980000, 0xe07c0000, 0x88aa0000, 0x45510000,
+        0xdcbf8000, 0xe4c84000, 0x02442000, 0x83a0d000, 0xb5f16800, 0xc7cfcc00, 0x14c19a00, 0x9865e100,
+        0x15146d80, 0xd61ccb40, 0x42ba85a0, 0xd3cb4770, 0xd6c73fb8, 0xc9627664, 0x7a903a16, 0x565c712f
+      },
+      { // 894
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x18000000, 0x9c000000, 0x96000000, 0xb7000000,
+        0x99800000, 0x55c00000, 0x17600000, 0xedd00000, 0xeb780000, 0x139c0000, 0x8c8e0000, 0x91150000,
+        0x769f8000, 0x88094000, 0xcc54a000, 0xd2b99000, 0x3afc6800, 0x825d8400, 0xf1eafa00, 0x8dc50900,
+        0xab633380, 0xcbd05a40, 0x9478dba0, 0x0e189e50, 0xd34881b8, 0xa7710764, 0xb5c85a3e, 0xaf359903
+      },
+      { // 895
+        0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x08000000, 0xe4000000, 0xda000000, 0x6b000000,
+        0xea800000, 0x70c00000, 0xbea00000, 0xd6b00000, 0x97080000, 0x492c0000, 0x5c5a0000, 0x63750000,
+        0x4a2e8000, 0x62dcc000, 0x21b2e000, 0x8b88b000, 0x8cee2800, 0x497f1c00, 0x4c85ea00, 0x1dc65700,
+        0xe9258e80, 0xe9f314c0, 0x0aed26a0, 0x347cc8f0, 0xe3002c98, 0xce872fcc, 0x4ac50a1a, 0x25a7e735
+      },
+      { // 896
+        0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0xf8000000, 0xcc000000, 0x52000000, 0x19000000,
+        0xcf800000, 0x6ac00000, 0x47e00000, 0x96900000, 0x13080000, 0x416c0000, 0x803e0000, 0xdd530000,
+        0xb76d8000, 0x1f3c4000, 0x65d52000, 0xf12c3000, 0xd09fb800, 0x8fe76400, 0x12934200, 0x850c6500,
+        0x6e6ec580, 0x30bf07c0, 0xff14fda0, 0x1ec823d0, 0x720c9f88, 0x02eb76c4, 0x18f86236, 0xd3b35537
+      },
+      { // 897
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x68000000, 0xd4000000, 0x62000000, 0x73000000,
+        0x41800000, 0x94400000, 0xc5600000, 0x06f00000, 0x95e80000, 0x970c0000, 0xecbe0000, 0x52b50000,
+        0x708f8000, 0x21fac000, 0xc1556000, 0x79bff000, 0x2a37a800, 0x624d4400, 0x835fd600, 0x8d85b500,
+        0xba407680, 0xd86007c0, 0x3a705ea0, 0xed2b83d0, 0x42ace8b8, 0xebe8c6e4, 0xa20ab622, 0x643a4511
+      },
+      { // 898
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x98000000, 0x9c000000, 0x6a000000, 0x27000000,
+        0x9d800000, 0x54c00000, 0x6b200000, 0xde500000, 0xff580000, 0xa7fc0000, 0x9c6e0000, 0x68970000,
+        0xf77f8000, 0x322d4000, 0xeaf2a000, 0x86c87000, 0xe0070800, 0xf004c400, 0x28065200, 0x94062300,
+        0x6e01a580, 0xd1036540, 0xd0812da0, 0xee46e150, 0xa263dfa8, 0xe1b3b274, 0x4a2cf20e, 0x86f25313
+      },
+      { // 899
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x88000000, 0x64000000, 0x3e000000, 0x0b000000,
+        0xf3800000, 0xd3400000, 0x57e00000, 0xe1700000, 0xd5f80000, 0xd39c0000, 0xc8aa0000, 0x50330000,
+        0x8b1f8000, 0x3869c000, 0x7c95e000, 0x49899000, 0xbae70800, 0x15f4f400, 0x9f3f3e00, 0xfa3de900,
+        0x6abcc680, 0x1e7cff40, 0x3cdc4ea0, 0x6d4dcb70, 0xf04490a8, 0x1066b274, 0xa432de0a, 0xfd18792d
+      },
+      { // 900
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x28000000, 0xa4000000, 0xc2000000, 0xd5000000,
+        0x29800000, 0x3cc00000, 0x97600000, 0x38700000, 0x18c80000, 0x4b2c0000, 0xda1a0000, 0x47710000,
+        0xe04a8000, 0x0c69c000, 0x7cb9e000, 0x4de37000, 0x9a371800, 0xdfec3400, 0x2979e200, 0xdd046100,
+        0xdd840680, 0x46c0cac0, 0x3e639ea0, 0x5ff43ef0, 0x97091cb8, 0xe2caefcc, 0x222be232, 0xdd996125
+      },
+      { // 901
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0x28000000, 0x9c000000, 0xd2000000, 0xef000000,
+        0xe3800000, 0x56400000, 0x50e00000, 0x0e700000, 0xd3280000, 0x934c0000, 0xbafe0000, 0xa0770000,
+        0x3e2e8000, 0x27c9c000, 0x0b3e2000, 0xc0d43000, 0xc1bb8800, 0x24173400, 0x1198f600, 0x0c411900,
+        0xd3e2ce80, 0x37f2d9c0, 0x4669c6a0, 0xda2b2dd0, 0x91c990a8, 0x123bc4fc, 0x1a50f622, 0xfd7d191b
+      },
+      { // 902
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x08000000, 0x94000000, 0xda000000, 0xdb000000,
+        0x09800000, 0x04400000, 0x58a00000, 0xbf300000, 0xff280000, 0x390c0000, 0x0dfa0000, 0x5b310000,
+        0xdd2f8000, 0x4e0dc000, 0x127c6000, 0xc2733000, 0x190b2800, 0xfdfd8400, 0x6332d600, 0x112d9b00,
+        0x080e3680, 0x877841c0, 0xcaf09ea0, 0xcfc905f0, 0xa899a8b8, 0x80e66ee4, 0x0992d63a, 0x711d9b01
+      },
+      { // 903
+        0x80000000, 0x40000000, 0x20000000, 0x50000000, 0xe8000000, 0x5c000000, 0xee000000, 0x6d000000,
+        0x38800000, 0x8f400000, 0x7aa00000, 0x1d900000, 0x69580000, 0x587c0000, 0x672e0000, 0x57170000,
+        0x05198000, 0x0758c000, 0x75792000, 0x7fadd000, 0x88537800, 0x97bb1c00, 0x46ccf600, 0xf2203b00,
+        0x4ad5fb80, 0xd7fccf40, 0x4fe903a0, 0x39741350, 0xe8eb55a8, 0x56f63844, 0xf02d7612, 0xa094fb13
+      },
+      { // 904
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0xb8000000, 0x7c000000, 0x66000000, 0xb9000000,
+        0x51800000, 0x69400000, 0x23a00000, 0xb8f00000, 0x4bf80000, 0xfedc0000, 0xebee0000, 0x45770000,
+        0x9cbb8000, 0x28784000, 0xcc98a000, 0x1aca1000, 0x0a429800, 0xcd223400, 0x0933ae00, 0xf89d4b00,
+        0xc8cb4880, 0x21471140, 0x97a450a0, 0x2af66550, 0x40fadea8, 0xb45e7e54, 0x70282e06, 0x81150b0b
+      },
+      { // 905
+        0x80000000, 0xc0000000, 0x60000000, 0xb0000000, 0x18000000, 0x64000000, 0x12000000, 0x23000000,
+        0xfb800000, 0x81400000, 0x57200000, 0xb6d00000, 0xa3980000, 0x163c0000, 0x452a0000, 0xdd510000,
+        0x2ad88000, 0xed1a4000, 0x2dfc6000, 0x33ca7000, 0x92662800, 0xe3f61400, 0xfe4fae00, 0x82239f00,
+        0xbc576d80, 0x9a5c6740, 0x8bdbc5a0, 0x3d9d3370, 0xfb3a8bb8, 0x3baf9c5c, 0x3e972e3e, 0x5839df05
+      },
+      { // 906
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x98000000, 0x84000000, 0x6a000000, 0x85000000,
+        0x31800000, 0xf2c00000, 0x14600000, 0xf1500000, 0x94180000, 0x9afc0000, 0x67ea0000, 0x71d50000,
+        0x65588000, 0x9d5e4000, 0xe95b6000, 0xfb5eb000, 0xca5fd800, 0x09deb400, 0xfa1e5200, 0xb5f98900,
+        0x336ba780, 0x82911d40, 0x1bfeffa0, 0xfc68e970, 0xe6114d98, 0x70b8907c, 0x06ccd23e, 0xed22c91d
+      },
+      { // 907
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xc8000000, 0x44000000, 0xe2000000, 0x7b000000,
+        0xf9800000, 0x7cc00000, 0x7aa00000, 0x7fb00000, 0xf0b80000, 0x1e9c0000, 0xf56e0000, 0xe5370000,
+        0xa9fa8000, 0x66fac000, 0xd57be000, 0x86bc7000, 0x1f986800, 0xebebc400, 0x3e751200, 0xba9e0f00,
+        0x476fe680, 0x46374940, 0xec7b0ea0, 0x743d4d50, 0x72d97ca8, 0x998ef25c, 0x1161921a, 0x0a93cf0d
+      },
+      { // 908
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x98000000, 0xe4000000, 0xc2000000, 0xb9000000,
+        0x7d800000, 0x6cc00000, 0x13200000, 0xf2f00000, 0xe1b80000, 0xc01c0000, 0x90aa0000, 0x26750000,
+        0xd8fa8000, 0x23fc4000, 0x277a6000, 0xd638f000, 0xd9da7800, 0xa00a7400, 0x57402200, 0xb4e76300,
+        0x5d50d080, 0x96085740, 0x044228a0, 0xec676370, 0x1a10ea98, 0x0aedb06c, 0xc510a23e, 0x2c6e2315
+      },
+      { // 909
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0xd8000000, 0x74000000, 0x92000000, 0x1b000000,
+        0x77800000, 0xc0400000, 0xbd600000, 0x15f00000, 0xcbe80000, 0x36cc0000, 0xde5e0000, 0x20470000,
+        0xcd638000, 0xfdf74000, 0x77ede000, 0x08cdf000, 0x2359e800, 0xdec0f400, 0x61a6e600, 0xf7571500,
+        0x1f3ea680, 0x6bb6ebc0, 0xcb8aaea0, 0xfdbbefd0, 0xa975a0a8, 0xc42c0ed4, 0x0fede01e, 0x2ccdf009
+      },
+      { // 910
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x48000000, 0x6c000000, 0xb2000000, 0x37000000,
+        0x28800000, 0x12c00000, 0x05e00000, 0xb3100000, 0xb8180000, 0xff3c0000, 0x61ce0000, 0xb6c70000,
+        0x9be78000, 0x1617c000, 0x379da000, 0x8d78b000, 0x1ae94800, 0xb2326c00, 0xa7efea00, 0x79b23d00,
+        0xbbaa8180, 0x5f91c740, 0x84de69a0, 0x87db1b50, 0x7958cba8, 0xa29b4a74, 0x9afda03a, 0x6ca8b02f
+      },
+      { // 911
+        0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0xd8000000, 0x5c000000, 0x9e000000, 0xf5000000,
+        0x53800000, 0x32c00000, 0xc2200000, 0x17100000, 0xaf280000, 0x97cc0000, 0x56fe0000, 0x24c30000,
+        0x83248000, 0xfe904000, 0xdaefa000, 0xb56cd000, 0x89afb800, 0xb68ac400, 0x061c2200, 0x81f35b00,
+        0xe31f9f80, 0x9a7180c0, 0x85df87a0, 0x325794d0, 0x7dcc1d88, 0xf9fe0bcc, 0xe047a03e, 0xf960d01b
+      },
+      { // 912
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x68000000, 0xbc000000, 0x62000000, 0x3d000000,
+        0xc3800000, 0xc6400000, 0x4ae00000, 0x56100000, 0x8a880000, 0x1a2c0000, 0xd4de0000, 0x7d470000,
+        0x62648000, 0x60d5c000, 0x02a92000, 0xea19b000, 0x99611800, 0x6857e400, 0xc46f4600, 0x0a3ab900,
+        0xd5567580, 0x47e943c0, 0xec7e4da0, 0x6fb717d0, 0x79f813a8, 0xdaf64aec, 0x179f2032, 0x9022b003
+      },
+      { // 913
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x78000000, 0xa4000000, 0x7a000000, 0x4b000000,
+        0x7f800000, 0xf6400000, 0x1c200000, 0xa4f00000, 0x6e680000, 0x100c0000, 0x1ada0000, 0x37450000,
+        0x00a58000, 0x11304000, 0xca0a6000, 0xe1d93000, 0x40c6a800, 0xbae37400, 0xab159600, 0xfbfbef00,
+        0xc1309480, 0x920e45c0, 0x35dc5ca0, 0xd2c401f0, 0x2de76298, 0x0a909ad4, 0x3cb86006, 0xe990303d
+      },
+      { // 914
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0xe8000000, 0x74000000, 0xd2000000, 0xcd000000,
+        0x9e800000, 0x55c00000, 0x8f600000, 0x4ed00000, 0xa4980000, 0xb23c0000, 0xdd8e0000, 0x6cc30000,
+        0x83e38000, 0x7616c000, 0x25786000, 0x412e7000, 0x82755800, 0x422b0c00, 0x37f5b200, 0x366be100,
+        0x2ed14380, 0xd4989940, 0x6a3c7ba0, 0xd18de550, 0x22c49188, 0xe8e10874, 0xf7966032, 0x233d7029
+      },
+      { // 915
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0xb8000000, 0x4c000000, 0x1a000000, 0xd5000000,
+        0xb5800000, 0xeec00000, 0x2fa00000, 0xe2900000, 0xa0280000, 0xcb4c0000, 0xab7a0000, 0x70410000,
+        0xdfe48000, 0xfd774000, 0x3d5e2000, 0xc6137000, 0xd56a1800, 0xe92cd400, 0x2ccff200, 0x04bf6700,
+        0x8c63ff80, 0xa4b2f8c0, 0x5e7fc7a0, 0x55c15cf0, 0xd9202db8, 0x16d3effc, 0x31c8a016, 0xe539302f
+      },
+      { // 916
+        0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x68000000, 0xbc000000, 0xc6000000, 0xa9000000,
+        0xb3800000, 0xb7c00000, 0x10e00000, 0xccf00000, 0x9d680000, 0x144c0000, 0x9d5e0000, 0x59410000,
+        0x7ea08000, 0x3cd1c000, 0x3ffb2000, 0x53949000, 0x605c9800, 0xd0c5e400, 0x4662ea00, 0x86b4e500,
+        0x9f4b3e80, 0xd5db7bc0, 0x6e0486a0, 0xb5060fd0, 0x2584f498, 0xc6c60efc, 0x7765a002, 0x01345013
+      },
+      { // 917
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xc8000000, 0xa4000000, 0x6a000000, 0xa3000000,
+        0xc5800000, 0x82c00000, 0x66a00000, 0x89900000, 0x07080000, 0x716c0000, 0x715e0000, 0x64450000,
+        0x61e68000, 0x0df2c000, 0x183ce000, 0x37f43000, 0xa3396800, 0x0e776400, 0xd7faa200, 0xcdd04f00,
+        0xf6ebcf80, 0x449d51c0, 0x056647a0, 0x9db205d0, 0x0bdb8db8, 0x65002eec, 0x8884600a, 0x1e43f005
+      },
+      { // 918
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0xc8000000, 0x64000000, 0x8e000000, 0x3f000000,
+        0xd1800000, 0xa4c00000, 0xf5a00000, 0xb8500000, 0xd1e80000, 0xe28c0000, 0x1a7a0000, 0xc3470000,
+        0x02608000, 0xd670c000, 0x0c7ee000, 0xe0451000, 0x51e0a800, 0xd7b60400, 0x5159d200, 0x76564700,
+        0x8eea6980, 0xe30990c0, 0x06bc21a0, 0x9ae684f0, 0x50375b88, 0xb69dc7ec, 0x0076603a, 0x8f79d035
+      },
+      { // 919
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0x88000000, 0x14000000, 0x0e000000, 0x37000000,
+        0x99800000, 0xafc00000, 0x4c200000, 0xbe900000, 0x23080000, 0xb2ec0000, 0x3d5e0000, 0xe8450000,
+        0x7ce18000, 0x0f37c000, 0xa45c6000, 0x76c09000, 0xb2a36800, 0x60d60400, 0xc4e88a00, 0xc65b9300,
+        0x83c44b80, 0xee27fdc0, 0x6b9343a0, 0x0f8d69d0, 0x21aea1b8, 0x6a39fed4, 0x15b5e01a, 0xac1b5011
+      },
+      { // 920
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0x98000000, 0xcc000000, 0xae000000, 0x31000000,
+        0x7d800000, 0x4bc00000, 0x81200000, 0x1c100000, 0xb3680000, 0x508c0000, 0xbc3a0000, 0xd6830000,
+        0xb5468000, 0xa0644000, 0xfe732000, 0xe21fd000, 0x66169800, 0x20691400, 0x920d3a00, 0x8b7e3b00,
+        0xf9e17780, 0xafb192c0, 0x203ecfa0, 0x308456f0, 0xc043eda8, 0x17e739fc, 0x7eb4800e, 0x4dbb400f
+      },
+      { // 921
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x88000000, 0xac000000, 0x2a000000, 0x53000000,
+        0x85800000, 0x69400000, 0x7ae00000, 0x51100000, 0x3ee80000, 0x264c0000, 0xcc3e0000, 0x7c870000,
+        0xffc38000, 0xb625c000, 0x52b1a000, 0x9d187000, 0xe5b2a800, 0xfe9de400, 0xc5f0fe00, 0xcafe3100,
+        0x5c235580, 0x61b748c0, 0x289e5da0, 0x14f5dcd0, 0xa07f8ba8, 0x12e3c9d4, 0x8d15800a, 0xaceec03f
+      },
+      { // 922
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x78000000, 0x9c000000, 0xca000000, 0xc3000000,
+        0x55800000, 0xedc00000, 0x3ee00000, 0x38100000, 0x87380000, 0xdf1c0000, 0xb86a0000, 0x64870000,
+        0x87438000, 0xfca64000, 0x4037a000, 0x30497000, 0xdbf0a800, 0xd7ace400, 0xad62da00, 0x64d2b500,
+        0x13599980, 0x854c6e40, 0x577491a0, 0x74eefa70, 0xa7c56388, 0x3de6eb74, 0xcd918016, 0x7afd4013
+      },
+      { // 923
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0xd8000000, 0x74000000, 0x0a000000, 0x33000000,
+        0xe6800000, 0x65400000, 0x8ba00000, 0x76300000, 0x97380000, 0x0edc0000, 0x17ca0000, 0xac870000,
+        0x36438000, 0xdd234000, 0xdb75e000, 0xb09d3000, 0x06ee6800, 0xb9f4fc00, 0x77de8600, 0xa249c300,
+        0x9f408680, 0x10a53540, 0x8cb10ea0, 0x447bf970, 0x107a6088, 0xca798674, 0x817b803e, 0x03ff4029
+      },
+      { // 924
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x18000000, 0x1c000000, 0x8e000000, 0x1f000000,
+        0x5b800000, 0x9dc00000, 0x28e00000, 0x19b00000, 0x11c80000, 0xe5ec0000, 0x683a0000, 0x0a030000,
+        0x4d038000, 0xea854000, 0x4944a000, 0xf6a45000, 0xb0946800, 0xae9e5400, 0xf292ca00, 0xc7997500,
+        0x1a106480, 0x07db84c0, 0xb432aca0, 0xff0e80f0, 0xb08d8ea8, 0x674fe1d4, 0xe2a8002e, 0xa19c0013
+      },
+      { // 925
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xc8000000, 0x7c000000, 0x3e000000, 0x29000000,
+        0xe8800000, 0xce400000, 0x38a00000, 0xad500000, 0xa3580000, 0xcabc0000, 0xc2ca0000, 0x24050000,
+        0x4a018000, 0x8b01c000, 0xef852000, 0xc7c45000, 0x62635800, 0x65b7fc00, 0x1fa87e00, 0x2c34f300,
+        0x656cdd80, 0x14d2b540, 0x0198a5a0, 0x46581970, 0xe4380398, 0x618fd674, 0x6e20002a, 0x8a10002b
+      },
+      { // 926
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0x88000000, 0xb4000000, 0xf6000000, 0x0f000000,
+        0x52800000, 0xb7c00000, 0xfaa00000, 0x2ed00000, 0xefe80000, 0xb38c0000, 0x1e7a0000, 0xa4050000,
+        0x5e038000, 0x0b01c000, 0x7c836000, 0x84c65000, 0xea226800, 0x60155c00, 0x48cf5200, 0x781cff00,
+        0xbcf11d80, 0xc3f8dcc0, 0x814215a0, 0xf362d0f0, 0x8f76af98, 0x35bfb3e4, 0x6ca0003a, 0xb1d00009
+      },
+      { // 927
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0xd8000000, 0xcc000000, 0xf2000000, 0xcb000000,
+        0x51800000, 0x6c400000, 0x9d200000, 0xac100000, 0x86d80000, 0xc2bc0000, 0x3b0a0000, 0x77010000,
+        0xbb828000, 0x0b424000, 0xcea72000, 0xd3573000, 0x867fa800, 0xf0ef4400, 0xebf5b600, 0x48280700,
+        0x6a126b80, 0x23daff40, 0xe238e3a0, 0x29cf8b70, 0x31e27db8, 0x13f7884c, 0xd42a000e, 0xd011003f
+      },
+      { // 928
+        0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0x18000000, 0xc4000000, 0xf2000000, 0x29000000,
+        0x92800000, 0xd2400000, 0x2ae00000, 0x72100000, 0x4ab80000, 0x7d1c0000, 0x246e0000, 0xb9010000,
+        0x3a828000, 0xee404000, 0xece16000, 0xb1117000, 0x3538f800, 0xcfde4c00, 0xf5cd4e00, 0x73725100,
+        0xd06ed580, 0xf304d240, 0xc7814da0, 0x66c6ee50, 0xcba07b98, 0x3f77b36c, 0x4e6e001e, 0x1401001d
+      },
+      { // 929
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0xd8000000, 0xdc000000, 0x92000000, 0x3f000000,
+        0xee800000, 0x79400000, 0xce200000, 0x35500000, 0xad780000, 0x149c0000, 0x26aa0000, 0xc8a10000,
+        0xe8168000, 0x3d5e4000, 0x24cfa000, 0x5e56b000, 0x05fe8800, 0xd4de9c00, 0xdf0a0600, 0xc333ef00,
+        0x6d88e180, 0xe8759840, 0xfcaf49a0, 0x43a3f470, 0xf09467b8, 0x4518376c, 0x7168080e, 0x1fc0dc1b
+      },
+      { // 930
+        0x80000000, 0xc0000000, 0xe0000000, 0x50000000, 0xf8000000, 0x44000000, 0x9e000000, 0x7f000000,
+        0x6f800000, 0x0c400000, 0x95e00000, 0xad700000, 0x1ad80000, 0x1cfc0000, 0xa02a0000, 0x8e650000,
+        0x57338000, 0xac3a4000, 0x540b6000, 0xafb31000, 0x53fc2800, 0xa7adf400, 0xde27a600, 0x48d35100,
+        0x184af680, 0x1a575a40, 0x4e8e3ea0, 0x1573fe70, 0x7eded098, 0x32fe4b64, 0x772fa826, 0x5de7b435
+      },
+      { // 931
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xb8000000, 0xac000000, 0xe6000000, 0xa1000000,
+        0xc9800000, 0xbb400000, 0x4ae00000, 0xddb00000, 0x71580000, 0xe17c0000, 0x396a0000, 0xe5630000,
+        0x07f58000, 0xd23e4000, 0xd78e2000, 0xbad59000, 0x75a85800, 0xa9c3f400, 0x7727de00, 0x20906100,
+        0x36c9b080, 0xef34c840, 0x1c9a48a0, 0xa45cec70, 0xd2fbeea8, 0x0d2ae964, 0x8305d806, 0x5a81b40f
+      },
+      { // 932
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x68000000, 0xc4000000, 0x1a000000, 0x05000000,
+        0xc2800000, 0x1ac00000, 0xeaa00000, 0xf5300000, 0xc7480000, 0xb1ac0000, 0x6efa0000, 0x13270000,
+        0x22708000, 0x48adc000, 0xaa7ae000, 0x1ae7b000, 0xa155d800, 0x12d86c00, 0x9ed22a00, 0x769af700,
+        0x08b7da80, 0xaa0bbec0, 0x4b4862a0, 0xdfa9a2f0, 0xb9fd7088, 0x60a089ec, 0x88375812, 0x79ceac1d
+      },
+      { // 933
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0xf8000000, 0xb4000000, 0x4e000000, 0x8f000000,
+        0x30800000, 0xa7400000, 0x47200000, 0xf5300000, 0x79f80000, 0x2d1c0000, 0x5e4e0000, 0x76a70000,
+        0x8df78000, 0x191a4000, 0x504ae000, 0xd9a61000, 0x2d70a800, 0x465a0c00, 0xa36f8600, 0x6292e700,
+        0xdb8c7a80, 0x5bc1d740, 0x5a61b2a0, 0x53178b50, 0xa34c7ca8, 0x3b257074, 0x27312816, 0xd4fb4c19
+      },
+      { // 934
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x58000000, 0x24000000, 0xca000000, 0x07000000,
+        0xa7800000, 0x34c00000, 0x56e00000, 0x3db00000, 0x86b80000, 0xcf1c0000, 0xe68a0000, 0x42670000,
+        0x2cf08000, 0x4f9c4000, 0xc5cc6000, 0xd847b000, 0x13a44800, 0x6695d400, 0xaf6de200, 0x9c51cd00,
+        0x848b8c80, 0xf9600740, 0xc57324a0, 0xc65e2370, 0x6baeee88, 0x52b18a6c, 0x3d3ec81e, 0xc5de9425
+      },
+      { // 935
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0x78000000, 0x74000000, 0x26000000, 0xc7000000,
+        0xb2800000, 0x7c400000, 0xc6600000, 0xe8b00000, 0xcbf80000, 0x655c0000, 0x30ca0000, 0x07610000,
+        0xcd328000, 0xed3f4000, 0x237be000, 0x341b5000, 0xb12da800, 0x30141c00, 0xb1690e00, 0x1c70a500,
+        0xacda4480, 0x740f4140, 0xb8468ca0, 0x38634d70, 0xcbb3cab8, 0xd77da44c, 0xd21fa826, 0x16291c11
+      },
+      { // 936
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x38000000, 0x0c000000, 0x4a000000, 0xfb000000,
+        0x94800000, 0x23c00000, 0xb8600000, 0x88d00000, 0xeca80000, 0x898c0000, 0x11fe0000, 0x51610000,
+        0x7b538000, 0xc9e84000, 0x352b2000, 0xc7cdf000, 0xe1dce800, 0x7896ac00, 0x01882200, 0xb5fc5900,
+        0xcf63eb80, 0x1657c8c0, 0xd46fa3a0, 0x7568d4d0, 0x82ee4998, 0x09aed1e4, 0x300ae816, 0xcfbbac27
+      },
+      { // 937
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xa8000000, 0x14000000, 0x66000000, 0x5f000000,
+        0x09800000, 0x18c00000, 0x17600000, 0xf2500000, 0x99480000, 0x116c0000, 0x079a0000, 0xa4610000,
+        0xe1d38000, 0xcc88c000, 0xe68f6000, 0x138cd000, 0x2f086800, 0x6b4e0400, 0xe868b200, 0x311a5100,
+        0x6526bf80, 0x46744bc0, 0x3dba37a0, 0xeb925ff0, 0xc4af8db8, 0x307bdac4, 0xd0726812, 0xbabf0401
+      },
+      { // 938
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x98000000, 0xbc000000, 0xa6000000, 0x4b000000,
+        0xea800000, 0x0e400000, 0x79a00000, 0xdf900000, 0xf1980000, 0x6efc0000, 0x578a0000, 0xa7a70000,
+        0xf8968000, 0x351c4000, 0xbfb8a000, 0x46ae1000, 0x27758800, 0x772ebc00, 0x2bb53e00, 0x84ce4b00,
+        0x27805380, 0xdfc3b540, 0xa563fba0, 0xa4735970, 0x69a9ed88, 0xb7f6be5c, 0x846d882e, 0xdb92bc33
+      },
+      { // 939
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xd8000000, 0x24000000, 0xc2000000, 0x65000000,
+        0xfa800000, 0x45400000, 0x1d200000, 0x12900000, 0x3ba80000, 0x074c0000, 0xfeba0000, 0xbf250000,
+        0xa7918000, 0xf9294000, 0x760b6000, 0xf99bf000, 0xecb11800, 0xa4bb6c00, 0xde239600, 0x6f147700,
+        0x116ca780, 0x6da938c0, 0x484f5fa0, 0x6d3ce4f0, 0x2ee4b198, 0xa4f10ff4, 0x8f19182e, 0x47f76c3d
+      },
+      { // 940
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x98000000, 0x3c000000, 0x6e000000, 0x0f000000,
+        0x7c800000, 0xf2400000, 0x3fe00000, 0xacb00000, 0x30980000, 0x5ebc0000, 0xfb2a0000, 0xe6a50000,
+        0x7dd58000, 0xef6f4000, 0xb245a000, 0x1fe05000, 0xdcb5e800, 0x389c6c00, 0xfabcce00, 0xa92e6900,
+        0x87a57880, 0x0e50e640, 0x61aab0a0, 0x7fe69a70, 0x8cb3b698, 0x409b8f54, 0x56ba483e, 0x5f293c1b
+      },
+      { // 941
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xa8000000, 0x4c000000, 0xa2000000, 0x2b000000,
+        0x2a800000, 0x1ac00000, 0x06600000, 0x73500000, 0x66780000, 0xb35c0000, 0xca2a0000, 0x29a50000,
+        0x5eb48000, 0x126fc000, 0x5906a000, 0xd9843000, 0x34412800, 0x42a09c00, 0x54359a00, 0x58abd100,
+        0x47626f80, 0x4ed7c240, 0xbc3b67a0, 0x78f9ae70, 0x9f9df598, 0x4149135c, 0x05758832, 0x298dac0f
+      },
+      { // 942
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xe8000000, 0xcc000000, 0xb6000000, 0xed000000,
+        0x6a800000, 0x63400000, 0x87600000, 0xc0b00000, 0x3ce80000, 0x274c0000, 0x0d5e0000, 0x0f250000,
+        0x18518000, 0xa19cc000, 0x7d85a000, 0x12c69000, 0x03a7b800, 0x5e110c00, 0xf0786600, 0x90761500,
+        0x604e9480, 0xf4dbb1c0, 0x57e30ca0, 0xd8f5edd0, 0x4c08f2b8, 0x1638a4d4, 0xf1941802, 0x15be9c27
+      },
+      { // 943
+        0x80000000, 0x40000000, 0x60000000, 0xd0000000, 0x38000000, 0xb4000000, 0xfe000000, 0xc5000000,
+        0x9b800000, 0x8cc00000, 0x53200000, 0xb8700000, 0x3af80000, 0xcf9c0000, 0xed8e0000, 0xc5e50000,
+        0xa8578000, 0x080c4000, 0xcc26e000, 0x00f19000, 0xecbf7800, 0x9dff8400, 0xc3195200, 0xc5ca8300,
+        0x52874c80, 0x1d46e540, 0x84e754a0, 0x65d1b150, 0xadc81eb8, 0x9e856664, 0x37419836, 0x6fe21409
+      },
+      { // 944
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0xf8000000, 0xe4000000, 0xd2000000, 0x75000000,
+        0x84800000, 0x89c00000, 0xa5200000, 0x1e300000, 0xd0980000, 0x7ffc0000, 0xecae0000, 0x52670000,
+        0x3bd38000, 0xe90e4000, 0x77946000, 0x0b6c7000, 0xe4471800, 0xde639c00, 0xb5d50200, 0x8a0ae300,
+        0x4414c680, 0x8b2dd440, 0xa8223ea0, 0x3eb77850, 0xab59c4a8, 0xbfdb3754, 0x8e18f816, 0xef3dac2d
+      },
+      { // 945
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0x68000000, 0xfc000000, 0xb2000000, 0xa7000000,
+        0xbd800000, 0x6fc00000, 0x42600000, 0x87900000, 0xac280000, 0xb90c0000, 0x71be0000, 0x0e270000,
+        0xe7308000, 0xc759c000, 0x7ef32000, 0x343b3000, 0xe5e24800, 0xd354c400, 0xb1c9ea00, 0xee5ce100,
+        0xb6758180, 0x117a96c0, 0x6dc269a0, 0xed67a2d0, 0x96146ba8, 0x69ea77cc, 0xc869e832, 0x05aa3433
+      },
+      { // 946
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x48000000, 0x24000000, 0x7e000000, 0x9b000000,
+        0x94800000, 0x5f400000, 0xea600000, 0xf9100000, 0x3f880000, 0x332c0000, 0x949a0000, 0xada70000,
+        0x86348000, 0xd1f8c000, 0x6630e000, 0x41fe9000, 0x7e370800, 0xddfa0c00, 0x6c31c600, 0x1cf9ad00,
+        0x1db2d180, 0x4c3d1fc0, 0x3c13b9a0, 0x000a43f0, 0x10eb1788, 0xf5b8b2cc, 0x88d3681a, 0xffac5c05
+      },
+      { // 947
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x48000000, 0x54000000, 0x5e000000, 0x15000000,
+        0x8d800000, 0x2ec00000, 0xf2600000, 0x0f500000, 0xab080000, 0x192c0000, 0x965a0000, 0x25270000,
+        0xbdf48000, 0xab38c000, 0x94f36000, 0x1cbc1000, 0x1931f800, 0xd25fb400, 0xa326f200, 0xe4f1a900,
+        0x94bb2f80, 0xed3339c0, 0x7c5f37a0, 0xfe235df0, 0x3d75dd88, 0xe47e90cc, 0x0a56181a, 0xfe8b6419
+      },
+      { // 948
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x38000000, 0xec000000, 0x62000000, 0x53000000,
+        0xc4800000, 0x0e400000, 0x6b600000, 0xe4700000, 0x6e980000, 0x763c0000, 0x24ea0000, 0xd9a10000,
+        0xcd578000, 0xb3884000, 0xc7d02000, 0x2ccbb000, 0x0b31e800, 0x6a7b2c00, 0xd48a0e00, 0x1d52ed00,
+        0x4b8bda80, 0x4bd77440, 0x1ecf92a0, 0x6032a870, 0x42f9d4b8, 0xb8c99964, 0x25364836, 0x6b78dc1f
+      },
+      { // 949
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0xa8000000, 0x0c000000, 0x96000000, 0xcd000000,
+        0xe0800000, 0x65400000, 0xbc600000, 0xd7100000, 0x9d480000, 0x73ec0000, 0x865e0000, 0xd8a10000,
+        0x88b78000, 0x4678c000, 0x9153a000, 0xe8ab9000, 0x5b39b800, 0xc9315c00, 0x45ba0600, 0xcd702d00,
+        0x3f590180, 0x4a27f9c0, 0x5af299a0, 0x1198f5d0, 0xa6830798, 0x4047d4c4, 0xb0e39832, 0x74530c07
+      },
+      { // 950
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x68000000, 0x24000000, 0x4a000000, 0xff000000,
+        0xe7800000, 0xb6c00000, 0xf7600000, 0x3ff00000, 0xb9780000, 0xa65c0000, 0x4e8a0000, 0xeb230000,
+        0xead78000, 0x6eaac000, 0xc476e000, 0xe9be3000, 0xf0398800, 0x5bf81400, 0xb01d3200, 0x84af9100,
+        0xeb716280, 0x46399740, 0x72fb8aa0, 0x8e9a7370, 0x54ec50a8, 0x90560674, 0x04eae832, 0x1853e43d
+      },
+      { // 951
+        0x80000000, 0xc0000000, 0x20000000, 0xb0000000, 0x58000000, 0x34000000, 0x9a000000, 0x31000000,
+        0x90800000, 0xc0400000, 0x96600000, 0x0eb00000, 0xbe780000, 0xf0cc0000, 0xaeb20000, 0xce7f0000,
+        0x88c88000, 0x2ab54000, 0x0c7c6000, 0x8dcdf000, 0x20301800, 0xfd396c00, 0x8b2f7600, 0xeec2a900,
+        0xd525aa80, 0x7556f040, 0xfe0adca0, 0xeb945970, 0x532f7628, 0x1ac2a91c, 0x6f25aa9e, 0xf456f061
+      },
+      { // 952
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x48000000, 0xb4000000, 0x1e000000, 0x65000000,
+        0x4f800000, 0xe6c00000, 0xf5a00000, 0x34300000, 0x94c80000, 0x00fc0000, 0xe4360000, 0x8ccb0000,
+        0xecfc8000, 0x3635c000, 0x0bcce000, 0x6c79d000, 0xe4761800, 0x322db400, 0x04ac9a00, 0x57ee8300,
+        0x678fb880, 0x409b9dc0, 0xab2322a0, 0xe3751ed0, 0xf2ac9a28, 0xf6ee831c, 0x5e0fb89a, 0x475b9de1
+      },
+      { // 953
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x58000000, 0x5c000000, 0x62000000, 0xd5000000,
+        0x90800000, 0xeec00000, 0x5c200000, 0xe6d00000, 0x37580000, 0x298c0000, 0xf2d60000, 0x11590000,
+        0xa28b8000, 0x45504000, 0xe2192000, 0xdcea7000, 0x7365f800, 0xbab30c00, 0xb46d8200, 0x71a26f00,
+        0x2c95db80, 0x13bf8e40, 0xb07859a0, 0x00dde150, 0x9acd8238, 0xecb26f34, 0xb76ddb8e, 0xa2238e73
+      },
+      { // 954
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0xe8000000, 0x3c000000, 0xd6000000, 0xed000000,
+        0xf9800000, 0xe4c00000, 0x73200000, 0xe0100000, 0x27b80000, 0xbfac0000, 0x3c120000, 0x21bb0000,
+        0xaaac8000, 0xa190c000, 0xc77da000, 0xde8bd000, 0x83011800, 0x10850400, 0x0f473a00, 0xc8e7a700,
+        0x85b29d80, 0xdde98740, 0xcd75a7a0, 0xe0ce2070, 0xb4673a08, 0x64f7a71c, 0x3c0a9d92, 0x03458763
+      },
+      { // 955
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x98000000, 0x7c000000, 0x2e000000, 0x87000000,
+        0xcb800000, 0xb8400000, 0xc3a00000, 0x14700000, 0x35a80000, 0x7ddc0000, 0x56720000, 0xc4ad0000,
+        0x2d5b8000, 0x9bb24000, 0xa04a2000, 0x4d091000, 0x2c2f0800, 0xac9c4400, 0xb9548e00, 0x331bd700,
+        0xfb107a80, 0x4dbe40c0, 0xf9e4f4a0, 0x46d597f0, 0xe15c8e38, 0x1db7d714, 0x334a7abe, 0xdc8f40fb
+      },
+      { // 956
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x58000000, 0x54000000, 0x2e000000, 0x87000000,
+        0x40800000, 0x94c00000, 0xf2e00000, 0x3eb00000, 0x89f80000, 0x7b4c0000, 0xe8b60000, 0x8afb0000,
+        0x6dc98000, 0x3f704000, 0x4e9b6000, 0x14ba5000, 0x2aed0800, 0x18a15c00, 0xc792f200, 0x71293900,
+        0xe6c0be80, 0x37e00840, 0x33324ca0, 0x3cb93150, 0xd6eaf228, 0x8aa53934, 0xf296be9e, 0x94ab0871
+      },
+      { // 957
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x98000000, 0x3c000000, 0x46000000, 0x15000000,
+        0x44800000, 0x55400000, 0x66600000, 0x21f00000, 0x9ed80000, 0xa92c0000, 0xdaf60000, 0xbb5b0000,
+        0x7ae98000, 0x16d64000, 0x734e2000, 0xfd025000, 0x1080d800, 0x0746ac00, 0x0167de00, 0x9277c100,
+        0xe0195080, 0x8d8b4740, 0x99a68ea0, 0x73d08650, 0x5fc9de28, 0xbc40c134, 0x04e6d0ae, 0xd1b6076b
+      },
+      { // 958
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0xa8000000, 0xcc000000, 0x26000000, 0x49000000,
+        0x6e800000, 0x3f400000, 0x1be00000, 0xbf300000, 0xc4280000, 0x651c0000, 0x4c320000, 0xcdad0000,
+        0xc1df8000, 0x9817c000, 0x7b3e2000, 0x25a0d000, 0xd650b800, 0xaa591c00, 0x2fd15e00, 0x76991d00,
+        0xfff57a80, 0x3a0ee6c0, 0xdc8c24a0, 0x9fcbfbf0, 0x7a2b5e38, 0xf8181d34, 0x10b0fab2, 0xe9e826f7
+      },
+      { // 959
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x28000000, 0x8c000000, 0x8a000000, 0x5d000000,
+        0x15800000, 0xcdc00000, 0x2da00000, 0xa4d00000, 0x62580000, 0xd08c0000, 0x8dd20000, 0xf9dd0000,
+        0xb64b8000, 0xdaf7c000, 0x7c482000, 0x27f3b000, 0x99cd7800, 0x52306400, 0x106c7200, 0xf0e7fb00,
+        0xa530ef80, 0x68eee640, 0xf0a49da0, 0x71551d70, 0xcf9e7238, 0x6d2afb14, 0x01036f92, 0x17852647
+      },
+      { // 960
+        0x80000000, 0x40000000, 0xe0000000, 0x30000000, 0xe8000000, 0x24000000, 0x22000000, 0x73000000,
+        0x2c800000, 0x31400000, 0x14e00000, 0xb6b00000, 0xf0780000, 0x28cc0000, 0xedb60000, 0x58fd0000,
+        0xeb8a8000, 0x5250c000, 0x0ecb6000, 0x2cb2b000, 0x3f7e4800, 0x0a4f9c00, 0x99f75e00, 0xd999e500,
+        0x17fc4e80, 0x890b0840, 0xc61310a0, 0xbfaeed50, 0x38c15e18, 0xc024e51c, 0xe096ce82, 0x79ebc845
+      },
+      { // 961
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x68000000, 0x2c000000, 0x76000000, 0x07000000,
+        0xc9800000, 0x50400000, 0xd5200000, 0x05700000, 0x4ce80000, 0x229c0000, 0xb1f20000, 0x342b0000,
+        0xa17b8000, 0x8463c000, 0xe6d12000, 0x345d5000, 0xe1164800, 0x5a3a5400, 0x2ec71e00, 0x14e32300,
+        0x3416b680, 0xfebd62c0, 0x5e03a8a0, 0x4b0541f0, 0x4f869e08, 0x6f47e324, 0x58a616b2, 0x0f34f2df
+      },
+      { // 962
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x38000000, 0xf4000000, 0x7e000000, 0x55000000,
+        0x87800000, 0x4ec00000, 0x33a00000, 0xe2100000, 0x95780000, 0x6e6c0000, 0xb6960000, 0x9d3b0000,
+        0x3a8a8000, 0xb4e04000, 0x92756000, 0xe74ad000, 0xe1c31800, 0xe722f400, 0xaa531a00, 0xe19d3300,
+        0x9c1dd980, 0x81dc5140, 0xb4f8c3a0, 0x11aa6250, 0x94b79a28, 0x58ea732c, 0xa9d43986, 0xa95dc141
+      },
+      { // 963
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x98000000, 0x5c000000, 0x92000000, 0xdf000000,
+        0x25800000, 0x2d400000, 0xc5200000, 0x40700000, 0x8dd80000, 0x06ac0000, 0x98f60000, 0x921b0000,
+        0x2f4d8000, 0xeee24000, 0x4f952000, 0x42cff000, 0x67a22800, 0x74b3f400, 0xc7bf3600, 0xd4f9ab00,
+        0xb4d93e80, 0xfa2bcb40, 0x393008a0, 0x5ef96050, 0x77dcb628, 0x6daceb14, 0xdb779eae, 0x265d7b53
+      },
+      { // 964
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x98000000, 0xd4000000, 0x3a000000, 0xed000000,
+        0x29800000, 0xdd400000, 0x5d200000, 0x41300000, 0xb6480000, 0xb07c0000, 0x9ab20000, 0x6a0d0000,
+        0x5adf8000, 0x59c64000, 0x09e76000, 0xb154f000, 0x225af800, 0x0b004400, 0x7286d600, 0x97c1bb00,
+        0x6ee64480, 0x9dd4ddc0, 0x8a9a92a0, 0xfd6466f0, 0x6d915638, 0x9e3bfb34, 0x711324be, 0x1efd2df1
+      },
+      { // 965
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0xd8000000, 0x74000000, 0xfa000000, 0x4f000000,
+        0xde800000, 0x7c400000, 0xc4a00000, 0x38700000, 0xae780000, 0x930c0000, 0x44f60000, 0xa93d0000,
+        0x932f8000, 0xdfc44000, 0xc5606000, 0x3017f000, 0x0befe800, 0x8825ec00, 0x97336600, 0x925f6f00,
+        0x5e3bea80, 0xe9a96640, 0x61868ca0, 0xaac70950, 0xf4e4e618, 0xe2d72f34, 0xfb0d8a8e, 0xd8f39679
+      },
+      { // 966
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0xb8000000, 0xcc000000, 0x7a000000, 0x59000000,
+        0xe2800000, 0x27c00000, 0x51e00000, 0xb6100000, 0x14580000, 0xcd4c0000, 0xd8920000, 0xa99f0000,
+        0x95ae8000, 0x44044000, 0xee04a000, 0xbf073000, 0x09875800, 0xe8467c00, 0x22a39a00, 0xe332a900,
+        0x482ae380, 0xaa473840, 0x77a379a0, 0x5bb69170, 0x46ed1a28, 0xa126e92c, 0x2a7643a6, 0x640c086f
+      },
+      { // 967
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0xf8000000, 0xb4000000, 0x82000000, 0x05000000,
+        0xc2800000, 0x8ec00000, 0xcc200000, 0x88100000, 0x2c580000, 0x2f4c0000, 0x92920000, 0xe69b0000,
+        0x39688000, 0x9b844000, 0x72416000, 0x29e53000, 0x85b27800, 0x970c5c00, 0x3277d200, 0x37a82f00,
+        0x97a51d80, 0x5a50c040, 0x35b8cfa0, 0x52ffef70, 0xb19f5208, 0x56ec6f3c, 0x0bc47d96, 0xcea5f061
+      },
+      { // 968
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x08000000, 0x7c000000, 0xbe000000, 0x39000000,
+        0x4a800000, 0xf5400000, 0x7d600000, 0xa5100000, 0x51680000, 0xb77c0000, 0x9f920000, 0x8c290000,
+        0x661a8000, 0xbc83c000, 0x9042a000, 0x59e09000, 0x5155f800, 0x12883c00, 0x252fee00, 0x349a7900,
+        0xedc05f80, 0x1722ddc0, 0x0ff5b1a0, 0xb1bda4f0, 0x9d356e18, 0x4119b93c, 0xdf02ffba, 0xf7824dd3
+      },
+      { // 969
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0xd8000000, 0x74000000, 0xca000000, 0xef000000,
+        0x47800000, 0xe0c00000, 0x0b600000, 0xccf00000, 0xac380000, 0xa74c0000, 0x2bb20000, 0xe79d0000,
+        0x10df8000, 0x837c4000, 0x40ec6000, 0x22247000, 0x6a526800, 0x1f2ba400, 0x16c28a00, 0x42651500,
+        0xba758880, 0x3e7f9440, 0x3c6882a0, 0x3f66c170, 0xa6f16a38, 0x333d2534, 0x28cb80ae, 0x67704059
+      },
+      { // 970
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0xa8000000, 0x14000000, 0xa2000000, 0x43000000,
+        0xd3800000, 0xc4400000, 0x8c600000, 0x18500000, 0x7a480000, 0x119c0000, 0x1f920000, 0x5a690000,
+        0x71af8000, 0x4f8bc000, 0xdab8e000, 0xb8243000, 0x6c37c800, 0x3e1ae400, 0x4dd0ce00, 0x470ea900,
+        0xc17e9580, 0x9e0226c0, 0x3501dba0, 0xd2874ff0, 0xc4c7ae18, 0x33a15914, 0x4471bd92, 0x4c7cf2e1
+      },
+      { // 971
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x38000000, 0x8c000000, 0x72000000, 0x41000000,
+        0xf9800000, 0xecc00000, 0x3ba00000, 0x7d900000, 0xb5180000, 0x610c0000, 0xe0d60000, 0x067f0000,
+        0x413d8000, 0x075b4000, 0x20eea000, 0x18a07000, 0xbd13d800, 0x8c59e400, 0x546e1a00, 0xdfe48300,
+        0xbb770580, 0x0beef640, 0xfc249fa0, 0x42513550, 0x063d3a08, 0xa1dfb334, 0x36aa7da6, 0xdf476247
+      },
+      { // 972
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x18000000, 0x74000000, 0x8a000000, 0xc9000000,
+        0x9e800000, 0x36400000, 0xd9a00000, 0x20d00000, 0x48e80000, 0xaebc0000, 0xc4120000, 0x290b0000,
+        0xaccc8000, 0x3faf4000, 0xf59c6000, 0x94857000, 0x3f445800, 0xe7215c00, 0xa697f600, 0x894e0700,
+        0xfa6e8780, 0x06fe1fc0, 0x4eb5f1a0, 0xf65f58f0, 0x20e71608, 0x80f4371c, 0x8bfebfae, 0x823633f1
+      },
+      { // 973
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x38000000, 0xd4000000, 0xa6000000, 0x9b000000,
+        0xde800000, 0x36400000, 0xcfe00000, 0xff500000, 0x48c80000, 0x051c0000, 0x49960000, 0x5e6d0000,
+        0x3d2f8000, 0xfb4b4000, 0xeede6000, 0xcab61000, 0x5699a800, 0x3252cc00, 0xe54b9600, 0xe1da4500,
+        0x5232b980, 0x6bdfd2c0, 0x1b36afa0, 0xf85ed7d0, 0xc0f27618, 0x337b1534, 0xb40371b6, 0x76060ed1
+      },
+      { // 974
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x58000000, 0x8c000000, 0x4a000000, 0x47000000,
+        0x4e800000, 0x21c00000, 0x04600000, 0xce300000, 0x8a780000, 0x70cc0000, 0x74760000, 0x6a590000,
+        0xffdb8000, 0xc2984000, 0x4c3ba000, 0x12efb000, 0x68632800, 0x54336c00, 0xf5780a00, 0x224f6500,
+        0x47b4ee80, 0xa53c5040, 0x356f64a0, 0x2e277550, 0x76162a38, 0x896d9534, 0x8c21e68e, 0x1511cc47
+      },
+      { // 975
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0xb8000000, 0x44000000, 0x16000000, 0x55000000,
+        0x44800000, 0xbc400000, 0x59600000, 0x3db00000, 0x74680000, 0xbf5c0000, 0x84720000, 0xbbcb0000,
+        0xd6cf8000, 0x16494000, 0x1c08e000, 0xc06b1000, 0x015e5800, 0x8d76ec00, 0x7d4d1600, 0x918d5100,
+        0x1aa87a80, 0xcf7f70c0, 0x0422eca0, 0x9e5761f0, 0xfc987608, 0x54d40104, 0x41d94286, 0x4737cce5
+      },
+      { // 976
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x68000000, 0xec000000, 0x4a000000, 0xc3000000,
+        0xe2800000, 0x9bc00000, 0x04a00000, 0x96900000, 0xbda80000, 0x5fbc0000, 0x88d20000, 0x164d0000,
+        0x07498000, 0xd2cfc000, 0xd58d2000, 0x97eab000, 0xea588800, 0xdd22ac00, 0xcbd63a00, 0x34c91300,
+        0xfc896d80, 0x0668fbc0, 0x2b1ed7a0, 0xc64228f0, 0xffe09a38, 0x96f16304, 0x3f1d4582, 0xa84327cf
+      },
+      { // 977
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0xe8000000, 0xdc000000, 0xbe000000, 0x59000000,
+        0x51800000, 0x8d400000, 0xbd200000, 0x32d00000, 0x54580000, 0x2e0c0000, 0x46920000, 0x48ff0000,
+        0x599c8000, 0x43ecc000, 0x0222a000, 0xce559000, 0xca98f800, 0xc96c6400, 0x29e0b600, 0x2eb75b00,
+        0xada94b80, 0xfd85da40, 0x3b477da0, 0x28214170, 0x05501628, 0xb41dcb3c, 0xa0ad33b2, 0x1e057e7b
+      },
+      { // 978
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x58000000, 0x6c000000, 0x02000000, 0xb5000000,
+        0x2b800000, 0xb3400000, 0x65e00000, 0xa7b00000, 0xdc780000, 0xc54c0000, 0x91f20000, 0x7a1b0000,
+        0x95bf8000, 0xce6e4000, 0x9be6a000, 0x28b6f000, 0x5efcf800, 0xd78fd400, 0xc6577600, 0xfdcb6d00,
+        0xea357680, 0x2c38f040, 0xf02f80a0, 0xc986dd70, 0xb643d608, 0x66669d04, 0xf0f60ebe, 0x8f99646f
+      },
+      { // 979
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xf8000000, 0xcc000000, 0x92000000, 0x77000000,
+        0x0b800000, 0xe1c00000, 0x75a00000, 0x17500000, 0xd6f80000, 0xe52c0000, 0x85960000, 0x4ed90000,
+        0x5aba8000, 0x784c4000, 0xd9e4a000, 0x5a367000, 0xc28e6800, 0xc5c3c400, 0x43a06200, 0x1656eb00,
+        0xbc79e380, 0xde692740, 0x337501a0, 0x236a8c50, 0x73f2c238, 0xc3299b3c, 0xec950ba6, 0xc05aa35f
+      },
+      { // 980
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x98000000, 0xec000000, 0x36000000, 0x87000000,
+        0xc3800000, 0x91400000, 0xac600000, 0xa8700000, 0x1fc80000, 0x9f3c0000, 0x24320000, 0x212f0000,
+        0x128b8000, 0x8d584000, 0x5f40a000, 0xf7675000, 0x35f6c800, 0xad8f0400, 0xb2dc8600, 0x40010100,
+        0xe004b480, 0xf00493c0, 0x4801b2a0, 0x7402d2f0, 0xda062628, 0xb1055104, 0x4483fcae, 0x52c0d7cf
+      },
+      { // 981
+        0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x08000000, 0x6c000000, 0x3a000000, 0x93000000,
+        0x3b800000, 0xeec00000, 0x20e00000, 0xebf00000, 0x61880000, 0xaefc0000, 0x10360000, 0x9beb0000,
+        0x4f4f8000, 0xee1cc000, 0x8bc42000, 0xa2633000, 0x85b68800, 0xa82ce400, 0xb9285a00, 0x45ae5900,
+        0xbeedcc80, 0xedcbe1c0, 0xd05c16a0, 0x4a6278d0, 0xd9b27a28, 0xea2a6904, 0x1e2ac48a, 0x202cc5cf
+      },
+      { // 982
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x28000000, 0xbc000000, 0x72000000, 0xed000000,
+        0xd5800000, 0x9b400000, 0xe4e00000, 0x94700000, 0x4f980000, 0x2f6c0000, 0x24360000, 0xedfd0000,
+        0xb2db8000, 0xa88fc000, 0x1ac5a000, 0x11a3f000, 0x1f923800, 0xdb6de400, 0xba314600, 0xbaf8e500,
+        0x265ad080, 0xbc4d4140, 0x346616a0, 0xc6b76450, 0xb23ae618, 0x8afa1514, 0xbe5d68b2, 0xd84e656b
+      },
+      { // 983
+        0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0x28000000, 0x3c000000, 0x0e000000, 0xad000000,
+        0xa1800000, 0x5a400000, 0xd8e00000, 0x45f00000, 0x8fd80000, 0xd8ac0000, 0x49b20000, 0x7e3b0000,
+        0x86db8000, 0x5329c000, 0x54f7a000, 0xe0581000, 0x8fefd800, 0x60d04400, 0x498c0e00, 0xede36d00,
+        0xc0713c80, 0x3f994740, 0xe74cb2a0, 0x1ac4ea70, 0x9523ae08, 0xde577d24, 0xd14ce4a2, 0xc3c2035b
+      },
+      { // 984
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0x58000000, 0x74000000, 0x82000000, 0x29000000,
+        0x56800000, 0xd9400000, 0x8ae00000, 0xae700000, 0x4a880000, 0xe97c0000, 0xcd320000, 0x2d6f0000,
+        0xbb8f8000, 0x0bfa4000, 0xb6726000, 0xde8a3000, 0x1b781800, 0xec321c00, 0x57ee0e00, 0x94cbe500,
+        0x2a1c8880, 0x678071c0, 0x1bc706a0, 0xa1a2d4f0, 0x05946e28, 0x9e7dd524, 0x8cb6909e, 0x05ad6dc9
+      },
+      { // 985
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x28000000, 0x94000000, 0xa6000000, 0x9b000000,
+        0x2c800000, 0x15c00000, 0xb5200000, 0x0df00000, 0xd8180000, 0xac6c0000, 0x62320000, 0x94390000,
+        0x781f8000, 0x1c6fc000, 0x3a30e000, 0xb83c1000, 0x621f2800, 0xb56edc00, 0x2bb41a00, 0x1a7dcf00,
+        0xee7b8a80, 0x1878dd40, 0x4b7a10a0, 0x63ffd270, 0xf83cfa18, 0x421ddf14, 0xc56ea2b2, 0x93b30141
+      },
+      { // 986
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x18000000, 0x1c000000, 0xc6000000, 0x43000000,
+        0x81800000, 0xebc00000, 0x2c200000, 0x14500000, 0xbeb80000, 0x026c0000, 0x7b920000, 0x889d0000,
+        0xf33b8000, 0x97ae4000, 0xf8b12000, 0x534f5000, 0xe1476800, 0xe264b400, 0xf9b64200, 0x8bce7700,
+        0x6e052780, 0x7702fd40, 0xb382e5a0, 0xfac3ca70, 0x2ca76238, 0xe7112714, 0x7dda4f9e, 0x135a4963
+      },
+      { // 987
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0xd8000000, 0xc4000000, 0x8a000000, 0x71000000,
+        0xbc800000, 0xe2c00000, 0xf2a00000, 0x24b00000, 0xb1280000, 0x6e1c0000, 0xae720000, 0x9f890000,
+        0xe4aa8000, 0xd45d4000, 0xe415e000, 0xd09af000, 0xd1b39800, 0xa7a90c00, 0x2ddd4200, 0x0852fb00,
+        0x45fb4c80, 0xe92176c0, 0x65f68ea0, 0x36cbcdf0, 0x7f48a218, 0x8b080b3c, 0x3a68d48e, 0xb8f87afd
+      },
+      { // 988
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x28000000, 0xdc000000, 0x26000000, 0x6f000000,
+        0xff800000, 0xd5400000, 0xcee00000, 0x56300000, 0xf4c80000, 0x107c0000, 0x63720000, 0x8a2b0000,
+        0x1e4f8000, 0xb3bdc000, 0x4850a000, 0xe83a5000, 0x8f148800, 0x13dba400, 0xbfa6c600, 0x8ad4f500,
+        0x97fd3280, 0x823359c0, 0x1ece74a0, 0xd17d6cf0, 0xfff66608, 0xaeeea504, 0xb6e9baa2, 0xf2e8fdc3
+      },
+      { // 989
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x38000000, 0x14000000, 0xce000000, 0x15000000,
+        0x7c800000, 0x58400000, 0xa8a00000, 0xb3d00000, 0x3e880000, 0x351c0000, 0x13360000, 0x5dfb0000,
+        0x8c438000, 0x06a54000, 0x56d06000, 0xaa085000, 0x415b1800, 0x6195ec00, 0x352c5600, 0xdb4caf00,
+        0x177a7f80, 0xb500c8c0, 0xec8649a0, 0x404437d0, 0x6ca72e28, 0x45d11324, 0x3f8d3186, 0x87998bf1
+      },
+      { // 990
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x58000000, 0x4c000000, 0x56000000, 0xb7000000,
+        0x0f800000, 0x53c00000, 0x6da00000, 0xb3300000, 0x85f80000, 0x390c0000, 0x9f560000, 0x0e6d0000,
+        0xdd478000, 0x56e44000, 0x3ad7a000, 0xd4ac5000, 0x6c61c800, 0x6b95a400, 0x744f5200, 0x91b4cb00,
+        0x78be4880, 0x5fea4840, 0x8d86baa0, 0x5ec2d350, 0xf3213a18, 0x90713f34, 0xa01ed2ae, 0xae5a2777
+      },
+      { // 991
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0xf8000000, 0xb4000000, 0xbe000000, 0x17000000,
+        0xb5800000, 0x31400000, 0x23a00000, 0xed100000, 0xced80000, 0x368c0000, 0x8df20000, 0xdd6f0000,
+        0x29c28000, 0x16664000, 0x39736000, 0x32afd000, 0x5ca68800, 0x0496b400, 0xdd98d600, 0x002baf00,
+        0x30661980, 0x8a723440, 0x112dafa0, 0xc6e64b70, 0x60b53e28, 0x1ccecb0c, 0xf1d247b6, 0x783c2f51
+      },
+      { // 992
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x08000000, 0x74000000, 0x32000000, 0x67000000,
+        0x72800000, 0xc0c00000, 0xd7600000, 0x28f00000, 0x1dd80000, 0x79ec0000, 0x2d560000, 0xb54d0000,
+        0x46478000, 0x65a6c000, 0x7894e000, 0xd7aeb000, 0xacf6e800, 0xf7d90c00, 0x82ef0200, 0x89d10500,
+        0x28892880, 0xf0a38f40, 0xcd12caa0, 0x15ec3a50, 0x23550a18, 0x744ab934, 0xf1c6c2ba, 0xb8e68679
+      },
+      { // 993
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xd8000000, 0x4c000000, 0x26000000, 0xcf000000,
+        0xb0800000, 0x6c400000, 0x0fa00000, 0x33f00000, 0x56480000, 0x77fc0000, 0x6d120000, 0x5f990000,
+        0x77868000, 0x38c54000, 0x31e3a000, 0x2956d000, 0xe4398800, 0x7e759c00, 0xef89d600, 0xad9e6700,
+        0xf283e680, 0x31478fc0, 0x4a2190a0, 0x6e3338f0, 0xde29fe18, 0xfd682b1c, 0x824f388e, 0x3dfc34ff
+      },
+      { // 994
+        0x80000000, 0x40000000, 0x20000000, 0x70000000, 0xf8000000, 0xe4000000, 0xce000000, 0xfd000000,
+        0xa4800000, 0xb9c00000, 0xdb200000, 0xd6100000, 0xb2780000, 0x3bac0000, 0x83f60000, 0x38cb0000,
+        0x17868000, 0xa0464000, 0xe661e000, 0xc4f2d000, 0x474e5800, 0xbbc1ec00, 0xc4249a00, 0x7d95ff00,
+        0x083ecd80, 0x36cd2d40, 0x8a83b7a0, 0x54c60250, 0xd7a52228, 0x03d1c30c, 0xbb5c8fb6, 0x3ab87e65
+      },
+      { // 995
+        0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xf8000000, 0x84000000, 0x52000000, 0x45000000,
+        0xf6800000, 0x30c00000, 0x7b200000, 0x67f00000, 0xc4980000, 0xc5ac0000, 0x2d160000, 0x1ccb0000,
+        0x83008000, 0xe9804000, 0xdf42e000, 0xdb633000, 0xc3177800, 0xefc9bc00, 0xf280a200, 0x22c27700,
+        0x1e265280, 0x21711d40, 0x0c5c10a0, 0x3a8c5a50, 0x18e33a28, 0x9d53fb3c, 0xb02908b6, 0xf456964d
+      },
+      { // 996
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0xb8000000, 0xd4000000, 0xfa000000, 0xdb000000,
+        0xd5800000, 0x16c00000, 0x5a600000, 0x69100000, 0x6ab80000, 0x9b6c0000, 0x3ab20000, 0x0e490000,
+        0x61078000, 0x2e874000, 0xb3446000, 0x64a5f000, 0x5f74c800, 0x2daed400, 0xd0d5ca00, 0xaf5abd00,
+        0xf7bc3780, 0x23ee2b40, 0x7cf59da0, 0x9e6d6670, 0x26376218, 0x9a089914, 0x4622b596, 0x92310251
+      },
+      { // 997
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x28000000, 0xb4000000, 0xc2000000, 0xcd000000,
+        0x1c800000, 0xffc00000, 0x15e00000, 0xa6100000, 0x7a280000, 0xbdfc0000, 0x09360000, 0xf15b0000,
+        0x54038000, 0x7205c000, 0x1505e000, 0x50853000, 0xa1c13800, 0xaee32c00, 0xb5910a00, 0x54693900,
+        0x4b597b80, 0x45071fc0, 0x388591a0, 0x35c716d0, 0xbce3d228, 0x50942524, 0xfceac982, 0x7698cad9
+      },
+      { // 998
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0xa8000000, 0x54000000, 0x8e000000, 0xc3000000,
+        0x66800000, 0x0fc00000, 0x36e00000, 0x74900000, 0x58c80000, 0x719c0000, 0xd6b60000, 0xf03f0000,
+        0x10058000, 0xe803c000, 0xf402e000, 0x1e025000, 0x6b072800, 0x32878c00, 0x81c73a00, 0xf5e7d100,
+        0x12112780, 0x57091cc0, 0x477cfda0, 0xa2209dd0, 0xa8f4f208, 0x619d0d34, 0x3eb4b582, 0x043a81f1
+      },
+      { // 999
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0xd8000000, 0x24000000, 0xd2000000, 0x2b000000,
+        0xc2800000, 0x4b400000, 0x62e00000, 0xf6700000, 0xafd80000, 0xa9ec0000, 0x3e560000, 0xae8f0000,
+        0x9fe18000, 0x9df44000, 0x751ae000, 0x76cb3000, 0xeb870800, 0x9ac16c00, 0x7f275e00, 0xc5d65500,
+        0xec4d5080, 0xc4c32740, 0x8a26eea0, 0xb2514250, 0x708d3608, 0x2ae74914, 0x4a76669e, 0xf9db6e4d
+      },
+      { // 1000
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x48000000, 0x0c000000, 0xa6000000, 0xc5000000,
+        0x2d800000, 0xa1c00000, 0x83600000, 0xba100000, 0x9a580000, 0x708c0000, 0xe6360000, 0xc26b0000,
+        0x83e28000, 0x8a57c000, 0x76fb2000, 0x70fed000, 0x05ff5800, 0x40782400, 0x1db9d200, 0x70ddfd00,
+        0x03ca0780, 0x12139c40, 0x065ef5a0, 0x4e8bb150, 0x97312a28, 0x0debc92c, 0x4d232d9a, 0x47b4557f
+      },
+      { // 1001
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0xc8000000, 0x8c000000, 0xa6000000, 0xe5000000,
+        0x29800000, 0x33400000, 0x9da00000, 0x7bb00000, 0xefb80000, 0xf64c0000, 0x3fd20000, 0x366f0000,
+        0xc5218000, 0x6374c000, 0x3e5b2000, 0x22d9d000, 0x101e5800, 0x82f90400, 0x9aea6600, 0xafe39f00,
+        0xb597dc80, 0x0c4faa40, 0x54d49aa0, 0xc6eae570, 0x21e49e28, 0x6c948b14, 0xdbcb42ba, 0xc6972147
+      },
+      { // 1002
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x18000000, 0x74000000, 0x7a000000, 0x8b000000,
+        0x06800000, 0x79400000, 0x59a00000, 0x8df00000, 0xbd580000, 0xa8ec0000, 0x69920000, 0xbf490000,
+        0x35608000, 0x1f954000, 0x8a4c6000, 0x3ae7f000, 0xef514800, 0xce28cc00, 0x68f7ae00, 0xfadb9f00,
+        0xa42e3680, 0x4bf01f40, 0x705ff8a0, 0xa3697070, 0xfb520618, 0x042de32c, 0x1bf6b0be, 0xf85dbc41
+      },
+      { // 1003
+        0x80000000, 0x40000000, 0xa0000000, 0x70000000, 0x78000000, 0xac000000, 0x4e000000, 0xb1000000,
+        0x6d800000, 0xe7c00000, 0xc2600000, 0xcaf00000, 0xc4180000, 0xae2c0000, 0x38d60000, 0x484f0000,
+        0x28228000, 0x7f524000, 0x648ba000, 0x04c09000, 0xc8e63800, 0x8db68400, 0xca3da200, 0x247b6500,
+        0x7bd84880, 0xf04e3940, 0x64204aa0, 0xe156cc50, 0xdd8aba08, 0xbd43310c, 0xcd2672b6, 0xb0d04877
+      },
+      { // 1004
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0x98000000, 0x7c000000, 0x12000000, 0x81000000,
+        0xdb800000, 0xfac00000, 0xdba00000, 0x4f300000, 0xcba80000, 0x155c0000, 0x73d60000, 0x62fd0000,
+        0x16e38000, 0xa4564000, 0x42382000, 0x4847f000, 0x4ee25800, 0x78563400, 0xa0391a00, 0x4145c300,
+        0x71639880, 0xec9462c0, 0xe89ca2a0, 0x54f751d0, 0x9b88e218, 0xd8ae4714, 0x0fdefa9e, 0xb29165db
+      },
+      { // 1005
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x08000000, 0x9c000000, 0x5a000000, 0x45000000,
+        0x16800000, 0xf6c00000, 0xde200000, 0x6d300000, 0x3c580000, 0xa0ac0000, 0x15520000, 0xa68f0000,
+        0x5c668000, 0x74d5c000, 0x0fcda000, 0x6001b000, 0x9006b800, 0x58077c00, 0xe4065200, 0xce032f00,
+        0x8301cc80, 0x0987ed40, 0xa5403ea0, 0x3e667270, 0x45d3ca28, 0x8f4c232c, 0xf1c6868a, 0x89a10e7b
+      },
+      { // 1006
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x98000000, 0x0c000000, 0xea000000, 0x61000000,
+        0x11800000, 0x59c00000, 0x48200000, 0x32b00000, 0x8f380000, 0x434c0000, 0xced60000, 0xae6f0000,
+        0x73e58000, 0xcf924000, 0xea09a000, 0x8eb7b000, 0x2d3a9800, 0x164ae400, 0xa9579200, 0xe4a84700,
+        0x4746b880, 0x5f623240, 0x15d68aa0, 0xa6eec550, 0x07a12a08, 0x3c775334, 0x659a128e, 0xc4bb2167
+      },
+      { // 1007
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x48000000, 0xb4000000, 0x7e000000, 0xc9000000,
+        0xb9800000, 0x90400000, 0xc5e00000, 0x09f00000, 0xe4280000, 0x6e9c0000, 0x49d60000, 0x1a790000,
+        0xb5a38000, 0x1c14c000, 0xc5dce000, 0xaeb6d000, 0x114df800, 0x2ea92400, 0x68583e00, 0xf0f3a500,
+        0xa5ab8c80, 0xf2d9dcc0, 0x9e3152a0, 0x5889a9d0, 0xeb0aa638, 0xec489134, 0xa92aaa8a, 0x51198dc9
+      },
+      { // 1008
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x28000000, 0x04000000, 0x3e000000, 0xa3000000,
+        0xdc800000, 0x24c00000, 0xf4a00000, 0x1ad00000, 0x27980000, 0x988c0000, 0xc6360000, 0x752f0000,
+        0xdd668000, 0xa9f4c000, 0xb90c6000, 0x8d725000, 0x01cfa800, 0xcbd2dc00, 0x721bb200, 0x85cbdb00,
+        0xb5d03780, 0x711f7c40, 0xa949e5a0, 0xb915f750, 0x81befa08, 0x8d9f972c, 0x3d884da2, 0xc5b42b7d
+      },
+      { // 1009
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0xc8000000, 0xa4000000, 0x0a000000, 0xbd000000,
+        0x08800000, 0x23400000, 0x6d200000, 0x7d100000, 0xeaa80000, 0xf47c0000, 0x34b20000, 0xbafd0000,
+        0xb4f78000, 0xd058c000, 0x23246000, 0x1a13f000, 0xf728f800, 0x6bbc0c00, 0xb8d54e00, 0xb3cfbb00,
+        0x21cf1580, 0x50cc8fc0, 0x8649bba0, 0xca0804f0, 0x7eaa3638, 0x867b7734, 0x95b63baa, 0xc47cc4ed
+      },
+      { // 1010
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0xa8000000, 0x74000000, 0xea000000, 0x0b000000,
+        0x85800000, 0xfe400000, 0x29600000, 0x4ab00000, 0x2cd80000, 0x19ac0000, 0x80560000, 0x55290000,
+        0xc4928000, 0x8d8ac000, 0xe201e000, 0xef037000, 0x17814800, 0x99425400, 0x9ae1ce00, 0x21f54100,
+        0x61386280, 0x23d89940, 0xfe2acca0, 0xd1146850, 0x0bca0638, 0xa761d53c, 0x93b64cb2, 0xae5ba871
+      },
+      { // 1011
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0x78000000, 0x14000000, 0x86000000, 0x63000000,
+        0xfa800000, 0xaf400000, 0x91600000, 0xbf900000, 0x43c80000, 0xcd9c0000, 0x9e720000, 0x92190000,
+        0x88b38000, 0xa6bd4000, 0x61006000, 0xa7821000, 0xc2c3e800, 0x52a4ec00, 0x9ab55e00, 0x83ba4900,
+        0x18869380, 0xe24780c0, 0x84e02da0, 0x685299f0, 0xe0ed3618, 0x6eefe534, 0xb1e9ada6, 0x416ad9c1
+      },
+      { // 1012
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0xc8000000, 0xec000000, 0xfa000000, 0x5b000000,
+        0x1a800000, 0x44400000, 0x27200000, 0x22900000, 0xd8d80000, 0x208c0000, 0x1d360000, 0x710b0000,
+        0xebf38000, 0x0e6ac000, 0x0c442000, 0x8b243000, 0xf8924800, 0x53dbec00, 0xf20f6600, 0xb570a300,
+        0xac2c2980, 0x9264a840, 0xcc34efa0, 0x688afb50, 0xb136ae28, 0xab0d8f24, 0x60f16fba, 0xdceb3b4f
+      },
+      { // 1013
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0xe8000000, 0xa4000000, 0x52000000, 0xfd000000,
+        0x0c800000, 0x16400000, 0x00200000, 0x5db00000, 0x6dd80000, 0xd6ac0000, 0x83160000, 0x9b2f0000,
+        0x17d78000, 0xce4bc000, 0x9dc36000, 0xa3e33000, 0x65573800, 0xe30c2c00, 0xa6610600, 0x85907b00,
+        0x0c6d1880, 0x75745940, 0xb6b8fea0, 0x1fbcd250, 0x3939be08, 0x3e7b9724, 0x14d97e92, 0x1828125d
+      },
+      { // 1014
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x78000000, 0x84000000, 0xea000000, 0xef000000,
+        0xa6800000, 0x93400000, 0xf5600000, 0xdc900000, 0x5d480000, 0x661c0000, 0xd6720000, 0x051f0000,
+        0xa6f28000, 0x375a4000, 0x0012e000, 0x490af000, 0x19fee800, 0x7fa3ec00, 0x54323e00, 0x3bfee900,
+        0x8ca36b80, 0x4cb60cc0, 0x25b935a0, 0xcc4455f0, 0xcbe45628, 0x1bd4450c, 0xca2b3596, 0xa98b55dd
+      },
+      { // 1015
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0xa8000000, 0x8c000000, 0x56000000, 0x5b000000,
+        0x08800000, 0x79c00000, 0x78600000, 0x43900000, 0x57180000, 0x8bcc0000, 0x62720000, 0x20cf0000,
+        0xb2f18000, 0xcd0fc000, 0x28942000, 0xa79c5000, 0xf6082800, 0x50107c00, 0xc65b7a00, 0x3a6f3500,
+        0x6180eb80, 0x10479240, 0xb42631a0, 0x29b73770, 0x39a8d228, 0x44e38914, 0x885431a2, 0x8e783747
+      },
+      { // 1016
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x58000000, 0x6c000000, 0x9a000000, 0x91000000,
+        0x64800000, 0xd6c00000, 0xee200000, 0xb3d00000, 0x42580000, 0x75cc0000, 0xe4760000, 0x49cf0000,
+        0x66778000, 0x14ce4000, 0x48f0a000, 0x0b0b3000, 0xae539800, 0xf4184c00, 0x932a8200, 0x5686af00,
+        0xe3c0db80, 0x84a55240, 0xd21579a0, 0x9bfa8d50, 0x89589a08, 0x604fa324, 0x263579be, 0xf92a8d6f
+      },
+      { // 1017
+        0x80000000, 0xc0000000, 0xa0000000, 0x70000000, 0x98000000, 0x4c000000, 0xc2000000, 0x13000000,
+        0xed800000, 0x55c00000, 0x66a00000, 0xc0500000, 0x3d880000, 0xeb9c0000, 0x84720000, 0x0f9b0000,
+        0xf2728000, 0x42994000, 0x26f7a000, 0x3dd9f000, 0x76134800, 0x1fe81400, 0x13ee1200, 0xb1eae300,
+        0x72ef8b80, 0x776b38c0, 0xf6acb9a0, 0x1e0d6bf0, 0x0f5dda08, 0xcc50b72c, 0x9f8cb98e, 0x289d6bcf
+      },
+      { // 1018
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x78000000, 0x34000000, 0x1e000000, 0xb3000000,
+        0x80800000, 0x16c00000, 0xd1a00000, 0x34d00000, 0x67580000, 0xbfcc0000, 0x1af60000, 0xafc90000,
+        0xd2f08000, 0x83ce4000, 0x08f56000, 0x56ccd000, 0x0f71a800, 0xde8dbc00, 0x7b108200, 0xbb7f8300,
+        0x3e5f1f80, 0xb24f9240, 0xafb27da0, 0x602e8150, 0x6d47aa38, 0x2be57f2c, 0x49b27d86, 0xa72e8171
+      },
+      { // 1019
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0x18000000, 0x64000000, 0x3a000000, 0xe7000000,
+        0xd0800000, 0xd3c00000, 0x17200000, 0x70100000, 0x0b080000, 0xbe5c0000, 0x88b60000, 0x3c590000,
+        0x1bb68000, 0x9edb4000, 0x6374e000, 0x1f797000, 0x79a12800, 0x0ed11c00, 0x53aa0a00, 0x990fbf00,
+        0x655aad80, 0x66345ec0, 0x029ac7a0, 0x2315d1d0, 0x898ba238, 0x969ce31c, 0x2112c79e, 0x5a89d1d5
+      },
+      { // 1020
+        0x80000000, 0xc0000000, 0xe0000000, 0x90000000, 0x38000000, 0x6c000000, 0x0a000000, 0x79000000,
+        0xac800000, 0x55400000, 0x58a00000, 0x96900000, 0x88380000, 0x196c0000, 0x33b20000, 0x73690000,
+        0x1ab78000, 0x07eb4000, 0xb3f1a000, 0x6d49b000, 0x30615800, 0x43f74c00, 0x05495e00, 0x84604700,
+        0xb5f48580, 0x4e4df740, 0x3de3fba0, 0x46334070, 0x3aad8618, 0x5f554b14, 0x0ddbfbb6, 0xf35f407f
+      },
+      { // 1021
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x68000000, 0xac000000, 0x76000000, 0x07000000,
+        0xbe800000, 0x2b400000, 0x44200000, 0xf9b00000, 0xdc980000, 0xc7ec0000, 0xc2920000, 0xafab0000,
+        0x22308000, 0xac5cc000, 0x330f2000, 0x6fc55000, 0xee63c800, 0xcc142c00, 0x2cedde00, 0x6a116300,
+        0x13e8c880, 0x8092fb40, 0xbaa8b6a0, 0x71b10870, 0x209c1608, 0x49ee4f3c, 0x319596b2, 0xa32f5867
+      },
+      { // 1022
+        0x80000000, 0xc0000000, 0xa0000000, 0x10000000, 0x58000000, 0x84000000, 0x32000000, 0xe1000000,
+        0xbc800000, 0x47c00000, 0xd7600000, 0x9ff00000, 0xa4c80000, 0xe97c0000, 0x7d920000, 0x8dbb0000,
+        0xdf718000, 0x850c4000, 0x151fe000, 0x2be73000, 0xb8375800, 0xc3ab4c00, 0x3e880a00, 0x055f6d00,
+        0xd2c51080, 0x71e6ffc0, 0x55317aa0, 0x3129e2f0, 0x3e4d5208, 0xe5bf2134, 0xd3749abe, 0xcb09d2e5
+      },
+      { // 1023
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xc8000000, 0x8c000000, 0x7e000000, 0xed000000,
+        0x1b800000, 0xfac00000, 0x1ae00000, 0xff100000, 0xb7880000, 0x68dc0000, 0x4af20000, 0x381f0000,
+        0x67138000, 0x338ec000, 0xbadf2000, 0x09f31000, 0x069dd800, 0x0a505400, 0xadaa3a00, 0xb22f4900,
+        0x5aece380, 0x230c4ac0, 0x329879a0, 0x2051d3f0, 0x5aade228, 0x66ac1d04, 0xe0af59ba, 0xb9aec3d7
+      },
+      { // 1024
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x88000000, 0x44000000, 0xae000000, 0x7d000000,
+        0xc9800000, 0x48400000, 0xeba00000, 0x4ab00000, 0xd0080000, 0xd27c0000, 0x8e120000, 0xac3f0000,
+        0x44b68000, 0x1d09c000, 0xb3fb6000, 0xf256d000, 0x619dd800, 0x37010400, 0xaa80be00, 0x54c19700,
+        0x5e679480, 0xcf544fc0, 0x4818caa0, 0x2f45c8f0, 0xb9276628, 0xd273932c, 0x646baaaa, 0xce2f18cd
+      },
+      { // 1025
+        0x80000000, 0x40000000, 0x20000000, 0x50000000, 0x08000000, 0x44000000, 0x4e000000, 0xbf000000,
+        0x26800000, 0x9fc00000, 0x9c200000, 0xb8b00000, 0xd3680000, 0xc19c0000, 0x0d960000, 0xfe5b0000,
+        0x81b78000, 0x6ee8c000, 0x46df6000, 0xe974d000, 0xb04cc800, 0x7fa96c00, 0x113b7a00, 0xabe08700,
+        0x7091c080, 0x0ddbe8c0, 0xb9f45aa0, 0xac8c7fd0, 0x9709b228, 0x8b4eeb04, 0x772b3a8a, 0x41f8afc5
+      },
+      { // 1026
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x28000000, 0x5c000000, 0x4e000000, 0x77000000,
+        0xc2800000, 0xf5c00000, 0x48e00000, 0x45d00000, 0xc2a80000, 0x633c0000, 0x44320000, 0x4afd0000,
+        0x82d38000, 0x182bc000, 0x12fca000, 0xa6d61000, 0x422d8800, 0xe7fccc00, 0x75540a00, 0x5e68f100,
+        0xd65d6d80, 0xfaa59dc0, 0x537447a0, 0xc7ddbcf0, 0x57e38238, 0x7b553d14, 0x8968e792, 0xe4dbacf3
+      },
+      { // 1027
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xf8000000, 0x1c000000, 0x9a000000, 0x3b000000,
+        0xad800000, 0xab400000, 0xe1600000, 0x58100000, 0x63580000, 0xe48c0000, 0x07760000, 0xe64b0000,
+        0x9b548000, 0x163c4000, 0xe29a2000, 0xe92bb000, 0xf645c800, 0xbde6d400, 0x8dd3a600, 0x50fd2900,
+        0x88bf5780, 0x605f6840, 0x350c51a0, 0x2632b150, 0xf42e6e28, 0x8ac7fd1c, 0x5822f1b6, 0x4675414b
+      },
+      { // 1028
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x68000000, 0x8c000000, 0xaa000000, 0xaf000000,
+        0xb5800000, 0xae400000, 0x68e00000, 0x31100000, 0x31780000, 0xf2ac0000, 0x45f60000, 0x826f0000,
+        0x40d18000, 0xb8d9c000, 0xaede2000, 0x93dfb000, 0xcd586800, 0xe09f3400, 0x4b3d4e00, 0x844fed00,
+        0x35e69380, 0x9f95f940, 0xc4ba7da0, 0xad0f6450, 0xc4852608, 0xbac0d914, 0x5a23ddb2, 0x57361467
+      },
+      { // 1029
+        0x80000000, 0x40000000, 0xe0000000, 0x70000000, 0xe8000000, 0x3c000000, 0x4a000000, 0xed000000,
+        0x69800000, 0x08c00000, 0x6ea00000, 0x11f00000, 0xc2e80000, 0x015c0000, 0xf7560000, 0xdf1d0000,
+        0x81b08000, 0x570ec000, 0xe3cda000, 0x876e3000, 0x9b9b7800, 0x40f74400, 0xa1689a00, 0x049a7b00,
+        0x8071c680, 0x2e2846c0, 0x11fa7ca0, 0x0da3cdd0, 0x3b73e218, 0x30ad3f0c, 0xe5b95c82, 0xa6423dd3
+      },
+      { // 1030
+        0x80000000, 0xc0000000, 0xe0000000, 0x10000000, 0xb8000000, 0xf4000000, 0xa2000000, 0x83000000,
+        0xce800000, 0xaf400000, 0x3ca00000, 0x5f100000, 0x43580000, 0xa08c0000, 0xe3b20000, 0xdc490000,
+        0x03d38000, 0x533b4000, 0x87f96000, 0x2b983000, 0xf2e9c800, 0x57c04c00, 0x62e25e00, 0x76356700,
+        0x998a9980, 0x6a32f040, 0x578827a0, 0x4f31e770, 0x100b9618, 0xe1f52b34, 0x1b68c796, 0x0c079779
+      },
+      { // 1031
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x48000000, 0xf4000000, 0x92000000, 0x4f000000,
+        0xd1800000, 0xa1400000, 0x33a00000, 0x64700000, 0x0b980000, 0xec4c0000, 0x9ba60000, 0xe0730000,
+        0xe1998000, 0x0f4ec000, 0x6423e000, 0x68303000, 0xdebf6800, 0x54fa3400, 0x2cd86600, 0x72e8a700,
+        0x1953d680, 0x372e4b40, 0xb134d8a0, 0xea3cd850, 0xe73f6828, 0x51ba3414, 0xe578661a, 0xbd98a739
+      },
+      { // 1032
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0x28000000, 0xd4000000, 0xb2000000, 0x2b000000,
+        0x02800000, 0xe3c00000, 0xdce00000, 0x05500000, 0x08880000, 0x393c0000, 0x40e60000, 0xf3550000,
+        0x59898000, 0x14bbc000, 0x3ba1e000, 0x33763000, 0x30bd4800, 0xd1a28c00, 0xd472ea00, 0xac3dc900,
+        0x57608580, 0x471262c0, 0xd12f27a0, 0x494d27d0, 0x46dd4818, 0xa3328c24, 0x521aea32, 0x6b51c901
+      },
+      { // 1033
+        0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0xe8000000, 0x14000000, 0x3a000000, 0x2d000000,
+        0x53800000, 0x7d400000, 0x35200000, 0xbef00000, 0xea180000, 0xa9cc0000, 0x99260000, 0xa8f70000,
+        0x911c8000, 0x214ac000, 0x5ce1e000, 0xb0167000, 0x230c3800, 0x43413400, 0xba249600, 0x9c763300,
+        0xdadd6680, 0x1eaa1340, 0x7875c8a0, 0xe8dd1450, 0xb7ac3808, 0xc9f1341c, 0x449c9612, 0xff0a3309
+      },
+      { // 1034
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0x38000000, 0x3c000000, 0xfa000000, 0xcd000000,
+        0x6d800000, 0xb0400000, 0x10200000, 0xc3300000, 0x67680000, 0x1c7c0000, 0xac220000, 0xf9310000,
+        0x4a6e8000, 0x41fc4000, 0x24622000, 0xd5173000, 0x735f3800, 0xeb914400, 0x5598ce00, 0xc9703300,
+        0x9a48a080, 0x62cae6c0, 0x730f56a0, 0xf16b91f0, 0xe37f3818, 0xe8a1443c, 0xd2f0ce36, 0xe50c3303
+      },
+      { // 1035
+        0x80000000, 0x40000000, 0x60000000, 0xb0000000, 0x88000000, 0x5c000000, 0xda000000, 0xc7000000,
+        0x64800000, 0xda400000, 0x81600000, 0x9e500000, 0xd4a80000, 0x579c0000, 0xe7660000, 0x73510000,
+        0x9f2e8000, 0x055dc000, 0xee40a000, 0xf7653000, 0x6b566800, 0x9b2cdc00, 0xbb5f5600, 0x2740e900,
+        0xd2e11180, 0xc891cbc0, 0x63882fa0, 0x1aadfed0, 0x369e6838, 0x4ee0dc3c, 0x3291563a, 0x748de93b
+      },
+      { // 1036
+        0x80000000, 0x40000000, 0xe0000000, 0x10000000, 0xd8000000, 0x2c000000, 0x2a000000, 0xfb000000,
+        0x8e800000, 0xbec00000, 0x29200000, 0x91900000, 0x5e380000, 0xaa8c0000, 0x1f260000, 0x28950000,
+        0x2fbf8000, 0x54ca4000, 0xadc1a000, 0xe3a53000, 0x01510800, 0x421dec00, 0x909a2200, 0x8c5a8f00,
+        0x4a7a4d80, 0x436c5140, 0xaa9167a0, 0x70bb3250, 0xe4490818, 0xfe01ec14, 0x4d04220e, 0x77838f0f
+      },
+      { // 1037
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x38000000, 0x34000000, 0x2e000000, 0x99000000,
+        0xd4800000, 0xba400000, 0x9de00000, 0xd9500000, 0xd5780000, 0xadcc0000, 0x23e20000, 0xc8550000,
+        0x6df88000, 0x7d8e4000, 0x31026000, 0x6885d000, 0xf8453800, 0x6ee02c00, 0x82d31600, 0x16b9ed00,
+        0x70eb9d80, 0x44100d40, 0x8d1db3a0, 0x7659cc70, 0xbb3d3838, 0xae2c2c2c, 0x3bb11616, 0x8daced11
+      },
+      { // 1038
+        0x80000000, 0x40000000, 0x20000000, 0xd0000000, 0x88000000, 0xac000000, 0xee000000, 0xcf000000,
+        0x05800000, 0xa4400000, 0xeb200000, 0x31f00000, 0xf4580000, 0xf08c0000, 0xc2260000, 0x17730000,
+        0x9b9f8000, 0xa0eec000, 0x95772000, 0xda991000, 0x9a6a8800, 0x6cb29400, 0xb1ff2e00, 0x02bbeb00,
+        0x881b1e80, 0x7fae5940, 0x91d6b8a0, 0x122b2650, 0x29948828, 0x6f0d9424, 0x2366ae2a, 0x54d62b1f
+      },
+      { // 1039
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0xf8000000, 0xdc000000, 0xd2000000, 0x25000000,
+        0x26800000, 0x8bc00000, 0xde600000, 0xe6300000, 0x16480000, 0x141c0000, 0xd5620000, 0x67b50000,
+        0xf60c8000, 0xb33c4000, 0x90f32000, 0x62ad7000, 0xc3ef3800, 0xec4a5c00, 0x451d4a00, 0x95e45d00,
+        0xcf733a80, 0xddea3fc0, 0xd34948a0, 0x02983ef0, 0xc6a53838, 0x95d35c0c, 0x3a3bca26, 0x5c711d0b
+      },
+      { // 1040
+        0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x48000000, 0xbc000000, 0x56000000, 0xb3000000,
+        0x86800000, 0xaec00000, 0xc3a00000, 0xe8300000, 0x94580000, 0xc5cc0000, 0x24a20000, 0x54b10000,
+        0x87988000, 0x37e9c000, 0x46d5a000, 0xf48e5000, 0x0a43a800, 0xf4626c00, 0xa811e200, 0x172bbb00,
+        0xf2703480, 0xd839af40, 0x99da7ea0, 0xd98c7870, 0x43c1a818, 0x6a236c0c, 0x8671622a, 0xf23e7b13
+      },
+      { // 1041
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xf8000000, 0x64000000, 0xba000000, 0x71000000,
+        0xf4800000, 0x4ec00000, 0x2ce00000, 0x15100000, 0x7af80000, 0x720c0000, 0x49620000, 0x3f550000,
+        0x80d98000, 0x7ff94000, 0x648ee000, 0x22a7f000, 0xf531d800, 0x360a6c00, 0x0367b200, 0x86542100,
+        0xb85fb780, 0x173c0340, 0xe76bdda0, 0x08374e70, 0x448a5838, 0xd2a62c24, 0x3d30d226, 0xfa0a910d
+      },
+      { // 1042
+        0x80000000, 0xc0000000, 0x20000000, 0x70000000, 0x48000000, 0xac000000, 0xc2000000, 0xff000000,
+        0x8c800000, 0x56c00000, 0x2de00000, 0xc4300000, 0x80680000, 0x86bc0000, 0x96620000, 0x72770000,
+        0x194a8000, 0xe06dc000, 0x16bd2000, 0x8e607000, 0xe6756800, 0x3f4b5c00, 0x716e7200, 0xa738e900,
+        0xab20c680, 0x11d32ec0, 0x8059dca0, 0x18d79bf0, 0x65dde828, 0x3b919c2c, 0x7379d21a, 0x7d055937
+      },
+      { // 1043
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x48000000, 0x3c000000, 0x1e000000, 0x6b000000,
+        0xc9800000, 0x6b400000, 0x38a00000, 0xcef00000, 0x28f80000, 0x0dac0000, 0x46220000, 0xc2330000,
+        0x281b8000, 0x9678c000, 0xa169a000, 0x96c61000, 0x11e62800, 0xf354d400, 0xdc883600, 0xf395cf00,
+        0x3a6bfa80, 0x0743d440, 0xaea7e4a0, 0x39f1cf70, 0x2f7fa808, 0x45ef1404, 0x8b02163a, 0x79871f3b
+      },
+      { // 1044
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x38000000, 0xe4000000, 0xfa000000, 0xd9000000,
+        0x27800000, 0x31400000, 0x58600000, 0x1af00000, 0x16280000, 0x09bc0000, 0xe8e60000, 0x57370000,
+        0xc58b8000, 0x77eb4000, 0x6c18e000, 0xc9b3f000, 0xe3489800, 0x56c9b400, 0x228ed600, 0xe3697900,
+        0x3bd9ac80, 0xb31402c0, 0x5299e2a0, 0x3f73cfd0, 0xfa6d1808, 0xfc59f424, 0xf253b626, 0xe2fac90d
+      },
+      { // 1045
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0xa8000000, 0xb4000000, 0x3a000000, 0x3d000000,
+        0xd4800000, 0x29400000, 0xb1600000, 0xdb700000, 0x60880000, 0xb39c0000, 0x6ee60000, 0x8db10000,
+        0x572c8000, 0x674ec000, 0x36bee000, 0x40717000, 0x470eb800, 0x295a8c00, 0xef468e00, 0xb264f100,
+        0xc0f24880, 0xe44983c0, 0x6d3c7ea0, 0xa4b6fed0, 0x69ac3838, 0x4b094c2c, 0xbf5aee32, 0x94464111
+      },
+      { // 1046
+        0x80000000, 0x40000000, 0xa0000000, 0xb0000000, 0x18000000, 0x04000000, 0x66000000, 0x07000000,
+        0x3e800000, 0xeec00000, 0x67e00000, 0x8fb00000, 0xdc980000, 0x1fcc0000, 0x48660000, 0xa0f70000,
+        0x7f388000, 0xd7594000, 0x67aee000, 0xb0901000, 0x7bc98800, 0x7e658c00, 0xaff1e200, 0xedba9900,
+        0x439dea80, 0x654ea540, 0x60a380a0, 0x7016b050, 0xd60f0808, 0xe107cc3c, 0x7981822e, 0x7044c92d
+      },
+      { // 1047
+        0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0x18000000, 0xc4000000, 0x8a000000, 0xb5000000,
+        0x28800000, 0xd6c00000, 0xec200000, 0x16d00000, 0x84b80000, 0x214c0000, 0x1ea20000, 0xad170000,
+        0xa41f8000, 0xbb5a4000, 0xdb3ce000, 0x76097000, 0x62c47800, 0x6e25ac00, 0x5fd69200, 0x323de700,
+        0xd08ccf80, 0xab000f40, 0xcf8425a0, 0xaf434470, 0x4863f828, 0x8133ec04, 0x92c8720e, 0xefe39705
+      },
+      { // 1048
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x18000000, 0xfc000000, 0x4a000000, 0xf7000000,
+        0xa5800000, 0x29c00000, 0x6ee00000, 0xb7d00000, 0x5d680000, 0x555c0000, 0x7f620000, 0x90150000,
+        0x028b8000, 0xf20c4000, 0xbd4d2000, 0x91ecb000, 0x301c6800, 0xb4c3d400, 0x8c66c200, 0x5394c900,
+        0xee4c8180, 0x226cb1c0, 0xd4dc2ba0, 0x80a2acf0, 0x53f7e838, 0xffdf9434, 0xdf23e21e, 0xe534793b
+      },
+      { // 1049
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x48000000, 0xe4000000, 0x5a000000, 0x1f000000,
+        0xda800000, 0x4bc00000, 0xe9e00000, 0xbfb00000, 0x2f280000, 0x007c0000, 0xc3620000, 0xac730000,
+        0xcacb8000, 0xd1c8c000, 0xe14f6000, 0x8d8af000, 0xc2eba800, 0xc09dec00, 0xa7506a00, 0x871f2100,
+        0xe5127a80, 0x31bd98c0, 0x2583b8a0, 0x214055f0, 0x9a202808, 0x2a552c04, 0x669f0a3a, 0x8e55d10d
+      },
+      { // 1050
+        0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x58000000, 0x3c000000, 0x3e000000, 0x0d000000,
+        0x87800000, 0xd0400000, 0xe9a00000, 0x53300000, 0x99b80000, 0x842c0000, 0x8e220000, 0x33730000,
+        0x581b8000, 0x63184000, 0x4d992000, 0xb85f1000, 0x62b81800, 0x0aaf1400, 0xabe01e00, 0xb1969f00,
+        0x0c0cec80, 0xfc525040, 0x5aeeeaa0, 0x8244db70, 0x42a39808, 0x45b75404, 0x20793e3e, 0xe8c98f3b
+      },
+      { // 1051
+        0x80000000, 0x40000000, 0xa0000000, 0x30000000, 0xa8000000, 0x7c000000, 0x96000000, 0x71000000,
+        0xc6800000, 0x84c00000, 0x5d600000, 0x43900000, 0x39880000, 0x21fc0000, 0x3f260000, 0xea370000,
+        0x2f7c8000, 0x17e0c000, 0x1954a000, 0xf9ea5000, 0xaaeab800, 0x276efc00, 0xba2af200, 0x3008fd00,
+        0x2ebcbf80, 0x1601c4c0, 0x310075a0, 0x668705d0, 0xb4c29808, 0xf5646c1c, 0x3f94ea02, 0xaf8c5113
+      },
+      { // 1052
+        0x80000000, 0xc0000000, 0x20000000, 0x90000000, 0x58000000, 0x7c000000, 0xda000000, 0x91000000,
+        0x95800000, 0x76400000, 0x1be00000, 0x44900000, 0x5f280000, 0xaddc0000, 0xcc220000, 0x17370000,
+        0x175d8000, 0xf8e24000, 0x14172000, 0xf2ec3000, 0x3f7ad800, 0x69d0e400, 0xd84bfe00, 0x568c3d00,
+        0xb4aa3380, 0x2c9e51c0, 0x294695a0, 0xb160c8f0, 0xe8507828, 0x000e9414, 0x026e061e, 0xc2bce93b
+      },
+      { // 1053
+        0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0xf8000000, 0x1c000000, 0xee000000, 0x6b000000,
+        0xed800000, 0x9ec00000, 0xc1600000, 0xb2500000, 0x77680000, 0xa1dc0000, 0xfe220000, 0xcbf70000,
+        0xab5e8000, 0x8b644000, 0xcb512000, 0xcfee9000, 0xb19fa800, 0xa801f400, 0xd4047a00, 0x2a030d00,
+        0x69008180, 0x908665c0, 0x0445d3a0, 0x5c20dcf0, 0x86f00828, 0xe9db240c, 0xfa22f236, 0xe9f0693b
+      },
+      { // 1054
+        0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0x48000000, 0xd4000000, 0x6a000000, 0xe9000000,
+        0x87800000, 0xa0400000, 0xe0e00000, 0x8fb00000, 0xd8880000, 0x645c0000, 0x39220000, 0x6c110000,
+        0xc9588000, 0xaca1c000, 0x5952e000, 0xe03af000, 0x48579800, 0xdbbf3400, 0x46149e00, 0x0058d500,
+        0x3b257280, 0x4111a5c0, 0x9cdef4a0, 0x79e784f0, 0x8035f818, 0x4cc8040c, 0x1ebbe62a, 0x17901109
+      },
+      { // 1055
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xc8000000, 0x6c000000, 0x0a000000, 0xe9000000,
+        0x7c800000, 0x30c00000, 0x36200000, 0x1ef00000, 0x91780000, 0x792c0000, 0x74620000, 0x07110000,
+        0xbe2a8000, 0x47e7c000, 0x48532000, 0x9d4c3000, 0xeb769800, 0xad3cec00, 0x57ca0200, 0x80b7e700,
+        0x4a994e80, 0xd37a7840, 0x3c2f54a0, 0xe2e6b370, 0x6ed73818, 0x3c8b1c1c, 0x05d5ba0a, 0xe50a3b37
+      },
+      { // 1056
+        0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x28000000, 0x3c000000, 0xca000000, 0x2b000000,
+        0xce800000, 0x93400000, 0xb4200000, 0x6d100000, 0x29a80000, 0xea1c0000, 0xabe60000, 0xed730000,
+        0xfc1e8000, 0xdae2c000, 0xf0f2a000, 0x45deb000, 0x23848800, 0xf4c46c00, 0x2ee20e00, 0x96f0eb00,
+        0x5cded180, 0x2201b1c0, 0x7706d7a0, 0xd487f6d0, 0x6040a828, 0x6ea41c2c, 0x08522602, 0x7c893733
+      },
+      { // 1057
+        0x80000000, 0x40000000, 0xa0000000, 0x90000000, 0x08000000, 0xbc000000, 0xfa000000, 0x4f000000,
+        0x74800000, 0xcd400000, 0x45200000, 0x2ed00000, 0xc8e80000, 0x439c0000, 0xfee60000, 0x2db70000,
+        0xa9998000, 0xf9e0c000, 0x4537a000, 0x0edf3000, 0xfbc52800, 0xa3639c00, 0xf1752e00, 0xb27f1300,
+        0x07d56780, 0xd96b75c0, 0x1d5ce1a0, 0x2e073ad0, 0x79030808, 0xf9806c34, 0xd2c1a62a, 0xb2e4bf0b
+      },
+      { // 1058
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0xf8000000, 0x5c000000, 0xf2000000, 0x17000000,
+        0x82800000, 0x33400000, 0xfca00000, 0xeeb00000, 0xcfc80000, 0x2d5c0000, 0xe8620000, 0xd4d30000,
+        0x3c1a8000, 0xcbc44000, 0xbce32000, 0x9e907000, 0x0738a800, 0x73b76c00, 0xc6496e00, 0xce98ef00,
+        0xc085a880, 0xbc41dfc0, 0x7226eea0, 0x27f61cf0, 0x806b0808, 0xef6c5c0c, 0xf1ea6616, 0x90a8b32b
+      },
+      { // 1059
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0x68000000, 0x1c000000, 0x46000000, 0xa9000000,
+        0xf7800000, 0x00c00000, 0xa2e00000, 0x26b00000, 0x42980000, 0xc74c0000, 0xb2a20000, 0x36170000,
+        0x2f898000, 0xcc47c000, 0x76a5a000, 0xd413d000, 0x948ff800, 0xd8c5b400, 0x06e15a00, 0x34b62100,
+        0xa199ea80, 0xb7cbdd40, 0xf0e6c8a0, 0x25b38870, 0x0219d828, 0xfd0aa434, 0xd5008212, 0x41808503
+      },
+      { // 1060
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xe8000000, 0x74000000, 0x3a000000, 0x89000000,
+        0x55800000, 0x9ec00000, 0xbc200000, 0x42300000, 0xa4880000, 0xa11c0000, 0x7a620000, 0x97550000,
+        0x615d8000, 0xd805c000, 0x8c02e000, 0xc6017000, 0x17031800, 0x0e81a400, 0x3645fa00, 0x4d60c700,
+        0xe9d3b880, 0x0f1d99c0, 0xd960daa0, 0xc3d53af0, 0x0e1e7838, 0x28e01404, 0x8f118222, 0x4f39d329
+      },
+      { // 1061
+        0x80000000, 0x40000000, 0xa0000000, 0xf0000000, 0x48000000, 0xd4000000, 0x0e000000, 0x81000000,
+        0x22800000, 0x5cc00000, 0xd8e00000, 0xde700000, 0x20d80000, 0xaecc0000, 0x8ba60000, 0x0ad70000,
+        0x718a8000, 0x9d01c000, 0xb886e000, 0x73c3d000, 0x8b63f800, 0xe8375c00, 0x70fd5200, 0xa6585100,
+        0xf40a3c80, 0xa645e140, 0x082616a0, 0xc4972c50, 0x1da99808, 0xbf924c2c, 0x002aca3a, 0xa8d11d09
+      },
+      { // 1062
+        0x80000000, 0xc0000000, 0x20000000, 0x10000000, 0xe8000000, 0xbc000000, 0x7e000000, 0xb7000000,
+        0x0d800000, 0xdec00000, 0xca600000, 0x0b700000, 0x08280000, 0x5ebc0000, 0xce220000, 0xe2570000,
+        0xcff98000, 0xd383c000, 0xb9c4a000, 0x0fe71000, 0x79b6c800, 0x544a9400, 0x5ecf7a00, 0xb5895500,
+        0xd528b080, 0xc63bf6c0, 0xe46082a0, 0xb477f7f0, 0x89a9e828, 0x06794434, 0xe7449232, 0x26a7112b
+      },
+      { // 1063
+        0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x08000000, 0x24000000, 0x22000000, 0x35000000,
+        0xcc800000, 0x3e400000, 0x85200000, 0xe9f00000, 0xfbc80000, 0xee9c0000, 0x4e660000, 0x40570000,
+        0x9c7d8000, 0x8874c000, 0x650b6000, 0xf3f93000, 0x25b63800, 0xa3e88c00, 0x5fef3600, 0xb1ea0b00,
+        0x32e8ae80, 0xf16d45c0, 0x1aaa20a0, 0x6b4c02d0, 0x2edb5808, 0x4046bc14, 0x4e248e2a, 0xae76470d
+      },
+      { // 1064
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x58000000, 0xd4000000, 0x7e000000, 0x5b000000,
+        0x0a800000, 0x1ec00000, 0x91200000, 0x2d300000, 0x69980000, 0x3c0c0000, 0xa8e60000, 0x34910000,
+        0xc3698000, 0x37344000, 0x049e6000, 0x818a5000, 0x46a5a800, 0xc6714c00, 0xfaff8200, 0x19dbcf00,
+        0x85ed5880, 0xa3f22140, 0x80b8f2a0, 0xf53de250, 0xb77dc838, 0xdf9a1c04, 0xcb0baa0e, 0x3862c321
+      },
+      { // 1065
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x98000000, 0x0c000000, 0x1a000000, 0x37000000,
+        0xd2800000, 0x13400000, 0xffe00000, 0x3b500000, 0x44180000, 0x712c0000, 0x19a20000, 0x4d330000,
+        0xb4888000, 0xc6954000, 0xeabaa000, 0x2e99b000, 0x1e6ee800, 0xc444ec00, 0xfd60ee00, 0xa013f500,
+        0x9ffebd80, 0xc47d1e40, 0x7cba3ba0, 0xc39c4770, 0x5bee4808, 0xb5825c1c, 0x89c4860e, 0x68a1592f
+      },
+      { // 1066
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0x38000000, 0x64000000, 0x8a000000, 0x67000000,
+        0xb7800000, 0x9bc00000, 0x2b600000, 0xdad00000, 0x3e480000, 0x637c0000, 0xb5a20000, 0xbd350000,
+        0x46d98000, 0x50974000, 0xcfece000, 0xa4487000, 0x9c7fe800, 0x56264400, 0xc4f5c200, 0x56b99500,
+        0xd3c0d580, 0x876228c0, 0x3cd17fa0, 0xdf4fb9f0, 0x65f90838, 0x10e73424, 0x5711aa16, 0xfc2d910d
+      },
+      { // 1067
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xd8000000, 0xdc000000, 0x1e000000, 0xdf000000,
+        0x28800000, 0xf8400000, 0x6c600000, 0x2dd00000, 0xb0b80000, 0xd88c0000, 0x6a260000, 0xceb10000,
+        0x0deb8000, 0x5c724000, 0x18ca2000, 0x8a411000, 0x45648800, 0xae527c00, 0x6a78e600, 0x89ae9100,
+        0x1e141580, 0x421c5f40, 0x067dfba0, 0x7faff250, 0xb516a838, 0x609f6c14, 0x3b3a6e2e, 0x264ded33
+      },
+      { // 1068
+        0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0x68000000, 0xb4000000, 0xd2000000, 0x57000000,
+        0xf1800000, 0x64400000, 0x6e200000, 0xa2700000, 0x5fb80000, 0x0f6c0000, 0x44620000, 0xdd510000,
+        0xd94a8000, 0x4a12c000, 0x6ce8e000, 0x57203000, 0x12f7a800, 0xc7797400, 0xa7888e00, 0xa7f78300,
+        0xc9f87a80, 0x66487240, 0xcf97dca0, 0x3aa94570, 0xde074818, 0x2905441c, 0x48852622, 0x14c3f701
+      },
+      { // 1069
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0xf8000000, 0xfc000000, 0x66000000, 0xb1000000,
+        0x7f800000, 0x83400000, 0xb4e00000, 0xf8f00000, 0xc7680000, 0x2bfc0000, 0x3da20000, 0x13130000,
+        0x55188000, 0x3a564000, 0x0efe2000, 0x5025d000, 0xe3553800, 0x057cb400, 0x11618600, 0xccb34d00,
+        0xad0d0880, 0x67c8b0c0, 0xc96b36a0, 0xeefe09f0, 0x80231808, 0x0b55641c, 0xb17ebe16, 0x7360f913
+      },
+      { // 1070
+        0x80000000, 0x40000000, 0xe0000000, 0x50000000, 0x38000000, 0x54000000, 0xfe000000, 0x9d000000,
+        0x07800000, 0x6ac00000, 0x29200000, 0xf7900000, 0x70180000, 0xbe2c0000, 0xc7e60000, 0x58b50000,
+        0xae8d8000, 0x67b74000, 0xb6096000, 0xe5f65000, 0x956b9800, 0x0d061400, 0x9f814a00, 0x8ec32f00,
+        0xbf223d80, 0x06923040, 0xdd9b6fa0, 0xb7e94b50, 0x7442f818, 0xc2604404, 0x9d72d236, 0x07293b01
+      },
+      { // 1071
+        0x80000000, 0x40000000, 0x60000000, 0x30000000, 0xf8000000, 0x44000000, 0xd2000000, 0x4f000000,
+        0x6d800000, 0x11c00000, 0x61a00000, 0x38f00000, 0xe7c80000, 0xfa1c0000, 0x1c660000, 0x47510000,
+        0x9e3a8000, 0x99524000, 0xff3fe000, 0x4dd3b000, 0x2e7f6800, 0xe731d400, 0x4f6a4200, 0x9a6dd300,
+        0x44ed1280, 0xcea9c5c0, 0x13ccb8a0, 0x901a82d0, 0x77608838, 0xc8d2641c, 0x38fd2a26, 0xd170071d
+      },
+      { // 1072
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x38000000, 0x5c000000, 0x12000000, 0xd5000000,
+        0xb6800000, 0xa3c00000, 0x85200000, 0x76b00000, 0x31580000, 0xc74c0000, 0x76e60000, 0x6b950000,
+        0x6beb8000, 0x4c114000, 0x00a92000, 0xe5f17000, 0x64b8b800, 0xc159dc00, 0x2f48ca00, 0xf2e16700,
+        0xb5925480, 0x94ed5b40, 0x7397a6a0, 0x07eda050, 0x16119818, 0x21a8ac34, 0x25707236, 0x5c78bb33
+      },
+      { // 1073
+        0x80000000, 0x40000000, 0x60000000, 0x10000000, 0xc8000000, 0x7c000000, 0x72000000, 0x8b000000,
+        0xf8800000, 0xedc00000, 0x1b600000, 0x3d900000, 0x30280000, 0x1b1c0000, 0x5dc60000, 0xe3610000,
+        0xf9938000, 0xe62ec000, 0x5619a000, 0x20467000, 0x0f26c800, 0x7cb01c00, 0xd59e6a00, 0xad061500,
+        0x2d834780, 0x4444a5c0, 0xe92245a0, 0x89b4dcd0, 0x0c19a038, 0x87467014, 0x2da6c82a, 0x76701c1b
+      },
+      { // 1074
+        0x80000000, 0x40000000, 0x20000000, 0x30000000, 0xb8000000, 0x6c000000, 0xbe000000, 0xb7000000,
+        0x5a800000, 0x59400000, 0x49a00000, 0x9bd00000, 0x41d80000, 0x7aec0000, 0x11460000, 0xfda30000,
+        0x59d08000, 0xc0dc4000, 0x436aa000, 0xc0809000, 0xe4434800, 0x6627ec00, 0x19145e00, 0x68be2700,
+        0x795c0380, 0xd2a89840, 0xf961b5a0, 0xebb1c350, 0x07eaa028, 0x5ec0901c, 0x6f634826, 0xf8b7ec17
+      },
+      { // 1075
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xa8000000, 0x6c000000, 0x76000000, 0xe7000000,
+        0x25800000, 0xd4c00000, 0x50a00000, 0x70300000, 0x9ee80000, 0x1abc0000, 0xfcc20000, 0xfca50000,
+        0x66318000, 0x29efc000, 0x973a2000, 0x4402d000, 0xda018800, 0xf1079400, 0x92804a00, 0x59420300,
+        0xe861d480, 0x5693fec0, 0x09da36a0, 0xa1d4b9f0, 0x32ba2038, 0x50c2d024, 0xeaa18832, 0xd137940f
+      },
+      { // 1076
+        0x80000000, 0x40000000, 0xe0000000, 0xd0000000, 0xe8000000, 0xac000000, 0xda000000, 0xcd000000,
+        0xd7800000, 0xe0c00000, 0x9d200000, 0x28d00000, 0x59c80000, 0xf4fc0000, 0xfcc60000, 0x3f250000,
+        0x41d18000, 0x2849c000, 0xeb3e2000, 0xd765b000, 0xfab5b800, 0xa8f95400, 0xbec47a00, 0x8623cf00,
+        0xd8511f80, 0x9b8db0c0, 0x1a9efda0, 0xdff29bd0, 0xc41e2018, 0xdeb5b024, 0x4efdb802, 0xa1c5541f
+      },
+      { // 1077
+        0x80000000, 0x40000000, 0xe0000000, 0x90000000, 0x58000000, 0xfc000000, 0x46000000, 0x8f000000,
+        0x31800000, 0x85c00000, 0xe5200000, 0x09d00000, 0xbfe80000, 0x7adc0000, 0x97c60000, 0x58250000,
+        0xb5538000, 0xaeae4000, 0xbab92000, 0xbc73d000, 0xf97b4800, 0x96527400, 0x2129e200, 0x3c7d2700,
+        0xe6d03780, 0x5e6c39c0, 0x471bbda0, 0x1ee0bad0, 0x4ff12018, 0x79bfd034, 0xa3f5482e, 0x27bb741b
+      },
+      { // 1078
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x58000000, 0xdc000000, 0x62000000, 0x81000000,
+        0xa2800000, 0x7b400000, 0x5da00000, 0x1b100000, 0x1dd80000, 0xf42c0000, 0x99420000, 0x1ca50000,
+        0xd9908000, 0x16994000, 0xf1882000, 0x5e57f000, 0x637a1800, 0xacbd9c00, 0x2d5d8e00, 0x966c1700,
+        0xda654580, 0x6ef36e40, 0x40eaf3a0, 0x87251570, 0x6c502038, 0x6a7bf02c, 0x9a38180e, 0xc0189c2b
+      },
+      { // 1079
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x68000000, 0xfc000000, 0x2e000000, 0xf3000000,
+        0xcb800000, 0x50c00000, 0xe6200000, 0x93900000, 0x6e880000, 0xe5fc0000, 0xcdc20000, 0x7ea50000,
+        0x18d08000, 0xc068c000, 0x0448a000, 0xe2dc9000, 0x28d7e800, 0x086f4400, 0xe84b1a00, 0xd4d89700,
+        0x4fd77d80, 0x11e860c0, 0x658b2fa0, 0x0a7f23f0, 0x4702a038, 0xc985902c, 0xf5c56802, 0x3aa28423
+      },
+      { // 1080
+        0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x58000000, 0xb4000000, 0x42000000, 0xcd000000,
+        0x72800000, 0xfac00000, 0xd8a00000, 0xc1500000, 0x43680000, 0x7a5c0000, 0x39c60000, 0xc1230000,
+        0xbe118000, 0x7a8a4000, 0xf1eb6000, 0xe099b000, 0xd1637800, 0x48767c00, 0x117f0200, 0xf6d2f300,
+        0x472fbf80, 0x9e38c9c0, 0xe730a5a0, 0x1099f6d0, 0xf9656028, 0x9476b014, 0xaf7cf81e, 0x95d33c29
+      },
+      { // 1081
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0xd8000000, 0xcc000000, 0xd6000000, 0x5d000000,
+        0x8c800000, 0x55c00000, 0x93600000, 0xc2f00000, 0x1a480000, 0xa41c0000, 0xb4c60000, 0xe1e30000,
+        0x6e358000, 0x57aa4000, 0xac2ca000, 0xf66ed000, 0xd54b5800, 0xd79d0c00, 0x9a838a00, 0x68c11500,
+        0xafe11c80, 0xdf36bdc0, 0x9d2d6ea0, 0x7ce874d0, 0x258aa028, 0x947dd034, 0x03b6d83e, 0x70eb4c17
+      },
+      { // 1082
+        0x80000000, 0x40000000, 0x60000000, 0x90000000, 0x08000000, 0x3c000000, 0x6e000000, 0x3b000000,
+        0x1f800000, 0x80c00000, 0x94e00000, 0xe5f00000, 0x3e780000, 0x8dac0000, 0xdfc60000, 0xf1610000,
+        0xfc378000, 0x781cc000, 0xf81da000, 0xb81c9000, 0xd81fa800, 0x4818a400, 0x401d3a00, 0x7c188100,
+        0x1218d880, 0x291c5440, 0x369feaa0, 0xb65ce150, 0x22bba038, 0xc74d9034, 0xf930281a, 0x7498642b
+      },
+      { // 1083
+        0x80000000, 0xc0000000, 0x60000000, 0xf0000000, 0xb8000000, 0x6c000000, 0x42000000, 0x0f000000,
+        0x29800000, 0xd6c00000, 0x80200000, 0x93f00000, 0x2dc80000, 0x57dc0000, 0x58420000, 0x9b650000,
+        0x33148000, 0xef1a4000, 0x3562a000, 0xbe177000, 0xa9996800, 0x3a22b400, 0x50f43a00, 0xd64ad700,
+        0xc6190e80, 0x25e249c0, 0xf054fca0, 0xd3f85af0, 0x0db42038, 0xbfa8300c, 0x244f4836, 0xd11f8427
+      },
+      { // 1084
+        0x80000000, 0x40000000, 0x60000000, 0x70000000, 0xf8000000, 0x14000000, 0x72000000, 0x59000000,
+        0xf6800000, 0xfe400000, 0xcce00000, 0x6a500000, 0xa1980000, 0x746c0000, 0xd7c60000, 0xdf210000,
+        0x6f708000, 0x6bec4000, 0x07036000, 0xe9813000, 0x33c25800, 0x1526fc00, 0x42778600, 0x9f693500,
+        0x5842a580, 0xc7e69640, 0xd5d21ba0, 0x21596f50, 0xaacde038, 0x1770700c, 0x3fefb826, 0x15068c19
+      },
+      { // 1085
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0xa8000000, 0x94000000, 0x9e000000, 0x09000000,
+        0x02800000, 0x01400000, 0xf4600000, 0x5a500000, 0xb0980000, 0x9aec0000, 0x34c60000, 0x8ea10000,
+        0x35f18000, 0x73efc000, 0x2645e000, 0x47e25000, 0x0597b800, 0x1fbadc00, 0x0bd95e00, 0x418d0900,
+        0x39148180, 0x67fc9e40, 0x653987a0, 0x76981b50, 0xdfea6038, 0xa4409004, 0x74e5d832, 0x68164c31
+      },
+      { // 1086
+        0x80000000, 0xc0000000, 0x60000000, 0x50000000, 0xb8000000, 0xac000000, 0x92000000, 0x0b000000,
+        0x38800000, 0x69c00000, 0xb1e00000, 0x52900000, 0x2ff80000, 0xdc4c0000, 0xb3420000, 0x9b250000,
+        0xfff18000, 0xc2af4000, 0xcf54a000, 0x301ff000, 0xcfdbc800, 0x53391c00, 0x3c2e4a00, 0x33902100,
+        0x1079cb80, 0x2f0e9340, 0x8862e9a0, 0x54d15e70, 0xd55d2038, 0x19fcb024, 0xc14d6836, 0x66c3ec3f
+      },
+      { // 1087
+        0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0xa8000000, 0x2c000000, 0x8a000000, 0x2f000000,
+        0x07800000, 0x4ec00000, 0xd2a00000, 0x95d00000, 0xe2180000, 0x06ac0000, 0x37420000, 0x7d630000,
+        0x69f28000, 0x6b8ac000, 0xf8502000, 0x13db3000, 0x2b8c2800, 0x9854c400, 0x43dc0a00, 0x738b0300,
+        0x1c56ab80, 0xe5dde640, 0xd68ca9a0, 0x34d61170, 0xac9aa008, 0x4aedf00c, 0x73a60802, 0xdb50f437
+      },
+      { // 1088
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x98000000, 0x6c000000, 0x76000000, 0x85000000,
+        0x87800000, 0xfcc00000, 0xd5e00000, 0x4d900000, 0x87e80000, 0x785c0000, 0x01460000, 0xea270000,
+        0x72f38000, 0x953a4000, 0x5493a000, 0x7e6ad000, 0x559e9800, 0x99209400, 0x30701a00, 0x4e79a900,
+        0xadb13380, 0x7e1fdbc0, 0xf3e211a0, 0x109736d0, 0xcc682008, 0x229c9024, 0xc9a3380e, 0x4c31442f
+      },
+      { // 1089
+        0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xf8000000, 0x14000000, 0xd6000000, 0xe3000000,
+        0x12800000, 0xafc00000, 0x3da00000, 0xce900000, 0x27780000, 0xda8c0000, 0xe9420000, 0xe4650000,
+        0xe0378000, 0x936b4000, 0xbe336000, 0xcc681000, 0xf6b6a800, 0xd2ad0c00, 0x14952a00, 0x567eb300,
+        0x6509e980, 0x33067740, 0x4a830ba0, 0x4bc4d870, 0x83a4e038, 0xc1935014, 0xf7fdc826, 0x40491c21
+      },
+      { // 1090
+        0x80000000, 0xc0000000, 0x60000000, 0x70000000, 0x28000000, 0x6c000000, 0x6e000000, 0x4b000000,
+        0x2b800000, 0x0a400000, 0x44a00000, 0xf9100000, 0x2d680000, 0x0b9c0000, 0x11c20000, 0xc6e50000,
+        0xc1b08000, 0xe27ac000, 0x29f62000, 0x33de1000, 0xf8662800, 0x23768400, 0xfb1b4e00, 0xa8069700,
+        0xac01dd80, 0x0e049bc0, 0x3b009ba0, 0x038398f0, 0x6646a038, 0x2aa4d02c, 0xb2100812, 0x06e89407
+      },
+      { // 1091
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xf8000000, 0xec000000, 0x16000000, 0x09000000,
+        0xe1800000, 0xc2400000, 0x61e00000, 0x92d00000, 0x1f680000, 0xff9c0000, 0x39820000, 0x5e450000,
+        0x3fe58000, 0x5fd14000, 0xfce8a000, 0xcedbd000, 0xa6e2f800, 0xe6524400, 0x62ac9e00, 0x91385d00,
+        0x29353980, 0xe2bebdc0, 0x40767fa0, 0x21de34f0, 0xc6658038, 0x61914004, 0x1308a026, 0x690bd00f
+      },
+      { // 1092
+        0x80000000, 0xc0000000, 0x20000000, 0x30000000, 0xc8000000, 0x54000000, 0x7e000000, 0x5b000000,
+        0x95800000, 0x28c00000, 0xcea00000, 0xfe300000, 0xd7680000, 0x22bc0000, 0xb1820000, 0x7ec70000,
+        0xd1a08000, 0xedb7c000, 0x38ace000, 0x539d5000, 0x42732800, 0xa9897400, 0xb0696a00, 0x6d3af300,
+        0x54466480, 0x1ae69ac0, 0x24d046a0, 0xd3bf8df0, 0xc1008028, 0xb887c03c, 0x9244e03a, 0x3de15019
+      },
+      { // 1093
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0xc8000000, 0x1c000000, 0xbe000000, 0x13000000,
+        0x29800000, 0x17c00000, 0x31a00000, 0xedd00000, 0x5b380000, 0x810c0000, 0xb5820000, 0x69c50000,
+        0x42a58000, 0x1450c000, 0x84fea000, 0xaca91000, 0xe6576800, 0x21fcd400, 0xea287200, 0xb613f300,
+        0xdc9d4380, 0x03d92740, 0xa93979a0, 0x240fd070, 0xf3058038, 0x3980c004, 0xbfc6a02a, 0xfda51033
+      },
+      { // 1094
+        0x80000000, 0xc0000000, 0xa0000000, 0xb0000000, 0x98000000, 0x9c000000, 0xce000000, 0xab000000,
+        0xe1800000, 0xcfc00000, 0x6fe00000, 0xc0100000, 0x3cd80000, 0x016c0000, 0xe3820000, 0xe2c30000,
+        0x31608000, 0x94514000, 0xfdf82000, 0xb61e9000, 0x54092800, 0x35d55400, 0x523ff200, 0xc9fd4100,
+        0xbc1adf80, 0x0d0eb640, 0x0154a5a0, 0x4f797370, 0x14588008, 0x122d401c, 0x3522200e, 0x1d71900b
+      },
+      { // 1095
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x88000000, 0x6c000000, 0x2e000000, 0xa3000000,
+        0x9b800000, 0x13c00000, 0x1d200000, 0xb1500000, 0x33180000, 0x532c0000, 0x6d820000, 0x94c10000,
+        0x24a18000, 0xff92c000, 0x9ebf2000, 0x063e1000, 0x7e7e6800, 0xc89cc400, 0x50efc200, 0x18a7b700,
+        0x9995c380, 0xb1bbc240, 0x63bac9a0, 0x46bc6170, 0x22398018, 0xdc7ec004, 0x959d201a, 0xe06f102f
+      },
+      { // 1096
+        0x80000000, 0xc0000000, 0xe0000000, 0x70000000, 0x58000000, 0xfc000000, 0xfa000000, 0x4f000000,
+        0xdc800000, 0xf3c00000, 0x5ee00000, 0x61f00000, 0x7bd80000, 0xdf8c0000, 0x86820000, 0xecc10000,
+        0x4a648000, 0x46314000, 0x7b3d2000, 0xf77c3000, 0x94dfa800, 0x53099c00, 0xbd47fa00, 0x66252900,
+        0x75905880, 0x74e9a140, 0xcd31aaa0, 0x11b86470, 0x09bc8018, 0xd5bd402c, 0xbfbf202e, 0xd8bd3023
+      },
+      { // 1097
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0xc8000000, 0x8c000000, 0xb6000000, 0x07000000,
+        0x17800000, 0x3ac00000, 0xbc200000, 0xec700000, 0x0c680000, 0x077c0000, 0x06860000, 0xfa430000,
+        0x79658000, 0x7692c000, 0x223a2000, 0x6c65d000, 0xac178800, 0xc6798400, 0x2e01ea00, 0x23007700,
+        0x9d87e280, 0xd3c630c0, 0xe8a620a0, 0xfb34d3d0, 0x3b8b8028, 0x47adc034, 0xcbd9a03a, 0x77b41007
+      },
+      { // 1098
+        0x80000000, 0x40000000, 0xa0000000, 0xd0000000, 0x38000000, 0xbc000000, 0x3e000000, 0x67000000,
+        0xe3800000, 0x9e400000, 0x54a00000, 0x1c300000, 0x1e480000, 0x351c0000, 0x0a860000, 0x12c70000,
+        0xdd638000, 0xbcd74000, 0x8bdc2000, 0x31e01000, 0x0510c800, 0x63392400, 0xf0716e00, 0xbbed9700,
+        0x89aea480, 0x3b0963c0, 0x8c38a2a0, 0xa7f680d0, 0xefad8008, 0xd00c4024, 0x19b9a026, 0x0ab0501b
+      },
+      { // 1099
+        0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x68000000, 0xdc000000, 0xb6000000, 0x05000000,
+        0x17800000, 0xb4c00000, 0xb5200000, 0x98900000, 0x8ec80000, 0xe63c0000, 0x5c820000, 0x32410000,
+        0x4c618000, 0x9275c000, 0x05fda000, 0x39275000, 0x86939800, 0xb7cf9400, 0x97bf9a00, 0x85414f00,
+        0x4ce68d80, 0xd63482c0, 0xac9eafa0, 0x6cd4c9f0, 0x5fab8018, 0xe7c8c004, 0x3fbe2022, 0xb9439003
+      },
+      { // 1100
+        0x80000000, 0xc0000000, 0x60000000, 0xd0000000, 0x08000000, 0x44000000, 0x66000000, 0x77000000,
+        0x7e800000, 0x4a400000, 0xc4a00000, 0x49d00000, 0x14780000, 0x43cc0000, 0x63820000, 0xc1c50000,
+        0x51658000, 0x16b6c000, 0xe1ca6000, 0xb2851000, 0xa8468800, 0xb5a34c00, 0x90572600, 0x28bc3700,
+        0x892a4b80, 0x88f3dd40, 0xeb6c05a0, 0x78537670, 0x7cbf8038, 0x872fc004, 0x6bf5e01a, 0xfbead025
+      },
+      { // 1101
+        0x80000000, 0x40000000, 0xe0000000, 0xf0000000, 0xe8000000, 0x44000000, 0x82000000, 0x9b000000,
+        0x06800000, 0x93400000, 0xa2200000, 0x1e700000, 0xd2880000, 0xb11c0000, 0xc3860000, 0x60c50000,
+        0x8ae08000, 0xc090c000, 0x881d6000, 0x0e023000, 0x0d02c800, 0xe783ec00, 0x52c32e00, 0x19e6cb00,
+        0x7217c280, 0x715a77c0, 0x7323c4a0, 0x97f1a0d0, 0x3d4e8018, 0x4779c02c, 0x5753e002, 0x627bf02d
+      },
+      { // 1102
+        0x80000000, 0x40000000, 0x20000000, 0x90000000, 0x88000000, 0x44000000, 0x7a000000, 0x4b000000,
+        0x36800000, 0x4f400000, 0xe3a00000, 0x21f00000, 0x5d980000, 0x580c0000, 0xf9860000, 0x63c30000,
+        0x57e58000, 0xecd0c000, 0xff2e6000, 0xd835f000, 0xb17b8800, 0xba5eec00, 0x15e94e00, 0xee562700,
+        0xb26bb280, 0x0c95f340, 0x800a94a0, 0x55840850, 0xedc38028, 0x7ee3c034, 0x5d53e02a, 0xb8e93035
+      },
+      { // 1103
+        0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xb8000000, 0x0c000000, 0x96000000, 0x0b000000,
+        0xb8800000, 0xa9c00000, 0xd3600000, 0x4b100000, 0xe2180000, 0x202c0000, 0xab020000, 0x28870000,
+        0x31c38000, 0x8f674000, 0x6515a000, 0xe51cd000, 0x0ea8e800, 0x09c79c00, 0x43678a00, 0xd3105500,
+        0xbe1b8380, 0x0e2ce840, 0xac00c1a0, 0x0607b170, 0x93020028, 0xe4870024, 0x87c38026, 0xd4674017
+      },
+      { // 1104
+        0x80000000, 0x40000000, 0x60000000, 0x50000000, 0x78000000, 0x4c000000, 0x8a000000, 0x47000000,
+        0xad800000, 0xf5400000, 0x62e00000, 0xe9700000, 0xf1080000, 0xb55c0000, 0xaf060000, 0xb9810000,
+        0x03418000, 0x87e14000, 0x37f1a000, 0x6fce3000, 0xeffa6800, 0xce115400, 0xf93bc600, 0xd0b13d00,
+        0x162f1c80, 0x390e63c0, 0x915892a0, 0x71007ad0, 0x68860038, 0x1bc10004, 0xd4218006, 0x87d14007
+      },
+      { // 1105
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x38000000, 0x54000000, 0xd6000000, 0x5f000000,
+        0x05800000, 0x30c00000, 0x24200000, 0x9d500000, 0x1e680000, 0x755c0000, 0x73020000, 0xe7830000,
+        0x29c48000, 0x76a04000, 0xc4136000, 0x888c1000, 0x45284800, 0xaab8d400, 0xb9f6aa00, 0x3b7a2700,
+        0x5b548b80, 0x8968f9c0, 0xbcdf89a0, 0xf1c55af0, 0x72a20008, 0xba13003c, 0x8b8c8026, 0xfaac4019
+      },
+      { // 1106
+        0x80000000, 0xc0000000, 0xe0000000, 0x30000000, 0xe8000000, 0x34000000, 0x82000000, 0x11000000,
+        0xcc800000, 0x63c00000, 0x94600000, 0x2dd00000, 0x96a80000, 0xd55c0000, 0x1f020000, 0x73810000,
+        0x00468000, 0xac26c000, 0x6df6e000, 0xa55db000, 0xd7009800, 0x9780ec00, 0x5a427a00, 0x61263d00,
+        0x17728d80, 0x559c7bc0, 0x9ee20fa0, 0x1510daf0, 0x3b4a0018, 0x0dcd003c, 0xb30c8002, 0x65ebc001
+      },
+      { // 1107
+        0x80000000, 0xc0000000, 0xa0000000, 0x30000000, 0x88000000, 0xc4000000, 0xca000000, 0x0d000000,
+        0x89800000, 0xfac00000, 0x6c600000, 0x5ff00000, 0x4a480000, 0x6b9c0000, 0x9f020000, 0x98830000,
+        0x65448000, 0x2da5c000, 0x31126000, 0x65f87000, 0xf9f23800, 0xb94a2400, 0x0d1a9a00, 0x15473500,
+        0xc5a6dc80, 0x65120dc0, 0x17fa9ea0, 0xb8f1acf0, 0x3eca0008, 0x30df003c, 0xfda6800a, 0xe916c03d
+      },
+      { // 1108
+        0x80000000, 0xc0000000, 0x60000000, 0x10000000, 0x68000000, 0xf4000000, 0x76000000, 0xf3000000,
+        0x1f800000, 0x1e400000, 0xbfe00000, 0x87f00000, 0x34480000, 0x3c9c0000, 0x14020000, 0xa6050000,
+        0xfb038000, 0xfb83c000, 0x0044e000, 0xb8e41000, 0xee742800, 0xd90f6400, 0x9cfc0e00, 0x8db70d00,
+        0x2dacc080, 0x406a1dc0, 0xdbc986a0, 0x9adca4f0, 0x57e00038, 0xb3f00034, 0x22480002, 0xdf9c0039
+      },
+      { // 1109
+        0x80000000, 0xc0000000, 0x60000000, 0x30000000, 0x18000000, 0x9c000000, 0x46000000, 0xcf000000,
+        0xdc800000, 0x7d400000, 0x47e00000, 0xe1d00000, 0x00080000, 0x2afc0000, 0xa8020000, 0x44050000,
+        0xba028000, 0xb9014000, 0x0b842000, 0x3dc6d000, 0x7ca44800, 0x69309c00, 0x3d5d0e00, 0x57b5d500,
+        0xc51b3180, 0x0dd00ec0, 0xfe0ed7a0, 0x29fbd7f0, 0x1a800038, 0x7240003c, 0xfb60001e, 0xac90002b
+      },
+      { // 1110
+        0x80000000, 0x40000000, 0x60000000, 0xf0000000, 0x88000000, 0x3c000000, 0x1e000000, 0xbb000000,
+        0x07800000, 0x26c00000, 0x16e00000, 0xbcb00000, 0xcc680000, 0x467c0000, 0xa0060000, 0xd0010000,
+        0x18048000, 0x4403c000, 0xaa05a000, 0x99011000, 0xa2852800, 0x9a45e400, 0x37a10a00, 0x8c918100,
+        0x663d5280, 0x36a786c0, 0x2a1650a0, 0x367c33d0, 0x68000038, 0x8c00002c, 0xf600003a, 0x77000033
+      }
+    };
+  }
+
+  template <typename U> static inline U reverse_lanes(U x) noexcept {
+    x = ((x >> 1) & U(0x55555555u)) | ((x & U(0x55555555u)) << 1);
+    x = ((x >> 2) & U(0x33333333u)) | ((x & U(0x33333333u)) << 2);
+    x = ((x >> 4) & U(0x0f0f0f0fu)) | ((x & U(0x0f0f0f0fu)) << 4);
+    x = ((x >> 8) & U(0x00ff00ffu)) | ((x & U(0x00ff00ffu)) << 8);
+    return (x >> 16) | (x << 16);
+  }
+
+  // detail::owen_scramble, a vector at a time
+  template <typename U> static inline U owen_lanes(U x, U seed) noexcept {
+    x = reverse_lanes(x);
+    x = x ^ (x * U(0x3d20adeau));
+    x = x + seed;
+    x = x * ((seed >> 16) | U(1u));
+    x = x ^ (x * U(0x05526c56u));
+    x = x ^ (x * U(0x53a22864u));
+    return reverse_lanes(x);
+  }
+
+  void sobol_sequence::samples(uint64_t first, size_t count, uint32_t dimension, float * out) const noexcept {
+    assert(dimension < detail::sobol_dimensions);
+    const uint32_t w = uint32_t(u32xn::width);
+    const bool owen = scramble == sobol_scramble::owen;
+
+    // where lane j sits relative to lane 0. when i is a multiple of w, i + j == i ^ j, so that's just an xor
+    uint32_t offsets[u32xn::width];
+    for (uint32_t j = 0; j < w; ++j) offsets[j] = detail::sobol_bits(j, dimension);
+    u32xn lane_offsets = u32xn::load(offsets);
+
+    while (count != 0) {
+      // a run of samples sharing their high 32 bits, and so their scramble
+      size_t n = size_t(std::min<uint64_t>(count, (uint64_t(1) << 32) - (first & 0xffffffffu)));
+      uint32_t s = dimension_seed(first, dimension);
+      auto one = [&](uint32_t i) {
+        uint32_t x = detail::sobol_bits(i, dimension);
+        return detail::unit_float(owen ? detail::owen_scramble(x, s) : x);
+      };
+      uint32_t i = uint32_t(first);
+      size_t k = 0;
+      for (; k < n && (i & (w - 1)) != 0; ++k, ++i) out[k] = one(i);
+      u32xn seeds(s);
+      for (; k + w <= n; k += w, i += w) {
+        u32xn x = u32xn(detail::sobol_bits(i, dimension)) ^ lane_offsets;
+        if (owen) x = owen_lanes(x, seeds);
+        x.store_unit(out + k);
+      }
+      for (; k < n; ++k, ++i) out[k] = one(i);
+      first += n;
+      out += n;
+      count -= n;
+    }
+  }
+
+  void sobol_sequence::dimensions(uint64_t index, uint32_t first_dimension, size_t count, float * out) const noexcept {
+    assert(first_dimension + count <= detail::sobol_dimensions);
+    const size_t w = u32xn::width;
+    const bool owen = scramble == sobol_scramble::owen;
+    size_t k = 0;
+    for (; k + w <= count; k += w) {
+      uint32_t x[u32xn::width], s[u32xn::width];
+      for (size_t j = 0; j < w; ++j) {
+        uint32_t d = first_dimension + uint32_t(k + j);
+        x[j] = detail::sobol_bits(uint32_t(index), d);
+        s[j] = dimension_seed(index, d);
+      }
+      u32xn v = u32xn::load(x);
+      if (owen) v = owen_lanes(v, u32xn::load(s));
+      v.store_unit(out + k);
+    }
+    for (; k < count; ++k) out[k] = (*this)(index, first_dimension + uint32_t(k));
   }
 }
 
@@ -1,18 +1,83 @@
 #pragma once
 
+#include <cassert>
+#include <cstdint>
 #include <intrin.h>
 #include <windows.h>
 #include "glm.h"
 #include "std.h"
 
 namespace framework {
+  namespace detail {
+    static const size_t sobol_dimensions = 1111;
+
+    // The Joe and Kuo direction numbers, expanded to 32 bits and left aligned, so that bit k of an index toggles
+    // sobol_directions[dimension][k] in a fixed point fraction
+    extern const uint32_t sobol_directions[sobol_dimensions][32];
+
+    static inline uint32_t ctz(uint32_t value) {
+#ifdef _WIN32
+      DWORD trailing_zero = 0;
+      return _BitScanForward(&trailing_zero, value) ? trailing_zero : 32;
+#else
+      return __builtin_ctz(value);
+#endif
+    }
+
+    // dimension of the point with the given index, by xoring together the directions of its bits
+    static inline uint32_t sobol_bits(uint32_t index, uint32_t dimension) noexcept {
+      const uint32_t * v = sobol_directions[dimension];
+      uint32_t result = 0;
+      for (; index != 0; index >>= 1, ++v)
+        result ^= *v & (0u - (index & 1u));
+      return result;
+    }
+
+    static inline uint32_t reverse_bits(uint32_t x) noexcept {
+      x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+      x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+      x = ((x >> 4) & 0x0f0f0f0fu) | ((x & 0x0f0f0f0fu) << 4);
+      x = ((x >> 8) & 0x00ff00ffu) | ((x & 0x00ff00ffu) << 8);
+      return (x >> 16) | (x << 16);
+    }
+
+    // The hash from "Stratified Sampling for Stochastic Transparency" by Laine and Karras, with the constants from
+    // "Practical Hash-based Owen Scrambling" by Brent Burley. each bit of the result depends only on the bits at or
+    // below it
+    static inline uint32_t laine_karras_permutation(uint32_t x, uint32_t seed) noexcept {
+      x ^= x * 0x3d20adeau;
+      x += seed;
+      x *= (seed >> 16) | 1u;
+      x ^= x * 0x05526c56u;
+      x ^= x * 0x53a22864u;
+      return x;
+    }
+
+    // Owen scrambling of a fixed point fraction: every digit is flipped, or not, by a hash of the digits above it
+    static inline uint32_t owen_scramble(uint32_t x, uint32_t seed) noexcept {
+      return reverse_bits(laine_karras_permutation(reverse_bits(x), seed));
+    }
+
+    // the splitmix64 finalizer
+    static inline uint64_t mix64(uint64_t x) noexcept {
+      x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+      x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+      return x ^ (x >> 31);
+    }
+
+    // the 24 bits of a fixed point fraction a float can hold, so we never round up to 1
+    static inline float unit_float(uint32_t x) noexcept {
+      return float(x >> 8) * 5.9604644775390625e-8f; // 2^-24
+    }
+  }
 
   //--------------------------------------------------------------------------
   // Sobol Low Discrepancy Sequence
   //-------------------------------------------------------------------------- 
   template <size_t N = 1>
   struct sobol {
-    sobol();
+    static_assert(N <= detail::sobol_dimensions, "Only 1111 dimensions worth of Sobol sequencing are available");
+
     // retrieve the next entry in the Sobol sequence over [0,1]^N
     inline typename vec<N>::type next() {
       typename vec<N>::type result;
@@ -28,76 +93,89 @@ namespace framework {
     inline void skip(uint32_t delta);
 
     uint32_t n = 0;
-    uint32_t m[N][32];
     uint32_t x[N]{};
-    uint32_t b[32]{};
   };
 
-  namespace detail {
-    static inline uint32_t ctz(uint32_t value) {
-#ifdef _WIN32
-      DWORD trailing_zero = 0;
-      return _BitScanForward(&trailing_zero, value) ? trailing_zero : 32;
-#else
-      return __builtin_ctz(value);
-#endif
-    }
-    extern const uint32_t sobol_a[1110];
-    extern const uint32_t sobol_minit[13][1110];
-  }
-
-  template <size_t N> sobol<N>::sobol() {
-    static_assert(N <= 1111, "Only 1111 dimensions worth of Sobol sequencing are available");
-    
-    for (auto & r : m)
-      for (auto & p : r)
-        p = 1;
-
-    for (uint32_t i=1;i<N;++i) {
-      uint32_t a = detail::sobol_a[i - 1];
-      uint32_t d = uint32_t(floor(log2(float(a)))); // use clz based integer log 2?
-
-      for (uint32_t j=0;j<d;++j)
-        m[i][j] = detail::sobol_minit[j][i - 1]; // TODO: transpose sobol_minit
-
-      for (uint32_t j=d;j<32;++j) {
-        uint32_t ac = a;
-        m[i][j] = m[i][j - d];
-
-        for (uint32_t k = 0;k < d; ++k) {
-          m[i][j] ^= ((ac & 1u) * m[i][j - d + k]) << (d - k);
-          ac >>= 1;
-        }
-      }
-    }
-  }
-
   template <size_t N> inline void sobol<N>::next(float data[N]) {
     uint32_t c = detail::ctz(++n);
-    for (int i=0;i<N;++i)
-      if (b[i] >= c) {
-        x[i] ^= m[i][c] << (b[i] - c);
-        data[i] = x[i] * exp2(-float(b[i] + 1));
-      } else {
-        x[i] = (x[i] << (c - b[i])) ^ m[i][c];
-        b[i] = c;
-        data[i] = x[i] * exp2(-float(c + 1));
-      }
+    for (size_t i=0;i<N;++i) {
+      x[i] ^= detail::sobol_directions[i][c];
+      data[i] = detail::unit_float(x[i]);
+    }
   }
 
+  // after n steps we're at the point indexed by the gray code of n, so go straight there
   template <size_t N> inline void sobol<N>::skip(uint32_t delta) {
-    uint32_t skips = delta & ~(delta - 1);
-    for (int i=0;i<skips;++i) next();
+    n += delta & ~(delta - 1);
+    for (size_t i=0;i<N;++i)
+      x[i] = detail::sobol_bits(n ^ (n >> 1), uint32_t(i));
   }
 
   // draw N samples from a D dimensional Sobol sequence with skip based warm up
-  template <typename D, typename F>
+  template <size_t D, typename F>
   inline void for_sobol(int N, F f) {
     sobol<D> s;
     s.skip(N);
     for (int i = 0;i < N; ++i)
       f(s.next());
   }
+
+  enum class sobol_scramble {
+    none, // the plain sequence, which starts at the origin and sits on a 2^-32 grid
+    owen  // nested uniform scrambling, by hashing
+  };
+
+  // Random access to a Sobol sequence, Owen scrambled by default.
+  //
+  //   sobol_sequence s(seed);
+  //   vec2 uv = s.get<2>(i);                          // dimensions 0 and 1 of sample i
+  //   s.samples(first, count, dimension, out);        // out[j] = dimension of sample first + j
+  //   s.dimensions(i, first_dimension, count, out);   // out[j] = dimension first_dimension + j of sample i
+  //
+  // A sample is worked out from the bits of its index, with no state to carry along, so workers can each take a
+  // slice of one sequence, in any order, and between them draw exactly the points one thread would have. Samples
+  // come in index order rather than the Gray code order sobol<N> steps through, but each aligned power of two
+  // block of them is the same set of points either way.
+  //
+  // Owen scrambling keeps the stratification, removes the bias, and decorrelates dimensions. Every seed and every
+  // dimension get their own scramble. Indices are 64 bits: the low 32 index the sequence and each further 2^32
+  // samples start a freshly scrambled copy of it, which is as far apart as 24 bits of float could tell them anyway.
+  // Unscrambled, those copies just repeat.
+  //
+  // samples and dimensions run as many lanes wide as sampling_sobol.cpp was compiled for, see simd.h.
+  struct sobol_sequence {
+    explicit sobol_sequence(uint64_t seed = 0, sobol_scramble scramble = sobol_scramble::owen) noexcept
+      : seed(seed), scramble(scramble) {}
+
+    // as a 32 bit fixed point fraction
+    uint32_t bits(uint64_t index, uint32_t dimension) const noexcept {
+      assert(dimension < detail::sobol_dimensions);
+      uint32_t x = detail::sobol_bits(uint32_t(index), dimension);
+      return scramble == sobol_scramble::owen ? detail::owen_scramble(x, dimension_seed(index, dimension)) : x;
+    }
+
+    float operator()(uint64_t index, uint32_t dimension) const noexcept {
+      return detail::unit_float(bits(index, dimension));
+    }
+
+    template <size_t N> typename vec<N>::type get(uint64_t index, uint32_t first_dimension = 0) const noexcept {
+      typename vec<N>::type result;
+      for (size_t i = 0;i < N;++i)
+        (&result.x)[i] = (*this)(index, first_dimension + uint32_t(i));
+      return result;
+    }
+
+    void samples(uint64_t first, size_t count, uint32_t dimension, float * out) const noexcept;
+    void dimensions(uint64_t index, uint32_t first_dimension, size_t count, float * out) const noexcept;
+
+    // the scramble for this dimension over the 2^32 samples around index
+    uint32_t dimension_seed(uint64_t index, uint32_t dimension) const noexcept {
+      return uint32_t(detail::mix64(seed ^ detail::mix64((index >> 32 << 32) | dimension)));
+    }
+
+    uint64_t seed;
+    sobol_scramble scramble;
+  };
 }
 
 /*
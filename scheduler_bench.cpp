@@ -0,0 +1,369 @@
+#include "stdafx.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "cds.h"
+#include "grammar.h"
+#include "parallel.h"
+#include "topology.h"
+#include "worker.h"
+
+// Headless benchmarks for framework::pool, comparing scheduling::dealing against scheduling::stealing.
+//
+//   scheduler_bench [--threads 1,2,4] [--modes dealing,stealing] [--kernels fib,nqueens,...] [--reps 5] [--json] [--out file] [--quick]
+//
+// Every kernel runs in a fresh pool for each mode and thread count. We report the median and worst wall time
+// across repetitions, throughput in kernel-specific items per second, speedup over one thread in the same mode,
+// and the pool's enqueue-to-start latency percentiles. Results go to stdout (or --out) as CSV, or JSON with --json.
+// A kernel that computes the wrong answer fails the run, so this doubles as a smoke test.
+
+using namespace std;
+using namespace std::chrono;
+using namespace framework;
+
+namespace {
+
+  // burn roughly n units of cpu in a way the optimizer can't see through
+  inline uint64_t spin(uint64_t n, uint64_t seed) {
+    uint64_t x = seed | 1;
+    for (uint64_t i = 0; i < n; ++i) {
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+    }
+    return x;
+  }
+
+  inline uint64_t mix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+  }
+
+  struct kernel {
+    const char * name;
+    const char * items; // what run counts
+    function<void()> prepare; // once per repetition, untimed
+    function<uint64_t(pool &)> run; // returns the number of items processed
+    function<bool()> check;
+  };
+
+  struct options {
+    vector<int> threads;
+    vector<scheduling> modes{ scheduling::dealing, scheduling::stealing };
+    vector<string> kernels;
+    int reps = 5;
+    bool json = false;
+    bool quick = false;
+    string out;
+  };
+
+  // fib: the classic, nearly all overhead below the cutoff
+  uint64_t fib_serial(int n) { return n < 2 ? uint64_t(n) : fib_serial(n - 1) + fib_serial(n - 2); }
+
+  uint64_t fib(pool & p, int n, int cutoff) {
+    if (n <= cutoff) return fib_serial(n);
+    uint64_t a = 0, b = 0;
+    parallel_invoke(p, [&] { a = fib(p, n - 1, cutoff); }, [&] { b = fib(p, n - 2, cutoff); });
+    return a + b;
+  }
+
+  // nqueens: irregular search, forks once per legal placement near the root
+  uint64_t queens_serial(int n, int row, uint32_t cols, uint32_t d1, uint32_t d2) {
+    if (row == n) return 1;
+    uint64_t total = 0;
+    uint32_t free = ~(cols | d1 | d2) & ((1u << n) - 1);
+    while (free) {
+      uint32_t bit = free & (0u - free);
+      free ^= bit;
+      total += queens_serial(n, row + 1, cols | bit, (d1 | bit) << 1, (d2 | bit) >> 1);
+    }
+    return total;
+  }
+
+  uint64_t queens(pool & p, int n, int row, uint32_t cols, uint32_t d1, uint32_t d2, int cutoff) {
+    if (row >= cutoff) return queens_serial(n, row, cols, d1, d2);
+    return parallel_reduce(p, 0, n, 1, uint64_t(0), [&](int c, uint64_t & acc) {
+      uint32_t bit = 1u << c;
+      if ((cols | d1 | d2) & bit) return;
+      acc += queens(p, n, row + 1, cols | bit, (d1 | bit) << 1, (d2 | bit) >> 1, cutoff);
+    }, [](uint64_t a, uint64_t b) { return a + b; });
+  }
+
+  // mergesort: fork-join with a serial merge at each level
+  void merge_sort(pool & p, uint32_t * a, uint32_t * scratch, size_t n, size_t cutoff) {
+    if (n <= cutoff) {
+      sort(a, a + n);
+      return;
+    }
+    size_t h = n / 2;
+    parallel_invoke(p,
+      [&] { merge_sort(p, a, scratch, h, cutoff); },
+      [&] { merge_sort(p, a + h, scratch + h, n - h, cutoff); }
+    );
+    merge(a, a + h, a + h, a + n, scratch);
+    copy(scratch, scratch + n, a);
+  }
+
+  // an unbalanced tree in the style of UTS: most nodes are leaves, a few have many children, so the
+  // shape is only discovered as we go. each node does a little work of its own.
+  uint64_t tree(pool & p, uint64_t id, int depth, int max_depth) {
+    uint64_t h = mix(id);
+    if (spin(64 + (h & 255), h) == 0) return 0; // never, but keeps the work from being optimized away
+    if (depth >= max_depth) return 1;
+    int children = (h >> 8) % 8 == 0 ? int(8 + (h >> 16) % 16) : (h >> 8) % 3 == 0 ? 1 : 0;
+    if (depth == 0) children = 32;
+    if (children == 0) return 1;
+    return 1 + parallel_reduce(p, 0, children, 1, uint64_t(0), [&](int c, uint64_t & acc) {
+      acc += tree(p, mix(id * 31 + uint64_t(c) + 1), depth + 1, max_depth);
+    }, [](uint64_t a, uint64_t b) { return a + b; });
+  }
+
+  uint64_t tree_serial(uint64_t id, int depth, int max_depth) {
+    uint64_t h = mix(id);
+    if (depth >= max_depth) return 1;
+    int children = (h >> 8) % 8 == 0 ? int(8 + (h >> 16) % 16) : (h >> 8) % 3 == 0 ? 1 : 0;
+    if (depth == 0) children = 32;
+    uint64_t total = 1;
+    for (int c = 0; c < children; ++c) total += tree_serial(mix(id * 31 + uint64_t(c) + 1), depth + 1, max_depth);
+    return total;
+  }
+
+  vector<kernel> make_kernels(bool quick) {
+    vector<kernel> result;
+
+    {
+      int n = quick ? 25 : 32, cutoff = 12;
+      auto answer = make_shared<uint64_t>(0);
+      uint64_t expected = fib_serial(n), forks = fib_serial(n - cutoff + 1); // leaves of the parallel part of the call tree
+      result.push_back(kernel{ "fib", "forks", [] {}, [n, cutoff, forks, answer](pool & p) {
+        *answer = fib(p, n, cutoff);
+        return forks;
+      }, [answer, expected] { return *answer == expected; } });
+    }
+
+    {
+      int n = quick ? 10 : 13;
+      static const uint64_t solutions[] = { 1, 1, 0, 0, 2, 10, 4, 40, 92, 352, 724, 2680, 14200, 73712, 365596 };
+      auto answer = make_shared<uint64_t>(0);
+      result.push_back(kernel{ "nqueens", "solutions", [] {}, [n, answer](pool & p) {
+        *answer = queens(p, n, 0, 0, 0, 0, 3);
+        return *answer;
+      }, [n, answer] { return *answer == solutions[n]; } });
+    }
+
+    {
+      size_t n = quick ? (size_t(1) << 18) : (size_t(1) << 22);
+      auto data = make_shared<vector<uint32_t>>(n), scratch = make_shared<vector<uint32_t>>(n);
+      result.push_back(kernel{ "mergesort", "elements", [data] {
+        mt19937 rng(1);
+        for (auto & x : *data) x = rng();
+      }, [n, data, scratch](pool & p) {
+        merge_sort(p, data->data(), scratch->data(), n, 2048);
+        return uint64_t(n);
+      }, [data] { return is_sorted(data->begin(), data->end()); } });
+    }
+
+    {
+      int depth = quick ? 8 : 12;
+      auto answer = make_shared<uint64_t>(0);
+      uint64_t expected = tree_serial(1, 0, depth);
+      result.push_back(kernel{ "tree", "nodes", [] {}, [depth, answer](pool & p) {
+        *answer = tree(p, 1, 0, depth);
+        return *answer;
+      }, [answer, expected] { return *answer == expected; } });
+    }
+
+    {
+      int n = quick ? 1 << 14 : 1 << 18;
+      auto answer = make_shared<uint64_t>(0);
+      result.push_back(kernel{ "for_uniform", "iterations", [] {}, [n, answer](pool & p) {
+        *answer = parallel_reduce(p, 0, n, 64, uint64_t(0), [](int i, uint64_t & acc) {
+          acc += spin(256, uint64_t(i)) != 0; // xorshift never reaches 0
+        }, [](uint64_t a, uint64_t b) { return a + b; });
+        return uint64_t(n);
+      }, [n, answer] { return *answer == uint64_t(n); } });
+    }
+
+    {
+      // the last few percent of the range costs as much as everything before it
+      int n = quick ? 1 << 14 : 1 << 18;
+      auto answer = make_shared<uint64_t>(0);
+      result.push_back(kernel{ "for_skewed", "iterations", [] {}, [n, answer](pool & p) {
+        *answer = parallel_reduce(p, 0, n, 64, uint64_t(0), [n](int i, uint64_t & acc) {
+          uint64_t cost = i >= n - n / 32 ? 256 * 32 : i % 97 == 0 ? 4096 : 64;
+          acc += spin(cost, uint64_t(i)) != 0;
+        }, [](uint64_t a, uint64_t b) { return a + b; });
+        return uint64_t(n);
+      }, [n, answer] { return *answer == uint64_t(n); } });
+    }
+
+    return result;
+  }
+
+  struct result {
+    string kernel;
+    const char * mode;
+    int threads;
+    double median_ms, worst_ms;
+    double throughput; // items per second, at the median
+    double speedup; // over one thread in the same mode, 0 if we didn't measure one
+    worker_stats stats;
+  };
+
+  vector<int> parse_list(const char * s) {
+    vector<int> result;
+    istringstream in(s);
+    string item;
+    while (getline(in, item, ',')) result.push_back(atoi(item.c_str()));
+    return result;
+  }
+
+  vector<string> parse_names(const char * s) {
+    vector<string> result;
+    istringstream in(s);
+    string item;
+    while (getline(in, item, ',')) result.push_back(item);
+    return result;
+  }
+
+  void usage() {
+    cerr << "usage: scheduler_bench [--threads 1,2,4] [--modes dealing,stealing] [--kernels fib,nqueens,mergesort,tree,for_uniform,for_skewed] [--reps n] [--json] [--out file] [--quick]\n";
+    exit(2);
+  }
+
+  options parse(int argc, char ** argv) {
+    options o;
+    for (int i = 1; i < argc; ++i) {
+      string a = argv[i];
+      bool more = i + 1 < argc;
+      if (a == "--threads" && more) o.threads = parse_list(argv[++i]);
+      else if (a == "--modes" && more) {
+        o.modes.clear();
+        for (auto && m : parse_names(argv[++i])) {
+          if (m == "dealing") o.modes.push_back(scheduling::dealing);
+          else if (m == "stealing") o.modes.push_back(scheduling::stealing);
+          else usage();
+        }
+      }
+      else if (a == "--kernels" && more) o.kernels = parse_names(argv[++i]);
+      else if (a == "--reps" && more) o.reps = max(1, atoi(argv[++i]));
+      else if (a == "--out" && more) o.out = argv[++i];
+      else if (a == "--json") o.json = true;
+      else if (a == "--quick") o.quick = true;
+      else usage();
+    }
+    if (o.threads.empty()) {
+      int most = available_workers(1); // the main thread joins in as a guest
+      for (int n = 1; n < most; n *= 2) o.threads.push_back(n);
+      o.threads.push_back(most);
+    }
+    return o;
+  }
+
+  const char * name(scheduling mode) { return mode == scheduling::dealing ? "dealing" : "stealing"; }
+
+  void write_csv(ostream & out, const vector<result> & results) {
+    out << "kernel,mode,threads,median_ms,worst_ms,throughput,speedup,tasks,deals,steals,parks,latency_p50_us,latency_p99_us,latency_max_us\n";
+    for (auto && r : results)
+      out << fmt::format("{},{},{},{:.3f},{:.3f},{:.1f},{:.3f},{},{},{},{},{:.2f},{:.2f},{:.2f}\n",
+        r.kernel, r.mode, r.threads, r.median_ms, r.worst_ms, r.throughput, r.speedup,
+        r.stats.tasks, r.stats.deals, r.stats.steals, r.stats.parks,
+        r.stats.latency.percentile(50) * 1e-3, r.stats.latency.percentile(99) * 1e-3, r.stats.latency.max() * 1e-3);
+  }
+
+  void write_json(ostream & out, const vector<result> & results) {
+    out << "[\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+      auto && r = results[i];
+      out << fmt::format("  {{ \"kernel\": \"{}\", \"mode\": \"{}\", \"threads\": {}, \"median_ms\": {:.3f}, \"worst_ms\": {:.3f}, "
+                         "\"throughput\": {:.1f}, \"speedup\": {:.3f}, \"tasks\": {}, \"deals\": {}, \"steals\": {}, \"parks\": {}, "
+                         "\"latency_us\": {{ \"p50\": {:.2f}, \"p99\": {:.2f}, \"max\": {:.2f} }} }}{}\n",
+        r.kernel, r.mode, r.threads, r.median_ms, r.worst_ms, r.throughput, r.speedup,
+        r.stats.tasks, r.stats.deals, r.stats.steals, r.stats.parks,
+        r.stats.latency.percentile(50) * 1e-3, r.stats.latency.percentile(99) * 1e-3, r.stats.latency.max() * 1e-3,
+        i + 1 < results.size() ? "," : "");
+    }
+    out << "]\n";
+  }
+}
+
+int main(int argc, char ** argv) {
+#ifdef FRAMEWORK_SUPPORTS_CDS
+  cds_main_thread_attachment<> main_thread_attachment;
+#endif
+  options o = parse(argc, argv);
+  vector<kernel> kernels = make_kernels(o.quick);
+  if (!o.kernels.empty()) {
+    vector<kernel> chosen;
+    for (auto && n : o.kernels) {
+      auto i = find_if(kernels.begin(), kernels.end(), [&](const kernel & k) { return n == k.name; });
+      if (i == kernels.end()) usage();
+      chosen.push_back(*i);
+    }
+    kernels = chosen;
+  }
+
+  const vector<int> placement = topology::system().placement(1);
+  vector<result> results;
+  bool ok = true;
+  for (auto && k : kernels) {
+    for (auto mode : o.modes) {
+      double one_thread_ms = 0;
+      for (int threads : o.threads) {
+        if (threads < 1) usage();
+        pool p(threads, mode, placement, mt19937(1));
+        vector<double> ms;
+        uint64_t items = 0;
+        k.prepare();
+        k.run(p); // warm up caches, slabs and the deques
+        for (int r = 0; r < o.reps; ++r) {
+          k.prepare();
+          auto start = steady_clock::now();
+          items = k.run(p);
+          ms.push_back(duration<double, milli>(steady_clock::now() - start).count());
+          if (!k.check()) {
+            cerr << fmt::format("{}: wrong answer with {} {} {}\n", k.name, threads, name(mode), plural(threads, "worker", "workers"));
+            ok = false;
+          }
+        }
+        sort(ms.begin(), ms.end());
+        result r;
+        r.kernel = k.name;
+        r.mode = name(mode);
+        r.threads = threads;
+        r.median_ms = ms[ms.size() / 2];
+        r.worst_ms = ms.back();
+        r.throughput = items / max(1e-9, r.median_ms * 1e-3);
+        if (threads == 1) one_thread_ms = r.median_ms;
+        r.speedup = one_thread_ms > 0 ? one_thread_ms / r.median_ms : 0;
+        r.stats = p.stats();
+        cerr << fmt::format("{:>12} {:>8} {:>3} {:>10.3f}ms {:>14.0f} {}/s {:>6.2f}x\n", r.kernel, r.mode, threads, r.median_ms, r.throughput, k.items, r.speedup);
+        results.push_back(std::move(r));
+      }
+    }
+  }
+
+  ofstream file;
+  if (!o.out.empty()) {
+    file.open(o.out);
+    if (!file) {
+      cerr << "unable to open " << o.out << "\n";
+      return 1;
+    }
+  }
+  ostream & out = o.out.empty() ? cout : file;
+  if (o.json) write_json(out, results);
+  else write_csv(out, results);
+  return ok ? 0 : 1;
+}
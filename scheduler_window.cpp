@@ -0,0 +1,80 @@
+#include "stdafx.h"
+#include <algorithm>
+#include <fstream>
+#include "epoch.h"
+#include "gui.h"
+#include "pool_allocator.h"
+#include "worker.h"
+
+using namespace std;
+
+namespace framework {
+
+  static const char * const stats_filename = "scheduler.txt";
+
+  void scheduler_window(bool * open) {
+    gui::SetNextWindowSize(ImVec2(560, 300), ImGuiSetCond_FirstUseEver);
+    if (open && gui::Begin("Scheduler", open)) {
+      pool * p = scheduler::current();
+      if (p == nullptr) {
+        gui::Text("no scheduler");
+        gui::End();
+        return;
+      }
+
+      worker_stats total = p->stats();
+      gui::Text("%d workers, %s", p->N, p->mode == scheduling::dealing ? "dealing" : "stealing");
+      gui::Text("%llu tasks, enqueue to start: p50 %.1fus, p99 %.1fus, max %.1fus",
+        (unsigned long long) total.tasks, total.latency.percentile(50) * 1e-3, total.latency.percentile(99) * 1e-3, total.latency.max() * 1e-3);
+      gui::Text("background: p50 %.1fus, p99 %.1fus, max %.1fus, %llu yields to critical work",
+        total.background_latency.percentile(50) * 1e-3, total.background_latency.percentile(99) * 1e-3, total.background_latency.max() * 1e-3,
+        (unsigned long long) total.yields);
+      gui::Text("%llu run where they were sent, %llu redirected from busy workers", (unsigned long long) total.affine, (unsigned long long) total.redirected);
+      epoch_stats e = epoch_manager::global().stats();
+      gui::Text("epoch %u: %llu retired objects pending (peak %llu), %llu reclaimed, %llu of %llu threads in critical sections",
+        e.epoch, (unsigned long long) e.pending, (unsigned long long) e.peak, (unsigned long long) e.reclaimed,
+        (unsigned long long) e.active, (unsigned long long) e.records);
+      pool_stats ps = get_pool_stats();
+      gui::Text("small object pool: %llu spans across %llu threads, %llu blocks sent home in %llu batches",
+        (unsigned long long) ps.spans, (unsigned long long) ps.caches, (unsigned long long) ps.remote_blocks, (unsigned long long) ps.remote_batches);
+
+      static bool dumped = false, dump_failed = false;
+      if (gui::Button("Dump")) {
+        ofstream out(stats_filename);
+        p->dump_stats(out);
+        dumped = true;
+        dump_failed = !out;
+      }
+      if (dumped) {
+        gui::SameLine();
+        gui::Text(dump_failed ? "unable to write %s" : "wrote %s", stats_filename);
+      }
+
+      gui::Separator();
+      gui::Columns(7, "workers");
+      const char * headings[] = { "worker", "tasks", p->mode == scheduling::dealing ? "deals" : "steals", "parks", "queue", "busy", "p99" };
+      for (auto h : headings) {
+        gui::Text("%s", h);
+        gui::NextColumn();
+      }
+      gui::Separator();
+      for (auto && w : p->workers) {
+        worker_stats s = w->stats();
+        double elapsed = std::max<double>(1.0, double(s.times.working + s.times.spinning + s.times.parked));
+        gui::Text("%d", w->i); gui::NextColumn();
+        gui::Text("%llu", (unsigned long long) s.tasks); gui::NextColumn();
+        if (p->mode == scheduling::dealing)
+          gui::Text("%llu/%llu", (unsigned long long) s.deals, (unsigned long long) s.deals_attempted);
+        else
+          gui::Text("%llu/%llu", (unsigned long long) s.steals, (unsigned long long) s.steal_attempts);
+        gui::NextColumn();
+        gui::Text("%llu", (unsigned long long) s.parks); gui::NextColumn();
+        gui::Text("%llu (%llu)", (unsigned long long) s.queue_depth, (unsigned long long) s.max_queue_depth); gui::NextColumn();
+        gui::Text("%.0f%%", 100.0 * s.times.working / elapsed); gui::NextColumn();
+        gui::Text("%.1fus", s.latency.percentile(99) * 1e-3); gui::NextColumn();
+      }
+      gui::Columns(1);
+      gui::End();
+    }
+  }
+}
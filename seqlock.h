@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "noncopyable.h"
+
+// A ring of the last N values written by one thread, readable by any number of others.
+//
+// Each slot carries a sequence number that is odd while the writer is in the middle of filling it, and otherwise
+// records which write last landed there. The writer never waits. A reader copies a slot out and then checks that
+// the sequence didn't move while it was looking; if it did, the copy is thrown away. Readers never write to
+// shared memory, so any number of them can look without slowing the writer or each other down.
+//
+// The payload is copied in and out a word at a time through relaxed atomics, so a torn read is a well-defined
+// torn read, caught by the sequence check, rather than a data race.
+namespace framework {
+
+  template <typename T, size_t N = 64> struct seqlock_ring : noncopyable {
+    static_assert(std::is_trivially_copyable<T>::value, "seqlock_ring: T must be trivially copyable");
+    static_assert(N != 0 && (N & (N - 1)) == 0, "seqlock_ring: N must be a power of 2");
+
+    static const size_t capacity = N;
+
+    seqlock_ring() noexcept {
+      for (auto & s : slots) {
+        s.sequence.store(0, std::memory_order_relaxed);
+        for (auto & w : s.words) w.store(0, std::memory_order_relaxed);
+      }
+    }
+
+    // writer only. returns the index of the value written
+    uint64_t push(const T & value) noexcept {
+      uint64_t i = written.load(std::memory_order_relaxed);
+      slot & s = slots[i & (N - 1)];
+      s.sequence.store(2 * i + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release); // nobody sees the new words without seeing the odd sequence
+      uint64_t buffer[words];
+      buffer[words - 1] = 0;
+      std::memcpy(buffer, &value, sizeof(T));
+      for (size_t k = 0; k < words; ++k) s.words[k].store(buffer[k], std::memory_order_relaxed);
+      s.sequence.store(2 * i + 2, std::memory_order_release);
+      written.store(i + 1, std::memory_order_release);
+      return i;
+    }
+
+    // how many values have ever been written. the latest, if any, has index size() - 1
+    uint64_t size() const noexcept { return written.load(std::memory_order_acquire); }
+
+    // copy out the value with the given index. false if it hasn't been written yet, or has since been overwritten
+    bool read(uint64_t i, T & result) const noexcept {
+      const slot & s = slots[i & (N - 1)];
+      uint64_t expected = 2 * i + 2;
+      uint64_t buffer[words];
+      if (s.sequence.load(std::memory_order_acquire) != expected) return false; // not there yet, or already gone
+      for (size_t k = 0; k < words; ++k) buffer[k] = s.words[k].load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire); // our loads of the words happen before we recheck
+      if (s.sequence.load(std::memory_order_relaxed) != expected) return false; // lapped while we were reading
+      std::memcpy(&result, buffer, sizeof(T));
+      return true;
+    }
+
+    // copy out the most recent value. false if nothing has been written
+    bool latest(T & result) const noexcept {
+      for (;;) {
+        uint64_t n = size();
+        if (n == 0) return false;
+        if (read(n - 1, result)) return true;
+      }
+    }
+
+  private:
+    static const size_t words = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    struct alignas(64) slot {
+      std::atomic<uint64_t> sequence;
+      std::atomic<uint64_t> words[seqlock_ring::words];
+    };
+
+    alignas(64) std::atomic<uint64_t> written{ 0 };
+    slot slots[N];
+  };
+}
@@ -0,0 +1,303 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX512F__) || defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#endif
+
+// Just enough of a portable float and uint32_t vector to write a kernel once and run it 1, 4, 8 or 16 lanes wide.
+//
+//   template <typename F> void kernel(const float * u, float * x) {
+//     F s, c;
+//     sincos(F::load(u) * tau, s, c);
+//     (s * c).store(x);
+//   }
+//
+// f32xn is the widest type the translation unit was compiled for: AVX-512 with /arch:AVX512 or -mavx512f,
+// AVX with /arch:AVX or /arch:AVX2, SSE2 on any x64 build, otherwise plain floats. f32x1 has the same interface
+// and the same math, so tails and portable builds compute the same values the wide lanes would.
+//
+// u32xn is the same for integers, except that it takes AVX2 to go 8 wide. Arithmetic wraps, as for uint32_t, and
+// store_unit writes each lane as a 32 bit fixed point fraction, truncated to the 24 bits a float can hold so that
+// nothing rounds up to 1.
+//
+// Comparisons yield a mask, which select() uses to choose lane by lane. The math is accurate to a few ulps on the
+// ranges the samplers feed it, not a replacement for <cmath> elsewhere.
+namespace framework {
+  namespace simd {
+
+    struct f32x1 {
+      typedef bool mask;
+      static const size_t width = 1;
+      float v;
+      f32x1() noexcept {}
+      f32x1(float v) noexcept : v(v) {}
+      static f32x1 load(const float * p) noexcept { return *p; }
+      void store(float * p) const noexcept { *p = v; }
+    };
+
+    inline f32x1 operator + (f32x1 a, f32x1 b) noexcept { return a.v + b.v; }
+    inline f32x1 operator - (f32x1 a, f32x1 b) noexcept { return a.v - b.v; }
+    inline f32x1 operator * (f32x1 a, f32x1 b) noexcept { return a.v * b.v; }
+    inline f32x1 operator / (f32x1 a, f32x1 b) noexcept { return a.v / b.v; }
+    inline f32x1 operator - (f32x1 a) noexcept { return -a.v; }
+    inline bool operator < (f32x1 a, f32x1 b) noexcept { return a.v < b.v; }
+    inline bool operator > (f32x1 a, f32x1 b) noexcept { return a.v > b.v; }
+    inline bool operator == (f32x1 a, f32x1 b) noexcept { return a.v == b.v; }
+    inline f32x1 select(bool m, f32x1 a, f32x1 b) noexcept { return m ? a : b; }
+    inline f32x1 sqrt(f32x1 a) noexcept { return std::sqrt(a.v); }
+    inline f32x1 min(f32x1 a, f32x1 b) noexcept { return b.v < a.v ? b.v : a.v; }
+    inline f32x1 max(f32x1 a, f32x1 b) noexcept { return a.v < b.v ? b.v : a.v; }
+    inline f32x1 abs(f32x1 a) noexcept { return std::fabs(a.v); }
+    inline f32x1 trunc(f32x1 a) noexcept { return float(int(a.v)); } // |a| < 2^31
+
+    static const float unit_scale = 5.9604644775390625e-8f; // 2^-24
+
+    struct u32x1 {
+      static const size_t width = 1;
+      uint32_t v;
+      u32x1() noexcept {}
+      u32x1(uint32_t v) noexcept : v(v) {}
+      static u32x1 load(const uint32_t * p) noexcept { return *p; }
+      void store(uint32_t * p) const noexcept { *p = v; }
+      void store_unit(float * p) const noexcept { *p = float(v >> 8) * unit_scale; }
+    };
+
+    inline u32x1 operator + (u32x1 a, u32x1 b) noexcept { return a.v + b.v; }
+    inline u32x1 operator * (u32x1 a, u32x1 b) noexcept { return a.v * b.v; }
+    inline u32x1 operator ^ (u32x1 a, u32x1 b) noexcept { return a.v ^ b.v; }
+    inline u32x1 operator & (u32x1 a, u32x1 b) noexcept { return a.v & b.v; }
+    inline u32x1 operator | (u32x1 a, u32x1 b) noexcept { return a.v | b.v; }
+    inline u32x1 operator >> (u32x1 a, int n) noexcept { return a.v >> n; }
+    inline u32x1 operator << (u32x1 a, int n) noexcept { return a.v << n; }
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__AVX__)
+#define FRAMEWORK_SIMD_SSE2
+
+    struct m32x4 { __m128 v; };
+
+    struct f32x4 {
+      typedef m32x4 mask;
+      static const size_t width = 4;
+      __m128 v;
+      f32x4() noexcept {}
+      f32x4(__m128 v) noexcept : v(v) {}
+      f32x4(float f) noexcept : v(_mm_set1_ps(f)) {}
+      static f32x4 load(const float * p) noexcept { return _mm_loadu_ps(p); }
+      void store(float * p) const noexcept { _mm_storeu_ps(p, v); }
+    };
+
+    inline f32x4 operator + (f32x4 a, f32x4 b) noexcept { return _mm_add_ps(a.v, b.v); }
+    inline f32x4 operator - (f32x4 a, f32x4 b) noexcept { return _mm_sub_ps(a.v, b.v); }
+    inline f32x4 operator * (f32x4 a, f32x4 b) noexcept { return _mm_mul_ps(a.v, b.v); }
+    inline f32x4 operator / (f32x4 a, f32x4 b) noexcept { return _mm_div_ps(a.v, b.v); }
+    inline f32x4 operator - (f32x4 a) noexcept { return _mm_xor_ps(a.v, _mm_set1_ps(-0.f)); }
+    inline m32x4 operator < (f32x4 a, f32x4 b) noexcept { return m32x4{ _mm_cmplt_ps(a.v, b.v) }; }
+    inline m32x4 operator > (f32x4 a, f32x4 b) noexcept { return m32x4{ _mm_cmpgt_ps(a.v, b.v) }; }
+    inline m32x4 operator == (f32x4 a, f32x4 b) noexcept { return m32x4{ _mm_cmpeq_ps(a.v, b.v) }; }
+    inline m32x4 operator | (m32x4 a, m32x4 b) noexcept { return m32x4{ _mm_or_ps(a.v, b.v) }; }
+    inline m32x4 operator & (m32x4 a, m32x4 b) noexcept { return m32x4{ _mm_and_ps(a.v, b.v) }; }
+    inline m32x4 operator ! (m32x4 a) noexcept { return m32x4{ _mm_xor_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(-1))) }; }
+    inline f32x4 select(m32x4 m, f32x4 a, f32x4 b) noexcept { return _mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v)); }
+    inline f32x4 sqrt(f32x4 a) noexcept { return _mm_sqrt_ps(a.v); }
+    inline f32x4 min(f32x4 a, f32x4 b) noexcept { return _mm_min_ps(a.v, b.v); }
+    inline f32x4 max(f32x4 a, f32x4 b) noexcept { return _mm_max_ps(a.v, b.v); }
+    inline f32x4 abs(f32x4 a) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.f), a.v); }
+    inline f32x4 trunc(f32x4 a) noexcept { return _mm_cvtepi32_ps(_mm_cvttps_epi32(a.v)); }
+
+    struct u32x4 {
+      static const size_t width = 4;
+      __m128i v;
+      u32x4() noexcept {}
+      u32x4(__m128i v) noexcept : v(v) {}
+      u32x4(uint32_t i) noexcept : v(_mm_set1_epi32(int(i))) {}
+      static u32x4 load(const uint32_t * p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+      void store(uint32_t * p) const noexcept { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+      void store_unit(float * p) const noexcept { _mm_storeu_ps(p, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(v, 8)), _mm_set1_ps(unit_scale))); }
+    };
+
+    inline u32x4 operator + (u32x4 a, u32x4 b) noexcept { return _mm_add_epi32(a.v, b.v); }
+#if defined(__SSE4_1__) || defined(__AVX__)
+    inline u32x4 operator * (u32x4 a, u32x4 b) noexcept { return _mm_mullo_epi32(a.v, b.v); }
+#else
+    // no pmulld before SSE4.1, so multiply the even and odd lanes separately and interleave the low halves
+    inline u32x4 operator * (u32x4 a, u32x4 b) noexcept {
+      __m128i even = _mm_mul_epu32(a.v, b.v);
+      __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a.v, 32), _mm_srli_epi64(b.v, 32));
+      return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    }
+#endif
+    inline u32x4 operator ^ (u32x4 a, u32x4 b) noexcept { return _mm_xor_si128(a.v, b.v); }
+    inline u32x4 operator & (u32x4 a, u32x4 b) noexcept { return _mm_and_si128(a.v, b.v); }
+    inline u32x4 operator | (u32x4 a, u32x4 b) noexcept { return _mm_or_si128(a.v, b.v); }
+    inline u32x4 operator >> (u32x4 a, int n) noexcept { return _mm_srl_epi32(a.v, _mm_cvtsi32_si128(n)); }
+    inline u32x4 operator << (u32x4 a, int n) noexcept { return _mm_sll_epi32(a.v, _mm_cvtsi32_si128(n)); }
+#endif
+
+#ifdef __AVX__
+#define FRAMEWORK_SIMD_AVX
+
+    struct m32x8 { __m256 v; };
+
+    struct f32x8 {
+      typedef m32x8 mask;
+      static const size_t width = 8;
+      __m256 v;
+      f32x8() noexcept {}
+      f32x8(__m256 v) noexcept : v(v) {}
+      f32x8(float f) noexcept : v(_mm256_set1_ps(f)) {}
+      static f32x8 load(const float * p) noexcept { return _mm256_loadu_ps(p); }
+      void store(float * p) const noexcept { _mm256_storeu_ps(p, v); }
+    };
+
+    inline f32x8 operator + (f32x8 a, f32x8 b) noexcept { return _mm256_add_ps(a.v, b.v); }
+    inline f32x8 operator - (f32x8 a, f32x8 b) noexcept { return _mm256_sub_ps(a.v, b.v); }
+    inline f32x8 operator * (f32x8 a, f32x8 b) noexcept { return _mm256_mul_ps(a.v, b.v); }
+    inline f32x8 operator / (f32x8 a, f32x8 b) noexcept { return _mm256_div_ps(a.v, b.v); }
+    inline f32x8 operator - (f32x8 a) noexcept { return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.f)); }
+    inline m32x8 operator < (f32x8 a, f32x8 b) noexcept { return m32x8{ _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+    inline m32x8 operator > (f32x8 a, f32x8 b) noexcept { return m32x8{ _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+    inline m32x8 operator == (f32x8 a, f32x8 b) noexcept { return m32x8{ _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ) }; }
+    inline m32x8 operator | (m32x8 a, m32x8 b) noexcept { return m32x8{ _mm256_or_ps(a.v, b.v) }; }
+    inline m32x8 operator & (m32x8 a, m32x8 b) noexcept { return m32x8{ _mm256_and_ps(a.v, b.v) }; }
+    inline m32x8 operator ! (m32x8 a) noexcept { return m32x8{ _mm256_xor_ps(a.v, _mm256_castsi256_ps(_mm256_set1_epi32(-1))) }; }
+    inline f32x8 select(m32x8 m, f32x8 a, f32x8 b) noexcept { return _mm256_blendv_ps(b.v, a.v, m.v); }
+    inline f32x8 sqrt(f32x8 a) noexcept { return _mm256_sqrt_ps(a.v); }
+    inline f32x8 min(f32x8 a, f32x8 b) noexcept { return _mm256_min_ps(a.v, b.v); }
+    inline f32x8 max(f32x8 a, f32x8 b) noexcept { return _mm256_max_ps(a.v, b.v); }
+    inline f32x8 abs(f32x8 a) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a.v); }
+    inline f32x8 trunc(f32x8 a) noexcept { return _mm256_cvtepi32_ps(_mm256_cvttps_epi32(a.v)); }
+#endif
+
+#ifdef __AVX2__
+#define FRAMEWORK_SIMD_AVX2
+
+    struct u32x8 {
+      static const size_t width = 8;
+      __m256i v;
+      u32x8() noexcept {}
+      u32x8(__m256i v) noexcept : v(v) {}
+      u32x8(uint32_t i) noexcept : v(_mm256_set1_epi32(int(i))) {}
+      static u32x8 load(const uint32_t * p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+      void store(uint32_t * p) const noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+      void store_unit(float * p) const noexcept { _mm256_storeu_ps(p, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(v, 8)), _mm256_set1_ps(unit_scale))); }
+    };
+
+    inline u32x8 operator + (u32x8 a, u32x8 b) noexcept { return _mm256_add_epi32(a.v, b.v); }
+    inline u32x8 operator * (u32x8 a, u32x8 b) noexcept { return _mm256_mullo_epi32(a.v, b.v); }
+    inline u32x8 operator ^ (u32x8 a, u32x8 b) noexcept { return _mm256_xor_si256(a.v, b.v); }
+    inline u32x8 operator & (u32x8 a, u32x8 b) noexcept { return _mm256_and_si256(a.v, b.v); }
+    inline u32x8 operator | (u32x8 a, u32x8 b) noexcept { return _mm256_or_si256(a.v, b.v); }
+    inline u32x8 operator >> (u32x8 a, int n) noexcept { return _mm256_srl_epi32(a.v, _mm_cvtsi32_si128(n)); }
+    inline u32x8 operator << (u32x8 a, int n) noexcept { return _mm256_sll_epi32(a.v, _mm_cvtsi32_si128(n)); }
+#endif
+
+#ifdef __AVX512F__
+#define FRAMEWORK_SIMD_AVX512
+
+    struct m32x16 { __mmask16 v; };
+
+    struct f32x16 {
+      typedef m32x16 mask;
+      static const size_t width = 16;
+      __m512 v;
+      f32x16() noexcept {}
+      f32x16(__m512 v) noexcept : v(v) {}
+      f32x16(float f) noexcept : v(_mm512_set1_ps(f)) {}
+      static f32x16 load(const float * p) noexcept { return _mm512_loadu_ps(p); }
+      void store(float * p) const noexcept { _mm512_storeu_ps(p, v); }
+    };
+
+    inline f32x16 operator + (f32x16 a, f32x16 b) noexcept { return _mm512_add_ps(a.v, b.v); }
+    inline f32x16 operator - (f32x16 a, f32x16 b) noexcept { return _mm512_sub_ps(a.v, b.v); }
+    inline f32x16 operator * (f32x16 a, f32x16 b) noexcept { return _mm512_mul_ps(a.v, b.v); }
+    inline f32x16 operator / (f32x16 a, f32x16 b) noexcept { return _mm512_div_ps(a.v, b.v); }
+    // xor_ps wants AVX512DQ, so flip the sign bit as an integer
+    inline f32x16 operator - (f32x16 a) noexcept { return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a.v), _mm512_set1_epi32(int(0x80000000u)))); }
+    inline m32x16 operator < (f32x16 a, f32x16 b) noexcept { return m32x16{ _mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ) }; }
+    inline m32x16 operator > (f32x16 a, f32x16 b) noexcept { return m32x16{ _mm512_cmp_ps_mask(a.v, b.v, _CMP_GT_OQ) }; }
+    inline m32x16 operator == (f32x16 a, f32x16 b) noexcept { return m32x16{ _mm512_cmp_ps_mask(a.v, b.v, _CMP_EQ_OQ) }; }
+    inline m32x16 operator | (m32x16 a, m32x16 b) noexcept { return m32x16{ __mmask16(a.v | b.v) }; }
+    inline m32x16 operator & (m32x16 a, m32x16 b) noexcept { return m32x16{ __mmask16(a.v & b.v) }; }
+    inline m32x16 operator ! (m32x16 a) noexcept { return m32x16{ __mmask16(~a.v) }; }
+    inline f32x16 select(m32x16 m, f32x16 a, f32x16 b) noexcept { return _mm512_mask_blend_ps(m.v, b.v, a.v); }
+    inline f32x16 sqrt(f32x16 a) noexcept { return _mm512_sqrt_ps(a.v); }
+    inline f32x16 min(f32x16 a, f32x16 b) noexcept { return _mm512_min_ps(a.v, b.v); }
+    inline f32x16 max(f32x16 a, f32x16 b) noexcept { return _mm512_max_ps(a.v, b.v); }
+    inline f32x16 abs(f32x16 a) noexcept { return _mm512_abs_ps(a.v); }
+    inline f32x16 trunc(f32x16 a) noexcept { return _mm512_cvtepi32_ps(_mm512_cvttps_epi32(a.v)); }
+
+    struct u32x16 {
+      static const size_t width = 16;
+      __m512i v;
+      u32x16() noexcept {}
+      u32x16(__m512i v) noexcept : v(v) {}
+      u32x16(uint32_t i) noexcept : v(_mm512_set1_epi32(int(i))) {}
+      static u32x16 load(const uint32_t * p) noexcept { return _mm512_loadu_si512(p); }
+      void store(uint32_t * p) const noexcept { _mm512_storeu_si512(p, v); }
+      void store_unit(float * p) const noexcept { _mm512_storeu_ps(p, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_srli_epi32(v, 8)), _mm512_set1_ps(unit_scale))); }
+    };
+
+    inline u32x16 operator + (u32x16 a, u32x16 b) noexcept { return _mm512_add_epi32(a.v, b.v); }
+    inline u32x16 operator * (u32x16 a, u32x16 b) noexcept { return _mm512_mullo_epi32(a.v, b.v); }
+    inline u32x16 operator ^ (u32x16 a, u32x16 b) noexcept { return _mm512_xor_si512(a.v, b.v); }
+    inline u32x16 operator & (u32x16 a, u32x16 b) noexcept { return _mm512_and_si512(a.v, b.v); }
+    inline u32x16 operator | (u32x16 a, u32x16 b) noexcept { return _mm512_or_si512(a.v, b.v); }
+    inline u32x16 operator >> (u32x16 a, int n) noexcept { return _mm512_srl_epi32(a.v, _mm_cvtsi32_si128(n)); }
+    inline u32x16 operator << (u32x16 a, int n) noexcept { return _mm512_sll_epi32(a.v, _mm_cvtsi32_si128(n)); }
+#endif
+
+#if defined(FRAMEWORK_SIMD_AVX512)
+    typedef f32x16 f32xn;
+#elif defined(FRAMEWORK_SIMD_AVX)
+    typedef f32x8 f32xn;
+#elif defined(FRAMEWORK_SIMD_SSE2)
+    typedef f32x4 f32xn;
+#else
+    typedef f32x1 f32xn;
+#endif
+
+#if defined(FRAMEWORK_SIMD_AVX512)
+    typedef u32x16 u32xn;
+#elif defined(FRAMEWORK_SIMD_AVX2)
+    typedef u32x8 u32xn;
+#elif defined(FRAMEWORK_SIMD_SSE2)
+    typedef u32x4 u32xn;
+#else
+    typedef u32x1 u32xn;
+#endif
+
+    // Cephes' sinf and cosf, sharing the range reduction: fold |x| into an octant, evaluate both polynomials on
+    // [-pi/4,pi/4], then swap and negate by octant. good to about 2 ulps for |x| up to a few thousand.
+    template <typename F> inline void sincos(F x, F & s, F & c) noexcept {
+      F sign = select(x < F(0.f), F(-1.f), F(1.f));
+      x = abs(x);
+      F j = trunc(x * F(1.27323954473516f)); // 4/pi
+      j = j + (j - F(2.f) * trunc(j * F(0.5f))); // round odd octants up, so j is even
+      F octant = j - F(8.f) * trunc(j * F(0.125f)); // 0, 2, 4 or 6
+      x = ((x - j * F(0.78515625f)) - j * F(2.4187564849853515625e-4f)) - j * F(3.77489497744594108e-8f);
+      F z = x * x;
+      F pc = ((F(2.443315711809948e-5f) * z - F(1.388731625493765e-3f)) * z + F(4.166664568298827e-2f)) * z * z - F(0.5f) * z + F(1.f);
+      F ps = ((F(-1.9515295891e-4f) * z + F(8.3321608736e-3f)) * z - F(1.6666654611e-1f)) * z * x + x;
+      auto swap = (octant == F(2.f)) | (octant == F(6.f));
+      auto sin_negative = (octant == F(4.f)) | (octant == F(6.f));
+      auto cos_negative = (octant == F(2.f)) | (octant == F(4.f));
+      F sv = select(swap, pc, ps);
+      F cv = select(swap, ps, pc);
+      s = select(sin_negative, -sv, sv) * sign;
+      c = select(cos_negative, -cv, cv);
+    }
+
+    // for 1 - x*x and the like, which can round a hair below zero
+    template <typename F> inline F safe_sqrt(F x) noexcept {
+      return sqrt(max(x, F(0.f)));
+    }
+
+    template <typename F> inline F clamp(F x, F lo, F hi) noexcept {
+      return min(max(x, lo), hi);
+    }
+  }
+}
@@ -1,5 +1,7 @@
 #include "stdafx.h"
 #include "skybox.h"
+#include "aligned_allocator.h"
+#include "memory_accounting.h"
 #include "glm.h"
 #include <cmath>
 #include <algorithm>
@@ -12,8 +14,10 @@
 #include "std.h"
 #include "gui.h"
 #include "timer.h"
+#include "metrics.h"
 #include "uniforms.h"
-#include <omp.h>
+#include "parallel.h"
+#include "coroutine.h"
 #include <glm/detail/type_half.hpp>
 
 extern "C" {
@@ -55,7 +59,9 @@ namespace framework {
       glTextureParameteri(cubemap, GL_TEXTURE_CUBE_MAP_SEAMLESS, GL_TRUE);
     else
       log("sky")->warn("GL_ARB_seamless_cubemap_per_texture unsupported");
-    glTextureStorage2D(cubemap, clamp(GLsizei(log2(float(N))),1,10), GL_RGBA16F, N, N);
+    GLsizei levels = clamp(GLsizei(log2(float(N))),1,10);
+    glTextureStorage2D(cubemap, levels, GL_RGBA16F, N, N);
+    gl::track_texture(cubemap, gl::texture_bytes(GL_RGBA16F, N, N, 6, levels), memory_tag::sky);
 
     cubemap_handle = glGetTextureHandleARB(cubemap);
     glMakeTextureHandleResidentARB(cubemap_handle);
@@ -67,16 +73,50 @@ namespace framework {
       glTextureParameteri(cubemap_views[i], GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
       glTextureParameteri(cubemap_views[i], GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
       glTextureStorage2D(cubemap_views[i], 3, GL_RGBA8, N, N);
+      gl::track_texture(cubemap_views[i], gl::texture_bytes(GL_RGBA8, N, N, 1, 3), memory_tag::sky);
     }
 
     initialized = false;
   }
 
   // sun size is in radians, not degrees
+  // written by whichever worker bakes, read by the gui
+  static gauge last_skybox_update_time("sky.skybox update", "ms");
+  static gauge last_solar_radiance_update_time("sky.solar radiance update", "ms");
+  static gauge last_update_time("sky.update", "ms");
+  static sharded_histogram update_times("sky.updates", "ms"); // decision to rebuild through upload
+
+  // everything a rebuild needs and produces. computing it touches neither GL nor the sky itself, so it can happen anywhere.
+  struct sky::bake {
+    int start; // SDL_GetTicks() when we decided to rebuild
+
+    vec3 sun_dir;
+    float sun_angular_radius;
+    vec3 ground_albedo;
+    float turbidity;
+    cancellation_token cancel; // set once the parameters have changed again, and this bake is no longer wanted
+
+    float elevation;
+    // filled by the worker that runs the bake, so back them with pages local to it, faulted in before we start
+    vector<tvec4<half>, accounted_allocator<tvec4<half>, memory_tag::sky, aligned_allocator<tvec4<half>, 64, memory_bake>>> cubemap_data;
+    vector<tvec4<uint8_t>, accounted_allocator<tvec4<uint8_t>, memory_tag::sky, aligned_allocator<tvec4<uint8_t>, 64, memory_bake>>> tonemapped_cubemap_data;
+    vec4 sky_sh9[9];
+    vec3 sun_irradiance;
+  };
+
+#ifdef FRAMEWORK_SUPPORTS_COROUTINES
+  // bake in the background lane of the pool, then come back to the main thread to upload
+  static async<void> rebuild(sky & s, unique_ptr<sky::bake> b, app_uniforms & uniforms) {
+    if (pool * p = scheduler::current()) co_await p->schedule(priority::background);
+    sky::compute(*b);
+    co_await on_main_thread();
+    if (b->cancel.cancelled()) co_return; // superseded while we were baking, and whoever did that now owns rebuilding
+    s.apply(*b, uniforms);
+    s.rebuilding = false;
+  }
+#endif
+
   void sky::update(app_uniforms & uniforms) {
-    static int last_skybox_update_time = 0;
-    static int last_solar_radiance_update_time = 0;
-    static int last_update_time = 0;
     static int time_accum = 0;
 
     // show gui
@@ -96,9 +136,9 @@ namespace framework {
       just_released = just_released || gui::IsItemJustReleased();
       gui::ColorEdit3("ground albedo", reinterpret_cast<float*>(&uniforms.ground_albedo));
       just_released = just_released || gui::IsItemJustReleased();
-      gui::text("Last overall update time: {}ms", last_update_time);
-      gui::text("Last solar radiance update time: {}ms", last_solar_radiance_update_time);
-      gui::text("Last skybox update time: {}ms", last_skybox_update_time);
+      gui::text("Last overall update time: {}ms", last_update_time.read());
+      gui::text("Last solar radiance update time: {}ms", last_solar_radiance_update_time.read());
+      gui::text("Last skybox update time: {}ms", last_skybox_update_time.read());
       gui::End();
     }
     uniforms.sun_dir = normalize(direction_editor.val);
@@ -124,13 +164,12 @@ namespace framework {
       // if the user is dragging the mouse rate limit so we don't spend more than half our time updating the sky
       if (!just_released) {
         time_accum += 11;
-        if (time_accum < last_update_time) return;
+        if (time_accum < last_update_time.read()) return;
       }
     }
 
 
     time_accum = 0;    
-    int start = SDL_GetTicks(); 
 
     // modify cache parameters, we're doing this
     direction_editor.val = sun_dir = uniforms.sun_dir;
@@ -138,18 +177,44 @@ namespace framework {
     turbidity = uniforms.turbidity;
     ground_albedo = uniforms.ground_albedo;
 
+    unique_ptr<bake> b(new bake);
+    b->start = SDL_GetTicks();
+    b->sun_dir = sun_dir;
+    b->sun_angular_radius = sun_angular_radius;
+    b->ground_albedo = ground_albedo;
+    b->turbidity = turbidity;
+
+#ifdef FRAMEWORK_SUPPORTS_COROUTINES
+    if (initialized) { // the first one we wait for, so that we never show an empty sky
+      if (rebuilding) rebuild_source.cancel(); // whatever it is baking is stale now
+      rebuild_source = cancellation_source();
+      b->cancel = rebuild_source.token();
+      rebuilding = true;
+      detach(rebuild(*this, std::move(b), uniforms));
+      return;
+    }
+#endif
+    compute(*b);
+    apply(*b, uniforms);
+  }
+
+  void sky::compute(bake & b) {
+    const vec3 & sun_dir = b.sun_dir;
+    const vec3 & ground_albedo = b.ground_albedo;
+    const float turbidity = b.turbidity;
+
     float theta_sun = angle_between(sun_dir, vec3(0, 1, 0));
-    elevation = float(M_PI_2) - theta_sun;
+    float elevation = b.elevation = float(M_PI_2) - theta_sun;
 
-    vector<tvec4<half>> cubemap_data(6 * N * N);
-    vector<tvec4<uint8_t>> tonemapped_cubemap_data(6 * N*N);
+    auto & cubemap_data = b.cubemap_data;
+    auto & tonemapped_cubemap_data = b.tonemapped_cubemap_data;
+    cubemap_data.resize(6 * N * N);
+    tonemapped_cubemap_data.resize(6 * N*N);
 
     {
       // compute skybox and spherical harmonics ~2s
       {
         int sky_start = SDL_GetTicks();
-        float weights = 0.0f;
-
         ArHosekSkyModelState * rgb[3];
         // create an rgb sky model for sampling
         for (int i = 0;i < 3;++i)
@@ -157,8 +222,9 @@ namespace framework {
 
         sh9_t<vec3> sh_array[N]{};
 
-        #pragma omp parallel for reduction(+:weights)
-        for (int y = 0; y < N; ++y) {
+        // each row owns its own spherical harmonic accumulator, so only the weights need reducing
+        float weights = parallel_reduce(0, N, 1, 0.0f, [&](int y, float & partial) {
+          if (b.cancel.cancelled()) return; // nobody is going to look at the result
           for (int s = 0; s < 6; ++s) {
             for (int x = 0; x < N; ++x) {
               vec3 dir = xys_to_direction(x, y, s, N, N);
@@ -204,19 +270,20 @@ namespace framework {
               const float weight = 4.0f / (sqrt(temp) * temp);
 
               sh_array[y] += project_onto_sh9(dir, radiance) * weight;
-              weights += weight;
+              partial += weight;
             }
           }
-        }
+        }, std::plus<float>());
 
         sh9_t<vec3> sh{};
         for (int i = 0;i < N;++i) sh += sh_array[i];
         sh *= 4.0f * float(M_PI) / weights;
         for (int i = 0;i < 9;++i)
-          uniforms.sky_sh9[i] = vec4(sh[i].r, sh[i].g, sh[i].b, 0);
+          b.sky_sh9[i] = vec4(sh[i].r, sh[i].g, sh[i].b, 0);
 
         last_skybox_update_time = SDL_GetTicks() - sky_start;
       }
+      if (b.cancel.cancelled()) return;
       // compute solar radiance ~15ms
       {
         int solar_start = SDL_GetTicks();
@@ -224,44 +291,47 @@ namespace framework {
 
         // initialize sky_states
         ArHosekSkyModelState * sky_states[spectral_samples];
-        //#pragma omp parallel for
-        for (auto i = 0; i < spectral_samples; ++i)
+        parallel_for(0, int(spectral_samples), 1, [&](int i) {
           sky_states[i] = arhosekskymodelstate_alloc_init(theta_sun, turbidity, ground_albedo_spectrum[i]);
+        });
 
 
         // compute solar radiance
+        vec3 & sun_irradiance = b.sun_irradiance = vec3(0.f);
         vec3 sun_dir_x = perpendicular(sun_dir);
         mat3 sun_orientation = mat3(sun_dir_x, cross(sun_dir, sun_dir_x), sun_dir);
         const size_t num_samples = 4;
-        // #pragma omp parallel for collapse(2) reduction(+:sun_irradiance)
+        float sample_u[num_samples * num_samples], sample_v[num_samples * num_samples];
+        float sample_x[num_samples * num_samples], sample_y[num_samples * num_samples], sample_z[num_samples * num_samples];
         for (size_t x = 0;x < num_samples; ++x)
           for (size_t y = 0;y < num_samples; ++y) {
-            vec3 sample_dir = sun_orientation * sample_cone(
-              vec2( (x + 0.5f) / num_samples, (y + 0.5f) / num_samples ),
-              cos_physical_sun_angular_radius
-            );
-            float sample_theta_sun = angle_between(sample_dir, vec3(0, 1, 0));
-            float sample_gamma = angle_between(sample_dir, sun_dir);
-
-            sampled_spectrum solar_radiance;
-
-            for (size_t i = 0; i < spectral_samples; ++i)
-              solar_radiance[i] = float(arhosekskymodel_solar_radiance(
-                sky_states[i],
-                sample_theta_sun,
-                sample_gamma,
-                lerp(float(sampled_lambda_start), float(sampled_lambda_end), i / float(spectral_samples))
-              ));
-
-            sun_irradiance += solar_radiance.to_rgb() * saturate<float, highp>(dot(sample_dir, sun_dir));
+            sample_u[x * num_samples + y] = (x + 0.5f) / num_samples;
+            sample_v[x * num_samples + y] = (y + 0.5f) / num_samples;
           }
+        sample_cone(num_samples * num_samples, sample_u, sample_v, cos_physical_sun_angular_radius, sample_x, sample_y, sample_z);
+        // #pragma omp parallel for reduction(+:sun_irradiance)
+        for (size_t j = 0;j < num_samples * num_samples; ++j) {
+          vec3 sample_dir = sun_orientation * vec3(sample_x[j], sample_y[j], sample_z[j]);
+          float sample_theta_sun = angle_between(sample_dir, vec3(0, 1, 0));
+          float sample_gamma = angle_between(sample_dir, sun_dir);
+
+          sampled_spectrum solar_radiance;
+
+          for (size_t i = 0; i < spectral_samples; ++i)
+            solar_radiance[i] = float(arhosekskymodel_solar_radiance(
+              sky_states[i],
+              sample_theta_sun,
+              sample_gamma,
+              lerp(float(sampled_lambda_start), float(sampled_lambda_end), i / float(spectral_samples))
+            ));
+
+          sun_irradiance += solar_radiance.to_rgb() * saturate<float, highp>(dot(sample_dir, sun_dir));
+        }
 
         sun_irradiance *= (1.0f / num_samples) * (1.0f / num_samples) * (1.0f / sample_cone_pdf(cos_physical_sun_angular_radius));
 
         // standard luminous efficiency 683 lm/W, coordinate system scaling & scaling to fit into the dynamic range of a 16 bit float
         sun_irradiance *= 683.0f * 100.0f * fp16_scale;
-        uniforms.sun_irradiance = sun_irradiance;
-        uniforms.sun_color = sun_irradiance / irradiance_integral(sun_angular_radius);
 
         // free sky states
         for (auto i = 0; i < spectral_samples; ++i) {
@@ -272,12 +342,20 @@ namespace framework {
         last_solar_radiance_update_time = SDL_GetTicks() - solar_start;
       }
     }
+  }
 
+  void sky::apply(const bake & b, app_uniforms & uniforms) {
     gl::debug_group debug("sky::update");
 
+    elevation = b.elevation;
+    sun_irradiance = b.sun_irradiance;
+    for (int i = 0;i < 9;++i)
+      uniforms.sky_sh9[i] = b.sky_sh9[i];
+    uniforms.sun_irradiance = sun_irradiance;
+    uniforms.sun_color = sun_irradiance / irradiance_integral(b.sun_angular_radius);
 
     // load cubemap into opengl
-    glTextureSubImage3D(cubemap, 0, 0, 0, 0, N, N, 6, GL_RGBA, GL_HALF_FLOAT, cubemap_data.data());
+    glTextureSubImage3D(cubemap, 0, 0, 0, 0, N, N, 6, GL_RGBA, GL_HALF_FLOAT, b.cubemap_data.data());
     glGenerateTextureMipmap(cubemap);
 
     // right left top bottom back front - opengl order
@@ -286,7 +364,7 @@ namespace framework {
     const int swizzle[6] = { 2, 3, 4, 5, 1, 0 };
 
     for (int i = 0;i < 6; ++i) {
-      glTextureSubImage2D(cubemap_views[i], 0, 0, 0, N, N, GL_RGBA, GL_UNSIGNED_BYTE, tonemapped_cubemap_data.data() + (N*N*i));
+      glTextureSubImage2D(cubemap_views[i], 0, 0, 0, N, N, GL_RGBA, GL_UNSIGNED_BYTE, b.tonemapped_cubemap_data.data() + (N*N*i));
       glGenerateTextureMipmap(cubemap_views[i]);
       vr_skybox[swizzle[i]].handle = (void*)(intptr_t)cubemap_views[i];
       vr_skybox[swizzle[i]].eColorSpace = vr::ColorSpace_Linear;
@@ -294,7 +372,9 @@ namespace framework {
     }
     vr::VRCompositor()->SetSkyboxOverride(vr_skybox, 6);
 
-    last_update_time = SDL_GetTicks() - start;
+    int elapsed = SDL_GetTicks() - b.start;
+    last_update_time = elapsed;
+    update_times.record(uint64_t(elapsed));
     initialized = true;
   }
 
@@ -302,6 +382,8 @@ namespace framework {
     gl::debug_group debug("sky::~sky()");
     glMakeTextureHandleNonResidentARB(cubemap_handle);
     glDeleteVertexArrays(1, &vao);
+    gl::untrack_texture(cubemap);
+    for (auto view : cubemap_views) gl::untrack_texture(view);
     glDeleteTextures(1, &cubemap);
     glDeleteTextures(6, cubemap_views);
   }
@@ -6,6 +6,7 @@
 #include "uniforms.h"
 #include "timer.h"
 #include "gui_direction.h"
+#include "task_group.h"
 
 namespace framework {
   static const float physical_sun_angular_radius = 0.27_degrees;
@@ -20,6 +21,12 @@ namespace framework {
     void update(app_uniforms & uniforms);
     void render() const;
 
+    struct bake; // a rebuild in progress
+    static void compute(bake & b); // the expensive part, safe to run off of the main thread
+    void apply(const bake & b, app_uniforms & uniforms); // upload. main thread only
+    bool rebuilding = false; // a bake is running in the background
+    cancellation_source rebuild_source; // cancels that bake when the parameters move on before it lands
+
     bool initialized;
     vec3 sun_dir, sun_radiance, sun_irradiance;
     float sun_angular_radius;
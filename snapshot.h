@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "epoch.h"
+#include "noncopyable.h"
+
+// Read-copy-update publication of immutable state.
+//
+//   versioned<app_uniforms> state;
+//   state.publish(uniforms);                              // writer: one copy, one exchange
+//   ...
+//   auto s = state.read();                                // reader, any thread: a fence and a load
+//   cull(s->predicted_pmv, s.version());                  // s stays put until it goes out of scope
+//
+// Every version is immutable once published, so a reader sees all of one version or all of another, never a
+// mix, and never waits on the writer or on other readers. A snapshot holds the calling thread's epoch open, so
+// the version it points at can't be deleted out from under it; the writer retires each version it replaces and
+// epoch reclamation deletes it once every reader that might have it has moved on.
+//
+// Keep snapshots short-lived. One held across a frame holds back reclamation for everything retired since,
+// on every thread.
+namespace framework {
+
+  template <typename T> struct versioned : noncopyable {
+  private:
+    struct node : epoch_entry {
+      template <typename ... Args> explicit node(uint64_t number, Args && ... args) : number(number), value(std::forward<Args>(args)...) {}
+      uint64_t number;
+      T value;
+    };
+
+  public:
+    // a consistent view of one version. pins the current thread's epoch until destroyed
+    struct snapshot {
+      snapshot(snapshot && that) noexcept : r(that.r), p(that.p) { that.r = nullptr; }
+      snapshot & operator = (snapshot &&) = delete;
+      ~snapshot() {
+        if (r) r->end();
+      }
+
+      const T & operator * () const noexcept { return p->value; }
+      const T * operator -> () const noexcept { return &p->value; }
+      const T & get() const noexcept { return p->value; }
+      uint64_t version() const noexcept { return p->number; } // 0 for whatever we were constructed with, then 1, 2, ...
+
+    private:
+      friend struct versioned;
+      snapshot(epoch_record & r, const node * p) noexcept : r(&r), p(p) {}
+      epoch_record * r;
+      const node * p;
+    };
+
+    template <typename ... Args> explicit versioned(Args && ... args) : current(new node(0, std::forward<Args>(args)...)) {}
+
+    // nobody may be reading by now
+    ~versioned() { delete current.load(std::memory_order_relaxed); }
+
+    // wait-free
+    snapshot read(epoch_record & r = epoch_record::local()) const noexcept {
+      r.begin();
+      return snapshot(r, current.load(std::memory_order_acquire));
+    }
+
+    // run f on the current version without holding on to it
+    template <typename F> auto read(F && f) const -> decltype(f(std::declval<const T &>())) {
+      epoch_guard guard;
+      return f(current.load(std::memory_order_acquire)->value);
+    }
+
+    // replace the current version. the old one is reclaimed once no reader can see it
+    template <typename ... Args> uint64_t publish(Args && ... args) {
+      epoch_record & r = epoch_record::local();
+      node * n = new node(0, std::forward<Args>(args)...);
+      node * old;
+      uint64_t number;
+      {
+        epoch_guard guard(r); // so old can't be reclaimed while we read its number, by another publisher
+        old = current.load(std::memory_order_acquire);
+        do n->number = number = old->number + 1;
+        while (!current.compare_exchange_weak(old, n, std::memory_order_acq_rel, std::memory_order_acquire));
+      }
+      r.retire(*old); // and n is no longer ours to look at
+      return number;
+    }
+
+    // publish f applied to a copy of the current version, retrying if someone else publishes first.
+    // f may be called more than once, so it should only touch its argument
+    template <typename F> uint64_t update(F && f) {
+      epoch_record & r = epoch_record::local();
+      for (;;) {
+        node * old;
+        node * n;
+        bool won;
+        {
+          epoch_guard guard(r); // held until the exchange, or old could be reused and the exchange succeed anyway
+          old = current.load(std::memory_order_acquire);
+          n = new node(old->number + 1, old->value);
+          f(n->value);
+          won = current.compare_exchange_strong(old, n, std::memory_order_acq_rel, std::memory_order_relaxed);
+        }
+        if (!won) {
+          delete n;
+          continue;
+        }
+        uint64_t number = old->number + 1;
+        r.retire(*old);
+        return number;
+      }
+    }
+
+    uint64_t version() const noexcept {
+      epoch_guard guard;
+      return current.load(std::memory_order_acquire)->number;
+    }
+
+  private:
+    std::atomic<node *> current;
+  };
+}
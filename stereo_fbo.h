@@ -18,6 +18,7 @@ namespace framework {
 
     void setup(T & fbo, const string & name, GLenum internalformat) const {
       glTextureStorage3D(fbo.texture, 1, internalformat, w, h, T::layer_count);
+      gl::track_texture(fbo.texture, gl::texture_bytes(internalformat, w, h, T::layer_count), fbo.tag);
       glTextureParameteri(fbo.texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
       glTextureParameteri(fbo.texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
       glTextureParameteri(fbo.texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -47,6 +48,7 @@ namespace framework {
 
     void setup(T & fbo, const string & name, GLenum internalformat) const {
       glTextureStorage3DMultisample(fbo.texture, msaa, internalformat, w, h, T::layer_count, fixed_sample_locations);
+      gl::track_texture(fbo.texture, gl::texture_bytes(internalformat, w, h, T::layer_count, 1, msaa), fbo.tag);
     }
 
     void set_view_parameters(GLuint view) {}
@@ -67,10 +69,10 @@ namespace framework {
 
     layered_fbo(storage_type & format) : format(format), initialized(false) {}
      
-    layered_fbo(storage_type & format, const string & name, GLenum internalformat = GL_RGBA16F) 
+    layered_fbo(storage_type & format, const string & name, GLenum internalformat = GL_RGBA16F, memory_tag tag = memory_tag::render_targets) 
       : format(format)
       , initialized(false) {
-      initialize(name, internalformat);
+      initialize(name, internalformat, tag);
     }
     virtual ~layered_fbo() {
       finalize();
@@ -80,8 +82,9 @@ namespace framework {
       glBindFramebuffer(target, fbo);
     }
 
-    void initialize(const string & name, GLenum internalformat = GL_RGBA16F) {
+    void initialize(const string & name, GLenum internalformat = GL_RGBA16F, memory_tag tag = memory_tag::render_targets) {
       finalize();
+      this->tag = tag;
 
 
       gl::debug_group debug("stereo_fbo {} initialization", name);
@@ -118,6 +121,7 @@ namespace framework {
         glMakeTextureHandleNonResidentARB(texture_handle);
         glDeleteFramebuffers(1, &fbo);
         glDeleteFramebuffers(N, fbo_view);
+        gl::untrack_texture(texture);
         glDeleteTextures(1, &texture);
         glDeleteTextures(N, texture_view);
         initialized = false;
@@ -130,6 +134,7 @@ namespace framework {
     GLuint fbo, fbo_view[N];
     GLuint texture, texture_view[N];
     GLuint64 texture_handle, texture_view_handle[N];
+    memory_tag tag = memory_tag::render_targets;
   };
 
   typedef layered_fbo<2> stereo_fbo;
@@ -145,8 +150,10 @@ namespace framework {
     void setup(T & fbo, const string & name, GLenum internalformat) const {
       const GLsizei d = T::layer_count;
       glTextureStorage3DMultisample(fbo.texture, msaa, internalformat, w, h, d, fixed_sample_locations);
+      gl::track_texture(fbo.texture, gl::texture_bytes(internalformat, w, h, d, 1, msaa), fbo.tag);
       glCreateTextures(GL_TEXTURE_2D_MULTISAMPLE_ARRAY, 1, &fbo.depth_stencil_texture);
       glTextureStorage3DMultisample(fbo.depth_stencil_texture, msaa, depth_stencil_internalformat, w, h, d, fixed_sample_locations);
+      gl::track_texture(fbo.depth_stencil_texture, gl::texture_bytes(depth_stencil_internalformat, w, h, d, 1, msaa), fbo.tag);
       glNamedFramebufferTexture(fbo.fbo, GL_DEPTH_STENCIL_ATTACHMENT, fbo.depth_stencil_texture, 0);
       fbo.depth_stencil_texture_handle = glGetTextureHandleARB(fbo.depth_stencil_texture);
       glMakeTextureHandleResidentARB(fbo.depth_stencil_texture_handle);
@@ -156,6 +163,7 @@ namespace framework {
 
     void teardown(T & fbo) const {
       glMakeTextureHandleNonResidentARB(fbo.depth_stencil_texture_handle);
+      gl::untrack_texture(fbo.depth_stencil_texture);
       glDeleteTextures(1, &fbo.depth_stencil_texture);
     }
   };
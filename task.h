@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "noncopyable.h"
+#include "pool_allocator.h"
+
+// A move-only replacement for std::function<void(worker&)> that never allocates for small closures.
+//
+// Closures up to task::inline_size bytes live inside the task itself. Larger ones are placed in a
+// block drawn from the small object pool in pool_allocator.h, as are tasks that have to be boxed to
+// move between workers through a chase_lev_deque or mailbox. A block freed on another thread is
+// batched up and sent back to the thread that allocated it, so stolen work doesn't drag memory along.
+namespace framework {
+
+  struct worker;
+
+  namespace detail {
+    template <size_t block_size> struct slab {
+      static void * allocate() {
+        return pool_allocate(block_size);
+      }
+
+      static void deallocate(void * p) noexcept {
+        pool_deallocate(p, block_size);
+      }
+    };
+  }
+
+  struct task {
+    static const size_t inline_size = 48; // keeps sizeof(task) at one 64 byte cache line
+    static const size_t slab_size = 256;  // closures larger than this go to the general heap
+
+    task() noexcept : vtable(nullptr) {}
+    task(std::nullptr_t) noexcept : vtable(nullptr) {}
+
+    template <typename F, typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, task>::value>::type>
+    task(F && f) : vtable(nullptr) {
+      typedef typename std::decay<F>::type fun;
+      emplace<fun>(std::forward<F>(f), std::integral_constant<bool, fits_inline<fun>::value>());
+    }
+
+    task(task && that) noexcept : enqueued(that.enqueued), vtable(that.vtable) {
+      if (vtable) {
+        vtable->move(that.storage, storage);
+        that.vtable = nullptr;
+      }
+    }
+
+    task & operator = (task && that) noexcept {
+      if (this != &that) {
+        reset();
+        enqueued = that.enqueued;
+        if (that.vtable) {
+          that.vtable->move(that.storage, storage);
+          vtable = that.vtable;
+          that.vtable = nullptr;
+        }
+      }
+      return *this;
+    }
+
+    task & operator = (std::nullptr_t) noexcept {
+      reset();
+      return *this;
+    }
+
+    task(const task &) = delete;
+    task & operator = (const task &) = delete;
+
+    ~task() { reset(); }
+
+    void operator()(worker & w) {
+      vtable->invoke(storage, w);
+    }
+
+    explicit operator bool() const noexcept { return vtable != nullptr; }
+
+    void reset() noexcept {
+      if (vtable) {
+        vtable->destroy(storage);
+        vtable = nullptr;
+      }
+    }
+
+    int64_t enqueued = 0; // steady_clock ticks when this was last queued, 0 if never. fits in what would otherwise be padding
+
+    // tasks handed between workers travel by pointer. box and unbox use the slab rather than new/delete.
+    static task * box(task && t) {
+      return new (detail::slab<sizeof(task)>::allocate()) task(std::move(t));
+    }
+
+    static task unbox(task * tp) noexcept {
+      task result(std::move(*tp));
+      tp->~task();
+      detail::slab<sizeof(task)>::deallocate(tp);
+      return result;
+    }
+
+  private:
+    struct vtable_type {
+      void (*invoke)(void * self, worker & w);
+      void (*move)(void * from, void * to) noexcept;
+      void (*destroy)(void * self) noexcept;
+    };
+
+    template <typename F> struct fits_inline : std::integral_constant<bool,
+      sizeof(F) <= inline_size &&
+      alignof(F) <= alignof(std::max_align_t) &&
+      std::is_nothrow_move_constructible<F>::value> {};
+
+    // closure stored directly in storage
+    template <typename F> struct inline_ops {
+      static void invoke(void * self, worker & w) { (*static_cast<F*>(self))(w); }
+      static void move(void * from, void * to) noexcept {
+        F * f = static_cast<F*>(from);
+        new (to) F(std::move(*f));
+        f->~F();
+      }
+      static void destroy(void * self) noexcept { static_cast<F*>(self)->~F(); }
+      static const vtable_type vtable;
+    };
+
+    // storage holds a pointer to a closure in a slab block, or on the heap if it won't fit in one
+    template <typename F> struct boxed_ops {
+      static const bool slabbed = sizeof(F) <= slab_size && alignof(F) <= alignof(std::max_align_t);
+      static F *& get(void * self) noexcept { return *static_cast<F**>(self); }
+      static void invoke(void * self, worker & w) { (*get(self))(w); }
+      static void move(void * from, void * to) noexcept {
+        new (to) F*(get(from));
+      }
+      static void destroy(void * self) noexcept {
+        F * f = get(self);
+        if (slabbed) {
+          f->~F();
+          detail::slab<slab_size>::deallocate(f);
+        } else {
+          delete f;
+        }
+      }
+      template <typename G> static F * make(G && g) {
+        if (!slabbed) return new F(std::forward<G>(g));
+        void * p = detail::slab<slab_size>::allocate();
+        try {
+          return new (p) F(std::forward<G>(g));
+        } catch (...) {
+          detail::slab<slab_size>::deallocate(p);
+          throw;
+        }
+      }
+      static const vtable_type vtable;
+    };
+
+    template <typename F, typename G> void emplace(G && g, std::true_type) {
+      new (storage) F(std::forward<G>(g));
+      vtable = &inline_ops<F>::vtable;
+    }
+
+    template <typename F, typename G> void emplace(G && g, std::false_type) {
+      new (storage) F*(boxed_ops<F>::make(std::forward<G>(g)));
+      vtable = &boxed_ops<F>::vtable;
+    }
+
+    const vtable_type * vtable;
+    alignas(std::max_align_t) unsigned char storage[inline_size];
+  };
+
+  template <typename F> const task::vtable_type task::inline_ops<F>::vtable = {
+    &task::inline_ops<F>::invoke, &task::inline_ops<F>::move, &task::inline_ops<F>::destroy
+  };
+
+  template <typename F> const task::vtable_type task::boxed_ops<F>::vtable = {
+    &task::boxed_ops<F>::invoke, &task::boxed_ops<F>::move, &task::boxed_ops<F>::destroy
+  };
+
+  inline bool operator == (const task & t, std::nullptr_t) noexcept { return !t; }
+  inline bool operator != (const task & t, std::nullptr_t) noexcept { return bool(t); }
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "noncopyable.h"
+#include "parallel.h"
+#include "worker.h"
+
+// Structured fork-join with cancellation.
+//
+//   cancellation_source stale;
+//   task_group g(p, stale.token());
+//   for (auto & shard : shards) g.run([&] { load(shard, g.token()); });
+//   ...
+//   stale.cancel();  // from anywhere: jobs that haven't started yet never will
+//   g.wait();        // help out until every job is done, then rethrow the first exception, if any
+//
+// Cancellation is cooperative. A job that hasn't started when its group is cancelled is dropped at the task
+// boundary, for the cost of a load. One already running carries on unless it checks its token, and may bail out
+// by throwing operation_cancelled, which the group treats as a quiet exit rather than a failure. The first job to
+// fail with anything else cancels the rest of its group, and its exception comes out of wait().
+//
+// Nothing here blocks a worker thread, and nothing a job throws escapes into the pool.
+namespace framework {
+
+  // thrown by cancellation_token::throw_if_cancelled
+  struct operation_cancelled : std::exception {
+    const char * what() const noexcept override { return "operation cancelled"; }
+  };
+
+  namespace detail {
+    struct cancellation_state : noncopyable {
+      explicit cancellation_state(std::shared_ptr<cancellation_state> parent) : parent(std::move(parent)) {}
+      std::atomic<bool> cancelled{ false };
+      std::shared_ptr<cancellation_state> parent; // cancelling it cancels us
+
+      bool requested() const noexcept {
+        for (const cancellation_state * s = this; s != nullptr; s = s->parent.get())
+          if (s->cancelled.load(std::memory_order_acquire)) return true;
+        return false;
+      }
+    };
+  }
+
+  // cheap to copy, and checked by whoever is doing the work. a default constructed token is never cancelled
+  struct cancellation_token {
+    cancellation_token() noexcept {}
+    bool cancelled() const noexcept { return state && state->requested(); }
+    void throw_if_cancelled() const {
+      if (cancelled()) throw operation_cancelled();
+    }
+  private:
+    friend struct cancellation_source;
+    explicit cancellation_token(std::shared_ptr<detail::cancellation_state> state) noexcept : state(std::move(state)) {}
+    std::shared_ptr<detail::cancellation_state> state;
+  };
+
+  // hands out tokens, and cancels them all at once. a source made from a token is also cancelled along with it
+  struct cancellation_source {
+    explicit cancellation_source(const cancellation_token & parent = cancellation_token())
+      : state(std::make_shared<detail::cancellation_state>(parent.state)) {}
+    cancellation_token token() const noexcept { return cancellation_token(state); }
+    void cancel() noexcept { state->cancelled.store(true, std::memory_order_release); }
+    bool cancelled() const noexcept { return state->requested(); }
+  private:
+    std::shared_ptr<detail::cancellation_state> state;
+  };
+
+  struct task_group : noncopyable {
+    explicit task_group(pool & p, const cancellation_token & parent = cancellation_token()) : p(&p), source(parent) {}
+    // on the process-wide scheduler. without one, jobs run as soon as they are handed to us
+    explicit task_group(const cancellation_token & parent = cancellation_token()) : p(scheduler::current()), source(parent) {}
+
+    // waits, but any exception not already collected by wait() is dropped, as destructors can't throw
+    ~task_group() { drain(); }
+
+    // f() runs as a job in the given lane, or that of whoever calls this, unless the group is cancelled first
+    template <typename F> void run(F && f) {
+      worker * w = worker::current();
+      run(w != nullptr && &w->p == p ? w->lane : priority::critical, std::forward<F>(f));
+    }
+
+    template <typename F> void run(priority lane, F && f) {
+      pending.fetch_add(1, std::memory_order_relaxed);
+      if (p == nullptr) {
+        execute(f);
+        return;
+      }
+      p->run(lane, task([this, f = std::forward<F>(f)](worker &) mutable { execute(f); }));
+    }
+
+    // help out until every job has finished, then rethrow the first exception any of them threw. the group can be
+    // reused afterwards, though once cancelled it stays that way
+    void wait() {
+      drain();
+      std::exception_ptr e = errors.error;
+      errors.reset();
+      if (e) std::rethrow_exception(e);
+    }
+
+    void cancel() noexcept { source.cancel(); }
+    bool cancelled() const noexcept { return source.cancelled(); }
+    cancellation_token token() const noexcept { return source.token(); } // for jobs to check as they go
+
+  private:
+    template <typename F> void execute(F & f) noexcept {
+      if (!source.cancelled()) {
+        try {
+          f();
+        } catch (operation_cancelled &) {
+          // they noticed, and gave up
+        } catch (...) {
+          errors.capture();
+          source.cancel(); // no point finishing the rest
+        }
+      }
+      pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    void drain() {
+      if (p == nullptr || pending.load(std::memory_order_acquire) == 0) return;
+      detail::with_worker(*p, [this](worker & w) {
+        while (pending.load(std::memory_order_acquire) != 0)
+          if (!w.try_run_one()) std::this_thread::yield();
+      });
+    }
+
+    pool * p;
+    cancellation_source source;
+    std::atomic<size_t> pending{ 0 };
+    detail::first_exception errors;
+  };
+}
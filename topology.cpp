@@ -0,0 +1,242 @@
+#include "stdafx.h"
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include "cds.h"
+#include "topology.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace std;
+
+namespace framework {
+
+  namespace {
+    // -1 means we don't know, and never matches anything
+    inline bool same(int a, int b) noexcept { return a >= 0 && a == b; }
+
+    // processors we couldn't place on a core are treated as cores of their own
+    inline int core_of(const processor & p) noexcept { return p.core >= 0 ? p.core : ~p.id; }
+
+    processor unknown(int id) {
+      return processor{ id, -1, -1, -1, -1, -1 };
+    }
+
+#if defined(_WIN32)
+    template <typename F> void each_processor(const GROUP_AFFINITY & affinity, F f) {
+      for (int bit = 0; bit < int(sizeof(KAFFINITY) * 8); ++bit)
+        if (affinity.Mask & (KAFFINITY(1) << bit)) f(affinity.Group * 64 + bit);
+    }
+
+    bool read_processors(vector<processor> & result) {
+      DWORD length = 0;
+      GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+      if (GetLastError() != ERROR_INSUFFICIENT_BUFFER) return false;
+      vector<char> buffer(length);
+      if (!GetLogicalProcessorInformationEx(RelationAll, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data()), &length))
+        return false;
+
+      map<int, processor> found;
+      auto get = [&](int id) -> processor & {
+        auto i = found.find(id);
+        if (i == found.end()) i = found.emplace(id, unknown(id)).first;
+        return i->second;
+      };
+
+      int cores = 0, packages = 0, caches = 0;
+      for (DWORD offset = 0; offset < length;) {
+        auto info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data() + offset);
+        switch (info->Relationship) {
+          case RelationProcessorCore:
+            for (WORD g = 0; g < info->Processor.GroupCount; ++g)
+              each_processor(info->Processor.GroupMask[g], [&](int id) { get(id).core = cores; });
+            ++cores;
+            break;
+          case RelationProcessorPackage:
+            for (WORD g = 0; g < info->Processor.GroupCount; ++g)
+              each_processor(info->Processor.GroupMask[g], [&](int id) { get(id).package = packages; });
+            ++packages;
+            break;
+          case RelationCache:
+            if (info->Cache.Level == 2)
+              each_processor(info->Cache.GroupMask, [&](int id) { get(id).l2 = caches; });
+            else if (info->Cache.Level == 3)
+              each_processor(info->Cache.GroupMask, [&](int id) { get(id).l3 = caches; });
+            ++caches;
+            break;
+          case RelationNumaNode:
+            each_processor(info->NumaNode.GroupMask, [&](int id) { get(id).node = int(info->NumaNode.NodeNumber); });
+            break;
+          default:
+            break;
+        }
+        offset += info->Size;
+      }
+      for (auto && p : found)
+        if (p.second.core >= 0) result.push_back(p.second); // only count things that are actually processors
+      return !result.empty();
+    }
+#elif defined(__linux__)
+    // parse the "0-3,8,10-11" lists /sys uses
+    vector<int> read_list(const string & filename) {
+      vector<int> result;
+      ifstream in(filename);
+      string text, range;
+      if (!getline(in, text)) return result;
+      istringstream ranges(text);
+      while (getline(ranges, range, ',')) {
+        if (range.empty()) continue;
+        size_t dash = range.find('-');
+        int lo = atoi(range.c_str());
+        int hi = dash == string::npos ? lo : atoi(range.c_str() + dash + 1);
+        for (int i = lo; i <= hi; ++i) result.push_back(i);
+      }
+      return result;
+    }
+
+    bool read_int(const string & filename, int & result) {
+      ifstream in(filename);
+      return bool(in >> result);
+    }
+
+    bool read_processors(vector<processor> & result) {
+      static const string root = "/sys/devices/system/";
+      map<int, processor> found;
+      for (int id : read_list(root + "cpu/online")) {
+        processor p = unknown(id);
+        string cpu = root + "cpu/cpu" + to_string(id);
+        read_int(cpu + "/topology/physical_package_id", p.package);
+        vector<int> siblings = read_list(cpu + "/topology/thread_siblings_list");
+        if (!siblings.empty()) p.core = *min_element(siblings.begin(), siblings.end());
+        for (int index = 0;; ++index) {
+          string cache = cpu + "/cache/index" + to_string(index);
+          int level;
+          if (!read_int(cache + "/level", level)) break;
+          if (level != 2 && level != 3) continue;
+          vector<int> sharing = read_list(cache + "/shared_cpu_list");
+          if (sharing.empty()) continue;
+          (level == 2 ? p.l2 : p.l3) = *min_element(sharing.begin(), sharing.end());
+        }
+        found.emplace(id, p);
+      }
+      for (int node : read_list(root + "node/online"))
+        for (int id : read_list(root + "node/node" + to_string(node) + "/cpulist")) {
+          auto i = found.find(id);
+          if (i != found.end()) i->second.node = node;
+        }
+      for (auto && p : found) result.push_back(p.second);
+      return !result.empty();
+    }
+#else
+    bool read_processors(vector<processor> &) { return false; }
+#endif
+
+    template <typename F> int distinct(const vector<processor> & processors, F f) {
+      set<int> seen;
+      for (auto && p : processors)
+        if (f(p) >= 0) seen.insert(f(p));
+      return std::max<int>(1, int(seen.size()));
+    }
+
+    topology detect() {
+      topology t;
+      if (!read_processors(t.processors)) {
+        t.processors.clear();
+#ifdef FRAMEWORK_SUPPORTS_CDS
+        int n = int(cds::OS::topology::processor_count());
+#else
+        int n = int(thread::hardware_concurrency());
+#endif
+        for (int i = 0; i < std::max(n, 1); ++i)
+          t.processors.push_back(processor{ i, i, i, -1, -1, -1 });
+        log("topology")->warn("unable to read processor topology, assuming {} independent cores", t.processors.size());
+      }
+      sort(t.processors.begin(), t.processors.end(), [](const processor & a, const processor & b) { return a.id < b.id; });
+      t.cores = distinct(t.processors, core_of);
+      t.packages = distinct(t.processors, [](const processor & p) { return p.package; });
+      t.nodes = distinct(t.processors, [](const processor & p) { return p.node; });
+      log("topology")->info("{} logical processors, {} cores, {} packages, {} numa nodes", t.processors.size(), t.cores, t.packages, t.nodes);
+      return t;
+    }
+  }
+
+  const topology & topology::system() {
+    static const topology t = detect();
+    return t;
+  }
+
+  const processor * topology::find(int id) const {
+    auto i = lower_bound(processors.begin(), processors.end(), id, [](const processor & p, int id) { return p.id < id; });
+    return i != processors.end() && i->id == id ? &*i : nullptr;
+  }
+
+  proximity topology::distance(int a, int b) const {
+    const processor * p = find(a), *q = find(b);
+    if (a == b) return proximity::core;
+    if (p == nullptr || q == nullptr) return proximity::machine;
+    if (same(p->core, q->core)) return proximity::core;
+    if (same(p->l2, q->l2)) return proximity::l2;
+    if (same(p->l3, q->l3)) return proximity::l3;
+    if (same(p->node, q->node)) return proximity::node;
+    if (same(p->package, q->package)) return proximity::package;
+    return proximity::machine;
+  }
+
+  vector<int> topology::placement(int reserved) const {
+    vector<const processor *> order;
+    for (auto && p : processors) order.push_back(&p);
+    // keep everything that shares a cache together
+    sort(order.begin(), order.end(), [](const processor * a, const processor * b) {
+      return make_tuple(a->package, a->node, a->l3, a->l2, core_of(*a), a->id)
+           < make_tuple(b->package, b->node, b->l3, b->l2, core_of(*b), b->id);
+    });
+
+    // rank each logical processor amongst the hyperthreads of its core, and skip the first reserved cores
+    map<int, int> rank_in_core;
+    set<int> skipped;
+    vector<pair<int, const processor *>> ranked;
+    for (auto p : order) {
+      int core = core_of(*p);
+      if (!rank_in_core.count(core) && int(skipped.size()) < reserved) skipped.insert(core);
+      ranked.emplace_back(rank_in_core[core]++, p);
+    }
+    // first hyperthreads first
+    stable_sort(ranked.begin(), ranked.end(), [](const pair<int, const processor *> & a, const pair<int, const processor *> & b) {
+      return a.first < b.first;
+    });
+
+    vector<int> result;
+    for (auto && r : ranked)
+      if (!skipped.count(core_of(*r.second))) result.push_back(r.second->id);
+    if (result.empty() && reserved > 0) return placement(0); // a reservation we can't honor
+    return result;
+  }
+
+  bool pin_current_thread(int processor) {
+    if (processor < 0) return false;
+#if defined(_WIN32)
+    GROUP_AFFINITY affinity{};
+    affinity.Group = WORD(processor / 64);
+    affinity.Mask = KAFFINITY(1) << (processor % 64);
+    return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != 0;
+#elif defined(__linux__)
+    if (processor >= CPU_SETSIZE) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(processor, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+  }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <vector>
+
+// Where each logical processor sits in the machine: which ones share a physical core, a cache, a NUMA node
+// or a package. Read once from GetLogicalProcessorInformationEx on Windows or /sys on Linux. Anything else,
+// or a failure to read either, looks like a flat machine with one logical processor per core.
+namespace framework {
+
+  struct processor {
+    int id;      // logical processor number, as the OS counts them
+    int core;    // physical core, shared by hyperthreads
+    int l2;      // level 2 cache domain
+    int l3;      // last level cache domain
+    int node;    // NUMA node
+    int package; // socket
+  };
+
+  // how far apart two logical processors are, nearest first
+  enum class proximity : int {
+    core = 0,    // hyperthreads of the same core
+    l2 = 1,      // share a level 2 cache
+    l3 = 2,      // share a last level cache
+    node = 3,    // share a NUMA node
+    package = 4, // share a socket
+    machine = 5  // anywhere else
+  };
+
+  struct topology {
+    std::vector<processor> processors; // sorted by id
+    int cores, packages, nodes;
+
+    static const topology & system(); // the machine we're running on
+
+    proximity distance(int a, int b) const; // between two logical processor ids
+
+    // logical processors to place workers on, in order: one per physical core, keeping cores that share
+    // caches adjacent, followed by their hyperthreads. the first `reserved` physical cores are left out entirely.
+    std::vector<int> placement(int reserved = 0) const;
+
+  private:
+    const processor * find(int id) const;
+  };
+
+  bool pin_current_thread(int processor); // returns false if we couldn't
+}
@@ -29,9 +29,11 @@ namespace framework {
     }
     ~vertex_array() {
       if (ibo) {
+        gl::untrack_buffer(ibo);
         glDeleteBuffers(1, &ibo);
         ibo = 0;
       }
+      gl::untrack_buffer(vbo);
       glDeleteBuffers(1, &vbo);
       glDeleteVertexArrays(1, &vao);
     }
@@ -47,6 +49,7 @@ namespace framework {
 
     void load(const T * v, size_t count, GLenum usage = GL_STREAM_DRAW) const {
       glNamedBufferData(vbo, sizeof(T) * count, v, usage);
+      gl::track_buffer(vbo, sizeof(T) * count, tag);
     }
 
     void load(const std::vector<T> & v, GLenum usage = GL_STREAM_DRAW) const {
@@ -56,6 +59,7 @@ namespace framework {
     void load_elements(const index_type * indices, size_t count, GLenum usage = GL_STREAM_DRAW) const {
       if (!ibo) die("no element array buffer");
       glNamedBufferData(ibo, sizeof(index_type) * count, indices, usage);
+      gl::track_buffer(ibo, sizeof(index_type) * count, tag);
       glVertexArrayElementBuffer(vao, ibo);
     }
 
@@ -67,6 +71,7 @@ namespace framework {
     GLuint vbo;
     GLuint ibo;
     string name;
+    memory_tag tag = memory_tag::geometry; // what our buffers are charged to. set before loading
   };
 
   template<class R, class T> ptrdiff_t get_offset(R T::* mem) {
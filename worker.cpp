@@ -1,9 +1,16 @@
 #include "stdafx.h"
 #include "error.h"
 #include "cds.h"
+#include "epoch.h"
+#include "pool_allocator.h"
 #include "grammar.h"
 #include "worker.h"
+#include <algorithm>
 #include <chrono>
+#include <ostream>
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <xmmintrin.h>
+#endif
 
 using namespace std;
 using namespace std::chrono;
@@ -11,86 +18,631 @@ using namespace framework;
 
 namespace framework {
 
+  static thread_local worker * current_worker = nullptr;
+
+  static inline void cpu_relax() noexcept {
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    _mm_pause();
+#else
+    this_thread::yield();
+#endif
+  }
+
+  // add the time since then to a counter, returns now
+  static inline steady_clock::time_point account(atomic<uint64_t> & ns, steady_clock::time_point then) noexcept {
+    auto now = steady_clock::now();
+    ns.fetch_add(uint64_t(duration_cast<nanoseconds>(now - then).count()), memory_order_relaxed);
+    return now;
+  }
+
+  // only ever bumped by the worker that owns it, so no need for a locked add
+  static inline void bump(atomic<uint64_t> & counter) noexcept {
+    counter.store(counter.load(memory_order_relaxed) + 1, memory_order_relaxed);
+  }
+
+  // when a task was queued, as nanoseconds on the steady clock. never 0, which means unstamped
+  static inline int64_t stamp() noexcept {
+    return std::max<int64_t>(1, duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+  }
+
+  static inline int64_t ticks(steady_clock::time_point t) noexcept {
+    return t.time_since_epoch().count();
+  }
+
+  // a task in a mailbox carries its lane in the low bit of the pointer, which boxes drawn from the slab never use
+  static inline task * tag(task * tp, priority lane) noexcept {
+    return reinterpret_cast<task*>(reinterpret_cast<uintptr_t>(tp) | uintptr_t(lane));
+  }
+
+  static inline priority lane_of(task * tp) noexcept {
+    return priority(reinterpret_cast<uintptr_t>(tp) & 1);
+  }
+
+  static inline task * untag(task * tp) noexcept {
+    return reinterpret_cast<task*>(reinterpret_cast<uintptr_t>(tp) & ~uintptr_t(1));
+  }
+
+  worker * worker::current() noexcept {
+    return current_worker;
+  }
+
+  worker::worker(pool & p)
+    : rng(uint32_t(hash<thread::id>()(this_thread::get_id())))
+    , p(p)
+    , i(-1) {
+    initialize();
+  }
+
+  worker::enlisted::enlisted(worker & w) noexcept : previous(current_worker) {
+    current_worker = &w;
+  }
+
+  worker::enlisted::~enlisted() {
+    current_worker = previous;
+  }
+
+  void worker::initialize() {
+    string name = guest() ? string("guest worker") : fmt::format("worker {}", i);
+    diary = log(name.c_str());
+    next_deal = high_resolution_clock::now();
+    if (guest()) return;
+
+    for (int j = 0; j < p.N; ++j)
+      if (j != i) peers.push_back(j);
+    if (p.placement.empty()) {
+      tiers.push_back(peers.size()); // we float, so everyone is equally far away
+      return;
+    }
+    const topology & machine = topology::system();
+    auto where = [this](int j) { return p.placement[size_t(j) % p.placement.size()]; };
+    auto distance = [&](int j) { return machine.distance(where(i), where(j)); };
+    pinned = where(i);
+    stable_sort(peers.begin(), peers.end(), [&](int a, int b) { return distance(a) < distance(b); });
+    for (size_t k = 0; k < peers.size(); ++k)
+      if (k + 1 == peers.size() || distance(peers[k]) != distance(peers[k + 1])) tiers.push_back(k + 1);
+  }
+
+  worker::~worker() {
+    task * tp;
+    for (auto && l : d)
+      while (l.pop(tp)) task::unbox(tp); // anything left over when the pool shut down
+  }
+
+  void worker::spawn(task t) {
+    spawn(lane, std::move(t));
+  }
+
+  void worker::spawn(priority lane, task t, steady_clock::time_point deadline) {
+    if (guest()) {
+      p.inject(std::move(t), lane, deadline); // nobody can take work from a guest, so share it
+      return;
+    }
+    t.enqueued = stamp();
+    if (p.mode == scheduling::stealing) {
+      d[int(lane)].push(task::box(std::move(t)));
+      note_queue_depth();
+      p.notify_one(); // anyone could steal it
+    } else {
+      q[int(lane)].push_back(std::move(t));
+      note_queue_depth();
+    }
+  }
+
+  bool worker::has_local_work() const noexcept {
+    if (guest()) return p.submitted_count[int(lane)].load(memory_order_relaxed) != 0;
+    return p.mode == scheduling::stealing ? !d[int(lane)].empty() : !q[int(lane)].empty();
+  }
+
+  bool worker::critical_work_waiting() const noexcept {
+    if (p.submitted_count[int(priority::critical)].load(memory_order_relaxed) != 0) return true;
+    if (guest()) return false;
+    if (!mail[int(priority::critical)].empty()) return true;
+    if (p.mode == scheduling::stealing) return !d[int(priority::critical)].empty();
+    if (!q[int(priority::critical)].empty()) return true;
+    task * tp = p.s[i].data.load(memory_order_relaxed);
+    return tp != nullptr && tp != &detail::dummy_task::instance && lane_of(tp) == priority::critical;
+  }
+
+  void worker::run_critical() {
+    bump(yields);
+    task t;
+    priority found;
+    while (try_acquire(t, found, true)) run(t, found);
+    withdraw(); // we're busy, don't let anyone deal to us
+  }
+
+  size_t worker::local_work() const noexcept {
+    size_t n = 0;
+    for (int l = 0; l < lanes; ++l) n += p.mode == scheduling::stealing ? d[l].size() : q[l].size();
+    return n;
+  }
+
+  size_t worker::backlog() const noexcept {
+    size_t n = queue_depth.load(memory_order_relaxed);
+    for (auto && m : mail) n += m.size();
+    return n;
+  }
+
+  void worker::note_queue_depth() noexcept {
+    uint64_t n = local_work();
+    queue_depth.store(n, memory_order_relaxed);
+    if (n > max_queue_depth.load(memory_order_relaxed)) max_queue_depth.store(n, memory_order_relaxed);
+  }
+
+  int worker::random_peer() {
+    if (guest()) return uniform_int_distribution<int>(0, p.N - 1)(rng);
+    // usually someone who shares a cache with us, now and then someone further out
+    size_t tier = 0;
+    while (tier + 1 < tiers.size() && bernoulli_distribution(steal_widening)(rng)) ++tier;
+    return peers[uniform_int_distribution<size_t>(0, tiers[tier] - 1)(rng)];
+  }
+
   void worker::main() {
 #ifdef FRAMEWORK_SUPPORTS_CDS
     cds_thread_attachment attach_thread;
 #endif
-
-    uniform_int_distribution<int> random_peer(0, p.N - 2);
-    exponential_distribution<double> random_delay_us(100.0); // 0.1ms expected task size
-    string name = fmt::format("worker {}", i);
-    shared_ptr<logger> diary = log(name.c_str());
-    auto d = high_resolution_clock::now();
-    diary->info("starting: {} {} in queue", q.size(), plural(q.size(), "item", "items"));
+    current_worker = this;
+    epoch_record & epoch = epoch_record::local(); // register now, rather than on our first steal
+    if (pinned >= 0) {
+      if (pin_current_thread(pinned)) diary->info("pinned to processor {}", pinned);
+      else diary->warn("unable to pin to processor {}", pinned);
+    }
+    diary->info("starting: {} {} in queue", local_work(), plural(local_work(), "item", "items"));
+    auto then = steady_clock::now();
+    int idle = 0; // consecutive failures to find work
     for (;;) {
-      task t;
       if (p.shutdown.load(std::memory_order_relaxed)) {
         diary->info("pool shutdown");
-        return; // check for pool shutdown
+        break; // check for pool shutdown
       }
-      if (q.empty()) {
-        diary->info("looking for work");
-        // acquire
-        p.s[i].data.store(nullptr, memory_order_relaxed);
-        // TODO: introduce exponential backoff
-        task * tp = p.s[i].data.load(memory_order_relaxed);
-        while (t == nullptr) {
-          //diary->info("unemployed");
-          this_thread::yield();
-          if (p.shutdown.load(std::memory_order_relaxed)) return; // check for pool shutdown
-          tp = p.s[i].data.load(memory_order_relaxed);
-        }
-        diary->info("employed");
-        t = *tp;
-        delete tp;
+      if (try_run_one()) {
+        idle = 0;
+        then = account(working_ns, then);
+        continue;
+      }
+      if (idle == 0 && epoch.pending_count.load(memory_order_relaxed) != 0)
+        epoch.poll(); // we have nothing better to do, so collect whatever we've retired
+      if (idle == 0) detail::pool_flush(); // and send home any blocks we freed for other threads
+      if (idle < spin_rounds) {
+        for (int k = 1 << idle; k > 0; --k) cpu_relax();
+      } else if (idle < spin_rounds + yield_rounds) {
+        this_thread::yield();
       } else {
-        diary->info("have work");
-        t = q.back();
-        q.pop_back();
+        account(spinning_ns, then);
+        park();
+        then = steady_clock::now();
+        idle = 0;
+        continue;
       }
-      if (p.N > 1) { // we have peers, so see if we should hand off work
-        auto then = high_resolution_clock::now();
-        // communicate if we should deal and we have something to deal out
-        if (then > d && !q.empty()) {
-          // deal_attempt
-          int j = random_peer(rng);
-          if (j >= i) j = j + 1; // make sure it isn't us. can't wrap: j < N-1 before.
-
-          task * expected = nullptr;
-          // weak should be fine, we're already in an outer loop, we'll come back
-          // on excessively weak architectures, this might mean that the effective delay is much higher though
-          if (p.s[j].data.load(memory_order_relaxed) == nullptr
-            && p.s[j].data.compare_exchange_weak(expected, &q.front(), memory_order_seq_cst)) {
-            q.pop_front(); // we gave the front of the deque away
-            diary->info("sent work to {}", j);
-          }
-
-          // don't resample time and round down to err on the side of too much sharing.
-          d = then - chrono::floor<high_resolution_clock::duration>(
-            duration<double, micro>(random_delay_us(rng))
-          );
+      ++idle;
+      then = account(spinning_ns, then);
+    }
+    withdraw();
+    current_worker = nullptr;
+    auto t = stats();
+    diary->info("{} {}, working {:.1f}ms, spinning {:.1f}ms, parked {:.1f}ms, latency p50 {:.1f}us p99 {:.1f}us",
+      t.tasks, plural(t.tasks, "task", "tasks"), t.times.working * 1e-6, t.times.spinning * 1e-6, t.times.parked * 1e-6,
+      t.latency.percentile(50) * 1e-3, t.latency.percentile(99) * 1e-3);
+  }
+
+  void worker::park() {
+    bump(parks);
+    auto then = steady_clock::now();
+    {
+      unique_lock<mutex> lock(park_mutex);
+      sleeping.store(true, memory_order_seq_cst);
+      p.sleepers.fetch_add(1, memory_order_seq_cst);
+      // whoever publishes work after this point will see that we're asleep and wake us,
+      // so we only need to look for work that was published before it.
+      atomic_thread_fence(memory_order_seq_cst);
+      if (!p.shutdown.load(memory_order_relaxed) && !work_available())
+        park_cv.wait(lock, [this] { return !sleeping.load(memory_order_relaxed); });
+      sleeping.store(false, memory_order_relaxed);
+      p.sleepers.fetch_sub(1, memory_order_relaxed);
+    }
+    account(parked_ns, then);
+  }
+
+  bool worker::wake() {
+    if (!sleeping.load(memory_order_seq_cst)) return false;
+    {
+      lock_guard<mutex> lock(park_mutex);
+      if (!sleeping.load(memory_order_relaxed)) return false; // someone beat us to it
+      sleeping.store(false, memory_order_relaxed);
+    }
+    park_cv.notify_one();
+    return true;
+  }
+
+  bool worker::work_available() const {
+    for (auto && c : p.submitted_count)
+      if (c.load(memory_order_relaxed) != 0) return true;
+    for (auto && m : mail)
+      if (!m.empty()) return true;
+    if (p.mode == scheduling::dealing) {
+      // we're advertising in our mailbox, so this is the only other way work reaches us
+      task * tp = p.s[i].data.load(memory_order_relaxed);
+      return tp != nullptr && tp != &detail::dummy_task::instance;
+    }
+    for (auto && w : p.workers)
+      for (auto && l : w->d)
+        if (!l.empty()) return true;
+    return false;
+  }
+
+  worker_times worker::times() const noexcept {
+    worker_times result;
+    result.working = working_ns.load(memory_order_relaxed);
+    result.spinning = spinning_ns.load(memory_order_relaxed);
+    result.parked = parked_ns.load(memory_order_relaxed);
+    return result;
+  }
+
+  worker_stats worker::stats() const noexcept {
+    worker_stats result;
+    result.tasks = tasks.load(memory_order_relaxed);
+    result.deals_attempted = deals_attempted.load(memory_order_relaxed);
+    result.deals = deals.load(memory_order_relaxed);
+    result.steal_attempts = steal_attempts.load(memory_order_relaxed);
+    result.steals = steals.load(memory_order_relaxed);
+    result.submissions = submissions.load(memory_order_relaxed);
+    result.parks = parks.load(memory_order_relaxed);
+    result.queue_depth = queue_depth.load(memory_order_relaxed);
+    result.max_queue_depth = max_queue_depth.load(memory_order_relaxed);
+    result.yields = yields.load(memory_order_relaxed);
+    result.affine = affine.load(memory_order_relaxed);
+    result.redirected = redirected.load(memory_order_relaxed);
+    result.failures = failures.load(memory_order_relaxed);
+    result.times = times();
+    result.latency = latency.read();
+    result.background_latency = background_latency.read();
+    return result;
+  }
+
+  worker_stats & worker_stats::operator += (const worker_stats & that) noexcept {
+    tasks += that.tasks;
+    deals_attempted += that.deals_attempted;
+    deals += that.deals;
+    steal_attempts += that.steal_attempts;
+    steals += that.steals;
+    submissions += that.submissions;
+    parks += that.parks;
+    queue_depth += that.queue_depth;
+    max_queue_depth = std::max(max_queue_depth, that.max_queue_depth);
+    yields += that.yields;
+    affine += that.affine;
+    redirected += that.redirected;
+    failures += that.failures;
+    times.working += that.times.working;
+    times.spinning += that.times.spinning;
+    times.parked += that.times.parked;
+    latency += that.latency;
+    background_latency += that.background_latency;
+    return *this;
+  }
+
+  bool worker::try_run_one() {
+    task t;
+    priority found;
+    if (!try_acquire(t, found, guest())) return false; // guests are usually the render thread, waiting on something critical
+    if (t.enqueued != 0) {
+      uint64_t waited = uint64_t(std::max<int64_t>(0, stamp() - t.enqueued));
+      (found == priority::critical ? latency : background_latency).record(waited);
+    }
+    if (p.mode == scheduling::dealing) maybe_deal();
+    run(t, found);
+    bump(tasks);
+    return true;
+  }
+
+  // look everywhere for critical work before settling for background work
+  bool worker::try_acquire(task & t, priority & found, bool critical_only) {
+    found = priority::critical;
+    if (try_pop(t, priority::critical)) return true;
+    if (try_affine(t, priority::critical)) return true;
+    if (try_receive(t, found)) {
+      if (found == priority::critical || !critical_only) return true;
+      q[int(found)].push_back(std::move(t)); // it can wait until we're done yielding
+      found = priority::critical;
+    }
+    if (p.try_take_submitted(t, priority::critical)) {
+      bump(submissions);
+      withdraw();
+      return true;
+    }
+    if (try_steal(t, priority::critical)) return true;
+    if (critical_only) return false;
+
+    found = priority::background;
+    if (try_pop(t, priority::background) || try_affine(t, priority::background)) {
+      withdraw(); // we may be at this a while, and deals to us would sit in our mailbox until we're done
+      return true;
+    }
+    if (p.try_take_submitted(t, priority::background)) {
+      bump(submissions);
+      withdraw();
+      return true;
+    }
+    return try_steal(t, priority::background);
+  }
+
+  bool worker::try_pop(task & t, priority lane) {
+    if (guest()) return false;
+    if (p.mode == scheduling::stealing) {
+      task * tp;
+      if (!d[int(lane)].pop(tp)) return false;
+      t = task::unbox(tp);
+    } else {
+      auto & local = q[int(lane)];
+      if (local.empty()) return false;
+      t = std::move(local.back());
+      local.pop_back();
+    }
+    note_queue_depth();
+    return true;
+  }
+
+  bool worker::try_affine(task & t, priority lane) {
+    if (guest() || !mail[int(lane)].pop(t)) return false;
+    bump(affine);
+    return true;
+  }
+
+  bool worker::try_receive(task & t, priority & found) {
+    if (guest() || p.mode != scheduling::dealing) return false; // guests have no mailbox
+    task * tp = p.s[i].data.load(memory_order_acquire);
+    if (tp == &detail::dummy_task::instance) {
+      p.s[i].data.store(nullptr, memory_order_relaxed); // acquire: advertise that we'll take a deal
+      return false;
+    }
+    if (tp == nullptr) return false;
+    p.s[i].data.store(&detail::dummy_task::instance, memory_order_relaxed); // stop accepting deals
+    found = lane_of(tp);
+    t = task::unbox(untag(tp));
+    return true;
+  }
+
+  bool worker::try_steal(task & t, priority lane) {
+    if (p.mode != scheduling::stealing || (p.N <= 1 && !guest())) return false;
+    // take the oldest (and typically largest) job a random victim has
+    bump(steal_attempts);
+    task * tp;
+    if (p.workers[random_peer()]->d[int(lane)].steal(tp) != stealing::stolen) return false;
+    bump(steals);
+    t = task::unbox(tp);
+    return true;
+  }
+
+  void worker::withdraw() {
+    if (guest() || p.mode != scheduling::dealing) return;
+    task * expected = nullptr;
+    if (!p.s[i].data.compare_exchange_strong(expected, &detail::dummy_task::instance, memory_order_acq_rel)
+      && expected != &detail::dummy_task::instance) {
+      // a peer dealt to us in the meantime, keep it
+      p.s[i].data.store(&detail::dummy_task::instance, memory_order_relaxed);
+      q[int(lane_of(expected))].push_back(task::unbox(untag(expected)));
+    }
+  }
+
+  void worker::maybe_deal() {
+    if (p.N <= 1 || guest()) return; // we have peers, so see if we should hand off work
+    auto then = high_resolution_clock::now();
+    // communicate if we should deal and we have something to deal out, critical work first
+    priority lane = q[int(priority::critical)].empty() ? priority::background : priority::critical;
+    auto & local = q[int(lane)];
+    if (then > next_deal && !local.empty()) {
+      bump(deals_attempted);
+      int j = random_peer();
+
+      task * expected = nullptr;
+      // weak should be fine, we're already in an outer loop, we'll come back
+      // on excessively weak architectures, this might mean that the effective delay is much higher though
+      if (p.s[j].data.load(memory_order_relaxed) == nullptr) {
+        task * tp = task::box(std::move(local.front()));
+        if (p.s[j].data.compare_exchange_weak(expected, tag(tp, lane), memory_order_seq_cst)) {
+          local.pop_front(); // we gave the front of the deque away
+          bump(deals);
+          note_queue_depth();
+          p.workers[j]->wake(); // they may have given up waiting for it
+        } else {
+          local.front() = task::unbox(tp); // take it back
         }
       }
-      try {
-        t(*this);
-      } catch (std::exception & e) {
-        p.shutdown.store(true, std::memory_order_release);
-        diary->critical("exception: {}, shutting down pool", e.what());
-        throw;
-      } catch (...) {
-        p.shutdown.store(true, std::memory_order_release);
-        diary->critical("non std::exception caught, shutting down pool");
-        throw;
-      }
+
+      // don't resample time and round down to err on the side of too much sharing.
+      next_deal = then - chrono::floor<high_resolution_clock::duration>(
+        duration<double, micro>(random_delay_us(rng))
+      );
+    }
+  }
+
+  // anything that wants its exceptions back runs inside a task_group or one of the blocking forms in parallel.h,
+  // which catch them before we can. what reaches us had nobody waiting on it, and one bad asset job is no reason
+  // to take every other job in the pool down with it
+  void worker::run(task & t, priority l) {
+    priority outer = lane; // we may be helping out from inside another task
+    lane = l;
+    try {
+      t(*this);
+    } catch (std::exception & e) {
+      bump(failures);
+      diary->error("task failed: {}", e.what());
+    } catch (...) {
+      bump(failures);
+      diary->error("task failed with a non std::exception");
+    }
+    lane = outer;
+  }
+
+  void pool::run(task t) {
+    worker * w = worker::current();
+    if (w != nullptr && &w->p == this)
+      w->spawn(std::move(t));
+    else
+      inject(std::move(t));
+  }
+
+  void pool::run(priority lane, task t, steady_clock::time_point deadline) {
+    worker * w = worker::current();
+    if (w != nullptr && &w->p == this)
+      w->spawn(lane, std::move(t), deadline);
+    else
+      inject(std::move(t), lane, deadline);
+  }
+
+  void pool::run(int i, task t) {
+    worker * w = worker::current();
+    run(i, w != nullptr && &w->p == this ? w->lane : priority::critical, std::move(t));
+  }
+
+  void pool::run(int i, priority lane, task t) {
+    worker & target = *workers[size_t((i % N + N) % N)];
+    if (target.backlog() >= affinity_limit) {
+      // better somewhere cold than stuck behind everything else it has to do
+      target.redirected.fetch_add(1, memory_order_relaxed);
+      run(lane, std::move(t));
+      return;
+    }
+    t.enqueued = stamp();
+    target.mail[int(lane)].push(std::move(t));
+    atomic_thread_fence(memory_order_seq_cst); // pairs with the fence in worker::park
+    target.wake();
+  }
+
+  void pool::inject(task t, priority lane, steady_clock::time_point deadline) {
+    t.enqueued = stamp();
+    unique_lock<mutex> lock(submitted_mutex);
+    auto & queue = submitted[int(lane)];
+    queue.emplace(deadline, std::move(t)); // after anything else with the same deadline
+    if (lane == priority::background) background_deadline.store(ticks(queue.begin()->first), memory_order_relaxed);
+    submitted_count[int(lane)].fetch_add(1, memory_order_release);
+    lock.unlock();
+    notify_one();
+  }
+
+  void pool::notify_one() {
+    atomic_thread_fence(memory_order_seq_cst); // pairs with the fence in worker::park
+    if (sleepers.load(memory_order_relaxed) == 0) return;
+    unsigned start = next_wake.fetch_add(1, memory_order_relaxed);
+    for (int k = 0; k < N; ++k)
+      if (workers[(start + k) % N]->wake()) return;
+  }
+
+  void pool::notify_all() {
+    atomic_thread_fence(memory_order_seq_cst);
+    for (auto && w : workers) w->wake();
+  }
+
+  worker_times pool::times() const noexcept {
+    worker_times result;
+    for (auto && w : workers) {
+      worker_times t = w->times();
+      result.working += t.working;
+      result.spinning += t.spinning;
+      result.parked += t.parked;
     }
-    diary->info("stopping work");
-  } // worker::main
+    return result;
+  }
+
+  worker_stats pool::stats() const noexcept {
+    worker_stats result;
+    for (auto && w : workers) result += w->stats();
+    return result;
+  }
+
+  void pool::dump_stats(ostream & out) const {
+    auto line = [&](const string & name, const worker_stats & s) {
+      out << fmt::format("{:>8} {:>11} {:>11} {:>11} {:>11} {:>11} {:>11} {:>11} {:>11} {:>8} {:>8} {:>8} {:>11.1f} {:>11.1f} {:>11.1f} {:>11.1f} {:>11.1f} {:>11.1f}\n",
+        name, s.tasks, s.deals_attempted, s.deals, s.steal_attempts, s.steals, s.submissions, s.affine, s.redirected, s.failures, s.parks, s.max_queue_depth,
+        s.times.working * 1e-6, s.times.spinning * 1e-6, s.times.parked * 1e-6,
+        s.latency.percentile(50) * 1e-3, s.latency.percentile(99) * 1e-3, s.latency.max() * 1e-3);
+    };
+    out << fmt::format("{} {}, {}\n", N, plural(N, "worker", "workers"), mode == scheduling::dealing ? "dealing" : "stealing");
+    out << fmt::format("{:>8} {:>11} {:>11} {:>11} {:>11} {:>11} {:>11} {:>11} {:>11} {:>8} {:>8} {:>8} {:>11} {:>11} {:>11} {:>11} {:>11} {:>11}\n",
+      "worker", "tasks", "deal tries", "deals", "steal tries", "steals", "submitted", "affine", "redirected", "failed", "parks", "max q",
+      "work ms", "spin ms", "park ms", "p50 us", "p99 us", "max us");
+    for (auto && w : workers) line(to_string(w->i), w->stats());
+    line("total", stats());
+  }
+
+  bool pool::try_take_submitted(task & t, priority lane) {
+    const int background = int(priority::background);
+    int64_t due = 0; // background work with a deadline before this is promoted
+    if (lane == priority::critical && submitted_count[background].load(memory_order_relaxed) != 0)
+      due = ticks(steady_clock::now() + duration_cast<steady_clock::duration>(duration<double>(deadline_slack)));
+    bool promote = background_deadline.load(memory_order_relaxed) <= due;
+    if (submitted_count[int(lane)].load(memory_order_acquire) == 0 && !promote) return false;
+
+    lock_guard<mutex> lock(submitted_mutex);
+    auto take = [&](int l) {
+      auto & queue = submitted[l];
+      t = std::move(queue.begin()->second);
+      queue.erase(queue.begin());
+      submitted_count[l].fetch_sub(1, memory_order_relaxed);
+      if (l == background)
+        background_deadline.store(queue.empty() ? numeric_limits<int64_t>::max() : ticks(queue.begin()->first), memory_order_relaxed);
+    };
+    if (!submitted[int(lane)].empty()) take(int(lane));
+    else if (promote && !submitted[background].empty() && ticks(submitted[background].begin()->first) <= due) take(background);
+    else return false;
+    return true;
+  }
+
+  uint64_t pool::next_serial() noexcept {
+    static atomic<uint64_t> serials{ 0 };
+    return serials.fetch_add(1, memory_order_relaxed) + 1;
+  }
+
+  worker & pool::guest() {
+    // remember the last pool we were asked about, the render thread only ever waits on the one
+    struct last_guest {
+      const pool * p;
+      uint64_t serial;
+      worker * w;
+    };
+    static thread_local last_guest last{ nullptr, 0, nullptr };
+    if (last.p == this && last.serial == serial) return *last.w;
+
+    lock_guard<mutex> lock(guest_mutex);
+    auto & slot = guests[this_thread::get_id()];
+    if (!slot) slot.reset(new worker(*this));
+    last = last_guest{ this, serial, slot.get() };
+    return *slot;
+  }
 
   pool::~pool() {
-    shutdown.store(true, std::memory_order_release);
+    shutdown.store(true, std::memory_order_seq_cst);
+    notify_all();
     for (auto && thread : threads)
       thread.join();
+    for (int i = 0; i < N; ++i) {
+      task * tp = s[i].data.load(memory_order_acquire);
+      if (tp != nullptr && tp != &detail::dummy_task::instance) task::unbox(untag(tp)); // dealt but never picked up
+    }
+  }
+
+  int available_workers(int reserved) {
+    return std::max(1, int(topology::system().placement(reserved).size()));
+  }
+
+  static atomic<pool *> current_scheduler { nullptr };
+
+  scheduler::scheduler(int reserved, scheduling mode)
+    : p(available_workers(reserved), mode, topology::system().placement(reserved), mt19937(random_device()())) {
+    pool * expected = nullptr;
+    bool installed = current_scheduler.compare_exchange_strong(expected, &p, memory_order_acq_rel);
+    assert(installed); // only one scheduler at a time
+    (void) installed;
+    log("main")->info("scheduler: {} {}", p.N, plural(p.N, "worker", "workers"));
+  }
+
+  scheduler::~scheduler() {
+    current_scheduler.store(nullptr, memory_order_release);
+  }
+
+  pool * scheduler::current() noexcept {
+    return current_scheduler.load(memory_order_acquire);
   }
 
   detail::dummy_task detail::dummy_task::instance;
-}
\ No newline at end of file
+}
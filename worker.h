@@ -2,89 +2,303 @@
 
 #include <deque>
 #include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <iosfwd>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 #include <chrono>
 #include <random>
 #include <math.h>
 
 #include "cache_isolated.h"
+#include "chase_lev_deque.h"
+#include "histogram.h"
+#include "inbox.h"
+#include "noncopyable.h"
+#include "spdlog.h"
+#include "task.h"
+#include "topology.h"
 
-// Implementation based on the steal-one sender-initiated variant of 
+// Implementation based on the steal-one sender-initiated variant of
 // [Scheduling Parallel Programs by Work Stealing with Private Deques](http://www.chargueraud.org/research/2013/ppopp/full.pdf)
 // by Acar, Charguraud, and Rainey
+//
+// scheduling::stealing swaps this for the classic receiver-initiated scheme, where each worker
+// owns a chase_lev_deque and idle workers take from the top of a random victim directly.
 namespace framework {
 
   struct pool;
   struct worker;
 
-  using task = std::function<void(worker&)>;
-
-  static const size_t max_workers = 16;
   static const double task_delta = 0.0002;
+  static const double steal_widening = 0.5; // chance of looking one level further out in the machine for a victim
+
+  // idle workers spin with doubling bursts of pauses, then yield, then park until someone has work for them
+  static const int spin_rounds = 10;
+  static const int yield_rounds = 20;
+
+  static const double deadline_slack = 0.002; // seconds before its deadline that queued background work is treated as critical
+
+  static const size_t affinity_limit = 32; // queued work past which pool::run(i, ...) stops waiting on worker i and lets anyone take it
+
+  enum class scheduling : int {
+    dealing = 0, // busy workers periodically deal the front of their private deque to an idle peer
+    stealing = 1 // idle workers steal directly from a busy peer's chase_lev_deque
+  };
+
+  // Work comes in two lanes. Workers always look everywhere for critical work before they start anything from the
+  // background lane, and work a task spawns stays in its lane. Long running background work should call
+  // yield_to_critical() now and then; parallel_for and friends do so between chunks.
+  enum class priority : int {
+    critical = 0, // needed for the next frame
+    background = 1 // sky rebuilds, decoding, baking
+  };
+
+  static const int lanes = 2;
+
+  // where worker time has gone, in nanoseconds
+  struct worker_times {
+    uint64_t working = 0; // running tasks, or looking for one right after running one
+    uint64_t spinning = 0; // unemployed, but awake
+    uint64_t parked = 0; // asleep
+  };
 
-  struct worker {
-    template <typename SeedSeq> worker(pool &p, int i, SeedSeq & seed) : rng(seed), i(i), p(p) {}
+  // what a worker has been up to. relaxed counters, bumped only by the worker itself, so these cost next to
+  // nothing to keep and are only roughly consistent with one another when read while the pool is running
+  struct worker_stats {
+    uint64_t tasks = 0; // run to completion
+    uint64_t deals_attempted = 0, deals = 0; // scheduling::dealing: times we tried to hand work to a peer, and succeeded
+    uint64_t steal_attempts = 0, steals = 0; // scheduling::stealing
+    uint64_t submissions = 0; // taken from the pool's shared queue
+    uint64_t parks = 0;
+    uint64_t queue_depth = 0, max_queue_depth = 0; // local jobs, as of the last time we looked
+    uint64_t yields = 0; // times background work stepped aside for critical work
+    uint64_t affine = 0; // taken from our inbox, see pool::run(int, task)
+    uint64_t redirected = 0; // sent our way, but we were too busy, so it went to whoever was free
+    uint64_t failures = 0; // tasks that threw and had nobody to catch it, see worker::run
+    worker_times times;
+    histogram::snapshot latency; // nanoseconds from enqueue to start, critical work
+    histogram::snapshot background_latency; // likewise for the background lane
+
+    worker_stats & operator += (const worker_stats & that) noexcept;
+  };
+
+  struct worker : noncopyable {
+    template <typename SeedSeq> worker(pool &p, int i, SeedSeq & seed) : rng(seed), p(p), i(i) { initialize(); }
+    explicit worker(pool & p); // a guest, lets a thread outside of the pool help out while it waits on the pool. see pool::guest
+    ~worker();
     std::mt19937 rng;
-    std::deque<task> q; // local jobs
+    std::deque<task> q[lanes]; // local jobs by priority, scheduling::dealing
+    chase_lev_deque<task*> d[lanes]; // local jobs by priority, scheduling::stealing
+    inbox mail[lanes]; // jobs sent to us in particular by anyone, see pool::run(int, task). only we take from these
     pool & p; // owning pool
-    int i; // worker id
+    int i; // worker id, -1 for a guest
+    int pinned = -1; // logical processor we're pinned to, -1 if we float
+    priority lane = priority::critical; // of whatever we're running, and so of anything we spawn
+
+    static worker * current() noexcept; // the worker or guest running on this thread, if any
+
+    bool guest() const noexcept { return i < 0; }
+
+    // makes a guest the current worker on this thread until the end of the scope
+    struct enlisted : noncopyable {
+      explicit enlisted(worker & w) noexcept;
+      ~enlisted();
+      worker * previous;
+    };
+
+    void spawn(task t); // push a job onto our local queue, in our current lane
+    void spawn(priority lane, task t, std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max()); // deadlines only order work that passes through the pool's shared queue
+    bool has_local_work() const noexcept; // is there anything in our lane a peer could take from us? drives lazy splitting
+    bool try_run_one(); // acquire and run a single job without blocking. returns false if none could be found
+    bool critical_work_waiting() const noexcept; // cheap, and only a hint
+    void yield_to_critical() { // from background work: run whatever critical work is waiting, then carry on
+      if (lane == priority::background && critical_work_waiting()) run_critical();
+    }
+    bool wake(); // wake this worker if it is parked. returns false if it wasn't
+    worker_times times() const noexcept;
+    worker_stats stats() const noexcept;
     void main();
+  private:
+    void initialize();
+    bool try_acquire(task & t, priority & found, bool critical_only = false);
+    bool try_pop(task & t, priority lane);
+    bool try_affine(task & t, priority lane); // our inbox
+    bool try_receive(task & t, priority & found); // scheduling::dealing: check our mailbox
+    bool try_steal(task & t, priority lane); // scheduling::stealing
+    void run_critical();
+    void withdraw(); // stop advertising for work in our mailbox
+    void maybe_deal(); // scheduling::dealing: periodically hand the front of q to an idle peer
+    int random_peer();
+    void run(task & t, priority lane); // execute t. anything it throws is logged and dropped, the pool carries on
+    void park(); // sleep until woken by a peer with work for us
+    bool work_available() const; // is there anything we could take right now? used to avoid missed wakeups
+    size_t local_work() const noexcept;
+    size_t backlog() const noexcept; // what pool::run(i, ...) weighs against affinity_limit. callable from anywhere
+    void note_queue_depth() noexcept;
+
+    std::chrono::high_resolution_clock::time_point next_deal;
+    std::exponential_distribution<double> random_delay_us{ 100.0 }; // 0.1ms expected task size
+    shared_ptr<logger> diary;
+
+    // victims, nearest first. tiers[k] is the end of the peers that are within k levels of the machine hierarchy of us
+    std::vector<int> peers;
+    std::vector<size_t> tiers;
+
+    std::mutex park_mutex;
+    std::condition_variable park_cv;
+    std::atomic<bool> sleeping{ false };
+    std::atomic<uint64_t> working_ns{ 0 }, spinning_ns{ 0 }, parked_ns{ 0 };
+    std::atomic<uint64_t> tasks{ 0 }, deals_attempted{ 0 }, deals{ 0 }, steal_attempts{ 0 }, steals{ 0 }, submissions{ 0 }, parks{ 0 };
+    std::atomic<uint64_t> queue_depth{ 0 }, max_queue_depth{ 0 }, yields{ 0 }, affine{ 0 }, failures{ 0 };
+    std::atomic<uint64_t> redirected{ 0 }; // bumped by whoever sent us the work, so this one is a locked add
+    friend struct pool;
+    histogram latency, background_latency;
   };
 
   struct pool {
-    // in between the time we start and the time we stop tasks are running. 
+    // in between the time we start and the time we stop tasks are running.
     // This provides no mechanism to detect their state, however.
     template <typename ... Ts> pool(int N, std::mt19937 r, Ts && ... args); // give us a list of starting tasks
+    template <typename ... Ts> pool(int N, scheduling mode, std::mt19937 r, Ts && ... args);
+    // pin worker i to logical processor placement[i % placement.size()], see topology::placement
+    template <typename ... Ts> pool(int N, scheduling mode, std::vector<int> placement, std::mt19937 r, Ts && ... args);
     virtual ~pool();
 
     int N;
-    framework::cache_isolated<std::atomic<task*>> s[max_workers]; // messaging primitives
+    scheduling mode;
+    std::vector<int> placement; // empty if our workers float
+    std::unique_ptr<framework::cache_isolated<std::atomic<task*>>[]> s; // messaging primitives, scheduling::dealing only
     std::vector<std::thread> threads;
     std::atomic<bool> shutdown;
-    std::vector<worker> workers;
+    std::vector<unique_ptr<worker>> workers;
+
+    // work submitted from outside of the pool, picked up by whichever worker runs dry first.
+    // earliest deadline first in each lane, and in order of submission after that
+    std::mutex submitted_mutex;
+    std::multimap<std::chrono::steady_clock::time_point, task> submitted[lanes];
+    std::atomic<size_t> submitted_count[lanes];
+    std::atomic<int64_t> background_deadline; // earliest in submitted[background], in steady_clock ticks
+
+    std::atomic<int> sleepers{ 0 }; // parked workers
+    std::atomic<unsigned> next_wake{ 0 }; // spreads wakeups around
+
+    // the calling thread's guest worker, built the first time it waits on us and kept until we shut down,
+    // so the render thread doesn't pay for a fresh one every frame
+    worker & guest();
+    std::mutex guest_mutex;
+    std::map<std::thread::id, std::unique_ptr<worker>> guests;
+    const uint64_t serial = next_serial(); // tells apart pools that happen to reuse an address
+    static uint64_t next_serial() noexcept;
+
+    void notify_one(); // new work is visible to everyone, wake a parked worker if there is one
+    void notify_all();
+    worker_times times() const noexcept; // summed over all of our workers
+    worker_stats stats() const noexcept; // likewise. guests aren't counted
+    void dump_stats(std::ostream & out) const; // a line per worker and a total, see scheduler_window
 
-    void run(task) {} // enqueue a task
+    void run(task t); // enqueue a task. from one of our own workers this is just worker::spawn
+    void run(priority lane, task t, std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max());
+    void inject(task t, priority lane = priority::critical, std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max()); // enqueue a task on the shared submission queue
+    bool try_take_submitted(task & t, priority lane); // critical also takes background work that is about to miss its deadline
 
-    template <typename ... T, typename F> void run(F && f, T && ... args) {
-      run(std::function(std::forward(f), std::forward(args)...));
+    // bind arguments to f. the arguments are fixed when the task is built, the worker is ignored
+    template <typename F, typename A, typename ... T, typename = typename std::enable_if<!std::is_integral<typename std::decay<F>::type>::value>::type>
+    void run(F && f, A && a, T && ... args) {
+      run(task(std::bind(std::forward<F>(f), std::forward<A>(a), std::forward<T>(args)...)));
     }
 
-    void run(int, task) {} // enqueue a task with affinity    
+    // enqueue a task with affinity for worker i % N, to keep related work on a warm cache. anyone may call this, the
+    // render thread included. if worker i already has affinity_limit or more jobs queued, the task is run as if
+    // through run(lane, t) instead, where any idle worker can take it
+    void run(int i, task t);
+    void run(int i, priority lane, task t);
 
-    template <typename ... T, typename F>
-    void run(int i, F && f, T && ... args) {
-      run(i, std::function(std::forward(f), std::forward(args)...));
+    // co_await p.schedule() to continue on one of our workers, see coroutine.h
+    struct schedule_awaiter {
+      pool & p;
+      priority lane;
+      bool await_ready() const noexcept { return false; }
+      template <typename Handle> void await_suspend(Handle h) {
+        p.run(lane, task([h](worker &) mutable { h.resume(); }));
+      }
+      void await_resume() const noexcept {}
+    };
+    schedule_awaiter schedule(priority lane = priority::critical) noexcept { return schedule_awaiter{ *this, lane }; }
+
+    template <typename F, typename A, typename ... T>
+    void run(int i, F && f, A && a, T && ... args) {
+      run(i, task(std::bind(std::forward<F>(f), std::forward<A>(a), std::forward<T>(args)...)));
     }
   };
 
+  // the number of workers for a pool that spans the machine, leaving `reserved` hardware threads free
+  // for threads we don't own, like the render thread
+  int available_workers(int reserved = 1);
+
+  // The process-wide pool. Framework code with a loop worth running in parallel (the sky, spherical
+  // harmonic projection, bakers) uses this rather than starting threads of its own, so we never
+  // oversubscribe the machine and fight the compositor. main owns it, and there is at most one at a time.
+  struct scheduler : noncopyable {
+    explicit scheduler(int reserved = 1, scheduling mode = scheduling::dealing);
+    ~scheduler();
+    static pool * current() noexcept; // nullptr if no scheduler is live
+    pool p;
+  };
+
+  // yield_to_critical() on this thread's worker, if it has one
+  inline void yield_to_critical() {
+    if (worker * w = worker::current()) w->yield_to_critical();
+  }
+
+  // counters and latency percentiles for the scheduler's workers, with a button to dump them to a file
+  void scheduler_window(bool * open);
+
   namespace detail {
     struct dummy_task : task {
-      static dummy_task instance;    
+      static dummy_task instance;
     };
   };
 
-  template <typename ... Ts> pool::pool(int N, std::mt19937 rng, Ts && ... args) : N(N) {
+  template <typename ... Ts> pool::pool(int N, std::mt19937 rng, Ts && ... args)
+    : pool(N, scheduling::dealing, rng, std::forward<Ts>(args)...) {}
 
-    for (int i = 0;i < N;++i)
-      s[i].data.store(&detail::dummy_task::instance, memory_order_relaxed);
+  template <typename ... Ts> pool::pool(int N, scheduling mode, std::mt19937 rng, Ts && ... args)
+    : pool(N, mode, std::vector<int>(), rng, std::forward<Ts>(args)...) {}
 
-    shutdown.store(false, memory_order_relaxed);
+  template <typename ... Ts> pool::pool(int N, scheduling mode, std::vector<int> placement, std::mt19937 rng, Ts && ... args)
+    : N(N), mode(mode), placement(std::move(placement)), s(new framework::cache_isolated<std::atomic<task*>>[N]) {
+    assert(0 < N);
+
+    for (auto && c : submitted_count) c.store(0, std::memory_order_relaxed);
+    background_deadline.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
 
     for (int i = 0;i < N;++i)
-      workers.push_back(worker(*this, i, seed_seq{ rng(), rng(), rng(), rng() }));
+      s[i].data.store(&detail::dummy_task::instance, std::memory_order_relaxed);
+
+    shutdown.store(false, std::memory_order_relaxed);
+
+    for (int i = 0;i < N;++i) {
+      std::seed_seq seed{ rng(), rng(), rng(), rng() };
+      workers.emplace_back(new worker(*this, i, seed));
+    }
 
     {
       int i = 0;
-      // pre-load our starting tasks
-      for (auto && task : { std::function<void(worker&)>(args) ... }) {
-        workers[i++].q.push_front(task); // distribute tasks round-robin to start before the threads kick in
-        i %= N;
-      }
+      // pre-load our starting tasks, distributing them round-robin to start before the threads kick in
+      using expand = int[];
+      (void) expand { 0, (workers[i++ % N]->spawn(task(std::forward<Ts>(args))), 0)... };
     }
 
     for (int i = 0; i < N;++i) {
-      threads.push_back(std::thread([&w(workers[i])] { w.main(); }));
+      threads.push_back(std::thread([&w = *workers[i]] { w.main(); }));
     }
   }
-}
\ No newline at end of file
+}